@@ -16,6 +16,7 @@
 
 #include "stwtypes.hpp"
 
+#include "TglTasks.hpp"
 #include "C_OscNode.hpp"
 #include "C_OscDiagProtocolBase.hpp"
 
@@ -63,9 +64,14 @@ protected:
    virtual void m_OnReadDataPoolNvmEventReceived(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                                  const uint16_t ou16_ElementIndex);
 
+   void m_SetContentFromBlob(C_OscNodeDataPoolContent & orc_Content, const std::vector<uint8_t> & orc_Data) const;
+   void m_GetContentAsBlob(const C_OscNodeDataPoolContent & orc_Content, std::vector<uint8_t> & orc_Data) const;
+
    C_OscNode * mpc_Node;
    uint32_t mu32_NodeIndex;
    C_OscDiagProtocolBase * mpc_DiagProtocol;
+   ///protects the values of mpc_Node's data pool elements against concurrent access by dealer and application
+   mutable stw::tgl::C_TglCriticalSection mc_CriticalSectionContent;
 
 private:
    C_OscDataDealer(const C_OscDataDealer & orc_Source);               //not implemented -> prevent copying
@@ -546,7 +546,8 @@ int32_t stw::tgl::TglCreateDirectory(const C_SclString & orc_Directory)
    if (TglDirectoryExists(orc_Directory.c_str()) == false)
    {
       x_Return = CreateDirectoryA(orc_Directory.c_str(), NULL);
-      if (x_Return == FALSE)
+      //another thread or process might have created the directory in the meantime
+      if ((x_Return == FALSE) && (TglDirectoryExists(orc_Directory) == false))
       {
          s32_Result = -1;
       }
@@ -648,6 +649,32 @@ int32_t stw::tgl::TglRemoveDirectory(const C_SclString & orc_Directory, const bo
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rename file
+
+   An existing file with the new name is replaced.
+   Within one volume readers see either the complete old or the complete new file.
+
+   \param[in]   orc_OldName    name of file to rename (absolute or relative)
+   \param[in]   orc_NewName    new name of file (absolute or relative)
+
+   \return
+   0     file renamed
+   -1    could not rename file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t stw::tgl::TglRenameFile(const C_SclString & orc_OldName, const C_SclString & orc_NewName)
+{
+   int32_t s32_Result = 0;
+
+   if (MoveFileExA(orc_OldName.c_str(), orc_NewName.c_str(),
+                   MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == FALSE)
+   {
+      s32_Result = -1;
+   }
+   return s32_Result;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Check whether specified path is a relative path
 
@@ -680,3 +707,144 @@ bool stw::tgl::TglIsRelativePath(const C_SclString & orc_Path)
    }
    return !q_IsAbsolute;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Initialize to "nothing mapped".
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglFileMapping::C_TglFileMapping(void) :
+   mpu8_Data(NULL),
+   mu32_Size(0U),
+   mpv_File(INVALID_HANDLE_VALUE), //lint !e923 //provided by system headers; no problems expected
+   mpv_Mapping(NULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Destructor
+
+   Release mapping (if any).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglFileMapping::~C_TglFileMapping(void)
+{
+   this->Unmap();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Map complete file into memory
+
+   Maps the specified file read-only into the address space of the process.
+   An already existing mapping is released first.
+   The mapping stays valid until Unmap() is called.
+
+   An empty file results in a valid "mapping" with no data (GetData() returns NULL, GetSize() returns 0).
+
+   \param[in]     orc_FileName     path to file
+
+   \return
+   C_NO_ERR    file mapped
+   C_RD_WR     could not open or map file
+   C_RANGE     file too big to be mapped (> 4GB)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_TglFileMapping::Map(const C_SclString & orc_FileName)
+{
+   int32_t s32_Return = C_RD_WR;
+   HANDLE pv_File;
+
+   this->Unmap();
+
+   pv_File = CreateFileA(orc_FileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                         FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+   if (pv_File != INVALID_HANDLE_VALUE) //lint !e923 //provided by system headers; no problems expected
+   {
+      DWORD u32_SizeHigh = 0U;
+      const DWORD u32_SizeLow = GetFileSize(pv_File, &u32_SizeHigh);
+
+      mpv_File = pv_File;
+      if ((u32_SizeLow == INVALID_FILE_SIZE) && (GetLastError() != NO_ERROR))
+      {
+         //could not get size
+      }
+      else if (u32_SizeHigh != 0U)
+      {
+         s32_Return = C_RANGE;
+      }
+      else if (u32_SizeLow == 0U)
+      {
+         //nothing to map; CreateFileMapping does not accept empty files
+         s32_Return = C_NO_ERR;
+      }
+      else
+      {
+         mpv_Mapping = CreateFileMappingA(pv_File, NULL, PAGE_READONLY, 0U, 0U, NULL);
+         if (mpv_Mapping != NULL)
+         {
+            mpu8_Data = static_cast<const uint8_t *>(MapViewOfFile(mpv_Mapping, FILE_MAP_READ, 0U, 0U, 0U));
+            if (mpu8_Data != NULL)
+            {
+               mu32_Size = u32_SizeLow;
+               s32_Return = C_NO_ERR;
+            }
+         }
+      }
+      if (s32_Return != C_NO_ERR)
+      {
+         this->Unmap();
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Release mapping
+
+   Pointers returned by GetData() are invalid after this call.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_TglFileMapping::Unmap(void)
+{
+   if (mpu8_Data != NULL)
+   {
+      (void)UnmapViewOfFile(mpu8_Data);
+   }
+   if (mpv_Mapping != NULL)
+   {
+      (void)CloseHandle(mpv_Mapping);
+   }
+   if (mpv_File != INVALID_HANDLE_VALUE) //lint !e923 //provided by system headers; no problems expected
+   {
+      (void)CloseHandle(mpv_File);
+   }
+   mpu8_Data = NULL;
+   mu32_Size = 0U;
+   mpv_File = INVALID_HANDLE_VALUE; //lint !e923 //provided by system headers; no problems expected
+   mpv_Mapping = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pointer to mapped file content
+
+   \return
+   start of file content (NULL if nothing is mapped or file is empty)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8_t * C_TglFileMapping::GetData(void) const
+{
+   return mpu8_Data;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get size of mapped file content
+
+   \return
+   size of file content in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_TglFileMapping::GetSize(void) const
+{
+   return mu32_Size;
+}
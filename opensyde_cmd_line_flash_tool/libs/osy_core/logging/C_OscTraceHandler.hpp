@@ -0,0 +1,109 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Recording of timed scopes for profiling (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCTRACEHANDLER_HPP
+#define C_OSCTRACEHANDLER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <string>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "TglTasks.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Accumulated durations of all recorded events with the same name
+class C_OscTraceSummary
+{
+public:
+   C_OscTraceSummary(void);
+
+   stw::scl::C_SclString c_Name;
+   uint32_t u32_Count;
+   uint64_t u64_TotalUs;
+   uint64_t u64_MaxUs;
+};
+
+///Handler class for recording trace events
+class C_OscTraceHandler
+{
+public:
+   static void h_SetActive(const bool oq_Active);
+   static bool h_IsActive(void);
+   static void h_Clear(void);
+   static uint32_t h_GetNumEvents(void);
+
+   static void h_AddEvent(const stw::scl::C_SclString & orc_Category, const stw::scl::C_SclString & orc_Name,
+                          const stw::scl::C_SclString & orc_Detail, const uint64_t ou64_StartUs,
+                          const uint64_t ou64_DurationUs);
+   static int32_t h_ExportChromeTrace(const stw::scl::C_SclString & orc_FilePath);
+   static void h_GetSummary(const stw::scl::C_SclString & orc_Category, std::vector<C_OscTraceSummary> & orc_Summary);
+
+private:
+   ///Completed scope
+   class C_Event
+   {
+   public:
+      stw::scl::C_SclString c_Category;
+      stw::scl::C_SclString c_Name;
+      stw::scl::C_SclString c_Detail;
+      uint64_t u64_StartUs; ///< Start time (time base of TglGetTickCountUs)
+      uint64_t u64_DurationUs;
+      uint32_t u32_ThreadId;
+   };
+
+   static bool mhq_Active;
+   static std::vector<C_Event> mhc_Events;
+   static uint32_t mhu32_NumDroppedEvents;
+   static stw::tgl::C_TglCriticalSection mhc_CriticalSection;
+
+   static const uint32_t mhu32_MAX_EVENTS;
+
+   static void mh_AppendJsonString(std::string & orc_Json, const stw::scl::C_SclString & orc_Text);
+
+   //Avoid calling
+   C_OscTraceHandler(void);
+};
+
+///Records the time from construction to destruction as trace event; does nothing if tracing is not active
+class C_OscTraceScope
+{
+public:
+   C_OscTraceScope(const char_t * const opcn_Category, const char_t * const opcn_Name);
+   C_OscTraceScope(const char_t * const opcn_Category, const char_t * const opcn_Name,
+                   const stw::scl::C_SclString & orc_Detail);
+   ~C_OscTraceScope(void);
+
+private:
+   const char_t * const mpcn_Category; ///< Static text
+   const char_t * const mpcn_Name;     ///< Static text
+   stw::scl::C_SclString mc_Detail;
+   const bool mq_Active;
+   uint64_t mu64_StartUs;
+
+   //Avoid call
+   C_OscTraceScope(const C_OscTraceScope &);
+   C_OscTraceScope & operator =(const C_OscTraceScope &);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -19,6 +19,7 @@
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscSystemDefinitionFilerV2.hpp"
 #include "C_OscSystemDefinitionFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "TglFile.hpp"
 #include "TglUtils.hpp"
 #include "C_OscNodeSquadFiler.hpp"
@@ -90,6 +91,7 @@ int32_t C_OscSystemDefinitionFiler::h_LoadSystemDefinitionFile(C_OscSystemDefini
                                                                const stw::scl::C_SclString * const opc_ExpectedNodeName,
                                                                std::vector<C_SclString> * const opc_ErrorDetailsMissingDevices)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "System definition", orc_PathSystemDefinition);
    int32_t s32_Retval = C_NO_ERR;
 
    if (TglFileExists(orc_PathSystemDefinition) == true)
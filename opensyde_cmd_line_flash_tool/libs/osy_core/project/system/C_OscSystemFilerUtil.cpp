@@ -103,6 +103,8 @@ int32_t C_OscSystemFilerUtil::h_BusTypeStringToEnum(const stw::scl::C_SclString
    \param[in,out]  orc_FileXmlParser   XML parser
    \param[in]      orc_Path            File path
    \param[in]      orc_RootNode        Root node name
+   \param[in]      oq_ReadOnly         true: load with C_OscXmlParser::LoadFromFileReadOnly (parser can not be used
+                                        to modify the document; uses far less memory for large files)
 
    \return
    C_NO_ERR   data was read from file
@@ -112,13 +114,21 @@ int32_t C_OscSystemFilerUtil::h_BusTypeStringToEnum(const stw::scl::C_SclString
 */
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscSystemFilerUtil::h_GetParserForExistingFile(C_OscXmlParser & orc_FileXmlParser,
-                                                         const C_SclString & orc_Path, const C_SclString & orc_RootNode)
+                                                         const C_SclString & orc_Path, const C_SclString & orc_RootNode,
+                                                         const bool oq_ReadOnly)
 {
    int32_t s32_Retval = C_NO_ERR;
 
    if (TglFileExists(orc_Path))
    {
-      s32_Retval = orc_FileXmlParser.LoadFromFile(orc_Path);
+      if (oq_ReadOnly == true)
+      {
+         s32_Retval = orc_FileXmlParser.LoadFromFileReadOnly(orc_Path);
+      }
+      else
+      {
+         s32_Retval = orc_FileXmlParser.LoadFromFile(orc_Path);
+      }
       if (s32_Retval == C_NO_ERR)
       {
          if (orc_FileXmlParser.SelectRoot() != orc_RootNode)
@@ -32,7 +32,8 @@ public:
    static stw::scl::C_SclString h_BusTypeEnumToString(const C_OscSystemBus::E_Type oe_Type);
    static int32_t h_BusTypeStringToEnum(const stw::scl::C_SclString & orc_Type, C_OscSystemBus::E_Type & ore_Type);
    static int32_t h_GetParserForExistingFile(C_OscXmlParser & orc_FileXmlParser, const stw::scl::C_SclString & orc_Path,
-                                             const stw::scl::C_SclString & orc_RootNode);
+                                             const stw::scl::C_SclString & orc_RootNode,
+                                             const bool oq_ReadOnly = false);
    static int32_t h_GetParserForNewFile(C_OscXmlParser & orc_FileXmlParser, const stw::scl::C_SclString & orc_Path,
                                         const stw::scl::C_SclString & orc_RootNode);
    static int32_t h_CreateFolder(const stw::scl::C_SclString & orc_Path);
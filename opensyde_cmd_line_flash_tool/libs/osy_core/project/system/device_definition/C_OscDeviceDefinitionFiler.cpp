@@ -19,6 +19,7 @@
 #include "TglUtils.hpp"
 #include "C_OscUtils.hpp"
 #include "C_OscDeviceDefinitionFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscDeviceDefinitionFilerV1.hpp"
 #include "C_OscXmlParserLog.hpp"
 #include "C_OscLoggingHandler.hpp"
@@ -1252,6 +1253,7 @@ void C_OscDeviceDefinitionFiler::mh_SaveFeatures(
 int32_t C_OscDeviceDefinitionFiler::h_Load(C_OscDeviceDefinition & orc_DeviceDefinition,
                                            const stw::scl::C_SclString & orc_Path)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "Device definition file", orc_Path);
    int32_t s32_Return = C_NO_ERR;
 
    if (TglFileExists(orc_Path) == false)
@@ -17,6 +17,7 @@
 #include "C_SclString.hpp"
 #include "TglUtils.hpp"
 #include "C_OscNodeFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscNodeCommFiler.hpp"
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscNodeDataPoolFiler.hpp"
@@ -60,6 +61,7 @@ using namespace stw::opensyde_core;
 int32_t C_OscNodeFiler::h_LoadNodeFile(C_OscNode & orc_Node, const C_SclString & orc_FilePath,
                                        const bool oq_SkipContent)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "Node file", orc_FilePath);
    C_OscXmlParser c_XmlParser;
    int32_t s32_Retval = C_OscSystemFilerUtil::h_GetParserForExistingFile(c_XmlParser, orc_FilePath,
                                                                          "opensyde-node-core-definition");
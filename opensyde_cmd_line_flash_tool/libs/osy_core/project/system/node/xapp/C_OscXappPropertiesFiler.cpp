@@ -17,6 +17,7 @@
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscXappPropertiesFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
@@ -49,6 +50,7 @@ const uint16_t C_OscXappPropertiesFiler::mhu16_FILE_VERSION_1 = 1;
 int32_t C_OscXappPropertiesFiler::h_LoadXappPropertiesFile(C_OscXappProperties & orc_XappProperties,
                                                            const stw::scl::C_SclString & orc_FilePath)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "X-App properties file", orc_FilePath);
    C_OscXmlParserLog c_XmlParser;
 
    c_XmlParser.SetLogHeading("Loading X-App properties");
@@ -486,6 +486,30 @@ int32_t C_OscDiagProtocolOsy::NvmWriteFinalizeTransaction(void)
    return C_NO_ERR;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of data bytes one NVM read service can transfer
+
+   \return
+   maximum number of data bytes per "ReadMemoryByAddress" service
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDiagProtocolOsy::GetNvmReadBlockSize(void) const
+{
+   return this->GetReadMemoryBlockSize();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of data bytes one NVM write service can transfer
+
+   \return
+   maximum number of data bytes per "WriteMemoryByAddress" service
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscDiagProtocolOsy::GetNvmWriteBlockSize(void) const
+{
+   return this->GetWriteMemoryBlockSize();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read data pool version
 
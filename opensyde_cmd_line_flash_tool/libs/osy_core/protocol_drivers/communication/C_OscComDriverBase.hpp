@@ -38,10 +38,24 @@ public:
    bool operator ==(const C_OscComDriverBaseCanMessage & orc_Cmp) const;
 
    stw::can::T_STWCAN_Msg_TX c_Msg;
-   uint32_t u32_TimeToSend; // First time to send message in ms. Can be used for an offset
+   uint32_t u32_TimeToSend; // First time to send message in ms (TglGetTickCount). Can be used for an offset
    uint32_t u32_Interval;   // Cyclic interval time in ms
 };
 
+class C_OscComDriverBaseCanMessageStatistics
+{
+public:
+   C_OscComDriverBaseCanMessageStatistics(void);
+
+   C_OscComDriverBaseCanMessage c_MsgCfg;
+   uint32_t u32_NumSent;       // Number of transmissions
+   uint32_t u32_NumMissed;     // Number of skipped periods (sent more than one interval late)
+   uint64_t u64_SumLatenessUs; // Sum of the delays between scheduled and actual transmission
+   uint32_t u32_MaxLatenessUs; // Maximum delay between scheduled and actual transmission
+};
+
+class C_OscComCyclicTxScheduler;
+
 class C_OscComDriverBase
 {
 public:
@@ -73,6 +87,9 @@ public:
                                        const bool oq_SetAutoSupportMode,
                                        const C_OscCanProtocol::E_Type oe_ProtocolType);
    virtual void RemoveAllCyclicCanMessages(void);
+   virtual void GetCyclicCanMessageStatistics(std::vector<C_OscComDriverBaseCanMessageStatistics> & orc_Statistics)
+   const;
+   virtual bool GetTimeToNextCanMessage(uint32_t & oru32_TimeUs) const;
 
    virtual void PrepareForDestruction(void);
    virtual void ClearData(void);
@@ -90,6 +107,9 @@ private:
    C_OscComDriverBase & operator =(const C_OscComDriverBase &);
 
    void m_HandleCanMessagesForSending(void);
+   void m_LogCyclicCanMessageStatistics(void) const;
+
+   static uint64_t mh_GetTimeToSendUs(const uint32_t ou32_TimeToSend);
 
    static uint32_t mh_GetCanMessageSizeInBits(const stw::can::T_STWCAN_Msg_RX & orc_Msg);
 
@@ -102,7 +122,7 @@ private:
    // Sending of CAN messages
    std::list<stw::can::T_STWCAN_Msg_TX> mc_CanMessages;
    // Sending of configured CAN messages
-   std::list<C_OscComDriverBaseCanMessage> mc_CanMessageConfigs;
+   C_OscComCyclicTxScheduler * mpc_CyclicTxScheduler;
 
    // Bus load information
    uint32_t mu32_CanMessageBits;
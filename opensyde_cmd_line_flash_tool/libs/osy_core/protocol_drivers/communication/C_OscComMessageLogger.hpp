@@ -20,6 +20,7 @@
 #include "stw_can.hpp"
 
 #include "C_OscComLoggerProtocols.hpp"
+#include "C_OscComMessageLoggerProtocolCache.hpp"
 #include "C_OscSystemDefinition.hpp"
 #include "C_OscComMessageLoggerOsySysDefConfig.hpp"
 #include "C_OscComMessageLoggerData.hpp"
@@ -105,6 +106,8 @@ protected:
    // CANmon based protocol interpretation
    stw::scl::C_SclString m_GetProtocolStringHex(const stw::can::T_STWCAN_Msg_RX & orc_Msg) const;
    stw::scl::C_SclString m_GetProtocolStringDec(const stw::can::T_STWCAN_Msg_RX & orc_Msg) const;
+   void m_GetProtocolStrings(const stw::can::T_STWCAN_Msg_RX & orc_Msg, stw::scl::C_SclString & orc_TextHex,
+                             stw::scl::C_SclString & orc_TextDec) const;
 
    // openSYDE system definition based interpretation
    virtual void m_InsertOsySysDef(const stw::scl::C_SclString & orc_PathSystemDefinition,
@@ -165,6 +168,7 @@ private:
 
    C_OscComLoggerProtocols mc_ProtocolHex;
    C_OscComLoggerProtocols mc_ProtocolDec;
+   mutable C_OscComMessageLoggerProtocolCache mc_ProtocolCache;
 
    // Database interpretation
    std::map<stw::scl::C_SclString, C_OscComMessageLoggerOsySysDefConfig> mc_OsySysDefs;
@@ -19,6 +19,7 @@
 #include "C_SclString.hpp"
 #include "C_OscSupServiceUpdatePackageV1.hpp"
 #include "C_OscSupServiceUpdatePackageCreate.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscSystemDefinition.hpp"
 #include "C_OscSystemDefinitionFiler.hpp"
@@ -221,6 +222,7 @@ int32_t C_OscSupServiceUpdatePackageCreate::h_CreatePackage(const C_SclString &
                                                             const vector<C_OscSuSequences::C_DoFlash> & orc_ApplicationsToWrite, C_SclStringList & orc_WarningMessages, C_SclString & orc_ErrorMessage, const C_SclString & orc_TemporaryDirectory, const std::vector<uint8_t> & orc_EncryptNodes, const std::vector<C_SclString> & orc_EncryptNodesPassword, const std::vector<uint8_t> & orc_AddSignatureNodes,
                                                             const std::vector<std::vector<uint8_t> > & orc_NodeSignatureKeys)
 {
+   const C_OscTraceScope c_TraceScope("Package creation", "Service update package", orc_PackagePath);
    int32_t s32_Return;
 
    bool q_TemporaryFolderCreated = false; // for cleanup at the end of this function
@@ -899,6 +901,7 @@ int32_t C_OscSupServiceUpdatePackageCreate::mh_CreateNodesZip(const std::vector<
                                                               const uint32_t ou32_NodeCount,
                                                               std::set<stw::scl::C_SclString> & orc_SupFiles)
 {
+   const C_OscTraceScope c_TraceScope("Package creation", "Secure node archives");
    int32_t s32_Return = C_NO_ERR;
 
    tgl_assert((orc_NodeFoldersAbs.size() == orc_SecFiles.size()) && ((orc_SecPackageFilesRel.size() ==
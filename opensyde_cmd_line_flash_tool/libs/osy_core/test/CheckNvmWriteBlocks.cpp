@@ -0,0 +1,319 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for NVM write block planning (C_OscDataDealerNvm::mh_PlanWriteBlocks)
+
+   Writes the planned blocks and the original entries into a simulated NVM and checks that both result in the same
+    memory content. Pseudo random entries (adjacent, overlapping, with gaps and empty) and various block sizes are
+    checked. Additionally the blocks must respect the maximum block size and adjacent entries must be combined.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <algorithm>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscDataDealerNvm.hpp"
+#include "C_OscParamSetRawEntry.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_MEMORY_SIZE = 512U;
+static const uint32_t mu32_NUM_RANDOM_RUNS = 2000U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///gives access to the protected planning function
+class C_NvmPlanner :
+   public C_OscDataDealerNvm
+{
+public:
+   static void h_PlanWriteBlocks(const std::vector<C_OscParamSetRawEntry> & orc_Entries,
+                                 const uint32_t ou32_MaxBlockSize, std::vector<C_OscParamSetRawEntry> & orc_Blocks)
+   {
+      C_OscDataDealerNvm::mh_PlanWriteBlocks(orc_Entries, ou32_MaxBlockSize, orc_Blocks);
+   }
+};
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+static uint32_t mu32_RandomState = 0x12345678U;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static uint32_t m_GetRandom(const uint32_t ou32_Range);
+static C_OscParamSetRawEntry m_CreateEntry(const uint32_t ou32_StartAddress, const uint32_t ou32_Size,
+                                           const uint8_t ou8_Fill);
+static void m_WriteToMemory(const std::vector<C_OscParamSetRawEntry> & orc_Entries,
+                            std::vector<uint8_t> & orc_Memory);
+static void m_CheckPlan(const std::vector<C_OscParamSetRawEntry> & orc_Entries, const uint32_t ou32_MaxBlockSize,
+                        const C_SclString & orc_Description, std::vector<C_OscParamSetRawEntry> & orc_Blocks);
+static void m_CheckFixedCases(void);
+static void m_CheckRandomCases(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      if (mu32_NumFailures <= 20U)
+      {
+         std::printf("FAILED: %s\n", orc_Description.c_str());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pseudo random number
+
+   xorshift32; fixed seed so all runs check the same values
+
+   \param[in]  ou32_Range   number of possible results (> 0)
+
+   \return
+   pseudo random number in range 0 .. ou32_Range-1
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetRandom(const uint32_t ou32_Range)
+{
+   mu32_RandomState ^= mu32_RandomState << 13U;
+   mu32_RandomState ^= mu32_RandomState >> 17U;
+   mu32_RandomState ^= mu32_RandomState << 5U;
+   return mu32_RandomState % ou32_Range;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create write access
+
+   \param[in]  ou32_StartAddress   start address
+   \param[in]  ou32_Size           number of bytes
+   \param[in]  ou8_Fill            value of first byte; following bytes are incremented
+
+   \return
+   write access
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_OscParamSetRawEntry m_CreateEntry(const uint32_t ou32_StartAddress, const uint32_t ou32_Size,
+                                           const uint8_t ou8_Fill)
+{
+   C_OscParamSetRawEntry c_Entry;
+
+   c_Entry.u32_StartAddress = ou32_StartAddress;
+   c_Entry.c_Bytes.resize(ou32_Size);
+   for (uint32_t u32_Byte = 0U; u32_Byte < ou32_Size; u32_Byte++)
+   {
+      c_Entry.c_Bytes[u32_Byte] = static_cast<uint8_t>(ou8_Fill + u32_Byte);
+   }
+   return c_Entry;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write accesses to simulated NVM in the given order
+
+   \param[in]      orc_Entries   write accesses
+   \param[in,out]  orc_Memory    simulated NVM
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_WriteToMemory(const std::vector<C_OscParamSetRawEntry> & orc_Entries, std::vector<uint8_t> & orc_Memory)
+{
+   for (uint32_t u32_Entry = 0U; u32_Entry < orc_Entries.size(); u32_Entry++)
+   {
+      const C_OscParamSetRawEntry & rc_Entry = orc_Entries[u32_Entry];
+      for (uint32_t u32_Byte = 0U; u32_Byte < rc_Entry.c_Bytes.size(); u32_Byte++)
+      {
+         orc_Memory[rc_Entry.u32_StartAddress + u32_Byte] = rc_Entry.c_Bytes[u32_Byte];
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Plan blocks and check the result
+
+   Checks:
+   * writing the blocks results in the same NVM content as writing the entries
+   * no block is empty or larger than the maximum block size
+   * the blocks do not contain more bytes than the entries
+
+   \param[in]   orc_Entries         write accesses
+   \param[in]   ou32_MaxBlockSize   maximum number of bytes per service
+   \param[in]   orc_Description     description for report
+   \param[out]  orc_Blocks          planned blocks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckPlan(const std::vector<C_OscParamSetRawEntry> & orc_Entries, const uint32_t ou32_MaxBlockSize,
+                        const C_SclString & orc_Description, std::vector<C_OscParamSetRawEntry> & orc_Blocks)
+{
+   std::vector<uint8_t> c_Expected(mu32_MEMORY_SIZE, 0xFFU);
+   std::vector<uint8_t> c_Actual(mu32_MEMORY_SIZE, 0xFFU);
+   const uint32_t u32_EffectiveBlockSize = (ou32_MaxBlockSize > 0U) ? ou32_MaxBlockSize : 1U;
+   uint32_t u32_EntryBytes = 0U;
+   uint32_t u32_BlockBytes = 0U;
+
+   C_NvmPlanner::h_PlanWriteBlocks(orc_Entries, ou32_MaxBlockSize, orc_Blocks);
+
+   m_WriteToMemory(orc_Entries, c_Expected);
+   m_WriteToMemory(orc_Blocks, c_Actual);
+   m_Check(c_Expected == c_Actual, orc_Description + ": NVM content differs");
+
+   for (uint32_t u32_Entry = 0U; u32_Entry < orc_Entries.size(); u32_Entry++)
+   {
+      u32_EntryBytes += static_cast<uint32_t>(orc_Entries[u32_Entry].c_Bytes.size());
+   }
+   for (uint32_t u32_Block = 0U; u32_Block < orc_Blocks.size(); u32_Block++)
+   {
+      const uint32_t u32_Size = static_cast<uint32_t>(orc_Blocks[u32_Block].c_Bytes.size());
+      m_Check(u32_Size > 0U, orc_Description + ": empty block");
+      m_Check(u32_Size <= u32_EffectiveBlockSize, orc_Description + ": block too large");
+      u32_BlockBytes += u32_Size;
+   }
+   m_Check(u32_BlockBytes == u32_EntryBytes, orc_Description + ": number of bytes differs");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check hand made cases with known number of blocks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckFixedCases(void)
+{
+   std::vector<C_OscParamSetRawEntry> c_Entries;
+   std::vector<C_OscParamSetRawEntry> c_Blocks;
+
+   //no entries
+   m_CheckPlan(c_Entries, 8U, "no entries", c_Blocks);
+   m_Check(c_Blocks.empty(), "no entries: blocks");
+
+   //two adjacent entries fitting into one block
+   c_Entries.push_back(m_CreateEntry(0U, 4U, 0x10U));
+   c_Entries.push_back(m_CreateEntry(4U, 4U, 0x20U));
+   m_CheckPlan(c_Entries, 8U, "adjacent", c_Blocks);
+   m_Check((c_Blocks.size() == 1U) && (c_Blocks[0].u32_StartAddress == 0U), "adjacent: one block");
+
+   //same with a smaller block size: cut into 3 + 3 + 2
+   m_CheckPlan(c_Entries, 3U, "adjacent cut", c_Blocks);
+   m_Check(c_Blocks.size() == 3U, "adjacent cut: three blocks");
+
+   //gap: never combined
+   c_Entries.clear();
+   c_Entries.push_back(m_CreateEntry(0U, 4U, 0x10U));
+   c_Entries.push_back(m_CreateEntry(5U, 4U, 0x20U));
+   m_CheckPlan(c_Entries, 64U, "gap", c_Blocks);
+   m_Check(c_Blocks.size() == 2U, "gap: two blocks");
+
+   //overlap: the later entry must win
+   c_Entries.clear();
+   c_Entries.push_back(m_CreateEntry(0U, 8U, 0x10U));
+   c_Entries.push_back(m_CreateEntry(4U, 8U, 0x80U));
+   m_CheckPlan(c_Entries, 64U, "overlap", c_Blocks);
+   m_Check(c_Blocks.size() == 2U, "overlap: two blocks");
+
+   //descending addresses: order must be kept; no combination
+   c_Entries.clear();
+   c_Entries.push_back(m_CreateEntry(8U, 4U, 0x10U));
+   c_Entries.push_back(m_CreateEntry(4U, 4U, 0x20U));
+   m_CheckPlan(c_Entries, 64U, "descending", c_Blocks);
+   m_Check((c_Blocks.size() == 2U) && (c_Blocks[0].u32_StartAddress == 8U), "descending: order kept");
+
+   //many small adjacent entries (typical parameter set list): minimum number of services
+   c_Entries.clear();
+   for (uint32_t u32_Entry = 0U; u32_Entry < 100U; u32_Entry++)
+   {
+      c_Entries.push_back(m_CreateEntry(u32_Entry * 2U, 2U, static_cast<uint8_t>(u32_Entry)));
+   }
+   m_CheckPlan(c_Entries, 61U, "list", c_Blocks);
+   m_Check(c_Blocks.size() == 4U, "list: 200 bytes in blocks of 61 bytes need 4 services");
+
+   //block size zero is treated as one
+   m_CheckPlan(c_Entries, 0U, "block size zero", c_Blocks);
+   m_Check(c_Blocks.size() == 200U, "block size zero: one byte per service");
+
+   //empty entry between adjacent ones
+   c_Entries.clear();
+   c_Entries.push_back(m_CreateEntry(0U, 4U, 0x10U));
+   c_Entries.push_back(m_CreateEntry(4U, 0U, 0x00U));
+   c_Entries.push_back(m_CreateEntry(4U, 4U, 0x20U));
+   m_CheckPlan(c_Entries, 64U, "empty entry", c_Blocks);
+   m_Check(c_Blocks.size() == 1U, "empty entry: one block");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check pseudo random cases
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckRandomCases(void)
+{
+   static const uint32_t hau32_BLOCK_SIZES[] =
+   {
+      0U, 1U, 2U, 3U, 7U, 8U, 61U, 255U, 4096U
+   };
+
+   for (uint32_t u32_Run = 0U; u32_Run < mu32_NUM_RANDOM_RUNS; u32_Run++)
+   {
+      std::vector<C_OscParamSetRawEntry> c_Entries;
+      std::vector<C_OscParamSetRawEntry> c_Blocks;
+      const uint32_t u32_NumEntries = m_GetRandom(30U);
+      uint32_t u32_Address = m_GetRandom(32U);
+
+      for (uint32_t u32_Entry = 0U; u32_Entry < u32_NumEntries; u32_Entry++)
+      {
+         const uint32_t u32_Size = m_GetRandom(24U);
+         //mostly adjacent; sometimes gaps, overlaps or jumps
+         switch (m_GetRandom(6U))
+         {
+         case 0U:
+            u32_Address += m_GetRandom(8U);
+            break;
+         case 1U:
+            u32_Address -= std::min(u32_Address, m_GetRandom(8U));
+            break;
+         case 2U:
+            u32_Address = m_GetRandom(mu32_MEMORY_SIZE / 2U);
+            break;
+         default:
+            break;
+         }
+         if ((u32_Address + u32_Size) > mu32_MEMORY_SIZE)
+         {
+            u32_Address = 0U;
+         }
+         c_Entries.push_back(m_CreateEntry(u32_Address, u32_Size, static_cast<uint8_t>(m_GetRandom(256U))));
+         u32_Address += u32_Size;
+      }
+      m_CheckPlan(c_Entries, hau32_BLOCK_SIZES[u32_Run % (sizeof(hau32_BLOCK_SIZES) / sizeof(uint32_t))],
+                  "random run " + C_SclString::IntToStr(u32_Run), c_Blocks);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   m_CheckFixedCases();
+   m_CheckRandomCases();
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
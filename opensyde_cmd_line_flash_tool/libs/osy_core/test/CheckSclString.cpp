@@ -0,0 +1,377 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for C_SclString number formatting
+
+   Checks that IntToStr, IntToHex and the numeric constructors of C_SclString produce exactly the same output as
+    the std::stringstream based implementation they replaced. Edge values and pseudo random values of all integer
+    widths are checked.
+
+   With "--benchmark" the following throughputs are measured in addition:
+   * IntToStr/IntToHex compared to the std::stringstream reference
+   * saving a data pool file (project save path; every attribute value is formatted by C_SclString)
+   * ASC logging of CAN messages
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclString.hpp"
+#include "TglTime.hpp"
+#include "TglFile.hpp"
+#include "C_OscNodeDataPool.hpp"
+#include "C_OscNodeDataPoolFiler.hpp"
+#include "C_OscComMessageLogger.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_NUM_RANDOM_VALUES = 20000U;
+static const uint32_t mu32_BENCHMARK_CONVERSIONS = 1000000U;
+static const uint32_t mu32_BENCHMARK_DP_LISTS = 20U;
+static const uint32_t mu32_BENCHMARK_DP_ELEMENTS = 500U;
+static const uint32_t mu32_BENCHMARK_DP_SAVES = 5U;
+static const uint32_t mu32_BENCHMARK_ASC_MESSAGES = 200000U;
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+static uint64_t mu64_RandomState = 0x9E3779B97F4A7C15ULL;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static uint64_t m_GetRandom(void);
+static void m_CheckAllTypes(void);
+static void m_RunBenchmarks(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      //limit output if something is fundamentally broken
+      if (mu32_NumFailures <= 20U)
+      {
+         std::printf("FAILED: %s\n", orc_Description.c_str());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pseudo random number
+
+   xorshift64; fixed seed so all runs check the same values
+
+   \return
+   pseudo random number
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint64_t m_GetRandom(void)
+{
+   mu64_RandomState ^= mu64_RandomState << 13U;
+   mu64_RandomState ^= mu64_RandomState >> 7U;
+   mu64_RandomState ^= mu64_RandomState << 17U;
+   return mu64_RandomState;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stream based reference implementation
+
+   Same as C_SclString implementation before the stream was replaced.
+   8bit types are promoted to 32bit the same way C_SclString did.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <typename T> class C_Reference
+{
+public:
+   static std::string h_ToDecimal(const T & orc_Value)
+   {
+      std::stringstream c_Stream;
+      c_Stream << orc_Value;
+      return c_Stream.str();
+   }
+
+   static std::string h_ToHex(const T & orc_Value, const uint32_t ou32_Digits)
+   {
+      std::stringstream c_Stream;
+      c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << orc_Value;
+      return c_Stream.str();
+   }
+};
+
+template <> class C_Reference<uint8_t>
+{
+public:
+   static std::string h_ToDecimal(const uint8_t & oru8_Value)
+   {
+      return C_Reference<uint32_t>::h_ToDecimal(static_cast<uint32_t>(oru8_Value));
+   }
+
+   static std::string h_ToHex(const uint8_t & oru8_Value, const uint32_t ou32_Digits)
+   {
+      return C_Reference<uint32_t>::h_ToHex(static_cast<uint32_t>(oru8_Value), ou32_Digits);
+   }
+};
+
+template <> class C_Reference<int8_t>
+{
+public:
+   static std::string h_ToDecimal(const int8_t & ors8_Value)
+   {
+      return C_Reference<int32_t>::h_ToDecimal(static_cast<int32_t>(ors8_Value));
+   }
+
+   static std::string h_ToHex(const int8_t & ors8_Value, const uint32_t ou32_Digits)
+   {
+      return C_Reference<int32_t>::h_ToHex(static_cast<int32_t>(ors8_Value), ou32_Digits);
+   }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare conversions of one value with reference
+
+   \param[in]  orc_Value      value to check
+   \param[in]  opcn_TypeName  name of type for report
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <typename T> static void m_CheckValue(const T & orc_Value, const char_t * const opcn_TypeName)
+{
+   const std::string c_Decimal = C_Reference<T>::h_ToDecimal(orc_Value);
+   const uint32_t u32_Digits = static_cast<uint32_t>(m_GetRandom() % 20U);
+   const std::string c_Hex = C_Reference<T>::h_ToHex(orc_Value, u32_Digits);
+   const C_SclString c_Constructed(orc_Value);
+
+   m_Check(C_SclString::IntToStr(orc_Value) == c_Decimal.c_str(),
+           C_SclString("IntToStr<") + opcn_TypeName + "> expected " + c_Decimal.c_str() + " got " +
+           C_SclString::IntToStr(orc_Value));
+   m_Check(c_Constructed == c_Decimal.c_str(),
+           C_SclString("C_SclString(") + opcn_TypeName + ") expected " + c_Decimal.c_str() + " got " + c_Constructed);
+   m_Check(C_SclString::IntToHex(orc_Value, u32_Digits) == c_Hex.c_str(),
+           C_SclString("IntToHex<") + opcn_TypeName + "> expected " + c_Hex.c_str() + " got " +
+           C_SclString::IntToHex(orc_Value, u32_Digits));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check edge values and pseudo random values of one type
+
+   \param[in]  opcn_TypeName  name of type for report
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <typename T> static void m_CheckType(const char_t * const opcn_TypeName)
+{
+   m_CheckValue<T>(static_cast<T>(0), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(1), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(9), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(10), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(99), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(100), opcn_TypeName);
+   m_CheckValue<T>(std::numeric_limits<T>::max(), opcn_TypeName);
+   m_CheckValue<T>(std::numeric_limits<T>::min(), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(std::numeric_limits<T>::max() - 1), opcn_TypeName);
+   m_CheckValue<T>(static_cast<T>(std::numeric_limits<T>::min() + 1), opcn_TypeName);
+   if (std::numeric_limits<T>::is_signed == true)
+   {
+      m_CheckValue<T>(static_cast<T>(-1), opcn_TypeName);
+      m_CheckValue<T>(static_cast<T>(-10), opcn_TypeName);
+   }
+   for (uint32_t u32_Value = 0U; u32_Value < mu32_NUM_RANDOM_VALUES; u32_Value++)
+   {
+      //use all magnitudes; not only large numbers
+      const uint32_t u32_Shift = static_cast<uint32_t>(m_GetRandom() % 64U);
+      m_CheckValue<T>(static_cast<T>(m_GetRandom() >> u32_Shift), opcn_TypeName);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check all integer types
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckAllTypes(void)
+{
+   m_CheckType<uint8_t>("uint8_t");
+   m_CheckType<int8_t>("int8_t");
+   m_CheckType<uint16_t>("uint16_t");
+   m_CheckType<int16_t>("int16_t");
+   m_CheckType<uint32_t>("uint32_t");
+   m_CheckType<int32_t>("int32_t");
+   m_CheckType<uint64_t>("uint64_t");
+   m_CheckType<int64_t>("int64_t");
+   m_CheckType<long>("long");                   //lint !e970 //explicitly checking native types
+   m_CheckType<unsigned long>("unsigned long"); //lint !e970 //explicitly checking native types
+
+   //char_t is formatted as number by IntToStr
+   m_Check(C_SclString::IntToStr(static_cast<char_t>(65)) == "65", "IntToStr(char_t)");
+   m_Check(C_SclString::IntToStr(static_cast<char_t>(-3)) == "-3", "IntToStr(char_t) negative");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Print duration of one benchmark
+
+   \param[in]  opcn_Name          name of benchmark
+   \param[in]  ou64_DurationUs    duration in micro seconds
+   \param[in]  ou32_NumItems      number of processed items
+   \param[in]  opcn_ItemName      name of processed items
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_PrintBenchmark(const char_t * const opcn_Name, const uint64_t ou64_DurationUs,
+                             const uint32_t ou32_NumItems, const char_t * const opcn_ItemName)
+{
+   const float64_t f64_Ms = static_cast<float64_t>(ou64_DurationUs) / 1000.0;
+   const float64_t f64_PerSecond = (ou64_DurationUs > 0U) ?
+                                   ((static_cast<float64_t>(ou32_NumItems) * 1000000.0) /
+                                    static_cast<float64_t>(ou64_DurationUs)) : 0.0;
+
+   std::printf("%-36s %10.1f ms %14.0f %s/s\n", opcn_Name, f64_Ms, f64_PerSecond, opcn_ItemName);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Measure throughput of formatting and of users of the formatting
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_RunBenchmarks(void)
+{
+   uint64_t u64_Start;
+   uint32_t u32_Sum = 0U; //prevent the optimizer from dropping the conversions
+
+   //IntToStr/IntToHex
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Value = 0U; u32_Value < mu32_BENCHMARK_CONVERSIONS; u32_Value++)
+   {
+      u32_Sum += C_SclString::IntToStr(u32_Value * 2654435761U).Length();
+   }
+   m_PrintBenchmark("IntToStr(uint32_t)", TglGetTickCountUs() - u64_Start, mu32_BENCHMARK_CONVERSIONS,
+                    "conversions");
+
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Value = 0U; u32_Value < mu32_BENCHMARK_CONVERSIONS; u32_Value++)
+   {
+      u32_Sum += static_cast<uint32_t>(C_Reference<uint32_t>::h_ToDecimal(u32_Value * 2654435761U).length());
+   }
+   m_PrintBenchmark("stringstream reference (decimal)", TglGetTickCountUs() - u64_Start,
+                    mu32_BENCHMARK_CONVERSIONS, "conversions");
+
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Value = 0U; u32_Value < mu32_BENCHMARK_CONVERSIONS; u32_Value++)
+   {
+      u32_Sum += C_SclString::IntToHex(u32_Value * 2654435761U, 8U).Length();
+   }
+   m_PrintBenchmark("IntToHex(uint32_t, 8)", TglGetTickCountUs() - u64_Start, mu32_BENCHMARK_CONVERSIONS,
+                    "conversions");
+
+   u64_Start = TglGetTickCountUs();
+   for (uint32_t u32_Value = 0U; u32_Value < mu32_BENCHMARK_CONVERSIONS; u32_Value++)
+   {
+      u32_Sum += static_cast<uint32_t>(C_Reference<uint32_t>::h_ToHex(u32_Value * 2654435761U, 8U).length());
+   }
+   m_PrintBenchmark("stringstream reference (hex)", TglGetTickCountUs() - u64_Start, mu32_BENCHMARK_CONVERSIONS,
+                    "conversions");
+
+   //project save: data pool file
+   {
+      const C_SclString c_FilePath = TglGetExePath() + "check_scl_string_dp.xml";
+      C_OscNodeDataPool c_DataPool;
+      c_DataPool.e_Type = C_OscNodeDataPool::eNVM;
+      c_DataPool.c_Name = "Benchmark";
+      c_DataPool.c_Lists.resize(mu32_BENCHMARK_DP_LISTS);
+      for (uint32_t u32_List = 0U; u32_List < mu32_BENCHMARK_DP_LISTS; u32_List++)
+      {
+         C_OscNodeDataPoolList & rc_List = c_DataPool.c_Lists[u32_List];
+         rc_List.c_Name = "List" + C_SclString::IntToStr(u32_List);
+         rc_List.c_Elements.resize(mu32_BENCHMARK_DP_ELEMENTS);
+         for (uint32_t u32_Element = 0U; u32_Element < mu32_BENCHMARK_DP_ELEMENTS; u32_Element++)
+         {
+            C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u32_Element];
+            rc_Element.c_Name = "Element" + C_SclString::IntToStr(u32_Element);
+            rc_Element.SetType(C_OscNodeDataPoolContent::eUINT32);
+            rc_Element.c_MinValue.SetValueU32(0U);
+            rc_Element.c_MaxValue.SetValueU32(0xFFFFFFFFU);
+            rc_Element.c_Value.SetValueU32(u32_Element * 1000U);
+            rc_Element.u32_NvmStartAddress = (u32_List * 0x10000U) + (u32_Element * 4U);
+         }
+      }
+      u64_Start = TglGetTickCountUs();
+      for (uint32_t u32_Save = 0U; u32_Save < mu32_BENCHMARK_DP_SAVES; u32_Save++)
+      {
+         m_Check(C_OscNodeDataPoolFiler::h_SaveDataPoolFile(c_DataPool, c_FilePath) == C_NO_ERR,
+                 "saving data pool file");
+      }
+      m_PrintBenchmark("data pool file save (10000 elements)", TglGetTickCountUs() - u64_Start,
+                       mu32_BENCHMARK_DP_SAVES, "saves");
+      (void)std::remove(c_FilePath.c_str());
+   }
+
+   //ASC logging
+   {
+      const C_SclString c_FilePath = TglGetExePath() + "check_scl_string_log.asc";
+      C_OscComMessageLogger c_Logger;
+      stw::can::T_STWCAN_Msg_RX c_Message;
+
+      (void)std::memset(&c_Message, 0, sizeof(c_Message));
+      c_Message.u8_DLC = 8U;
+      m_Check(c_Logger.AddLogFileAsc(c_FilePath, true, false) == C_NO_ERR, "adding ASC log file");
+      c_Logger.Start();
+      u64_Start = TglGetTickCountUs();
+      for (uint32_t u32_Message = 0U; u32_Message < mu32_BENCHMARK_ASC_MESSAGES; u32_Message++)
+      {
+         c_Message.u32_ID = 0x100U + (u32_Message % 0x400U);
+         c_Message.au8_Data[0] = static_cast<uint8_t>(u32_Message);
+         c_Message.au8_Data[1] = static_cast<uint8_t>(u32_Message >> 8U);
+         c_Message.u64_TimeStamp = static_cast<uint64_t>(u32_Message) * 250U;
+         (void)c_Logger.HandleCanMessage(c_Message, false);
+      }
+      c_Logger.RemoveAllLogFiles();
+      m_PrintBenchmark("ASC logging (hex)", TglGetTickCountUs() - u64_Start, mu32_BENCHMARK_ASC_MESSAGES,
+                       "messages");
+      c_Logger.Stop();
+      (void)std::remove(c_FilePath.c_str());
+   }
+
+   std::printf("(checksum %u)\n", u32_Sum);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \param[in]  os32_Argc     number of command line arguments
+   \param[in]  oppcn_Argv    command line arguments; "--benchmark" to also run benchmarks
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(const int32_t os32_Argc, char_t * oppcn_Argv[])
+{
+   m_CheckAllTypes();
+   if ((os32_Argc > 1) && (std::strcmp(oppcn_Argv[1], "--benchmark") == 0))
+   {
+      m_RunBenchmarks();
+   }
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
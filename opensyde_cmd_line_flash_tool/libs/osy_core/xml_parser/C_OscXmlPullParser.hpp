@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Pull style streaming XML reader (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCXMLPULLPARSER_HPP
+#define C_OSCXMLPULLPARSER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <string>
+#include <vector>
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Pull style XML reader working on a memory buffer
+class C_OscXmlPullParser
+{
+public:
+   enum E_Event
+   {
+      eELEMENT_START, ///< start tag was read; name and attributes are available
+      eELEMENT_END,   ///< end tag was read (also reported for empty element tags); name is available
+      eTEXT,          ///< text or CDATA section was read; text is available
+      eOTHER,         ///< comment, declaration or DTD was skipped
+      eEND_OF_DATA,   ///< all data was read; the document is well-formed
+      eERROR          ///< the document is not well-formed; no more events will be reported
+   };
+
+   C_OscXmlPullParser(void);
+
+   void SetData(const char_t * const opcn_Data, const uint32_t ou32_Size);
+   E_Event ReadNext(void);
+
+   const std::string & GetName(void) const;
+   uint32_t GetNumAttributes(void) const;
+   const std::string & GetAttributeName(const uint32_t ou32_Index) const;
+   const std::string & GetAttributeValue(const uint32_t ou32_Index) const;
+   const std::string & GetText(void) const;
+   uint32_t GetLineNumber(void) const;
+
+private:
+   //not implemented -> prevent copying
+   C_OscXmlPullParser(const C_OscXmlPullParser & orc_Source);
+   //not implemented -> prevent assignment
+   C_OscXmlPullParser & operator = (const C_OscXmlPullParser & orc_Source);
+
+   const char_t * mpcn_Current;
+   const char_t * mpcn_End;
+   uint32_t mu32_CurrentLine;     ///< line of read position
+   uint32_t mu32_EventLine;       ///< line the last reported event started in
+   bool mq_ElementEndPending;     ///< last start tag was an empty element tag
+   bool mq_DeclarationsOnly;      ///< only declarations found at document level so far
+   bool mq_Finished;              ///< end of data or error was reported
+   E_Event me_FinalEvent;         ///< event to report again after finishing
+
+   //buffers are kept across events so they do not need to be reallocated for every element:
+   std::string mc_Name;
+   std::string mc_Text;
+   std::vector<std::string> mc_AttributeNames;
+   std::vector<std::string> mc_AttributeValues;
+   uint32_t mu32_NumAttributes;
+   std::vector<std::string> mc_OpenElements;
+   uint32_t mu32_Depth;
+
+   E_Event m_ReadMarkup(void);
+   E_Event m_ReadStartTag(void);
+   E_Event m_ReadEndTag(void);
+   bool m_ReadTagContent(bool & orq_EmptyElement);
+   E_Event m_SkipUntil(const char_t * const opcn_Terminator, const uint32_t ou32_Length);
+   E_Event m_Finish(const E_Event oe_Event);
+   const char_t * m_Find(const char_t * const opcn_Terminator, const uint32_t ou32_Length) const;
+   void m_AdvanceTo(const char_t * const opcn_Position);
+   void m_SkipWhiteSpace(void);
+   bool m_ReadName(std::string & orc_Name);
+   bool m_ReadAttribute(void);
+   bool m_StartsWith(const char_t * const opcn_Text, const uint32_t ou32_Length) const;
+   void m_PushOpenElement(void);
+   static void mh_DecodeText(const char_t * const opcn_Start, const char_t * const opcn_End,
+                             const bool oq_ProcessEntities, std::string & orc_Text);
+   static const char_t * mh_DecodeEntity(const char_t * const opcn_Start, const char_t * const opcn_End,
+                                         std::string & orc_Text);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -6,6 +6,10 @@
    Its main job is to place incoming data into the data pool.
    The application is responsible to not "::Cycle" and poll at the same time from different threads.
 
+   The data pool content instances are not thread safe by themselves.
+   All accesses of the dealer to the node's values are done while holding mc_CriticalSectionContent.
+   Application code reading those values from a different thread shall do the same.
+
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -180,14 +184,7 @@ int32_t C_OscDataDealer::DataPoolRead(const uint8_t ou8_DataPoolIndex, const uin
                //size OK
                //convert to native endianness depending on the type ...
                //no possible problem we did not check for already ...
-               if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-               {
-                  (void)pc_Element->c_Value.SetValueFromBigEndianBlob(c_Data);
-               }
-               else
-               {
-                  (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(c_Data);
-               }
+               this->m_SetContentFromBlob(pc_Element->c_Value, c_Data);
             }
          }
       }
@@ -246,7 +243,9 @@ int32_t C_OscDataDealer::DataPoolWrite(const uint8_t ou8_DataPoolIndex, const ui
          std::vector<uint8_t> c_Data;
 
          //is the value within the defines min/max ranges ?
+         this->mc_CriticalSectionContent.Acquire();
          s32_Return = pc_Element->CheckValueRange();
+         this->mc_CriticalSectionContent.Release();
          if (s32_Return != C_NO_ERR)
          {
             s32_Return = C_OVERFLOW;
@@ -254,14 +253,7 @@ int32_t C_OscDataDealer::DataPoolWrite(const uint8_t ou8_DataPoolIndex, const ui
          else
          {
             //convert native to protocol endianness depending on the type ...
-            if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-            {
-               pc_Element->c_Value.GetValueAsBigEndianBlob(c_Data);
-            }
-            else
-            {
-               pc_Element->c_Value.GetValueAsLittleEndianBlob(c_Data);
-            }
+            this->m_GetContentAsBlob(pc_Element->c_Value, c_Data);
 
             //use communication function matching the element type
             if (pc_Element->GetArray() == false)
@@ -340,14 +332,7 @@ int32_t C_OscDataDealer::NvmRead(const uint8_t ou8_DataPoolIndex, const uint16_t
             //we have data
             //convert to native endianness depending on the type ...
             //no possible problem we did not check for already ...
-            if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-            {
-               (void)pc_Element->c_NvmValue.SetValueFromBigEndianBlob(c_Data);
-            }
-            else
-            {
-               (void)pc_Element->c_NvmValue.SetValueFromLittleEndianBlob(c_Data);
-            }
+            this->m_SetContentFromBlob(pc_Element->c_NvmValue, c_Data);
          }
       }
    }
@@ -412,7 +397,9 @@ int32_t C_OscDataDealer::NvmWrite(const uint8_t ou8_DataPoolIndex, const uint16_
          std::vector<uint8_t> c_Data;
 
          //is the value within the defined min/max ranges ?
+         this->mc_CriticalSectionContent.Acquire();
          s32_Return = pc_Element->CheckNvmValueRange();
+         this->mc_CriticalSectionContent.Release();
          if (s32_Return != C_NO_ERR)
          {
             s32_Return = C_OVERFLOW;
@@ -420,14 +407,7 @@ int32_t C_OscDataDealer::NvmWrite(const uint8_t ou8_DataPoolIndex, const uint16_
          else
          {
             //convert native to protocol endianness depending on the type ...
-            if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-            {
-               pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_Data);
-            }
-            else
-            {
-               pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_Data);
-            }
+            this->m_GetContentAsBlob(pc_Element->c_NvmValue, c_Data);
 
             //write data to server:
             s32_Return = mpc_DiagProtocol->NvmWrite(pc_Element->u32_NvmStartAddress, c_Data, opu8_NrCode);
@@ -614,14 +594,7 @@ void C_OscDataDealer::m_ReadDataPoolDataEventReceived(const uint8_t ou8_DataPool
 
             //convert to native endianness depending on the type ...
             //no possible problem we did not check for already ...
-            if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-            {
-               (void)pc_Element->c_Value.SetValueFromBigEndianBlob(c_Data);
-            }
-            else
-            {
-               (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(c_Data);
-            }
+            this->m_SetContentFromBlob(pc_Element->c_Value, c_Data);
             //inform application
             m_OnReadDataPoolEventReceived(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex);
          }
@@ -702,3 +675,53 @@ void C_OscDataDealer::m_ReadDataPoolDataEventErrorReceived(const uint8_t ou8_Dat
       }
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Place received data into data pool content
+
+   Converts from the endianness of the diagnostic protocol to native endianness.
+   Done with mc_CriticalSectionContent held.
+
+   \param[in,out]  orc_Content   content to write to
+   \param[in]      orc_Data      data as received from server; size is expected to match the content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealer::m_SetContentFromBlob(C_OscNodeDataPoolContent & orc_Content,
+                                           const std::vector<uint8_t> & orc_Data) const
+{
+   this->mc_CriticalSectionContent.Acquire();
+   if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
+   {
+      (void)orc_Content.SetValueFromBigEndianBlob(orc_Data);
+   }
+   else
+   {
+      (void)orc_Content.SetValueFromLittleEndianBlob(orc_Data);
+   }
+   this->mc_CriticalSectionContent.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get data pool content in format to send to server
+
+   Converts from native endianness to the endianness of the diagnostic protocol.
+   Done with mc_CriticalSectionContent held.
+
+   \param[in]   orc_Content   content to read from
+   \param[out]  orc_Data      data to send to server
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealer::m_GetContentAsBlob(const C_OscNodeDataPoolContent & orc_Content,
+                                         std::vector<uint8_t> & orc_Data) const
+{
+   this->mc_CriticalSectionContent.Acquire();
+   if (mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
+   {
+      orc_Content.GetValueAsBigEndianBlob(orc_Data);
+   }
+   else
+   {
+      orc_Content.GetValueAsLittleEndianBlob(orc_Data);
+   }
+   this->mc_CriticalSectionContent.Release();
+}
@@ -80,6 +80,7 @@ private:
                               const bool oq_DivertStreamDesired);
    int32_t m_WriteStartFingerPrint(const C_XFLFingerPrintSupportedIndexes & orc_FingerPrintIndexes);
    void m_FlashingFinished(const E_XFLFlashFinishedAction oe_Action);
+   void m_SleepBeforeNetCommand(void);
    int32_t m_ScanDeviceIDFromHexFile(const uint32_t ou32_StartAddress, const bool oq_FailIfNotFoundAtStartAddress,
                                      C_XFLHexFile & orc_HexFile, stw::scl::C_SclString & orc_DeviceId) const;
    int32_t m_DoDeviceIDXCheck(C_XFLHexFile & orc_HexFile, const stw::scl::C_SclString & orc_DeviceId,
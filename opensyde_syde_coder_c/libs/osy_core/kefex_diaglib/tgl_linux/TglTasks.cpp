@@ -13,11 +13,14 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <unistd.h>
 #include <csignal>
+#include <sys/syscall.h>
 #include "stwtypes.hpp"
+#include "stwerrors.hpp"
 #include "TglTasks.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
+using namespace stw::errors;
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
@@ -75,3 +78,182 @@ void C_TglCriticalSection::Release(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   The thread is not started before calling Start().
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglThread::C_TglThread(void) :
+   mx_Thread(),
+   mq_Started(false),
+   mpr_Function(NULL),
+   mpv_Instance(NULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+
+   Waits for a still running thread to finish.
+   The owner is responsible for making the thread function return.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglThread::~C_TglThread(void)
+{
+   this->Join();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start thread
+
+   \param[in]  opr_Function   function to execute in the new thread
+   \param[in]  opv_Instance   parameter passed to the function
+
+   \return
+   C_NO_ERR   thread started
+   C_BUSY     thread was already started and not joined yet
+   C_RANGE    opr_Function is NULL
+   C_NOACT    could not create thread
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_TglThread::Start(const PR_ThreadFunction opr_Function, void * const opv_Instance)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->mq_Started == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else if (opr_Function == NULL)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->mpr_Function = opr_Function;
+      this->mpv_Instance = opv_Instance;
+      if (pthread_create(&this->mx_Thread, NULL, &C_TglThread::mh_ThreadFunc, this) == 0)
+      {
+         this->mq_Started = true;
+      }
+      else
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait for the thread function to return
+
+   Does nothing if the thread was not started.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_TglThread::Join(void)
+{
+   if (this->mq_Started == true)
+   {
+      (void)pthread_join(this->mx_Thread, NULL);
+      this->mq_Started = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether thread was started and not joined yet
+
+   \return
+   true    thread started
+   false   thread not started or already joined
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_TglThread::IsStarted(void) const
+{
+   return this->mq_Started;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Thread entry point
+
+   \param[in]  opv_Thread   instance of C_TglThread
+
+   \return
+   NULL (not used)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void * C_TglThread::mh_ThreadFunc(void * const opv_Thread)
+{
+   const C_TglThread * const pc_Thread = static_cast<const C_TglThread *>(opv_Thread);
+
+   pc_Thread->mpr_Function(pc_Thread->mpv_Instance);
+   return NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   The event is not signaled.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglEvent::C_TglEvent(void) :
+   mq_Signaled(false)
+{
+   pthread_mutex_init(&mu_Mutex, NULL);
+   pthread_cond_init(&mu_Condition, NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglEvent::~C_TglEvent(void)
+{
+   pthread_cond_destroy(&mu_Condition);
+   pthread_mutex_destroy(&mu_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Signal event
+
+   Wakes up a waiting thread. If no thread is waiting the next call of Wait() returns immediately.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_TglEvent::Signal(void)
+{
+   pthread_mutex_lock(&mu_Mutex);
+   mq_Signaled = true;
+   pthread_cond_signal(&mu_Condition);
+   pthread_mutex_unlock(&mu_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait until the event is signaled
+
+   Resets the event before returning.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_TglEvent::Wait(void)
+{
+   pthread_mutex_lock(&mu_Mutex);
+   //loop: pthread_cond_wait may return spuriously
+   while (mq_Signaled == false)
+   {
+      pthread_cond_wait(&mu_Condition, &mu_Mutex);
+   }
+   mq_Signaled = false;
+   pthread_mutex_unlock(&mu_Mutex);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get ID of calling thread
+
+   \return
+   ID of calling thread as shown by the operating system
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t stw::tgl::TglGetCurrentThreadId(void)
+{
+   return static_cast<uint32_t>(syscall(SYS_gettid));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #include "TglFile.hpp"
 #include "TglUtils.hpp"
 #include "C_OscProjectFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscXmlParser.hpp"
 #include "C_OscLoggingHandler.hpp"
 
@@ -121,6 +122,7 @@ int32_t C_OscProjectFiler::h_Save(C_OscProject & orc_Project, const C_SclString
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscProjectFiler::h_Load(C_OscProject & orc_Project, const C_SclString & orc_Path)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "Project file", orc_Path);
    int32_t s32_Retval;
 
    if (TglFileExists(orc_Path) == true)
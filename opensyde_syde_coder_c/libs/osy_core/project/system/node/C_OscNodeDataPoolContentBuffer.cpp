@@ -0,0 +1,205 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Raw value storage of a data pool content
+
+   Holds the bytes of a data pool content value.
+   Scalars and short arrays are stored inline so creating and copying them does not allocate.
+   Larger arrays use heap memory.
+
+   The class is not thread safe. Users sharing content between threads must synchronize on their own level
+   (e.g. the data dealers).
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "stwtypes.hpp"
+#include "C_OscNodeDataPoolContentBuffer.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Starts with an empty inline storage.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::C_OscNodeDataPoolContentBuffer(void) :
+   mpu8_Heap(NULL),
+   mu32_Capacity(hu32_INLINE_SIZE),
+   mu32_Size(0U)
+{
+   (void)std::memset(&this->mau8_Inline[0], 0, sizeof(this->mau8_Inline));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Copy constructor
+
+   \param[in]  orc_Source  Reference to source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::C_OscNodeDataPoolContentBuffer(const C_OscNodeDataPoolContentBuffer & orc_Source) :
+   mpu8_Heap(NULL),
+   mu32_Capacity(hu32_INLINE_SIZE),
+   mu32_Size(0U)
+{
+   if (orc_Source.mu32_Size <= hu32_INLINE_SIZE)
+   {
+      //small value: no allocation; bytes beyond the size are never read
+      (void)std::memcpy(&this->mau8_Inline[0], orc_Source.GetData(), orc_Source.mu32_Size);
+      this->mu32_Size = orc_Source.mu32_Size;
+   }
+   else
+   {
+      this->mpu8_Heap = new uint8_t[orc_Source.mu32_Size];
+      this->mu32_Capacity = orc_Source.mu32_Size;
+      this->mu32_Size = orc_Source.mu32_Size;
+      (void)std::memcpy(this->mpu8_Heap, orc_Source.mpu8_Heap, orc_Source.mu32_Size);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Assignment operator
+
+   \param[in]  orc_Source  Reference to source
+
+   \return
+   reference to new instance
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer & C_OscNodeDataPoolContentBuffer::operator =(
+   const C_OscNodeDataPoolContentBuffer & orc_Source)
+{
+   if (this != &orc_Source)
+   {
+      if (orc_Source.mu32_Size > this->mu32_Capacity)
+      {
+         //current storage is too small: replace it; the old content is overwritten anyway
+         //allocate first so this instance stays intact if the allocation throws
+         uint8_t * const pu8_NewData = new uint8_t[orc_Source.mu32_Size];
+         delete[] this->mpu8_Heap;
+         this->mpu8_Heap = pu8_NewData;
+         this->mu32_Capacity = orc_Source.mu32_Size;
+      }
+      this->mu32_Size = orc_Source.mu32_Size;
+      (void)std::memcpy(this->GetData(), orc_Source.GetData(), orc_Source.mu32_Size);
+   }
+   return (*this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Destructor
+
+   Release heap storage (if any)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscNodeDataPoolContentBuffer::~C_OscNodeDataPoolContentBuffer(void)
+{
+   delete[] this->mpu8_Heap;
+   this->mpu8_Heap = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Change number of bytes in use
+
+   Existing bytes are kept (up to the new size). Added bytes are set to zero.
+
+   \param[in]  ou32_Size   new number of bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscNodeDataPoolContentBuffer::Resize(const uint32_t ou32_Size)
+{
+   if (ou32_Size > this->mu32_Capacity)
+   {
+      uint8_t * const pu8_NewData = new uint8_t[ou32_Size];
+      (void)std::memcpy(pu8_NewData, this->GetData(), this->mu32_Size);
+      delete[] this->mpu8_Heap;
+      this->mpu8_Heap = pu8_NewData;
+      this->mu32_Capacity = ou32_Size;
+   }
+   if (ou32_Size > this->mu32_Size)
+   {
+      (void)std::memset(&this->GetData()[this->mu32_Size], 0, ou32_Size - this->mu32_Size);
+   }
+   this->mu32_Size = ou32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of bytes in use
+
+   \return
+   number of bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscNodeDataPoolContentBuffer::GetSize(void) const
+{
+   return this->mu32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get access to the stored bytes
+
+   The returned pointer is valid even if no bytes are in use.
+   It gets invalid when the buffer is resized or assigned to.
+
+   \return
+   pointer to first byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8_t * C_OscNodeDataPoolContentBuffer::GetData(void)
+{
+   uint8_t * pu8_Data;
+
+   if (this->mpu8_Heap != NULL)
+   {
+      pu8_Data = this->mpu8_Heap;
+   }
+   else
+   {
+      pu8_Data = &this->mau8_Inline[0];
+   }
+   return pu8_Data;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get read access to the stored bytes
+
+   See non-const variant for details.
+
+   \return
+   pointer to first byte
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8_t * C_OscNodeDataPoolContentBuffer::GetData(void) const
+{
+   const uint8_t * pu8_Data;
+
+   if (this->mpu8_Heap != NULL)
+   {
+      pu8_Data = this->mpu8_Heap;
+   }
+   else
+   {
+      pu8_Data = &this->mau8_Inline[0];
+   }
+   return pu8_Data;
+}
@@ -18,6 +18,7 @@
 #include "stwerrors.hpp"
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscNodeDataPoolFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "TglUtils.hpp"
 #include "C_OscLoggingHandler.hpp"
 
@@ -29,6 +30,27 @@ using namespace stw::scl;
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_VALUE("value");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_FACTOR("factor");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_OFFSET("offset");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_INTERPRET_AS_STRING("interpret_as_string");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_DIAG_EVENT_CALL("diag-event-call");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_NVM_START_ADDRESS("nvm-start-address");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_LENGTH("length");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_IS_ARRAY("is-array");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_ATTR_ARRAY_SIZE("array-size");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_ELEMENT("element");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_DATA_ELEMENT("data-element");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_DATA_ELEMENTS("data-elements");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_DATA_SET_VALUE("data-set-value");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_DATA_SET_VALUES("data-set-values");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_NAME("name");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_MIN_VALUE("min-value");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_MAX_VALUE("max-value");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_COMMENT("comment");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_UNIT("unit");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_ACCESS("access");
+const C_OscXmlName C_OscNodeDataPoolFiler::mhc_NODE_TYPE("type");
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -62,9 +84,11 @@ C_OscNodeDataPoolFiler::C_OscNodeDataPoolFiler(void)
 int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolFile(C_OscNodeDataPool & orc_NodeDataPool,
                                                    const C_SclString & orc_FilePath)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "Datapool file", orc_FilePath);
    C_OscXmlParser c_XmlParser;
+   //the file is only read: no need for a full DOM
    int32_t s32_Retval = C_OscSystemFilerUtil::h_GetParserForExistingFile(c_XmlParser, orc_FilePath,
-                                                                         "opensyde-dp-core-definition");
+                                                                         "opensyde-dp-core-definition", true);
 
    //File version
    if (c_XmlParser.SelectNodeChild("file-version") == "file-version")
@@ -420,16 +444,16 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
 {
    int32_t s32_Retval = C_NO_ERR;
 
-   orc_NodeDataPoolListElement.f64_Factor = orc_XmlParser.GetAttributeFloat64("factor");
-   orc_NodeDataPoolListElement.f64_Offset = orc_XmlParser.GetAttributeFloat64("offset");
-   orc_NodeDataPoolListElement.q_InterpretAsString = orc_XmlParser.GetAttributeBool("interpret_as_string");
-   orc_NodeDataPoolListElement.q_DiagEventCall = orc_XmlParser.GetAttributeBool("diag-event-call");
-   orc_NodeDataPoolListElement.u32_NvmStartAddress = orc_XmlParser.GetAttributeUint32("nvm-start-address");
-   if (orc_XmlParser.SelectNodeChild("name") == "name")
+   orc_NodeDataPoolListElement.f64_Factor = orc_XmlParser.GetAttributeFloat64(mhc_ATTR_FACTOR);
+   orc_NodeDataPoolListElement.f64_Offset = orc_XmlParser.GetAttributeFloat64(mhc_ATTR_OFFSET);
+   orc_NodeDataPoolListElement.q_InterpretAsString = orc_XmlParser.GetAttributeBool(mhc_ATTR_INTERPRET_AS_STRING);
+   orc_NodeDataPoolListElement.q_DiagEventCall = orc_XmlParser.GetAttributeBool(mhc_ATTR_DIAG_EVENT_CALL);
+   orc_NodeDataPoolListElement.u32_NvmStartAddress = orc_XmlParser.GetAttributeUint32(mhc_ATTR_NVM_START_ADDRESS);
+   if (orc_XmlParser.SelectNodeChild(mhc_NODE_NAME) == true)
    {
-      orc_NodeDataPoolListElement.c_Name = orc_XmlParser.GetNodeContent();
+      orc_NodeDataPoolListElement.c_Name = orc_XmlParser.GetNodeContentRaw();
       //Return
-      tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+      tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
    }
    else
    {
@@ -442,7 +466,7 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XmlParser.SelectNodeChild("min-value") == "min-value")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_MIN_VALUE) == true)
       {
          //copy over value so we have the correct type:
          orc_NodeDataPoolListElement.c_MinValue = orc_NodeDataPoolListElement.c_Value;
@@ -452,7 +476,7 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
          orc_NodeDataPoolListElement.c_NvmValue = orc_NodeDataPoolListElement.c_MinValue;
          orc_NodeDataPoolListElement.c_Value = orc_NodeDataPoolListElement.c_MinValue;
          //Return
-         tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
       }
       else
       {
@@ -463,14 +487,14 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XmlParser.SelectNodeChild("max-value") == "max-value")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_MAX_VALUE) == true)
       {
          //copy over value so we have the correct type:
          orc_NodeDataPoolListElement.c_MaxValue = orc_NodeDataPoolListElement.c_Value;
 
          s32_Retval = h_LoadDataPoolElementValue(orc_NodeDataPoolListElement.c_MaxValue, orc_XmlParser, false);
          //Return
-         tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
       }
       else
       {
@@ -481,11 +505,11 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XmlParser.SelectNodeChild("comment") == "comment")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_COMMENT) == true)
       {
-         orc_NodeDataPoolListElement.c_Comment = orc_XmlParser.GetNodeContent();
+         orc_NodeDataPoolListElement.c_Comment = orc_XmlParser.GetNodeContentRaw();
          //Return
-         tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
       }
       else
       {
@@ -496,11 +520,11 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XmlParser.SelectNodeChild("unit") == "unit")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_UNIT) == true)
       {
-         orc_NodeDataPoolListElement.c_Unit = orc_XmlParser.GetNodeContent();
+         orc_NodeDataPoolListElement.c_Unit = orc_XmlParser.GetNodeContentRaw();
          //Return
-         tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
       }
       else
       {
@@ -511,12 +535,13 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XmlParser.SelectNodeChild("access") == "access")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_ACCESS) == true)
       {
          s32_Retval =
-            mh_StringToNodeDataPoolElementAccess(orc_XmlParser.GetNodeContent(), orc_NodeDataPoolListElement.e_Access);
+            mh_StringToNodeDataPoolElementAccess(orc_XmlParser.GetNodeContentRaw(),
+                                                 orc_NodeDataPoolListElement.e_Access);
          //Return
-         tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
       }
       else
       {
@@ -527,13 +552,13 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElement(C_OscNodeDataPoolListEleme
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XmlParser.SelectNodeChild("data-set-values") == "data-set-values")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_DATA_SET_VALUES) == true)
       {
          s32_Retval = h_LoadDataPoolListElementDataSetValues(orc_NodeDataPoolListElement.c_Value,
                                                              orc_NodeDataPoolListElement.c_DataSetValues,
                                                              orc_XmlParser);
          //Return
-         tgl_assert(orc_XmlParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENT));
       }
       else
       {
@@ -705,22 +730,19 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolListElements(
    std::vector<C_OscNodeDataPoolListElement> & orc_NodeDataPoolListElements, C_OscXmlParserBase & orc_XmlParser)
 {
    int32_t s32_Retval = C_NO_ERR;
-   C_SclString c_CurNodeDataElement;
    uint32_t u32_ExpectedSize = 0UL;
-   const bool q_ExpectedSizeHere = orc_XmlParser.AttributeExists("length");
+   const bool q_ExpectedSizeHere = orc_XmlParser.AttributeExists(mhc_ATTR_LENGTH);
 
    //Check optional length
    if (q_ExpectedSizeHere == true)
    {
-      u32_ExpectedSize = orc_XmlParser.GetAttributeUint32("length");
+      u32_ExpectedSize = orc_XmlParser.GetAttributeUint32(mhc_ATTR_LENGTH);
       orc_NodeDataPoolListElements.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeDataElement = orc_XmlParser.SelectNodeChild("data-element");
-
    //Clear
    orc_NodeDataPoolListElements.clear();
-   if (c_CurNodeDataElement == "data-element")
+   if (orc_XmlParser.SelectNodeChild(mhc_NODE_DATA_ELEMENT) == true)
    {
       do
       {
@@ -733,13 +755,11 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolListElements(
 
          //Append
          orc_NodeDataPoolListElements.push_back(c_CurDataElement);
-
-         //Next
-         c_CurNodeDataElement = orc_XmlParser.SelectNodeNext("data-element");
       }
-      while (c_CurNodeDataElement == "data-element");
+      //Next
+      while (orc_XmlParser.SelectNodeNext(mhc_NODE_DATA_ELEMENT) == true);
       //Return
-      tgl_assert(orc_XmlParser.SelectNodeParent() == "data-elements");
+      tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_ELEMENTS));
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -805,9 +825,7 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolListElementDataSetValues(const C_O
                                                                        C_OscXmlParserBase & orc_XmlParser)
 {
    int32_t s32_Retval = C_NO_ERR;
-   C_SclString c_CurNodeDataSetValue = orc_XmlParser.SelectNodeChild("data-set-value");
-
-   if (c_CurNodeDataSetValue == "data-set-value")
+   if (orc_XmlParser.SelectNodeChild(mhc_NODE_DATA_SET_VALUE) == true)
    {
       do
       {
@@ -820,13 +838,11 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolListElementDataSetValues(const C_O
 
          //Append
          orc_NodeDataPoolListElementDataSetValues.push_back(c_CurDataSetValue);
-
-         //Next
-         c_CurNodeDataSetValue = orc_XmlParser.SelectNodeNext("data-set-value");
       }
-      while (c_CurNodeDataSetValue == "data-set-value");
+      //Next
+      while (orc_XmlParser.SelectNodeNext(mhc_NODE_DATA_SET_VALUE) == true);
       //Return
-      tgl_assert(orc_XmlParser.SelectNodeParent() == "data-set-values");
+      tgl_assert(orc_XmlParser.SelectNodeParentRaw() && orc_XmlParser.IsCurrentNode(mhc_NODE_DATA_SET_VALUES));
    }
    return s32_Retval;
 }
@@ -1046,21 +1062,21 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElementType(C_OscNodeDataPoolConte
 {
    int32_t s32_Retval = C_CONFIG;
 
-   if (orc_XmlParser.SelectNodeChild("type") == "type")
+   if (orc_XmlParser.SelectNodeChild(mhc_NODE_TYPE) == true)
    {
       C_OscNodeDataPoolContent::E_Type e_Type;
       s32_Retval = mh_StringToNodeDataPoolContent(orc_XmlParser.GetAttributeString("base-type"), e_Type);
       if (s32_Retval == C_NO_ERR)
       {
          orc_NodeDataPoolContent.SetType(e_Type);
-         orc_NodeDataPoolContent.SetArray(orc_XmlParser.GetAttributeBool("is-array"));
+         orc_NodeDataPoolContent.SetArray(orc_XmlParser.GetAttributeBool(mhc_ATTR_IS_ARRAY));
          if (orc_NodeDataPoolContent.GetArray() == true)
          {
-            orc_NodeDataPoolContent.SetArraySize(orc_XmlParser.GetAttributeUint32("array-size"));
+            orc_NodeDataPoolContent.SetArraySize(orc_XmlParser.GetAttributeUint32(mhc_ATTR_ARRAY_SIZE));
          }
       }
       //Return
-      orc_XmlParser.SelectNodeParent();
+      orc_XmlParser.SelectNodeParentRaw();
    }
    else
    {
@@ -1133,34 +1149,35 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OscNodeDataPoolCont
          switch (orc_NodeDataPoolContent.GetType())
          {
          case C_OscNodeDataPoolContent::eUINT8:
-            orc_NodeDataPoolContent.SetValueU8(static_cast<uint8_t>(orc_XmlParser.GetAttributeUint32("value")));
+            orc_NodeDataPoolContent.SetValueU8(static_cast<uint8_t>(orc_XmlParser.GetAttributeUint32(mhc_ATTR_VALUE)));
             break;
          case C_OscNodeDataPoolContent::eUINT16:
-            orc_NodeDataPoolContent.SetValueU16(static_cast<uint16_t>(orc_XmlParser.GetAttributeUint32("value")));
+            orc_NodeDataPoolContent.SetValueU16(
+               static_cast<uint16_t>(orc_XmlParser.GetAttributeUint32(mhc_ATTR_VALUE)));
             break;
          case C_OscNodeDataPoolContent::eUINT32:
-            orc_NodeDataPoolContent.SetValueU32(orc_XmlParser.GetAttributeUint32("value"));
+            orc_NodeDataPoolContent.SetValueU32(orc_XmlParser.GetAttributeUint32(mhc_ATTR_VALUE));
             break;
          case C_OscNodeDataPoolContent::eUINT64:
-            orc_NodeDataPoolContent.SetValueU64(orc_XmlParser.GetAttributeUint64("value"));
+            orc_NodeDataPoolContent.SetValueU64(orc_XmlParser.GetAttributeUint64(mhc_ATTR_VALUE));
             break;
          case C_OscNodeDataPoolContent::eSINT8:
-            orc_NodeDataPoolContent.SetValueS8(static_cast<int8_t>(orc_XmlParser.GetAttributeSint64("value")));
+            orc_NodeDataPoolContent.SetValueS8(static_cast<int8_t>(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE)));
             break;
          case C_OscNodeDataPoolContent::eSINT16:
-            orc_NodeDataPoolContent.SetValueS16(static_cast<int16_t>(orc_XmlParser.GetAttributeSint64("value")));
+            orc_NodeDataPoolContent.SetValueS16(static_cast<int16_t>(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE)));
             break;
          case C_OscNodeDataPoolContent::eSINT32:
-            orc_NodeDataPoolContent.SetValueS32(static_cast<int32_t>(orc_XmlParser.GetAttributeSint64("value")));
+            orc_NodeDataPoolContent.SetValueS32(static_cast<int32_t>(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE)));
             break;
          case C_OscNodeDataPoolContent::eSINT64:
-            orc_NodeDataPoolContent.SetValueS64(orc_XmlParser.GetAttributeSint64("value"));
+            orc_NodeDataPoolContent.SetValueS64(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE));
             break;
          case C_OscNodeDataPoolContent::eFLOAT32:
-            orc_NodeDataPoolContent.SetValueF32(orc_XmlParser.GetAttributeFloat32("value"));
+            orc_NodeDataPoolContent.SetValueF32(orc_XmlParser.GetAttributeFloat32(mhc_ATTR_VALUE));
             break;
          case C_OscNodeDataPoolContent::eFLOAT64:
-            orc_NodeDataPoolContent.SetValueF64(orc_XmlParser.GetAttributeFloat64("value"));
+            orc_NodeDataPoolContent.SetValueF64(orc_XmlParser.GetAttributeFloat64(mhc_ATTR_VALUE));
             break;
          default:
             break;
@@ -1170,8 +1187,7 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OscNodeDataPoolCont
    else
    {
       //Array
-      C_SclString c_CurNode = orc_XmlParser.SelectNodeChild("element");
-      if (c_CurNode == "element")
+      if (orc_XmlParser.SelectNodeChild(mhc_NODE_ELEMENT) == true)
       {
          uint32_t u32_CurIndex = 0U;
          do
@@ -1189,51 +1205,51 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OscNodeDataPoolCont
             switch (orc_NodeDataPoolContent.GetType())
             {
             case C_OscNodeDataPoolContent::eUINT8:
-               orc_NodeDataPoolContent.SetValueArrU8Element(static_cast<uint8_t>(orc_XmlParser.GetAttributeUint32(
-                                                                                    "value")), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueArrU8Element(
+                  static_cast<uint8_t>(orc_XmlParser.GetAttributeUint32(mhc_ATTR_VALUE)), u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eUINT16:
-               orc_NodeDataPoolContent.SetValueArrU16Element(static_cast<uint16_t>(orc_XmlParser.GetAttributeUint32(
-                                                                                      "value")), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueArrU16Element(
+                  static_cast<uint16_t>(orc_XmlParser.GetAttributeUint32(mhc_ATTR_VALUE)), u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eUINT32:
-               orc_NodeDataPoolContent.SetValueArrU32Element(orc_XmlParser.GetAttributeUint32("value"),
+               orc_NodeDataPoolContent.SetValueArrU32Element(orc_XmlParser.GetAttributeUint32(mhc_ATTR_VALUE),
                                                              u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eUINT64:
-               orc_NodeDataPoolContent.SetValueArrU64Element(orc_XmlParser.GetAttributeUint64("value"), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueArrU64Element(orc_XmlParser.GetAttributeUint64(mhc_ATTR_VALUE),
+                                                             u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eSINT8:
-               orc_NodeDataPoolContent.SetValueArrS8Element(static_cast<int8_t>(orc_XmlParser.GetAttributeSint64(
-                                                                                   "value")), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueArrS8Element(
+                  static_cast<int8_t>(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE)), u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eSINT16:
-               orc_NodeDataPoolContent.SetValueArrS16Element(static_cast<int16_t>(orc_XmlParser.GetAttributeSint64(
-                                                                                     "value")), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueArrS16Element(
+                  static_cast<int16_t>(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE)), u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eSINT32:
-               orc_NodeDataPoolContent.SetValueArrS32Element(static_cast<int32_t>(orc_XmlParser.GetAttributeSint64(
-                                                                                     "value")), u32_CurIndex);
+               orc_NodeDataPoolContent.SetValueArrS32Element(
+                  static_cast<int32_t>(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE)), u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eSINT64:
-               orc_NodeDataPoolContent.SetValueArrS64Element(orc_XmlParser.GetAttributeSint64("value"),
+               orc_NodeDataPoolContent.SetValueArrS64Element(orc_XmlParser.GetAttributeSint64(mhc_ATTR_VALUE),
                                                              u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eFLOAT32:
-               orc_NodeDataPoolContent.SetValueArrF32Element(orc_XmlParser.GetAttributeFloat32("value"),
+               orc_NodeDataPoolContent.SetValueArrF32Element(orc_XmlParser.GetAttributeFloat32(mhc_ATTR_VALUE),
                                                              u32_CurIndex);
                break;
             case C_OscNodeDataPoolContent::eFLOAT64:
-               orc_NodeDataPoolContent.SetValueArrF64Element(orc_XmlParser.GetAttributeFloat64("value"),
+               orc_NodeDataPoolContent.SetValueArrF64Element(orc_XmlParser.GetAttributeFloat64(mhc_ATTR_VALUE),
                                                              u32_CurIndex);
                break;
             default:
                break;
             }
             u32_CurIndex++; //next element
-            c_CurNode = orc_XmlParser.SelectNodeNext("element");
          }
-         while ((c_CurNode == "element") && (s32_Retval == C_NO_ERR));
+         while ((orc_XmlParser.SelectNodeNext(mhc_NODE_ELEMENT) == true) && (s32_Retval == C_NO_ERR));
 
          //check whether we have the correct number of elements:
          if (u32_CurIndex != orc_NodeDataPoolContent.GetArraySize())
@@ -1243,7 +1259,7 @@ int32_t C_OscNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OscNodeDataPoolCont
          }
       }
       //Return
-      orc_XmlParser.SelectNodeParent();
+      orc_XmlParser.SelectNodeParentRaw();
    }
 
    return s32_Retval;
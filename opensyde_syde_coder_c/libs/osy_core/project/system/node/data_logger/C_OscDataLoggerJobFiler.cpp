@@ -20,6 +20,7 @@
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscNodeDataPoolFiler.hpp"
 #include "C_OscDataLoggerJobFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::tgl;
@@ -56,6 +57,7 @@ const uint16_t C_OscDataLoggerJobFiler::mhu16_FILE_VERSION_1 = 1;
 int32_t C_OscDataLoggerJobFiler::h_LoadFile(std::vector<C_OscDataLoggerJob> & orc_Config,
                                             const stw::scl::C_SclString & orc_Path)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "Data logger file", orc_Path);
    int32_t s32_Retval = C_NO_ERR;
 
    if (TglFileExists(orc_Path) == true)
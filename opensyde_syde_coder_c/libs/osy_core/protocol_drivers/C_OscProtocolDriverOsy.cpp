@@ -130,6 +130,61 @@ void C_OscProtocolDriverOsy::SetMaxServiceSize(const uint16_t ou16_MaxServiceSiz
    mu16_MaxServiceSize = ou16_MaxServiceSize;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of data bytes transferred by one "ReadMemoryByAddress" service
+
+   OsyReadMemoryByAddress splits bigger requests into services of this size.
+
+   Protocol overhead for ReadMemoryByAddress:
+   * 1 byte service ID
+   * 1 byte FormatIdentifier
+   * 1..4 bytes address
+   * 1..4 bytes size
+
+   If traffic encryption is active the service size that can effectively be transferred is further reduced by the
+    protocol overhead needed for encryption (4 bytes header + padding to multiples of 16 bytes).
+
+   \return
+   maximum number of data bytes per service
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscProtocolDriverOsy::GetReadMemoryBlockSize(void) const
+{
+   uint32_t u32_BlockSize = (C_OscProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE - 10U);
+
+   tgl_assert(this->pc_SecuritySubLayer != NULL);
+   if ((this->pc_SecuritySubLayer != NULL) && (this->pc_SecuritySubLayer->GetEncryptionIsActive() == true))
+   {
+      const uint16_t u16_EncryptionOverhead = static_cast<uint16_t>(4U + ((u32_BlockSize) % 16U));
+      u32_BlockSize -= u16_EncryptionOverhead;
+   }
+   return u32_BlockSize;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of data bytes transferred by one "WriteMemoryByAddress" service
+
+   OsyWriteMemoryByAddress splits bigger requests into services of this size.
+   Based on the service size configured with SetMaxServiceSize.
+   Protocol and encryption overhead are considered as described for GetReadMemoryBlockSize.
+
+   \return
+   maximum number of data bytes per service
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscProtocolDriverOsy::GetWriteMemoryBlockSize(void) const
+{
+   uint32_t u32_BlockSize = static_cast<uint32_t>(mu16_MaxServiceSize) - 10U;
+
+   tgl_assert(this->pc_SecuritySubLayer != NULL);
+   if ((this->pc_SecuritySubLayer != NULL) && (this->pc_SecuritySubLayer->GetEncryptionIsActive() == true))
+   {
+      const uint16_t u16_EncryptionOverhead = static_cast<uint16_t>(4U + ((u32_BlockSize) % 16U));
+      u32_BlockSize -= u16_EncryptionOverhead;
+   }
+   return u32_BlockSize;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Initialization of the async handling of tunneled CAN messages
 
@@ -5442,22 +5497,8 @@ int32_t C_OscProtocolDriverOsy::OsyReadMemoryByAddress(const uint32_t ou32_Memor
    }
    else
    {
-      //Protocol overhead for ReadMemoryByAddress:
-      //1 byte service ID
-      //1 byte FormatIdentifier
-      //1..4 bytes address
-      //1..4 bytes size
-      uint32_t u32_BlockSize = (C_OscProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE - 10U);
-
-      //if traffic encryption is active we need to consider that the service size that can effectively
-      // be transferred is reduced by the protocol overhead needed for encryption
-      //4bytes header + padding to multiples of 16 bytes
-      tgl_assert(this->pc_SecuritySubLayer != NULL);
-      if (this->pc_SecuritySubLayer->GetEncryptionIsActive() == true)
-      {
-         const uint16_t u16_EncryptionOverhead = static_cast<uint16_t>(4U + ((u32_BlockSize) % 16U));
-         u32_BlockSize -= u16_EncryptionOverhead;
-      }
+      //considers protocol and encryption overhead:
+      const uint32_t u32_BlockSize = this->GetReadMemoryBlockSize();
 
       //split up into smaller blocks:
       for (uint32_t u32_ReadIndex = 0U; u32_ReadIndex < orc_DataRecord.size(); u32_ReadIndex += u32_BlockSize)
@@ -5575,22 +5616,8 @@ int32_t C_OscProtocolDriverOsy::OsyWriteMemoryByAddress(const uint32_t ou32_Memo
    }
    else
    {
-      //worst case protocol overhead:
-      //1 byte service ID
-      //1 byte FormatIdentifier
-      //1..4 bytes address
-      //1..4 bytes size
-      const uint32_t u32_BlockSize = static_cast<uint32_t>(mu16_MaxServiceSize) - 10U;
-
-      //if traffic encryption is active we need to consider that the service size that can effectively
-      // be transferred is reduced by the protocol overhead needed for encryption
-      //4bytes header + padding to multiples of 16 bytes
-      tgl_assert(this->pc_SecuritySubLayer != NULL);
-      if (this->pc_SecuritySubLayer->GetEncryptionIsActive() == true)
-      {
-         const uint16_t u16_EncryptionOverhead = static_cast<uint16_t>(4U + ((u32_BlockSize) % 16U));
-         mu16_MaxServiceSize -= u16_EncryptionOverhead;
-      }
+      //considers worst case protocol overhead and encryption overhead:
+      const uint32_t u32_BlockSize = this->GetWriteMemoryBlockSize();
 
       //split up into smaller blocks:
       for (uint32_t u32_WriteIndex = 0U; u32_WriteIndex < orc_DataRecord.size(); u32_WriteIndex += u32_BlockSize)
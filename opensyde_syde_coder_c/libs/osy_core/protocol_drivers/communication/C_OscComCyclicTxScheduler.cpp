@@ -0,0 +1,275 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Transmit schedule of registered CAN messages
+
+   Priority queue of all messages registered for (cyclic) transmission, ordered by the next point in time to send.
+   Checking for due messages only looks at the front of the queue, so its cost does not depend on the number of
+   registered messages.
+
+   All times are in microseconds of TglGetTickCountUs.
+   The next point in time of a cyclic message is calculated from its previous one, not from the actual sending time.
+   So the period does not drift with the latency of the calling thread and the initial offset is kept.
+   If a message could not be sent for more than one period the missed periods are skipped and counted
+   instead of sending a burst.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+
+#include "TglUtils.hpp"
+#include "C_OscComCyclicTxScheduler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComCyclicTxScheduler::C_OscComCyclicTxScheduler(void) :
+   mu32_NextSequence(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Register a message for transmission
+
+   \param[in]  orc_MsgCfg        Message configuration; interval 0 for sending only once
+   \param[in]  ou64_FirstDueUs   First point in time to send the message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComCyclicTxScheduler::Add(const C_OscComDriverBaseCanMessage & orc_MsgCfg, const uint64_t ou64_FirstDueUs)
+{
+   C_Entry c_Entry;
+
+   c_Entry.c_Statistics.c_MsgCfg = orc_MsgCfg;
+   c_Entry.u64_DueUs = ou64_FirstDueUs;
+   c_Entry.u64_IntervalUs = static_cast<uint64_t>(orc_MsgCfg.u32_Interval) * 1000U;
+   c_Entry.u32_Sequence = this->mu32_NextSequence;
+   ++this->mu32_NextSequence;
+
+   this->mc_Entries.push_back(c_Entry);
+   std::push_heap(this->mc_Entries.begin(), this->mc_Entries.end(), &C_OscComCyclicTxScheduler::mh_IsLater);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of registered messages
+
+   \return
+   Number of registered messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscComCyclicTxScheduler::GetSize(void) const
+{
+   return static_cast<uint32_t>(this->mc_Entries.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get registered message
+
+   The index order is not the order of registration or transmission and changes with each transmission.
+   The send relevant parts of the message (ID, interval) must not be changed.
+
+   \param[in]  ou32_Index  Index of message; must be smaller than the result of GetSize
+
+   \return
+   Registered message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComDriverBaseCanMessage & C_OscComCyclicTxScheduler::GetMessage(const uint32_t ou32_Index)
+{
+   tgl_assert(ou32_Index < this->mc_Entries.size());
+   return this->mc_Entries[ou32_Index].c_Statistics.c_MsgCfg;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get transmission statistics of registered message
+
+   \param[in]  ou32_Index  Index of message; must be smaller than the result of GetSize
+
+   \return
+   Statistics of message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscComDriverBaseCanMessageStatistics & C_OscComCyclicTxScheduler::GetStatistics(const uint32_t ou32_Index)
+const
+{
+   tgl_assert(ou32_Index < this->mc_Entries.size());
+   return this->mc_Entries[ou32_Index].c_Statistics;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove registered message
+
+   \param[in]  ou32_Index  Index of message; must be smaller than the result of GetSize
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComCyclicTxScheduler::Remove(const uint32_t ou32_Index)
+{
+   if (ou32_Index < this->mc_Entries.size())
+   {
+      this->mc_Entries.erase(this->mc_Entries.begin() + ou32_Index);
+      std::make_heap(this->mc_Entries.begin(), this->mc_Entries.end(), &C_OscComCyclicTxScheduler::mh_IsLater);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all registered messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComCyclicTxScheduler::Clear(void)
+{
+   this->mc_Entries.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Restart the schedule after a break of transmission
+
+   Messages which were due during the break are due now; the statistics are reset.
+
+   \param[in]  ou64_NowUs  Current time
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComCyclicTxScheduler::Resynchronize(const uint64_t ou64_NowUs)
+{
+   for (uint32_t u32_ItEntry = 0U; u32_ItEntry < this->mc_Entries.size(); ++u32_ItEntry)
+   {
+      C_Entry & rc_Entry = this->mc_Entries[u32_ItEntry];
+      const C_OscComDriverBaseCanMessage c_MsgCfg = rc_Entry.c_Statistics.c_MsgCfg;
+
+      rc_Entry.c_Statistics = C_OscComDriverBaseCanMessageStatistics();
+      rc_Entry.c_Statistics.c_MsgCfg = c_MsgCfg;
+      rc_Entry.u64_DueUs = std::max(rc_Entry.u64_DueUs, ou64_NowUs);
+   }
+   std::make_heap(this->mc_Entries.begin(), this->mc_Entries.end(), &C_OscComCyclicTxScheduler::mh_IsLater);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get next message to send
+
+   After sending the message ConfirmDue must be called before calling this function again.
+
+   \param[in]  ou64_NowUs  Current time
+
+   \return
+   NULL     No message due
+   Else     Message to send now
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComDriverBaseCanMessage * C_OscComCyclicTxScheduler::GetDue(const uint64_t ou64_NowUs)
+{
+   C_OscComDriverBaseCanMessage * pc_Retval = NULL;
+
+   if ((this->mc_Entries.empty() == false) && (this->mc_Entries.front().u64_DueUs <= ou64_NowUs))
+   {
+      pc_Retval = &this->mc_Entries.front().c_Statistics.c_MsgCfg;
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Mark the message returned by GetDue as sent
+
+   Updates the statistics and schedules the next transmission.
+   Single shot messages are removed.
+
+   \param[in]  ou64_NowUs  Time the message was sent
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComCyclicTxScheduler::ConfirmDue(const uint64_t ou64_NowUs)
+{
+   if (this->mc_Entries.empty() == false)
+   {
+      std::pop_heap(this->mc_Entries.begin(), this->mc_Entries.end(), &C_OscComCyclicTxScheduler::mh_IsLater);
+      if (this->mc_Entries.back().u64_IntervalUs == 0U)
+      {
+         this->mc_Entries.pop_back();
+      }
+      else
+      {
+         C_Entry & rc_Entry = this->mc_Entries.back();
+         C_OscComDriverBaseCanMessageStatistics & rc_Statistics = rc_Entry.c_Statistics;
+         const uint64_t u64_LatenessUs = (ou64_NowUs > rc_Entry.u64_DueUs) ? (ou64_NowUs - rc_Entry.u64_DueUs) : 0U;
+         const uint64_t u64_NumMissed = u64_LatenessUs / rc_Entry.u64_IntervalUs;
+         const uint32_t u32_LatenessUs = static_cast<uint32_t>(std::min(u64_LatenessUs,
+                                                                        static_cast<uint64_t>(0xFFFFFFFFUL)));
+
+         ++rc_Statistics.u32_NumSent;
+         rc_Statistics.u32_NumMissed += static_cast<uint32_t>(u64_NumMissed);
+         rc_Statistics.u64_SumLatenessUs += u64_LatenessUs;
+         rc_Statistics.u32_MaxLatenessUs = std::max(rc_Statistics.u32_MaxLatenessUs, u32_LatenessUs);
+
+         //stay in phase; skip periods which are completely over
+         rc_Entry.u64_DueUs += (u64_NumMissed + 1U) * rc_Entry.u64_IntervalUs;
+         std::push_heap(this->mc_Entries.begin(), this->mc_Entries.end(), &C_OscComCyclicTxScheduler::mh_IsLater);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get time until the next message is due
+
+   \param[in]   ou64_NowUs      Current time
+   \param[out]  oru64_TimeUs    Time until the next message is due (0 if already due)
+
+   \return
+   true     Message registered; time valid
+   false    No message registered
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComCyclicTxScheduler::GetTimeToNextDue(const uint64_t ou64_NowUs, uint64_t & oru64_TimeUs) const
+{
+   bool q_Retval = false;
+
+   if (this->mc_Entries.empty() == false)
+   {
+      const uint64_t u64_DueUs = this->mc_Entries.front().u64_DueUs;
+      oru64_TimeUs = (u64_DueUs > ou64_NowUs) ? (u64_DueUs - ou64_NowUs) : 0U;
+      q_Retval = true;
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Heap order: entry due later (or registered later if due at the same time)
+
+   \param[in]  orc_Entry1  First entry
+   \param[in]  orc_Entry2  Second entry
+
+   \return
+   true     Entry 1 is due after entry 2
+   false    Else
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComCyclicTxScheduler::mh_IsLater(const C_Entry & orc_Entry1, const C_Entry & orc_Entry2)
+{
+   bool q_Retval;
+
+   if (orc_Entry1.u64_DueUs != orc_Entry2.u64_DueUs)
+   {
+      q_Retval = (orc_Entry1.u64_DueUs > orc_Entry2.u64_DueUs);
+   }
+   else
+   {
+      q_Retval = (orc_Entry1.u32_Sequence > orc_Entry2.u32_Sequence);
+   }
+   return q_Retval;
+}
@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Transmit schedule of registered CAN messages (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMCYCLICTXSCHEDULER_HPP
+#define C_OSCCOMCYCLICTXSCHEDULER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_OscComDriverBase.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscComCyclicTxScheduler
+{
+public:
+   C_OscComCyclicTxScheduler(void);
+
+   void Add(const C_OscComDriverBaseCanMessage & orc_MsgCfg, const uint64_t ou64_FirstDueUs);
+   uint32_t GetSize(void) const;
+   C_OscComDriverBaseCanMessage & GetMessage(const uint32_t ou32_Index);
+   const C_OscComDriverBaseCanMessageStatistics & GetStatistics(const uint32_t ou32_Index) const;
+   void Remove(const uint32_t ou32_Index);
+   void Clear(void);
+   void Resynchronize(const uint64_t ou64_NowUs);
+
+   C_OscComDriverBaseCanMessage * GetDue(const uint64_t ou64_NowUs);
+   void ConfirmDue(const uint64_t ou64_NowUs);
+   bool GetTimeToNextDue(const uint64_t ou64_NowUs, uint64_t & oru64_TimeUs) const;
+
+private:
+   class C_Entry
+   {
+   public:
+      C_OscComDriverBaseCanMessageStatistics c_Statistics; ///< Also holds the message
+      uint64_t u64_DueUs;                                  ///< Next point in time to send
+      uint64_t u64_IntervalUs;                             ///< 0 for single shot messages
+      uint32_t u32_Sequence;                               ///< Order of registration; for equal due times
+   };
+
+   static bool mh_IsLater(const C_Entry & orc_Entry1, const C_Entry & orc_Entry2);
+
+   std::vector<C_Entry> mc_Entries; ///< Binary min-heap; the next due message is at the front
+   uint32_t mu32_NextSequence;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
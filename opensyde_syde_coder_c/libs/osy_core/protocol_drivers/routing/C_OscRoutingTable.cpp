@@ -0,0 +1,837 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Best routes from one bus to all nodes of a system
+
+   The buses of the system are searched once, breadth first, starting at the bus the PC is connected to.
+   Each node with two routing interfaces is a route point from the bus of one interface to the bus of the other.
+   For each bus the search keeps the route with the fewest route points; of routes with the same number of
+   route points the one using Ethernet is preferred. Routing from CAN to Ethernet is not possible.
+   Remaining ties are broken like the previous depth first search over all routes did (route points in node and
+   interface index order): of equal routes using Ethernet the last one found is kept, else the first one found.
+
+   The best route to a node is the best route to one of the buses the node can be reached on. If this route passes
+   the target node itself (which can not route to itself) the search is repeated without the target node.
+
+   Tables are cached with all routing relevant input data as key, so calculating the routes of all nodes of a system
+   only searches the buses once. The key is compared completely, so a changed system never gets an outdated table.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <set>
+
+#include "stwerrors.hpp"
+#include "C_SclString.hpp"
+
+#include "C_OscRoutingTable.hpp"
+#include "C_OscLoggingHandler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace std;
+
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscRoutingTable::mhu32_CACHE_SIZE = 4U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+std::list<C_OscRoutingTable::C_CacheEntry> C_OscRoutingTable::mhc_Cache;
+C_TglCriticalSection C_OscRoutingTable::mhc_CacheCriticalSection;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Calculates the best routes to all nodes.
+
+   \param[in]     orc_AllNodes         All nodes in the system definition
+   \param[in]     orc_ActiveNodes      Flags for all available nodes in the system
+   \param[in]     ou32_StartBusIndex   Start bus for the routing
+   \param[in]     oe_Mode              Decision for update or diagnostic routing
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscRoutingTable::C_OscRoutingTable(const vector<C_OscNode> & orc_AllNodes, const vector<uint8_t> & orc_ActiveNodes,
+                                     const uint32_t ou32_StartBusIndex,
+                                     const C_OscRoutingCalculation::E_Mode oe_Mode)
+{
+   map<uint32_t, vector<C_OscRoutingRoutePoint> > c_RoutePointsPerBus;
+   map<uint32_t, C_Bus> c_Buses;
+   map<uint32_t, C_Bus> c_BusesWithCanToEthernet;
+   bool q_CanToEthernetSearched = false;
+   uint32_t u32_NodeCounter;
+
+   mh_GetRoutePoints(orc_AllNodes, orc_ActiveNodes, c_RoutePointsPerBus);
+   mh_SearchBuses(c_RoutePointsPerBus, ou32_StartBusIndex, false, 0xFFFFFFFFU, c_Buses);
+
+   this->mc_Targets.reserve(orc_AllNodes.size());
+   for (u32_NodeCounter = 0U; u32_NodeCounter < orc_AllNodes.size(); ++u32_NodeCounter)
+   {
+      const C_OscNode & rc_Node = orc_AllNodes[u32_NodeCounter];
+      C_Target c_Target(u32_NodeCounter);
+
+      // Is the node configured for update or diagnostic on its connected buses and is connected to a bus
+      c_Target.s32_State = mh_CheckTargetNodeConfig(rc_Node, oe_Mode);
+      if (c_Target.s32_State == C_NO_ERR)
+      {
+         const bool q_Active = (u32_NodeCounter < orc_ActiveNodes.size()) &&
+                               (orc_ActiveNodes[u32_NodeCounter] == 1U);
+
+         if ((q_Active == true) &&
+             (mh_FindRoute(c_RoutePointsPerBus, c_Buses, ou32_StartBusIndex, false, rc_Node, u32_NodeCounter,
+                           oe_Mode, c_Target.c_Route.c_VecRoutePoints) == true))
+         {
+            // Success
+            c_Target.s32_State = C_NO_ERR;
+         }
+         else
+         {
+            // Check whether a route would exist without the CAN to Ethernet limitation
+            if (q_CanToEthernetSearched == false)
+            {
+               mh_SearchBuses(c_RoutePointsPerBus, ou32_StartBusIndex, true, 0xFFFFFFFFU, c_BusesWithCanToEthernet);
+               q_CanToEthernetSearched = true;
+            }
+
+            if ((q_Active == true) &&
+                (mh_FindRoute(c_RoutePointsPerBus, c_BusesWithCanToEthernet, ou32_StartBusIndex, true, rc_Node,
+                              u32_NodeCounter, oe_Mode, c_Target.c_Route.c_VecRoutePoints) == true))
+            {
+               // A route was available, but is not possible due to limitations
+               c_Target.s32_State = C_CONFIG;
+            }
+            else
+            {
+               // No route available
+               c_Target.s32_State = C_COM;
+            }
+            c_Target.c_Route.c_VecRoutePoints.clear();
+         }
+      }
+
+      this->mc_Targets.push_back(c_Target);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the result state of the calculation for one target node
+
+   \param[in]     ou32_TargetNodeIndex   Target node at the end of the routing
+
+   \return
+   C_NO_ERR    Route was found
+   C_RANGE     Target node does not exist
+   C_COM       No route was found
+   C_CONFIG    Route is not possible due to routing from CAN to Ethernet
+   C_NOACT     Target function (update or diagnostic) deactivated on all connected bus. No routing necessary.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscRoutingTable::GetState(const uint32_t ou32_TargetNodeIndex) const
+{
+   int32_t s32_Return = C_RANGE;
+
+   if (ou32_TargetNodeIndex < this->mc_Targets.size())
+   {
+      s32_Return = this->mc_Targets[ou32_TargetNodeIndex].s32_State;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the best route to one target node
+
+   \param[in]     ou32_TargetNodeIndex   Target node at the end of the routing
+
+   \return
+   Valid Pointer:    Best route to target
+   NULL:             No route found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OscRoutingRoute * C_OscRoutingTable::GetBestRoute(const uint32_t ou32_TargetNodeIndex) const
+{
+   const C_OscRoutingRoute * pc_Result = NULL;
+
+   if (this->GetState(ou32_TargetNodeIndex) == C_NO_ERR)
+   {
+      pc_Result = &this->mc_Targets[ou32_TargetNodeIndex].c_Route;
+   }
+   return pc_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get best route to one target node from cached table
+
+   The table gets calculated if there is no cached table for the routing relevant data.
+   A calculated table is reported with one log entry (written after leaving the cache lock).
+
+   \param[in]     orc_AllNodes           All nodes in the system definition
+   \param[in]     orc_ActiveNodes        Flags for all available nodes in the system
+   \param[in]     ou32_StartBusIndex     Start bus for the routing
+   \param[in]     ou32_TargetNodeIndex   Target node at the end of the routing
+   \param[in]     oe_Mode                Decision for update or diagnostic routing
+   \param[out]    orc_Route              Best route to target (only valid if C_NO_ERR is returned)
+
+   \return
+   see GetState
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscRoutingTable::h_GetBestRoute(const vector<C_OscNode> & orc_AllNodes,
+                                          const vector<uint8_t> & orc_ActiveNodes, const uint32_t ou32_StartBusIndex,
+                                          const uint32_t ou32_TargetNodeIndex,
+                                          const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                          C_OscRoutingRoute & orc_Route)
+{
+   int32_t s32_Return;
+   std::vector<uint32_t> c_Key;
+   C_SclString c_Summary;
+
+   std::list<C_CacheEntry>::iterator c_ItEntry;
+
+   mh_GetCacheKey(orc_AllNodes, orc_ActiveNodes, ou32_StartBusIndex, oe_Mode, c_Key);
+
+   mhc_CacheCriticalSection.Acquire();
+   for (c_ItEntry = mhc_Cache.begin(); c_ItEntry != mhc_Cache.end(); ++c_ItEntry)
+   {
+      if (c_ItEntry->c_Key == c_Key)
+      {
+         break;
+      }
+   }
+
+   if (c_ItEntry == mhc_Cache.end())
+   {
+      C_OscRoutingTable c_Table(orc_AllNodes, orc_ActiveNodes, ou32_StartBusIndex, oe_Mode);
+
+      c_Summary = "Routes calculated (start bus index: " + C_SclString::IntToStr(ou32_StartBusIndex) + ", mode: " +
+                  C_SclString::IntToStr(static_cast<int32_t>(oe_Mode)) + "): " + c_Table.m_GetSummary();
+      if (mhc_Cache.size() >= mhu32_CACHE_SIZE)
+      {
+         // drop least recently used table
+         mhc_Cache.pop_back();
+      }
+      mhc_Cache.push_front(C_CacheEntry());
+      mhc_Cache.front().c_Key.swap(c_Key);
+      mhc_Cache.front().c_Targets.swap(c_Table.mc_Targets);
+   }
+   else
+   {
+      // most recently used table first
+      mhc_Cache.splice(mhc_Cache.begin(), mhc_Cache, c_ItEntry);
+   }
+
+   if (ou32_TargetNodeIndex < mhc_Cache.front().c_Targets.size())
+   {
+      const C_Target & rc_Target = mhc_Cache.front().c_Targets[ou32_TargetNodeIndex];
+      s32_Return = rc_Target.s32_State;
+      if (s32_Return == C_NO_ERR)
+      {
+         orc_Route = rc_Target.c_Route;
+      }
+   }
+   else
+   {
+      s32_Return = C_RANGE;
+   }
+   mhc_CacheCriticalSection.Release();
+
+   if (c_Summary.IsEmpty() == false)
+   {
+      osc_write_log_info("Routing calculation", c_Summary);
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all cached tables
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::h_ClearCache(void)
+{
+   mhc_CacheCriticalSection.Acquire();
+   mhc_Cache.clear();
+   mhc_CacheCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Checks a specific interface of a specific node if it is relevant and usable
+
+   \param[in]       oq_IsTarget              true: interface of target node; false: interface of routing node
+   \param[in]       oe_Mode                  Decision for update or diagnostic routing
+   \param[in]       orc_ComItfSettings       Interface of node for check
+
+   \retval   true   Interface can be used
+   \retval   false  Interface can not be used or is not relevant
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscRoutingTable::h_CheckItfNumberForRouting(const bool oq_IsTarget,
+                                                   const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                                   const C_OscNodeComInterfaceSettings & orc_ComItfSettings)
+{
+   // Check if the interface can be used for routing
+   bool q_Return = false;
+
+   if (orc_ComItfSettings.GetBusConnected() == true)
+   {
+      if (oq_IsTarget == true)
+      {
+         // Node is target and must support the function on the current interface
+         if ((oe_Mode == C_OscRoutingCalculation::eDIAGNOSTIC) &&
+             (orc_ComItfSettings.q_IsDiagnosisEnabled == true))
+         {
+            // At least one com interface is relevant
+            q_Return = true;
+         }
+         else if ((oe_Mode == C_OscRoutingCalculation::eUPDATE) &&
+                  (orc_ComItfSettings.q_IsUpdateEnabled == true))
+         {
+            // At least one com interface is relevant
+            q_Return = true;
+         }
+         else if ((oe_Mode == C_OscRoutingCalculation::eROUTING_CHECK) ||
+                  (oe_Mode == C_OscRoutingCalculation::eROUTING_CHECK_DIAG))
+         {
+            // Independent of any update or diagnostic functionality of the interface
+            q_Return = true;
+         }
+         else
+         {
+            // Nothing to do
+         }
+      }
+      else
+      {
+         // Node is for routing
+         if (orc_ComItfSettings.q_IsRoutingEnabled == true)
+         {
+            q_Return = true;
+         }
+      }
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor
+
+   \param[in]  ou32_TargetNodeIndex    Target node at the end of the routing
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscRoutingTable::C_Target::C_Target(const uint32_t ou32_TargetNodeIndex) :
+   s32_State(C_COM),
+   c_Route(ou32_TargetNodeIndex)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscRoutingTable::C_Bus::C_Bus(void) :
+   u32_Hops(0U),
+   q_HasEthernet(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get all possible route points of all active nodes
+
+   A route point routes from the bus of one routing interface to the bus of another routing interface of the same node.
+
+   \param[in]     orc_AllNodes            All nodes in the system definition
+   \param[in]     orc_ActiveNodes         Flags for all available nodes in the system
+   \param[out]    orc_RoutePointsPerBus   Route points per input bus index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::mh_GetRoutePoints(const vector<C_OscNode> & orc_AllNodes,
+                                          const vector<uint8_t> & orc_ActiveNodes,
+                                          map<uint32_t, vector<C_OscRoutingRoutePoint> > & orc_RoutePointsPerBus)
+{
+   uint32_t u32_NodeCounter;
+
+   orc_RoutePointsPerBus.clear();
+
+   for (u32_NodeCounter = 0U; u32_NodeCounter < orc_AllNodes.size(); ++u32_NodeCounter)
+   {
+      if ((u32_NodeCounter < orc_ActiveNodes.size()) && (orc_ActiveNodes[u32_NodeCounter] == 1U))
+      {
+         const vector<C_OscNodeComInterfaceSettings> & rc_Interfaces =
+            orc_AllNodes[u32_NodeCounter].c_Properties.c_ComInterfaces;
+         uint32_t u32_InItfCounter;
+
+         for (u32_InItfCounter = 0U; u32_InItfCounter < rc_Interfaces.size(); ++u32_InItfCounter)
+         {
+            const C_OscNodeComInterfaceSettings & rc_InItf = rc_Interfaces[u32_InItfCounter];
+
+            if (h_CheckItfNumberForRouting(false, C_OscRoutingCalculation::eROUTING_CHECK, rc_InItf) == true)
+            {
+               uint32_t u32_OutItfCounter;
+
+               for (u32_OutItfCounter = 0U; u32_OutItfCounter < rc_Interfaces.size(); ++u32_OutItfCounter)
+               {
+                  const C_OscNodeComInterfaceSettings & rc_OutItf = rc_Interfaces[u32_OutItfCounter];
+
+                  if ((u32_OutItfCounter != u32_InItfCounter) &&
+                      (h_CheckItfNumberForRouting(false, C_OscRoutingCalculation::eROUTING_CHECK,
+                                                  rc_OutItf) == true) &&
+                      (rc_OutItf.u32_BusIndex != rc_InItf.u32_BusIndex))
+                  {
+                     C_OscRoutingRoutePoint c_Point;
+
+                     c_Point.u32_NodeIndex = u32_NodeCounter;
+                     c_Point.u32_InBusIndex = rc_InItf.u32_BusIndex;
+                     c_Point.u8_InNodeId = rc_InItf.u8_NodeId;
+                     c_Point.e_InInterfaceType = rc_InItf.e_InterfaceType;
+                     c_Point.u8_InInterfaceNumber = rc_InItf.u8_InterfaceNumber;
+                     c_Point.u32_OutBusIndex = rc_OutItf.u32_BusIndex;
+                     c_Point.u8_OutNodeId = rc_OutItf.u8_NodeId;
+                     c_Point.e_OutInterfaceType = rc_OutItf.e_InterfaceType;
+                     c_Point.u8_OutInterfaceNumber = rc_OutItf.u8_InterfaceNumber;
+
+                     orc_RoutePointsPerBus[rc_InItf.u32_BusIndex].push_back(c_Point);
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Search shortest routes to all reachable buses
+
+   Breadth first search over all buses. Of routes with the same number of route points the last one using Ethernet
+   is kept, else the first one found.
+
+   \param[in]     orc_RoutePointsPerBus    Route points per input bus index
+   \param[in]     ou32_StartBusIndex       Start bus for the routing
+   \param[in]     oq_AllowCanToEthernet    true: also use route points routing from CAN to Ethernet
+   \param[in]     ou32_ExcludedNodeIndex   Node which must not be used as route point (0xFFFFFFFF: none)
+   \param[out]    orc_Buses                Shortest routes to all reachable buses
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::mh_SearchBuses(const map<uint32_t, vector<C_OscRoutingRoutePoint> > & orc_RoutePointsPerBus,
+                                       const uint32_t ou32_StartBusIndex, const bool oq_AllowCanToEthernet,
+                                       const uint32_t ou32_ExcludedNodeIndex, map<uint32_t, C_Bus> & orc_Buses)
+{
+   vector<uint32_t> c_CurrentBuses;
+   vector<uint32_t> c_NextBuses;
+
+   orc_Buses.clear();
+   orc_Buses[ou32_StartBusIndex] = C_Bus();
+   c_CurrentBuses.push_back(ou32_StartBusIndex);
+
+   while (c_CurrentBuses.size() > 0)
+   {
+      uint32_t u32_BusCounter;
+
+      for (u32_BusCounter = 0U; u32_BusCounter < c_CurrentBuses.size(); ++u32_BusCounter)
+      {
+         const map<uint32_t, vector<C_OscRoutingRoutePoint> >::const_iterator c_ItPoints =
+            orc_RoutePointsPerBus.find(c_CurrentBuses[u32_BusCounter]);
+
+         if (c_ItPoints != orc_RoutePointsPerBus.end())
+         {
+            // map elements are not moved by inserting, so the reference stays valid
+            const C_Bus & rc_FromBus = orc_Buses[c_CurrentBuses[u32_BusCounter]];
+            uint32_t u32_PointCounter;
+
+            for (u32_PointCounter = 0U; u32_PointCounter < c_ItPoints->second.size(); ++u32_PointCounter)
+            {
+               const C_OscRoutingRoutePoint & rc_Point = c_ItPoints->second[u32_PointCounter];
+               const bool q_Ethernet = (rc_FromBus.q_HasEthernet == true) ||
+                                       (rc_Point.e_OutInterfaceType == C_OscSystemBus::eETHERNET);
+
+               // No CAN to Ethernet routing. The other direction is possible.
+               if ((rc_Point.u32_NodeIndex != ou32_ExcludedNodeIndex) &&
+                   ((oq_AllowCanToEthernet == true) ||
+                    (rc_Point.e_InInterfaceType != C_OscSystemBus::eCAN) ||
+                    (rc_Point.e_OutInterfaceType != C_OscSystemBus::eETHERNET)))
+               {
+                  const map<uint32_t, C_Bus>::iterator c_ItToBus = orc_Buses.find(rc_Point.u32_OutBusIndex);
+
+                  if (c_ItToBus == orc_Buses.end())
+                  {
+                     // first route to this bus
+                     C_Bus & rc_ToBus = orc_Buses[rc_Point.u32_OutBusIndex];
+                     rc_ToBus.u32_Hops = rc_FromBus.u32_Hops + 1U;
+                     rc_ToBus.q_HasEthernet = q_Ethernet;
+                     rc_ToBus.c_RoutePoints = rc_FromBus.c_RoutePoints;
+                     rc_ToBus.c_RoutePoints.push_back(rc_Point);
+                     c_NextBuses.push_back(rc_Point.u32_OutBusIndex);
+                  }
+                  else if ((c_ItToBus->second.u32_Hops == (rc_FromBus.u32_Hops + 1U)) && (q_Ethernet == true))
+                  {
+                     // route of same length with Ethernet; the last one is kept like in the previous search
+                     c_ItToBus->second.q_HasEthernet = true;
+                     c_ItToBus->second.c_RoutePoints = rc_FromBus.c_RoutePoints;
+                     c_ItToBus->second.c_RoutePoints.push_back(rc_Point);
+                  }
+                  else
+                  {
+                     // route is not better than the known one
+                  }
+               }
+            }
+         }
+      }
+
+      c_CurrentBuses.swap(c_NextBuses);
+      c_NextBuses.clear();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find the best route to a target node
+
+   \param[in]     orc_RoutePointsPerBus    Route points per input bus index
+   \param[in]     orc_Buses                Shortest routes to all reachable buses
+   \param[in]     ou32_StartBusIndex       Start bus for the routing (used for repeated search)
+   \param[in]     oq_AllowCanToEthernet    Parameter of search of orc_Buses (used for repeated search)
+   \param[in]     orc_TargetNode           Target node
+   \param[in]     ou32_TargetNodeIndex     Target node index
+   \param[in]     oe_Mode                  Decision for update or diagnostic routing
+   \param[out]    orc_RoutePoints          Route points of best route
+
+   \retval   true    Route found
+   \retval   false   No route found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscRoutingTable::mh_FindRoute(const map<uint32_t, vector<C_OscRoutingRoutePoint> > & orc_RoutePointsPerBus,
+                                     const map<uint32_t, C_Bus> & orc_Buses, const uint32_t ou32_StartBusIndex,
+                                     const bool oq_AllowCanToEthernet, const C_OscNode & orc_TargetNode,
+                                     const uint32_t ou32_TargetNodeIndex,
+                                     const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                     vector<C_OscRoutingRoutePoint> & orc_RoutePoints)
+{
+   bool q_TargetUsedAsRouter = false;
+   bool q_Found = mh_GetBestTargetRoute(orc_TargetNode, ou32_TargetNodeIndex, oe_Mode, orc_Buses,
+                                        q_TargetUsedAsRouter, orc_RoutePoints);
+
+   if (q_TargetUsedAsRouter == true)
+   {
+      // The target can not route to itself; search again without it
+      map<uint32_t, C_Bus> c_Buses;
+      mh_SearchBuses(orc_RoutePointsPerBus, ou32_StartBusIndex, oq_AllowCanToEthernet, ou32_TargetNodeIndex, c_Buses);
+      q_Found = mh_GetBestTargetRoute(orc_TargetNode, ou32_TargetNodeIndex, oe_Mode, c_Buses, q_TargetUsedAsRouter,
+                                      orc_RoutePoints);
+   }
+   return q_Found;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the best of the routes to the buses the target node can be reached on
+
+   The buses are checked in ascending bus index order. Of routes with the same number of route points the last one
+   using Ethernet is taken, else the first one.
+
+   \param[in]     orc_TargetNode           Target node
+   \param[in]     ou32_TargetNodeIndex     Target node index
+   \param[in]     oe_Mode                  Decision for update or diagnostic routing
+   \param[in]     orc_Buses                Shortest routes to all reachable buses
+   \param[out]    orq_TargetUsedAsRouter   true: at least one route was skipped because it passes the target node
+   \param[out]    orc_RoutePoints          Route points of best route
+
+   \retval   true    Route found
+   \retval   false   No route found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscRoutingTable::mh_GetBestTargetRoute(const C_OscNode & orc_TargetNode, const uint32_t ou32_TargetNodeIndex,
+                                              const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                              const map<uint32_t, C_Bus> & orc_Buses, bool & orq_TargetUsedAsRouter,
+                                              vector<C_OscRoutingRoutePoint> & orc_RoutePoints)
+{
+   const C_Bus * pc_Best = NULL;
+   uint32_t u32_ItfCounter;
+   std::set<uint32_t> c_TargetBuses;
+
+   orq_TargetUsedAsRouter = false;
+
+   for (u32_ItfCounter = 0U; u32_ItfCounter < orc_TargetNode.c_Properties.c_ComInterfaces.size(); ++u32_ItfCounter)
+   {
+      const C_OscNodeComInterfaceSettings & rc_Itf = orc_TargetNode.c_Properties.c_ComInterfaces[u32_ItfCounter];
+
+      if (h_CheckItfNumberForRouting(true, oe_Mode, rc_Itf) == true)
+      {
+         c_TargetBuses.insert(rc_Itf.u32_BusIndex);
+      }
+   }
+
+   for (std::set<uint32_t>::const_iterator c_ItTargetBus = c_TargetBuses.begin();
+        c_ItTargetBus != c_TargetBuses.end(); ++c_ItTargetBus)
+   {
+      const map<uint32_t, C_Bus>::const_iterator c_ItBus = orc_Buses.find(*c_ItTargetBus);
+
+      if (c_ItBus != orc_Buses.end())
+      {
+         bool q_PassesTarget = false;
+         uint32_t u32_PointCounter;
+
+         for (u32_PointCounter = 0U; u32_PointCounter < c_ItBus->second.c_RoutePoints.size(); ++u32_PointCounter)
+         {
+            if (c_ItBus->second.c_RoutePoints[u32_PointCounter].u32_NodeIndex == ou32_TargetNodeIndex)
+            {
+               q_PassesTarget = true;
+               break;
+            }
+         }
+
+         if (q_PassesTarget == true)
+         {
+            orq_TargetUsedAsRouter = true;
+         }
+         else if ((pc_Best == NULL) ||
+                  (c_ItBus->second.u32_Hops < pc_Best->u32_Hops) ||
+                  ((c_ItBus->second.u32_Hops == pc_Best->u32_Hops) && (c_ItBus->second.q_HasEthernet == true)))
+         {
+            pc_Best = &c_ItBus->second;
+         }
+         else
+         {
+            // Not better
+         }
+      }
+   }
+
+   if (pc_Best != NULL)
+   {
+      orc_RoutePoints = pc_Best->c_RoutePoints;
+   }
+
+   return (pc_Best != NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Checks the target node configuration for a routable setting
+
+   \param[in]     orc_TargetNode           Target node
+   \param[in]     oe_Mode                  Decision for update or diagnostic routing
+
+   \return
+   C_NO_ERR    Node is configured for correct routing
+   C_NOACT     Target node must not be routed, because the relevant function is deactivated on all connected buses
+   C_COM       No bus is connected to minimum one activated relevant function
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscRoutingTable::mh_CheckTargetNodeConfig(const C_OscNode & orc_TargetNode,
+                                                    const C_OscRoutingCalculation::E_Mode oe_Mode)
+{
+   // Check if the target node must be routable
+   int32_t s32_Return;
+   bool q_UsableBusFound = false;
+   bool q_AtLeastOneFunctionActive = false;
+
+   tgl_assert(orc_TargetNode.pc_DeviceDefinition != NULL);
+   if (orc_TargetNode.pc_DeviceDefinition != NULL)
+   {
+      tgl_assert(orc_TargetNode.u32_SubDeviceIndex < orc_TargetNode.pc_DeviceDefinition->c_SubDevices.size());
+      if (orc_TargetNode.u32_SubDeviceIndex < orc_TargetNode.pc_DeviceDefinition->c_SubDevices.size())
+      {
+         const C_OscSubDeviceDefinition & rc_SubDevDef =
+            orc_TargetNode.pc_DeviceDefinition->c_SubDevices[orc_TargetNode.u32_SubDeviceIndex];
+
+         // But with one exception: A node without any functionality like a third party device. This must be handled
+         // without functionality and without error. All other nodes must be checked
+         if ((rc_SubDevDef.q_FlashloaderOpenSydeEthernet == true) ||
+             (rc_SubDevDef.q_FlashloaderOpenSydeCan == true) ||
+             (rc_SubDevDef.q_FlashloaderStwCan == true))
+         {
+            uint32_t u32_Counter;
+            for (u32_Counter = 0U; u32_Counter < orc_TargetNode.c_Properties.c_ComInterfaces.size(); ++u32_Counter)
+            {
+               const C_OscNodeComInterfaceSettings & rc_Itf = orc_TargetNode.c_Properties.c_ComInterfaces[u32_Counter];
+               bool q_FunctionActive;
+
+               // Bus is connected and for the routing and check relevant
+               if (oe_Mode == C_OscRoutingCalculation::eDIAGNOSTIC)
+               {
+                  q_FunctionActive = rc_Itf.q_IsDiagnosisEnabled;
+               }
+               else if (oe_Mode == C_OscRoutingCalculation::eUPDATE)
+               {
+                  q_FunctionActive = rc_Itf.q_IsUpdateEnabled;
+               }
+               else if (oe_Mode == C_OscRoutingCalculation::eROUTING_CHECK)
+               {
+                  // Independent of any update or diagnostic functionality of the interface, but the error must be
+                  // detected, so handle it as interface with active functionality
+                  q_FunctionActive = true;
+               }
+               else
+               {
+                  // Dependent only of diagnostic support of the node and not the concrete interface configuration.
+                  // In case of a principle diagnostic support the error must be detected,
+                  // so handle it as interface with active functionality
+                  q_FunctionActive =
+                     (orc_TargetNode.c_Properties.e_DiagnosticServer != C_OscNodeProperties::eDS_NONE);
+               }
+
+               if (q_FunctionActive == true)
+               {
+                  q_AtLeastOneFunctionActive = true;
+
+                  if (rc_Itf.GetBusConnected() == true)
+                  {
+                     // Minimum one com interface is relevant
+                     q_UsableBusFound = true;
+                     break;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   if (q_UsableBusFound == true)
+   {
+      // Function (diagnosis or update) is active and minimum one bus is connected to the matching interface
+      s32_Return = C_NO_ERR;
+   }
+   else if (q_AtLeastOneFunctionActive == true)
+   {
+      // Minimum one function (diagnosis or update) is active but no bus is connected to a matching interface
+      // No routing possible
+      s32_Return = C_COM;
+   }
+   else
+   {
+      // Target node must not be routed, because the relevant function is deactivated on all buses
+      s32_Return = C_NOACT;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get all data the routing depends on as cache key
+
+   Only the interface properties used by the routing are part of the key; e.g. a changed IP address does not require
+   a new table.
+
+   \param[in]     orc_AllNodes         All nodes in the system definition
+   \param[in]     orc_ActiveNodes      Flags for all available nodes in the system
+   \param[in]     ou32_StartBusIndex   Start bus for the routing
+   \param[in]     oe_Mode              Decision for update or diagnostic routing
+   \param[out]    orc_Key              Key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscRoutingTable::mh_GetCacheKey(const vector<C_OscNode> & orc_AllNodes, const vector<uint8_t> & orc_ActiveNodes,
+                                       const uint32_t ou32_StartBusIndex,
+                                       const C_OscRoutingCalculation::E_Mode oe_Mode, vector<uint32_t> & orc_Key)
+{
+   uint32_t u32_Counter;
+
+   orc_Key.clear();
+   orc_Key.push_back(ou32_StartBusIndex);
+   orc_Key.push_back(static_cast<uint32_t>(oe_Mode));
+   orc_Key.push_back(static_cast<uint32_t>(orc_ActiveNodes.size()));
+   for (u32_Counter = 0U; u32_Counter < orc_ActiveNodes.size(); ++u32_Counter)
+   {
+      orc_Key.push_back(orc_ActiveNodes[u32_Counter]);
+   }
+
+   orc_Key.push_back(static_cast<uint32_t>(orc_AllNodes.size()));
+   for (u32_Counter = 0U; u32_Counter < orc_AllNodes.size(); ++u32_Counter)
+   {
+      const C_OscNode & rc_Node = orc_AllNodes[u32_Counter];
+      const vector<C_OscNodeComInterfaceSettings> & rc_Interfaces = rc_Node.c_Properties.c_ComInterfaces;
+      uint32_t u32_Flashloaders = 0U;
+      uint32_t u32_ItfCounter;
+
+      if ((rc_Node.pc_DeviceDefinition != NULL) &&
+          (rc_Node.u32_SubDeviceIndex < rc_Node.pc_DeviceDefinition->c_SubDevices.size()))
+      {
+         const C_OscSubDeviceDefinition & rc_SubDevDef =
+            rc_Node.pc_DeviceDefinition->c_SubDevices[rc_Node.u32_SubDeviceIndex];
+         u32_Flashloaders = (rc_SubDevDef.q_FlashloaderOpenSydeEthernet ? 0x01U : 0U) |
+                            (rc_SubDevDef.q_FlashloaderOpenSydeCan ? 0x02U : 0U) |
+                            (rc_SubDevDef.q_FlashloaderStwCan ? 0x04U : 0U);
+      }
+      orc_Key.push_back(u32_Flashloaders);
+      orc_Key.push_back(static_cast<uint32_t>(rc_Node.c_Properties.e_DiagnosticServer));
+      orc_Key.push_back(static_cast<uint32_t>(rc_Interfaces.size()));
+      for (u32_ItfCounter = 0U; u32_ItfCounter < rc_Interfaces.size(); ++u32_ItfCounter)
+      {
+         const C_OscNodeComInterfaceSettings & rc_Itf = rc_Interfaces[u32_ItfCounter];
+         const uint32_t u32_Flags = (rc_Itf.GetBusConnected() ? 0x01U : 0U) |
+                                    (rc_Itf.q_IsRoutingEnabled ? 0x02U : 0U) |
+                                    (rc_Itf.q_IsUpdateEnabled ? 0x04U : 0U) |
+                                    (rc_Itf.q_IsDiagnosisEnabled ? 0x08U : 0U);
+
+         orc_Key.push_back(static_cast<uint32_t>(rc_Itf.e_InterfaceType));
+         orc_Key.push_back((static_cast<uint32_t>(rc_Itf.u8_InterfaceNumber) << 8U) | rc_Itf.u8_NodeId);
+         orc_Key.push_back(u32_Flags);
+         orc_Key.push_back(rc_Itf.u32_BusIndex);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get summary of the results of all target nodes for logging
+
+   \return
+   Number of found routes and target node indexes without route
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscRoutingTable::m_GetSummary(void) const
+{
+   uint32_t u32_NumFound = 0U;
+   C_SclString c_NoRoute;
+   C_SclString c_CanToEthernet;
+   C_SclString c_NotRouted;
+   C_SclString c_Summary;
+   uint32_t u32_Counter;
+
+   for (u32_Counter = 0U; u32_Counter < this->mc_Targets.size(); ++u32_Counter)
+   {
+      const C_SclString c_Index = " " + C_SclString::IntToStr(u32_Counter);
+
+      switch (this->mc_Targets[u32_Counter].s32_State)
+      {
+      case C_NO_ERR:
+         ++u32_NumFound;
+         break;
+      case C_CONFIG:
+         c_CanToEthernet += c_Index;
+         break;
+      case C_NOACT:
+         c_NotRouted += c_Index;
+         break;
+      case C_COM:
+      default:
+         c_NoRoute += c_Index;
+         break;
+      }
+   }
+
+   c_Summary = C_SclString::IntToStr(u32_NumFound) + " of " + C_SclString::IntToStr(this->mc_Targets.size()) +
+               " routes found";
+   if (c_NoRoute.IsEmpty() == false)
+   {
+      c_Summary += "; no route to node indexes:" + c_NoRoute;
+   }
+   if (c_CanToEthernet.IsEmpty() == false)
+   {
+      c_Summary += "; CAN to Ethernet routing not possible to node indexes:" + c_CanToEthernet;
+   }
+   if (c_NotRouted.IsEmpty() == false)
+   {
+      c_Summary += "; function deactivated on all buses of node indexes:" + c_NotRouted;
+   }
+   return c_Summary;
+}
@@ -0,0 +1,523 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for the one pass hex file loader (C_HexFile::LoadFromFile)
+
+   Pseudo random memory content is written as Intel HEX file (Intel32 and Intel16 offsets) or S-Record file
+    (S1, S2 and S3 records) with records in random order and mixed line ends. The content loaded by C_HexFile must
+    match the written content byte by byte, also after saving and loading the file again.
+   Additionally the results for defective files (checksum, syntax, missing EOF record, missing file) are checked.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_HexFile.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::hex_file;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_NUM_RANDOM_RUNS = 300U;
+static const char_t * const mpcn_FILE_NAME = "hex_check.hex";
+static const char_t * const mpcn_COPY_FILE_NAME = "hex_check_copy.hex";
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///one data record to write
+class C_Record
+{
+public:
+   uint32_t u32_Address;
+   std::vector<uint8_t> c_Data;
+};
+
+///memory content: address -> value
+typedef std::map<uint32_t, uint8_t> T_Memory;
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+static uint32_t mu32_RandomState = 0x2468ACE1U;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static uint32_t m_GetRandom(const uint32_t ou32_Range);
+static C_SclString m_ToHex(const uint32_t ou32_Value, const uint32_t ou32_NumBytes);
+static C_SclString m_GetLineEnd(void);
+static C_SclString m_CreateIntelLine(const uint8_t ou8_Command, const uint16_t ou16_Address,
+                                     const std::vector<uint8_t> & orc_Data);
+static C_SclString m_CreateIntelHex(const std::vector<C_Record> & orc_Records, const bool oq_Intel16);
+static C_SclString m_CreateSRecordLine(const uint8_t ou8_Type, const uint32_t ou32_Address,
+                                       const std::vector<uint8_t> & orc_Data);
+static C_SclString m_CreateSRecord(const std::vector<C_Record> & orc_Records, const uint8_t ou8_Type);
+static void m_WriteFile(const char_t * const opcn_FileName, const C_SclString & orc_Content);
+static void m_CreateRandomContent(const uint32_t ou32_MaxAddress, std::vector<C_Record> & orc_Records,
+                                  T_Memory & orc_Memory);
+static bool m_CompareContent(C_HexFile & orc_HexFile, const T_Memory & orc_Memory);
+static void m_CheckLoad(const C_SclString & orc_Content, const T_Memory & orc_Memory,
+                        const C_SclString & orc_Description);
+static void m_CheckRandomCases(void);
+static void m_CheckDefectiveFiles(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      if (mu32_NumFailures <= 20U)
+      {
+         std::printf("FAILED: %s\n", orc_Description.c_str());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pseudo random number
+
+   xorshift32; fixed seed so all runs check the same values
+
+   \param[in]  ou32_Range   number of possible results (> 0)
+
+   \return
+   pseudo random number in range 0 .. ou32_Range-1
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetRandom(const uint32_t ou32_Range)
+{
+   mu32_RandomState ^= mu32_RandomState << 13U;
+   mu32_RandomState ^= mu32_RandomState >> 17U;
+   mu32_RandomState ^= mu32_RandomState << 5U;
+   return mu32_RandomState % ou32_Range;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Format value as upper case hex digits
+
+   \param[in]  ou32_Value      value to format
+   \param[in]  ou32_NumBytes   number of bytes to format (two digits each)
+
+   \return
+   formatted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_ToHex(const uint32_t ou32_Value, const uint32_t ou32_NumBytes)
+{
+   return C_SclString::IntToHex(static_cast<int64_t>(ou32_Value), ou32_NumBytes * 2U).UpperCase();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get random line end
+
+   \return
+   "\n" or "\r\n"
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_GetLineEnd(void)
+{
+   return (m_GetRandom(2U) == 0U) ? "\n" : "\r\n";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create one Intel HEX line
+
+   \param[in]  ou8_Command    record type
+   \param[in]  ou16_Address   16 bit address field
+   \param[in]  orc_Data       data bytes
+
+   \return
+   line including line end
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_CreateIntelLine(const uint8_t ou8_Command, const uint16_t ou16_Address,
+                                     const std::vector<uint8_t> & orc_Data)
+{
+   uint8_t u8_Checksum = static_cast<uint8_t>(orc_Data.size() + (ou16_Address >> 8U) + ou16_Address + ou8_Command);
+   C_SclString c_Line = ":" + m_ToHex(static_cast<uint32_t>(orc_Data.size()), 1U) + m_ToHex(ou16_Address, 2U) +
+                        m_ToHex(ou8_Command, 1U);
+
+   for (uint32_t u32_Index = 0U; u32_Index < orc_Data.size(); u32_Index++)
+   {
+      c_Line += m_ToHex(orc_Data[u32_Index], 1U);
+      u8_Checksum = static_cast<uint8_t>(u8_Checksum + orc_Data[u32_Index]);
+   }
+   c_Line += m_ToHex(static_cast<uint8_t>(0x100U - u8_Checksum), 1U);
+   return c_Line + m_GetLineEnd();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create Intel HEX file content
+
+   Intel32: extended linear address records; records crossing a 64kB page are split.
+   Intel16: extended segment address records; the segment is not aligned to 64kB so records may cross a 64kB
+    boundary.
+
+   \param[in]  orc_Records   data records (address + length must be < 0xF0000 for Intel16)
+   \param[in]  oq_Intel16    true: use Intel16 offsets; false: use Intel32 offsets
+
+   \return
+   file content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_CreateIntelHex(const std::vector<C_Record> & orc_Records, const bool oq_Intel16)
+{
+   C_SclString c_Content;
+   uint32_t u32_Base = 0U;
+
+   for (uint32_t u32_Record = 0U; u32_Record < orc_Records.size(); u32_Record++)
+   {
+      const C_Record & rc_Record = orc_Records[u32_Record];
+      uint32_t u32_Written = 0U;
+
+      while (u32_Written < rc_Record.c_Data.size())
+      {
+         const uint32_t u32_Address = rc_Record.u32_Address + u32_Written;
+         uint32_t u32_Length = static_cast<uint32_t>(rc_Record.c_Data.size()) - u32_Written;
+
+         if ((u32_Address < u32_Base) || ((u32_Address + u32_Length) > (u32_Base + 0x10000U)))
+         {
+            std::vector<uint8_t> c_Offset(2U);
+            const uint32_t u32_Offset = (oq_Intel16 == true) ? (u32_Address >> 4U) : (u32_Address >> 16U);
+            u32_Base = (oq_Intel16 == true) ? (u32_Offset << 4U) : (u32_Offset << 16U);
+            c_Offset[0] = static_cast<uint8_t>(u32_Offset >> 8U);
+            c_Offset[1] = static_cast<uint8_t>(u32_Offset);
+            c_Content += m_CreateIntelLine((oq_Intel16 == true) ? 2U : 4U, 0U, c_Offset);
+         }
+         if ((u32_Address + u32_Length) > (u32_Base + 0x10000U))
+         {
+            //Intel32 record crossing a 64kB page
+            u32_Length = (u32_Base + 0x10000U) - u32_Address;
+         }
+         {
+            const std::vector<uint8_t> c_Data(rc_Record.c_Data.begin() + u32_Written,
+                                              rc_Record.c_Data.begin() + u32_Written + u32_Length);
+            c_Content += m_CreateIntelLine(0U, static_cast<uint16_t>(u32_Address - u32_Base), c_Data);
+         }
+         u32_Written += u32_Length;
+      }
+   }
+   c_Content += m_CreateIntelLine(1U, 0U, std::vector<uint8_t>());
+   return c_Content;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create one S-Record line
+
+   \param[in]  ou8_Type       record type
+   \param[in]  ou32_Address   address
+   \param[in]  orc_Data       data bytes
+
+   \return
+   line including line end
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_CreateSRecordLine(const uint8_t ou8_Type, const uint32_t ou32_Address,
+                                       const std::vector<uint8_t> & orc_Data)
+{
+   //S0, S1, S5, S9: 2 address bytes; S2, S8: 3 address bytes; S3, S7: 4 address bytes
+   const uint32_t u32_NumAddressBytes = ((ou8_Type == 2U) || (ou8_Type == 8U)) ? 3U :
+                                        (((ou8_Type == 3U) || (ou8_Type == 7U)) ? 4U : 2U);
+   const uint32_t u32_Length = u32_NumAddressBytes + static_cast<uint32_t>(orc_Data.size()) + 1U;
+   uint8_t u8_Checksum = static_cast<uint8_t>(u32_Length);
+   C_SclString c_Line = "S" + C_SclString::IntToStr(ou8_Type) + m_ToHex(u32_Length, 1U) +
+                        m_ToHex(ou32_Address, u32_NumAddressBytes);
+
+   for (uint32_t u32_Index = 0U; u32_Index < u32_NumAddressBytes; u32_Index++)
+   {
+      u8_Checksum = static_cast<uint8_t>(u8_Checksum + (ou32_Address >> (u32_Index * 8U)));
+   }
+   for (uint32_t u32_Index = 0U; u32_Index < orc_Data.size(); u32_Index++)
+   {
+      c_Line += m_ToHex(orc_Data[u32_Index], 1U);
+      u8_Checksum = static_cast<uint8_t>(u8_Checksum + orc_Data[u32_Index]);
+   }
+   c_Line += m_ToHex(static_cast<uint8_t>(~u8_Checksum), 1U);
+   return c_Line + m_GetLineEnd();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create S-Record file content
+
+   \param[in]  orc_Records   data records (must fit into the address range of the record type)
+   \param[in]  ou8_Type      data record type (1, 2 or 3)
+
+   \return
+   file content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_CreateSRecord(const std::vector<C_Record> & orc_Records, const uint8_t ou8_Type)
+{
+   std::vector<uint8_t> c_Header;
+   C_SclString c_Content;
+
+   c_Header.push_back(static_cast<uint8_t>('c'));
+   c_Header.push_back(static_cast<uint8_t>('h'));
+   c_Header.push_back(static_cast<uint8_t>('k'));
+   c_Content = m_CreateSRecordLine(0U, 0U, c_Header);
+   for (uint32_t u32_Record = 0U; u32_Record < orc_Records.size(); u32_Record++)
+   {
+      c_Content += m_CreateSRecordLine(ou8_Type, orc_Records[u32_Record].u32_Address, orc_Records[u32_Record].c_Data);
+   }
+   c_Content += m_CreateSRecordLine(5U, static_cast<uint32_t>(orc_Records.size()), std::vector<uint8_t>());
+   c_Content += m_CreateSRecordLine(static_cast<uint8_t>(10U - ou8_Type), 0U, std::vector<uint8_t>());
+   return c_Content;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write text file
+
+   \param[in]  opcn_FileName   path of file
+   \param[in]  orc_Content     new file content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_WriteFile(const char_t * const opcn_FileName, const C_SclString & orc_Content)
+{
+   std::FILE * const pc_File = std::fopen(opcn_FileName, "wb");
+
+   if (pc_File != NULL)
+   {
+      (void)std::fwrite(orc_Content.c_str(), 1U, orc_Content.Length(), pc_File);
+      (void)std::fclose(pc_File);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create pseudo random memory content
+
+   Non overlapping areas; split into records of random length (1..250 bytes) in random order.
+   250 bytes is the maximum for S3 records (the length byte also covers address and checksum).
+
+   \param[in]   ou32_MaxAddress   upper limit for addresses (exclusive)
+   \param[out]  orc_Records       records to write
+   \param[out]  orc_Memory        expected memory content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CreateRandomContent(const uint32_t ou32_MaxAddress, std::vector<C_Record> & orc_Records,
+                                  T_Memory & orc_Memory)
+{
+   const uint32_t u32_NumAreas = m_GetRandom(6U) + 1U;
+   uint32_t u32_Address = m_GetRandom(ou32_MaxAddress / 2U);
+
+   orc_Records.clear();
+   orc_Memory.clear();
+   for (uint32_t u32_Area = 0U; u32_Area < u32_NumAreas; u32_Area++)
+   {
+      const uint32_t u32_Size = m_GetRandom(2000U) + 1U;
+      uint32_t u32_Offset = 0U;
+
+      if ((u32_Address + u32_Size) > ou32_MaxAddress)
+      {
+         break;
+      }
+      while (u32_Offset < u32_Size)
+      {
+         C_Record c_Record;
+         uint32_t u32_Length = m_GetRandom(250U) + 1U;
+         if (u32_Length > (u32_Size - u32_Offset))
+         {
+            u32_Length = u32_Size - u32_Offset;
+         }
+         c_Record.u32_Address = u32_Address + u32_Offset;
+         for (uint32_t u32_Index = 0U; u32_Index < u32_Length; u32_Index++)
+         {
+            const uint8_t u8_Value = static_cast<uint8_t>(m_GetRandom(256U));
+            c_Record.c_Data.push_back(u8_Value);
+            orc_Memory[c_Record.u32_Address + u32_Index] = u8_Value;
+         }
+         //insert at random position: the loader has to sort the records
+         orc_Records.insert(orc_Records.begin() + m_GetRandom(static_cast<uint32_t>(orc_Records.size()) + 1U),
+                            c_Record);
+         u32_Offset += u32_Length;
+      }
+      //gaps of random size; including adjacent areas
+      u32_Address += u32_Size + ((m_GetRandom(3U) == 0U) ? 0U : m_GetRandom(0x20000U));
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare loaded content with expected memory content
+
+   \param[in,out]  orc_HexFile   loaded hex file
+   \param[in]      orc_Memory    expected memory content
+
+   \return
+   true: content matches
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_CompareContent(C_HexFile & orc_HexFile, const T_Memory & orc_Memory)
+{
+   bool q_Match = false;
+   uint32_t u32_Result;
+   const C_HexDataDump * const pc_Dump = orc_HexFile.GetDataDump(u32_Result);
+
+   if ((pc_Dump != NULL) && (u32_Result == NO_ERR) && (orc_Memory.empty() == false))
+   {
+      T_Memory c_Loaded;
+      for (int32_t s32_Block = 0; s32_Block < pc_Dump->at_Blocks.GetLength(); s32_Block++)
+      {
+         const C_HexDataDumpBlock & rc_Block = pc_Dump->at_Blocks[s32_Block];
+         for (int32_t s32_Index = 0; s32_Index < rc_Block.au8_Data.GetLength(); s32_Index++)
+         {
+            c_Loaded[rc_Block.u32_AddressOffset + static_cast<uint32_t>(s32_Index)] = rc_Block.au8_Data[s32_Index];
+         }
+      }
+      q_Match = (c_Loaded == orc_Memory) && (orc_HexFile.MinAdr() == orc_Memory.begin()->first) &&
+                (orc_HexFile.MaxAdr() == orc_Memory.rbegin()->first) &&
+                (orc_HexFile.ByteCount() == static_cast<uint32_t>(orc_Memory.size()));
+   }
+   return q_Match;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load file content and compare with expected memory content
+
+   The loaded file is also saved (line based representation) and loaded again.
+
+   \param[in]  orc_Content       file content
+   \param[in]  orc_Memory        expected memory content
+   \param[in]  orc_Description   description of case
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckLoad(const C_SclString & orc_Content, const T_Memory & orc_Memory,
+                        const C_SclString & orc_Description)
+{
+   C_HexFile c_HexFile;
+   C_HexFile c_Copy;
+
+   m_WriteFile(mpcn_FILE_NAME, orc_Content);
+   m_Check(c_HexFile.LoadFromFile(mpcn_FILE_NAME) == NO_ERR, orc_Description + ": loaded");
+   m_Check(m_CompareContent(c_HexFile, orc_Memory) == true, orc_Description + ": content");
+   m_Check(c_HexFile.SaveToFile(mpcn_COPY_FILE_NAME) == NO_ERR, orc_Description + ": saved");
+   m_Check(c_Copy.LoadFromFile(mpcn_COPY_FILE_NAME) == NO_ERR, orc_Description + ": saved file loaded");
+   m_Check(m_CompareContent(c_Copy, orc_Memory) == true, orc_Description + ": saved file content");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check pseudo random files of all supported formats
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckRandomCases(void)
+{
+   std::vector<C_Record> c_Records;
+   T_Memory c_Memory;
+
+   for (uint32_t u32_Run = 0U; u32_Run < mu32_NUM_RANDOM_RUNS; u32_Run++)
+   {
+      const C_SclString c_Run = " run " + C_SclString::IntToStr(u32_Run);
+
+      switch (u32_Run % 5U)
+      {
+      case 0U:
+         m_CreateRandomContent(0x01000000U, c_Records, c_Memory);
+         m_CheckLoad(m_CreateIntelHex(c_Records, false), c_Memory, "Intel32" + c_Run);
+         break;
+      case 1U:
+         m_CreateRandomContent(0x000F0000U, c_Records, c_Memory);
+         m_CheckLoad(m_CreateIntelHex(c_Records, true), c_Memory, "Intel16" + c_Run);
+         break;
+      case 2U:
+         m_CreateRandomContent(0x00010000U, c_Records, c_Memory);
+         m_CheckLoad(m_CreateSRecord(c_Records, 1U), c_Memory, "S1" + c_Run);
+         break;
+      case 3U:
+         m_CreateRandomContent(0x01000000U, c_Records, c_Memory);
+         m_CheckLoad(m_CreateSRecord(c_Records, 2U), c_Memory, "S2" + c_Run);
+         break;
+      default:
+         m_CreateRandomContent(0xFFFF0000U, c_Records, c_Memory);
+         m_CheckLoad(m_CreateSRecord(c_Records, 3U), c_Memory, "S3" + c_Run);
+         break;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check results for defective files
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckDefectiveFiles(void)
+{
+   C_HexFile c_HexFile;
+   std::vector<uint8_t> c_Data(16U, 0x55U);
+   const C_SclString c_Line1 = m_CreateIntelLine(0U, 0x1000U, c_Data);
+   const C_SclString c_Eof = m_CreateIntelLine(1U, 0U, std::vector<uint8_t>());
+   C_SclString c_Defective;
+   uint32_t u32_Result;
+
+   //checksum error in line 2
+   c_Defective = m_CreateIntelLine(0U, 0x2000U, c_Data);
+   c_Defective[c_Defective.Pos("5")] = '6';
+   m_WriteFile(mpcn_FILE_NAME, c_Line1 + c_Defective + c_Eof);
+   u32_Result = c_HexFile.LoadFromFile(mpcn_FILE_NAME);
+   m_Check(u32_Result == (ERR_HEXLINE_CHECKSUM | 2U), "checksum error reported with line number");
+   m_Check(c_HexFile.ByteCount() == 0U, "no data kept after error");
+
+   //invalid character in line 3
+   c_Defective = m_CreateIntelLine(0U, 0x3000U, c_Data);
+   c_Defective[4] = 'X';
+   m_WriteFile(mpcn_FILE_NAME, c_Line1 + c_Line1 + c_Defective + c_Eof);
+   u32_Result = c_HexFile.LoadFromFile(mpcn_FILE_NAME);
+   m_Check(u32_Result == (ERR_HEXLINE_SYNTAX | 3U), "syntax error reported with line number");
+
+   //truncated line
+   m_WriteFile(mpcn_FILE_NAME, c_Line1.SubString(1U, 20U) + "\n" + c_Eof);
+   m_Check((c_HexFile.LoadFromFile(mpcn_FILE_NAME) & ERR_MASK) == ERR_HEXLINE_SYNTAX, "truncated line reported");
+
+   //S-Record with checksum error in line 2
+   c_Defective = m_CreateSRecordLine(1U, 0x2000U, c_Data);
+   c_Defective[c_Defective.Pos("5")] = '6';
+   m_WriteFile(mpcn_FILE_NAME, m_CreateSRecordLine(1U, 0x1000U, c_Data) + c_Defective);
+   m_Check(c_HexFile.LoadFromFile(mpcn_FILE_NAME) == (ERR_HEXLINE_CHECKSUM | 2U), "S-Record checksum error");
+
+   //missing EOF record: warning; data loaded
+   m_WriteFile(mpcn_FILE_NAME, c_Line1);
+   m_Check(c_HexFile.LoadFromFile(mpcn_FILE_NAME) == WRN_NO_EOF_RECORD, "missing EOF record reported");
+   m_Check(c_HexFile.ByteCount() == 16U, "data loaded without EOF record");
+
+   //overlapping records: warning
+   m_WriteFile(mpcn_FILE_NAME, c_Line1 + m_CreateIntelLine(0U, 0x1008U, c_Data) + c_Eof);
+   m_Check((c_HexFile.LoadFromFile(mpcn_FILE_NAME) & ERR_MASK) == WRN_RECORD_OVERLAY, "overlay reported");
+
+   //empty file; missing file
+   m_WriteFile(mpcn_FILE_NAME, "");
+   m_Check((c_HexFile.LoadFromFile(mpcn_FILE_NAME) & ERR_MASK) != NO_ERR, "empty file reported");
+   (void)std::remove(mpcn_FILE_NAME);
+   m_Check(c_HexFile.LoadFromFile(mpcn_FILE_NAME) == ERR_CANT_OPEN_FILE, "missing file reported");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   m_CheckRandomCases();
+   m_CheckDefectiveFiles();
+   (void)std::remove(mpcn_FILE_NAME);
+   (void)std::remove(mpcn_COPY_FILE_NAME);
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
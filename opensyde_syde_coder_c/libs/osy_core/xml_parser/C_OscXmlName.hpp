@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Interned XML element and attribute name (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCXMLNAME_HPP
+#define C_OSCXMLNAME_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Precomputed handle for an XML element or attribute name
+class C_OscXmlName
+{
+public:
+   explicit C_OscXmlName(const char_t * const opcn_Name);
+
+   const char_t * GetName(void) const;
+   bool operator ==(const C_OscXmlName & orc_Other) const;
+
+   static const char_t * h_Intern(const char_t * const opcn_Name);
+
+private:
+   class C_NameLess;
+   class C_NamePool;
+
+   const char_t * mpcn_Name;
+
+   static C_NamePool & mh_GetPool(void);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,854 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Pull style streaming XML reader
+
+   Reads XML data from a memory buffer one event at a time (start tag, end tag, text ...).
+   No document tree is created. Name, attribute and text buffers are reused between events so reading a document
+    does not cause an allocation per element.
+
+   The syntax rules and the decoding of text and attribute values (entities, character references, line end
+    normalization) follow the tinyxml2 implementation, so the reported content is identical to what tinyxml2
+    would place in its DOM.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp" //pre-compiled headers
+
+#include <cstring>
+#include <algorithm>
+#include "stwtypes.hpp"
+#include "C_OscXmlPullParser.hpp"
+#include "tinyxml2.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+//tinyxml2 counts the document and the content of each open element as one level each and fails when reaching the
+// maximum depth:
+static const uint32_t mu32_MAX_OPEN_ELEMENTS = static_cast<uint32_t>(TINYXML2_MAX_ELEMENT_DEPTH) - 2U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///predefined XML entity
+class C_OscXmlPullParserEntity
+{
+public:
+   const char_t * pcn_Pattern;
+   uint32_t u32_Length;
+   char_t cn_Value;
+};
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static const C_OscXmlPullParserEntity mac_ENTITIES[] =
+{
+   { "quot", 4U, '\"' },
+   { "amp", 3U, '&' },
+   { "apos", 4U, '\'' },
+   { "lt", 2U, '<' },
+   { "gt", 2U, '>' }
+};
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   No data is set. ReadNext will report eERROR until SetData was called.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::C_OscXmlPullParser(void) :
+   mpcn_Current(NULL),
+   mpcn_End(NULL),
+   mu32_CurrentLine(1U),
+   mu32_EventLine(1U),
+   mq_ElementEndPending(false),
+   mq_DeclarationsOnly(true),
+   mq_Finished(true),
+   me_FinalEvent(eERROR),
+   mu32_NumAttributes(0U),
+   mu32_Depth(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set data to parse
+
+   The data is not copied. It must stay valid until parsing is finished.
+   It does not need to be zero terminated.
+
+   \param[in]  opcn_Data   XML text
+   \param[in]  ou32_Size   number of bytes in opcn_Data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlPullParser::SetData(const char_t * const opcn_Data, const uint32_t ou32_Size)
+{
+   mpcn_Current = opcn_Data;
+   mpcn_End = opcn_Data + ou32_Size;
+   mu32_CurrentLine = 1U;
+   mu32_EventLine = 1U;
+   mq_ElementEndPending = false;
+   mq_DeclarationsOnly = true;
+   mq_Finished = false;
+   me_FinalEvent = eERROR;
+   mu32_NumAttributes = 0U;
+   mu32_Depth = 0U;
+   mc_Name.clear();
+   mc_Text.clear();
+
+   if (opcn_Data == NULL)
+   {
+      mpcn_End = NULL;
+   }
+
+   //skip UTF-8 byte order mark:
+   m_SkipWhiteSpace();
+   if (m_StartsWith("\xEF\xBB\xBF", 3U) == true)
+   {
+      mpcn_Current += 3;
+   }
+   if (mpcn_Current == mpcn_End)
+   {
+      //no content at all: not a valid document
+      (void)m_Finish(eERROR);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read next event
+
+   Once eEND_OF_DATA or eERROR was reported all subsequent calls will report the same event again.
+
+   \return
+   type of event read (see E_Event)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::E_Event C_OscXmlPullParser::ReadNext(void)
+{
+   E_Event e_Event;
+
+   if (mq_Finished == true)
+   {
+      e_Event = me_FinalEvent;
+   }
+   else if (mq_ElementEndPending == true)
+   {
+      //second half of an empty element tag; name is still set from the start tag
+      mq_ElementEndPending = false;
+      e_Event = eELEMENT_END;
+   }
+   else
+   {
+      const char_t * const pcn_Start = mpcn_Current;
+      const uint32_t u32_StartLine = mu32_CurrentLine;
+
+      m_SkipWhiteSpace();
+      mu32_EventLine = mu32_CurrentLine;
+
+      if (mpcn_Current == mpcn_End)
+      {
+         //all elements must be closed at the end of the data
+         e_Event = m_Finish((mu32_Depth == 0U) ? eEND_OF_DATA : eERROR);
+      }
+      else if (*mpcn_Current == '<')
+      {
+         e_Event = m_ReadMarkup();
+      }
+      else
+      {
+         //text: leading white space is part of the text (it's only dropped if there is no other text)
+         const char_t * const pcn_TextEnd =
+            static_cast<const char_t *>(std::memchr(mpcn_Current, '<', static_cast<size_t>(mpcn_End - mpcn_Current)));
+         if (pcn_TextEnd == NULL)
+         {
+            e_Event = m_Finish(eERROR);
+         }
+         else
+         {
+            mu32_CurrentLine = u32_StartLine;
+            mpcn_Current = pcn_Start;
+            mh_DecodeText(pcn_Start, pcn_TextEnd, true, mc_Text);
+            m_AdvanceTo(pcn_TextEnd);
+            if (mu32_Depth == 0U)
+            {
+               mq_DeclarationsOnly = false;
+            }
+            e_Event = eTEXT;
+         }
+      }
+   }
+   return e_Event;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name of element
+
+   \return
+   name of element of the last eELEMENT_START or eELEMENT_END event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::string & C_OscXmlPullParser::GetName(void) const
+{
+   return mc_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of attributes of element
+
+   \return
+   number of attributes of the last eELEMENT_START event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlPullParser::GetNumAttributes(void) const
+{
+   return mu32_NumAttributes;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name of attribute
+
+   Attributes are reported in the order they appear in the start tag.
+
+   \param[in]  ou32_Index   index of attribute (0 .. GetNumAttributes() - 1)
+
+   \return
+   attribute name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::string & C_OscXmlPullParser::GetAttributeName(const uint32_t ou32_Index) const
+{
+   return mc_AttributeNames[ou32_Index];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get value of attribute
+
+   \param[in]  ou32_Index   index of attribute (0 .. GetNumAttributes() - 1)
+
+   \return
+   attribute value with entities and character references resolved
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::string & C_OscXmlPullParser::GetAttributeValue(const uint32_t ou32_Index) const
+{
+   return mc_AttributeValues[ou32_Index];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get text
+
+   \return
+   text of the last eTEXT event with entities and character references resolved
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const std::string & C_OscXmlPullParser::GetText(void) const
+{
+   return mc_Text;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get line number
+
+   \return
+   line number (starting at 1) of the last reported event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlPullParser::GetLineNumber(void) const
+{
+   return mu32_EventLine;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read markup starting with "<"
+
+   \return
+   type of event read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::E_Event C_OscXmlPullParser::m_ReadMarkup(void)
+{
+   E_Event e_Event;
+
+   if (m_StartsWith("<?", 2U) == true)
+   {
+      //declarations are only permitted at the beginning of the document
+      if ((mu32_Depth == 0U) && (mq_DeclarationsOnly == true))
+      {
+         e_Event = m_SkipUntil("?>", 2U);
+      }
+      else
+      {
+         e_Event = m_Finish(eERROR);
+      }
+   }
+   else
+   {
+      if (mu32_Depth == 0U)
+      {
+         mq_DeclarationsOnly = false;
+      }
+
+      if (m_StartsWith("<!--", 4U) == true)
+      {
+         e_Event = m_SkipUntil("-->", 3U);
+      }
+      else if (m_StartsWith("<![CDATA[", 9U) == true)
+      {
+         const char_t * pcn_End;
+         mpcn_Current += 9;
+         pcn_End = m_Find("]]>", 3U);
+         if (pcn_End == NULL)
+         {
+            e_Event = m_Finish(eERROR);
+         }
+         else
+         {
+            mh_DecodeText(mpcn_Current, pcn_End, false, mc_Text);
+            m_AdvanceTo(pcn_End + 3);
+            e_Event = eTEXT;
+         }
+      }
+      else if (m_StartsWith("<!", 2U) == true)
+      {
+         e_Event = m_SkipUntil(">", 1U);
+      }
+      else
+      {
+         mpcn_Current++;
+         m_SkipWhiteSpace();
+         if ((mpcn_Current != mpcn_End) && (*mpcn_Current == '/'))
+         {
+            mpcn_Current++;
+            e_Event = m_ReadEndTag();
+         }
+         else
+         {
+            e_Event = m_ReadStartTag();
+         }
+      }
+   }
+   return e_Event;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read start tag
+
+   Read position is expected after "<".
+   Like tinyxml2 the number of nested open elements is limited.
+
+   \return
+   eELEMENT_START   start tag read
+   eERROR           syntax error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::E_Event C_OscXmlPullParser::m_ReadStartTag(void)
+{
+   E_Event e_Event = eERROR;
+   bool q_EmptyElement = false;
+
+   mu32_NumAttributes = 0U;
+   if ((m_ReadName(mc_Name) == true) && (m_ReadTagContent(q_EmptyElement) == true))
+   {
+      if (q_EmptyElement == true)
+      {
+         mq_ElementEndPending = true;
+         e_Event = eELEMENT_START;
+      }
+      else if (mu32_Depth < mu32_MAX_OPEN_ELEMENTS)
+      {
+         m_PushOpenElement();
+         e_Event = eELEMENT_START;
+      }
+      else
+      {
+         //nesting too deep
+      }
+   }
+
+   if (e_Event == eERROR)
+   {
+      e_Event = m_Finish(eERROR);
+   }
+   return e_Event;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read end tag
+
+   Read position is expected after "</".
+   The name must match the innermost open element.
+
+   Special cases handled the same way as by tinyxml2:
+   * attributes in end tags are checked for syntax but ignored
+   * "</name/>" is an empty element tag
+   * an end tag on document level ends the document; all following data is ignored
+
+   \return
+   eELEMENT_END     end tag read
+   eELEMENT_START   empty element tag read
+   eEND_OF_DATA     end tag on document level read
+   eERROR           syntax error or end tag does not match
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::E_Event C_OscXmlPullParser::m_ReadEndTag(void)
+{
+   E_Event e_Event = eERROR;
+   bool q_EmptyElement = false;
+
+   mu32_NumAttributes = 0U;
+   if ((m_ReadName(mc_Name) == true) && (m_ReadTagContent(q_EmptyElement) == true))
+   {
+      if (q_EmptyElement == true)
+      {
+         mq_ElementEndPending = true;
+         e_Event = eELEMENT_START;
+      }
+      else if (mu32_Depth == 0U)
+      {
+         e_Event = m_Finish(eEND_OF_DATA);
+      }
+      else if (mc_OpenElements[mu32_Depth - 1U] == mc_Name)
+      {
+         mu32_Depth--;
+         e_Event = eELEMENT_END;
+      }
+      else
+      {
+         //does not match
+      }
+   }
+
+   if (e_Event == eERROR)
+   {
+      e_Event = m_Finish(eERROR);
+   }
+   return e_Event;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read attributes and end of tag
+
+   Read position is expected after the element name.
+
+   \param[out]  orq_EmptyElement   true: tag was closed with "/>"; false: tag was closed with ">"
+
+   \return
+   true    tag read up to and including the closing ">"
+   false   syntax error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlPullParser::m_ReadTagContent(bool & orq_EmptyElement)
+{
+   bool q_Return = false;
+   bool q_Done = false;
+
+   while (q_Done == false)
+   {
+      m_SkipWhiteSpace();
+      if (mpcn_Current == mpcn_End)
+      {
+         q_Done = true;
+      }
+      else if (tinyxml2::XMLUtil::IsNameStartChar(static_cast<uint8_t>(*mpcn_Current)) == true)
+      {
+         if (m_ReadAttribute() == false)
+         {
+            q_Done = true;
+         }
+      }
+      else if (*mpcn_Current == '>')
+      {
+         mpcn_Current++;
+         orq_EmptyElement = false;
+         q_Return = true;
+         q_Done = true;
+      }
+      else if (m_StartsWith("/>", 2U) == true)
+      {
+         mpcn_Current += 2;
+         orq_EmptyElement = true;
+         q_Return = true;
+         q_Done = true;
+      }
+      else
+      {
+         q_Done = true;
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Skip markup up to and including the terminator
+
+   \param[in]  opcn_Terminator   end of markup
+   \param[in]  ou32_Length       number of characters in opcn_Terminator
+
+   \return
+   eOTHER   markup skipped
+   eERROR   terminator not found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::E_Event C_OscXmlPullParser::m_SkipUntil(const char_t * const opcn_Terminator,
+                                                            const uint32_t ou32_Length)
+{
+   E_Event e_Event = eOTHER;
+   const char_t * const pcn_End = m_Find(opcn_Terminator, ou32_Length);
+
+   if (pcn_End == NULL)
+   {
+      e_Event = m_Finish(eERROR);
+   }
+   else
+   {
+      m_AdvanceTo(pcn_End + ou32_Length);
+   }
+   return e_Event;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Finish parsing
+
+   \param[in]  oe_Event   final event (eEND_OF_DATA or eERROR)
+
+   \return
+   oe_Event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlPullParser::E_Event C_OscXmlPullParser::m_Finish(const E_Event oe_Event)
+{
+   mq_Finished = true;
+   me_FinalEvent = oe_Event;
+   mu32_EventLine = mu32_CurrentLine;
+   return oe_Event;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find text starting at the current read position
+
+   \param[in]  opcn_Terminator   text to find
+   \param[in]  ou32_Length       number of characters in opcn_Terminator
+
+   \return
+   NULL       not found
+   else       position of opcn_Terminator
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlPullParser::m_Find(const char_t * const opcn_Terminator, const uint32_t ou32_Length) const
+{
+   const char_t * pcn_Result = NULL;
+   const char_t * pcn_Search = mpcn_Current;
+
+   while ((pcn_Result == NULL) && (pcn_Search != NULL) &&
+          (static_cast<uint32_t>(mpcn_End - pcn_Search) >= ou32_Length))
+   {
+      pcn_Search = static_cast<const char_t *>(std::memchr(pcn_Search, opcn_Terminator[0],
+                                                           static_cast<size_t>(mpcn_End - pcn_Search)));
+      if (pcn_Search != NULL)
+      {
+         if ((static_cast<uint32_t>(mpcn_End - pcn_Search) >= ou32_Length) &&
+             (std::memcmp(pcn_Search, opcn_Terminator, ou32_Length) == 0))
+         {
+            pcn_Result = pcn_Search;
+         }
+         else
+         {
+            pcn_Search++;
+         }
+      }
+   }
+   return pcn_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Move read position forward and keep track of line number
+
+   \param[in]  opcn_Position   new read position
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlPullParser::m_AdvanceTo(const char_t * const opcn_Position)
+{
+   mu32_CurrentLine += static_cast<uint32_t>(std::count(mpcn_Current, opcn_Position, '\n'));
+   mpcn_Current = opcn_Position;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Skip white space characters at read position
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlPullParser::m_SkipWhiteSpace(void)
+{
+   while ((mpcn_Current != mpcn_End) && (tinyxml2::XMLUtil::IsWhiteSpace(*mpcn_Current) == true))
+   {
+      if (*mpcn_Current == '\n')
+      {
+         mu32_CurrentLine++;
+      }
+      mpcn_Current++;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read element or attribute name at read position
+
+   \param[out]  orc_Name   read name
+
+   \return
+   true    name read
+   false   no valid name at read position
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlPullParser::m_ReadName(std::string & orc_Name)
+{
+   bool q_Return = false;
+
+   if ((mpcn_Current != mpcn_End) &&
+       (tinyxml2::XMLUtil::IsNameStartChar(static_cast<uint8_t>(*mpcn_Current)) == true))
+   {
+      const char_t * const pcn_Start = mpcn_Current;
+      mpcn_Current++;
+      while ((mpcn_Current != mpcn_End) &&
+             (tinyxml2::XMLUtil::IsNameChar(static_cast<uint8_t>(*mpcn_Current)) == true))
+      {
+         mpcn_Current++;
+      }
+      orc_Name.assign(pcn_Start, mpcn_Current);
+      q_Return = true;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read one attribute of a start tag
+
+   Read position is expected at the start of the attribute name.
+   Attribute names must be unique within one element.
+
+   \return
+   true    attribute read
+   false   syntax error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlPullParser::m_ReadAttribute(void)
+{
+   bool q_Return = false;
+
+   if (mu32_NumAttributes == mc_AttributeNames.size())
+   {
+      mc_AttributeNames.push_back(std::string());
+      mc_AttributeValues.push_back(std::string());
+   }
+
+   if (m_ReadName(mc_AttributeNames[mu32_NumAttributes]) == true)
+   {
+      m_SkipWhiteSpace();
+      if ((mpcn_Current != mpcn_End) && (*mpcn_Current == '='))
+      {
+         mpcn_Current++;
+         m_SkipWhiteSpace();
+         if ((mpcn_Current != mpcn_End) && ((*mpcn_Current == '\"') || (*mpcn_Current == '\'')))
+         {
+            const char_t * pcn_End;
+            const char_t acn_Quote[1] = { *mpcn_Current };
+            mpcn_Current++;
+            pcn_End = m_Find(&acn_Quote[0], 1U);
+            if (pcn_End != NULL)
+            {
+               q_Return = true;
+               for (uint32_t u32_Index = 0U; u32_Index < mu32_NumAttributes; u32_Index++)
+               {
+                  if (mc_AttributeNames[u32_Index] == mc_AttributeNames[mu32_NumAttributes])
+                  {
+                     q_Return = false;
+                  }
+               }
+               mh_DecodeText(mpcn_Current, pcn_End, true, mc_AttributeValues[mu32_NumAttributes]);
+               m_AdvanceTo(pcn_End + 1);
+               mu32_NumAttributes++;
+            }
+         }
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether the data at the read position starts with a text
+
+   \param[in]  opcn_Text     text to compare with
+   \param[in]  ou32_Length   number of characters in opcn_Text
+
+   \return
+   true    data starts with text
+   false   data does not start with text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlPullParser::m_StartsWith(const char_t * const opcn_Text, const uint32_t ou32_Length) const
+{
+   return (static_cast<uint32_t>(mpcn_End - mpcn_Current) >= ou32_Length) &&
+          (std::memcmp(mpcn_Current, opcn_Text, ou32_Length) == 0);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remember the current element as open element
+
+   The string objects of the stack are kept once created so their buffers can be reused.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlPullParser::m_PushOpenElement(void)
+{
+   if (mu32_Depth < mc_OpenElements.size())
+   {
+      mc_OpenElements[mu32_Depth] = mc_Name;
+   }
+   else
+   {
+      mc_OpenElements.push_back(mc_Name);
+   }
+   mu32_Depth++;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decode text or attribute value
+
+   Line ends ("\r\n", "\n\r", "\r") are normalized to "\n".
+   If requested predefined entities and character references are resolved. Unknown entities are kept as they are.
+
+   \param[in]   opcn_Start            start of raw text
+   \param[in]   opcn_End              end of raw text (first character not belonging to the text)
+   \param[in]   oq_ProcessEntities    true: resolve entities and character references
+   \param[out]  orc_Text              decoded text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlPullParser::mh_DecodeText(const char_t * const opcn_Start, const char_t * const opcn_End,
+                                       const bool oq_ProcessEntities, std::string & orc_Text)
+{
+   const char_t * pcn_Run = opcn_Start; //start of the characters not yet copied
+   const char_t * pcn_Act = opcn_Start;
+
+   orc_Text.clear();
+   while (pcn_Act != opcn_End)
+   {
+      const char_t cn_Char = *pcn_Act;
+      if ((cn_Char == '\r') || (cn_Char == '\n'))
+      {
+         const char_t cn_Pair = (cn_Char == '\r') ? '\n' : '\r';
+         orc_Text.append(pcn_Run, pcn_Act);
+         orc_Text += '\n';
+         pcn_Act++;
+         if ((pcn_Act != opcn_End) && (*pcn_Act == cn_Pair))
+         {
+            pcn_Act++;
+         }
+         pcn_Run = pcn_Act;
+      }
+      else if ((cn_Char == '&') && (oq_ProcessEntities == true))
+      {
+         orc_Text.append(pcn_Run, pcn_Act);
+         pcn_Act = mh_DecodeEntity(pcn_Act, opcn_End, orc_Text);
+         pcn_Run = pcn_Act;
+      }
+      else
+      {
+         pcn_Act++;
+      }
+   }
+   orc_Text.append(pcn_Run, opcn_End);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decode one entity or character reference
+
+   \param[in]      opcn_Start   position of "&"
+   \param[in]      opcn_End     end of raw text
+   \param[in,out]  orc_Text     decoded text; the decoded character(s) are appended
+
+   \return
+   position after the decoded sequence
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlPullParser::mh_DecodeEntity(const char_t * const opcn_Start, const char_t * const opcn_End,
+                                                   std::string & orc_Text)
+{
+   const char_t * pcn_Next = opcn_Start + 1;
+   const uint32_t u32_Remaining = static_cast<uint32_t>(opcn_End - opcn_Start);
+
+   if ((u32_Remaining > 1U) && (opcn_Start[1] == '#'))
+   {
+      if (u32_Remaining > 2U)
+      {
+         //numeric character reference "&#20013;" or "&#x4e2d;"
+         const bool q_Hex = (opcn_Start[2] == 'x');
+         const char_t * pcn_Digit = opcn_Start + (q_Hex ? 3 : 2);
+         uint32_t u32_Value = 0U;
+         bool q_Valid = true;
+
+         while ((q_Valid == true) && (pcn_Digit != opcn_End) && (*pcn_Digit != ';'))
+         {
+            const char_t cn_Digit = *pcn_Digit;
+            if ((cn_Digit >= '0') && (cn_Digit <= '9'))
+            {
+               u32_Value = (u32_Value * (q_Hex ? 16U : 10U)) + static_cast<uint32_t>(cn_Digit - '0');
+            }
+            else if ((q_Hex == true) && (cn_Digit >= 'a') && (cn_Digit <= 'f'))
+            {
+               u32_Value = (u32_Value * 16U) + static_cast<uint32_t>(cn_Digit - 'a') + 10U;
+            }
+            else if ((q_Hex == true) && (cn_Digit >= 'A') && (cn_Digit <= 'F'))
+            {
+               u32_Value = (u32_Value * 16U) + static_cast<uint32_t>(cn_Digit - 'A') + 10U;
+            }
+            else
+            {
+               q_Valid = false;
+            }
+            pcn_Digit++;
+         }
+         if ((q_Valid == true) && (pcn_Digit != opcn_End))
+         {
+            char_t acn_Utf8[4];
+            int x_Length = 0; //lint !e8080 !e970 //using type to match library interface
+            tinyxml2::XMLUtil::ConvertUTF32ToUTF8(u32_Value, &acn_Utf8[0], &x_Length);
+            orc_Text.append(&acn_Utf8[0], static_cast<size_t>(x_Length));
+            pcn_Next = pcn_Digit + 1;
+         }
+         else
+         {
+            //not a valid reference: keep as it is
+            orc_Text += '&';
+         }
+      }
+      //else: "&#" at the very end; dropped (same as tinyxml2)
+   }
+   else
+   {
+      bool q_Found = false;
+      for (uint32_t u32_Index = 0U; (u32_Index < (sizeof(mac_ENTITIES) / sizeof(mac_ENTITIES[0]))) &&
+           (q_Found == false); u32_Index++)
+      {
+         const C_OscXmlPullParserEntity & rc_Entity = mac_ENTITIES[u32_Index];
+         if ((u32_Remaining > (rc_Entity.u32_Length + 1U)) &&
+             (std::memcmp(opcn_Start + 1, rc_Entity.pcn_Pattern, rc_Entity.u32_Length) == 0) &&
+             (opcn_Start[rc_Entity.u32_Length + 1U] == ';'))
+         {
+            orc_Text += rc_Entity.cn_Value;
+            pcn_Next = opcn_Start + rc_Entity.u32_Length + 2U;
+            q_Found = true;
+         }
+      }
+      if (q_Found == false)
+      {
+         //unknown entity: keep as it is
+         orc_Text += '&';
+      }
+   }
+   return pcn_Next;
+}
@@ -23,7 +23,9 @@
 #include "C_OscSystemDefinition.hpp"
 #include "C_OscSystemDefinitionFiler.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "TGLFile.hpp"
+#include "TglTime.hpp"
 #include "C_OsyCodeExportBase.hpp"
 #include "C_OscUtils.hpp"
 #include "C_OscUtilBinaryHash.hpp"
@@ -72,6 +74,18 @@ void C_OsyCodeExportBase::m_PrintCommandLineParameters(void) const
       "                                   (only if --node is also specified)           applications>\n";
    std::cout <<
       "-e      --erasefolder          Erase target directory and all subdirectories <don't>           -e\n";
+   std::cout <<
+      "-t      --tracefile            Write timing trace (Chrome trace JSON format) <none>            -t c:\\trace.json\n";
+   std::cout <<
+      "-j      --jobs                 Number of applications to generate code for   1                 -j 8\n";
+   std::cout <<
+      "                                   concurrently (only if --node is not specified)\n";
+   std::cout <<
+      "-i      --incremental          Only generate code for changed applications   <don't>           -i\n";
+   std::cout <<
+      "                                   (keeps a manifest file in the output path)\n";
+   std::cout <<
+      "-r      --timingreport         Print durations of the code generators        <don't>           -r\n";
    std::cout <<
       "-h      --help                 Print command line parameters\n";
    std::cout << "Parameters that have a \"Default\" are optional. All others are mandatory.\n" << &std::endl;
@@ -130,6 +144,25 @@ C_OsyCodeExportBase::~C_OsyCodeExportBase(void)
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up job
+
+   \param[in]  orc_Node               node to generate code for
+   \param[in]  ou16_ApplicationIndex  application to generate code for
+   \param[in]  orc_OutputPath         code generation output path
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OsyCodeExportBase::C_ApplicationJob::C_ApplicationJob(const C_OscNode & orc_Node,
+                                                        const uint16_t ou16_ApplicationIndex,
+                                                        const C_SclString & orc_OutputPath) :
+   pc_Node(&orc_Node),
+   u16_ApplicationIndex(ou16_ApplicationIndex),
+   c_OutputPath(orc_OutputPath),
+   e_Result(eRESULT_OK),
+   q_UpToDate(false)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set up generic code export engine
 
@@ -151,6 +184,11 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::Init(const int32_t os32_A
    tgl_assert(u32_Return != 0);
 
    mq_EraseTargetFolder = false;
+   mu32_Jobs = 1U;
+   mq_TimingReport = false;
+   mq_Incremental = false;
+   mu32_NextApplicationJob = 0U;
+   mu32_GenerationTimeMs = 0U;
 
    mc_ExeName = acn_ApplicationName;
    mc_ExeVersion = h_GetApplicationVersion(mc_ExeName);
@@ -231,6 +269,18 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::ParseCommandLine(const in
       {
          "erasefolder",               no_argument,       NULL, 'e'
       },
+      {
+         "tracefile",                 required_argument, NULL, 't'
+      },
+      {
+         "jobs",                      required_argument, NULL, 'j'
+      },
+      {
+         "timingreport",              no_argument,       NULL, 'r'
+      },
+      {
+         "incremental",               no_argument,       NULL, 'i'
+      },
       {
          "help",                      no_argument,       NULL, 'h'
       },
@@ -241,12 +291,13 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::ParseCommandLine(const in
 
    mc_SystemDefinitionFilePath = "";
    mc_OutputPath = "";
+   mc_TraceFilePath = "";
 
    do
    {
       int32_t s32_Index;
 
-      s32_Result = getopt_long(os32_Argc, opacn_Argv, "s:d:o:n:a:he", &ac_Options[0], &s32_Index);
+      s32_Result = getopt_long(os32_Argc, opacn_Argv, "s:d:o:n:a:t:j:heri", &ac_Options[0], &s32_Index);
       if (s32_Result != -1)
       {
          switch (s32_Result)
@@ -272,6 +323,31 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::ParseCommandLine(const in
          case 'e':
             mq_EraseTargetFolder = true;
             break;
+         case 't':
+            mc_TraceFilePath = optarg;
+            C_OscTraceHandler::h_SetActive(true);
+            break;
+         case 'j':
+            {
+               const int32_t s32_Jobs = C_SclString(optarg).ToIntDef(0);
+               if (s32_Jobs > 0)
+               {
+                  mu32_Jobs = static_cast<uint32_t>(s32_Jobs);
+               }
+               else
+               {
+                  q_ParseError = true;
+               }
+            }
+            break;
+         case 'r':
+            //the report is based on the recorded trace events
+            mq_TimingReport = true;
+            C_OscTraceHandler::h_SetActive(true);
+            break;
+         case 'i':
+            mq_Incremental = true;
+            break;
          case 'h':
             q_PrintCommandLineParameters = true;
             break;
@@ -409,11 +485,16 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateNodeCode(const C_
             }
             else
             {
-               e_Return = m_CreateApplicationCode(orc_Node, static_cast<uint16_t>(u32_Application),
-                                                  orc_OutputPath, c_CreatedFiles);
+               bool q_UpToDate;
+               e_Return = m_GetApplicationCode(orc_Node, static_cast<uint16_t>(u32_Application),
+                                               orc_OutputPath, c_CreatedFiles, q_UpToDate);
 
                this->m_PrintCodeCreationInformation(orc_Node.c_Properties.c_Name, rc_Application,
                                                     e_Return == eRESULT_OK, c_CreatedFiles);
+               if (q_UpToDate == true)
+               {
+                  this->m_PrintUpToDateInfo();
+               }
             }
             q_Found = true;
             break;
@@ -447,13 +528,18 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateNodeCode(const C_
                const C_SclString c_Path =
                   TglFileIncludeTrailingDelimiter(orc_OutputPath) +
                   C_OscUtils::h_NiceifyStringForFileName(rc_Application.c_Name);
+               bool q_UpToDate;
                e_Return =
-                  m_CreateApplicationCode(orc_Node, static_cast<uint16_t>(u32_Application), c_Path,
-                                          c_CreatedFiles);
+                  m_GetApplicationCode(orc_Node, static_cast<uint16_t>(u32_Application), c_Path, c_CreatedFiles,
+                                       q_UpToDate);
                if (e_Return == eRESULT_OK)
                {
                   this->m_PrintCodeCreationInformation(orc_Node.c_Properties.c_Name, rc_Application, true,
                                                        c_CreatedFiles);
+                  if (q_UpToDate == true)
+                  {
+                     this->m_PrintUpToDateInfo();
+                  }
                }
                else
                {
@@ -483,6 +569,18 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateNodeCode(const C_
    return e_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Print information about skipped code generation in incremental mode
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::m_PrintUpToDateInfo(void) const
+{
+   const C_SclString c_Info = "Inputs unchanged since previous code generation. Files were not rewritten.";
+
+   std::cout << c_Info.c_str() << &std::endl;
+   osc_write_log_info("Code Generation", c_Info);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Utility for putting together information about unknown code format version.
 
@@ -554,6 +652,280 @@ void C_OsyCodeExportBase::m_PrintCodeCreationInformation(const C_SclString & orc
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Generate source code for all applications of all nodes concurrently
+
+   Collects all applications the sequential generation would create code for and distributes them to mu32_Jobs
+   threads (including the calling thread). The generators only read the system definition and each application has
+   its own output folder, so the applications are independent of each other.
+
+   Results are stored in mc_ApplicationJobs. Nothing is printed here; m_CreateNodeCode reports the results
+   in the order of the system definition, so the console output, the log and the file list do not depend on the
+   scheduling of the threads.
+   Code is generated for all collected applications even if the generation of one fails.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::m_CreateApplicationCodeParallel(void)
+{
+   bool q_Stop = false;
+   uint32_t u32_NumThreads;
+   C_SclString c_Info;
+
+   mc_ApplicationJobs.clear();
+   for (uint32_t u32_Node = 0U; (u32_Node < mc_SystemDefinition.c_Nodes.size()) && (q_Stop == false); u32_Node++)
+   {
+      const C_OscNode & rc_Node = mc_SystemDefinition.c_Nodes[u32_Node];
+      if ((rc_Node.c_Properties.e_DiagnosticServer == C_OscNodeProperties::eDS_OPEN_SYDE))
+      {
+         const C_SclString c_NodePath = TglFileIncludeTrailingDelimiter(mc_OutputPath) +
+                                        C_OscUtils::h_NiceifyStringForFileName(rc_Node.c_Properties.c_Name);
+         for (uint32_t u32_Application = 0U; u32_Application < rc_Node.c_Applications.size(); u32_Application++)
+         {
+            const C_OscNodeApplication & rc_Application = rc_Node.c_Applications[u32_Application];
+            if ((rc_Application.e_Type == C_OscNodeApplication::ePROGRAMMABLE_APPLICATION) ||
+                (rc_Application.e_Type == C_OscNodeApplication::ePARAMETER_SET_HALC))
+            {
+               if (rc_Application.u16_GenCodeVersion > C_OscNodeApplication::hu16_HIGHEST_KNOWN_CODE_VERSION)
+               {
+                  //the sequential generation stops here; the error is reported by m_CreateNodeCode
+                  q_Stop = true;
+                  break;
+               }
+               mc_ApplicationJobs.push_back(C_ApplicationJob(rc_Node, static_cast<uint16_t>(u32_Application),
+                                                             TglFileIncludeTrailingDelimiter(c_NodePath) +
+                                                             C_OscUtils::h_NiceifyStringForFileName(
+                                                                rc_Application.c_Name)));
+            }
+         }
+      }
+   }
+
+   u32_NumThreads = (mu32_Jobs < mc_ApplicationJobs.size()) ? mu32_Jobs :
+                    static_cast<uint32_t>(mc_ApplicationJobs.size());
+   c_Info = "Generating code for " + C_SclString::IntToStr(static_cast<uint32_t>(mc_ApplicationJobs.size())) +
+            " application(s) in " + C_SclString::IntToStr(u32_NumThreads) + " thread(s).";
+   std::cout << c_Info.c_str() << &std::endl;
+   osc_write_log_info("Code Generation", c_Info);
+
+   mu32_NextApplicationJob = 0U;
+   if (u32_NumThreads > 1U)
+   {
+      //the calling thread is one of the workers
+      C_TglThread * const pc_Threads = new C_TglThread[u32_NumThreads - 1U];
+      for (uint32_t u32_Thread = 0U; u32_Thread < (u32_NumThreads - 1U); u32_Thread++)
+      {
+         if (pc_Threads[u32_Thread].Start(&C_OsyCodeExportBase::mh_ApplicationJobThread, this) != C_NO_ERR)
+         {
+            osc_write_log_warning("Code Generation", "Could not start code generation thread. "
+                                  "Continuing with fewer threads.");
+         }
+      }
+      m_ProcessApplicationJobs();
+      for (uint32_t u32_Thread = 0U; u32_Thread < (u32_NumThreads - 1U); u32_Thread++)
+      {
+         pc_Threads[u32_Thread].Join();
+      }
+      delete[] pc_Threads;
+   }
+   else
+   {
+      m_ProcessApplicationJobs();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Generate code for pending application jobs until none is left
+
+   Called by all code generation threads.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::m_ProcessApplicationJobs(void)
+{
+   bool q_Continue = true;
+
+   while (q_Continue == true)
+   {
+      uint32_t u32_Job;
+
+      mc_ApplicationJobsCriticalSection.Acquire();
+      u32_Job = mu32_NextApplicationJob;
+      if (u32_Job < mc_ApplicationJobs.size())
+      {
+         mu32_NextApplicationJob++;
+      }
+      mc_ApplicationJobsCriticalSection.Release();
+
+      if (u32_Job < mc_ApplicationJobs.size())
+      {
+         //each job is only accessed by the thread which took it
+         C_ApplicationJob & rc_Job = mc_ApplicationJobs[u32_Job];
+         rc_Job.e_Result = m_CreateApplicationCodeIncremental(*rc_Job.pc_Node, rc_Job.u16_ApplicationIndex,
+                                                              rc_Job.c_OutputPath, rc_Job.c_CreatedFiles,
+                                                              rc_Job.q_UpToDate);
+      }
+      else
+      {
+         q_Continue = false;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Thread function of additional code generation threads
+
+   \param[in]  opv_Instance   instance of C_OsyCodeExportBase
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::mh_ApplicationJobThread(void * const opv_Instance)
+{
+   //lint -e{9079}  This class is the only one which starts this thread function. It must match.
+   C_OsyCodeExportBase * const pc_Instance = reinterpret_cast<C_OsyCodeExportBase *>(opv_Instance);
+
+   pc_Instance->m_ProcessApplicationJobs();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Generate source code for one application or get the result of the parallel generation
+
+   \param[in]   orc_Node               node to generate code for
+   \param[in]   ou16_ApplicationIndex  application to generate code for
+   \param[in]   orc_OutputPath         code generation output path
+   \param[out]  orc_CreatedFiles       list of created files (with paths)
+   \param[out]  orq_UpToDate           true: code generation skipped in incremental mode as inputs did not change
+
+   \return
+   eRESULT_OK                        code created
+   eRESULT_CODE_GENERATION_ERROR     problems creating code
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_GetApplicationCode(const C_OscNode & orc_Node,
+                                                                            const uint16_t ou16_ApplicationIndex,
+                                                                            const C_SclString & orc_OutputPath,
+                                                                            std::vector<C_SclString> & orc_CreatedFiles,
+                                                                            bool & orq_UpToDate)
+{
+   E_ResultCode e_Return = eRESULT_OK;
+   bool q_Found = false;
+
+   for (uint32_t u32_Job = 0U; u32_Job < mc_ApplicationJobs.size(); u32_Job++)
+   {
+      const C_ApplicationJob & rc_Job = mc_ApplicationJobs[u32_Job];
+      if ((rc_Job.pc_Node == &orc_Node) && (rc_Job.u16_ApplicationIndex == ou16_ApplicationIndex))
+      {
+         e_Return = rc_Job.e_Result;
+         orc_CreatedFiles = rc_Job.c_CreatedFiles;
+         orq_UpToDate = rc_Job.q_UpToDate;
+         q_Found = true;
+         break;
+      }
+   }
+
+   if (q_Found == false)
+   {
+      e_Return = m_CreateApplicationCodeIncremental(orc_Node, ou16_ApplicationIndex, orc_OutputPath,
+                                                    orc_CreatedFiles, orq_UpToDate);
+   }
+
+   return e_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Generate source code for one application unless it is up to date
+
+   In incremental mode the code generation is skipped if the manifest shows that the inputs (node and generator
+   version) did not change and that the previously generated files are still unmodified.
+   Otherwise the manifest is updated with the result.
+   Parameter set image files contain their creation time, so they are written again whenever an application is
+   generated again, even if their content did not change otherwise.
+   Can be called by multiple threads.
+
+   \param[in]   orc_Node               node to generate code for
+   \param[in]   ou16_ApplicationIndex  application to generate code for
+   \param[in]   orc_OutputPath         code generation output path
+   \param[out]  orc_CreatedFiles       list of created files (with paths)
+   \param[out]  orq_UpToDate           true: code generation skipped as inputs did not change
+
+   \return
+   eRESULT_OK                        code created or up to date
+   eRESULT_CODE_GENERATION_ERROR     problems creating code
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateApplicationCodeIncremental(
+   const C_OscNode & orc_Node, const uint16_t ou16_ApplicationIndex, const C_SclString & orc_OutputPath,
+   std::vector<C_SclString> & orc_CreatedFiles, bool & orq_UpToDate)
+{
+   E_ResultCode e_Return = eRESULT_OK;
+
+   orq_UpToDate = false;
+   if (mq_Incremental == true)
+   {
+      const C_SclString c_InputHash = C_OscExportManifest::h_CalcInputHash(orc_Node, ou16_ApplicationIndex,
+                                                                           mc_ExeVersion + " " + mc_BinaryHash);
+      orq_UpToDate = mc_Manifest.IsUpToDate(orc_OutputPath, c_InputHash, orc_CreatedFiles);
+      if (orq_UpToDate == false)
+      {
+         e_Return = m_CreateApplicationCode(orc_Node, ou16_ApplicationIndex, orc_OutputPath, orc_CreatedFiles);
+         if (e_Return == eRESULT_OK)
+         {
+            mc_Manifest.SetOutputs(orc_OutputPath, c_InputHash, orc_CreatedFiles);
+         }
+         else
+         {
+            mc_Manifest.RemoveOutputs(orc_OutputPath);
+         }
+      }
+   }
+   else
+   {
+      e_Return = m_CreateApplicationCode(orc_Node, ou16_ApplicationIndex, orc_OutputPath, orc_CreatedFiles);
+   }
+
+   return e_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get path of manifest file for incremental mode
+
+   \return
+   path of manifest file in output folder
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OsyCodeExportBase::m_GetManifestFilePath(void) const
+{
+   return TglFileIncludeTrailingDelimiter(mc_OutputPath) + TglExtractFileName(TglChangeFileExtension(mc_ExeName, "")) +
+          "_manifest.ini";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Print accumulated durations of the code generators to console and log
+
+   Based on the recorded trace events. In parallel mode the durations of all threads are added up.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::m_PrintTimingReport(void) const
+{
+   std::vector<C_OscTraceSummary> c_Summary;
+   C_SclString c_Text;
+
+   C_OscTraceHandler::h_GetSummary("Code generation", c_Summary);
+
+   c_Text = "Timing report (elapsed time: " + C_SclString::IntToStr(mu32_GenerationTimeMs) + " ms, jobs: " +
+            C_SclString::IntToStr(mu32_Jobs) + ")";
+   c_Text += "\nGenerator                           Calls   Total [ms]     Max [ms]";
+   for (uint32_t u32_Entry = 0U; u32_Entry < c_Summary.size(); u32_Entry++)
+   {
+      const C_OscTraceSummary & rc_Entry = c_Summary[u32_Entry];
+      C_SclString c_Line;
+      c_Line.PrintFormatted("\n%-32s %8u %12.1f %12.1f", rc_Entry.c_Name.c_str(), rc_Entry.u32_Count,
+                            static_cast<float64_t>(rc_Entry.u64_TotalUs) / 1000.0,
+                            static_cast<float64_t>(rc_Entry.u64_MaxUs) / 1000.0);
+      c_Text += c_Line;
+   }
+
+   std::cout << c_Text.c_str() << &std::endl;
+   osc_write_log_info("Timing Report", c_Text);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Generate source code
 
@@ -579,6 +951,7 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::GenerateSourceCode(void)
 {
    E_ResultCode e_Return = eRESULT_OK;
    const bool q_OneNodeOnly = (mc_DeviceName != "");
+   const uint32_t u32_StartTime = TglGetTickCount();
 
    //erase target folder if requested
    if (mq_EraseTargetFolder == true)
@@ -624,6 +997,12 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::GenerateSourceCode(void)
       }
    }
 
+   if ((e_Return == eRESULT_OK) && (mq_Incremental == true))
+   {
+      //a missing or unreadable manifest results in a complete code generation
+      (void)mc_Manifest.LoadFromFile(m_GetManifestFilePath());
+   }
+
    if (e_Return == eRESULT_OK)
    {
       //does the requested device exist ?
@@ -654,6 +1033,12 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::GenerateSourceCode(void)
       }
       else
       {
+         if (mu32_Jobs > 1U)
+         {
+            //generate all applications up front; the results are reported in the order of the system definition
+            m_CreateApplicationCodeParallel();
+         }
+
          //generate code for all nodes
          for (uint32_t u32_Node = 0U; u32_Node < mc_SystemDefinition.c_Nodes.size(); u32_Node++)
          {
@@ -676,9 +1061,18 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::GenerateSourceCode(void)
                osc_write_log_info("Code Generation", c_Info);
             }
          }
+         mc_ApplicationJobs.clear();
+      }
+
+      if (mq_Incremental == true)
+      {
+         //failures are logged; the next run will generate everything again
+         (void)mc_Manifest.SaveToFile(m_GetManifestFilePath());
       }
    }
 
+   mu32_GenerationTimeMs = TglGetTickCount() - u32_StartTime;
+
    return e_Return;
 }
 
@@ -765,6 +1159,20 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::Exit(const E_ResultCode o
       break;
    }
 
+   if (mq_TimingReport == true)
+   {
+      m_PrintTimingReport();
+   }
+
+   if (mc_TraceFilePath != "")
+   {
+      //errors are reported to the log by the trace handler; no reason to fail the code generation
+      if (C_OscTraceHandler::h_ExportChromeTrace(mc_TraceFilePath) == C_NO_ERR)
+      {
+         std::cout << "Trace written to: " << mc_TraceFilePath.c_str() << &std::endl;
+      }
+   }
+
    std::cout << c_Text.c_str() << &std::endl;
    if (e_Return == eRESULT_OK)
    {
@@ -16,7 +16,9 @@
 
 #include "stwtypes.hpp"
 #include "C_SclString.hpp"
+#include "TglTasks.hpp"
 #include "C_OscSystemDefinition.hpp"
+#include "C_OscExportManifest.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 
@@ -59,13 +61,49 @@ public:
    E_ResultCode Exit(const E_ResultCode oe_ResultCode);
 
 private:
+   ///Code generation for one application in parallel mode
+   class C_ApplicationJob
+   {
+   public:
+      C_ApplicationJob(const stw::opensyde_core::C_OscNode & orc_Node, const uint16_t ou16_ApplicationIndex,
+                       const stw::scl::C_SclString & orc_OutputPath);
+
+      const stw::opensyde_core::C_OscNode * pc_Node;
+      uint16_t u16_ApplicationIndex;
+      stw::scl::C_SclString c_OutputPath;
+      E_ResultCode e_Result;
+      std::vector<stw::scl::C_SclString> c_CreatedFiles;
+      bool q_UpToDate;
+   };
+
+   std::vector<C_ApplicationJob> mc_ApplicationJobs; //results of parallel mode; empty in sequential mode
+   uint32_t mu32_NextApplicationJob;
+   stw::tgl::C_TglCriticalSection mc_ApplicationJobsCriticalSection;
+   uint32_t mu32_GenerationTimeMs;
+   stw::opensyde_core::C_OscExportManifest mc_Manifest; //inputs and outputs of previous runs (incremental mode)
+
    void m_PrintCommandLineParameters(void) const;
    E_ResultCode m_CreateNodeCode(const stw::opensyde_core::C_OscNode & orc_Node,
                                  const stw::scl::C_SclString & orc_OutputPath);
+   void m_CreateApplicationCodeParallel(void);
+   void m_ProcessApplicationJobs(void);
+   static void mh_ApplicationJobThread(void * const opv_Instance);
+   E_ResultCode m_GetApplicationCode(const stw::opensyde_core::C_OscNode & orc_Node,
+                                     const uint16_t ou16_ApplicationIndex,
+                                     const stw::scl::C_SclString & orc_OutputPath,
+                                     std::vector<stw::scl::C_SclString> & orc_CreatedFiles, bool & orq_UpToDate);
+   E_ResultCode m_CreateApplicationCodeIncremental(const stw::opensyde_core::C_OscNode & orc_Node,
+                                                   const uint16_t ou16_ApplicationIndex,
+                                                   const stw::scl::C_SclString & orc_OutputPath,
+                                                   std::vector<stw::scl::C_SclString> & orc_CreatedFiles,
+                                                   bool & orq_UpToDate);
+   stw::scl::C_SclString m_GetManifestFilePath(void) const;
+   void m_PrintTimingReport(void) const;
    void m_PrintCodeCreationInformation(const stw::scl::C_SclString & orc_NodeName,
                                        const stw::opensyde_core::C_OscNodeApplication & orc_Application,
                                        const bool oq_GenerationSuccessful,
                                        std::vector<stw::scl::C_SclString> & orc_CreatedFiles);
+   void m_PrintUpToDateInfo(void) const;
    void m_PrintCodeFormatUnknownInfo(const stw::scl::C_SclString & orc_NodeName,
                                      const stw::opensyde_core::C_OscNodeApplication & orc_Application);
 
@@ -76,6 +114,10 @@ protected:
    stw::scl::C_SclString mc_DeviceName;      //name of device for which to create code ("" -> all)
    stw::scl::C_SclString mc_ApplicationName; //name of application for which to create code ("" -> all)
    bool mq_EraseTargetFolder;
+   stw::scl::C_SclString mc_TraceFilePath; //path of timing trace file ("" -> no trace)
+   uint32_t mu32_Jobs;                     //number of applications to generate code for in parallel (1 -> sequential)
+   bool mq_TimingReport;
+   bool mq_Incremental; //skip applications with unchanged inputs
 
    //parsed system definition
    stw::opensyde_core::C_OscSystemDefinition mc_SystemDefinition;
@@ -11,6 +11,7 @@
 #include "precomp_headers.hpp"
 
 #include <cstring>
+#include <algorithm>
 #include "stwtypes.hpp"
 
 #include "stwerrors.hpp"
@@ -87,23 +88,14 @@ uint16_t C_OscDataDealerNvm::NvmCalcCrc(const C_OscNodeDataPoolList & orc_List)
    if (this->mpc_DiagProtocol != NULL)
    {
       uint32_t u32_Counter;
-      const uint8_t u8_Endianness = this->mpc_DiagProtocol->GetEndianness();
 
       for (u32_Counter = 0U; u32_Counter < orc_List.c_Elements.size(); ++u32_Counter)
       {
          const C_OscNodeDataPoolListElement * const pc_Element = &orc_List.c_Elements[u32_Counter];
          std::vector<uint8_t> c_Data;
 
-         //convert to native endianness depending on the type ...
-         //no possible problem we did not check for already ...
-         if (u8_Endianness == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-         {
-            pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_Data);
-         }
-         else
-         {
-            pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_Data);
-         }
+         //convert to protocol endianness (under the content lock) ...
+         this->m_GetContentAsBlob(pc_Element->c_NvmValue, c_Data);
          stw::scl::C_SclChecksums::CalcCRC16(&c_Data[0], static_cast<uint32_t>(c_Data.size()), u16_Crc);
       }
    }
@@ -225,26 +217,149 @@ int32_t C_OscDataDealerNvm::m_NvmReadListRaw(const C_OscNodeDataPoolList & orc_L
                                              uint8_t * const opu8_NrCode)
 {
    int32_t s32_Return;
+   const std::vector<const C_OscNodeDataPoolList *> c_Lists(1U, &orc_List);
+   std::vector<std::vector<uint8_t> > c_Values;
 
-   // If CRC is active, at least 2 byte are necessary for the CRC
-   if ((orc_List.u32_NvmSize > 2U) ||
-       ((orc_List.u32_NvmSize > 0U) && (orc_List.q_NvmCrcActive == false)))
+   s32_Return = this->m_NvmReadListsRaw(c_Lists, c_Values, opu8_NrCode);
+   if (s32_Return == C_NO_ERR)
    {
-      // Size is input parameter for NvmRead
-      const uint32_t u32_NumBytesToRead = orc_List.GetNumBytesUsed();
-      orc_Values.resize(u32_NumBytesToRead);
+      orc_Values.swap(c_Values[0]);
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reads the dumps of multiple NVM lists of ECU
+
+   Lists are read in ascending address order. Lists placed back to back in the NVM are combined into one read
+    request. The gap between two lists is read along if it lies within the reserved NVM area of the preceding list
+    and combining does not need more services than reading both parts separately.
+   So the number of services is minimized without reading outside the configured list areas.
 
-      // Read the entire list
-      // TODO: KEFEX Protocol dependent count of calls necessary and problems with fragmented lists im NVM memory
-      // TODO: KEFEX Protocol dependent position of CRC!
-      s32_Return = this->mpc_DiagProtocol->NvmRead(orc_List.u32_NvmStartAddress, orc_Values, opu8_NrCode);
+   \param[in]      orc_Lists      Lists with read information
+   \param[out]     orc_Values     List dumps; one entry per list in the same order as orc_Lists
+   \param[out]     opu8_NrCode    if != NULL: negative response code in case of an error response
 
-      // Adapt return value
-      s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+   \return
+   C_NO_ERR   Request sent, positive response received
+   C_OVERFLOW At least one list has no elements. Nothing was read
+   C_TIMEOUT  Expected response not received within timeout
+   C_NOACT    Could not send request (e.g. Tx buffer full)
+   C_WARN     Error response
+   C_CONFIG   Pre-requisites not correct; e.g. driver not initialized or
+              parameter out of range (checked by client side)
+   C_COM      expected server response not received because of communication error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscDataDealerNvm::m_NvmReadListsRaw(const std::vector<const C_OscNodeDataPoolList *> & orc_Lists,
+                                              std::vector<std::vector<uint8_t> > & orc_Values,
+                                              uint8_t * const opu8_NrCode)
+{
+   int32_t s32_Return = C_NO_ERR;
+   //start address and index of each list; sorted by address below
+   std::vector<std::pair<uint32_t, uint32_t> > c_Order;
+   uint32_t u32_ListCounter;
+
+   orc_Values.resize(orc_Lists.size());
+   c_Order.reserve(orc_Lists.size());
+   for (u32_ListCounter = 0U; (u32_ListCounter < orc_Lists.size()) && (s32_Return == C_NO_ERR); ++u32_ListCounter)
+   {
+      const C_OscNodeDataPoolList & rc_List = *orc_Lists[u32_ListCounter];
+
+      // If CRC is active, at least 2 byte are necessary for the CRC
+      if ((rc_List.u32_NvmSize > 2U) ||
+          ((rc_List.u32_NvmSize > 0U) && (rc_List.q_NvmCrcActive == false)))
+      {
+         orc_Values[u32_ListCounter].resize(rc_List.GetNumBytesUsed());
+         c_Order.push_back(std::pair<uint32_t, uint32_t>(rc_List.u32_NvmStartAddress, u32_ListCounter));
+      }
+      else
+      {
+         s32_Return = C_OVERFLOW;
+      }
    }
-   else
+
+   if (s32_Return == C_NO_ERR)
    {
-      s32_Return = C_OVERFLOW;
+      uint32_t u32_BlockSize = this->mpc_DiagProtocol->GetNvmReadBlockSize();
+      uint32_t u32_RunFirst = 0U;
+
+      if (u32_BlockSize == 0U)
+      {
+         u32_BlockSize = 1U;
+      }
+
+      std::sort(c_Order.begin(), c_Order.end());
+
+      while ((u32_RunFirst < c_Order.size()) && (s32_Return == C_NO_ERR))
+      {
+         const C_OscNodeDataPoolList & rc_FirstList = *orc_Lists[c_Order[u32_RunFirst].second];
+         const uint32_t u32_RunStart = rc_FirstList.u32_NvmStartAddress;
+         uint32_t u32_RunEnd = u32_RunStart + static_cast<uint32_t>(orc_Values[c_Order[u32_RunFirst].second].size());
+         uint32_t u32_ReserveEnd = std::max(u32_RunEnd, u32_RunStart + rc_FirstList.u32_NvmSize);
+         uint32_t u32_RunLast = u32_RunFirst;
+         bool q_Extend = true;
+
+         //add following lists to the run as long as this pays off
+         while (((u32_RunLast + 1U) < c_Order.size()) && (q_Extend == true))
+         {
+            const C_OscNodeDataPoolList & rc_NextList = *orc_Lists[c_Order[u32_RunLast + 1U].second];
+            const uint32_t u32_NextStart = rc_NextList.u32_NvmStartAddress;
+            const uint32_t u32_NextEnd = u32_NextStart +
+                                         static_cast<uint32_t>(orc_Values[c_Order[u32_RunLast + 1U].second].size());
+
+            q_Extend = false;
+            if ((u32_NextStart >= u32_RunEnd) && (u32_NextStart <= u32_ReserveEnd))
+            {
+               const uint32_t u32_ServicesCombined = ((u32_NextEnd - u32_RunStart) + (u32_BlockSize - 1U)) /
+                                                     u32_BlockSize;
+               const uint32_t u32_ServicesSeparate =
+                  (((u32_RunEnd - u32_RunStart) + (u32_BlockSize - 1U)) / u32_BlockSize) +
+                  (((u32_NextEnd - u32_NextStart) + (u32_BlockSize - 1U)) / u32_BlockSize);
+               if (u32_ServicesCombined <= u32_ServicesSeparate)
+               {
+                  q_Extend = true;
+                  u32_RunEnd = u32_NextEnd;
+                  u32_ReserveEnd = std::max(u32_ReserveEnd, u32_NextStart + rc_NextList.u32_NvmSize);
+                  ++u32_RunLast;
+               }
+            }
+         }
+
+         if (u32_RunFirst == u32_RunLast)
+         {
+            //single list: read directly into its result
+            s32_Return = this->mpc_DiagProtocol->NvmRead(u32_RunStart, orc_Values[c_Order[u32_RunFirst].second],
+                                                         opu8_NrCode);
+         }
+         else if (u32_RunEnd > u32_RunStart)
+         {
+            // Size is input parameter for NvmRead; protocol splits into services of u32_BlockSize
+            std::vector<uint8_t> c_Run(u32_RunEnd - u32_RunStart);
+            s32_Return = this->mpc_DiagProtocol->NvmRead(u32_RunStart, c_Run, opu8_NrCode);
+            if (s32_Return == C_NO_ERR)
+            {
+               for (uint32_t u32_ItRun = u32_RunFirst; u32_ItRun <= u32_RunLast; ++u32_ItRun)
+               {
+                  std::vector<uint8_t> & rc_Values = orc_Values[c_Order[u32_ItRun].second];
+                  if (rc_Values.size() > 0U)
+                  {
+                     const uint32_t u32_Offset = c_Order[u32_ItRun].first - u32_RunStart;
+                     (void)std::memcpy(&rc_Values[0], &c_Run[u32_Offset], rc_Values.size());
+                  }
+               }
+            }
+         }
+         else
+         {
+            //nothing to read
+         }
+
+         // Adapt return value
+         s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+         u32_RunFirst = u32_RunLast + 1U;
+      }
    }
 
    return s32_Return;
@@ -342,16 +457,8 @@ int32_t C_OscDataDealerNvm::m_SaveDumpValuesToListValues(const std::vector<uint8
          (void)std::memcpy(&c_ElementData[0], &orc_Values[u32_Index], u32_SizeElement);
 
          //we have data
-         //convert to native endianness depending on the type ...
-         //no possible problem we did not check for already ...
-         if (this->mpc_DiagProtocol->GetEndianness() == C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-         {
-            (void)pc_Element->c_NvmValue.SetValueFromBigEndianBlob(c_ElementData);
-         }
-         else
-         {
-            (void)pc_Element->c_NvmValue.SetValueFromLittleEndianBlob(c_ElementData);
-         }
+         //convert to native endianness (under the content lock) ...
+         this->m_SetContentFromBlob(pc_Element->c_NvmValue, c_ElementData);
          pc_Element->q_NvmValueIsValid = true;
       }
       else
@@ -404,3 +511,57 @@ int32_t C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(const int32_t os32_ProtR
 
    return s32_Return;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Combine NVM write accesses into as few services as possible
+
+   Entries are processed in the given order; that order is kept for the resulting blocks.
+   An entry is appended to the previous block if it starts directly behind it.
+   Blocks are cut so none exceeds the maximum block size. So every resulting block can be written with one service
+    and the number of blocks equals the number of services needed.
+   Overlapping entries are never combined so later entries still overwrite earlier ones in the NVM.
+
+   \param[in]   orc_Entries        Write accesses (address and data)
+   \param[in]   ou32_MaxBlockSize  Maximum number of bytes per service
+   \param[out]  orc_Blocks         Resulting write accesses
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscDataDealerNvm::mh_PlanWriteBlocks(const std::vector<C_OscParamSetRawEntry> & orc_Entries,
+                                            const uint32_t ou32_MaxBlockSize,
+                                            std::vector<C_OscParamSetRawEntry> & orc_Blocks)
+{
+   const uint32_t u32_BlockSize = (ou32_MaxBlockSize > 0U) ? ou32_MaxBlockSize : 1U;
+
+   orc_Blocks.clear();
+   for (uint32_t u32_ItEntry = 0U; u32_ItEntry < orc_Entries.size(); ++u32_ItEntry)
+   {
+      const C_OscParamSetRawEntry & rc_Entry = orc_Entries[u32_ItEntry];
+      const uint32_t u32_EntrySize = static_cast<uint32_t>(rc_Entry.c_Bytes.size());
+      uint32_t u32_Done = 0U;
+
+      //fill up previous block if this entry continues it
+      if (orc_Blocks.empty() == false)
+      {
+         C_OscParamSetRawEntry & rc_Last = orc_Blocks.back();
+         const uint32_t u32_LastSize = static_cast<uint32_t>(rc_Last.c_Bytes.size());
+         if (((rc_Last.u32_StartAddress + u32_LastSize) == rc_Entry.u32_StartAddress) &&
+             (u32_LastSize < u32_BlockSize))
+         {
+            u32_Done = std::min(u32_EntrySize, u32_BlockSize - u32_LastSize);
+            rc_Last.c_Bytes.insert(rc_Last.c_Bytes.end(), rc_Entry.c_Bytes.begin(),
+                                   rc_Entry.c_Bytes.begin() + u32_Done);
+         }
+      }
+
+      //remaining bytes in new blocks
+      while (u32_Done < u32_EntrySize)
+      {
+         const uint32_t u32_Size = std::min(u32_EntrySize - u32_Done, u32_BlockSize);
+         C_OscParamSetRawEntry c_Block;
+         c_Block.u32_StartAddress = rc_Entry.u32_StartAddress + u32_Done;
+         c_Block.c_Bytes.assign(rc_Entry.c_Bytes.begin() + u32_Done, rc_Entry.c_Bytes.begin() + u32_Done + u32_Size);
+         orc_Blocks.push_back(c_Block);
+         u32_Done += u32_Size;
+      }
+   }
+}
@@ -14,6 +14,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "C_OscDataDealer.hpp"
 #include "C_OscNodeDataPoolList.hpp"
+#include "C_OscParamSetRawEntry.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -43,10 +44,14 @@ public:
 protected:
    int32_t m_NvmReadListRaw(const C_OscNodeDataPoolList & orc_List, std::vector<uint8_t> & orc_Values,
                             uint8_t * const opu8_NrCode);
+   int32_t m_NvmReadListsRaw(const std::vector<const C_OscNodeDataPoolList *> & orc_Lists,
+                             std::vector<std::vector<uint8_t> > & orc_Values, uint8_t * const opu8_NrCode);
    int32_t m_SaveDumpToList(const std::vector<uint8_t> & orc_Values, C_OscNodeDataPoolList & orc_List) const;
    int32_t m_SaveDumpValuesToListValues(const std::vector<uint8_t> & orc_Values,
                                         C_OscNodeDataPoolList & orc_List) const;
    static int32_t mh_AdaptProtocolReturnValue(const int32_t os32_ProtReturnValue);
+   static void mh_PlanWriteBlocks(const std::vector<C_OscParamSetRawEntry> & orc_Entries,
+                                  const uint32_t ou32_MaxBlockSize, std::vector<C_OscParamSetRawEntry> & orc_Blocks);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
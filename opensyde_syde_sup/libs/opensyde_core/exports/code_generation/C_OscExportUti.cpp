@@ -12,6 +12,9 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <cstdio>
+#include <cstring>
+
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "TglFile.hpp"
@@ -166,6 +169,11 @@ void C_OscExportUti::h_AddProjIdFunctionPrototype(C_SclStringList & orc_Data, co
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Store assembled data in file
 
+   The data is written to a temporary file next to the target file first, which then replaces the target file.
+   So a concurrent reader (e.g. a build running in parallel) never sees a partially written file and an aborted
+   generation does not leave a truncated file behind.
+   An existing file with identical content is not touched, so its time stamp does not trigger a rebuild.
+
    \param[in]  orc_Data       File data as string list
    \param[in]  orc_Path       Directory path for created file excluding file name
    \param[in]  orc_FileName   File name excluding file extension
@@ -181,6 +189,7 @@ int32_t C_OscExportUti::h_SaveToFile(stw::scl::C_SclStringList & orc_Data, const
 {
    int32_t s32_Retval = C_NO_ERR;
    C_SclString c_PathAndFilename;
+   C_SclString c_TemporaryPathAndFilename;
 
    // get file path: path + filename + extension
    // add path + add filename + extension
@@ -195,20 +204,60 @@ int32_t C_OscExportUti::h_SaveToFile(stw::scl::C_SclStringList & orc_Data, const
       c_PathAndFilename += ".c";
    }
 
-   // store into file
-   try
-   {
-      orc_Data.SaveToFile(c_PathAndFilename);
-   }
-   catch (...)
+   if (mh_IsFileContentEqual(c_PathAndFilename, orc_Data.GetText("\r\n")) == false)
    {
-      osc_write_log_error("Creating source code", "Could not write to file \"" + c_PathAndFilename + "\"");
-      s32_Retval = C_RD_WR;
+      // store into temporary file and replace the target file
+      c_TemporaryPathAndFilename = c_PathAndFilename + ".tmp";
+      try
+      {
+         orc_Data.SaveToFile(c_TemporaryPathAndFilename);
+         if (TglRenameFile(c_TemporaryPathAndFilename, c_PathAndFilename) != 0)
+         {
+            s32_Retval = C_RD_WR;
+         }
+      }
+      catch (...)
+      {
+         s32_Retval = C_RD_WR;
+      }
+
+      if (s32_Retval != C_NO_ERR)
+      {
+         (void)std::remove(c_TemporaryPathAndFilename.c_str());
+         osc_write_log_error("Creating source code", "Could not write to file \"" + c_PathAndFilename + "\"");
+      }
    }
 
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether a file exists with exactly the specified content
+
+   \param[in]  orc_PathAndFilename   Path of file to check
+   \param[in]  orc_Content           Expected content
+
+   \return
+   true     file exists and has the same content
+   false    file does not exist, could not be read or has different content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscExportUti::mh_IsFileContentEqual(const C_SclString & orc_PathAndFilename, const C_SclString & orc_Content)
+{
+   bool q_Equal = false;
+
+   if (TglFileExists(orc_PathAndFilename) == true)
+   {
+      C_TglFileMapping c_File;
+      if ((c_File.Map(orc_PathAndFilename) == C_NO_ERR) && (c_File.GetSize() == orc_Content.Length()))
+      {
+         q_Equal = ((orc_Content.Length() == 0U) ||
+                    (std::memcmp(c_File.GetData(), orc_Content.c_str(), orc_Content.Length()) == 0));
+      }
+   }
+   return q_Equal;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add .c and .h file paths to file paths list.
 
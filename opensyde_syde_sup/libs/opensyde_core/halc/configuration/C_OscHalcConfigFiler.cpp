@@ -21,6 +21,7 @@
 #include "C_OscHalcDefFiler.hpp"
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscHalcConfigFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscHalcDefStructFiler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
@@ -60,6 +61,7 @@ using namespace stw::opensyde_core;
 int32_t C_OscHalcConfigFiler::h_LoadFile(C_OscHalcConfig & orc_IoData, const C_SclString & orc_Path,
                                          const C_SclString & orc_BasePath)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "HALC configuration file", orc_Path);
    int32_t s32_Retval = C_NO_ERR;
 
    if (TglFileExists(orc_Path) == true)
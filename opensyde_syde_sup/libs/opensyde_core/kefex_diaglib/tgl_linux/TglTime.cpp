@@ -12,8 +12,10 @@
 //----------------------------------------------------------------------------------------------------------------------
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
-#include <unistd.h>
+#include <pthread.h>
+#include <cerrno>
 #include <ctime>
+#include <algorithm>
 #include "stwtypes.hpp"
 #include "TglTime.hpp"
 #include "TglUtils.hpp"
@@ -23,14 +25,23 @@
 using namespace stw::tgl;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_DELAY_SPIN_MIN_US = 20U;        ///< lower limit of final busy wait of TglDelayUs
+static const uint32_t mu32_DELAY_SPIN_MAX_US = 1000U;      ///< upper limit of final busy wait of TglDelayUs
+static const uint32_t mu32_DELAY_SPIN_MARGIN_US = 10U;     ///< added to measured wake up latency
+static const uint32_t mu32_DELAY_CALIBRATION_RUNS = 16U;   ///< number of test sleeps for calibration
+static const uint32_t mu32_DELAY_CALIBRATION_SLEEP_US = 200U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static pthread_once_t mx_DelayCalibrationOnce = PTHREAD_ONCE_INIT; //lint !e8080 //using type to match library API
+static uint32_t mu32_DelaySpinUs = mu32_DELAY_SPIN_MAX_US; ///< final busy wait of TglDelayUs; set by calibration
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_SleepUntilUs(const uint64_t ou64_TimeUs);
+static void m_CalibrateDelay(void);
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
@@ -78,9 +89,65 @@ void stw::tgl::TglGetDateTimeNow(C_TglDateTime & orc_DateTime)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Actively wait for a period of time
+/*! \brief   Sleep until a point in time
+
+   Not woken up early by signals.
+
+   \param[in]   ou64_TimeUs   point in time in micro-seconds (time base of TglGetTickCountUs)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_SleepUntilUs(const uint64_t ou64_TimeUs)
+{
+   struct timespec c_Time;
+   int x_Result; //lint !e8080 //using type to match library API
+
+   c_Time.tv_sec = static_cast<time_t>(ou64_TimeUs / 1000000U);
+   c_Time.tv_nsec = static_cast<long>((ou64_TimeUs % 1000000U) * 1000U); //lint !e8080 //type of library struct
+
+   do
+   {
+      x_Result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &c_Time, NULL);
+   }
+   while (x_Result == EINTR);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Determine the final busy wait of TglDelayUs
+
+   Measures how late the system wakes up a sleeping thread.
+   The second largest of some test sleeps is used so a single preemption does not dominate the result.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CalibrateDelay(void)
+{
+   uint32_t au32_LatencyUs[mu32_DELAY_CALIBRATION_RUNS];
+   uint32_t u32_SpinUs;
+
+   for (uint32_t u32_Run = 0U; u32_Run < mu32_DELAY_CALIBRATION_RUNS; ++u32_Run)
+   {
+      const uint64_t u64_WakeUpTime = TglGetTickCountUs() + mu32_DELAY_CALIBRATION_SLEEP_US;
+      uint64_t u64_Now;
+
+      m_SleepUntilUs(u64_WakeUpTime);
+      u64_Now = TglGetTickCountUs();
+      au32_LatencyUs[u32_Run] = static_cast<uint32_t>(std::min(
+                                                         (u64_Now > u64_WakeUpTime) ? (u64_Now - u64_WakeUpTime) : 0U,
+                                                         static_cast<uint64_t>(mu32_DELAY_SPIN_MAX_US)));
+   }
+   std::sort(&au32_LatencyUs[0], &au32_LatencyUs[mu32_DELAY_CALIBRATION_RUNS]);
+
+   u32_SpinUs = au32_LatencyUs[mu32_DELAY_CALIBRATION_RUNS - 2U] + mu32_DELAY_SPIN_MARGIN_US;
+   mu32_DelaySpinUs = std::max(mu32_DELAY_SPIN_MIN_US, std::min(u32_SpinUs, mu32_DELAY_SPIN_MAX_US));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait precisely for a period of time
+
+   Blocks for the given number of microseconds.
+   The thread sleeps for most of the time and only actively waits for the last part.
+   The length of the active part is the wake up latency of the system, measured with the first call.
+   So the precision is the one of active waiting without burning the CPU for long delays.
 
-   Actively blocks for the given number of microseconds.
    Depending on the underlying system very short delays might not be possible
      and are rounded up to the smallest possible delay.
    Thus for example 10 calls of TGL_DelayUs(1) can cause a longer delay than 1 call of TGL_DelayUs(10).
@@ -90,7 +157,16 @@ void stw::tgl::TglGetDateTimeNow(C_TglDateTime & orc_DateTime)
 //----------------------------------------------------------------------------------------------------------------------
 void stw::tgl::TglDelayUs(const uint32_t ou32_NumberUs)
 {
-   const uint64_t u64_StopTime = TglGetTickCountUs() + ou32_NumberUs;
+   uint64_t u64_StopTime;
+
+   //calibrate first so the time needed by the calibration is not part of the delay
+   (void)pthread_once(&mx_DelayCalibrationOnce, &m_CalibrateDelay);
+
+   u64_StopTime = TglGetTickCountUs() + ou32_NumberUs;
+   if (ou32_NumberUs > mu32_DelaySpinUs)
+   {
+      m_SleepUntilUs(u64_StopTime - mu32_DelaySpinUs);
+   }
 
    while (TglGetTickCountUs() < u64_StopTime)
    {
@@ -108,7 +184,7 @@ void stw::tgl::TglDelayUs(const uint32_t ou32_NumberUs)
 //----------------------------------------------------------------------------------------------------------------------
 void stw::tgl::TglSleep(const uint32_t ou32_NumberMs)
 {
-   usleep(static_cast<useconds_t>(ou32_NumberMs) * 1000);
+   m_SleepUntilUs(TglGetTickCountUs() + (static_cast<uint64_t>(ou32_NumberMs) * 1000U));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -130,7 +206,7 @@ void stw::tgl::TglSleep(const uint32_t ou32_NumberMs)
 //----------------------------------------------------------------------------------------------------------------------
 void stw::tgl::TglSleepPolling()
 {
-   usleep(1000);
+   TglSleep(1U);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -44,6 +44,55 @@ public:
    void Release(void);
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+///Runs a function in a separate thread
+class C_TglThread
+{
+public:
+   ///Function executed by the thread; returning from it ends the thread
+   typedef void (*PR_ThreadFunction)(void * const opv_Instance);
+
+   C_TglThread(void);
+   virtual ~C_TglThread(void);
+
+   int32_t Start(const PR_ThreadFunction opr_Function, void * const opv_Instance);
+   void Join(void);
+   bool IsStarted(void) const;
+
+private:
+   //this class can not be copied:
+   C_TglThread(const C_TglThread & orc_Source);
+   C_TglThread & operator = (const C_TglThread & orc_Source);
+
+   static DWORD WINAPI mh_ThreadFunc(LPVOID opv_Thread);
+
+   HANDLE mx_Thread; ///< thread handle (valid while started)
+   bool mq_Started;
+   PR_ThreadFunction mpr_Function;
+   void * mpv_Instance;
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+///Auto-reset event: lets one thread sleep until another one has work for it
+class C_TglEvent
+{
+public:
+   C_TglEvent(void);
+   virtual ~C_TglEvent(void);
+
+   void Signal(void);
+   void Wait(void);
+
+private:
+   //this class can not be copied:
+   C_TglEvent(const C_TglEvent & orc_Source);
+   C_TglEvent & operator = (const C_TglEvent & orc_Source);
+
+   HANDLE mx_Event; ///< auto-reset event object
+};
+
+uint32_t TglGetCurrentThreadId(void);
+
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
 }
 }
@@ -14,6 +14,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <fstream>
 #include <map>
+#include <string>
+#include <vector>
 #include "C_SclString.hpp"
 #include "TglUtils.hpp"
 #include "TglTime.hpp"
@@ -55,6 +57,7 @@ public:
    static void h_SetWriteToConsoleActive(const bool oq_Active);
    static void h_SetMeasurePerformanceActive(const bool oq_Active);
    static void h_SetCompleteLogFileLocation(const stw::scl::C_SclString & orc_CompleteLogFileLocation);
+   static void h_SetFileRotation(const uint32_t ou32_MaxFileSize, const uint32_t ou32_NumBackupFiles);
    static const stw::scl::C_SclString & h_GetCompleteLogFileLocation(void);
 
    //Logging call
@@ -75,22 +78,69 @@ public:
    static std::string h_UtilConvertDateTimeToString(const stw::tgl::C_TglDateTime & orc_DateTime);
 
 private:
+   ///Type of log entry
+   enum E_Type
+   {
+      eINFO,
+      eWARNING,
+      eERROR
+   };
+
+   ///Log entry as recorded by the logging thread; formatted by the file writer thread
+   class C_Entry
+   {
+   public:
+      stw::tgl::C_TglDateTime c_DateTime;
+      E_Type e_Type;
+      stw::scl::C_SclString c_Activity;
+      stw::scl::C_SclString c_Message;
+      stw::scl::C_SclString c_Class;    ///< Unprocessed class or file path (empty if unknown)
+      stw::scl::C_SclString c_Function; ///< Unprocessed function name (empty if unknown)
+   };
+
    static bool mhq_WriteToFile;
    static bool mhq_AutoFlushAllFile;
    static bool mhq_AutoFlushWarningsAndErrorsFile;
    static bool mhq_WriteToConsole;
    static bool mhq_MeasureTime;
    static bool mhq_LogInitErrorsToConsole;
-   static std::map<uint16_t, uint32_t> mhc_StartTimes; ///< first: Timer ID, second: start time
+   static std::map<uint16_t, uint64_t> mhc_StartTimes; ///< first: Timer ID, second: start time in us
    static stw::scl::C_SclString mhc_FileName;
    static stw::tgl::C_TglCriticalSection mhc_ConsoleCriticalSection;
    static stw::tgl::C_TglCriticalSection mhc_FileCriticalSection;
    static std::ofstream mhc_File;
+   static uint64_t mhu64_FileSize;
+   static uint32_t mhu32_MaxFileSize; ///< Rotation threshold in bytes (0: no rotation)
+   static uint32_t mhu32_NumBackupFiles;
+   static std::string mhc_FileBuffer;
+   static std::vector<C_Entry> mhc_FileEntries; ///< Entries currently written by the file writer
+
+   //Queue from the logging threads to the file writer thread
+   static stw::tgl::C_TglCriticalSection mhc_QueueCriticalSection;
+   static std::vector<C_Entry> mhc_QueuedEntries;
+   static uint32_t mhu32_NumDroppedEntries;
+   static bool mhq_WriterActive;
+   static bool mhq_StopWriter;
+   static bool mhq_WriteSynchronously;
+   static bool mhq_ExitHandlerRegistered;
+   static stw::tgl::C_TglThread mhc_WriterThread;
+   static stw::tgl::C_TglEvent mhc_WriterEvent; ///< Wakes up the writer thread
+
+   static const uint32_t mhu32_MAX_QUEUED_ENTRIES;
 
-   static void mh_WriteLog(const stw::scl::C_SclString & orc_Type, const stw::scl::C_SclString & orc_Activity,
+   static void mh_WriteLog(const E_Type oe_Type, const stw::scl::C_SclString & orc_Activity,
                            const stw::scl::C_SclString & orc_Message, const char_t * const opcn_Class = NULL,
                            const char_t * const opcn_Function = NULL);
+   static void mh_FormatEntry(const C_Entry & orc_Entry, std::string & orc_Line);
+   static void mh_AppendPadded(std::string & orc_Line, const char_t * const opcn_Text, const uint32_t ou32_Width);
+   static void mh_AppendNumber(std::string & orc_Line, const uint32_t ou32_Value, const uint32_t ou32_Digits);
+   static void mh_AppendDateTime(std::string & orc_Line, const stw::tgl::C_TglDateTime & orc_DateTime);
    static void mh_OpenFile(void);
+   static void mh_CloseFile(void);
+   static void mh_RotateFile(void);
+   static void mh_WriteQueuedEntries(const bool oq_Flush);
+   static void mh_WriterThreadFunc(void * const opv_Instance);
+   static void mh_OnExit(void);
    //Avoid calling
    C_OscLoggingHandler(void);
    virtual ~C_OscLoggingHandler(void);
@@ -15,6 +15,7 @@
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "C_OscNodeCommFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscSystemFilerUtil.hpp"
 
@@ -52,9 +53,11 @@ int32_t C_OscNodeCommFiler::h_LoadNodeComProtocolFile(C_OscCanProtocol & orc_Nod
                                                       const C_SclString & orc_FilePath,
                                                       const std::vector<C_OscNodeDataPool> & orc_NodeDataPools)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "COMM protocol file", orc_FilePath);
    C_OscXmlParser c_XmlParser;
+   //the file is only read: no need for a full DOM
    int32_t s32_Retval = C_OscSystemFilerUtil::h_GetParserForExistingFile(c_XmlParser, orc_FilePath,
-                                                                         "opensyde-comm-core-definition");
+                                                                         "opensyde-comm-core-definition", true);
 
    //File version
    if (c_XmlParser.SelectNodeChild("file-version") == "file-version")
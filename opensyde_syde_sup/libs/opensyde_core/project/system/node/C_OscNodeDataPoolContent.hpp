@@ -16,8 +16,7 @@
 #include <vector>
 #include <string>
 #include "stwtypes.hpp"
-
-#include "TglTasks.hpp"
+#include "C_OscNodeDataPoolContentBuffer.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -34,8 +33,6 @@ class C_OscNodeDataPoolContent
 public:
    C_OscNodeDataPoolContent(void);
    C_OscNodeDataPoolContent(const C_OscNodeDataPoolContent & orc_Source);
-   //lint -esym(1539,stw::opensyde_core::C_OscNodeDataPoolContent::mc_CriticalSection)
-   //The lock of the copy is intended to remain unchanged.
    C_OscNodeDataPoolContent & operator = (const C_OscNodeDataPoolContent & orc_Source);
    virtual ~C_OscNodeDataPoolContent(void);
 
@@ -163,13 +160,13 @@ public:
    void GetAnyValueAsFloat32(float32_t & orf32_Output, const uint32_t ou32_Index) const;
    void GetAnyValueAsFloat64(float64_t & orf64_Output, const uint32_t ou32_Index) const;
 
-   const std::vector<uint8_t> * GetDataAccessConst(stw::tgl::C_TglCriticalSection ** const oppc_CriticalSection) const;
-   std::vector<uint8_t> * GetDataAccess(stw::tgl::C_TglCriticalSection ** const oppc_CriticalSection);
+   const uint8_t * GetDataAccessConst(void) const;
+   uint8_t * GetDataAccess(void);
 
 private:
-   E_Type me_Type;               ///< Currently active type
-   bool mq_Array;                ///< Flag for array (true) or single element type (false)
-   std::vector<uint8_t> mc_Data; ///< Contained value
+   E_Type me_Type;                         ///< Currently active type
+   bool mq_Array;                          ///< Flag for array (true) or single element type (false)
+   C_OscNodeDataPoolContentBuffer mc_Data; ///< Contained value
 
    template <typename T> void m_SetValue(const T & orc_Value, const E_Type oe_Type);
    template <typename T> void m_GetValue(const E_Type oe_Type, T & orc_Value) const;
@@ -195,10 +192,6 @@ private:
 
    bool m_CompareArrayNotEqual(const C_OscNodeDataPoolContent & orc_Cmp, const uint32_t ou32_Index) const;
 
-   // It is mutable because of the constness of the getter functions. Without the keyword mutable the getter functions
-   // must be non const and that is not wanted.
-   mutable stw::tgl::C_TglCriticalSection mc_CriticalSection;
-
    void m_GetBaseType(bool & orq_IsUintBase, bool & orq_IsSintBase, bool & orq_IsFloatBase, uint64_t & oru64_UintValue,
                       int64_t & ors64_SintValue, float64_t & orf64_FloatValue) const;
    void m_GetBaseTypeArray(const uint32_t & oru32_Index, bool & orq_IsUintBase, bool & orq_IsSintBase,
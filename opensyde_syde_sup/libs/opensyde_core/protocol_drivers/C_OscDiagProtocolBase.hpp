@@ -433,6 +433,32 @@ public:
    //-----------------------------------------------------------------------------
    virtual int32_t NvmWriteFinalizeTransaction(void) = 0;
 
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Get number of data bytes one NVM read service can transfer
+
+      NvmRead splits bigger requests into multiple services.
+      Applications can use this information to combine accesses to adjacent NVM areas with minimum overhead.
+
+      \return
+      maximum number of data bytes per service
+   */
+   //-----------------------------------------------------------------------------
+   virtual uint32_t GetNvmReadBlockSize(void) const = 0;
+
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Get number of data bytes one NVM write service can transfer
+
+      NvmWrite splits bigger requests into multiple services.
+      Applications can use this information to combine accesses to adjacent NVM areas with minimum overhead.
+
+      \return
+      maximum number of data bytes per service
+   */
+   //-----------------------------------------------------------------------------
+   virtual uint32_t GetNvmWriteBlockSize(void) const = 0;
+
    //-----------------------------------------------------------------------------
    /*!
       \brief   Read Datapool version
@@ -93,6 +93,8 @@ public:
    virtual int32_t NvmWrite(const uint32_t ou32_MemoryAddress, const std::vector<uint8_t> & orc_DataRecord,
                             uint8_t * const opu8_NrCode);
    virtual int32_t NvmWriteFinalizeTransaction(void);
+   virtual uint32_t GetNvmReadBlockSize(void) const;
+   virtual uint32_t GetNvmWriteBlockSize(void) const;
    virtual int32_t DataPoolReadVersion(const uint8_t ou8_DataPoolIndex,
                                        uint8_t(&orau8_Version)[3],
                                        uint8_t * const opu8_NrCode);
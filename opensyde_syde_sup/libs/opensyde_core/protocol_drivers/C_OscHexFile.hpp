@@ -22,15 +22,43 @@ namespace stw
 {
 namespace opensyde_core
 {
+//----------------------------------------------------------------------------------------------------------------------
+///Information extracted from the hex file data once, so it does not need to be searched for again
+class C_OscHexFileIndex
+{
+public:
+   C_OscHexFileIndex(void);
+
+   bool q_Valid;                        ///< true: index was created for the current data
+   int32_t s32_SignatureBlockResult;    ///< result of signature block search
+   uint32_t u32_SignatureBlockAddress;  ///< address of signature block (if found)
+   stw::scl::C_SclDynamicArray<stw::diag_lib::C_XFLECUInformation> c_ApplicationInfoBlocks; ///< "Block0" info blocks
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 ///Comfort layer on top of the hex file class
 class C_OscHexFile :
    public stw::diag_lib::C_XFLHexFile
 {
 public:
+   C_OscHexFile(void);
+
    int32_t GetSignatureBlockAddress(uint32_t & oru32_Address);
    int32_t ScanDeviceIdFromHexFile(stw::scl::C_SclString & orc_DeviceId);
    int32_t ScanApplicationInformationBlockFromHexFile(stw::diag_lib::C_XFLECUInformation & orc_InfoBlock);
+
+   void CreateIndex(void);
+   void SetIndex(const C_OscHexFileIndex & orc_Index);
+   C_OscHexFileIndex GetIndex(void) const;
+
+private:
+   C_OscHexFileIndex mc_Index;
+   uint32_t mu32_IndexDataGeneration; ///< data generation mc_Index was created for (see GetDataGeneration())
+
+   bool m_IsIndexValid(void) const;
+
+   int32_t m_SearchSignatureBlockAddress(uint32_t & oru32_Address);
+   void m_GetApplicationInfoBlocks(stw::scl::C_SclDynamicArray<stw::diag_lib::C_XFLECUInformation> & orc_InfoBlocks);
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,611 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Cache for parsed hex file images (implementation)
+
+   Hex files are typically opened more than once within one update run:
+   * when checking the files before the update (e.g. application information blocks, device name)
+   * when flashing the files (once per node; often the same file is flashed to several nodes of the same type)
+
+   This class keeps the parsed memory image of each file together with an index of the information blocks.
+   The images are identified by the file content (size and MD5 over all bytes of the file); so a renamed or
+    copied file will still hit the cache while a modified file will always be parsed again.
+   Calculating the MD5 is much cheaper than parsing the file.
+
+   Optionally the images can also be stored on disk in a compact binary format. This allows subsequent runs of
+    e.g. SYDEsup to skip parsing unchanged files.
+
+   Disk image format (all values little endian):
+   * 8 bytes magic "OSYHEXI2"
+   * 4 bytes size of hex file
+   * 32 bytes MD5 of hex file (as hex string)
+   * 4 bytes number of blocks
+   * 32 bytes MD5 of payload (as hex string)
+   * payload: per block: 4 bytes start address, 4 bytes number of data bytes, data bytes
+   Images with a payload not matching its MD5 (e.g. truncated or damaged files) are ignored.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "stwerrors.hpp"
+#include "C_OscHexImageCache.hpp"
+#include "C_Md5Checksum.hpp"
+#include "TglFile.hpp"
+#include "C_OscUtils.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::hex_file;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const char_t macn_DISK_IMAGE_MAGIC[8] =
+{
+   'O', 'S', 'Y', 'H', 'E', 'X', 'I', '2'
+};
+static const uint32_t mu32_MD5_STRING_LENGTH = 32U;
+static const uint32_t mu32_DISK_IMAGE_OFFSET_FILE_SIZE = 8U;
+static const uint32_t mu32_DISK_IMAGE_OFFSET_FILE_MD5 = 12U;
+static const uint32_t mu32_DISK_IMAGE_OFFSET_NUM_BLOCKS = 44U;
+static const uint32_t mu32_DISK_IMAGE_OFFSET_PAYLOAD_MD5 = 48U;
+static const uint32_t mu32_DISK_IMAGE_HEADER_SIZE = 80U;
+static const uint32_t mu32_DEFAULT_MAX_ENTRIES = 16U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+std::map<C_OscHexImageCache::C_ContentKey, C_OscHexImageCache::C_Image> C_OscHexImageCache::mhc_Images;
+std::list<C_OscHexImageCache::C_ContentKey> C_OscHexImageCache::mhc_Order;
+uint32_t C_OscHexImageCache::mhu32_MaxEntries = mu32_DEFAULT_MAX_ENTRIES;
+C_SclString C_OscHexImageCache::mhc_DiskCacheDirectory = "";
+C_TglCriticalSection C_OscHexImageCache::mhc_CriticalSection;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_SetU32(uint8_t * const opu8_Target, const uint32_t ou32_Value);
+static uint32_t m_GetU32(const uint8_t * const opu8_Source);
+static C_SclString m_GetMd5(const uint8_t * const opu8_Data, const uint32_t ou32_Length);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Serialize 32bit value (little endian)
+
+   \param[out]  opu8_Target   target buffer (4 bytes)
+   \param[in]   ou32_Value    value to serialize
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_SetU32(uint8_t * const opu8_Target, const uint32_t ou32_Value)
+{
+   opu8_Target[0] = static_cast<uint8_t>(ou32_Value);
+   opu8_Target[1] = static_cast<uint8_t>(ou32_Value >> 8U);
+   opu8_Target[2] = static_cast<uint8_t>(ou32_Value >> 16U);
+   opu8_Target[3] = static_cast<uint8_t>(ou32_Value >> 24U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Deserialize 32bit value (little endian)
+
+   \param[in]  opu8_Source   source buffer (4 bytes)
+
+   \return
+   value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetU32(const uint8_t * const opu8_Source)
+{
+   return static_cast<uint32_t>(opu8_Source[0]) + (static_cast<uint32_t>(opu8_Source[1]) << 8U) +
+          (static_cast<uint32_t>(opu8_Source[2]) << 16U) + (static_cast<uint32_t>(opu8_Source[3]) << 24U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Calculate MD5 of buffer
+
+   \param[in]  opu8_Data     data (may be NULL if ou32_Length is zero)
+   \param[in]  ou32_Length   number of bytes
+
+   \return
+   MD5 as hex string (32 characters)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_GetMd5(const uint8_t * const opu8_Data, const uint32_t ou32_Length)
+{
+   const uint8_t u8_Dummy = 0U;
+
+   return stw::md5::C_Md5Checksum::GetMD5((ou32_Length > 0U) ? opu8_Data : &u8_Dummy, ou32_Length);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare keys
+
+   \param[in]  orc_Other   key to compare with
+
+   \return
+   true     this key is "smaller" than orc_Other
+   false    else
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscHexImageCache::C_ContentKey::operator <(const C_OscHexImageCache::C_ContentKey & orc_Other) const
+{
+   bool q_Return;
+
+   if (this->u32_FileSize != orc_Other.u32_FileSize)
+   {
+      q_Return = (this->u32_FileSize < orc_Other.u32_FileSize);
+   }
+   else
+   {
+      q_Return = (this->c_Md5 < orc_Other.c_Md5);
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check keys for equality
+
+   \param[in]  orc_Other   key to compare with
+
+   \return
+   true     same file content
+   false    else
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscHexImageCache::C_ContentKey::operator ==(const C_OscHexImageCache::C_ContentKey & orc_Other) const
+{
+   return (this->u32_FileSize == orc_Other.u32_FileSize) && (this->c_Md5 == orc_Other.c_Md5);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file using the cache
+
+   Drop-in replacement for C_OscHexFile::LoadFromFile():
+   * if an image of the same file content is in the cache it is handed to orc_HexFile without parsing the file
+   * else if the disk cache is active and contains the image it is read from there
+   * else the file is parsed and the resulting image is added to the cache
+
+   In all cases orc_HexFile contains an index (see C_OscHexFile::CreateIndex()) afterwards.
+   Files that can not be loaded without errors or warnings are not cached.
+
+   Thread safe.
+
+   \param[in]   orc_FilePath   path to hex file
+   \param[out]  orc_HexFile    loaded hex file
+
+   \return
+   see C_HexFile::LoadFromFile()
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscHexImageCache::h_LoadHexFile(const C_SclString & orc_FilePath, C_OscHexFile & orc_HexFile)
+{
+   uint32_t u32_Return;
+   C_ContentKey c_Key;
+
+   if (mh_CalcContentKey(orc_FilePath, c_Key) != C_NO_ERR)
+   {
+      //let the hex file report the problem
+      u32_Return = orc_HexFile.LoadFromFile(orc_FilePath.c_str());
+   }
+   else
+   {
+      bool q_Found = false;
+      C_SclString c_DiskCacheDirectory;
+
+      mhc_CriticalSection.Acquire();
+      const std::map<C_ContentKey, C_Image>::const_iterator c_It = mhc_Images.find(c_Key);
+      if (c_It != mhc_Images.end())
+      {
+         u32_Return = orc_HexFile.SetDataDump(c_It->second.c_Dump);
+         if (u32_Return == NO_ERR)
+         {
+            orc_HexFile.SetIndex(c_It->second.c_Index);
+            q_Found = true;
+            //least recently used entries are dropped first
+            mhc_Order.remove(c_Key);
+            mhc_Order.push_back(c_Key);
+         }
+      }
+      c_DiskCacheDirectory = mhc_DiskCacheDirectory;
+      mhc_CriticalSection.Release();
+
+      if (q_Found == false)
+      {
+         C_Image c_Image;
+         bool q_Loaded = false;
+         const C_SclString c_DiskImagePath = (c_DiskCacheDirectory != "") ?
+                                             mh_GetDiskCacheFilePath(c_DiskCacheDirectory, c_Key) : "";
+
+         if ((c_DiskImagePath != "") && (mh_ReadDiskImage(c_DiskImagePath, c_Key, c_Image.c_Dump) == C_NO_ERR))
+         {
+            u32_Return = orc_HexFile.SetDataDump(c_Image.c_Dump);
+            q_Loaded = (u32_Return == NO_ERR);
+         }
+
+         if (q_Loaded == false)
+         {
+            u32_Return = orc_HexFile.LoadFromFile(orc_FilePath.c_str());
+            if (u32_Return == NO_ERR)
+            {
+               //dump was already created by LoadFromFile; so this is a simple lookup
+               const C_HexDataDump * const pc_Dump = orc_HexFile.GetDataDump(u32_Return);
+               if (pc_Dump != NULL)
+               {
+                  c_Image.c_Dump = *pc_Dump;
+                  q_Loaded = true;
+                  if (c_DiskImagePath != "")
+                  {
+                     //failing to write the disk image is no problem; we will parse the file again next time
+                     (void)mh_WriteDiskImage(c_DiskImagePath, c_Key, c_Image.c_Dump);
+                  }
+               }
+            }
+         }
+
+         if (q_Loaded == true)
+         {
+            orc_HexFile.CreateIndex();
+            c_Image.c_Index = orc_HexFile.GetIndex();
+            mh_AddImage(c_Key, c_Image);
+         }
+      }
+   }
+   return u32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set disk cache directory
+
+   The directory (including parent directories) will be created when the first image is written.
+
+   \param[in]  orc_Directory   directory to store images in; empty string: disk cache not active (default)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexImageCache::h_SetDiskCacheDirectory(const C_SclString & orc_Directory)
+{
+   mhc_CriticalSection.Acquire();
+   mhc_DiskCacheDirectory = orc_Directory;
+   mhc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get disk cache directory
+
+   \return
+   directory to store images in; empty string: disk cache not active
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscHexImageCache::h_GetDiskCacheDirectory(void)
+{
+   C_SclString c_Directory;
+
+   mhc_CriticalSection.Acquire();
+   c_Directory = mhc_DiskCacheDirectory;
+   mhc_CriticalSection.Release();
+   return c_Directory;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set maximum number of images kept in memory
+
+   If there are more images the least recently used ones are dropped.
+
+   \param[in]  ou32_MaxEntries   maximum number of images (0: do not keep any image in memory)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexImageCache::h_SetMaxNumberOfEntries(const uint32_t ou32_MaxEntries)
+{
+   mhc_CriticalSection.Acquire();
+   mhu32_MaxEntries = ou32_MaxEntries;
+   while (mhc_Order.size() > mhu32_MaxEntries)
+   {
+      mhc_Images.erase(mhc_Order.front());
+      mhc_Order.pop_front();
+   }
+   mhc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Drop all images kept in memory
+
+   Images in the disk cache are not affected.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexImageCache::h_Clear(void)
+{
+   mhc_CriticalSection.Acquire();
+   mhc_Images.clear();
+   mhc_Order.clear();
+   mhc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Calculate key identifying the file content
+
+   \param[in]   orc_FilePath   path to file
+   \param[out]  orc_Key        key of file content
+
+   \return
+   C_NO_ERR   key calculated
+   C_RD_WR    could not read file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscHexImageCache::mh_CalcContentKey(const C_SclString & orc_FilePath, C_ContentKey & orc_Key)
+{
+   C_TglFileMapping c_File;
+   int32_t s32_Return = c_File.Map(orc_FilePath);
+
+   if (s32_Return == C_NO_ERR)
+   {
+      orc_Key.u32_FileSize = c_File.GetSize();
+      orc_Key.c_Md5 = m_GetMd5(c_File.GetData(), c_File.GetSize());
+      c_File.Unmap();
+   }
+   else
+   {
+      s32_Return = C_RD_WR;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add image to memory cache
+
+   Drops the least recently used images if there are too many.
+
+   \param[in]  orc_Key     key of file content
+   \param[in]  orc_Image   image to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexImageCache::mh_AddImage(const C_ContentKey & orc_Key, const C_Image & orc_Image)
+{
+   mhc_CriticalSection.Acquire();
+   //might have been added by another thread in the meantime
+   if ((mhu32_MaxEntries > 0U) && (mhc_Images.find(orc_Key) == mhc_Images.end()))
+   {
+      try
+      {
+         mhc_Images[orc_Key] = orc_Image;
+         mhc_Order.push_back(orc_Key);
+      }
+      catch (...)
+      {
+         //not enough memory; the cache is not essential
+         mhc_Images.erase(orc_Key);
+      }
+      while (mhc_Order.size() > mhu32_MaxEntries)
+      {
+         mhc_Images.erase(mhc_Order.front());
+         mhc_Order.pop_front();
+      }
+   }
+   mhc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get path of disk image for file content
+
+   \param[in]  orc_Directory   disk cache directory
+   \param[in]  orc_Key         key of file content
+
+   \return
+   path of disk image
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscHexImageCache::mh_GetDiskCacheFilePath(const C_SclString & orc_Directory,
+                                                        const C_ContentKey & orc_Key)
+{
+   C_SclString c_FileName;
+
+   c_FileName.PrintFormatted("%08X_", orc_Key.u32_FileSize);
+   return TglFileIncludeTrailingDelimiter(orc_Directory) + c_FileName + orc_Key.c_Md5 + ".osyhex";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read image from disk
+
+   \param[in]   orc_FilePath   path of disk image
+   \param[in]   orc_Key        expected key of file content
+   \param[out]  orc_Dump       read image
+
+   \return
+   C_NO_ERR   image read
+   C_RD_WR    file does not exist or could not be read
+   C_CONFIG   file does not contain a valid image for the key (or the payload checksum does not match)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscHexImageCache::mh_ReadDiskImage(const C_SclString & orc_FilePath, const C_ContentKey & orc_Key,
+                                             C_HexDataDump & orc_Dump)
+{
+   int32_t s32_Return = C_RD_WR;
+   C_TglFileMapping c_File;
+
+   if ((TglFileExists(orc_FilePath) == true) && (c_File.Map(orc_FilePath) == C_NO_ERR))
+   {
+      const uint8_t * const pu8_Data = c_File.GetData();
+      const uint32_t u32_Size = c_File.GetSize();
+
+      s32_Return = C_CONFIG;
+      if ((u32_Size >= mu32_DISK_IMAGE_HEADER_SIZE) &&
+          (std::memcmp(pu8_Data, &macn_DISK_IMAGE_MAGIC[0], sizeof(macn_DISK_IMAGE_MAGIC)) == 0) &&
+          (m_GetU32(&pu8_Data[mu32_DISK_IMAGE_OFFSET_FILE_SIZE]) == orc_Key.u32_FileSize) &&
+          (orc_Key.c_Md5.Length() == mu32_MD5_STRING_LENGTH) &&
+          (std::memcmp(&pu8_Data[mu32_DISK_IMAGE_OFFSET_FILE_MD5], orc_Key.c_Md5.c_str(),
+                       mu32_MD5_STRING_LENGTH) == 0) &&
+          (std::memcmp(&pu8_Data[mu32_DISK_IMAGE_OFFSET_PAYLOAD_MD5],
+                       m_GetMd5(&pu8_Data[mu32_DISK_IMAGE_HEADER_SIZE],
+                                u32_Size - mu32_DISK_IMAGE_HEADER_SIZE).c_str(), mu32_MD5_STRING_LENGTH) == 0))
+      {
+         const uint32_t u32_NumBlocks = m_GetU32(&pu8_Data[mu32_DISK_IMAGE_OFFSET_NUM_BLOCKS]);
+         uint32_t u32_Position = mu32_DISK_IMAGE_HEADER_SIZE;
+
+         s32_Return = C_NO_ERR;
+         try
+         {
+            orc_Dump.at_Blocks.SetLength(0);
+            //each block needs at least 8 bytes; so this check also protects against absurd block numbers
+            if (u32_NumBlocks > ((u32_Size - u32_Position) / 8U))
+            {
+               s32_Return = C_CONFIG;
+            }
+            else
+            {
+               orc_Dump.at_Blocks.SetLength(static_cast<int32_t>(u32_NumBlocks));
+            }
+            for (uint32_t u32_Block = 0U; (u32_Block < u32_NumBlocks) && (s32_Return == C_NO_ERR); u32_Block++)
+            {
+               uint32_t u32_BlockSize;
+               C_HexDataDumpBlock & rc_Block = orc_Dump.at_Blocks[static_cast<int32_t>(u32_Block)];
+
+               if ((u32_Size - u32_Position) < 8U)
+               {
+                  s32_Return = C_CONFIG;
+                  break;
+               }
+               rc_Block.u32_AddressOffset = m_GetU32(&pu8_Data[u32_Position]);
+               u32_BlockSize = m_GetU32(&pu8_Data[u32_Position + 4U]);
+               u32_Position += 8U;
+               if ((u32_Size - u32_Position) < u32_BlockSize)
+               {
+                  s32_Return = C_CONFIG;
+                  break;
+               }
+               rc_Block.au8_Data.SetLength(static_cast<int32_t>(u32_BlockSize));
+               if (u32_BlockSize > 0U)
+               {
+                  (void)std::memcpy(&rc_Block.au8_Data[0], &pu8_Data[u32_Position], u32_BlockSize);
+               }
+               u32_Position += u32_BlockSize;
+            }
+            if ((s32_Return == C_NO_ERR) && (u32_Position != u32_Size))
+            {
+               s32_Return = C_CONFIG;
+            }
+         }
+         catch (...)
+         {
+            s32_Return = C_RD_WR;
+         }
+      }
+      c_File.Unmap();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write image to disk
+
+   The image is written to a temporary file first and then renamed.
+   So concurrent readers will never see an incomplete image.
+
+   \param[in]  orc_FilePath   path of disk image
+   \param[in]  orc_Key        key of file content
+   \param[in]  orc_Dump       image to write
+
+   \return
+   C_NO_ERR   image written
+   C_RD_WR    could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscHexImageCache::mh_WriteDiskImage(const C_SclString & orc_FilePath, const C_ContentKey & orc_Key,
+                                              const C_HexDataDump & orc_Dump)
+{
+   int32_t s32_Return = C_NO_ERR;
+   const C_SclString c_Directory = TglExtractFilePath(orc_FilePath);
+   const C_SclString c_TempPath = orc_FilePath + ".tmp";
+
+   if (C_OscUtils::h_CreateFolderRecursively(c_Directory) != C_NO_ERR)
+   {
+      s32_Return = C_RD_WR;
+   }
+   else
+   {
+      std::vector<uint8_t> c_Payload;
+
+      try
+      {
+         //assemble payload first; we need its checksum for the header
+         for (int32_t s32_Block = 0; s32_Block < orc_Dump.at_Blocks.GetLength(); s32_Block++)
+         {
+            const C_HexDataDumpBlock & rc_Block = orc_Dump.at_Blocks[s32_Block];
+            const uint32_t u32_BlockSize = static_cast<uint32_t>(rc_Block.au8_Data.GetLength());
+            const size_t x_Position = c_Payload.size();
+
+            c_Payload.resize(x_Position + 8U + u32_BlockSize);
+            m_SetU32(&c_Payload[x_Position], rc_Block.u32_AddressOffset);
+            m_SetU32(&c_Payload[x_Position + 4U], u32_BlockSize);
+            if (u32_BlockSize > 0U)
+            {
+               (void)std::memcpy(&c_Payload[x_Position + 8U], &rc_Block.au8_Data[0], u32_BlockSize);
+            }
+         }
+      }
+      catch (...)
+      {
+         s32_Return = C_RD_WR;
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         std::FILE * const pc_File = std::fopen(c_TempPath.c_str(), "wb");
+         if (pc_File == NULL)
+         {
+            s32_Return = C_RD_WR;
+         }
+         else
+         {
+            const uint32_t u32_PayloadSize = static_cast<uint32_t>(c_Payload.size());
+            const C_SclString c_PayloadMd5 = m_GetMd5((u32_PayloadSize > 0U) ? &c_Payload[0] : NULL,
+                                                      u32_PayloadSize);
+            uint8_t au8_Header[mu32_DISK_IMAGE_HEADER_SIZE];
+
+            (void)std::memset(&au8_Header[0], 0, sizeof(au8_Header));
+            (void)std::memcpy(&au8_Header[0], &macn_DISK_IMAGE_MAGIC[0], sizeof(macn_DISK_IMAGE_MAGIC));
+            m_SetU32(&au8_Header[mu32_DISK_IMAGE_OFFSET_FILE_SIZE], orc_Key.u32_FileSize);
+            (void)std::memcpy(&au8_Header[mu32_DISK_IMAGE_OFFSET_FILE_MD5], orc_Key.c_Md5.c_str(),
+                              mu32_MD5_STRING_LENGTH);
+            m_SetU32(&au8_Header[mu32_DISK_IMAGE_OFFSET_NUM_BLOCKS],
+                     static_cast<uint32_t>(orc_Dump.at_Blocks.GetLength()));
+            (void)std::memcpy(&au8_Header[mu32_DISK_IMAGE_OFFSET_PAYLOAD_MD5], c_PayloadMd5.c_str(),
+                              mu32_MD5_STRING_LENGTH);
+            if (std::fwrite(&au8_Header[0], 1U, sizeof(au8_Header), pc_File) != sizeof(au8_Header))
+            {
+               s32_Return = C_RD_WR;
+            }
+            else if ((u32_PayloadSize > 0U) &&
+                     (std::fwrite(&c_Payload[0], 1U, u32_PayloadSize, pc_File) != u32_PayloadSize))
+            {
+               s32_Return = C_RD_WR;
+            }
+            else
+            {
+               //fine
+            }
+            if (std::fclose(pc_File) != 0)
+            {
+               s32_Return = C_RD_WR;
+            }
+
+            //TglRenameFile replaces an existing image (e.g. written by a concurrent process) on all platforms
+            if ((s32_Return == C_NO_ERR) && (TglRenameFile(c_TempPath, orc_FilePath) != 0))
+            {
+               s32_Return = C_RD_WR;
+            }
+            if (s32_Return != C_NO_ERR)
+            {
+               (void)std::remove(c_TempPath.c_str());
+            }
+         }
+      }
+   }
+   return s32_Return;
+}
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Cache for parsed hex file images (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCHEXIMAGECACHE_HPP
+#define C_OSCHEXIMAGECACHE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+#include <list>
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_OscHexFile.hpp"
+#include "TglTasks.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Process wide cache for parsed hex file images
+class C_OscHexImageCache
+{
+public:
+   static uint32_t h_LoadHexFile(const stw::scl::C_SclString & orc_FilePath, C_OscHexFile & orc_HexFile);
+
+   static void h_SetDiskCacheDirectory(const stw::scl::C_SclString & orc_Directory);
+   static stw::scl::C_SclString h_GetDiskCacheDirectory(void);
+   static void h_SetMaxNumberOfEntries(const uint32_t ou32_MaxEntries);
+   static void h_Clear(void);
+
+private:
+   ///identifies file content
+   class C_ContentKey
+   {
+   public:
+      uint32_t u32_FileSize;
+      stw::scl::C_SclString c_Md5; ///< MD5 of file content as hex string
+
+      bool operator <(const C_ContentKey & orc_Other) const;
+      bool operator ==(const C_ContentKey & orc_Other) const;
+   };
+
+   ///one cached image
+   class C_Image
+   {
+   public:
+      stw::hex_file::C_HexDataDump c_Dump;
+      C_OscHexFileIndex c_Index;
+   };
+
+   C_OscHexImageCache(void); ///< static class; no instances
+
+   static std::map<C_ContentKey, C_Image> mhc_Images;
+   static std::list<C_ContentKey> mhc_Order; ///< least recently used entry first
+   static uint32_t mhu32_MaxEntries;
+   static stw::scl::C_SclString mhc_DiskCacheDirectory;
+   static stw::tgl::C_TglCriticalSection mhc_CriticalSection;
+
+   static int32_t mh_CalcContentKey(const stw::scl::C_SclString & orc_FilePath, C_ContentKey & orc_Key);
+   static void mh_AddImage(const C_ContentKey & orc_Key, const C_Image & orc_Image);
+   static stw::scl::C_SclString mh_GetDiskCacheFilePath(const stw::scl::C_SclString & orc_Directory,
+                                                        const C_ContentKey & orc_Key);
+   static int32_t mh_ReadDiskImage(const stw::scl::C_SclString & orc_FilePath, const C_ContentKey & orc_Key,
+                                   stw::hex_file::C_HexDataDump & orc_Dump);
+   static int32_t mh_WriteDiskImage(const stw::scl::C_SclString & orc_FilePath, const C_ContentKey & orc_Key,
+                                    const stw::hex_file::C_HexDataDump & orc_Dump);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
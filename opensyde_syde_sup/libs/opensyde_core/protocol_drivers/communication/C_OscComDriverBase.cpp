@@ -14,6 +14,7 @@
 #include "precomp_headers.hpp"
 
 #include <cstring>
+#include <algorithm>
 
 #include "stwerrors.hpp"
 
@@ -22,6 +23,7 @@
 #include "TglTime.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscComAutoSupport.hpp"
+#include "C_OscComCyclicTxScheduler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -96,6 +98,18 @@ bool C_OscComDriverBaseCanMessage::operator ==(const C_OscComDriverBaseCanMessag
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComDriverBaseCanMessageStatistics::C_OscComDriverBaseCanMessageStatistics(void) :
+   u32_NumSent(0U),
+   u32_NumMissed(0U),
+   u64_SumLatenessUs(0U),
+   u32_MaxLatenessUs(0U)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Default constructor
 */
@@ -110,6 +124,7 @@ C_OscComDriverBase::C_OscComDriverBase(void) :
    mu32_CanTxCounter(0U),
    mu32_CanTxErrors(0U)
 {
+   mpc_CyclicTxScheduler = new C_OscComCyclicTxScheduler();
    mpc_AutoSupportProtocol = new C_OscComAutoSupport();
 }
 
@@ -123,6 +138,7 @@ C_OscComDriverBase::~C_OscComDriverBase(void)
 {
    this->mpc_CanDispatcher = NULL; //do not delete ! not owned by us
    delete this->mpc_AutoSupportProtocol;
+   delete this->mpc_CyclicTxScheduler;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -195,6 +211,8 @@ int32_t C_OscComDriverBase::StartLogging(const int32_t os32_Bitrate)
       this->mu32_CanMessageBits = 0U;
       this->mu32_CanTxCounter = 0U;
       this->mu32_CanTxErrors = 0U;
+      // Messages were not sent while stopped
+      this->mpc_CyclicTxScheduler->Resynchronize(stw::tgl::TglGetTickCountUs());
 
       // Inform all loggers about the start
       for (u32_Counter = 0U; u32_Counter < this->mc_Logger.size(); ++u32_Counter)
@@ -215,6 +233,10 @@ void C_OscComDriverBase::StopLogging(void)
    mpc_AutoSupportProtocol->ClearAutoSupportInfo();
    uint32_t u32_Counter;
 
+   if (this->mq_Started == true)
+   {
+      this->m_LogCyclicCanMessageStatistics();
+   }
    this->mq_Started = false;
 
    // Inform all logger about the stop and no bus load when stopped
@@ -517,9 +539,11 @@ int32_t C_OscComDriverBase::SendCanMessageDirect(T_STWCAN_Msg_TX & orc_Msg)
 void C_OscComDriverBase::SendCanMessage(C_OscComDriverBaseCanMessage & orc_MsgCfg, const bool oq_SetAutoSupportMode,
                                         const C_OscCanProtocol::E_Type oe_ProtocolType)
 {
+   C_OscComDriverBaseCanMessage c_MsgCfg = orc_MsgCfg;
+
    mpc_AutoSupportProtocol->AutoSupportModeInfo(orc_MsgCfg.c_Msg.u32_ID, oq_SetAutoSupportMode, oe_ProtocolType);
-   this->mc_CanMessageConfigs.push_back(orc_MsgCfg);
-   this->mc_CanMessageConfigs.back().u32_Interval = 0U;
+   c_MsgCfg.u32_Interval = 0U;
+   this->mpc_CyclicTxScheduler->Add(c_MsgCfg, C_OscComDriverBase::mh_GetTimeToSendUs(c_MsgCfg.u32_TimeToSend));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -534,12 +558,14 @@ void C_OscComDriverBase::AddCyclicCanMessage(const C_OscComDriverBaseCanMessage
                                              const bool oq_SetAutoSupportMode,
                                              const C_OscCanProtocol::E_Type oe_ProtocolType)
 {
+   C_OscComDriverBaseCanMessage c_MsgCfg = orc_MsgCfg;
+
    mpc_AutoSupportProtocol->AutoSupportModeInfo(orc_MsgCfg.c_Msg.u32_ID, oq_SetAutoSupportMode, oe_ProtocolType);
-   this->mc_CanMessageConfigs.push_back(orc_MsgCfg);
-   if (orc_MsgCfg.u32_Interval == 0U)
+   if (c_MsgCfg.u32_Interval == 0U)
    {
-      this->mc_CanMessageConfigs.back().u32_Interval = 1U;
+      c_MsgCfg.u32_Interval = 1U;
    }
+   this->mpc_CyclicTxScheduler->Add(c_MsgCfg, C_OscComDriverBase::mh_GetTimeToSendUs(c_MsgCfg.u32_TimeToSend));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -557,32 +583,31 @@ void C_OscComDriverBase::RemoveCyclicCanMessage(const C_OscComDriverBaseCanMessa
    mpc_AutoSupportProtocol->AutoSupportModeInfo(orc_MsgCfg.c_Msg.u32_ID, false, oe_ProtocolType);
    C_OscComDriverBaseCanMessage c_MsgCfg = orc_MsgCfg;
 
-   std::list<C_OscComDriverBaseCanMessage>::iterator c_ItConfig;
-
    if (c_MsgCfg.u32_Interval == 0U)
    {
       c_MsgCfg.u32_Interval = 1U;
    }
 
-   for (c_ItConfig = this->mc_CanMessageConfigs.begin(); c_ItConfig != this->mc_CanMessageConfigs.end(); ++c_ItConfig)
+   for (uint32_t u32_ItConfig = 0U; u32_ItConfig < this->mpc_CyclicTxScheduler->GetSize(); ++u32_ItConfig)
    {
-      if (((false == oq_SetAutoSupportMode) && (*c_ItConfig == c_MsgCfg)) ||
+      const C_OscComDriverBaseCanMessage * const pc_Config = &this->mpc_CyclicTxScheduler->GetMessage(u32_ItConfig);
+      if (((false == oq_SetAutoSupportMode) && (*pc_Config == c_MsgCfg)) ||
           ((true == oq_SetAutoSupportMode) && (oe_ProtocolType == C_OscCanProtocol::eCAN_OPEN_SAFETY) &&
-           (*c_ItConfig == c_MsgCfg)) ||
+           (*pc_Config == c_MsgCfg)) ||
           ((true == oq_SetAutoSupportMode) && (oe_ProtocolType == C_OscCanProtocol::eECES) &&
-           ((c_ItConfig->c_Msg.u32_ID == orc_MsgCfg.c_Msg.u32_ID) &&
-            (c_ItConfig->c_Msg.u8_Align == orc_MsgCfg.c_Msg.u8_Align) &&
-            (c_ItConfig->c_Msg.u8_DLC == orc_MsgCfg.c_Msg.u8_DLC) &&
-            (c_ItConfig->c_Msg.u8_RTR == orc_MsgCfg.c_Msg.u8_RTR) &&
-            (c_ItConfig->c_Msg.u8_XTD == orc_MsgCfg.c_Msg.u8_XTD) &&
-            (c_ItConfig->c_Msg.au8_Data[0] == orc_MsgCfg.c_Msg.au8_Data[0]) &&
-            (c_ItConfig->c_Msg.au8_Data[1] == orc_MsgCfg.c_Msg.au8_Data[1]) &&
-            (c_ItConfig->c_Msg.au8_Data[2] == orc_MsgCfg.c_Msg.au8_Data[2]) &&
-            (c_ItConfig->c_Msg.au8_Data[3] == orc_MsgCfg.c_Msg.au8_Data[3]) &&
-            (c_ItConfig->c_Msg.au8_Data[4] == orc_MsgCfg.c_Msg.au8_Data[4]) &&
-            (c_ItConfig->c_Msg.au8_Data[5] == orc_MsgCfg.c_Msg.au8_Data[5]))))
+           ((pc_Config->c_Msg.u32_ID == orc_MsgCfg.c_Msg.u32_ID) &&
+            (pc_Config->c_Msg.u8_Align == orc_MsgCfg.c_Msg.u8_Align) &&
+            (pc_Config->c_Msg.u8_DLC == orc_MsgCfg.c_Msg.u8_DLC) &&
+            (pc_Config->c_Msg.u8_RTR == orc_MsgCfg.c_Msg.u8_RTR) &&
+            (pc_Config->c_Msg.u8_XTD == orc_MsgCfg.c_Msg.u8_XTD) &&
+            (pc_Config->c_Msg.au8_Data[0] == orc_MsgCfg.c_Msg.au8_Data[0]) &&
+            (pc_Config->c_Msg.au8_Data[1] == orc_MsgCfg.c_Msg.au8_Data[1]) &&
+            (pc_Config->c_Msg.au8_Data[2] == orc_MsgCfg.c_Msg.au8_Data[2]) &&
+            (pc_Config->c_Msg.au8_Data[3] == orc_MsgCfg.c_Msg.au8_Data[3]) &&
+            (pc_Config->c_Msg.au8_Data[4] == orc_MsgCfg.c_Msg.au8_Data[4]) &&
+            (pc_Config->c_Msg.au8_Data[5] == orc_MsgCfg.c_Msg.au8_Data[5]))))
       {
-         this->mc_CanMessageConfigs.erase(c_ItConfig);
+         this->mpc_CyclicTxScheduler->Remove(u32_ItConfig);
          break;
       }
    }
@@ -594,7 +619,58 @@ void C_OscComDriverBase::RemoveCyclicCanMessage(const C_OscComDriverBaseCanMessa
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscComDriverBase::RemoveAllCyclicCanMessages(void)
 {
-   this->mc_CanMessageConfigs.clear();
+   this->mpc_CyclicTxScheduler->Clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get transmission statistics of all registered CAN messages
+
+   The statistics are reset with each start of logging.
+
+   \param[out]  orc_Statistics  Statistics of all registered messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComDriverBase::GetCyclicCanMessageStatistics(
+   std::vector<C_OscComDriverBaseCanMessageStatistics> & orc_Statistics) const
+{
+   orc_Statistics.resize(this->mpc_CyclicTxScheduler->GetSize());
+   for (uint32_t u32_ItMessage = 0U; u32_ItMessage < orc_Statistics.size(); ++u32_ItMessage)
+   {
+      orc_Statistics[u32_ItMessage] = this->mpc_CyclicTxScheduler->GetStatistics(u32_ItMessage);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get time until the next CAN message has to be sent
+
+   Can be used by the thread calling DistributeMessages to wait exactly until the next transmission.
+
+   \param[out]  oru32_TimeUs  Time until the next transmission (0 if a message is already due)
+
+   \return
+   true     Message pending; time valid
+   false    No message queued or registered
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComDriverBase::GetTimeToNextCanMessage(uint32_t & oru32_TimeUs) const
+{
+   bool q_Retval = false;
+
+   if (this->mc_CanMessages.empty() == false)
+   {
+      oru32_TimeUs = 0U;
+      q_Retval = true;
+   }
+   else
+   {
+      uint64_t u64_TimeUs;
+      if (this->mpc_CyclicTxScheduler->GetTimeToNextDue(stw::tgl::TglGetTickCountUs(), u64_TimeUs) == true)
+      {
+         oru32_TimeUs = static_cast<uint32_t>(std::min(u64_TimeUs, static_cast<uint64_t>(0xFFFFFFFFUL)));
+         q_Retval = true;
+      }
+   }
+   return q_Retval;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -633,14 +709,14 @@ void C_OscComDriverBase::UpdateAutoSupportProtocol(const int32_t os32_CanId, con
 {
    mpc_AutoSupportProtocol->AutoSupportModeInfo(os32_CanId, oq_SetAutoSupportMode, oe_ProtocolType);
    mpc_AutoSupportProtocol->ResetMessageCounters(os32_CanId, oq_SetAutoSupportMode, oe_ProtocolType);
-   std::list<C_OscComDriverBaseCanMessage>::iterator c_ItConfig;
-   for (c_ItConfig = this->mc_CanMessageConfigs.begin(); c_ItConfig != this->mc_CanMessageConfigs.end(); ++c_ItConfig)
+   for (uint32_t u32_ItConfig = 0U; u32_ItConfig < this->mpc_CyclicTxScheduler->GetSize(); ++u32_ItConfig)
    {
-      if ((static_cast<int32_t>(c_ItConfig->c_Msg.u32_ID) == os32_CanId) &&
+      C_OscComDriverBaseCanMessage & rc_Config = this->mpc_CyclicTxScheduler->GetMessage(u32_ItConfig);
+      if ((static_cast<int32_t>(rc_Config.c_Msg.u32_ID) == os32_CanId) &&
           (oe_ProtocolType == C_OscCanProtocol::eECES) && (oq_SetAutoSupportMode == false))
       {
-         c_ItConfig->c_Msg.au8_Data[6] = 0;
-         c_ItConfig->c_Msg.au8_Data[7] = 0;
+         rc_Config.c_Msg.au8_Data[6] = 0;
+         rc_Config.c_Msg.au8_Data[7] = 0;
       }
    }
 }
@@ -675,7 +751,8 @@ void C_OscComDriverBase::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, con
 void C_OscComDriverBase::m_HandleCanMessagesForSending(void)
 {
    std::list<stw::can::T_STWCAN_Msg_TX>::iterator c_ItCanMessage;
-   std::list<C_OscComDriverBaseCanMessage>::iterator c_ItCanMessageConfig = this->mc_CanMessageConfigs.begin();
+   uint64_t u64_CurTimeStampUs;
+   C_OscComDriverBaseCanMessage * pc_MessageConfig;
 
    // Send all queued CAN messages
    for (c_ItCanMessage = this->mc_CanMessages.begin(); c_ItCanMessage != this->mc_CanMessages.end();
@@ -685,34 +762,68 @@ void C_OscComDriverBase::m_HandleCanMessagesForSending(void)
    }
    this->mc_CanMessages.clear();
 
-   // Send all registered cyclic messages
-   while (c_ItCanMessageConfig != this->mc_CanMessageConfigs.end())
+   // Send all registered messages which are due; in order of their scheduled time
+   u64_CurTimeStampUs = stw::tgl::TglGetTickCountUs();
+   pc_MessageConfig = this->mpc_CyclicTxScheduler->GetDue(u64_CurTimeStampUs);
+   while (pc_MessageConfig != NULL)
    {
-      const uint32_t u32_CurTimeStamp = stw::tgl::TglGetTickCount();
+      this->SendCanMessageDirect(pc_MessageConfig->c_Msg);
+      // Schedules the next transmission or removes single shot messages
+      this->mpc_CyclicTxScheduler->ConfirmDue(u64_CurTimeStampUs);
 
-      if ((*c_ItCanMessageConfig).u32_TimeToSend <= u32_CurTimeStamp)
-      {
-         // It is time for sending the CAN message
-         this->SendCanMessageDirect((*c_ItCanMessageConfig).c_Msg);
+      u64_CurTimeStampUs = stw::tgl::TglGetTickCountUs();
+      pc_MessageConfig = this->mpc_CyclicTxScheduler->GetDue(u64_CurTimeStampUs);
+   }
+}
 
-         if ((*c_ItCanMessageConfig).u32_Interval != 0)
-         {
-            // Update the next timestamp for the next sending
-            (*c_ItCanMessageConfig).u32_TimeToSend = u32_CurTimeStamp + (*c_ItCanMessageConfig).u32_Interval;
-            ++c_ItCanMessageConfig;
-         }
-         else
-         {
-            // No interval configured. Sending this CAN message only once and erase the configuration
-            c_ItCanMessageConfig = this->mc_CanMessageConfigs.erase(c_ItCanMessageConfig);
-         }
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write transmission statistics of all registered cyclic CAN messages to the log
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComDriverBase::m_LogCyclicCanMessageStatistics(void) const
+{
+   std::vector<C_OscComDriverBaseCanMessageStatistics> c_Statistics;
+
+   this->GetCyclicCanMessageStatistics(c_Statistics);
+   for (uint32_t u32_ItMessage = 0U; u32_ItMessage < c_Statistics.size(); ++u32_ItMessage)
+   {
+      const C_OscComDriverBaseCanMessageStatistics & rc_Statistics = c_Statistics[u32_ItMessage];
+      if (rc_Statistics.u32_NumSent > 0U)
+      {
+         osc_write_log_info("Cyclic CAN transmission",
+                            "ID 0x" + C_SclString::IntToHex(rc_Statistics.c_MsgCfg.c_Msg.u32_ID, 3U) +
+                            " (" + C_SclString::IntToStr(rc_Statistics.c_MsgCfg.u32_Interval) + " ms): " +
+                            C_SclString::IntToStr(rc_Statistics.u32_NumSent) + " sent, " +
+                            C_SclString::IntToStr(rc_Statistics.u32_NumMissed) + " periods missed, lateness avg " +
+                            C_SclString::IntToStr(rc_Statistics.u64_SumLatenessUs / rc_Statistics.u32_NumSent) +
+                            " us, max " + C_SclString::IntToStr(rc_Statistics.u32_MaxLatenessUs) + " us");
       }
-      else
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert the time to send of a message configuration to the time base of the scheduler
+
+   \param[in]  ou32_TimeToSend  Time to send in ms (TglGetTickCount); 0 for now
+
+   \return
+   Time to send in us (TglGetTickCountUs)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscComDriverBase::mh_GetTimeToSendUs(const uint32_t ou32_TimeToSend)
+{
+   uint64_t u64_Retval = stw::tgl::TglGetTickCountUs();
+
+   if (ou32_TimeToSend != 0U)
+   {
+      //both tick counters have different origins; only use the difference
+      const int32_t s32_DelayMs = static_cast<int32_t>(ou32_TimeToSend - stw::tgl::TglGetTickCount());
+      if (s32_DelayMs > 0)
       {
-         // Nothing to do, check next element
-         ++c_ItCanMessageConfig;
+         u64_Retval += static_cast<uint64_t>(s32_DelayMs) * 1000U;
       }
    }
+   return u64_Retval;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
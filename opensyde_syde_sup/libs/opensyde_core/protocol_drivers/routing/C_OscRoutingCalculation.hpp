@@ -1,7 +1,7 @@
 //----------------------------------------------------------------------------------------------------------------------
 /*!
    \file
-   \brief       Calculation of all potential routes to a specific node in a specific view. (header)
+   \brief       Calculation of the best route to a specific node in a specific view. (header)
 
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
@@ -11,7 +11,6 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <vector>
-#include <list>
 
 #include "stwtypes.hpp"
 
@@ -44,7 +43,6 @@ public:
                            const E_Mode oe_Mode);
    virtual ~C_OscRoutingCalculation();
 
-   const std::vector<C_OscRoutingRoute> * GetRoutes(void) const;
    const C_OscRoutingRoute * GetBestRoute(void) const;
    int32_t GetState(void) const;
    bool CheckItfNumberForRouting(const uint32_t ou32_TargetNodeIndex,
@@ -55,35 +53,11 @@ private:
    C_OscRoutingCalculation(const C_OscRoutingCalculation &);
    C_OscRoutingCalculation & operator =(const C_OscRoutingCalculation &);
 
-   void m_SearchRoute(void);
-   int32_t m_CheckTargetNodeConfig(void) const;
-   void m_SearchRoutePointsOnBus(const uint32_t ou32_BusIndex);
-   std::vector<uint32_t> m_GetAllRoutePointsOfNodeOnOneInput(const C_OscRoutingRoutePoint & orc_InPoint,
-                                                             const uint32_t ou32_InItfNumber);
-   void m_AddOneRoutePoint(const C_OscRoutingRoutePoint & orc_Point);
-
-   void m_CalculateRoutes(const uint32_t ou32_BusIndex);
-   void m_AddOneOpenRoute(const C_OscRoutingRoute & orc_Route);
-   void m_AddOneRouteToTarget(const C_OscRoutingRoute & orc_Route);
-
-   int32_t m_CheckRoutesForLimitations(void);
-
-   uint32_t mu32_StartBusIndex;
    uint32_t mu32_TargetNodeIndex;
    E_Mode me_Mode;
 
-   std::vector<C_OscRoutingRoutePoint> mc_AllRoutePoints;
-   std::vector<C_OscRoutingRoute> mc_RoutesToTarget;
-   std::list<C_OscRoutingRoute> mc_AllOpenRoutes;
+   C_OscRoutingRoute mc_BestRoute;
    int32_t ms32_ResultState;
-
-   std::vector<uint32_t> mc_CheckedBuses;
-   bool mq_PcBus;
-
-   //lint -e{1725} reference used for performance reasons
-   const std::vector<C_OscNode> & mrc_AllNodes;
-   //lint -e{1725} reference used for performance reasons
-   const std::vector<uint8_t> & mrc_ActiveNodes;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
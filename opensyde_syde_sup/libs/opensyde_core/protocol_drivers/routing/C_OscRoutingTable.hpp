@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Best routes from one bus to all nodes of a system (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCROUTINGTABLE_HPP
+#define C_OSCROUTINGTABLE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <list>
+#include <map>
+
+#include "stwtypes.hpp"
+
+#include "TglTasks.hpp"
+#include "C_SclString.hpp"
+#include "C_OscRoutingRoute.hpp"
+#include "C_OscRoutingCalculation.hpp"
+#include "C_OscNode.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscRoutingTable
+{
+public:
+   C_OscRoutingTable(const std::vector<C_OscNode> & orc_AllNodes, const std::vector<uint8_t> & orc_ActiveNodes,
+                     const uint32_t ou32_StartBusIndex, const C_OscRoutingCalculation::E_Mode oe_Mode);
+
+   int32_t GetState(const uint32_t ou32_TargetNodeIndex) const;
+   const C_OscRoutingRoute * GetBestRoute(const uint32_t ou32_TargetNodeIndex) const;
+
+   static int32_t h_GetBestRoute(const std::vector<C_OscNode> & orc_AllNodes,
+                                 const std::vector<uint8_t> & orc_ActiveNodes, const uint32_t ou32_StartBusIndex,
+                                 const uint32_t ou32_TargetNodeIndex, const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                 C_OscRoutingRoute & orc_Route);
+   static void h_ClearCache(void);
+   static bool h_CheckItfNumberForRouting(const bool oq_IsTarget, const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                          const C_OscNodeComInterfaceSettings & orc_ComItfSettings);
+
+private:
+   ///Result for one target node
+   class C_Target
+   {
+   public:
+      explicit C_Target(const uint32_t ou32_TargetNodeIndex);
+
+      int32_t s32_State;
+      C_OscRoutingRoute c_Route;
+   };
+
+   ///Shortest route from the start bus to one bus
+   class C_Bus
+   {
+   public:
+      C_Bus(void);
+
+      uint32_t u32_Hops;
+      bool q_HasEthernet; ///< true: at least one route point routes to Ethernet
+      std::vector<C_OscRoutingRoutePoint> c_RoutePoints;
+   };
+
+   ///Cached table
+   class C_CacheEntry
+   {
+   public:
+      std::vector<uint32_t> c_Key; ///< All routing relevant input data (see mh_GetCacheKey)
+      std::vector<C_Target> c_Targets;
+   };
+
+   std::vector<C_Target> mc_Targets;
+
+   static std::list<C_CacheEntry> mhc_Cache;
+   static stw::tgl::C_TglCriticalSection mhc_CacheCriticalSection;
+
+   static const uint32_t mhu32_CACHE_SIZE;
+
+   static void mh_GetRoutePoints(const std::vector<C_OscNode> & orc_AllNodes,
+                                 const std::vector<uint8_t> & orc_ActiveNodes,
+                                 std::map<uint32_t, std::vector<C_OscRoutingRoutePoint> > & orc_RoutePointsPerBus);
+   static void mh_SearchBuses(const std::map<uint32_t, std::vector<C_OscRoutingRoutePoint> > & orc_RoutePointsPerBus,
+                              const uint32_t ou32_StartBusIndex, const bool oq_AllowCanToEthernet,
+                              const uint32_t ou32_ExcludedNodeIndex, std::map<uint32_t, C_Bus> & orc_Buses);
+   static bool mh_FindRoute(const std::map<uint32_t, std::vector<C_OscRoutingRoutePoint> > & orc_RoutePointsPerBus,
+                            const std::map<uint32_t, C_Bus> & orc_Buses, const uint32_t ou32_StartBusIndex,
+                            const bool oq_AllowCanToEthernet, const C_OscNode & orc_TargetNode,
+                            const uint32_t ou32_TargetNodeIndex, const C_OscRoutingCalculation::E_Mode oe_Mode,
+                            std::vector<C_OscRoutingRoutePoint> & orc_RoutePoints);
+   static bool mh_GetBestTargetRoute(const C_OscNode & orc_TargetNode, const uint32_t ou32_TargetNodeIndex,
+                                     const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                     const std::map<uint32_t, C_Bus> & orc_Buses, bool & orq_TargetUsedAsRouter,
+                                     std::vector<C_OscRoutingRoutePoint> & orc_RoutePoints);
+   static int32_t mh_CheckTargetNodeConfig(const C_OscNode & orc_TargetNode,
+                                           const C_OscRoutingCalculation::E_Mode oe_Mode);
+   static void mh_GetCacheKey(const std::vector<C_OscNode> & orc_AllNodes,
+                              const std::vector<uint8_t> & orc_ActiveNodes, const uint32_t ou32_StartBusIndex,
+                              const C_OscRoutingCalculation::E_Mode oe_Mode, std::vector<uint32_t> & orc_Key);
+   stw::scl::C_SclString m_GetSummary(void) const;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
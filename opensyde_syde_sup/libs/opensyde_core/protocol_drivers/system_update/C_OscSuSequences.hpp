@@ -17,6 +17,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "stwtypes.hpp"
 #include "C_SclString.hpp"
+#include "TglTasks.hpp"
 #include "C_OscSystemDefinition.hpp"
 #include "C_OscComFlashloaderInformation.hpp"
 #include "C_OscComSequencesBase.hpp"
@@ -258,6 +259,8 @@ public:
                         const std::vector<uint32_t> & orc_NodesOrder);
    int32_t ResetSystem(void);
 
+   void SetXflMaxParallelSessions(const uint32_t ou32_MaxSessions);
+
    virtual int32_t GetConnectStates(std::vector<C_OscSuSequencesNodeConnectStates> & orc_ConnectStatesNodes)
    const;
    virtual int32_t GetUpdateStates(std::vector<C_OscSuSequencesNodeUpdateStates> & orc_UpdateStatesNodes)
@@ -297,7 +300,34 @@ private:
    //not implemented -> prevent assignment
    C_OscSuSequences & operator = (const C_OscSuSequences & orc_Source); //lint !e1511 //we want to hide the base func.
 
+   ///Flashing of one STW Flashloader node (see m_FlashNodesXflParallel)
+   class C_XflSession
+   {
+   public:
+      C_XflSession(C_OscSuSequences & orc_Sequences, const uint32_t ou32_NodeIndex,
+                   const C_OscProtocolDriverOsyNode & orc_ServerId,
+                   const std::vector<stw::scl::C_SclString> & orc_FilesToFlash,
+                   std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & orc_StateHexFiles);
+
+      C_OscSuSequences & rc_Sequences;
+      const uint32_t u32_NodeIndex; ///< index of node within System Definition
+      const C_OscProtocolDriverOsyNode c_ServerId;
+      const std::vector<stw::scl::C_SclString> & rc_FilesToFlash;
+      std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & rc_StateHexFiles;
+      uint32_t u32_CurrentFile;
+      int32_t s32_Result;
+      stw::tgl::C_TglThread c_Thread; ///< only used if the node is flashed in parallel to others
+
+   private:
+      //not implemented -> prevent copying
+      C_XflSession(const C_XflSession & orc_Source);
+      //not implemented -> prevent assignment
+      C_XflSession & operator = (const C_XflSession & orc_Source);
+   };
+
    C_OscProtocolDriverOsyNode mc_CurrentNode; //node we currently deal with
+   uint32_t mu32_XflMaxParallelSessions;
+   stw::tgl::C_TglCriticalSection mc_XflReportCriticalSection; ///< serializes reports of parallel XFL sessions
 
    std::vector<C_OscSuSequencesNodeConnectStates> mc_ConnectStatesNodes;
    std::vector<C_OscSuSequencesNodeUpdateStates> mc_UpdateStatesNodes;
@@ -336,8 +366,21 @@ private:
 
    int32_t m_WriteFingerPrintOsy(void);
 
-   int32_t m_FlashNodeXfl(const std::vector<stw::scl::C_SclString> & orc_FilesToFlash,
-                          std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & orc_StateHexFiles);
+   int32_t m_FlashNodeXfl(C_XflSession & orc_Session);
+   void m_GetXflSessionNodes(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
+                             const std::vector<uint32_t> & orc_NodesOrder, const uint32_t ou32_FirstPosition,
+                             std::vector<uint32_t> & orc_NodeIndexes,
+                             std::vector<C_OscProtocolDriverOsyNode> & orc_ServerIds);
+   int32_t m_FlashNodesXflParallel(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
+                                   const std::vector<uint32_t> & orc_NodeIndexes,
+                                   const std::vector<C_OscProtocolDriverOsyNode> & orc_ServerIds);
+   void m_SetNodeUpdateErrorState(const uint32_t ou32_NodeIndex, const int32_t os32_Result);
+   bool m_ReportXflSessionProgress(const E_ProgressStep oe_Step, const int32_t os32_Result, const uint8_t ou8_Progress,
+                                   const C_OscProtocolDriverOsyNode & orc_Server,
+                                   const stw::scl::C_SclString & orc_Information);
+   static void mh_XflSessionThread(void * const opv_Session);
+   static int32_t mh_XflSessionReportProgress(void * const opv_Session, const uint8_t ou8_Progress,
+                                              const stw::scl::C_SclString & orc_Text);
 
    int32_t m_ReadDeviceInformationOpenSyde(const uint8_t ou8_ProgressToReport, const uint32_t ou32_NodeIndex,
                                            C_OscSuSequencesNodeConnectStates & orc_NodeState);
@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Compact read-only XML element table (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCXMLCOMPACTTREE_HPP
+#define C_OSCXMLCOMPACTTREE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+#include <string>
+#include <vector>
+#include "stwtypes.hpp"
+#include "C_OscXmlName.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Read-only XML element table filled by the pull parser
+class C_OscXmlCompactTree
+{
+public:
+   static const uint32_t hu32_INVALID_INDEX; ///< "no element"
+
+   C_OscXmlCompactTree(void);
+
+   void Clear(void);
+   int32_t Parse(const char_t * const opcn_Data, const uint32_t ou32_Size);
+
+   uint32_t GetRootElement(void) const;
+   uint32_t GetParentElement(const uint32_t ou32_Element) const;
+   uint32_t GetFirstChildElement(const uint32_t ou32_Element) const;
+   uint32_t GetFirstChildElement(const uint32_t ou32_Element, const C_OscXmlName & orc_Name) const;
+   uint32_t GetNextSiblingElement(const uint32_t ou32_Element) const;
+   uint32_t GetNextSiblingElement(const uint32_t ou32_Element, const C_OscXmlName & orc_Name) const;
+
+   const char_t * GetName(const uint32_t ou32_Element) const;
+   const char_t * GetText(const uint32_t ou32_Element) const;
+   uint32_t GetLineNumber(const uint32_t ou32_Element) const;
+   uint32_t GetNumAttributes(const uint32_t ou32_Element) const;
+   const char_t * GetAttributeName(const uint32_t ou32_Element, const uint32_t ou32_Index) const;
+   const char_t * GetAttributeValue(const uint32_t ou32_Element, const uint32_t ou32_Index) const;
+   const char_t * GetAttribute(const uint32_t ou32_Element, const C_OscXmlName & orc_Name) const;
+
+private:
+   ///one element
+   class C_Element
+   {
+   public:
+      const char_t * pcn_Name;     ///< interned name (see C_OscXmlName)
+      uint32_t u32_Parent;         ///< hu32_INVALID_INDEX for elements at document level
+      uint32_t u32_FirstChild;     ///< hu32_INVALID_INDEX if there are no child elements
+      uint32_t u32_NextSibling;    ///< hu32_INVALID_INDEX if this is the last element on its level
+      uint32_t u32_FirstAttribute; ///< index in mc_Attributes
+      uint32_t u32_NumAttributes;  ///< number of attributes in mc_Attributes
+      uint32_t u32_TextOffset;     ///< offset of text in mc_Strings; hu32_INVALID_INDEX if there is no text
+      uint32_t u32_LineNumber;     ///< line of start tag in file
+   };
+
+   ///one attribute
+   class C_Attribute
+   {
+   public:
+      const char_t * pcn_Name;  ///< interned name (see C_OscXmlName)
+      uint32_t u32_ValueOffset; ///< offset of zero terminated value in mc_Strings
+   };
+
+   std::vector<C_Element> mc_Elements;
+   std::vector<C_Attribute> mc_Attributes;
+   std::vector<char_t> mc_Strings; ///< zero terminated texts and attribute values
+
+   static const char_t * mh_GetName(const std::string & orc_Name,
+                                    std::map<std::string, const char_t *> & orc_KnownNames);
+   uint32_t m_AddString(const std::string & orc_String);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
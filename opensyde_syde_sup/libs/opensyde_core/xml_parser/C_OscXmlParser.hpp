@@ -20,6 +20,8 @@
 #include "tinyxml2.h"
 #include "stwtypes.hpp"
 #include "C_SclString.hpp"
+#include "C_OscXmlCompactTree.hpp"
+#include "C_OscXmlName.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 
@@ -50,10 +52,30 @@ private:
 
    tinyxml2::XMLElement * mpc_CurrentNode;
 
+   //read-only mode: document is held in a compact element table instead of the tinyxml2 DOM
+   C_OscXmlCompactTree mc_CompactTree;
+   bool mq_ReadOnly;
+   uint32_t mu32_CurrentCompactNode;
+
+   const char_t * m_GetAttributeValue(const stw::scl::C_SclString & orc_Name) const;
+   tinyxml2::XMLElement * m_GetParentForChildSelection(void);
+   uint32_t m_GetCompactParentForChildSelection(void) const;
+
+   static int32_t mh_ToSint32(const char_t * const opcn_Text, const int32_t os32_Default);
+   static uint32_t mh_ToUint32(const char_t * const opcn_Text, const uint32_t ou32_Default);
+   static int64_t mh_ToSint64(const char_t * const opcn_Text, const int64_t os64_Default);
+   static uint64_t mh_ToUint64(const char_t * const opcn_Text, const uint64_t ou64_Default);
+   static bool mh_ToBool(const char_t * const opcn_Text, const bool oq_Default);
+   static float32_t mh_ToFloat32(const char_t * const opcn_Text, const float32_t of32_Default);
+   static float64_t mh_ToFloat64(const char_t * const opcn_Text, const float64_t of64_Default);
+
 protected:
    tinyxml2::XMLDocument mc_Document;
 
    void m_Init(void);
+   int32_t m_LoadReadOnly(const char_t * const opcn_Data, const uint32_t ou32_Size);
+   void m_ResetReadOnly(void);
+   bool m_IsReadOnly(void) const;
 
 public:
    // set up class
@@ -112,6 +134,24 @@ public:
    float32_t GetAttributeFloat32(const stw::scl::C_SclString & orc_Name, const float32_t of32_Default = 0.0F) const;
    float64_t GetAttributeFloat64(const stw::scl::C_SclString & orc_Name, const float64_t of64_Default = 0.0) const;
 
+   // non-allocating variants: names are passed as precomputed handles (typically static constants of the caller),
+   // results as plain text valid until the document is modified or reloaded
+   bool SelectNodeNext(const C_OscXmlName & orc_Name);
+   bool SelectNodeChild(const C_OscXmlName & orc_Name);
+   bool SelectNodeParentRaw(void);
+   const char_t * GetCurrentNodeNameRaw(void) const;
+   bool IsCurrentNode(const C_OscXmlName & orc_Name) const;
+   const char_t * GetNodeContentRaw(void) const;
+   bool AttributeExists(const C_OscXmlName & orc_Name) const;
+   const char_t * GetAttributeRaw(const C_OscXmlName & orc_Name) const;
+   int32_t GetAttributeSint32(const C_OscXmlName & orc_Name, const int32_t os32_Default = 0L) const;
+   uint32_t GetAttributeUint32(const C_OscXmlName & orc_Name, const uint32_t ou32_Default = 0UL) const;
+   int64_t GetAttributeSint64(const C_OscXmlName & orc_Name, const int64_t os64_Default = 0LL) const;
+   uint64_t GetAttributeUint64(const C_OscXmlName & orc_Name, const uint64_t ou64_Default = 0ULL) const;
+   bool GetAttributeBool(const C_OscXmlName & orc_Name, const bool oq_Default = false) const;
+   float32_t GetAttributeFloat32(const C_OscXmlName & orc_Name, const float32_t of32_Default = 0.0F) const;
+   float64_t GetAttributeFloat64(const C_OscXmlName & orc_Name, const float64_t of64_Default = 0.0) const;
+
    // get attribute values (includes error check)
    virtual int32_t GetAttributeStringError(const stw::scl::C_SclString & orc_Name,
                                            stw::scl::C_SclString & orc_Value) const;
@@ -158,6 +198,8 @@ public:
 
    // open xml file; create XML declaration
    virtual int32_t LoadFromFile(const stw::scl::C_SclString & orc_FileName);
+   // open xml file for reading only; uses far less memory than LoadFromFile; modifying functions have no effect
+   int32_t LoadFromFileReadOnly(const stw::scl::C_SclString & orc_FileName);
    virtual int32_t SaveToFile(const stw::scl::C_SclString & orc_FileName);
 
    // parse xml string; create XML declaration
@@ -25,12 +25,14 @@
 #include "C_OscSupServiceUpdatePackageV1.hpp"
 #include "C_OscSupServiceUpdatePackageLoad.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "TglTime.hpp"
 #include "TglFile.hpp"
 #include "C_SupSuSequences.hpp"
 #include "C_SupCreatePackage.hpp"
 #include "C_OscUtilBinaryHash.hpp"
 #include "C_OscHexFile.hpp"
+#include "C_OscHexImageCache.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
@@ -60,6 +62,7 @@ C_SydeSup::C_SydeSup(void) :
    mpc_EthDispatcher(NULL),
    mq_Quiet(false),
    mq_OnlyNecessaryFiles(false),
+   mu32_XflSessions(1U),
    me_OperationMode(eMODE_UPDATE),
    mc_OperationMode(""),
    mc_SupFilePath(""),
@@ -70,7 +73,8 @@ C_SydeSup::C_SydeSup(void) :
    mc_CertFolderPath(""),
    mc_OsyProjectPath(""),
    mc_ViewName(""),
-   mc_DeviceDefPath("")
+   mc_DeviceDefPath(""),
+   mc_TraceFilePath("")
 
 {
 }
@@ -108,6 +112,8 @@ C_SydeSup::~C_SydeSup(void)
    * -k for PEM file
    * -x for password
    * -c for certificate files
+   * -t for trace file path (optional)
+   * -f for number of STW Flashloader nodes to flash in parallel (optional)
 
    \param[in]  os32_Argc   number of command line arguments
    \param[in]  oppcn_Argv  command line arguments
@@ -181,6 +187,15 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
       {
          "password",          required_argument,   NULL,    'x'
       },
+      {
+         "tracefile",         required_argument,   NULL,    't'
+      },
+      {
+         "xflsessions",       required_argument,   NULL,    'f'
+      },
+      {
+         "hexcachedir",       required_argument,   NULL,    'e'
+      },
       {
          NULL,                0,                   NULL,    0
       }
@@ -189,7 +204,7 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
    do
    {
       int32_t s32_Index;
-      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hmvqnp:o:i:z:l:c:s:w:d:k:x:", &ac_Options[0], &s32_Index);
+      s32_Result = getopt_long(os32_Argc, oppcn_Argv, "hmvqnp:o:i:z:l:c:s:w:d:k:x:t:f:e:", &ac_Options[0], &s32_Index);
       if (s32_Result != -1)
       {
          switch (s32_Result)
@@ -243,6 +258,26 @@ C_SydeSup::E_Result C_SydeSup::ParseCommandLine(const int32_t os32_Argc, char_t
          case 'x':
             mc_Password = optarg;
             break;
+         case 't':
+            mc_TraceFilePath = optarg;
+            C_OscTraceHandler::h_SetActive(true);
+            break;
+         case 'f':
+            {
+               const int32_t s32_Sessions = C_SclString(optarg).ToIntDef(0);
+               if (s32_Sessions > 0)
+               {
+                  mu32_XflSessions = static_cast<uint32_t>(s32_Sessions);
+               }
+               else
+               {
+                  q_ParseError = true;
+               }
+            }
+            break;
+         case 'e':
+            C_OscHexImageCache::h_SetDiskCacheDirectory(optarg);
+            break;
          case '?': //parser reports error (missing parameter option)
             q_ParseError = true;
             break;
@@ -358,6 +393,15 @@ C_SydeSup::E_Result C_SydeSup::SelectModeAndStart(void)
       e_Result = this->Update();
    }
 
+   if (mc_TraceFilePath != "")
+   {
+      if (C_OscTraceHandler::h_ExportChromeTrace(mc_TraceFilePath) == C_NO_ERR)
+      {
+         h_WriteLog("Trace", "Trace of " + C_SclString::IntToStr(C_OscTraceHandler::h_GetNumEvents()) +
+                    " events written to: " + mc_TraceFilePath, false, mq_Quiet);
+      }
+   }
+
    return e_Result;
 }
 
@@ -611,6 +655,7 @@ C_SydeSup::E_Result C_SydeSup::Update(void)
                                       mpc_EthDispatcher, &this->mc_PemDatabase);
          // tell report methods to not print to console
          c_Sequence.SetQuiet(mq_Quiet);
+         c_Sequence.SetXflMaxParallelSessions(mu32_XflSessions);
       }
    }
 
@@ -925,7 +970,9 @@ void C_SydeSup::m_PrintInformation(const bool oq_Detailed) const
                      (this->m_GetDefaultLogLocation().Length() < 16) ?
                      (16 - this->m_GetDefaultLogLocation().Length()) : 0), ' ') <<
       "-l ." << c_PathDelimiter.c_str() << "MyLogDir\n"
-      "-o     --operationmode     Set mode: \"update\" or \"createpackage\"           update          -o createpackage\n\n"
+      "-o     --operationmode     Set mode: \"update\" or \"createpackage\"           update          -o createpackage\n"
+      "-t     --tracefile         Write timing trace (Chrome trace JSON format)   <none>          -t ." <<
+      c_PathDelimiter.c_str() << "trace.json\n\n"
       "Package Creation\n"
       "---------------------\n"
       "-s     --opensydeproject   Path to openSYDE project file (SYDE file)       <none>          -s ." <<
@@ -949,7 +996,12 @@ void C_SydeSup::m_PrintInformation(const bool oq_Detailed) const
       "-i     --caninterface      CAN interface                                   <none>          " <<
       this->m_GetCanInterfaceUsageExample().c_str() << "\n"
       "-z     --unzipdir          Existing directory for temporary files          <packagefile>   -z "  <<
-      this->m_GetUnzipLocationDefaultExample().c_str() << "\n\n"
+      this->m_GetUnzipLocationDefaultExample().c_str() << "\n"
+      "-f     --xflsessions       Number of STW Flashloader nodes on the local    1               -f 6\n"
+      "                           bus to flash in parallel\n"
+      "-e     --hexcachedir       Directory for caching parsed HEX files across   <none>          -e ." <<
+      c_PathDelimiter.c_str() << "MyHexCache\n"
+      "                           runs (created if it does not exist)\n\n"
       "In update mode the package file parameter \"-p\" is mandatory, all others are optional.\n"
       "If the active bus in the given Service Update Package is of CAN type, a CAN interface must be provided.\n\n"
       "Secure Authentication\n"
@@ -1446,7 +1498,8 @@ int32_t C_SydeSup::m_UpdateSystem(C_SupSuSequences & orc_Sequence, const C_OscSy
 
                   C_OscHexFile c_HexFile;
 
-                  const uint32_t u32_Result = c_HexFile.LoadFromFile(c_Path.c_str());
+                  //parsed image will be re-used when the file is flashed
+                  const uint32_t u32_Result = C_OscHexImageCache::h_LoadHexFile(c_Path, c_HexFile);
                   if (u32_Result == stw::hex_file::NO_ERR)
                   {
                      stw::diag_lib::C_XFLECUInformation c_FileApplicationInfo;
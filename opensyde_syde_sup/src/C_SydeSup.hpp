@@ -115,6 +115,7 @@ protected:
    stw::opensyde_core::C_OscIpDispatcher * mpc_EthDispatcher;
    bool mq_Quiet;
    bool mq_OnlyNecessaryFiles;
+   uint32_t mu32_XflSessions; //maximum number of STW Flashloader nodes to flash in parallel
    E_OperationMode me_OperationMode;
    stw::scl::C_SclString mc_OperationMode;
    stw::scl::C_SclString mc_SupFilePath;
@@ -128,6 +129,7 @@ protected:
    stw::scl::C_SclString mc_DeviceDefPath;
    stw::scl::C_SclString mc_PubKeyPemPath; //path to pem file with public key in case of secure update package
    stw::scl::C_SclString mc_Password; //optional password if the secure update package is also encrypted
+   stw::scl::C_SclString mc_TraceFilePath; //optional path for timing trace output
 
    C_SydeSup::E_Result m_InitOptionalParameters(void);
 
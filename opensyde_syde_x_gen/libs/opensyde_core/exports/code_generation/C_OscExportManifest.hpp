@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Record of inputs and outputs of previous code generations (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCEXPORTMANIFEST_HPP
+#define C_OSCEXPORTMANIFEST_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "TglTasks.hpp"
+#include "C_OscNode.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OscExportManifest
+{
+public:
+   C_OscExportManifest(void);
+
+   int32_t LoadFromFile(const stw::scl::C_SclString & orc_FilePath);
+   int32_t SaveToFile(const stw::scl::C_SclString & orc_FilePath);
+
+   bool IsUpToDate(const stw::scl::C_SclString & orc_OutputPath, const stw::scl::C_SclString & orc_InputHash,
+                   std::vector<stw::scl::C_SclString> & orc_Files);
+   void SetOutputs(const stw::scl::C_SclString & orc_OutputPath, const stw::scl::C_SclString & orc_InputHash,
+                   const std::vector<stw::scl::C_SclString> & orc_Files);
+   void RemoveOutputs(const stw::scl::C_SclString & orc_OutputPath);
+
+   static stw::scl::C_SclString h_CalcInputHash(const C_OscNode & orc_Node, const uint16_t ou16_ApplicationIndex,
+                                                const stw::scl::C_SclString & orc_GeneratorVersion);
+
+private:
+   ///Outputs of the code generation for one application
+   class C_Outputs
+   {
+   public:
+      C_Outputs(void);
+
+      stw::scl::C_SclString c_InputHash;                ///< MD5 of inputs
+      std::vector<stw::scl::C_SclString> c_Files;
+      std::vector<stw::scl::C_SclString> c_FileHashes; ///< MD5 of file content; same order as c_Files
+   };
+
+   std::map<stw::scl::C_SclString, C_Outputs> mc_Outputs; ///< per output path
+   stw::tgl::C_TglCriticalSection mc_CriticalSection;
+
+   static const uint32_t mhu32_FORMAT_VERSION;
+
+   static int32_t mh_CalcFileHash(const stw::scl::C_SclString & orc_FilePath, stw::scl::C_SclString & orc_Hash);
+
+   //Avoid call
+   C_OscExportManifest(const C_OscExportManifest &);
+   C_OscExportManifest & operator =(const C_OscExportManifest &);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
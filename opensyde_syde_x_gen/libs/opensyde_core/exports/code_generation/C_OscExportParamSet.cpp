@@ -360,6 +360,9 @@ int32_t C_OscExportParamSet::mh_FillRawEntries(const C_OscNodeDataPool & orc_SdD
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get file info for parameter set image file
 
+   Contains the current date, time and user. So the image file is different with each generation run, even with
+   unchanged parameters (incremental code generation only skips applications that did not change at all).
+
    \param[in]  orc_ExportToolName      Name of calling executable
    \param[in]  orc_ExportToolVersion   Version of calling executable
 
@@ -49,6 +49,10 @@ public:
    static stw::scl::C_SclString h_FloatToStrGe(const float64_t of64_Value, bool * const opq_InfOrNan = NULL);
    static bool h_CheckInfOrNan(const stw::scl::C_SclString & orc_String);
    static void h_AddDecimalPointIfNone(stw::scl::C_SclString & orc_FloatString);
+
+private:
+   static bool mh_IsFileContentEqual(const stw::scl::C_SclString & orc_PathAndFilename,
+                                     const stw::scl::C_SclString & orc_Content);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
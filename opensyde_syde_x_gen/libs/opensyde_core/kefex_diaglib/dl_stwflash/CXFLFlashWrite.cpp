@@ -111,15 +111,13 @@ void C_XFLFlashWrite::m_FlashingFinished(const E_XFLFlashFinishedAction oe_Actio
       NodeSleep();
       break;
    case eXFL_FLASH_FINISHED_ACTION_NET_START:
-      NodeSleep(); //make sure CRC over CRCs is written !!
-      TglSleep(50U);
+      m_SleepBeforeNetCommand(); //make sure CRC over CRCs is written !!
       NetStart();
       //wait for request to be sent out for sure (there's no response ...)
       TglSleep(50U);
       break;
    case eXFL_FLASH_FINISHED_ACTION_NET_RESET:
-      NodeSleep(); //make sure CRC over CRCs is written !!
-      TglSleep(50U);
+      m_SleepBeforeNetCommand(); //make sure CRC over CRCs is written !!
       NetReset();
       //wait for request to be sent out for sure (there's no response ...)
       TglSleep(50U);
@@ -133,6 +131,21 @@ void C_XFLFlashWrite::m_FlashingFinished(const E_XFLFlashFinishedAction oe_Actio
    this->TRG_ReportStatus(TGL_LoadStr(STR_FM_FINISHED), gu8_DL_REPORT_STATUS_TYPE_INFORMATION);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   send node to sleep before sending a network wide command
+
+   The server confirms node_sleep after it has written the CRC over CRCs.
+   Only if there is no confirmation (e.g. ancient implementations) give it some time to finish.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_XFLFlashWrite::m_SleepBeforeNetCommand(void)
+{
+   if (NodeSleep() != C_NO_ERR)
+   {
+      TglSleep(50U);
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //opq_SectorBasedCRCsSupported -> For servers below protocol V3.00r0 we have to
 //                                detect whether they support checksums hard-coded
@@ -7,6 +7,7 @@
    - file timestamps
    - file size
    - file exists
+   - read-only memory mapping of files
 
    \copyright   Copyright 2009 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
@@ -36,6 +37,30 @@ public:
    //for now we only need the name ...
 };
 
+///Read-only memory mapping of a complete file
+class C_TglFileMapping
+{
+private:
+   //this class can not be copied:
+   C_TglFileMapping(const C_TglFileMapping & orc_Source);
+   C_TglFileMapping & operator = (const C_TglFileMapping & orc_Source);
+
+   const uint8_t * mpu8_Data; ///< start of mapped file content (NULL if nothing mapped)
+   uint32_t mu32_Size;        ///< size of mapped file content in bytes
+   void * mpv_File;           ///< handle of opened file (HANDLE; kept opaque to keep windows.h out of here)
+   void * mpv_Mapping;        ///< handle of file mapping object (HANDLE)
+
+public:
+   C_TglFileMapping(void);
+   ~C_TglFileMapping(void);
+
+   int32_t Map(const stw::scl::C_SclString & orc_FileName);
+   void Unmap(void);
+
+   const uint8_t * GetData(void) const;
+   uint32_t GetSize(void) const;
+};
+
 bool TglFileAgeString(const stw::scl::C_SclString & orc_FileName, stw::scl::C_SclString & orc_String);
 int32_t TglFileSize(const stw::scl::C_SclString & orc_FileName);
 bool TglDirectoryExists(const stw::scl::C_SclString & orc_Path);
@@ -57,6 +82,7 @@ bool TglIsRelativePath(const stw::scl::C_SclString & orc_Path);
 
 int32_t TglCreateDirectory(const stw::scl::C_SclString & orc_Directory);
 int32_t TglRemoveDirectory(const stw::scl::C_SclString & orc_Directory, const bool oq_ContentOnly);
+int32_t TglRenameFile(const stw::scl::C_SclString & orc_OldName, const stw::scl::C_SclString & orc_NewName);
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
 }
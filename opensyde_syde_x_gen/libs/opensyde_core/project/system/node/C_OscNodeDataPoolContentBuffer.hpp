@@ -0,0 +1,53 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Raw value storage of a data pool content (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCNODEDATAPOOLCONTENTBUFFER_HPP
+#define C_OSCNODEDATAPOOLCONTENTBUFFER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Byte storage with inline space for scalars and short arrays
+class C_OscNodeDataPoolContentBuffer
+{
+public:
+   C_OscNodeDataPoolContentBuffer(void);
+   C_OscNodeDataPoolContentBuffer(const C_OscNodeDataPoolContentBuffer & orc_Source);
+   C_OscNodeDataPoolContentBuffer & operator = (const C_OscNodeDataPoolContentBuffer & orc_Source);
+   ~C_OscNodeDataPoolContentBuffer(void);
+
+   void Resize(const uint32_t ou32_Size);
+   uint32_t GetSize(void) const;
+   uint8_t * GetData(void);
+   const uint8_t * GetData(void) const;
+
+   static const uint32_t hu32_INLINE_SIZE = 16U; ///< number of bytes stored without heap allocation
+
+private:
+   uint8_t * mpu8_Heap;                   ///< heap storage; NULL while the inline storage is used
+   uint32_t mu32_Capacity;                ///< number of bytes available in the active storage
+   uint32_t mu32_Size;                    ///< number of bytes in use
+   uint8_t mau8_Inline[hu32_INLINE_SIZE]; ///< inline storage
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
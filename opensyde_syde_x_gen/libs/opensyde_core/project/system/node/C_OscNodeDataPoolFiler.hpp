@@ -89,6 +89,29 @@ public:
                                                   stw::scl::C_SclString * const opc_CheckDataTypeErrorDetails = NULL);
 
 private:
+   //precomputed names of the nodes and attributes read for every data element
+   static const C_OscXmlName mhc_ATTR_VALUE;
+   static const C_OscXmlName mhc_ATTR_FACTOR;
+   static const C_OscXmlName mhc_ATTR_OFFSET;
+   static const C_OscXmlName mhc_ATTR_INTERPRET_AS_STRING;
+   static const C_OscXmlName mhc_ATTR_DIAG_EVENT_CALL;
+   static const C_OscXmlName mhc_ATTR_NVM_START_ADDRESS;
+   static const C_OscXmlName mhc_ATTR_LENGTH;
+   static const C_OscXmlName mhc_ATTR_IS_ARRAY;
+   static const C_OscXmlName mhc_ATTR_ARRAY_SIZE;
+   static const C_OscXmlName mhc_NODE_ELEMENT;
+   static const C_OscXmlName mhc_NODE_DATA_ELEMENT;
+   static const C_OscXmlName mhc_NODE_DATA_ELEMENTS;
+   static const C_OscXmlName mhc_NODE_DATA_SET_VALUE;
+   static const C_OscXmlName mhc_NODE_DATA_SET_VALUES;
+   static const C_OscXmlName mhc_NODE_NAME;
+   static const C_OscXmlName mhc_NODE_MIN_VALUE;
+   static const C_OscXmlName mhc_NODE_MAX_VALUE;
+   static const C_OscXmlName mhc_NODE_COMMENT;
+   static const C_OscXmlName mhc_NODE_UNIT;
+   static const C_OscXmlName mhc_NODE_ACCESS;
+   static const C_OscXmlName mhc_NODE_TYPE;
+
    static stw::scl::C_SclString mh_NodeDataPoolContentToString(
       const C_OscNodeDataPoolContent::E_Type & ore_NodeDataPoolContent);
    static int32_t mh_StringToNodeDataPoolContent(const stw::scl::C_SclString & orc_String,
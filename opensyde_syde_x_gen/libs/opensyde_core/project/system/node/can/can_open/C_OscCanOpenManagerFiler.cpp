@@ -22,6 +22,7 @@
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscNodeDataPoolFiler.hpp"
 #include "C_OscCanOpenManagerFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::tgl;
@@ -68,6 +69,7 @@ C_OscCanOpenManagerFiler::C_OscCanOpenManagerFiler()
 int32_t C_OscCanOpenManagerFiler::h_LoadFile(std::map<uint8_t, C_OscCanOpenManagerInfo> & orc_Config,
                                              const C_SclString & orc_Path, const C_SclString & orc_BasePath)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "CANopen manager file", orc_Path);
    int32_t s32_Retval = C_NO_ERR;
 
    if (TglFileExists(orc_Path) == true)
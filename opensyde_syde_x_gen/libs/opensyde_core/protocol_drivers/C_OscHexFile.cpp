@@ -22,6 +22,26 @@ using namespace stw::opensyde_core;
 using namespace stw::scl;
 using namespace stw::diag_lib;
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscHexFileIndex::C_OscHexFileIndex(void) :
+   q_Valid(false),
+   s32_SignatureBlockResult(C_NOACT),
+   u32_SignatureBlockAddress(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscHexFile::C_OscHexFile(void) :
+   mu32_IndexDataGeneration(0U)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   get address of signature block from hex file
 
@@ -42,6 +62,32 @@ int32_t C_OscHexFile::GetSignatureBlockAddress(uint32_t & oru32_Address)
 {
    int32_t s32_Return;
 
+   if (this->m_IsIndexValid() == true)
+   {
+      oru32_Address = this->mc_Index.u32_SignatureBlockAddress;
+      s32_Return = this->mc_Index.s32_SignatureBlockResult;
+   }
+   else
+   {
+      s32_Return = this->m_SearchSignatureBlockAddress(oru32_Address);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   search signature block in hex file data
+
+   \param[out]     oru32_Address             address of signature block
+
+   \return
+   C_NO_ERR     everything OK; block found
+   C_NOACT      no block found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscHexFile::m_SearchSignatureBlockAddress(uint32_t & oru32_Address)
+{
+   int32_t s32_Return;
+
    oru32_Address = this->mu32_MinAdr;
 
    //lint -e{926}
@@ -75,8 +121,9 @@ int32_t C_OscHexFile::ScanDeviceIdFromHexFile(C_SclString & orc_DeviceId)
    C_SclString c_DeviceId = "";
 
    C_SclDynamicArray<C_XFLECUInformation> c_InfoBlocks;
-   s32_Return = this->GetECUInformationBlocks(c_InfoBlocks, 0x0U, false, false, true);
-   if ((s32_Return == C_NO_ERR) && (c_InfoBlocks.GetLength() > 0))
+   this->m_GetApplicationInfoBlocks(c_InfoBlocks);
+   s32_Return = C_NO_ERR;
+   if (c_InfoBlocks.GetLength() > 0)
    {
       int32_t s32_Index;
       for (s32_Index = 0; s32_Index < c_InfoBlocks.GetLength(); s32_Index++)
@@ -136,8 +183,7 @@ int32_t C_OscHexFile::ScanApplicationInformationBlockFromHexFile(C_XFLECUInforma
    int32_t s32_Return;
 
    C_SclDynamicArray<C_XFLECUInformation> c_InfoBlocks;
-   s32_Return = this->GetECUInformationBlocks(c_InfoBlocks, 0x0U, false, false, true);
-   tgl_assert(s32_Return == C_NO_ERR); //no plausible reasons documented
+   this->m_GetApplicationInfoBlocks(c_InfoBlocks);
 
    if (c_InfoBlocks.GetLength() == 0)
    {
@@ -168,3 +214,90 @@ int32_t C_OscHexFile::ScanApplicationInformationBlockFromHexFile(C_XFLECUInforma
 
    return s32_Return;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create index for current data
+
+   Searches the signature block and all application information blocks ("Block0") in the data once.
+   Subsequent calls to GetSignatureBlockAddress(), ScanDeviceIdFromHexFile() and
+    ScanApplicationInformationBlockFromHexFile() will use the index instead of searching the data again.
+   The index is discarded as soon as the data is changed (via any function; see C_HexFile::GetDataGeneration()).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexFile::CreateIndex(void)
+{
+   C_OscHexFileIndex c_Index;
+
+   c_Index.s32_SignatureBlockResult = this->m_SearchSignatureBlockAddress(c_Index.u32_SignatureBlockAddress);
+   this->m_GetApplicationInfoBlocks(c_Index.c_ApplicationInfoBlocks);
+   c_Index.q_Valid = true;
+   this->mc_Index = c_Index;
+   this->mu32_IndexDataGeneration = this->GetDataGeneration();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set index for current data
+
+   Caller is responsible that the index really matches the data (e.g. both taken from the same cache entry).
+   The index is discarded as soon as the data is changed.
+
+   \param[in]  orc_Index   index to use
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexFile::SetIndex(const C_OscHexFileIndex & orc_Index)
+{
+   this->mc_Index = orc_Index;
+   this->mu32_IndexDataGeneration = this->GetDataGeneration();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get index of current data
+
+   \return
+   index (q_Valid is false if no index was created for the current data)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscHexFileIndex C_OscHexFile::GetIndex(void) const
+{
+   C_OscHexFileIndex c_Index;
+
+   if (this->m_IsIndexValid() == true)
+   {
+      c_Index = this->mc_Index;
+   }
+   return c_Index;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get all application information blocks
+
+   Taken from the index if available; otherwise the data is searched.
+
+   \param[out]  orc_InfoBlocks   application information blocks ("Block0" only)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscHexFile::m_GetApplicationInfoBlocks(C_SclDynamicArray<C_XFLECUInformation> & orc_InfoBlocks)
+{
+   if (this->m_IsIndexValid() == true)
+   {
+      orc_InfoBlocks = this->mc_Index.c_ApplicationInfoBlocks;
+   }
+   else
+   {
+      const int32_t s32_Return = this->GetECUInformationBlocks(orc_InfoBlocks, 0x0U, false, false, true);
+      tgl_assert(s32_Return == C_NO_ERR); //no plausible reasons documented
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether index was created for the current data
+
+   \return
+   true    index can be used
+   false   no index or data was changed after the index was created
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscHexFile::m_IsIndexValid(void) const
+{
+   return (this->mc_Index.q_Valid == true) && (this->mu32_IndexDataGeneration == this->GetDataGeneration());
+}
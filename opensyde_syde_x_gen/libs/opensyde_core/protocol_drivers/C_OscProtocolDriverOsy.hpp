@@ -269,6 +269,8 @@ public:
    void SetTimeoutPolling(const uint32_t ou32_TimeoutPollingMs);
    void ResetTimeoutPolling(void);
    void SetMaxServiceSize(const uint16_t ou16_MaxServiceSize);
+   uint32_t GetReadMemoryBlockSize(void) const;
+   uint32_t GetWriteMemoryBlockSize(void) const;
 
    void InitializeTunnelCanMessage(const PR_OsyTunnelCanMessageReceived opr_OsyTunnelCanMessageReceived,
                                    void * const opv_Instance);
@@ -21,6 +21,7 @@
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscProtocolDriverOsyTpBase.hpp"
 #include "C_OscUpdateUtil.hpp"
+#include "C_OscHexImageCache.hpp"
 #include "C_OscBuSequences.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
@@ -785,7 +786,7 @@ int32_t C_OscBuSequences::h_ReadHexFile(const C_SclString & orc_HexFilePath, C_O
    uint32_t u32_Return;
    const C_SclString c_LogActivity = "Read HEX File";
 
-   u32_Return = orc_HexFile.LoadFromFile(orc_HexFilePath.c_str());
+   u32_Return = C_OscHexImageCache::h_LoadHexFile(orc_HexFilePath, orc_HexFile);
    if (u32_Return != stw::hex_file::NO_ERR)
    {
       s32_Return = C_RD_WR;
@@ -220,6 +220,7 @@ void C_OscComMessageLogger::SetProtocol(const e_CanMonL7Protocols oe_Protocol)
    this->me_Protocol = oe_Protocol;
    this->mc_ProtocolHex.SetProtocolMode(oe_Protocol);
    this->mc_ProtocolDec.SetProtocolMode(oe_Protocol);
+   // Cached interpretations are stored per protocol and stay valid
 
    // Update the protocol names of all log files
    this->mc_ProtocolDec.GetProtocolName(this->me_Protocol, c_ProtocolName);
@@ -384,6 +385,7 @@ int32_t C_OscComMessageLogger::SetOsySysDefBus(const C_SclString & orc_PathSyste
           (c_ItSysDef->second.c_OsySysDef.c_Buses[ou32_BusIndex].e_Type == C_OscSystemBus::eCAN))
       {
          c_ItSysDef->second.u32_BusIndex = ou32_BusIndex;
+         this->mc_ProtocolCache.Clear();
          s32_Return = C_NO_ERR;
       }
       else
@@ -446,6 +448,7 @@ int32_t C_OscComMessageLogger::RemoveDatabase(const C_SclString & orc_Path)
    {
       this->mc_ProtocolDec.RemoveOsySysDef(&(c_ItSysDef->second));
       this->mc_ProtocolHex.RemoveOsySysDef(&(c_ItSysDef->second));
+      this->mc_ProtocolCache.Clear();
 
       // Remove the entry
       this->mc_OsySysDefs.erase(c_ItSysDef);
@@ -495,6 +498,7 @@ int32_t C_OscComMessageLogger::ActivateDatabase(const C_SclString & orc_Path, co
             this->mc_ProtocolDec.RemoveOsySysDef(&(c_ItSysDef->second));
             this->mc_ProtocolHex.RemoveOsySysDef(&(c_ItSysDef->second));
          }
+         this->mc_ProtocolCache.Clear();
       }
    }
 
@@ -690,15 +694,11 @@ int32_t C_OscComMessageLogger::HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg,
             if (this->m_CheckInterpretation(this->mc_HandledCanMessage) == false)
             {
                // No interpretation found, check for classical protocol interpretation
-               this->mc_HandledCanMessage.c_ProtocolTextHex = this->m_GetProtocolStringHex(orc_Msg).c_str();
-               if (this->mc_HandledCanMessage.c_ProtocolTextHex != "")
-               {
-                  // Only necessary if a protocol was found in the hex variant
-                  this->mc_HandledCanMessage.c_ProtocolTextDec = this->m_GetProtocolStringDec(orc_Msg).c_str();
-               }
+               this->m_GetProtocolStrings(orc_Msg, this->mc_HandledCanMessage.c_ProtocolTextHex,
+                                          this->mc_HandledCanMessage.c_ProtocolTextDec);
 
                // Message not found in any other place. Check and process for ECoS inverted message
-               else
+               if (this->mc_HandledCanMessage.c_ProtocolTextHex == "")
                {
                   this->m_HandleEcosInvertedMessage();
                }
@@ -918,6 +918,41 @@ C_SclString C_OscComMessageLogger::m_GetProtocolStringDec(const T_STWCAN_Msg_RX
    return c_Result;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Returns the CAN message as protocol specific interpreted strings with values as hex and decimal
+
+   Each message content is only interpreted once per protocol, repeated messages are taken from the cache.
+
+   \param[in]   orc_Msg       Current CAN message
+   \param[out]  orc_TextHex   CAN message converted to protocol string with values as hex
+                              Empty string if no protocol is configured or the message does not match the protocol
+   \param[out]  orc_TextDec   CAN message converted to protocol string with values as decimal
+                              Empty string if no protocol is configured or the message does not match the protocol
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLogger::m_GetProtocolStrings(const T_STWCAN_Msg_RX & orc_Msg, C_SclString & orc_TextHex,
+                                                 C_SclString & orc_TextDec) const
+{
+   C_OscComMessageLoggerProtocolText c_Text;
+
+   if (this->me_Protocol != stw::cmon_protocol::eCMON_L7_PROTOCOL_NONE)
+   {
+      if (this->mc_ProtocolCache.Get(this->me_Protocol, orc_Msg, c_Text) == false)
+      {
+         c_Text.c_TextHex = this->m_GetProtocolStringHex(orc_Msg);
+         if (c_Text.c_TextHex != "")
+         {
+            // Only necessary if a protocol was found in the hex variant
+            c_Text.c_TextDec = this->m_GetProtocolStringDec(orc_Msg);
+         }
+         this->mc_ProtocolCache.Add(this->me_Protocol, orc_Msg, c_Text);
+      }
+   }
+
+   orc_TextHex = c_Text.c_TextHex;
+   orc_TextDec = c_Text.c_TextDec;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Inserts openSYDE system definition to parsing configuration
 
@@ -945,6 +980,7 @@ void C_OscComMessageLogger::m_InsertOsySysDef(const C_SclString & orc_PathSystem
 
    this->mc_ProtocolDec.AddOsySysDef(&(c_ItNewConfig->second));
    this->mc_ProtocolHex.AddOsySysDef(&(c_ItNewConfig->second));
+   this->mc_ProtocolCache.Clear();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "C_OscSuSequences.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_SclString.hpp"
 #include "C_SclDateTime.hpp"
 #include "C_SclChecksums.hpp"
@@ -23,6 +24,7 @@
 #include "TglTime.hpp"
 #include "TglFile.hpp"
 #include "C_OscHexFile.hpp"
+#include "C_OscHexImageCache.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscUtils.hpp"
 #include "C_OscDataDealerNvmSafe.hpp"
@@ -81,6 +83,30 @@ bool C_OscSuSequences::C_DoFlash::IsAnyActionRequired() const
            (this->q_SendTrafficEncryptionEnabledState));
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor
+
+   \param[in]      orc_Sequences       Sequences the session belongs to
+   \param[in]      ou32_NodeIndex      Index of node within System Definition
+   \param[in]      orc_ServerId        Server ID of node
+   \param[in]      orc_FilesToFlash    Files to flash
+   \param[in,out]  orc_StateHexFiles   States of all handled hex files
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscSuSequences::C_XflSession::C_XflSession(C_OscSuSequences & orc_Sequences, const uint32_t ou32_NodeIndex,
+                                             const C_OscProtocolDriverOsyNode & orc_ServerId,
+                                             const std::vector<C_SclString> & orc_FilesToFlash,
+                                             std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & orc_StateHexFiles) :
+   rc_Sequences(orc_Sequences),
+   u32_NodeIndex(ou32_NodeIndex),
+   c_ServerId(orc_ServerId),
+   rc_FilesToFlash(orc_FilesToFlash),
+   rc_StateHexFiles(orc_StateHexFiles),
+   u32_CurrentFile(0U),
+   s32_Result(C_NO_ERR)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility: check whether node is an active node on a specific bus
 
@@ -321,6 +347,8 @@ int32_t C_OscSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SclString>
                                                  const uint32_t ou32_TransferDataTimeout, bool & orq_SetProgrammingMode,
                                                  std::vector<C_OscSuSequencesNodeHexFileStates> & orc_StateHexFiles)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Flash openSYDE HEX files",
+                                      this->mpc_SystemDefinition->c_Nodes[this->mu32_CurrentNode].c_Properties.c_Name);
    int32_t s32_Return = C_NO_ERR;
    uint32_t u32_Return;
 
@@ -339,7 +367,8 @@ int32_t C_OscSuSequences::m_FlashNodeOpenSydeHex(const std::vector<C_SclString>
    {
       (void)m_ReportProgress(eUPDATE_SYSTEM_OSY_NODE_HEX_OPEN_START, C_NO_ERR, 0U, mc_CurrentNode,
                              "Opening HEX file " + orc_FilesToFlash[u32_File] + ".");
-      u32_Return = c_Files[u32_File]->LoadFromFile(orc_FilesToFlash[u32_File].c_str());
+      //files were usually already checked (and parsed) before; so we will get them from the cache
+      u32_Return = C_OscHexImageCache::h_LoadHexFile(orc_FilesToFlash[u32_File], *c_Files[u32_File]);
       if (u32_Return != stw::hex_file::NO_ERR)
       {
          const C_SclString c_ErrorText = c_Files[u32_File]->ErrorCodeToErrorText(u32_Return);
@@ -858,6 +887,8 @@ int32_t C_OscSuSequences::m_FlashNodeOpenSydeFile(const std::vector<C_SclString>
                                                   bool & orq_SetProgrammingMode,
                                                   std::vector<C_OscSuSequencesNodeOtherFileStates> & orc_StateOtherFiles)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Write openSYDE files",
+                                      this->mpc_SystemDefinition->c_Nodes[this->mu32_CurrentNode].c_Properties.c_Name);
    int32_t s32_Return = C_NO_ERR;
 
    //start the actual transfers
@@ -1276,6 +1307,8 @@ int32_t C_OscSuSequences::m_WriteNvmOpenSyde(const std::vector<C_SclString> & or
                                              const bool oq_SetProgrammingMode,
                                              std::vector<C_OscSuSequencesNodePsiFileStates> & orc_StatePsiFiles)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Write parameter set files",
+                                      this->mpc_SystemDefinition->c_Nodes[this->mu32_CurrentNode].c_Properties.c_Name);
    int32_t s32_Return = C_NO_ERR;
 
    //Get pointer to OSY protocol driver provided by comm driver:
@@ -1477,6 +1510,8 @@ int32_t C_OscSuSequences::m_WritePemOpenSydeFile(const stw::scl::C_SclString & o
                                                  bool & orq_SetProgrammingMode,
                                                  C_OscSuSequencesNodeSecuritySettingsStates & orc_StateSecuritySettings)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Write PEM file",
+                                      this->mpc_SystemDefinition->c_Nodes[this->mu32_CurrentNode].c_Properties.c_Name);
    int32_t s32_Return;
 
    if (orc_FileToWrite != "")
@@ -1631,6 +1666,8 @@ int32_t C_OscSuSequences::m_WriteOpenSydeNodeStates(const C_OscSuSequences::C_Do
                                                     const C_OscProtocolDriverOsy::C_ListOfFeatures & orc_ProtocolFeatures, bool & orq_SetProgrammingMode,
                                                     C_OscSuSequencesNodeSecuritySettingsStates & orc_StateSecuritySettings)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Write node states",
+                                      this->mpc_SystemDefinition->c_Nodes[this->mu32_CurrentNode].c_Properties.c_Name);
    int32_t s32_Return = C_NO_ERR;
    const uint8_t u8_SECURITY_LEVEL = 1U;
 
@@ -1885,9 +1922,10 @@ int32_t C_OscSuSequences::m_WriteFingerPrintOsy(void)
 /*! \brief   Flash one STW Flashloader based node
 
    Flash one or more files.
+   Can be called from a different thread for each node (see m_FlashNodesXflParallel()).
+   So all reporting is done via m_ReportXflSessionProgress().
 
    Assumptions/prerequisites (not explicitly checked by this function):
-   * mc_CurrentNode contains ID of node to work with
    * server node must be in Flashloader mode
    * list of files must be > 0
    * files must be present and in Intel or Motorola hex format
@@ -1896,55 +1934,301 @@ int32_t C_OscSuSequences::m_WriteFingerPrintOsy(void)
    * Reports progress from 0..100 for the overall process
    * Reports 0..100 for each file being flashed
 
-   \param[in]     orc_FilesToFlash              Files to flash
-   \param[out]    orc_StateHexFiles             States of all handled hex files
+   \param[in,out]  orc_Session   Node and files to flash; states of all handled hex files and index of last file
 
    \return
    C_NO_ERR    flashed all files
    C_COM       error flashing (see log for details)
 */
 //----------------------------------------------------------------------------------------------------------------------
-int32_t C_OscSuSequences::m_FlashNodeXfl(const std::vector<C_SclString> & orc_FilesToFlash,
-                                         std::vector<C_OscSuSequencesNodeStwFlHexFileStates> & orc_StateHexFiles)
+int32_t C_OscSuSequences::m_FlashNodeXfl(C_XflSession & orc_Session)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Flash STW Flashloader HEX files",
+                                      this->mpc_SystemDefinition->c_Nodes[orc_Session.u32_NodeIndex].c_Properties.
+                                      c_Name);
    int32_t s32_Return = C_NO_ERR;
 
-   (void)m_ReportProgress(eUPDATE_SYSTEM_XFL_NODE_START, C_NO_ERR, 0U, mc_CurrentNode,
-                          "Flashing node ...");
+   (void)m_ReportXflSessionProgress(eUPDATE_SYSTEM_XFL_NODE_START, C_NO_ERR, 0U, orc_Session.c_ServerId,
+                                    "Flashing node ...");
 
-   for (uint32_t u32_File = 0U; u32_File < orc_FilesToFlash.size(); u32_File++)
+   for (uint32_t u32_File = 0U; u32_File < orc_Session.rc_FilesToFlash.size(); u32_File++)
    {
       // Save file index
-      this->mu32_CurrentFile = u32_File;
+      orc_Session.u32_CurrentFile = u32_File;
 
-      (void)m_ReportProgress(eUPDATE_SYSTEM_XFL_NODE_FLASH_HEX_START, C_NO_ERR, 0U, mc_CurrentNode,
-                             "Flashing HEX file ...");
+      (void)m_ReportXflSessionProgress(eUPDATE_SYSTEM_XFL_NODE_FLASH_HEX_START, C_NO_ERR, 0U,
+                                       orc_Session.c_ServerId, "Flashing HEX file ...");
 
       // Loading errors can not be detected on this layer separated from the sending process
-      orc_StateHexFiles[u32_File].e_FileLoaded = eSUSEQ_STATE_NOT_NEEDED;
+      orc_Session.rc_StateHexFiles[u32_File].e_FileLoaded = eSUSEQ_STATE_NOT_NEEDED;
 
-      s32_Return = this->mpc_ComDriver->SendStwDoFlash(mc_CurrentNode, orc_FilesToFlash[u32_File]);
+      s32_Return = this->mpc_ComDriver->SendStwDoFlash(orc_Session.c_ServerId, orc_Session.rc_FilesToFlash[u32_File],
+                                                       &C_OscSuSequences::mh_XflSessionReportProgress, &orc_Session);
       if (s32_Return != C_NO_ERR)
       {
-         (void)m_ReportProgress(eUPDATE_SYSTEM_XFL_NODE_FLASH_HEX_ERROR, C_NO_ERR, 100U, mc_CurrentNode,
-                                "Flashing HEX file finished.");
+         (void)m_ReportXflSessionProgress(eUPDATE_SYSTEM_XFL_NODE_FLASH_HEX_ERROR, C_NO_ERR, 100U,
+                                          orc_Session.c_ServerId, "Flashing HEX file finished.");
 
-         orc_StateHexFiles[u32_File].e_FileSent = eSUSEQ_STATE_ERROR;
+         orc_Session.rc_StateHexFiles[u32_File].e_FileSent = eSUSEQ_STATE_ERROR;
          s32_Return = C_COM;
          break;
       }
       else
       {
-         orc_StateHexFiles[u32_File].e_FileSent = eSUSEQ_STATE_NO_ERR;
+         orc_Session.rc_StateHexFiles[u32_File].e_FileSent = eSUSEQ_STATE_NO_ERR;
       }
 
-      (void)m_ReportProgress(eUPDATE_SYSTEM_XFL_NODE_FLASH_HEX_FINISHED, C_NO_ERR, 100U, mc_CurrentNode,
-                             "Flashing HEX file finished.");
+      (void)m_ReportXflSessionProgress(eUPDATE_SYSTEM_XFL_NODE_FLASH_HEX_FINISHED, C_NO_ERR, 100U,
+                                       orc_Session.c_ServerId, "Flashing HEX file finished.");
    }
    if (s32_Return == C_NO_ERR)
    {
-      (void)m_ReportProgress(eUPDATE_SYSTEM_XFL_NODE_FINISHED, C_NO_ERR, 100U, mc_CurrentNode,
-                             "Flashing node finished.");
+      (void)m_ReportXflSessionProgress(eUPDATE_SYSTEM_XFL_NODE_FINISHED, C_NO_ERR, 100U, orc_Session.c_ServerId,
+                                       "Flashing node finished.");
+   }
+   orc_Session.s32_Result = s32_Return;
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get STW Flashloader nodes which can be flashed in parallel
+
+   Starting at the specified position of the update order all directly following nodes are collected which
+   * are STW Flashloader nodes on the local bus (no routing required)
+   * only have files to flash (NVM and PEM files are not supported by the STW Flashloader)
+   The number of nodes is limited by mu32_XflMaxParallelSessions.
+
+   The relative update order to all other nodes is kept this way.
+   All STW Flashloader nodes on the local bus share the same CAN IDs and are addressed by their local ID,
+   so the protocol instances of the nodes can work at the same time.
+
+   \param[in]   orc_ApplicationsToWrite   list of files to flash per node
+   \param[in]   orc_NodesOrder            Vector with node update order (index is update position, value is node index)
+   \param[in]   ou32_FirstPosition        Position in update order to start with
+   \param[out]  orc_NodeIndexes           Indexes of found nodes in update order (empty if the node at
+                                          ou32_FirstPosition does not match)
+   \param[out]  orc_ServerIds             Server IDs of found nodes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::m_GetXflSessionNodes(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
+                                            const std::vector<uint32_t> & orc_NodesOrder,
+                                            const uint32_t ou32_FirstPosition, std::vector<uint32_t> & orc_NodeIndexes,
+                                            std::vector<C_OscProtocolDriverOsyNode> & orc_ServerIds)
+{
+   orc_NodeIndexes.clear();
+   orc_ServerIds.clear();
+
+   for (uint32_t u32_Position = ou32_FirstPosition;
+        (u32_Position < orc_NodesOrder.size()) && (orc_NodeIndexes.size() < this->mu32_XflMaxParallelSessions);
+        ++u32_Position)
+   {
+      const uint32_t u32_NodeIndex = orc_NodesOrder[u32_Position];
+      const C_DoFlash & rc_DoFlash = orc_ApplicationsToWrite[u32_NodeIndex];
+      C_OscNodeProperties::E_FlashLoaderProtocol e_ProtocolType;
+      C_OscProtocolDriverOsyNode c_ServerId;
+      uint32_t u32_BusIndex;
+      bool q_Match = false;
+
+      if ((rc_DoFlash.c_FilesToFlash.size() > 0) && (rc_DoFlash.c_FilesToWriteToNvm.size() == 0) &&
+          (rc_DoFlash.c_PemFile == "") &&
+          (this->mpc_ComDriver->GetBusIndexOfRoutingNode(u32_NodeIndex, u32_BusIndex) == C_NOACT))
+      {
+         q_Match = m_IsNodeActive(u32_NodeIndex, this->mu32_ActiveBusIndex, e_ProtocolType, c_ServerId);
+         q_Match = q_Match && (e_ProtocolType == C_OscNodeProperties::eFL_STW);
+      }
+
+      if (q_Match == false)
+      {
+         break;
+      }
+      orc_NodeIndexes.push_back(u32_NodeIndex);
+      orc_ServerIds.push_back(c_ServerId);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Flash several STW Flashloader nodes on the local bus at the same time
+
+   Each node is flashed by m_FlashNodeXfl() in its own thread.
+   The phases of the nodes overlap this way; especially the long sector erase of one node does not block the
+   other nodes any more.
+   If a thread can not be started the node is flashed in the calling thread.
+
+   In case of an error mu32_CurrentNode, mu32_CurrentFile and mc_CurrentNode are set to the first failed node in
+   update order. The update error states of all failed nodes are set (see m_SetNodeUpdateErrorState()).
+
+   \param[in]  orc_ApplicationsToWrite   list of files to flash per node
+   \param[in]  orc_NodeIndexes           Indexes of nodes to flash (see m_GetXflSessionNodes())
+   \param[in]  orc_ServerIds             Server IDs of nodes to flash
+
+   \return
+   C_NO_ERR    flashed all files of all nodes
+   C_COM       error flashing at least one node (see log for details)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuSequences::m_FlashNodesXflParallel(const std::vector<C_DoFlash> & orc_ApplicationsToWrite,
+                                                  const std::vector<uint32_t> & orc_NodeIndexes,
+                                                  const std::vector<C_OscProtocolDriverOsyNode> & orc_ServerIds)
+{
+   const C_OscTraceScope c_TraceScope("System update", "Flash STW Flashloader nodes in parallel",
+                                      C_SclString::IntToStr(orc_NodeIndexes.size()) + " nodes");
+   int32_t s32_Return = C_NO_ERR;
+   std::vector<C_XflSession *> c_Sessions;
+   uint32_t u32_Session;
+
+   tgl_assert(orc_NodeIndexes.size() == orc_ServerIds.size());
+
+   osc_write_log_info("System Update", "Flashing " + C_SclString::IntToStr(orc_NodeIndexes.size()) +
+                      " STW Flashloader nodes in parallel.");
+
+   c_Sessions.reserve(orc_NodeIndexes.size());
+   for (u32_Session = 0U; u32_Session < orc_NodeIndexes.size(); ++u32_Session)
+   {
+      const uint32_t u32_NodeIndex = orc_NodeIndexes[u32_Session];
+      C_XflSession * const pc_Session =
+         new C_XflSession(*this, u32_NodeIndex, orc_ServerIds[u32_Session],
+                          orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
+                          this->mc_UpdateStatesNodes[u32_NodeIndex].c_StateStwFlHexFiles);
+      c_Sessions.push_back(pc_Session);
+      if (pc_Session->c_Thread.Start(&C_OscSuSequences::mh_XflSessionThread, pc_Session) != C_NO_ERR)
+      {
+         osc_write_log_warning("System Update", "Could not start thread for STW Flashloader node " +
+                               C_SclString::IntToStr(u32_NodeIndex) + ". Flashing it in sequence.");
+         (void)m_FlashNodeXfl(*pc_Session);
+      }
+   }
+
+   for (u32_Session = 0U; u32_Session < c_Sessions.size(); ++u32_Session)
+   {
+      C_XflSession * const pc_Session = c_Sessions[u32_Session];
+      pc_Session->c_Thread.Join();
+      if (pc_Session->s32_Result != C_NO_ERR)
+      {
+         // All failed nodes get their error state, not only the reported one
+         m_SetNodeUpdateErrorState(pc_Session->u32_NodeIndex, pc_Session->s32_Result);
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = pc_Session->s32_Result;
+            this->mu32_CurrentNode = pc_Session->u32_NodeIndex;
+            this->mu32_CurrentFile = pc_Session->u32_CurrentFile;
+            this->mc_CurrentNode = pc_Session->c_ServerId;
+         }
+      }
+      delete pc_Session;
+   }
+
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set update error state of a failed node
+
+   \param[in]  ou32_NodeIndex   Index of failed node within System Definition
+   \param[in]  os32_Result      Error result of the node update
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::m_SetNodeUpdateErrorState(const uint32_t ou32_NodeIndex, const int32_t os32_Result)
+{
+   tgl_assert(ou32_NodeIndex < this->mc_UpdateStatesNodes.size());
+   if (ou32_NodeIndex < this->mc_UpdateStatesNodes.size())
+   {
+      C_OscSuSequencesNodeUpdateStates & rc_NodeUpdateStates = this->mc_UpdateStatesNodes[ou32_NodeIndex];
+
+      switch (os32_Result)
+      {
+      case C_TIMEOUT:
+         rc_NodeUpdateStates.q_Timeout = true;
+         break;
+      case C_CHECKSUM:
+         rc_NodeUpdateStates.q_SecurityAccessError = true;
+         break;
+      default:
+         // Nothing to do
+         break;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report progress of one STW Flashloader node
+
+   Reports can come from several threads at the same time (see m_FlashNodesXflParallel()).
+   They are passed to m_ReportProgress() one after the other.
+
+   \param[in]  oe_Step           Step of node update
+   \param[in]  os32_Result       Result of service
+   \param[in]  ou8_Progress      Progress of sequence in percentage; progress invalid: 255
+   \param[in]  orc_Server        Affected node
+   \param[in]  orc_Information   Additional text information
+
+   \return
+   Flag for aborting sequence
+   - true   abort sequence
+   - false  continue sequence
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscSuSequences::m_ReportXflSessionProgress(const E_ProgressStep oe_Step, const int32_t os32_Result,
+                                                  const uint8_t ou8_Progress,
+                                                  const C_OscProtocolDriverOsyNode & orc_Server,
+                                                  const C_SclString & orc_Information)
+{
+   bool q_Return;
+
+   this->mc_XflReportCriticalSection.Acquire();
+   q_Return = this->m_ReportProgress(oe_Step, os32_Result, ou8_Progress, orc_Server, orc_Information);
+   this->mc_XflReportCriticalSection.Release();
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Thread function of one STW Flashloader node flashed in parallel to others
+
+   \param[in,out]  opv_Session   Session of node (C_XflSession)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::mh_XflSessionThread(void * const opv_Session)
+{
+   //lint -e{9079}  This class is the only one which starts this thread function. It must match.
+   C_XflSession * const pc_Session = reinterpret_cast<C_XflSession *>(opv_Session);
+
+   tgl_assert(pc_Session != NULL);
+   if (pc_Session != NULL)
+   {
+      (void)pc_Session->rc_Sequences.m_FlashNodeXfl(*pc_Session);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   report progress of STW Flashloader driver for one node
+
+   Same as m_XflReportProgress() but reports for the node of the session instead of mc_CurrentNode.
+
+   \param[in]  opv_Session    Session of node (C_XflSession)
+   \param[in]  ou8_Progress   progress of operation (from 0 to 100); progress invalid: 255
+   \param[in]  orc_Text       textual information about progress
+
+   \return
+   C_NO_ERR    continue operation
+   else        abort operation (not honored at each position)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscSuSequences::mh_XflSessionReportProgress(void * const opv_Session, const uint8_t ou8_Progress,
+                                                      const C_SclString & orc_Text)
+{
+   int32_t s32_Return = C_NO_ERR;
+   //lint -e{9079}  This class is the only one which registers itself at the caller of this function. It must match.
+   C_XflSession * const pc_Session = reinterpret_cast<C_XflSession *>(opv_Session);
+
+   tgl_assert(pc_Session != NULL);
+   if (pc_Session != NULL)
+   {
+      const bool q_Return = pc_Session->rc_Sequences.m_ReportXflSessionProgress(eXFL_PROGRESS, C_NO_ERR,
+                                                                               ou8_Progress, pc_Session->c_ServerId,
+                                                                               orc_Text);
+      if (q_Return == true)
+      {
+         s32_Return = C_BUSY; //abort
+      }
    }
    return s32_Return;
 }
@@ -1969,6 +2253,8 @@ int32_t C_OscSuSequences::m_ReadDeviceInformationOpenSyde(const uint8_t ou8_Prog
                                                           const uint32_t ou32_NodeIndex,
                                                           C_OscSuSequencesNodeConnectStates & orc_NodeState)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Read openSYDE device information",
+                                      this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex].c_Properties.c_Name);
    C_OsyDeviceInformation c_Info;
    uint8_t u8_NrCode;
    int32_t s32_Return;
@@ -2160,6 +2446,8 @@ int32_t C_OscSuSequences::m_ReadDeviceInformationStwFlashloader(const uint8_t ou
                                                                 const uint32_t ou32_NodeIndex, C_OscSuSequencesNodeConnectStates &
                                                                 orc_NodeState)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Read STW Flashloader device information",
+                                      this->mpc_SystemDefinition->c_Nodes[ou32_NodeIndex].c_Properties.c_Name);
    int32_t s32_Return;
    C_XflDeviceInformation c_Information;
 
@@ -2211,7 +2499,8 @@ int32_t C_OscSuSequences::m_ReadDeviceInformationStwFlashloader(const uint8_t ou
 C_OscSuSequences::C_OscSuSequences(void) :
    C_OscComSequencesBase(true, true),
    mu32_CurrentNode(0U),
-   mu32_CurrentFile(0U)
+   mu32_CurrentFile(0U),
+   mu32_XflMaxParallelSessions(1U)
 {
 }
 
@@ -2225,6 +2514,22 @@ C_OscSuSequences::~C_OscSuSequences(void)
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set maximum number of STW Flashloader nodes to flash at the same time
+
+   UpdateSystem() flashes directly following STW Flashloader nodes on the local bus in parallel sessions,
+   so the long sector erase phases of the nodes overlap.
+   All nodes still receive the whole CAN traffic of the other sessions, so this should only be used if all nodes
+   can cope with it.
+
+   \param[in]  ou32_MaxSessions   Maximum number of nodes flashed in parallel (0 and 1: one node after the other)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscSuSequences::SetXflMaxParallelSessions(const uint32_t ou32_MaxSessions)
+{
+   this->mu32_XflMaxParallelSessions = ou32_MaxSessions;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Copy referenced files to a temporary folder
 
@@ -2273,6 +2578,7 @@ int32_t C_OscSuSequences::h_CreateTemporaryFolder(const std::vector<C_OscNode> &
                                                   std::vector<C_DoFlash> & orc_ApplicationsToWrite,
                                                   C_SclString * const opc_ErrorPath)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Create temporary folder");
    int32_t s32_Return = C_NO_ERR;
 
    std::vector<C_DoFlash> c_NodesToFlashNewPaths = orc_ApplicationsToWrite;
@@ -2649,6 +2955,7 @@ void C_OscSuSequences::h_CheckForChangedApplications(
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscSuSequences::ActivateFlashloader(const bool oq_FailOnFirstError)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Activate flashloader");
    int32_t s32_Return = C_NO_ERR;
    bool q_AtLeastOneError = false;
    const uint32_t u32_SCAN_TIME_MS = 5000U;
@@ -3392,6 +3699,7 @@ int32_t C_OscSuSequences::ActivateFlashloader(const bool oq_FailOnFirstError)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscSuSequences::ReadDeviceInformation(const bool oq_FailOnFirstError)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Read device information");
    int32_t s32_Return = C_NO_ERR;
    bool q_AtLeastOneError = false;
    bool q_AtLeastOneAuthenticationError = false;
@@ -3597,6 +3905,7 @@ int32_t C_OscSuSequences::ReadDeviceInformation(const bool oq_FailOnFirstError)
 int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoFlash> & orc_ApplicationsToWrite,
                                        const std::vector<uint32_t> & orc_NodesOrder)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Update system");
    int32_t s32_Return = C_NO_ERR;
 
    this->mu32_CurrentNode = 0U;
@@ -3832,6 +4141,8 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
 
    if (s32_Return == C_NO_ERR)
    {
+      std::set<uint32_t> c_NodesFlashedInParallel;
+
       (void)m_ReportProgress(eUPDATE_SYSTEM_START, C_NO_ERR, 0U, "Starting System Update ...");
       for (uint32_t u32_Position = 0U; u32_Position < orc_NodesOrder.size(); u32_Position++)
       {
@@ -3841,9 +4152,26 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
          // Save node index
          this->mu32_CurrentNode = u32_NodeIndex;
 
+         //Flash directly following STW Flashloader nodes on the local bus at the same time
+         if ((this->mu32_XflMaxParallelSessions > 1U) && (c_NodesFlashedInParallel.count(u32_NodeIndex) == 0U))
+         {
+            std::vector<uint32_t> c_XflNodeIndexes;
+            std::vector<C_OscProtocolDriverOsyNode> c_XflServerIds;
+
+            m_GetXflSessionNodes(orc_ApplicationsToWrite, orc_NodesOrder, u32_Position, c_XflNodeIndexes,
+                                 c_XflServerIds);
+            if (c_XflNodeIndexes.size() > 1U)
+            {
+               c_NodesFlashedInParallel.insert(c_XflNodeIndexes.begin(), c_XflNodeIndexes.end());
+               //error states of the failed nodes are set by m_FlashNodesXflParallel()
+               s32_Return = m_FlashNodesXflParallel(orc_ApplicationsToWrite, c_XflNodeIndexes, c_XflServerIds);
+            }
+         }
+
          //Flash openSYDE nodes.
          //Do we have anything for that node at all?
-         if (orc_ApplicationsToWrite[u32_NodeIndex].IsAnyActionRequired() == true)
+         if ((orc_ApplicationsToWrite[u32_NodeIndex].IsAnyActionRequired() == true) &&
+             (c_NodesFlashedInParallel.count(u32_NodeIndex) == 0U))
          {
             uint32_t u32_BusIndex;
             bool q_RoutingActivated = false;
@@ -4011,8 +4339,11 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
                   else
                   {
                      //flash STW Flashloader nodes
-                     s32_Return = m_FlashNodeXfl(orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
-                                                 rc_NodeUpdateStates.c_StateStwFlHexFiles);
+                     C_XflSession c_Session(*this, u32_NodeIndex, mc_CurrentNode,
+                                            orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToFlash,
+                                            rc_NodeUpdateStates.c_StateStwFlHexFiles);
+                     s32_Return = m_FlashNodeXfl(c_Session);
+                     this->mu32_CurrentFile = c_Session.u32_CurrentFile;
 
                      if ((s32_Return == C_NO_ERR) &&
                          ((orc_ApplicationsToWrite[u32_NodeIndex].c_FilesToWriteToNvm.size() > 0) ||
@@ -4033,19 +4364,8 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
          }
          if (s32_Return != C_NO_ERR)
          {
-            switch (s32_Return)
-            {
-            case C_TIMEOUT:
-               rc_NodeUpdateStates.q_Timeout = true;
-               break;
-            case C_CHECKSUM:
-               rc_NodeUpdateStates.q_SecurityAccessError = true;
-               break;
-            default:
-               // Nothing to do
-               break;
-            }
-
+            // mu32_CurrentNode is the failed node; for nodes flashed in parallel the first failed one
+            m_SetNodeUpdateErrorState(this->mu32_CurrentNode, s32_Return);
             break;
          }
       }
@@ -4082,6 +4402,7 @@ int32_t C_OscSuSequences::UpdateSystem(const std::vector<C_OscSuSequences::C_DoF
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscSuSequences::ResetSystem(void)
 {
+   const C_OscTraceScope c_TraceScope("System update", "Reset system");
    int32_t s32_Return = C_NO_ERR;
 
    if (this->mpc_SystemDefinition == NULL)
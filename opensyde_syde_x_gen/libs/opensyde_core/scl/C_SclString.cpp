@@ -61,6 +61,14 @@ const uint8_t mau8_ConvTable[256] =
    0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
 };
 
+//pairs of decimal digits "00" .. "99"; allows converting two digits per division
+const char_t macn_DecimalDigitPairs[201] =
+   "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+   "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+   "8081828384858687888990919293949596979899";
+
+const char_t macn_HexDigits[17] = "0123456789abcdef";
+
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
@@ -101,9 +109,7 @@ C_SclString::C_SclString(void) :
 //----------------------------------------------------------------------------------------------------------------------
 C_SclString::C_SclString(const uint8_t ou8_InitValue)
 {
-   std::stringstream c_Stream;
-   c_Stream << static_cast<uint32_t>(ou8_InitValue);
-   c_String = c_Stream.str();
+   mh_FormatDecimal(ou8_InitValue, false, c_String);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -117,9 +123,7 @@ C_SclString::C_SclString(const uint8_t ou8_InitValue)
 //----------------------------------------------------------------------------------------------------------------------
 C_SclString::C_SclString(const int8_t os8_InitValue)
 {
-   std::stringstream c_Stream;
-   c_Stream << static_cast<int32_t>(os8_InitValue);
-   c_String = c_Stream.str();
+   C_NumberFormatter<true, true>::h_ToDecimal(os8_InitValue, c_String);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -179,6 +183,41 @@ C_SclString::C_SclString(const C_SclString & orc_InitValue)
    c_String.operator =(orc_InitValue.c_str());
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor.
+
+   Initialize string data from "const char_t *".
+   Handled explicitly so zero-terminated strings do not take the stream based template constructor.
+   A NULL pointer results in an empty string.
+
+   \param[in]  opcn_InitValue   pointer to zero-terminated initial string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString::C_SclString(const char_t * const opcn_InitValue)
+{
+   if (opcn_InitValue != NULL)
+   {
+      c_String.operator =(opcn_InitValue);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor.
+
+   Initialize string data from "char_t *"
+   See documentation of const-variation for details.
+
+   \param[in]  opcn_InitValue   pointer to zero-terminated initial string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString::C_SclString(char_t * const opcn_InitValue)
+{
+   if (opcn_InitValue != NULL)
+   {
+      c_String.operator =(opcn_InitValue);
+   }
+} //lint !e818
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Constructor.
 
@@ -1391,6 +1430,93 @@ const std::string * C_SclString::AsStdString(void) const
    return &c_String;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Format integer as decimal number
+
+   Fast replacement for streaming an integer value into a std::stringstream.
+   The result is identical to the stream output (no grouping, "-" prefix for negative values).
+
+   \param[in]   ou64_Magnitude   absolute value to format
+   \param[in]   oq_IsNegative    true: prefix with "-"
+   \param[out]  orc_Text         resulting text (previous content is replaced)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SclString::mh_FormatDecimal(const uint64_t ou64_Magnitude, const bool oq_IsNegative, std::string & orc_Text)
+{
+   //20 digits for the largest uint64 value + sign
+   char_t acn_Buffer[21];
+   uint32_t u32_Position = sizeof(acn_Buffer);
+   uint64_t u64_Rest = ou64_Magnitude;
+
+   //two digits per step
+   while (u64_Rest >= 100U)
+   {
+      const uint32_t u32_Index = static_cast<uint32_t>(u64_Rest % 100U) * 2U;
+      u64_Rest /= 100U;
+      u32_Position -= 2U;
+      acn_Buffer[u32_Position] = macn_DecimalDigitPairs[u32_Index];
+      acn_Buffer[u32_Position + 1U] = macn_DecimalDigitPairs[u32_Index + 1U];
+   }
+   if (u64_Rest >= 10U)
+   {
+      const uint32_t u32_Index = static_cast<uint32_t>(u64_Rest) * 2U;
+      u32_Position -= 2U;
+      acn_Buffer[u32_Position] = macn_DecimalDigitPairs[u32_Index];
+      acn_Buffer[u32_Position + 1U] = macn_DecimalDigitPairs[u32_Index + 1U];
+   }
+   else
+   {
+      u32_Position--;
+      acn_Buffer[u32_Position] = static_cast<char_t>('0' + static_cast<char_t>(u64_Rest));
+   }
+   if (oq_IsNegative == true)
+   {
+      u32_Position--;
+      acn_Buffer[u32_Position] = '-';
+   }
+   orc_Text.assign(&acn_Buffer[u32_Position], sizeof(acn_Buffer) - u32_Position);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Format integer as hexadecimal number
+
+   Fast replacement for streaming an integer value into a std::stringstream with "std::hex", "std::setw" and
+    "std::setfill('0')".
+   The result is identical to the stream output (lower case digits, no prefix, no truncation).
+
+   \param[in]   ou64_Value    value to format
+   \param[in]   ou32_Digits   minimum number of digits (zeroes will be filled in from the left)
+   \param[out]  orc_Text      resulting text (previous content is replaced)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SclString::mh_FormatHex(const uint64_t ou64_Value, const uint32_t ou32_Digits, std::string & orc_Text)
+{
+   //16 digits for the largest uint64 value
+   char_t acn_Buffer[16];
+   uint32_t u32_Position = sizeof(acn_Buffer);
+   uint64_t u64_Rest = ou64_Value;
+   uint32_t u32_NumDigits;
+
+   do
+   {
+      u32_Position--;
+      acn_Buffer[u32_Position] = macn_HexDigits[static_cast<uint32_t>(u64_Rest & 0x0FU)];
+      u64_Rest >>= 4U;
+   }
+   while (u64_Rest != 0U);
+
+   u32_NumDigits = sizeof(acn_Buffer) - u32_Position;
+   if (ou32_Digits > u32_NumDigits)
+   {
+      orc_Text.assign(static_cast<size_t>(ou32_Digits) - u32_NumDigits, '0');
+   }
+   else
+   {
+      orc_Text.clear();
+   }
+   orc_Text.append(&acn_Buffer[u32_Position], u32_NumDigits);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Convert charn number to string
 
@@ -1408,10 +1534,8 @@ C_SclString C_SclString::IntToStr(const char_t ocn_Value)
 {
    C_SclString c_Text;
 
-   std::stringstream c_Stream;
    //a "int32_t" should be enough for a charn on all platforms
-   c_Stream << static_cast<int32_t>(ocn_Value);
-   c_Text.c_String = c_Stream.str();
+   C_NumberFormatter<true, true>::h_ToDecimal(static_cast<int32_t>(ocn_Value), c_Text.c_String);
 
    return c_Text;
 }
@@ -1438,9 +1562,7 @@ C_SclString C_SclString::IntToHex(const uint8_t ou8_Value, const uint32_t ou32_D
 {
    C_SclString c_Text;
 
-   std::stringstream c_Stream;
-   c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << static_cast<uint32_t>(ou8_Value);
-   c_Text.c_String = c_Stream.str();
+   mh_FormatHex(ou8_Value, ou32_Digits, c_Text.c_String);
 
    return c_Text;
 }
@@ -1467,9 +1589,8 @@ C_SclString C_SclString::IntToHex(const int8_t os8_Value, const uint32_t ou32_Di
 {
    C_SclString c_Text;
 
-   std::stringstream c_Stream;
-   c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << static_cast<int32_t>(os8_Value);
-   c_Text.c_String = c_Stream.str();
+   //same as the stream based implementation: format as int32_t
+   C_NumberFormatter<true, true>::h_ToHex(static_cast<int32_t>(os8_Value), ou32_Digits, c_Text.c_String);
 
    return c_Text;
 }
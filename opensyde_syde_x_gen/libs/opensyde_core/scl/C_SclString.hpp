@@ -35,6 +35,7 @@
 #include <iomanip>
 #include <iostream>
 #include <sstream>
+#include <limits>
 #include "stwtypes.hpp"
 #include "C_SclDynamicArray.hpp"
 
@@ -76,6 +77,11 @@ private:
    void m_ThrowIfOutOfRange(const int32_t os32_Index) const;
    static int64_t mh_StrTos64(const char_t * const opcn_String, const bool oq_Hex);
    static int32_t mh_StrTos32(const char_t * const opcn_String, const bool oq_Hex);
+   static void mh_FormatDecimal(const uint64_t ou64_Magnitude, const bool oq_IsNegative, std::string & orc_Text);
+   static void mh_FormatHex(const uint64_t ou64_Value, const uint32_t ou32_Digits, std::string & orc_Text);
+
+   //selects stream or fast integer formatting at compile time (see implementation below the class)
+   template <bool oq_IsFastInteger, bool oq_IsSigned> class C_NumberFormatter;
 
    std::string c_String; ///< actual string data wrapped by C_SclString
 
@@ -112,6 +118,8 @@ public:
    //constructors:
    C_SclString(void);
    C_SclString(const C_SclString & orc_InitValue);
+   C_SclString(const char_t * const opcn_InitValue);
+   C_SclString(char_t * const opcn_InitValue);
    C_SclString(const char_t * const opcn_InitValue, const uint32_t oun_Length);
    C_SclString(const int8_t os8_InitValue);
    C_SclString(const uint8_t ou8_InitValue);
@@ -184,6 +192,89 @@ public:
    void Tokenize(const C_SclString & orc_Delimiters, C_SclDynamicArray<C_SclString> & orc_TokenizedData) const;
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Generic number formatting
+
+   Used for all types that are not handled by the integer fast path (floating point types, character types, bool,
+   pointers, strings ...).
+   Uses a stream so the results are exactly what the stream operators of the type produce.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <bool oq_IsFastInteger, bool oq_IsSigned> class C_SclString::C_NumberFormatter
+{
+public:
+   template <typename T> static void h_ToDecimal(const T & orc_Value, std::string & orc_Text)
+   {
+      std::stringstream c_Stream;
+      c_Stream << orc_Value;
+      orc_Text = c_Stream.str();
+   }
+
+   template <typename T> static void h_ToHex(const T & orc_Value, const uint32_t ou32_Digits, std::string & orc_Text)
+   {
+      std::stringstream c_Stream;
+      c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << orc_Value;
+      orc_Text = c_Stream.str();
+   }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Number formatting for unsigned integer types
+
+   Formats directly into a character buffer instead of constructing a stream.
+   Results are identical to the stream based formatting.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <> class C_SclString::C_NumberFormatter<true, false>
+{
+public:
+   template <typename T> static void h_ToDecimal(const T & orc_Value, std::string & orc_Text)
+   {
+      C_SclString::mh_FormatDecimal(static_cast<uint64_t>(orc_Value), false, orc_Text);
+   }
+
+   template <typename T> static void h_ToHex(const T & orc_Value, const uint32_t ou32_Digits, std::string & orc_Text)
+   {
+      C_SclString::mh_FormatHex(static_cast<uint64_t>(orc_Value), ou32_Digits, orc_Text);
+   }
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Number formatting for signed integer types
+
+   Formats directly into a character buffer instead of constructing a stream.
+   Results are identical to the stream based formatting.
+   Like with streams negative values are printed as two's complement of the type's width in hexadecimal format.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+template <> class C_SclString::C_NumberFormatter<true, true>
+{
+public:
+   template <typename T> static void h_ToDecimal(const T & orc_Value, std::string & orc_Text)
+   {
+      const int64_t s64_Value = static_cast<int64_t>(orc_Value);
+
+      if (s64_Value < 0)
+      {
+         //unsigned arithmetic to also cover the most negative value
+         C_SclString::mh_FormatDecimal(0U - static_cast<uint64_t>(s64_Value), true, orc_Text);
+      }
+      else
+      {
+         C_SclString::mh_FormatDecimal(static_cast<uint64_t>(s64_Value), false, orc_Text);
+      }
+   }
+
+   template <typename T> static void h_ToHex(const T & orc_Value, const uint32_t ou32_Digits, std::string & orc_Text)
+   {
+      //limit to the width of the type:
+      const uint64_t u64_Mask = (~static_cast<uint64_t>(0U)) >> (64U - (sizeof(T) * 8U));
+
+      C_SclString::mh_FormatHex(static_cast<uint64_t>(static_cast<int64_t>(orc_Value)) & u64_Mask, ou32_Digits,
+                                orc_Text);
+   }
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Constructor
 
@@ -194,9 +285,8 @@ public:
 //----------------------------------------------------------------------------------------------------------------------
 template <typename T> C_SclString::C_SclString(const T orc_Value)
 {
-   std::stringstream c_Stream;
-   c_Stream << orc_Value;
-   c_String = c_Stream.str();
+   C_NumberFormatter<(std::numeric_limits<T>::is_integer && (sizeof(T) > 1U)),
+                     std::numeric_limits<T>::is_signed>::h_ToDecimal(orc_Value, c_String);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -237,9 +327,8 @@ template <typename T> C_SclString C_SclString::IntToHex(const T orc_Value, const
 {
    C_SclString c_Text;
 
-   std::stringstream c_Stream;
-   c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << orc_Value;
-   c_Text.c_String = c_Stream.str();
+   C_NumberFormatter<(std::numeric_limits<T>::is_integer && (sizeof(T) > 1U)),
+                     std::numeric_limits<T>::is_signed>::h_ToHex(orc_Value, ou32_Digits, c_Text.c_String);
 
    return c_Text;
 }
@@ -0,0 +1,526 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for the hex image cache (C_OscHexImageCache)
+
+   The disk images are used to tell where an image came from: the check writes disk images with data differing from
+    the hex file (in the documented "OSYHEXI2" format).
+   * memory cache hit: data of the image that was cached before
+   * memory cache miss with valid disk image: data of the disk image
+   * memory cache miss with invalid disk image: data of the hex file
+   Checked: hits and misses, LRU eviction, disk image round trip (format and content), rejection of truncated and
+    corrupted disk images and discarding of the hex file index if the data is changed via the base class.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_Md5Checksum.hpp"
+#include "TglFile.hpp"
+#include "C_OscHexFile.hpp"
+#include "C_OscHexImageCache.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::hex_file;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const char_t * const mpcn_CACHE_DIRECTORY = "hex_image_cache_check";
+static const uint32_t mu32_NUM_FILES = 3U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///memory content: address -> value
+typedef std::map<uint32_t, uint8_t> T_Memory;
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static void m_WriteFile(const C_SclString & orc_FilePath, const std::vector<uint8_t> & orc_Content);
+static std::vector<uint8_t> m_ReadFile(const C_SclString & orc_FilePath);
+static void m_SetU32(std::vector<uint8_t> & orc_Target, const uint32_t ou32_Value);
+static C_SclString m_GetFilePath(const uint32_t ou32_File);
+static C_SclString m_GetDiskImagePath(const uint32_t ou32_File);
+static C_HexDataDump m_CreateDump(const uint32_t ou32_Address, const uint8_t ou8_FirstValue);
+static void m_WriteHexFile(const uint32_t ou32_File);
+static std::vector<uint8_t> m_CreateDiskImage(const uint32_t ou32_File, const C_HexDataDump & orc_Dump);
+static T_Memory m_GetMemory(const C_HexDataDump & orc_Dump);
+static bool m_LoadAndCompare(const uint32_t ou32_File, const C_HexDataDump & orc_Expected);
+static void m_CheckHitAndMiss(void);
+static void m_CheckLruEviction(void);
+static void m_CheckDiskRoundTrip(void);
+static void m_CheckInvalidDiskImages(void);
+static void m_CheckIndex(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      std::printf("FAILED: %s\n", orc_Description.c_str());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write binary file
+
+   \param[in]  orc_FilePath   path of file
+   \param[in]  orc_Content    new file content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_WriteFile(const C_SclString & orc_FilePath, const std::vector<uint8_t> & orc_Content)
+{
+   std::FILE * const pc_File = std::fopen(orc_FilePath.c_str(), "wb");
+
+   if (pc_File != NULL)
+   {
+      if (orc_Content.empty() == false)
+      {
+         (void)std::fwrite(&orc_Content[0], 1U, orc_Content.size(), pc_File);
+      }
+      (void)std::fclose(pc_File);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read binary file
+
+   \param[in]  orc_FilePath   path of file
+
+   \return
+   file content (empty if the file could not be read)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static std::vector<uint8_t> m_ReadFile(const C_SclString & orc_FilePath)
+{
+   std::vector<uint8_t> c_Content;
+   std::FILE * const pc_File = std::fopen(orc_FilePath.c_str(), "rb");
+
+   if (pc_File != NULL)
+   {
+      uint8_t au8_Buffer[256];
+      size_t x_Read;
+      do
+      {
+         x_Read = std::fread(&au8_Buffer[0], 1U, sizeof(au8_Buffer), pc_File);
+         c_Content.insert(c_Content.end(), &au8_Buffer[0], &au8_Buffer[x_Read]);
+      }
+      while (x_Read == sizeof(au8_Buffer));
+      (void)std::fclose(pc_File);
+   }
+   return c_Content;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append 32bit value (little endian)
+
+   \param[in,out]  orc_Target   buffer to append to
+   \param[in]      ou32_Value   value to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_SetU32(std::vector<uint8_t> & orc_Target, const uint32_t ou32_Value)
+{
+   orc_Target.push_back(static_cast<uint8_t>(ou32_Value));
+   orc_Target.push_back(static_cast<uint8_t>(ou32_Value >> 8U));
+   orc_Target.push_back(static_cast<uint8_t>(ou32_Value >> 16U));
+   orc_Target.push_back(static_cast<uint8_t>(ou32_Value >> 24U));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get path of hex file
+
+   \param[in]  ou32_File   index of hex file
+
+   \return
+   path of hex file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_GetFilePath(const uint32_t ou32_File)
+{
+   return "hex_image_cache_check_" + C_SclString::IntToStr(ou32_File) + ".hex";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get path of disk image of hex file
+
+   "<size>_<md5>.osyhex" in the disk cache directory
+
+   \param[in]  ou32_File   index of hex file
+
+   \return
+   path of disk image
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_GetDiskImagePath(const uint32_t ou32_File)
+{
+   const C_SclString c_FilePath = m_GetFilePath(ou32_File);
+   C_SclString c_FileName;
+
+   c_FileName.PrintFormatted("%08X_", static_cast<uint32_t>(TglFileSize(c_FilePath)));
+   return TglFileIncludeTrailingDelimiter(mpcn_CACHE_DIRECTORY) + c_FileName +
+          stw::md5::C_Md5Checksum::GetMD5(c_FilePath) + ".osyhex";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create memory dump with one block of 16 bytes
+
+   \param[in]  ou32_Address     start address
+   \param[in]  ou8_FirstValue   value of first byte (incremented for each following byte)
+
+   \return
+   memory dump
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_HexDataDump m_CreateDump(const uint32_t ou32_Address, const uint8_t ou8_FirstValue)
+{
+   C_HexDataDump c_Dump;
+
+   c_Dump.at_Blocks.SetLength(1);
+   c_Dump.at_Blocks[0].u32_AddressOffset = ou32_Address;
+   c_Dump.at_Blocks[0].au8_Data.SetLength(16);
+   for (int32_t s32_Index = 0; s32_Index < 16; s32_Index++)
+   {
+      c_Dump.at_Blocks[0].au8_Data[s32_Index] = static_cast<uint8_t>(ou8_FirstValue + s32_Index);
+   }
+   return c_Dump;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write hex file with the content of m_CreateDump(ou32_File * 0x1000, ou32_File * 0x10)
+
+   \param[in]  ou32_File   index of hex file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_WriteHexFile(const uint32_t ou32_File)
+{
+   const C_HexDataDump c_Dump = m_CreateDump(ou32_File * 0x1000U, static_cast<uint8_t>(ou32_File * 0x10U));
+   const uint32_t u32_Address = c_Dump.at_Blocks[0].u32_AddressOffset;
+   uint8_t u8_Checksum = static_cast<uint8_t>(16U + (u32_Address >> 8U) + u32_Address);
+   C_SclString c_Line = ":10" + C_SclString::IntToHex(static_cast<int64_t>(u32_Address), 4U) + "00";
+   std::vector<uint8_t> c_Content;
+
+   for (int32_t s32_Index = 0; s32_Index < 16; s32_Index++)
+   {
+      const uint8_t u8_Value = c_Dump.at_Blocks[0].au8_Data[s32_Index];
+      c_Line += C_SclString::IntToHex(u8_Value, 2U);
+      u8_Checksum = static_cast<uint8_t>(u8_Checksum + u8_Value);
+   }
+   c_Line += C_SclString::IntToHex(static_cast<uint8_t>(0x100U - u8_Checksum), 2U) + "\n:00000001FF\n";
+   c_Line = c_Line.UpperCase();
+   c_Content.assign(c_Line.c_str(), c_Line.c_str() + c_Line.Length());
+   m_WriteFile(m_GetFilePath(ou32_File), c_Content);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create disk image for hex file
+
+   Independent implementation of the documented "OSYHEXI2" format.
+
+   \param[in]  ou32_File   index of hex file (the image is only valid for its content)
+   \param[in]  orc_Dump    data to put into image
+
+   \return
+   disk image content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static std::vector<uint8_t> m_CreateDiskImage(const uint32_t ou32_File, const C_HexDataDump & orc_Dump)
+{
+   const C_SclString c_FilePath = m_GetFilePath(ou32_File);
+   const C_SclString c_FileMd5 = stw::md5::C_Md5Checksum::GetMD5(c_FilePath);
+   const char_t acn_MAGIC[] = "OSYHEXI2";
+   std::vector<uint8_t> c_Payload;
+   std::vector<uint8_t> c_Image(&acn_MAGIC[0], &acn_MAGIC[8]);
+   C_SclString c_PayloadMd5;
+
+   for (int32_t s32_Block = 0; s32_Block < orc_Dump.at_Blocks.GetLength(); s32_Block++)
+   {
+      const C_HexDataDumpBlock & rc_Block = orc_Dump.at_Blocks[s32_Block];
+      m_SetU32(c_Payload, rc_Block.u32_AddressOffset);
+      m_SetU32(c_Payload, static_cast<uint32_t>(rc_Block.au8_Data.GetLength()));
+      for (int32_t s32_Index = 0; s32_Index < rc_Block.au8_Data.GetLength(); s32_Index++)
+      {
+         c_Payload.push_back(rc_Block.au8_Data[s32_Index]);
+      }
+   }
+   c_PayloadMd5 = stw::md5::C_Md5Checksum::GetMD5(&c_Payload[0], static_cast<uint32_t>(c_Payload.size()));
+
+   m_SetU32(c_Image, static_cast<uint32_t>(TglFileSize(c_FilePath)));
+   c_Image.insert(c_Image.end(), c_FileMd5.c_str(), c_FileMd5.c_str() + c_FileMd5.Length());
+   m_SetU32(c_Image, static_cast<uint32_t>(orc_Dump.at_Blocks.GetLength()));
+   c_Image.insert(c_Image.end(), c_PayloadMd5.c_str(), c_PayloadMd5.c_str() + c_PayloadMd5.Length());
+   c_Image.insert(c_Image.end(), c_Payload.begin(), c_Payload.end());
+   return c_Image;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get memory content of dump
+
+   \param[in]  orc_Dump   memory dump
+
+   \return
+   memory content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static T_Memory m_GetMemory(const C_HexDataDump & orc_Dump)
+{
+   T_Memory c_Memory;
+
+   for (int32_t s32_Block = 0; s32_Block < orc_Dump.at_Blocks.GetLength(); s32_Block++)
+   {
+      const C_HexDataDumpBlock & rc_Block = orc_Dump.at_Blocks[s32_Block];
+      for (int32_t s32_Index = 0; s32_Index < rc_Block.au8_Data.GetLength(); s32_Index++)
+      {
+         c_Memory[rc_Block.u32_AddressOffset + static_cast<uint32_t>(s32_Index)] = rc_Block.au8_Data[s32_Index];
+      }
+   }
+   return c_Memory;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load hex file via cache and compare content
+
+   \param[in]  ou32_File      index of hex file
+   \param[in]  orc_Expected   expected content
+
+   \return
+   true: loaded without error and content matches
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_LoadAndCompare(const uint32_t ou32_File, const C_HexDataDump & orc_Expected)
+{
+   bool q_Match = false;
+   C_OscHexFile c_HexFile;
+
+   if (C_OscHexImageCache::h_LoadHexFile(m_GetFilePath(ou32_File), c_HexFile) == NO_ERR)
+   {
+      uint32_t u32_Result;
+      const C_HexDataDump * const pc_Dump = c_HexFile.GetDataDump(u32_Result);
+      q_Match = (pc_Dump != NULL) && (u32_Result == NO_ERR) && (c_HexFile.GetIndex().q_Valid == true) &&
+                (m_GetMemory(*pc_Dump) == m_GetMemory(orc_Expected));
+   }
+   return q_Match;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check memory cache hits and misses
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckHitAndMiss(void)
+{
+   const C_HexDataDump c_DiskData1 = m_CreateDump(0x8000U, 0x81U);
+   const C_HexDataDump c_DiskData2 = m_CreateDump(0x9000U, 0x91U);
+
+   C_OscHexImageCache::h_Clear();
+   C_OscHexImageCache::h_SetMaxNumberOfEntries(16U);
+   C_OscHexImageCache::h_SetDiskCacheDirectory(mpcn_CACHE_DIRECTORY);
+
+   m_WriteFile(m_GetDiskImagePath(1U), m_CreateDiskImage(1U, c_DiskData1));
+   m_Check(m_LoadAndCompare(1U, c_DiskData1) == true, "miss: disk image used");
+   m_WriteFile(m_GetDiskImagePath(1U), m_CreateDiskImage(1U, c_DiskData2));
+   m_Check(m_LoadAndCompare(1U, c_DiskData1) == true, "hit: memory image used");
+
+   //same content under a different name hits the cache
+   m_WriteFile("hex_image_cache_check_copy.hex", m_ReadFile(m_GetFilePath(1U)));
+   {
+      C_OscHexFile c_HexFile;
+      uint32_t u32_Result;
+      m_Check((C_OscHexImageCache::h_LoadHexFile("hex_image_cache_check_copy.hex", c_HexFile) == NO_ERR) &&
+              (m_GetMemory(*c_HexFile.GetDataDump(u32_Result)) == m_GetMemory(c_DiskData1)), "hit: copied file");
+   }
+   (void)std::remove("hex_image_cache_check_copy.hex");
+
+   //other content misses the cache
+   m_WriteHexFile(2U);
+   m_Check(m_LoadAndCompare(2U, m_CreateDump(0x2000U, 0x20U)) == true, "miss: hex file parsed");
+
+   C_OscHexImageCache::h_Clear();
+   m_Check(m_LoadAndCompare(1U, c_DiskData2) == true, "cleared: disk image used");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check eviction of least recently used images
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckLruEviction(void)
+{
+   C_OscHexImageCache::h_Clear();
+   C_OscHexImageCache::h_SetMaxNumberOfEntries(2U);
+   C_OscHexImageCache::h_SetDiskCacheDirectory(mpcn_CACHE_DIRECTORY);
+
+   //fill the memory cache with the "old" disk images
+   for (uint32_t u32_File = 0U; u32_File < mu32_NUM_FILES; u32_File++)
+   {
+      m_WriteFile(m_GetDiskImagePath(u32_File), m_CreateDiskImage(u32_File, m_CreateDump(0x8000U, 0x80U + u32_File)));
+   }
+   m_Check(m_LoadAndCompare(0U, m_CreateDump(0x8000U, 0x80U)) == true, "LRU: load 0");
+   m_Check(m_LoadAndCompare(1U, m_CreateDump(0x8000U, 0x81U)) == true, "LRU: load 1");
+
+   //from now on the disk images tell about misses
+   for (uint32_t u32_File = 0U; u32_File < mu32_NUM_FILES; u32_File++)
+   {
+      m_WriteFile(m_GetDiskImagePath(u32_File), m_CreateDiskImage(u32_File, m_CreateDump(0x9000U, 0x90U + u32_File)));
+   }
+   //use 0, so 1 is the least recently used one
+   m_Check(m_LoadAndCompare(0U, m_CreateDump(0x8000U, 0x80U)) == true, "LRU: hit 0");
+   m_Check(m_LoadAndCompare(2U, m_CreateDump(0x9000U, 0x92U)) == true, "LRU: miss 2 (evicts 1)");
+   m_Check(m_LoadAndCompare(0U, m_CreateDump(0x8000U, 0x80U)) == true, "LRU: 0 kept");
+   m_Check(m_LoadAndCompare(1U, m_CreateDump(0x9000U, 0x91U)) == true, "LRU: 1 evicted");
+
+   C_OscHexImageCache::h_SetMaxNumberOfEntries(0U);
+   m_WriteFile(m_GetDiskImagePath(1U), m_CreateDiskImage(1U, m_CreateDump(0xA000U, 0xA1U)));
+   m_Check(m_LoadAndCompare(1U, m_CreateDump(0xA000U, 0xA1U)) == true, "no entries: nothing kept");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check disk image written for a parsed file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckDiskRoundTrip(void)
+{
+   const C_HexDataDump c_FileData = m_CreateDump(0x1000U, 0x10U);
+
+   C_OscHexImageCache::h_Clear();
+   C_OscHexImageCache::h_SetMaxNumberOfEntries(16U);
+   C_OscHexImageCache::h_SetDiskCacheDirectory(mpcn_CACHE_DIRECTORY);
+   (void)std::remove(m_GetDiskImagePath(1U).c_str());
+
+   m_Check(m_LoadAndCompare(1U, c_FileData) == true, "round trip: parsed");
+   m_Check(m_ReadFile(m_GetDiskImagePath(1U)) == m_CreateDiskImage(1U, c_FileData), "round trip: disk image format");
+   C_OscHexImageCache::h_Clear();
+   m_Check(m_LoadAndCompare(1U, c_FileData) == true, "round trip: disk image loaded");
+
+   //disk cache not active: nothing written
+   C_OscHexImageCache::h_Clear();
+   C_OscHexImageCache::h_SetDiskCacheDirectory("");
+   (void)std::remove(m_GetDiskImagePath(1U).c_str());
+   m_Check(m_LoadAndCompare(1U, c_FileData) == true, "no disk cache: parsed");
+   m_Check(TglFileExists(m_GetDiskImagePath(1U)) == false, "no disk cache: no image written");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check that invalid disk images are ignored and replaced
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckInvalidDiskImages(void)
+{
+   const C_HexDataDump c_FileData = m_CreateDump(0x1000U, 0x10U);
+   const std::vector<uint8_t> c_Valid = m_CreateDiskImage(1U, m_CreateDump(0x8000U, 0x81U));
+   std::vector<std::vector<uint8_t> > c_Invalid;
+   std::vector<uint8_t> c_Image;
+
+   C_OscHexImageCache::h_SetMaxNumberOfEntries(16U);
+   C_OscHexImageCache::h_SetDiskCacheDirectory(mpcn_CACHE_DIRECTORY);
+
+   //truncated payload; truncated header
+   c_Invalid.push_back(std::vector<uint8_t>(c_Valid.begin(), c_Valid.end() - 1));
+   c_Invalid.push_back(std::vector<uint8_t>(c_Valid.begin(), c_Valid.begin() + 40));
+   //corrupted payload; corrupted number of blocks; old format
+   c_Image = c_Valid;
+   c_Image[c_Image.size() - 1U] ^= 0x01U;
+   c_Invalid.push_back(c_Image);
+   c_Image = c_Valid;
+   c_Image[44] = 2U;
+   c_Invalid.push_back(c_Image);
+   c_Image = c_Valid;
+   c_Image[7] = static_cast<uint8_t>('1');
+   c_Invalid.push_back(c_Image);
+   //image of other file content
+   c_Invalid.push_back(m_CreateDiskImage(2U, m_CreateDump(0x8000U, 0x81U)));
+   //empty file
+   c_Invalid.push_back(std::vector<uint8_t>());
+
+   for (uint32_t u32_Case = 0U; u32_Case < c_Invalid.size(); u32_Case++)
+   {
+      const C_SclString c_Case = "invalid disk image " + C_SclString::IntToStr(u32_Case);
+      C_OscHexImageCache::h_Clear();
+      m_WriteFile(m_GetDiskImagePath(1U), c_Invalid[u32_Case]);
+      m_Check(m_LoadAndCompare(1U, c_FileData) == true, c_Case + ": hex file parsed");
+      m_Check(m_ReadFile(m_GetDiskImagePath(1U)) == m_CreateDiskImage(1U, c_FileData), c_Case + ": replaced");
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check that the index is discarded when the data is changed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckIndex(void)
+{
+   C_OscHexFile c_HexFile;
+   C_HexFile & rc_Base = c_HexFile;
+
+   C_OscHexImageCache::h_Clear();
+   m_Check((C_OscHexImageCache::h_LoadHexFile(m_GetFilePath(1U), c_HexFile) == NO_ERR) &&
+           (c_HexFile.GetIndex().q_Valid == true), "index: created");
+   rc_Base.Clear();
+   m_Check(c_HexFile.GetIndex().q_Valid == false, "index: discarded by Clear");
+
+   m_Check((C_OscHexImageCache::h_LoadHexFile(m_GetFilePath(1U), c_HexFile) == NO_ERR) &&
+           (c_HexFile.GetIndex().q_Valid == true), "index: from cache");
+   (void)rc_Base.LoadFromFile(m_GetFilePath(2U).c_str());
+   m_Check(c_HexFile.GetIndex().q_Valid == false, "index: discarded by base class LoadFromFile");
+
+   c_HexFile.CreateIndex();
+   (void)rc_Base.SetDataDump(m_CreateDump(0x3000U, 0x30U));
+   m_Check(c_HexFile.GetIndex().q_Valid == false, "index: discarded by base class SetDataDump");
+
+   c_HexFile.CreateIndex();
+   (void)rc_Base.Optimize(8U);
+   m_Check(c_HexFile.GetIndex().q_Valid == false, "index: discarded by Optimize");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   (void)TglRemoveDirectory(mpcn_CACHE_DIRECTORY, false);
+   (void)TglCreateDirectory(mpcn_CACHE_DIRECTORY);
+   for (uint32_t u32_File = 0U; u32_File < mu32_NUM_FILES; u32_File++)
+   {
+      m_WriteHexFile(u32_File);
+   }
+
+   m_CheckHitAndMiss();
+   m_CheckLruEviction();
+   m_CheckDiskRoundTrip();
+   m_CheckInvalidDiskImages();
+   m_CheckIndex();
+
+   C_OscHexImageCache::h_Clear();
+   (void)TglRemoveDirectory(mpcn_CACHE_DIRECTORY, false);
+   for (uint32_t u32_File = 0U; u32_File < mu32_NUM_FILES; u32_File++)
+   {
+      (void)std::remove(m_GetFilePath(u32_File).c_str());
+   }
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
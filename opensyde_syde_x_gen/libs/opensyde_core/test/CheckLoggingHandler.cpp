@@ -0,0 +1,442 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for the log file writer of the logging handler (C_OscLoggingHandler)
+
+   Checked:
+   * warnings and errors configured to be flushed are on disk when the logging call returns, after the info entries
+     logged before
+   * entries dropped because of a full queue are reported with their number: written and reported entries add up to
+     the logged entries
+   * size based rotation keeps the configured number of backups "<file>.1" ... "<file>.N" with consecutive entries
+   * h_Flush and closing the log file write all entries logged before
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "TglFile.hpp"
+#include "C_OscLoggingHandler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const char_t * const mpcn_LOG_FILE = "check_logging_handler.log";
+static const char_t * const mpcn_ROTATION_LOG_FILE = "check_logging_handler_rotation.log";
+static const char_t * const mpcn_DROPPED_TEXT = "Log queue was full. ";
+static const uint32_t mu32_ROTATION_MAX_FILE_SIZE = 4000U;
+static const uint32_t mu32_ROTATION_NUM_BACKUPS = 3U;
+static const uint32_t mu32_OVERFLOW_BURST_SIZE = 100000U;
+static const uint32_t mu32_OVERFLOW_MAX_BURSTS = 20U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static std::string m_ReadFile(const C_SclString & orc_FilePath);
+static C_SclString m_GetBackupPath(const C_SclString & orc_FilePath, const uint32_t ou32_Backup);
+static void m_RemoveFiles(const C_SclString & orc_FilePath);
+static std::vector<uint32_t> m_GetEntryNumbers(const std::string & orc_Content, const std::string & orc_Tag);
+static uint32_t m_GetNumDropped(const std::string & orc_Content);
+static bool m_AreConsecutive(const std::vector<uint32_t> & orc_Numbers, const uint32_t ou32_First,
+                             const uint32_t ou32_Count);
+static void m_CheckSynchronousWarnings(void);
+static void m_CheckFlushAndClose(void);
+static void m_CheckQueueOverflow(void);
+static void m_CheckRotation(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      std::printf("FAILED: %s\n", orc_Description.c_str());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read file as it is on disk
+
+   \param[in]  orc_FilePath   path of file
+
+   \return
+   file content (empty if the file could not be read)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static std::string m_ReadFile(const C_SclString & orc_FilePath)
+{
+   std::string c_Content;
+   std::FILE * const pc_File = std::fopen(orc_FilePath.c_str(), "rb");
+
+   if (pc_File != NULL)
+   {
+      char_t acn_Buffer[4096];
+      size_t x_Read;
+      do
+      {
+         x_Read = std::fread(&acn_Buffer[0], 1U, sizeof(acn_Buffer), pc_File);
+         c_Content.append(&acn_Buffer[0], x_Read);
+      }
+      while (x_Read == sizeof(acn_Buffer));
+      (void)std::fclose(pc_File);
+   }
+   return c_Content;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get path of backup file of rotation
+
+   \param[in]  orc_FilePath   path of log file
+   \param[in]  ou32_Backup    number of backup (0: log file itself)
+
+   \return
+   path of backup file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_GetBackupPath(const C_SclString & orc_FilePath, const uint32_t ou32_Backup)
+{
+   return (ou32_Backup == 0U) ? orc_FilePath : (orc_FilePath + "." + C_SclString::IntToStr(ou32_Backup));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove log file and all possible backups
+
+   \param[in]  orc_FilePath   path of log file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_RemoveFiles(const C_SclString & orc_FilePath)
+{
+   for (uint32_t u32_Backup = 0U; u32_Backup <= (mu32_ROTATION_NUM_BACKUPS + 1U); u32_Backup++)
+   {
+      (void)std::remove(m_GetBackupPath(orc_FilePath, u32_Backup).c_str());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get numbers of entries with message "<tag> <number>" in file order
+
+   \param[in]  orc_Content   log file content
+   \param[in]  orc_Tag       tag of messages
+
+   \return
+   numbers of entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static std::vector<uint32_t> m_GetEntryNumbers(const std::string & orc_Content, const std::string & orc_Tag)
+{
+   std::vector<uint32_t> c_Numbers;
+   const std::string c_Pattern = " " + orc_Tag + " ";
+   size_t x_Position = orc_Content.find(c_Pattern);
+
+   while (x_Position != std::string::npos)
+   {
+      x_Position += c_Pattern.size();
+      c_Numbers.push_back(static_cast<uint32_t>(std::strtoul(&orc_Content[x_Position], NULL, 10)));
+      x_Position = orc_Content.find(c_Pattern, x_Position);
+   }
+   return c_Numbers;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get sum of all reported numbers of dropped entries
+
+   \param[in]  orc_Content   log file content
+
+   \return
+   number of dropped entries reported in the log file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetNumDropped(const std::string & orc_Content)
+{
+   const std::string c_Pattern = mpcn_DROPPED_TEXT;
+   uint32_t u32_NumDropped = 0U;
+   size_t x_Position = orc_Content.find(c_Pattern);
+
+   while (x_Position != std::string::npos)
+   {
+      x_Position += c_Pattern.size();
+      u32_NumDropped += static_cast<uint32_t>(std::strtoul(&orc_Content[x_Position], NULL, 10));
+      x_Position = orc_Content.find(c_Pattern, x_Position);
+   }
+   return u32_NumDropped;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check for consecutive numbers
+
+   \param[in]  orc_Numbers   numbers to check
+   \param[in]  ou32_First    expected first number
+   \param[in]  ou32_Count    expected count of numbers
+
+   \return
+   true: numbers are ou32_First ... ou32_First + ou32_Count - 1
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_AreConsecutive(const std::vector<uint32_t> & orc_Numbers, const uint32_t ou32_First,
+                             const uint32_t ou32_Count)
+{
+   bool q_Return = (orc_Numbers.size() == ou32_Count);
+
+   for (uint32_t u32_Index = 0U; (u32_Index < orc_Numbers.size()) && (q_Return == true); u32_Index++)
+   {
+      q_Return = (orc_Numbers[u32_Index] == (ou32_First + u32_Index));
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check warnings and errors flushed by the logging call
+
+   The file is read right after the logging call without h_Flush.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckSynchronousWarnings(void)
+{
+   std::string c_Content;
+
+   m_RemoveFiles(mpcn_LOG_FILE);
+   C_OscLoggingHandler::h_SetCompleteLogFileLocation(mpcn_LOG_FILE);
+   C_OscLoggingHandler::h_SetWriteToFileActive(true, false, false, true);
+
+   for (uint32_t u32_Round = 0U; u32_Round < 20U; u32_Round++)
+   {
+      for (uint32_t u32_Entry = 0U; u32_Entry < 50U; u32_Entry++)
+      {
+         osc_write_log_info("Check", "info " + C_SclString::IntToStr((u32_Round * 50U) + u32_Entry));
+      }
+      if ((u32_Round % 2U) == 0U)
+      {
+         osc_write_log_warning("Check", "flushed " + C_SclString::IntToStr(u32_Round));
+      }
+      else
+      {
+         osc_write_log_error("Check", "flushed " + C_SclString::IntToStr(u32_Round));
+      }
+
+      c_Content = m_ReadFile(mpcn_LOG_FILE);
+      m_Check(m_AreConsecutive(m_GetEntryNumbers(c_Content, "flushed"), 0U, u32_Round + 1U),
+              "warning / error on disk after logging call in round " + C_SclString::IntToStr(u32_Round));
+      m_Check(m_AreConsecutive(m_GetEntryNumbers(c_Content, "info"), 0U, (u32_Round + 1U) * 50U),
+              "info entries on disk before warning / error in round " + C_SclString::IntToStr(u32_Round));
+      m_Check(c_Content.rfind(" info ") < c_Content.rfind(" flushed "),
+              "warning / error after info entries in round " + C_SclString::IntToStr(u32_Round));
+   }
+
+   C_OscLoggingHandler::h_SetWriteToFileActive(false);
+   m_RemoveFiles(mpcn_LOG_FILE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check h_Flush and closing the file write all entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckFlushAndClose(void)
+{
+   std::string c_Content;
+
+   m_RemoveFiles(mpcn_LOG_FILE);
+   C_OscLoggingHandler::h_SetCompleteLogFileLocation(mpcn_LOG_FILE);
+   C_OscLoggingHandler::h_SetWriteToFileActive(true, false, false, false);
+
+   for (uint32_t u32_Entry = 0U; u32_Entry < 1000U; u32_Entry++)
+   {
+      osc_write_log_warning("Check", "flush " + C_SclString::IntToStr(u32_Entry));
+   }
+   C_OscLoggingHandler::h_Flush();
+   c_Content = m_ReadFile(mpcn_LOG_FILE);
+   m_Check(m_AreConsecutive(m_GetEntryNumbers(c_Content, "flush"), 0U, 1000U), "all entries written by h_Flush");
+
+   for (uint32_t u32_Entry = 0U; u32_Entry < 1000U; u32_Entry++)
+   {
+      osc_write_log_info("Check", "close " + C_SclString::IntToStr(u32_Entry));
+   }
+   C_OscLoggingHandler::h_SetWriteToFileActive(false);
+   c_Content = m_ReadFile(mpcn_LOG_FILE);
+   m_Check(m_AreConsecutive(m_GetEntryNumbers(c_Content, "close"), 0U, 1000U), "all entries written on close");
+
+   //closed: nothing is written
+   osc_write_log_error("Check", "closed 0");
+   C_OscLoggingHandler::h_Flush();
+   c_Content = m_ReadFile(mpcn_LOG_FILE);
+   m_Check(m_GetEntryNumbers(c_Content, "closed").empty(), "no entries written after close");
+
+   //changing the location closes the file
+   C_OscLoggingHandler::h_SetWriteToFileActive(true, false, false, false);
+   for (uint32_t u32_Entry = 0U; u32_Entry < 1000U; u32_Entry++)
+   {
+      osc_write_log_info("Check", "relocate " + C_SclString::IntToStr(u32_Entry));
+   }
+   C_OscLoggingHandler::h_SetCompleteLogFileLocation(mpcn_ROTATION_LOG_FILE);
+   c_Content = m_ReadFile(mpcn_LOG_FILE);
+   m_Check(m_AreConsecutive(m_GetEntryNumbers(c_Content, "relocate"), 0U, 1000U),
+           "all entries written on change of location");
+
+   C_OscLoggingHandler::h_SetWriteToFileActive(false);
+   m_RemoveFiles(mpcn_LOG_FILE);
+   m_RemoveFiles(mpcn_ROTATION_LOG_FILE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check the report of entries dropped because of a full queue
+
+   Bursts of entries are logged to a new file until the writer thread can not keep up with one burst.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckQueueOverflow(void)
+{
+   uint32_t u32_NumDropped = 0U;
+   std::vector<uint32_t> c_Numbers;
+
+   C_OscLoggingHandler::h_SetCompleteLogFileLocation(mpcn_LOG_FILE);
+   for (uint32_t u32_Burst = 0U; (u32_Burst < mu32_OVERFLOW_MAX_BURSTS) && (u32_NumDropped == 0U); u32_Burst++)
+   {
+      std::string c_Content;
+
+      m_RemoveFiles(mpcn_LOG_FILE);
+      C_OscLoggingHandler::h_SetWriteToFileActive(true, false, false, false);
+      for (uint32_t u32_Entry = 0U; u32_Entry < mu32_OVERFLOW_BURST_SIZE; u32_Entry++)
+      {
+         osc_write_log_info("Check", "burst " + C_SclString::IntToStr(u32_Entry));
+      }
+      C_OscLoggingHandler::h_Flush();
+      c_Content = m_ReadFile(mpcn_LOG_FILE);
+      c_Numbers = m_GetEntryNumbers(c_Content, "burst");
+      u32_NumDropped = m_GetNumDropped(c_Content);
+      C_OscLoggingHandler::h_SetWriteToFileActive(false);
+   }
+
+   m_Check(u32_NumDropped > 0U, "queue overflow reported");
+   m_Check((c_Numbers.size() + u32_NumDropped) == mu32_OVERFLOW_BURST_SIZE,
+           "written (" + C_SclString::IntToStr(c_Numbers.size()) + ") and dropped (" +
+           C_SclString::IntToStr(u32_NumDropped) + ") entries add up to logged entries");
+   for (uint32_t u32_Index = 1U; u32_Index < c_Numbers.size(); u32_Index++)
+   {
+      if (c_Numbers[u32_Index - 1U] >= c_Numbers[u32_Index])
+      {
+         m_Check(false, "written entries in logged order");
+         break;
+      }
+   }
+
+   m_RemoveFiles(mpcn_LOG_FILE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check size based rotation
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckRotation(void)
+{
+   const uint32_t u32_NUM_ENTRIES = 300U;
+   std::vector<uint32_t> c_Numbers;
+   std::string c_Content;
+
+   m_RemoveFiles(mpcn_ROTATION_LOG_FILE);
+   C_OscLoggingHandler::h_SetFileRotation(mu32_ROTATION_MAX_FILE_SIZE, mu32_ROTATION_NUM_BACKUPS);
+   C_OscLoggingHandler::h_SetCompleteLogFileLocation(mpcn_ROTATION_LOG_FILE);
+   C_OscLoggingHandler::h_SetWriteToFileActive(true, false, false, true);
+
+   //mix of entries written by the writer thread and by the logging thread
+   for (uint32_t u32_Entry = 0U; u32_Entry < u32_NUM_ENTRIES; u32_Entry++)
+   {
+      if ((u32_Entry % 7U) == 0U)
+      {
+         osc_write_log_warning("Check", "rotation " + C_SclString::IntToStr(u32_Entry));
+      }
+      else
+      {
+         osc_write_log_info("Check", "rotation " + C_SclString::IntToStr(u32_Entry));
+      }
+   }
+   C_OscLoggingHandler::h_Flush();
+
+   //oldest backup first
+   for (uint32_t u32_Backup = mu32_ROTATION_NUM_BACKUPS + 1U; u32_Backup > 0U; u32_Backup--)
+   {
+      const C_SclString c_Path = m_GetBackupPath(mpcn_ROTATION_LOG_FILE, u32_Backup - 1U);
+      const std::string c_File = m_ReadFile(c_Path);
+      const std::vector<uint32_t> c_FileNumbers = m_GetEntryNumbers(c_File, "rotation");
+
+      m_Check(TglFileExists(c_Path), "rotation: file exists: " + c_Path);
+      m_Check(c_File.size() <= mu32_ROTATION_MAX_FILE_SIZE, "rotation: file size limited: " + c_Path);
+      m_Check(c_FileNumbers.empty() == false, "rotation: file contains entries: " + c_Path);
+      c_Numbers.insert(c_Numbers.end(), c_FileNumbers.begin(), c_FileNumbers.end());
+   }
+   m_Check(TglFileExists(m_GetBackupPath(mpcn_ROTATION_LOG_FILE, mu32_ROTATION_NUM_BACKUPS + 1U)) == false,
+           "rotation: number of backups limited");
+   m_Check((c_Numbers.size() > 0U) && (c_Numbers.size() < u32_NUM_ENTRIES) &&
+           m_AreConsecutive(c_Numbers, u32_NUM_ENTRIES - static_cast<uint32_t>(c_Numbers.size()),
+                            static_cast<uint32_t>(c_Numbers.size())),
+           "rotation: consecutive entries up to the last one");
+
+   //no backups: full log file is discarded
+   C_OscLoggingHandler::h_SetWriteToFileActive(false);
+   m_RemoveFiles(mpcn_ROTATION_LOG_FILE);
+   C_OscLoggingHandler::h_SetFileRotation(mu32_ROTATION_MAX_FILE_SIZE, 0U);
+   C_OscLoggingHandler::h_SetWriteToFileActive(true, false, false, false);
+   for (uint32_t u32_Entry = 0U; u32_Entry < u32_NUM_ENTRIES; u32_Entry++)
+   {
+      osc_write_log_info("Check", "discard " + C_SclString::IntToStr(u32_Entry));
+   }
+   C_OscLoggingHandler::h_Flush();
+   c_Content = m_ReadFile(mpcn_ROTATION_LOG_FILE);
+   c_Numbers = m_GetEntryNumbers(c_Content, "discard");
+   m_Check(TglFileExists(m_GetBackupPath(mpcn_ROTATION_LOG_FILE, 1U)) == false, "rotation without backup: no backup");
+   m_Check(c_Content.size() <= mu32_ROTATION_MAX_FILE_SIZE, "rotation without backup: file size limited");
+   m_Check((c_Numbers.size() > 0U) &&
+           m_AreConsecutive(c_Numbers, u32_NUM_ENTRIES - static_cast<uint32_t>(c_Numbers.size()),
+                            static_cast<uint32_t>(c_Numbers.size())),
+           "rotation without backup: consecutive entries up to the last one");
+
+   C_OscLoggingHandler::h_SetWriteToFileActive(false);
+   C_OscLoggingHandler::h_SetFileRotation(0U, 0U);
+   m_RemoveFiles(mpcn_ROTATION_LOG_FILE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   C_OscLoggingHandler::h_SetWriteToConsoleActive(false);
+
+   m_CheckSynchronousWarnings();
+   m_CheckFlushAndClose();
+   m_CheckQueueOverflow();
+   m_CheckRotation();
+
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,473 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Compact read-only XML element table
+
+   Filled in one pass by C_OscXmlPullParser. Instead of a DOM with one heap object per element, attribute and text
+    node, elements and attributes are stored in flat arrays referencing each other by index.
+   Names are interned in the process wide C_OscXmlName pool, so looking up elements and attributes by name compares
+    pointers only. Attribute values and texts are stored zero terminated in one common character buffer.
+   Only what C_OscXmlParserBase needs for reading is kept: element hierarchy, names, attributes, the first text of
+    each element and line numbers. Comments, declarations and formatting white space are dropped.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp" //pre-compiled headers
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_OscXmlCompactTree.hpp"
+#include "C_OscXmlPullParser.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscXmlCompactTree::hu32_INVALID_INDEX = 0xFFFFFFFFUL;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Sets up empty table.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlCompactTree::C_OscXmlCompactTree(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all content and release memory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlCompactTree::Clear(void)
+{
+   //swap with empty containers to really release the memory:
+   std::vector<C_Element>().swap(mc_Elements);
+   std::vector<C_Attribute>().swap(mc_Attributes);
+   std::vector<char_t>().swap(mc_Strings);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse XML data into table
+
+   Previous content is replaced.
+
+   \param[in]  opcn_Data   XML text (does not need to be zero terminated)
+   \param[in]  ou32_Size   number of bytes in opcn_Data
+
+   \return
+   C_NO_ERR   data parsed
+   C_CONFIG   data is not a well-formed XML document (table is empty)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscXmlCompactTree::Parse(const char_t * const opcn_Data, const uint32_t ou32_Size)
+{
+   int32_t s32_Return = C_NO_ERR;
+   bool q_Done = false;
+   C_OscXmlPullParser c_Parser;
+
+   std::map<std::string, const char_t *> c_KnownNames; //avoids locking the name pool for every element
+   std::vector<uint32_t> c_OpenElements;    //element indices of currently open elements
+   std::vector<uint32_t> c_LastChildren;    //last element seen on each level; [0] is the document level
+   std::vector<bool> c_HasChildNodes;       //for each open element: were there any child nodes yet ?
+
+   this->Clear();
+   c_LastChildren.push_back(hu32_INVALID_INDEX);
+   c_Parser.SetData(opcn_Data, ou32_Size);
+
+   while (q_Done == false)
+   {
+      const C_OscXmlPullParser::E_Event e_Event = c_Parser.ReadNext();
+      const uint32_t u32_Depth = static_cast<uint32_t>(c_OpenElements.size());
+
+      switch (e_Event)
+      {
+      case C_OscXmlPullParser::eELEMENT_START:
+         {
+            C_Element c_Element;
+            const uint32_t u32_NewIndex = static_cast<uint32_t>(mc_Elements.size());
+
+            c_Element.pcn_Name = mh_GetName(c_Parser.GetName(), c_KnownNames);
+            c_Element.u32_Parent = (u32_Depth == 0U) ? hu32_INVALID_INDEX : c_OpenElements.back();
+            c_Element.u32_FirstChild = hu32_INVALID_INDEX;
+            c_Element.u32_NextSibling = hu32_INVALID_INDEX;
+            c_Element.u32_FirstAttribute = static_cast<uint32_t>(mc_Attributes.size());
+            c_Element.u32_NumAttributes = c_Parser.GetNumAttributes();
+            c_Element.u32_TextOffset = hu32_INVALID_INDEX;
+            c_Element.u32_LineNumber = c_Parser.GetLineNumber();
+
+            for (uint32_t u32_Attribute = 0U; u32_Attribute < c_Element.u32_NumAttributes; u32_Attribute++)
+            {
+               C_Attribute c_Attribute;
+               c_Attribute.pcn_Name = mh_GetName(c_Parser.GetAttributeName(u32_Attribute), c_KnownNames);
+               c_Attribute.u32_ValueOffset = m_AddString(c_Parser.GetAttributeValue(u32_Attribute));
+               mc_Attributes.push_back(c_Attribute);
+            }
+
+            //link with previous sibling resp. parent:
+            if (c_LastChildren[u32_Depth] != hu32_INVALID_INDEX)
+            {
+               mc_Elements[c_LastChildren[u32_Depth]].u32_NextSibling = u32_NewIndex;
+            }
+            else if (u32_Depth > 0U)
+            {
+               mc_Elements[c_OpenElements.back()].u32_FirstChild = u32_NewIndex;
+            }
+            else
+            {
+               //first element on document level
+            }
+            c_LastChildren[u32_Depth] = u32_NewIndex;
+            if (u32_Depth > 0U)
+            {
+               c_HasChildNodes.back() = true;
+            }
+            mc_Elements.push_back(c_Element);
+
+            //open new level:
+            c_OpenElements.push_back(u32_NewIndex);
+            c_HasChildNodes.push_back(false);
+            if (c_LastChildren.size() <= c_OpenElements.size())
+            {
+               c_LastChildren.push_back(hu32_INVALID_INDEX);
+            }
+            else
+            {
+               c_LastChildren[c_OpenElements.size()] = hu32_INVALID_INDEX;
+            }
+         }
+         break;
+      case C_OscXmlPullParser::eELEMENT_END:
+         c_OpenElements.pop_back();
+         c_HasChildNodes.pop_back();
+         break;
+      case C_OscXmlPullParser::eTEXT:
+         //only the text directly at the beginning of an element is its content (same as tinyxml2 GetText)
+         if ((u32_Depth > 0U) && (c_HasChildNodes.back() == false))
+         {
+            mc_Elements[c_OpenElements.back()].u32_TextOffset = m_AddString(c_Parser.GetText());
+         }
+         if (u32_Depth > 0U)
+         {
+            c_HasChildNodes.back() = true;
+         }
+         break;
+      case C_OscXmlPullParser::eOTHER:
+         if (u32_Depth > 0U)
+         {
+            c_HasChildNodes.back() = true;
+         }
+         break;
+      case C_OscXmlPullParser::eEND_OF_DATA:
+         q_Done = true;
+         break;
+      case C_OscXmlPullParser::eERROR:
+      default:
+         s32_Return = C_CONFIG;
+         q_Done = true;
+         break;
+      }
+   }
+
+   if (s32_Return == C_NO_ERR)
+   {
+      //the table will not grow anymore: drop reserve capacity
+      std::vector<C_Element>(mc_Elements).swap(mc_Elements);
+      std::vector<C_Attribute>(mc_Attributes).swap(mc_Attributes);
+      std::vector<char_t>(mc_Strings).swap(mc_Strings);
+   }
+   else
+   {
+      this->Clear();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get root element
+
+   \return
+   index of first element on document level (hu32_INVALID_INDEX if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetRootElement(void) const
+{
+   return (mc_Elements.size() > 0) ? 0U : hu32_INVALID_INDEX;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get parent element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   index of parent element (hu32_INVALID_INDEX for elements on document level or invalid ou32_Element)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetParentElement(const uint32_t ou32_Element) const
+{
+   return (ou32_Element < mc_Elements.size()) ? mc_Elements[ou32_Element].u32_Parent : hu32_INVALID_INDEX;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get first child element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   index of first child element with any name (hu32_INVALID_INDEX if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetFirstChildElement(const uint32_t ou32_Element) const
+{
+   return (ou32_Element < mc_Elements.size()) ? mc_Elements[ou32_Element].u32_FirstChild : hu32_INVALID_INDEX;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get first child element with name
+
+   \param[in]  ou32_Element   element index
+   \param[in]  orc_Name       name of child element
+
+   \return
+   index of child element (hu32_INVALID_INDEX if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetFirstChildElement(const uint32_t ou32_Element, const C_OscXmlName & orc_Name) const
+{
+   uint32_t u32_Child = this->GetFirstChildElement(ou32_Element);
+
+   if ((u32_Child != hu32_INVALID_INDEX) && (mc_Elements[u32_Child].pcn_Name != orc_Name.GetName()))
+   {
+      u32_Child = this->GetNextSiblingElement(u32_Child, orc_Name);
+   }
+   return u32_Child;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get next sibling element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   index of next element on the same level with any name (hu32_INVALID_INDEX if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetNextSiblingElement(const uint32_t ou32_Element) const
+{
+   return (ou32_Element < mc_Elements.size()) ? mc_Elements[ou32_Element].u32_NextSibling : hu32_INVALID_INDEX;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get next sibling element with name
+
+   \param[in]  ou32_Element   element index
+   \param[in]  orc_Name       name of sibling element
+
+   \return
+   index of next element on the same level with this name (hu32_INVALID_INDEX if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetNextSiblingElement(const uint32_t ou32_Element, const C_OscXmlName & orc_Name) const
+{
+   const char_t * const pcn_Name = orc_Name.GetName();
+   uint32_t u32_Sibling = this->GetNextSiblingElement(ou32_Element);
+
+   //interned names: comparing pointers is sufficient
+   while ((u32_Sibling != hu32_INVALID_INDEX) && (mc_Elements[u32_Sibling].pcn_Name != pcn_Name))
+   {
+      u32_Sibling = mc_Elements[u32_Sibling].u32_NextSibling;
+   }
+   return u32_Sibling;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name of element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   element name ("" for invalid index)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlCompactTree::GetName(const uint32_t ou32_Element) const
+{
+   return (ou32_Element < mc_Elements.size()) ? mc_Elements[ou32_Element].pcn_Name : "";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get text content of element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   NULL   element has no text content (or invalid index)
+   else   text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlCompactTree::GetText(const uint32_t ou32_Element) const
+{
+   const char_t * pcn_Text = NULL;
+
+   if ((ou32_Element < mc_Elements.size()) && (mc_Elements[ou32_Element].u32_TextOffset != hu32_INVALID_INDEX))
+   {
+      pcn_Text = &mc_Strings[mc_Elements[ou32_Element].u32_TextOffset];
+   }
+   return pcn_Text;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get line number of element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   line of start tag (0 for invalid index)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetLineNumber(const uint32_t ou32_Element) const
+{
+   return (ou32_Element < mc_Elements.size()) ? mc_Elements[ou32_Element].u32_LineNumber : 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of attributes of element
+
+   \param[in]  ou32_Element   element index
+
+   \return
+   number of attributes (0 for invalid index)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::GetNumAttributes(const uint32_t ou32_Element) const
+{
+   return (ou32_Element < mc_Elements.size()) ? mc_Elements[ou32_Element].u32_NumAttributes : 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get attribute name by index
+
+   \param[in]  ou32_Element   element index
+   \param[in]  ou32_Index     attribute index (0 .. GetNumAttributes() - 1)
+
+   \return
+   attribute name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlCompactTree::GetAttributeName(const uint32_t ou32_Element, const uint32_t ou32_Index) const
+{
+   const C_Attribute & rc_Attribute = mc_Attributes[mc_Elements[ou32_Element].u32_FirstAttribute + ou32_Index];
+
+   return rc_Attribute.pcn_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get attribute value by index
+
+   \param[in]  ou32_Element   element index
+   \param[in]  ou32_Index     attribute index (0 .. GetNumAttributes() - 1)
+
+   \return
+   attribute value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlCompactTree::GetAttributeValue(const uint32_t ou32_Element, const uint32_t ou32_Index) const
+{
+   const C_Attribute & rc_Attribute = mc_Attributes[mc_Elements[ou32_Element].u32_FirstAttribute + ou32_Index];
+
+   return &mc_Strings[rc_Attribute.u32_ValueOffset];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get attribute value by name
+
+   \param[in]  ou32_Element   element index
+   \param[in]  orc_Name       attribute name
+
+   \return
+   NULL   element has no attribute with this name (or invalid index)
+   else   attribute value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlCompactTree::GetAttribute(const uint32_t ou32_Element, const C_OscXmlName & orc_Name) const
+{
+   const char_t * pcn_Value = NULL;
+
+   if (ou32_Element < mc_Elements.size())
+   {
+      const C_Element & rc_Element = mc_Elements[ou32_Element];
+      if (rc_Element.u32_NumAttributes > 0U)
+      {
+         const char_t * const pcn_Name = orc_Name.GetName();
+         for (uint32_t u32_Index = 0U; (u32_Index < rc_Element.u32_NumAttributes) && (pcn_Value == NULL); u32_Index++)
+         {
+            const C_Attribute & rc_Attribute = mc_Attributes[rc_Element.u32_FirstAttribute + u32_Index];
+            if (rc_Attribute.pcn_Name == pcn_Name)
+            {
+               pcn_Value = &mc_Strings[rc_Attribute.u32_ValueOffset];
+            }
+         }
+      }
+   }
+   return pcn_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get interned name
+
+   \param[in]      orc_Name          name
+   \param[in,out]  orc_KnownNames    names interned during this parse run
+
+   \return
+   interned name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlCompactTree::mh_GetName(const std::string & orc_Name,
+                                               std::map<std::string, const char_t *> & orc_KnownNames)
+{
+   const char_t * pcn_Name;
+   const std::map<std::string, const char_t *>::const_iterator c_Iter = orc_KnownNames.find(orc_Name);
+
+   if (c_Iter != orc_KnownNames.end())
+   {
+      pcn_Name = c_Iter->second;
+   }
+   else
+   {
+      pcn_Name = C_OscXmlName::h_Intern(orc_Name.c_str());
+      orc_KnownNames[orc_Name] = pcn_Name;
+   }
+   return pcn_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add zero terminated string to string buffer
+
+   \param[in]  orc_String   string to add
+
+   \return
+   offset of string in buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlCompactTree::m_AddString(const std::string & orc_String)
+{
+   const uint32_t u32_Offset = static_cast<uint32_t>(mc_Strings.size());
+
+   mc_Strings.insert(mc_Strings.end(), orc_String.begin(), orc_String.end());
+   mc_Strings.push_back('\0');
+   return u32_Offset;
+}
@@ -0,0 +1,150 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Interned XML element and attribute name
+
+   All names are kept in one process wide pool: each distinct name is stored exactly once and never released.
+   Two names are equal exactly if their pool pointers are equal, so looking up elements and attributes by a
+    C_OscXmlName handle boils down to pointer comparisons.
+   Handles are meant to be created once (e.g. as static constants of a filer) and reused for all lookups.
+   The number of distinct names is bounded by the tags and attributes used in the file formats, so the pool stays
+    small.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp" //pre-compiled headers
+
+#include <cstring>
+#include <list>
+#include <set>
+#include <string>
+#include "stwtypes.hpp"
+#include "TglTasks.hpp"
+#include "C_OscXmlName.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_core;
+using stw::tgl::C_TglCriticalSection;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///lexical comparison of zero terminated strings
+class C_OscXmlName::C_NameLess
+{
+public:
+   bool operator ()(const char_t * const opcn_Name1, const char_t * const opcn_Name2) const
+   {
+      return std::strcmp(opcn_Name1, opcn_Name2) < 0;
+   }
+};
+
+///storage of all interned names
+class C_OscXmlName::C_NamePool
+{
+public:
+   C_TglCriticalSection c_CriticalSection;
+   std::list<std::string> c_Names;                       ///< storage; list elements never move
+   std::set<const char_t *, C_NameLess> c_NamePointers; ///< lookup of pointers into c_Names
+};
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name pool
+
+   Function local instance: handles might be created during static initialization of other modules.
+
+   \return
+   name pool
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlName::C_NamePool & C_OscXmlName::mh_GetPool(void)
+{
+   static C_NamePool hc_Pool;
+
+   return hc_Pool;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor
+
+   Interns the name.
+
+   \param[in]  opcn_Name   element or attribute name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscXmlName::C_OscXmlName(const char_t * const opcn_Name) :
+   mpcn_Name(h_Intern(opcn_Name))
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get interned name
+
+   \return
+   name text; equal names have equal pointers
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlName::GetName(void) const
+{
+   return mpcn_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compare handles
+
+   \param[in]  orc_Other   handle to compare with
+
+   \return
+   true    names are equal
+   false   names differ
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlName::operator ==(const C_OscXmlName & orc_Other) const
+{
+   return mpcn_Name == orc_Other.mpcn_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pool instance of name
+
+   Adds the name to the pool if it is not known yet.
+   Thread safe.
+
+   \param[in]  opcn_Name   name
+
+   \return
+   pointer to pool instance of name; valid until the end of the process
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlName::h_Intern(const char_t * const opcn_Name)
+{
+   const char_t * pcn_Interned;
+   C_NamePool & rc_Pool = mh_GetPool();
+
+   rc_Pool.c_CriticalSection.Acquire();
+   const std::set<const char_t *, C_NameLess>::const_iterator c_Iter = rc_Pool.c_NamePointers.find(opcn_Name);
+   if (c_Iter != rc_Pool.c_NamePointers.end())
+   {
+      pcn_Interned = *c_Iter;
+   }
+   else
+   {
+      rc_Pool.c_Names.push_back(opcn_Name);
+      pcn_Interned = rc_Pool.c_Names.back().c_str();
+      rc_Pool.c_NamePointers.insert(pcn_Interned);
+   }
+   rc_Pool.c_CriticalSection.Release();
+
+   return pcn_Interned;
+}
@@ -21,6 +21,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <algorithm>
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "TglFile.hpp"
@@ -261,110 +262,108 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteChangedValues(
             {
                uint32_t u32_ListCounter;
                uint32_t u32_Elementcounter;
-               uint16_t u16_AccessCount = 0U;
-
-               // Count the changed elements
+               uint32_t u32_ItEntry;
+               //changed elements of this datapool; write accesses sorted by address together with element index
+               std::vector<C_OscNodeDataPoolListElementId> c_Elements;
+               std::vector<std::pair<uint32_t, uint32_t> > c_Order;
+               std::vector<C_OscParamSetRawEntry> c_Entries;
+               std::vector<C_OscParamSetRawEntry> c_Blocks;
+               bool q_RangeOk = true;
+
+               // Collect and check the changed elements before anything is written
                for (u32_ListCounter = 0U; u32_ListCounter < pc_DataPool->c_Lists.size(); ++u32_ListCounter)
                {
-                  for (u32_Elementcounter = 0U;
-                       u32_Elementcounter < pc_DataPool->c_Lists[u32_ListCounter].c_Elements.size();
-                       ++u32_Elementcounter)
+                  const C_OscNodeDataPoolList & rc_List = pc_DataPool->c_Lists[u32_ListCounter];
+                  c_ElementId.u32_ListIndex = u32_ListCounter;
+                  for (u32_Elementcounter = 0U; u32_Elementcounter < rc_List.c_Elements.size(); ++u32_Elementcounter)
                   {
-                     if (pc_DataPool->c_Lists[u32_ListCounter].c_Elements[u32_Elementcounter].q_NvmValueChanged == true)
+                     const C_OscNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u32_Elementcounter];
+                     if (rc_Element.q_NvmValueChanged == true)
                      {
-                        // Element was changed and must be written.
-                        ++u16_AccessCount;
+                        if (rc_Element.CheckNvmValueRange() != C_NO_ERR)
+                        {
+                           q_RangeOk = false;
+                        }
+                        c_ElementId.u32_ElementIndex = u32_Elementcounter;
+                        c_Order.push_back(std::pair<uint32_t, uint32_t>(rc_Element.u32_NvmStartAddress,
+                                                                        static_cast<uint32_t>(c_Elements.size())));
+                        c_Elements.push_back(c_ElementId);
                      }
                   }
                }
 
-               if (u16_AccessCount > 0U)
+               if (q_RangeOk == false)
                {
-                  // Prepare the transaction for this datapool
+                  s32_Return = C_OVERFLOW;
+               }
+               else if (c_Elements.size() > 0U)
+               {
+                  std::vector<bool> c_Written(c_Elements.size(), false);
+                  uint32_t u32_BytesPlanned = 0U;
+                  uint32_t u32_BytesWritten = 0U;
+                  uint32_t u32_NextEntry = 0U;
+                  // cumulative end of each entry in the planned byte stream
+                  std::vector<uint32_t> c_EntryEnds;
+
+                  // Combine elements placed back to back in the NVM
+                  std::sort(c_Order.begin(), c_Order.end());
+                  c_Entries.resize(c_Order.size());
+                  c_EntryEnds.resize(c_Order.size());
+                  for (u32_ItEntry = 0U; u32_ItEntry < c_Order.size(); ++u32_ItEntry)
+                  {
+                     const C_OscNodeDataPoolListElementId & rc_Id = c_Elements[c_Order[u32_ItEntry].second];
+                     const C_OscNodeDataPoolListElement & rc_Element =
+                        pc_DataPool->c_Lists[rc_Id.u32_ListIndex].c_Elements[rc_Id.u32_ElementIndex];
+                     c_Entries[u32_ItEntry].u32_StartAddress = rc_Element.u32_NvmStartAddress;
+                     //convert to native endianness depending on the type ...
+                     this->m_GetContentAsBlob(rc_Element.c_NvmValue, c_Entries[u32_ItEntry].c_Bytes);
+                     u32_BytesPlanned += static_cast<uint32_t>(c_Entries[u32_ItEntry].c_Bytes.size());
+                     c_EntryEnds[u32_ItEntry] = u32_BytesPlanned;
+                  }
+                  C_OscDataDealerNvm::mh_PlanWriteBlocks(c_Entries, this->mpc_DiagProtocol->GetNvmWriteBlockSize(),
+                                                         c_Blocks);
+
+                  // Prepare the transaction for this datapool; each block is one access
                   s32_Return = this->mpc_DiagProtocol->NvmWriteStartTransaction(
                      static_cast<uint8_t>(u32_DataPoolCounter),
-                     u16_AccessCount);
-                  if (s32_Return == C_NO_ERR)
+                     static_cast<uint16_t>(c_Blocks.size()));
+                  // Adapt errorcode
+                  s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+
+                  for (uint32_t u32_ItBlock = 0U; (u32_ItBlock < c_Blocks.size()) && (s32_Return == C_NO_ERR);
+                       ++u32_ItBlock)
                   {
-                     // Write the concrete elements
-                     for (u32_ListCounter = 0U; u32_ListCounter < pc_DataPool->c_Lists.size(); ++u32_ListCounter)
+                     s32_Return = this->mpc_DiagProtocol->NvmWrite(c_Blocks[u32_ItBlock].u32_StartAddress,
+                                                                   c_Blocks[u32_ItBlock].c_Bytes, opu8_NrCode);
+                     // Adapt errorcode
+                     s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+                     if (s32_Return == C_NO_ERR)
                      {
-                        C_OscNodeDataPoolList * const pc_List = &pc_DataPool->c_Lists[u32_ListCounter];
-                        C_OscNodeDataPoolListId c_ListId;
-
-                        c_ElementId.u32_ListIndex = u32_ListCounter;
-                        c_ListId = c_ElementId;
-
-                        for (u32_Elementcounter = 0U;
-                             u32_Elementcounter < pc_List->c_Elements.size();
-                             ++u32_Elementcounter)
-                        {
-                           C_OscNodeDataPoolListElement * const pc_Element = &pc_List->c_Elements[u32_Elementcounter];
-
-                           // Check range if value was changed
-                           if (pc_Element->q_NvmValueChanged == true)
-                           {
-                              if (pc_Element->CheckNvmValueRange() == C_NO_ERR)
-                              {
-                                 std::vector<uint8_t> c_ElementData;
-
-                                 //convert to native endianness depending on the type ...
-                                 //no possible problem we did not check for already ...
-                                 if (this->mpc_DiagProtocol->GetEndianness() ==
-                                     C_OscDiagProtocolBase::mhu8_ENDIANNESS_BIG)
-                                 {
-                                    pc_Element->c_NvmValue.GetValueAsBigEndianBlob(c_ElementData);
-                                 }
-                                 else
-                                 {
-                                    pc_Element->c_NvmValue.GetValueAsLittleEndianBlob(c_ElementData);
-                                 }
-
-                                 // Element value was changed and is valid
-                                 s32_Return =
-                                    this->mpc_DiagProtocol->NvmWrite(pc_Element->u32_NvmStartAddress, c_ElementData,
-                                                                     opu8_NrCode);
-                                 // Adapt errorcode
-                                 s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
-
-                                 if (s32_Return == C_NO_ERR)
-                                 {
-                                    // Element written
-                                    // Return the entire element id
-                                    c_ElementId.u32_ElementIndex = u32_Elementcounter;
-                                    orc_ChangedElements.push_back(c_ElementId);
-
-                                    // Reset the flag
-                                    pc_Element->q_NvmValueChanged = false;
-
-                                    // Save the list index as changed list. Will be used by NvmSafeReadValues.
-                                    this->mc_ChangedLists.insert(c_ListId);
-                                 }
-                              }
-                              else
-                              {
-                                 s32_Return = C_OVERFLOW;
-                              }
-                           }
-
-                           if (s32_Return != C_NO_ERR)
-                           {
-                              // Service failed. Abort writing.
-                              break;
-                           }
-                        }
-
-                        if (s32_Return != C_NO_ERR)
+                        // Elements are written once all their bytes are written
+                        u32_BytesWritten += static_cast<uint32_t>(c_Blocks[u32_ItBlock].c_Bytes.size());
+                        while ((u32_NextEntry < c_EntryEnds.size()) &&
+                               (c_EntryEnds[u32_NextEntry] <= u32_BytesWritten))
                         {
-                           // Service failed. Abort writing.
-                           break;
+                           c_Written[c_Order[u32_NextEntry].second] = true;
+                           ++u32_NextEntry;
                         }
                      }
                   }
-                  else
+
+                  // Report written elements in datapool order (as they were found)
+                  for (u32_ItEntry = 0U; u32_ItEntry < c_Elements.size(); ++u32_ItEntry)
                   {
-                     // Start service failed. Adapt errorcode
-                     s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
+                     if (c_Written[u32_ItEntry] == true)
+                     {
+                        const C_OscNodeDataPoolListElementId & rc_Id = c_Elements[u32_ItEntry];
+                        C_OscNodeDataPoolList & rc_List = pc_DataPool->c_Lists[rc_Id.u32_ListIndex];
+                        // Return the entire element id
+                        orc_ChangedElements.push_back(rc_Id);
+                        // Reset the flag
+                        rc_List.c_Elements[rc_Id.u32_ElementIndex].q_NvmValueChanged = false;
+                        // Save the list index as changed list. Will be used by NvmSafeReadValues.
+                        this->mc_ChangedLists.insert(rc_Id);
+                     }
                   }
 
                   if (s32_Return == C_NO_ERR)
@@ -375,6 +374,10 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteChangedValues(
                      s32_Return = C_OscDataDealerNvm::mh_AdaptProtocolReturnValue(s32_Return);
                   }
                }
+               else
+               {
+                  //nothing changed in this datapool
+               }
 
                //Stop if service failure, continue with C_BUSY (don't stop if no elements found in first datapool)
                if ((s32_Return != C_NO_ERR) && (s32_Return != C_BUSY))
@@ -435,10 +438,13 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
       if (this->mc_ChangedLists.size() > 0)
       {
          std::set<C_OscNodeDataPoolListId>::const_iterator c_ItChangedList;
+         std::vector<C_OscNodeDataPoolList *> c_Lists;
+         std::vector<const C_OscNodeDataPoolList *> c_ListsToRead;
 
-         // Read all changed lists
+         s32_Return = C_NO_ERR;
+         // Collect all changed lists
          for (c_ItChangedList = this->mc_ChangedLists.begin();
-              c_ItChangedList != this->mc_ChangedLists.end();
+              (c_ItChangedList != this->mc_ChangedLists.end()) && (s32_Return == C_NO_ERR);
               ++c_ItChangedList)
          {
             if (((*c_ItChangedList).u32_DataPoolIndex < this->mc_NodeCopy.c_DataPools.size()) &&
@@ -448,7 +454,6 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
                C_OscNodeDataPoolList & rc_List =
                   this->mc_NodeCopy.c_DataPools[(*c_ItChangedList).u32_DataPoolIndex].c_Lists[(*c_ItChangedList).
                                                                                               u32_ListIndex];
-               std::vector<uint8_t> c_Values;
                uint32_t u32_ElementCounter;
 
                // Reset of all valid flags
@@ -456,30 +461,33 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeReadValues(const C_OscNode * (&orpc_NodeC
                {
                   rc_List.c_Elements[u32_ElementCounter].q_NvmValueIsValid = false;
                }
-
-               s32_Return = this->m_NvmReadListRaw(rc_List, c_Values, opu8_NrCode);
-
-               if (s32_Return == C_NO_ERR)
-               {
-                  // Store the read values into the copy without checking and updating the CRC.
-                  // The valid flag will be set to true if the element was read
-                  s32_Return = this->m_SaveDumpValuesToListValues(c_Values, rc_List);
-
-                  if (s32_Return == C_RD_WR)
-                  {
-                     // Remap the error
-                     s32_Return = C_RANGE;
-                  }
-               }
+               c_Lists.push_back(&rc_List);
+               c_ListsToRead.push_back(&rc_List);
             }
             else
             {
                s32_Return = C_RANGE;
             }
+         }
 
-            if (s32_Return != C_NO_ERR)
+         if (s32_Return == C_NO_ERR)
+         {
+            std::vector<std::vector<uint8_t> > c_Values;
+
+            // Read all changed lists; lists located back to back are read together
+            s32_Return = this->m_NvmReadListsRaw(c_ListsToRead, c_Values, opu8_NrCode);
+
+            for (uint32_t u32_ItList = 0U; (u32_ItList < c_Lists.size()) && (s32_Return == C_NO_ERR); ++u32_ItList)
             {
-               break;
+               // Store the read values into the copy without checking and updating the CRC.
+               // The valid flag will be set to true if the element was read
+               s32_Return = this->m_SaveDumpValuesToListValues(c_Values[u32_ItList], *c_Lists[u32_ItList]);
+
+               if (s32_Return == C_RD_WR)
+               {
+                  // Remap the error
+                  s32_Return = C_RANGE;
+               }
             }
          }
       }
@@ -1330,11 +1338,17 @@ int32_t C_OscDataDealerNvmSafe::NvmSafeWriteParameterSetFile(const C_SclString &
                tgl_assert(pc_Node != NULL);
                if (pc_Node != NULL)
                {
+                  std::vector<C_OscParamSetRawEntry> c_Blocks;
+
+                  //combine entries placed back to back; the order of the file (CRCs invalidated first) is kept
+                  C_OscDataDealerNvm::mh_PlanWriteBlocks(pc_Node->c_Entries,
+                                                         this->mpc_DiagProtocol->GetNvmWriteBlockSize(), c_Blocks);
+
                   //write the actual values:
-                  for (uint32_t u32_ItEntry = 0; u32_ItEntry < pc_Node->c_Entries.size(); u32_ItEntry++)
+                  for (uint32_t u32_ItBlock = 0; u32_ItBlock < c_Blocks.size(); u32_ItBlock++)
                   {
-                     const C_OscParamSetRawEntry & rc_Entry = pc_Node->c_Entries[u32_ItEntry];
-                     s32_Retval = this->mpc_DiagProtocol->NvmWrite(rc_Entry.u32_StartAddress, rc_Entry.c_Bytes, NULL);
+                     const C_OscParamSetRawEntry & rc_Block = c_Blocks[u32_ItBlock];
+                     s32_Retval = this->mpc_DiagProtocol->NvmWrite(rc_Block.u32_StartAddress, rc_Block.c_Bytes, NULL);
                      //Map error codes
                      switch (s32_Retval)
                      {
@@ -0,0 +1,412 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Record of inputs and outputs of previous code generations (implementation)
+
+   Used for incremental code generation: The code generated for one application only depends on the node and the
+   version of the generator. For each application the manifest stores a hash of these inputs (node properties,
+   Datapools, protocols, HALC configuration, ...) and the generated files with a hash of their content.
+   If the inputs did not change and all generated files are still there unmodified, the code generation for the
+   application can be skipped. All hashes are MD5 digests, so a changed input or file is not taken for an unchanged
+   one by accident.
+
+   Limitation: parameter set image files (.syde_psi) contain the time of their creation. So if an application
+   is generated again its parameter set image files are always written again, even if their data did not change.
+
+   The manifest is stored as INI file. If it cannot be read everything is generated again.
+   Access to the outputs is thread safe.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+
+#include "stwerrors.hpp"
+#include "TglFile.hpp"
+#include "C_SclIniFile.hpp"
+#include "C_SclStringList.hpp"
+#include "C_Md5Checksum.hpp"
+#include "C_OscXmlParser.hpp"
+#include "C_OscNodeFiler.hpp"
+#include "C_OscExportManifest.hpp"
+#include "C_OscLoggingHandler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::md5;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscExportManifest::mhu32_FORMAT_VERSION = 2U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscExportManifest::C_Outputs::C_Outputs(void) :
+   c_InputHash("")
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Empty manifest: nothing is up to date.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscExportManifest::C_OscExportManifest(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load manifest from file
+
+   Replaces the current content. On error the manifest is empty.
+
+   \param[in]  orc_FilePath   Path of manifest file
+
+   \return
+   C_NO_ERR    manifest loaded
+   C_RANGE     file does not exist
+   C_CONFIG    file has unknown format version or invalid content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscExportManifest::LoadFromFile(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   std::map<C_SclString, C_Outputs> c_Outputs;
+
+   if (TglFileExists(orc_FilePath) == false)
+   {
+      s32_Retval = C_RANGE;
+   }
+   else
+   {
+      try
+      {
+         C_SclIniFile c_Ini(orc_FilePath);
+         if (c_Ini.ReadString("Manifest", "Version", "") != C_SclString::IntToStr(mhu32_FORMAT_VERSION))
+         {
+            s32_Retval = C_CONFIG;
+         }
+         else
+         {
+            const int32_t s32_NumOutputs = c_Ini.ReadInteger("Manifest", "NumOutputs", 0);
+            for (int32_t s32_Output = 0; s32_Output < s32_NumOutputs; s32_Output++)
+            {
+               const C_SclString c_Section = "Output" + C_SclString::IntToStr(s32_Output);
+               const C_SclString c_Path = c_Ini.ReadString(c_Section, "Path", "");
+               const int32_t s32_NumFiles = c_Ini.ReadInteger(c_Section, "NumFiles", 0);
+               C_Outputs c_Entry;
+
+               //entries with missing hashes are never up to date
+               c_Entry.c_InputHash = c_Ini.ReadString(c_Section, "InputHash", "");
+               for (int32_t s32_File = 0; s32_File < s32_NumFiles; s32_File++)
+               {
+                  const C_SclString c_Index = C_SclString::IntToStr(s32_File);
+                  c_Entry.c_Files.push_back(c_Ini.ReadString(c_Section, "File" + c_Index, ""));
+                  c_Entry.c_FileHashes.push_back(c_Ini.ReadString(c_Section, "FileHash" + c_Index, ""));
+               }
+               c_Outputs[c_Path] = c_Entry;
+            }
+         }
+      }
+      catch (...)
+      {
+         s32_Retval = C_CONFIG;
+      }
+   }
+
+   if (s32_Retval != C_NO_ERR)
+   {
+      c_Outputs.clear();
+      if (s32_Retval == C_CONFIG)
+      {
+         osc_write_log_warning("Code generation manifest", "Could not read manifest \"" + orc_FilePath +
+                               "\". Generating all code again.");
+      }
+   }
+
+   this->mc_CriticalSection.Acquire();
+   this->mc_Outputs = c_Outputs;
+   this->mc_CriticalSection.Release();
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Save manifest to file
+
+   The file is written to a temporary file first which then replaces the existing manifest.
+
+   \param[in]  orc_FilePath   Path of manifest file
+
+   \return
+   C_NO_ERR    manifest saved
+   C_RD_WR     could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscExportManifest::SaveToFile(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   const C_SclString c_TemporaryFilePath = orc_FilePath + ".tmp";
+   C_SclIniFile c_Ini(""); //in-memory file
+   C_SclStringList c_Lines;
+   int32_t s32_Output = 0;
+
+   c_Ini.WriteString("Manifest", "Version", C_SclString::IntToStr(mhu32_FORMAT_VERSION));
+
+   this->mc_CriticalSection.Acquire();
+   c_Ini.WriteInteger("Manifest", "NumOutputs", static_cast<int32_t>(this->mc_Outputs.size()));
+   for (std::map<C_SclString, C_Outputs>::const_iterator c_It = this->mc_Outputs.begin();
+        c_It != this->mc_Outputs.end(); ++c_It)
+   {
+      const C_SclString c_Section = "Output" + C_SclString::IntToStr(s32_Output);
+      c_Ini.WriteString(c_Section, "Path", c_It->first);
+      c_Ini.WriteString(c_Section, "InputHash", c_It->second.c_InputHash);
+      c_Ini.WriteInteger(c_Section, "NumFiles", static_cast<int32_t>(c_It->second.c_Files.size()));
+      for (uint32_t u32_File = 0U; u32_File < c_It->second.c_Files.size(); u32_File++)
+      {
+         const C_SclString c_Index = C_SclString::IntToStr(u32_File);
+         c_Ini.WriteString(c_Section, "File" + c_Index, c_It->second.c_Files[u32_File]);
+         c_Ini.WriteString(c_Section, "FileHash" + c_Index, c_It->second.c_FileHashes[u32_File]);
+      }
+      s32_Output++;
+   }
+   this->mc_CriticalSection.Release();
+
+   c_Ini.GetFileAsStringList(c_Lines);
+   try
+   {
+      c_Lines.SaveToFile(c_TemporaryFilePath);
+      if (TglRenameFile(c_TemporaryFilePath, orc_FilePath) != 0)
+      {
+         s32_Retval = C_RD_WR;
+      }
+   }
+   catch (...)
+   {
+      s32_Retval = C_RD_WR;
+   }
+
+   if (s32_Retval != C_NO_ERR)
+   {
+      (void)std::remove(c_TemporaryFilePath.c_str());
+      osc_write_log_error("Code generation manifest", "Could not write manifest \"" + orc_FilePath + "\".");
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether the generated code of one application is up to date
+
+   Up to date means:
+   * the manifest has an entry for the output path with the same input hash
+   * all files of the entry still exist with unchanged content
+
+   \param[in]   orc_OutputPath   Output path of application
+   \param[in]   orc_InputHash    Hash of current inputs (see h_CalcInputHash)
+   \param[out]  orc_Files        Files generated for the application (only valid if true is returned)
+
+   \return
+   true     up to date; code generation can be skipped
+   false    code needs to be generated
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscExportManifest::IsUpToDate(const C_SclString & orc_OutputPath, const C_SclString & orc_InputHash,
+                                     std::vector<C_SclString> & orc_Files)
+{
+   bool q_UpToDate = false;
+   C_Outputs c_Entry;
+
+   this->mc_CriticalSection.Acquire();
+   const std::map<C_SclString, C_Outputs>::const_iterator c_It = this->mc_Outputs.find(orc_OutputPath);
+   if ((c_It != this->mc_Outputs.end()) && (orc_InputHash.IsEmpty() == false) &&
+       (c_It->second.c_InputHash == orc_InputHash))
+   {
+      c_Entry = c_It->second;
+      q_UpToDate = true;
+   }
+   this->mc_CriticalSection.Release();
+
+   //check files outside of the critical section; other threads might check their files in the meantime
+   for (uint32_t u32_File = 0U; (u32_File < c_Entry.c_Files.size()) && (q_UpToDate == true); u32_File++)
+   {
+      C_SclString c_Hash;
+      if ((mh_CalcFileHash(c_Entry.c_Files[u32_File], c_Hash) != C_NO_ERR) ||
+          (c_Hash != c_Entry.c_FileHashes[u32_File]))
+      {
+         q_UpToDate = false;
+      }
+   }
+
+   if (q_UpToDate == true)
+   {
+      orc_Files = c_Entry.c_Files;
+   }
+
+   return q_UpToDate;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store generated files of one application
+
+   To be called after successful code generation.
+   The content hashes of the files are calculated here. If a file cannot be read or the input hash is empty the
+   entry is removed, so the next run generates the code again.
+
+   \param[in]  orc_OutputPath   Output path of application
+   \param[in]  orc_InputHash    Hash of inputs the code was generated from (see h_CalcInputHash)
+   \param[in]  orc_Files        Generated files
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscExportManifest::SetOutputs(const C_SclString & orc_OutputPath, const C_SclString & orc_InputHash,
+                                     const std::vector<C_SclString> & orc_Files)
+{
+   C_Outputs c_Entry;
+   bool q_Valid = (orc_InputHash.IsEmpty() == false);
+
+   c_Entry.c_InputHash = orc_InputHash;
+   c_Entry.c_Files = orc_Files;
+   c_Entry.c_FileHashes.resize(orc_Files.size());
+   for (uint32_t u32_File = 0U; u32_File < orc_Files.size(); u32_File++)
+   {
+      if (mh_CalcFileHash(orc_Files[u32_File], c_Entry.c_FileHashes[u32_File]) != C_NO_ERR)
+      {
+         q_Valid = false;
+      }
+   }
+
+   if (q_Valid == true)
+   {
+      this->mc_CriticalSection.Acquire();
+      this->mc_Outputs[orc_OutputPath] = c_Entry;
+      this->mc_CriticalSection.Release();
+   }
+   else
+   {
+      this->RemoveOutputs(orc_OutputPath);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove entry of one application
+
+   To be called if the code generation failed, so the next run will generate the code again.
+
+   \param[in]  orc_OutputPath   Output path of application
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscExportManifest::RemoveOutputs(const C_SclString & orc_OutputPath)
+{
+   this->mc_CriticalSection.Acquire();
+   (void)this->mc_Outputs.erase(orc_OutputPath);
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Calculate hash of all inputs of the code generation for one application
+
+   The node contains everything the generators use (properties, interfaces, Datapools, protocols, applications,
+   HALC configuration, ...). The generator version covers changes of the generators themselves.
+
+   The node is serialized with the system definition file format (all parts in one XML string); the MD5 digest
+   is calculated over this string, the generator version, the application index and the node hash (which also
+   covers data which is not saved with the node like the device definition).
+
+   \param[in]  orc_Node                 Node to generate code for
+   \param[in]  ou16_ApplicationIndex    Application to generate code for
+   \param[in]  orc_GeneratorVersion     Version of generator (should change with each build of the generator)
+
+   \return
+   MD5 digest of inputs
+   Empty string if the node could not be serialized (code is always generated)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscExportManifest::h_CalcInputHash(const C_OscNode & orc_Node, const uint16_t ou16_ApplicationIndex,
+                                                 const C_SclString & orc_GeneratorVersion)
+{
+   C_SclString c_Hash;
+   C_SclString c_NodeContent;
+   C_OscXmlParser c_XmlParser;
+   std::map<uint32_t, C_SclString> c_NodeIndicesToNameMap;
+   uint32_t u32_NodeHash = 0xFFFFFFFFU;
+
+   //CANopen managers refer to other nodes; only their indexes are known here
+   for (std::map<uint8_t, C_OscCanOpenManagerInfo>::const_iterator c_ItManager = orc_Node.c_CanOpenManagers.begin();
+        c_ItManager != orc_Node.c_CanOpenManagers.end(); ++c_ItManager)
+   {
+      for (std::map<C_OscCanInterfaceId, C_OscCanOpenManagerDeviceInfo>::const_iterator c_ItDevice =
+              c_ItManager->second.c_CanOpenDevices.begin();
+           c_ItDevice != c_ItManager->second.c_CanOpenDevices.end(); ++c_ItDevice)
+      {
+         c_NodeIndicesToNameMap[c_ItDevice->first.u32_NodeIndex] =
+            "node" + C_SclString::IntToStr(c_ItDevice->first.u32_NodeIndex);
+      }
+   }
+
+   (void)c_XmlParser.CreateAndSelectNodeChild("node");
+   //empty base path: all parts are stored in the XML content instead of separate files
+   if (C_OscNodeFiler::h_SaveNode(orc_Node, c_XmlParser, "", NULL, c_NodeIndicesToNameMap) == C_NO_ERR)
+   {
+      C_SclString c_Input;
+
+      c_XmlParser.SaveToString(c_NodeContent);
+      orc_Node.CalcHash(u32_NodeHash);
+      c_Input = orc_GeneratorVersion + "\n" + C_SclString::IntToStr(ou16_ApplicationIndex) + "\n" +
+                C_SclString::IntToStr(u32_NodeHash) + "\n" + c_NodeContent;
+      c_Hash = C_Md5Checksum::GetMD5(reinterpret_cast<const uint8_t *>(c_Input.c_str()), c_Input.Length());
+   }
+   else
+   {
+      osc_write_log_warning("Code generation manifest", "Could not serialize node \"" +
+                            orc_Node.c_Properties.c_Name + "\". Generating its code again.");
+   }
+
+   return c_Hash;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Calculate hash of file content
+
+   \param[in]   orc_FilePath   Path of file
+   \param[out]  orc_Hash       MD5 of file content
+
+   \return
+   C_NO_ERR   hash calculated
+   C_RD_WR    file does not exist or could not be read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscExportManifest::mh_CalcFileHash(const C_SclString & orc_FilePath, C_SclString & orc_Hash)
+{
+   int32_t s32_Retval = C_RD_WR;
+
+   orc_Hash = "";
+   if (TglFileExists(orc_FilePath) == true)
+   {
+      //empty on read error
+      orc_Hash = C_Md5Checksum::GetMD5(orc_FilePath);
+      if (orc_Hash.IsEmpty() == false)
+      {
+         s32_Retval = C_NO_ERR;
+      }
+   }
+   return s32_Retval;
+}
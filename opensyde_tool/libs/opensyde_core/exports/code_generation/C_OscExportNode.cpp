@@ -16,6 +16,7 @@
 #include "stwerrors.hpp"
 #include "C_OscExportUti.hpp"
 #include "C_OscExportNode.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_OscExportDataPool.hpp"
 #include "C_OscExportCommunicationStack.hpp"
 #include "C_OscExportCanOpenConfig.hpp"
@@ -82,6 +83,7 @@ int32_t C_OscExportNode::h_CreateSourceCode(const C_OscNode & orc_Node, const ui
                                             const C_SclString & orc_ExportToolName,
                                             const C_SclString & orc_ExportToolVersion)
 {
+   const C_OscTraceScope c_TraceScope("Code generation", "Node", orc_Node.c_Properties.c_Name);
    int32_t s32_Retval = C_NO_ERR;
 
    orc_Files.clear();
@@ -192,6 +194,7 @@ int32_t C_OscExportNode::mh_CreateOsyInitCode(const C_OscNode & orc_Node, const
                                               const C_SclString & orc_Path, std::vector<C_SclString> & orc_Files,
                                               const C_SclString & orc_ExportToolInfo)
 {
+   const C_OscTraceScope c_TraceScope("Code generation", "openSYDE server initialization");
    int32_t s32_Retval;
 
    bool q_CreateDpdInit;
@@ -238,6 +241,7 @@ int32_t C_OscExportNode::mh_CreateDatapoolCode(const C_OscNode & orc_Node, const
                                                const C_SclString & orc_Path, std::vector<C_SclString> & orc_Files,
                                                const C_SclString & orc_ExportToolInfo)
 {
+   const C_OscTraceScope c_TraceScope("Code generation", "Datapools");
    int32_t s32_Retval = C_NO_ERR;
 
    //index of Datapool within this application (as there can be Datapools owned by other applications
@@ -390,6 +394,7 @@ int32_t C_OscExportNode::mh_CreateCommStackCode(const C_OscNode & orc_Node, cons
                                                 const C_SclString & orc_Path, std::vector<C_SclString> & orc_Files,
                                                 const C_SclString & orc_ExportToolInfo)
 {
+   const C_OscTraceScope c_TraceScope("Code generation", "COMM stack");
    int32_t s32_Retval = C_NO_ERR;
 
    for (uint32_t u32_ItProtocol = 0U; u32_ItProtocol < orc_Node.c_ComProtocols.size(); ++u32_ItProtocol)
@@ -494,6 +499,7 @@ int32_t C_OscExportNode::mh_CreateHalConfigCode(const C_OscNode & orc_Node, cons
                                                 const C_SclString & orc_Path, std::vector<C_SclString> & orc_Files,
                                                 const C_SclString & orc_ExportToolInfo)
 {
+   const C_OscTraceScope c_TraceScope("Code generation", "HAL configuration");
    int32_t s32_Retval = C_NO_ERR;
 
    if (orc_Node.c_HalcConfig.IsClear() == false)
@@ -564,6 +570,7 @@ int32_t C_OscExportNode::mh_CreateHalNvmData(const C_OscNode & orc_Node, const u
                                              const C_SclString & orc_ExportToolName,
                                              const C_SclString & orc_ExportToolVersion)
 {
+   const C_OscTraceScope c_TraceScope("Code generation", "HAL NVM data");
    int32_t s32_Retval = C_NO_ERR;
 
    if (orc_Node.c_HalcConfig.IsClear() == false)
@@ -63,7 +63,8 @@ int32_t C_OscHalcDefFiler::h_LoadFile(C_OscHalcDefBase & orc_IoData, const C_Scl
    if (TglFileExists(orc_Path) == true)
    {
       C_OscXmlParserLog c_XmlParser;
-      s32_Retval = c_XmlParser.LoadFromFile(orc_Path);
+      //the file is only read: no need for a full DOM
+      s32_Retval = c_XmlParser.LoadFromFileReadOnly(orc_Path);
       if (s32_Retval == C_NO_ERR)
       {
          c_XmlParser.SetLogHeading("Loading HALC definition");
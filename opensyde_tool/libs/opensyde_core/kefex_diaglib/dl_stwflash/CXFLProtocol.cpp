@@ -20,6 +20,7 @@
 #include "CXFLProtocol.hpp"
 #include "TglTime.hpp"
 #include "TglUtils.hpp"
+#include "TglTasks.hpp"
 #include "stw_can.hpp"
 #include "DLLocalize.hpp"
 
@@ -151,6 +152,8 @@ static const uint8_t mu8_COMMAND_ERR      = 0xFFU;
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
+//several protocol instances may send via the same dispatcher from different threads (one thread per node)
+static C_TglCriticalSection mc_SendCriticalSection;
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
@@ -642,6 +645,9 @@ int32_t C_XFLProtocol::ProgFlash(void)
 /*! \brief   Send one hex file line to server ECU
 
    Send one hex file line to the server.
+   The server confirms each line with its checksum, so only one line can be in flight.
+   Its frames are sent back-to-back (unless an inter-frame delay is configured).
+   If the server reports a checksum error the line is sent again right away.
    For compatibility reasons ou32_TimeOut will only be used if it is greater than TIMEOUT_FLASH.
    Otherwise TIMEOUT_FLASH will be used.
 
@@ -666,6 +672,7 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
    int32_t s32_RemainingLength;
    int32_t s32_Return;
    uint32_t u32_StartTime;
+   bool q_SendAgain;
    T_STWCAN_Msg_RX t_RXMsg;
    static const uint16_t hu16_MAX_TRIES = 5U;
 
@@ -703,7 +710,7 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
             return C_COM;
          }
          s32_RemainingLength -= u8_SendNow;
-         if (s32_RemainingLength > 0)
+         if ((s32_RemainingLength > 0) && (ou32_InterFrameDelayUs != 0U))
          {
             TRG_WaitMicroSeconds(ou32_InterFrameDelayUs); // TX-delay between individual messages
             TRG_HandleSystemMessages();
@@ -711,11 +718,11 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
       }
 
       u32_StartTime = TglGetTickCount();
+      q_SendAgain = false;
 
       //evaluate response from ECU
       do
       {
-         TRG_WaitMicroSeconds(ou32_InterFrameDelayUs);
          TRG_HandleSystemMessages();
          if (m_CANGetResponse(t_RXMsg) == C_NO_ERR)
          {
@@ -741,6 +748,7 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
                         mu8_LastError = t_RXMsg.au8_Data[2];
                         return C_NOACT;
                      }
+                     q_SendAgain = true; //no need to wait for the timeout
                      break;
                   default:
                      mu8_LastError = t_RXMsg.au8_Data[2];
@@ -752,8 +760,14 @@ int32_t C_XFLProtocol::m_SendHexLine(const uint8_t * const opu8_HexLine, const u
                }
             }
          }
+         else
+         {
+            //nothing received yet; wait for the response without burning CPU time
+            mc_Config.pc_CANDispatcher->WaitForRxFrame(1U);
+         }
       }
-      while ((u32_Tries < hu16_MAX_TRIES) && ((TglGetTickCount() - u32_StartTime) < u32_TimeOut));
+      while ((u32_Tries < hu16_MAX_TRIES) && (q_SendAgain == false) &&
+             ((TglGetTickCount() - u32_StartTime) < u32_TimeOut));
       TRG_HandleSystemMessages();
    }
    while (u32_Tries < hu16_MAX_TRIES);
@@ -2326,8 +2340,13 @@ uint8_t C_XFLProtocol::GetLastXFLError(void) const
 
 int32_t C_XFLProtocol::m_CANSendMessage(const T_STWCAN_Msg_TX & orc_MSG)
 {
+   int32_t s32_Return;
+
    tgl_assert(mc_Config.pc_CANDispatcher != NULL);
-   return mc_Config.pc_CANDispatcher->CAN_Send_Msg(orc_MSG);
+   mc_SendCriticalSection.Acquire();
+   s32_Return = mc_Config.pc_CANDispatcher->CAN_Send_Msg(orc_MSG);
+   mc_SendCriticalSection.Release();
+   return s32_Return;
 }
 
 //************************************************************************
@@ -2349,7 +2368,7 @@ int32_t C_XFLProtocol::m_CANSendMessage(void)
    {
       return -1;
    }
-   return mc_Config.pc_CANDispatcher->CAN_Send_Msg(mc_CanWriteMessage);
+   return this->m_CANSendMessage(mc_CanWriteMessage);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
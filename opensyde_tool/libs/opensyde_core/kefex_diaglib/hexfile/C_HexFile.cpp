@@ -28,13 +28,17 @@
 
 #include <cstring>
 #include <cctype>
+#include <algorithm>
 
 #include "C_HexFile.hpp"
 #include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "TglFile.hpp"
 
 //------------------------------------------------------------------------
 
 using namespace stw::hex_file;
+using stw::tgl::C_TglFileMapping;
 
 //------------------------------------------------------------------------
 
@@ -44,9 +48,6 @@ static const int32_t ms32_HEXFILE_IHEX  =   0; // GetFileType: file is intel-hex
 static const int32_t ms32_HEXFILE_SREC  =   1; // GetFileType: file is s-record
 
 static const uint32_t mu32_HEXBUFFER_SIZE  = 530U;     // buffer size for hex line data
-static const int32_t ms32_INTELHEX_MAX    = (522 + 2); // max size of intel-hex line + \r\n
-
-static const int32_t ms32_SRECORD_MAX  = 517; // max size of s-record line
 
 static const uint8_t mu8_MIN_RECSIZE          =   8U;
 static const uint8_t mu8_MAX_RECSIZE          =   255U;
@@ -82,13 +83,37 @@ static const uint8_t mu8_SREC_ADR     =   0x01U;
 
 static const uint32_t mu32_XADR32_MASK  =   0xFFFF0000U;
 
+static const uint32_t mu32_DUMP_RECORD_SIZE = 32U; // record size used when taking over data from a memory dump
+
+// value of ASCII hex digits; 0xFF: no hex digit
+static const uint8_t mau8_HEX_DIGIT_VALUES[256] =
+{
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U, 0x09U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x0FU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+   0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU
+};
+
 static const uint32_t mu32_MAX_DWORD    =   0xFFFFFFFFU;
 static const uint32_t mu32_MIN_DWORD    =   0x00000000U;
 
 //------------------------------------------------------------------------
 
 C_HexFile::C_HexFile(void) :
-   mu32_LastOverlayErrorAddress(0U)
+   mu32_LastOverlayErrorAddress(0U),
+   mu32_DataGeneration(0U)
 {
    m_InitHexFile();
 }
@@ -107,140 +132,248 @@ uint32_t C_HexFile::ByteCount(void) const
    return mu32_NumRawBytes;
 }
 
-//************************************************************************
-// .FUNCTION    LoadFromFile
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//  - HexFile.LoadFromFile load a HEX file into memory
-//    internal hex format is intel-hex
-//    all records are sorted by address, Intel16 offset commands are
-//    converted into Intel32 offset commands
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_FileName      file name (C-string)
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              WRN_NO_EOF_RECORD       0x10000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//              ERR_HEXLINE_COMMAND     0xAxxxxxxx
-//              ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
-//              ERR_CANT_OPEN_FILE      0xF0000000
-//
-//              xxxxxxx = error line number of input file
-//************************************************************************
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Load hex file into memory
+
+   Supported formats: Intel HEX and Motorola S-Record.
+
+   The file is memory mapped and parsed in one pass. The data records are collected in one continuous buffer and then
+    sorted by address. The memory dump (see GetDataDump()) is created directly from the sorted records.
+   The line based representation (as required by LineInit(), NextLine(), SaveToFile() ...) is only created on demand.
+   Its content is the same as it would be after parsing line by line:
+   - all records are sorted by address
+   - Intel16 offset commands are converted into Intel32 offset commands
+   - S-Records are converted into Intel HEX records
+
+   \param[in]  opcn_FileName    file name (C-string)
+
+   \return
+   NO_ERR                  0x00000000
+   WRN_NO_EOF_RECORD       0x10000000
+   WRN_RECORD_OVERLAY      0x2xxxxxxx (xxxxxxx = lowest 7 nibbles of the offending address)
+   ERR_HEXLINE_SYNTAX      0x8xxxxxxx
+   ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
+   ERR_HEXLINE_COMMAND     0xAxxxxxxx
+   ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
+   ERR_CANT_OPEN_FILE      0xF0000000
+
+   xxxxxxx = error line number of input file (unless stated otherwise)
+*/
+//-----------------------------------------------------------------------------
 uint32_t C_HexFile::LoadFromFile(const char_t * const opcn_FileName)
 {
    uint32_t u32_Error;
-   int32_t s32_FileType;
-
-   std::FILE * pc_File;
+   C_TglFileMapping c_File;
 
    this->Clear();
-   pc_File = std::fopen(opcn_FileName, "rt");
 
-   if (pc_File == NULL)
+   if (c_File.Map(opcn_FileName) != stw::errors::C_NO_ERR)
    {
       u32_Error = ERR_CANT_OPEN_FILE;
    }
    else
    {
-      u32_Error = this->m_GetFileType(pc_File, s32_FileType); // get hex file type
-      // intel-hex, s-record, ...
+      //raw data of all data records; the file contains two characters per byte so this is the upper limit
+      std::vector<uint8_t> c_DataPool;
+      const char_t * const pcn_Text = reinterpret_cast<const char_t *>(c_File.GetData());
+      const uint32_t u32_TextSize = c_File.GetSize();
+      int32_t s32_FileType;
+
+      try
+      {
+         c_DataPool.reserve(u32_TextSize / 2U);
+         u32_Error = this->m_GetFileType(pcn_Text, u32_TextSize, s32_FileType);
+      }
+      catch (...)
+      {
+         u32_Error = ERR_NOT_ENOUGH_MEMORY;
+      }
+
       if (u32_Error == NO_ERR)
       {
-         u32_Error = m_AddHexLine(":020000040000FA\n"); // init data with zero offset
+         switch (s32_FileType)
+         {
+         case ms32_HEXFILE_IHEX:
+            u32_Error = m_LoadIntelHex(pcn_Text, u32_TextSize, c_DataPool);
+            break;
+         case ms32_HEXFILE_SREC:
+            u32_Error = m_LoadSRecord(pcn_Text, u32_TextSize, c_DataPool);
+            break;
+         default:
+            u32_Error = ERR_HEXLINE_SYNTAX;
+            break;
+         }
+      }
+      c_File.Unmap();
+
+      if ((u32_Error & ERR_HEXLINE_SYNTAX) == 0U) // no error?
+      {
+         const uint32_t u32_Result = m_CreateImage(c_DataPool);
+         if (u32_Result != NO_ERR)
+         {
+            u32_Error = u32_Result;
+         }
+      }
+      else
+      {
+         this->Clear(); //do not keep incomplete data
+      }
+   }
 
-         if (u32_Error == NO_ERR)
+   if (u32_Error == NO_ERR)
+   {
+      u32_Error = this->Validate();
+   }
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Take over data from memory dump
+
+   Replaces the current content with the data of the given memory dump.
+   The dump will be available via GetDataDump() right away.
+   The line based representation is created on demand with records of 32 bytes (aligned to 32 byte boundaries).
+
+   Assumption: blocks of dump are sorted by address and do not overlap (as created by GetDataDump())
+
+   \param[in]  orc_Dump    memory dump to take over
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_NOT_ENOUGH_MEMORY   0xE0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::SetDataDump(const C_HexDataDump & orc_Dump)
+{
+   uint32_t u32_Error = NO_ERR;
+   uint32_t u32_NumLines = 1U; //EOF record
+   uint32_t u32_AdrOffs = 0U;  //offset records are only needed for non-zero offsets
+
+   this->Clear();
+
+   try
+   {
+      if (&orc_Dump != &mc_Dump)
+      {
+         mc_Dump = orc_Dump;
+      }
+
+      for (int32_t s32_Block = 0; s32_Block < mc_Dump.at_Blocks.GetLength(); s32_Block++)
+      {
+         const C_HexDataDumpBlock & rc_Block = mc_Dump.at_Blocks[s32_Block];
+         const uint32_t u32_BlockSize = static_cast<uint32_t>(rc_Block.au8_Data.GetLength());
+         uint32_t u32_Offset = 0U;
+
+         while (u32_Offset < u32_BlockSize)
          {
-            switch (s32_FileType)
+            //records end at multiples of the record size; so they never cross a 64kB boundary
+            T_HexRecord t_Record;
+            const uint32_t u32_Address = rc_Block.u32_AddressOffset + u32_Offset;
+            uint32_t u32_Length = mu32_DUMP_RECORD_SIZE - (u32_Address % mu32_DUMP_RECORD_SIZE);
+            if (u32_Length > (u32_BlockSize - u32_Offset))
             {
-            case ms32_HEXFILE_IHEX:
-               u32_Error = m_LoadIntelHex(pc_File);
-               break;
-            case ms32_HEXFILE_SREC:
-               u32_Error = m_LoadSRecord(pc_File);
-               break;
-            default:
-               u32_Error = ERR_HEXLINE_SYNTAX;
-               break;
+               u32_Length = u32_BlockSize - u32_Offset;
             }
+            t_Record.u32_Address = u32_Address;
+            t_Record.u32_DataIndex = 0U; //data will be taken from dump
+            t_Record.u8_Length = static_cast<uint8_t>(u32_Length);
+            mc_Records.push_back(t_Record);
 
-            (void)fclose(pc_File);
-
-            if ((u32_Error & ERR_HEXLINE_SYNTAX) == 0U) // no error?
+            if ((u32_Address & mu32_XADR32_MASK) != u32_AdrOffs)
             {
-               m_RemoveFirst(); // remove first element (zero offset)
+               u32_AdrOffs = (u32_Address & mu32_XADR32_MASK);
+               u32_NumLines++;
             }
+            u32_NumLines++;
+            u32_Offset += u32_Length;
          }
-         else
+
+         if (u32_BlockSize > 0U)
          {
-            //Release created file pointer
-            (void)fclose(pc_File);
+            if (rc_Block.u32_AddressOffset < mu32_MinAdr)
+            {
+               mu32_MinAdr = rc_Block.u32_AddressOffset;
+            }
+            if (((rc_Block.u32_AddressOffset + u32_BlockSize) - 1U) > mu32_MaxAdr)
+            {
+               mu32_MaxAdr = (rc_Block.u32_AddressOffset + u32_BlockSize) - 1U;
+            }
+            mu32_NumRawBytes += u32_BlockSize;
          }
       }
-      else
-      {
-         //Release created file pointer
-         (void)fclose(pc_File);
-      }
    }
-
-   mq_DumpIsDirty = true;
+   catch (...)
+   {
+      u32_Error = ERR_NOT_ENOUGH_MEMORY;
+   }
 
    if (u32_Error == NO_ERR)
    {
-      u32_Error = this->Validate();
+      mu8_MaxRecordLength = static_cast<uint8_t>(mu32_DUMP_RECORD_SIZE);
+      mu32_LineCountNew = u32_NumLines;
+      mq_LinesPending = true;
+      mq_DumpIsDirty = false;
+   }
+   else
+   {
+      this->Clear();
    }
    return u32_Error;
 }
 
-//************************************************************************
-// .FUNCTION    LoadIntelHex
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//  - HexFile.LoadIntelHex load a Intel HEX file into memory
-//    all records are sorted by address, Intel16 offset commands are
-//    converted into Intel32 offset commands
-//------------------------------------------------------------------------
-// .PARAMETERS  opt_File                file handle
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              WRN_NO_EOF_RECORD       0x10000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//              ERR_HEXLINE_COMMAND     0xAxxxxxxx
-//              ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
-//
-//              xxxxxxx = error line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_LoadIntelHex(std::FILE * const opt_File)
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Parse Intel HEX file content
+
+   All data records are appended to the record list; the actual data goes to orc_DataPool.
+   Data records that are located behind an Intel16 offset that is not aligned to 64kB are split at the 64kB boundaries
+    (so each record can be represented using Intel32 offset commands).
+
+   \param[in]     opcn_Text      file content
+   \param[in]     ou32_Size      size of file content in bytes
+   \param[in,out] orc_DataPool   raw data of all data records
+
+   \return
+   NO_ERR                  0x00000000
+   WRN_NO_EOF_RECORD       0x10000000
+   ERR_HEXLINE_SYNTAX      0x8xxxxxxx
+   ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
+   ERR_HEXLINE_COMMAND     0xAxxxxxxx
+   ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
+
+   xxxxxxx = error line number of input file
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_LoadIntelHex(const char_t * const opcn_Text, const uint32_t ou32_Size,
+                                   std::vector<uint8_t> & orc_DataPool)
 {
    uint32_t u32_Error = NO_ERR;
-   char_t acn_HexBuffer[mu32_HEXBUFFER_SIZE];
-   uint32_t u32_AdrNew;
+   uint8_t au8_Record[mu32_HEXBUFFER_SIZE / 2U];
    uint8_t u8_Command = mu8_CMD_DATA;
-   uint8_t u8_Len = 0U;
+   uint32_t u32_Position = 0U;
 
    mu8_MaxRecordLength = 0U;
 
-   while ((fgets(acn_HexBuffer, ms32_INTELHEX_MAX, opt_File)) != NULL)
+   while (u32_Position < ou32_Size)
    {
+      const char_t * const pcn_Line = &opcn_Text[u32_Position];
+      const uint32_t u32_LineLength = mh_GetLineLength(pcn_Line, ou32_Size - u32_Position);
+      uint8_t u8_Len;
+
+      u32_Position += (u32_LineLength + 1U); //skip line end
       mu32_LineCount++;
 
-      u32_Error = m_GetIHexCommand(acn_HexBuffer, u8_Command);
-      if (u32_Error == NO_ERR)
-      {
-         u32_Error = mh_GetByte(acn_HexBuffer, mu8_INTEL_LEN, u8_Len);
-      }
+      u32_Error = mh_DecodeIntelRecord(pcn_Line, u32_LineLength, au8_Record);
       if (u32_Error != NO_ERR)
       {
+         u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number
          break;
       }
 
+      u8_Len = au8_Record[mu8_INTEL_LEN];
+      u8_Command = au8_Record[mu8_INTEL_CMD];
       if (u8_Len > mu8_MaxRecordLength)
       {
          mu8_MaxRecordLength = u8_Len;
@@ -249,227 +382,708 @@ uint32_t C_HexFile::m_LoadIntelHex(std::FILE * const opt_File)
       switch (u8_Command)
       {
       case mu8_CMD_DATA:
-         u32_Error = m_GetIntelAddress(acn_HexBuffer, u8_Command, u32_AdrNew);
-         if (u32_Error == NO_ERR)
          {
-            if ((mu32_AdrOffs & ~mu32_XADR32_MASK) != 0)
+            const uint32_t u32_Address = mu32_AdrOffs + ((static_cast<uint32_t>(au8_Record[mu8_INTEL_ADRH]) << 8U) +
+                                                         au8_Record[mu8_INTEL_ADRL]);
+            const uint32_t u32_LenToBoundary = 0x10000U - (u32_Address & ~mu32_XADR32_MASK);
+
+            if (((mu32_AdrOffs & ~mu32_XADR32_MASK) != 0U) && (u8_Len > u32_LenToBoundary))
             {
-               // change XADR16 into XADR32 records
-               u32_Error = m_ConvRec16ToRec32(acn_HexBuffer);
+               // Intel16 record crossing a 64k page: split it into two Intel32 records
+               u32_Error = m_AddRecord(u32_Address, &au8_Record[mu8_INTEL_DAT],
+                                       static_cast<uint8_t>(u32_LenToBoundary), orc_DataPool);
+               if (u32_Error == NO_ERR)
+               {
+                  u32_Error = m_AddRecord(u32_Address + u32_LenToBoundary,
+                                          &au8_Record[mu8_INTEL_DAT + u32_LenToBoundary],
+                                          static_cast<uint8_t>(u8_Len - u32_LenToBoundary), orc_DataPool);
+               }
             }
             else
             {
-               m_SetDataPtr(u32_AdrNew);
-               u32_Error = m_AddHexLine(acn_HexBuffer);
+               u32_Error = m_AddRecord(u32_Address, &au8_Record[mu8_INTEL_DAT], u8_Len, orc_DataPool);
             }
             if (u32_Error == NO_ERR)
             {
                mu32_NumRawBytes += u8_Len;
             }
+            break;
          }
-         break;
-
       case mu8_CMD_XADR16:
       case mu8_CMD_XADR32:
-         u32_Error = m_GetIntelAddress(acn_HexBuffer, u8_Command, u32_AdrNew);
-         if (u32_Error == NO_ERR)
+         if (u8_Len < 2U)
+         {
+            u32_Error = ERR_HEXLINE_SYNTAX | (mu32_LineCount & ~ERR_MASK);
+         }
+         else
+         {
+            const uint32_t u32_Offset = (static_cast<uint32_t>(au8_Record[mu8_INTEL_DAT]) << 8U) +
+                                        au8_Record[mu8_INTEL_DAT + 1U];
+            mu32_AdrOffs = (u8_Command == mu8_CMD_XADR16) ? (u32_Offset << 4U) : (u32_Offset << 16U);
+         }
+         break;
+      default:
+         break;
+      }
+
+      if ((u32_Error != NO_ERR) || (u8_Command == mu8_CMD_EOF))
+      {
+         break;
+      }
+   }
+
+   if ((u8_Command != mu8_CMD_EOF) && (u32_Error == NO_ERR)) // no EOF record?
+   {
+      u32_Error = WRN_NO_EOF_RECORD; // set warning; EOF record will be added anyway
+   }
+
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Parse Motorola S-Record file content
+
+   All data records are appended to the record list; the actual data goes to orc_DataPool.
+
+   \param[in]     opcn_Text      file content
+   \param[in]     ou32_Size      size of file content in bytes
+   \param[in,out] orc_DataPool   raw data of all data records
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_HEXLINE_SYNTAX      0x8xxxxxxx
+   ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
+   ERR_HEXLINE_COMMAND     0xAxxxxxxx
+   ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
+
+   xxxxxxx = error line number of input file
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_LoadSRecord(const char_t * const opcn_Text, const uint32_t ou32_Size,
+                                  std::vector<uint8_t> & orc_DataPool)
+{
+   uint32_t u32_Error = NO_ERR;
+   uint8_t au8_Record[mu32_HEXBUFFER_SIZE / 2U];
+   uint8_t u8_RecordType;
+   uint32_t u32_Position = 0U;
+
+   mu8_MaxRecordLength = 0U;
+
+   while (u32_Position < ou32_Size)
+   {
+      const char_t * const pcn_Line = &opcn_Text[u32_Position];
+      const uint32_t u32_LineLength = mh_GetLineLength(pcn_Line, ou32_Size - u32_Position);
+
+      u32_Position += (u32_LineLength + 1U); //skip line end
+      mu32_LineCount++;
+
+      u32_Error = mh_DecodeSRecord(pcn_Line, u32_LineLength, au8_Record, u8_RecordType);
+      if (u32_Error == NO_ERR)
+      {
+         const uint8_t u8_Length = au8_Record[mu8_SREC_LEN];
+
+         if (u8_Length > mu8_MaxRecordLength)
          {
-            mu32_AdrOffs = u32_AdrNew;
-            if (m_SetXAdrPtr(u32_AdrNew & mu32_XADR32_MASK) != 0U)
+            mu8_MaxRecordLength = u8_Length;
+         }
+
+         if ((u8_RecordType == mu8_SREC_DATA16) || (u8_RecordType == mu8_SREC_DATA24) ||
+             (u8_RecordType == mu8_SREC_DATA32))
+         {
+            // number of address bytes is (record type + 1); there is one checksum byte at the end
+            const uint32_t u32_NumAddressBytes = static_cast<uint32_t>(u8_RecordType) + 1U;
+
+            if (u8_Length < (u32_NumAddressBytes + 1U))
             {
-               if (u8_Command == mu8_CMD_XADR16)
+               u32_Error = ERR_HEXLINE_SYNTAX;
+            }
+            else
+            {
+               const uint8_t u8_DataLength = static_cast<uint8_t>(u8_Length - (u32_NumAddressBytes + 1U));
+               uint32_t u32_Address = 0U;
+
+               for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < u32_NumAddressBytes; u32_ByteIndex++)
                {
-                  // convert XADR16 into XADR32 offset
-                  m_ConvOffs16To32(acn_HexBuffer);
+                  u32_Address = (u32_Address << 8U) + au8_Record[mu8_SREC_ADR + u32_ByteIndex];
                }
 
-               u32_Error = m_AddHexLine(acn_HexBuffer);
+               u32_Error = m_AddRecord(u32_Address, &au8_Record[mu8_SREC_ADR + u32_NumAddressBytes],
+                                       u8_DataLength, orc_DataPool);
+               if (u32_Error == NO_ERR)
+               {
+                  mu32_NumRawBytes += u8_DataLength;
+               }
             }
          }
-         break;
+      }
 
-      case mu8_CMD_EOF:
-         m_SetEOFPtr();
-         u32_Error = m_AddHexLine(acn_HexBuffer);
+      if (u32_Error != NO_ERR)
+      {
+         u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number info
          break;
+      }
+   }
 
-      default:
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Detect file type
+
+   Checks whether the first line of the file content is a valid Intel HEX or S-Record line.
+
+   \param[in]   opcn_Text        file content
+   \param[in]   ou32_Size        size of file content in bytes
+   \param[out]  ors32_FileType   detected type (ms32_HEXFILE_IHEX, ms32_HEXFILE_SREC)
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_HEXLINE_SYNTAX      0x80000000
+   ERR_HEXLINE_CHECKSUM    0x90000000
+   ERR_HEXLINE_COMMAND     0xA0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_GetFileType(const char_t * const opcn_Text, const uint32_t ou32_Size,
+                                  int32_t & ors32_FileType) const
+{
+   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
+   uint8_t au8_Record[mu32_HEXBUFFER_SIZE / 2U];
+
+   ors32_FileType = ms32_HEXFILE_ERR;
+
+   if (ou32_Size > 0U)
+   {
+      const uint32_t u32_LineLength = mh_GetLineLength(opcn_Text, ou32_Size);
+      uint8_t u8_Dummy;
+
+      if (opcn_Text[0] == ':') // line might be intel-hex?
+      {
+         u32_Error = mh_DecodeIntelRecord(opcn_Text, u32_LineLength, au8_Record);
+         if (u32_Error == NO_ERR)
+         {
+            ors32_FileType = ms32_HEXFILE_IHEX;
+         }
+      }
+      else if (opcn_Text[0] == 'S') // line might be s-record?
+      {
+         u32_Error = mh_DecodeSRecord(opcn_Text, u32_LineLength, au8_Record, u8_Dummy);
+         if (u32_Error == NO_ERR)
+         {
+            ors32_FileType = ms32_HEXFILE_SREC;
+         }
+      }
+      else
+      {
+         //unknown format
+      }
+   }
+
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Get length of one text line
+
+   \param[in]   opcn_Line        start of line
+   \param[in]   ou32_MaxLength   number of characters available from opcn_Line on
+
+   \return
+   number of characters up to (not including) the next line feed or the end of the available characters
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::mh_GetLineLength(const char_t * const opcn_Line, const uint32_t ou32_MaxLength)
+{
+   const void * const pv_LineEnd = std::memchr(opcn_Line, '\n', ou32_MaxLength);
+
+   return (pv_LineEnd == NULL) ? ou32_MaxLength :
+          static_cast<uint32_t>(static_cast<const char_t *>(pv_LineEnd) - opcn_Line);
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Decode ASCII hex characters
+
+   \param[in]   opcn_Chars       characters to decode (two per byte; upper and lower case are accepted)
+   \param[in]   ou32_NumBytes    number of bytes to decode
+   \param[out]  opu8_Bytes       decoded bytes
+
+   \return
+   true     all characters valid
+   false    invalid character detected
+*/
+//-----------------------------------------------------------------------------
+bool C_HexFile::mh_DecodeBytes(const char_t * const opcn_Chars, const uint32_t ou32_NumBytes,
+                               uint8_t * const opu8_Bytes)
+{
+   bool q_Valid = true;
+
+   for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < ou32_NumBytes; u32_ByteIndex++)
+   {
+      const uint8_t u8_HiNib = mau8_HEX_DIGIT_VALUES[static_cast<uint8_t>(opcn_Chars[u32_ByteIndex * 2U])];
+      const uint8_t u8_LoNib = mau8_HEX_DIGIT_VALUES[static_cast<uint8_t>(opcn_Chars[(u32_ByteIndex * 2U) + 1U])];
+
+      if ((u8_HiNib | u8_LoNib) > 0x0FU)
+      {
+         q_Valid = false;
          break;
       }
+      opu8_Bytes[u32_ByteIndex] = static_cast<uint8_t>((static_cast<uint8_t>(u8_HiNib << 4U)) | u8_LoNib);
+   }
+   return q_Valid;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Decode and check one Intel HEX line
+
+   Checks syntax, checksum and command of the line.
+
+   \param[in]   opcn_Line         start of line
+   \param[in]   ou32_LineLength   number of characters in line (without line feed)
+   \param[out]  opu8_Record       decoded record: length, address, command, data, checksum
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_HEXLINE_SYNTAX      0x80000000
+   ERR_HEXLINE_CHECKSUM    0x90000000
+   ERR_HEXLINE_COMMAND     0xA0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::mh_DecodeIntelRecord(const char_t * const opcn_Line, const uint32_t ou32_LineLength,
+                                         uint8_t * const opu8_Record)
+{
+   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
+
+   if ((ou32_LineLength >= 3U) && (opcn_Line[0] == ':') && (mh_DecodeBytes(&opcn_Line[1], 1U, opu8_Record) == true))
+   {
+      // complete record length: length, address, command, data, checksum
+      const uint32_t u32_Length = static_cast<uint32_t>(opu8_Record[mu8_INTEL_LEN]) + mu8_INTEL_DAT + 1U;
+
+      if ((ou32_LineLength >= ((u32_Length * 2U) + 1U)) &&
+          (mh_DecodeBytes(&opcn_Line[1], u32_Length, opu8_Record) == true))
+      {
+         uint8_t u8_Checksum = 0U;
+         for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < u32_Length; u32_ByteIndex++)
+         {
+            u8_Checksum += opu8_Record[u32_ByteIndex];
+         }
+
+         if (u8_Checksum != 0x00U)
+         {
+            u32_Error = ERR_HEXLINE_CHECKSUM;
+         }
+         else if (opu8_Record[mu8_INTEL_CMD] > mu8_CMD_START32)
+         {
+            u32_Error = ERR_HEXLINE_COMMAND;
+         }
+         else
+         {
+            u32_Error = NO_ERR;
+         }
+      }
+   }
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Decode and check one S-Record line
+
+   Checks syntax, checksum and record type of the line.
+
+   \param[in]   opcn_Line         start of line
+   \param[in]   ou32_LineLength   number of characters in line (without line feed)
+   \param[out]  opu8_Record       decoded record: length, address, data, checksum
+   \param[out]  oru8_RecordType   S-Record type (0..9)
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_HEXLINE_SYNTAX      0x80000000
+   ERR_HEXLINE_CHECKSUM    0x90000000
+   ERR_HEXLINE_COMMAND     0xA0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::mh_DecodeSRecord(const char_t * const opcn_Line, const uint32_t ou32_LineLength,
+                                     uint8_t * const opu8_Record, uint8_t & oru8_RecordType)
+{
+   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
+
+   if ((ou32_LineLength >= 4U) && (opcn_Line[0] == 'S') && (mh_DecodeBytes(&opcn_Line[2], 1U, opu8_Record) == true))
+   {
+      // complete record length: length byte, address, data, checksum
+      const uint32_t u32_Length = static_cast<uint32_t>(opu8_Record[mu8_SREC_LEN]) + 1U;
 
-      if ((u32_Error != 0U) || (u8_Command == mu8_CMD_EOF))
+      if ((ou32_LineLength >= ((u32_Length * 2U) + 2U)) &&
+          (mh_DecodeBytes(&opcn_Line[2], u32_Length, opu8_Record) == true))
       {
+         uint8_t u8_Checksum = 0U;
+         for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < u32_Length; u32_ByteIndex++)
+         {
+            u8_Checksum += opu8_Record[u32_ByteIndex];
+         }
+
+         oru8_RecordType = static_cast<uint8_t>(static_cast<uint8_t>(opcn_Line[1]) - 0x30U);
+         if (u8_Checksum != 0xFFU)
+         {
+            u32_Error = ERR_HEXLINE_CHECKSUM;
+         }
+         else if (oru8_RecordType > mu8_SREC_END16)
+         {
+            u32_Error = ERR_HEXLINE_COMMAND;
+         }
+         else
+         {
+            u32_Error = NO_ERR;
+         }
+      }
+   }
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Add one parsed data record
+
+   Records without data are ignored.
+
+   \param[in]     ou32_Address   absolute address of first data byte
+   \param[in]     opu8_Data      data of record
+   \param[in]     ou8_Length     number of data bytes
+   \param[in,out] orc_DataPool   data of all records (data will be appended)
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_NOT_ENOUGH_MEMORY   0xE0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_AddRecord(const uint32_t ou32_Address, const uint8_t * const opu8_Data,
+                                const uint8_t ou8_Length, std::vector<uint8_t> & orc_DataPool)
+{
+   uint32_t u32_Error = NO_ERR;
+
+   if (ou8_Length > 0U)
+   {
+      try
+      {
+         T_HexRecord t_Record;
+         t_Record.u32_Address = ou32_Address;
+         t_Record.u32_DataIndex = static_cast<uint32_t>(orc_DataPool.size());
+         t_Record.u8_Length = ou8_Length;
+         mc_Records.push_back(t_Record);
+         orc_DataPool.insert(orc_DataPool.end(), opu8_Data, &opu8_Data[ou8_Length]);
+      }
+      catch (...)
+      {
+         u32_Error = ERR_NOT_ENOUGH_MEMORY;
+      }
+   }
+   return u32_Error;
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Compare records by address
+
+   \param[in]  orc_Record1   first record
+   \param[in]  orc_Record2   second record
+
+   \return
+   true    first record starts at a lower address
+   false   else
+*/
+//-----------------------------------------------------------------------------
+bool C_HexFile::mh_CompareRecordAddress(const T_HexRecord & orc_Record1, const T_HexRecord & orc_Record2)
+{
+   return (orc_Record1.u32_Address < orc_Record2.u32_Address);
+}
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Create memory image from parsed records
+
+   Sorts the records by address and creates the memory dump from them.
+   Records with the same address keep the order they had in the file.
+
+   If records overlap a dump can not be created. In this case the line based representation is created right away and
+    the dump stays "dirty". So the next call to GetDataDump() will report the overlay exactly as if we had parsed line
+    by line.
+
+   \param[in]  orc_DataPool   data of all records
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_NOT_ENOUGH_MEMORY   0xE0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_CreateImage(const std::vector<uint8_t> & orc_DataPool)
+{
+   uint32_t u32_Error = NO_ERR;
+   int64_t s64_LastAddress = -2; //-2 -> make sure that a block is detected at the first record
+   uint32_t u32_NumBlocks = 0U;
+   uint32_t u32_NumLines = 1U; //EOF record
+   uint32_t u32_AdrOffs = 0U;  //offset records are only needed for non-zero offsets
+   bool q_Overlay = false;
+   uint32_t u32_Record;
+
+   //usually the records are already sorted; only sort if required
+   for (u32_Record = 1U; u32_Record < mc_Records.size(); u32_Record++)
+   {
+      if (mc_Records[u32_Record].u32_Address < mc_Records[static_cast<size_t>(u32_Record) - 1U].u32_Address)
+      {
+         std::stable_sort(mc_Records.begin(), mc_Records.end(), &C_HexFile::mh_CompareRecordAddress);
          break;
       }
    }
 
-   if ((u8_Command != mu8_CMD_EOF) && (u32_Error == NO_ERR)) // no EOF record?
+   //first run: check for overlay, count blocks and lines
+   for (u32_Record = 0U; u32_Record < mc_Records.size(); u32_Record++)
    {
-      m_SetEOFPtr(); // add EOF record
-      u32_Error = m_AddHexLine(":00000001FF\n");
-      if (u32_Error == 0U)
+      const T_HexRecord & rt_Record = mc_Records[u32_Record];
+      const uint32_t u32_EndAddress = (rt_Record.u32_Address + rt_Record.u8_Length) - 1U;
+
+      if (static_cast<int64_t>(rt_Record.u32_Address) < s64_LastAddress)
+      {
+         q_Overlay = true;
+      }
+      else if (static_cast<int64_t>(rt_Record.u32_Address) > s64_LastAddress)
+      {
+         u32_NumBlocks++; //new block detected
+      }
+      else
+      {
+         //contiguous data
+      }
+      s64_LastAddress = static_cast<int64_t>(rt_Record.u32_Address) + rt_Record.u8_Length;
+
+      if ((rt_Record.u32_Address & mu32_XADR32_MASK) != u32_AdrOffs)
+      {
+         u32_AdrOffs = (rt_Record.u32_Address & mu32_XADR32_MASK);
+         u32_NumLines++;
+      }
+      u32_NumLines++;
+
+      if (rt_Record.u32_Address < mu32_MinAdr)
+      {
+         mu32_MinAdr = rt_Record.u32_Address;
+      }
+      if (u32_EndAddress > mu32_MaxAdr)
       {
-         u32_Error = WRN_NO_EOF_RECORD; // set warning
+         mu32_MaxAdr = u32_EndAddress;
       }
    }
 
+   if (q_Overlay == true)
+   {
+      u32_Error = m_CreateLines(&orc_DataPool);
+      mq_DumpIsDirty = true;
+   }
+   else
+   {
+      //second run: copy data into blocks
+      try
+      {
+         int32_t s32_Block = -1;
+         uint32_t u32_FirstRecordOfBlock = 0U;
+         uint32_t u32_BlockSize = 0U;
+
+         mc_Dump.at_Blocks.SetLength(static_cast<int32_t>(u32_NumBlocks));
+         s64_LastAddress = -2;
+         for (u32_Record = 0U; u32_Record <= mc_Records.size(); u32_Record++)
+         {
+            //finish previous block if a new one starts or we are finished
+            if ((u32_Record == mc_Records.size()) ||
+                (static_cast<int64_t>(mc_Records[u32_Record].u32_Address) > s64_LastAddress))
+            {
+               if (s32_Block >= 0)
+               {
+                  C_HexDataDumpBlock & rc_Block = mc_Dump.at_Blocks[s32_Block];
+                  uint32_t u32_Offset = 0U;
+                  rc_Block.au8_Data.SetLength(static_cast<int32_t>(u32_BlockSize));
+                  for (uint32_t u32_Copy = u32_FirstRecordOfBlock; u32_Copy < u32_Record; u32_Copy++)
+                  {
+                     (void)std::memcpy(&rc_Block.au8_Data[static_cast<int32_t>(u32_Offset)],
+                                       &orc_DataPool[mc_Records[u32_Copy].u32_DataIndex],
+                                       mc_Records[u32_Copy].u8_Length);
+                     u32_Offset += mc_Records[u32_Copy].u8_Length;
+                  }
+               }
+               if (u32_Record < mc_Records.size())
+               {
+                  s32_Block++;
+                  mc_Dump.at_Blocks[s32_Block].u32_AddressOffset = mc_Records[u32_Record].u32_Address;
+                  u32_FirstRecordOfBlock = u32_Record;
+                  u32_BlockSize = 0U;
+               }
+            }
+            if (u32_Record < mc_Records.size())
+            {
+               u32_BlockSize += mc_Records[u32_Record].u8_Length;
+               s64_LastAddress = static_cast<int64_t>(mc_Records[u32_Record].u32_Address) +
+                                 mc_Records[u32_Record].u8_Length;
+            }
+         }
+         //the data now lives in the dump; the records are only needed to create the lines on demand
+         mu32_LineCountNew = u32_NumLines;
+         mq_LinesPending = true;
+         mq_DumpIsDirty = false;
+      }
+      catch (...)
+      {
+         u32_Error = ERR_NOT_ENOUGH_MEMORY;
+      }
+   }
    return u32_Error;
 }
 
-//************************************************************************
-// .FUNCTION    LoadSRecord
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//  - HexFile.LoadSRecord load a Motorola S_Record file into memory
-//    convert records internal into intel hex format
-//    all records are sorted by address, for address offset
-//    Intel32 offset commands are used
-//------------------------------------------------------------------------
-// .PARAMETERS  opt_File                file handle
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//              ERR_HEXLINE_COMMAND     0xAxxxxxxx
-//              ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
-//
-//              xxxxxxx = error line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_LoadSRecord(std::FILE * const opt_File)
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Create line based representation from parsed records
+
+   Creates the Intel HEX lines in sorted order:
+   - Intel32 offset lines whenever the upper 16 bits of the address change
+   - one data line per record
+   - EOF line
+
+   \param[in]  opc_DataPool   data of all records;
+                              NULL: take the data from the memory dump (which must have been created from the records)
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_NOT_ENOUGH_MEMORY   0xE0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_CreateLines(const std::vector<uint8_t> * const opc_DataPool)
 {
    uint32_t u32_Error = NO_ERR;
-   char_t acn_HexBuffer[mu32_HEXBUFFER_SIZE];
-   char_t acn_IntelBuffer[mu32_HEXBUFFER_SIZE];
-   uint32_t u32_AdrNew;
-   uint8_t u8_RecordType;
-   uint8_t u8_Length = 0U;
+   uint8_t au8_Line[mu32_HEXBUFFER_SIZE / 2U];
+   uint32_t u32_AdrOffs = 0U;
+   int32_t s32_Block = 0;
 
-   mu8_MaxRecordLength = 0U;
+   mq_LinesPending = false;
+   mu32_LineCountNew = 0U;
 
-   while ((fgets(acn_HexBuffer, ms32_SRECORD_MAX, opt_File)) != NULL)
+   for (uint32_t u32_Record = 0U; (u32_Record < mc_Records.size()) && (u32_Error == NO_ERR); u32_Record++)
    {
-      mu32_LineCount++;
+      const T_HexRecord & rt_Record = mc_Records[u32_Record];
+      const uint8_t * pu8_Data;
 
-      u32_Error = m_GetSRecordType(acn_HexBuffer, u8_RecordType);
-      if (u32_Error == NO_ERR)
+      if (opc_DataPool != NULL)
       {
-         u32_Error = mh_GetByte(acn_HexBuffer + 1, mu8_SREC_LEN, u8_Length);
-         if (u32_Error != NO_ERR)
-         {
-            u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number info
-         }
+         pu8_Data = &(*opc_DataPool)[rt_Record.u32_DataIndex];
       }
-      if (u32_Error == NO_ERR)
+      else
       {
-         if (u8_Length > mu8_MaxRecordLength)
+         //records are sorted and do not overlap; so we only need to move forward through the blocks
+         while ((rt_Record.u32_Address - mc_Dump.at_Blocks[s32_Block].u32_AddressOffset) >=
+                static_cast<uint32_t>(mc_Dump.at_Blocks[s32_Block].au8_Data.GetLength()))
          {
-            mu8_MaxRecordLength = u8_Length;
+            s32_Block++;
          }
+         pu8_Data = &mc_Dump.at_Blocks[s32_Block].au8_Data[static_cast<int32_t>(rt_Record.u32_Address -
+                                                                                 mc_Dump.at_Blocks[s32_Block].
+                                                                                 u32_AddressOffset)];
+      }
 
-         if ((u8_RecordType == mu8_SREC_DATA16) || (u8_RecordType == mu8_SREC_DATA24) ||
-             (u8_RecordType == mu8_SREC_DATA32))
-         {
-            // get record address
-            u32_Error = m_GetSRecordAddress(acn_HexBuffer, u8_RecordType, u32_AdrNew);
-
-            if (mu32_AdrOffs != (u32_AdrNew & mu32_XADR32_MASK)) // 32bit address offset changed?
-            {
-               mu32_AdrOffs = (u32_AdrNew & mu32_XADR32_MASK); // yes -> set new address offset
-               u32_Error = m_SetOffset(mu32_AdrOffs);          // set new offset record
-            }
-
-            if (u32_Error == NO_ERR) // no error?
-            {
-               // create intel hex record
-               u8_Length -= static_cast<uint8_t>(u8_RecordType + 2U); // calc. intel-hex length
-               acn_IntelBuffer[0] = ':';
-
-               mu32_NumRawBytes += u8_Length;
-
-               mh_SetByte(acn_IntelBuffer, mu8_INTEL_LEN, u8_Length);
-               mh_SetWord(acn_IntelBuffer, mu8_INTEL_ADRH, (u32_AdrNew & ~mu32_XADR32_MASK));
-               mh_SetByte(acn_IntelBuffer, mu8_INTEL_CMD, mu8_CMD_DATA);
-               std::memmove(&acn_IntelBuffer[(mu8_INTEL_DAT * 2U) + 1U], &acn_HexBuffer[(u8_RecordType * 2U) + 6U],
-                            static_cast<uint32_t>(u8_Length) * 2U);
-               mh_CalcCheck(acn_IntelBuffer);
-
-               m_SetDataPtr(u32_AdrNew);
-               u32_Error = m_AddHexLine(acn_IntelBuffer);
-            }
-         }
+      if ((rt_Record.u32_Address & mu32_XADR32_MASK) != u32_AdrOffs)
+      {
+         u32_AdrOffs = (rt_Record.u32_Address & mu32_XADR32_MASK);
+         au8_Line[mu8_INTEL_LEN] = 2U;
+         au8_Line[mu8_INTEL_ADRH] = 0U;
+         au8_Line[mu8_INTEL_ADRL] = 0U;
+         au8_Line[mu8_INTEL_CMD] = mu8_CMD_XADR32;
+         au8_Line[mu8_INTEL_DAT] = static_cast<uint8_t>(u32_AdrOffs >> 24U);
+         au8_Line[mu8_INTEL_DAT + 1U] = static_cast<uint8_t>(u32_AdrOffs >> 16U);
+         u32_Error = m_AppendLine(au8_Line, u32_AdrOffs);
       }
 
-      if (u32_Error != NO_ERR)
+      if (u32_Error == NO_ERR)
       {
-         break;
+         au8_Line[mu8_INTEL_LEN] = rt_Record.u8_Length;
+         au8_Line[mu8_INTEL_ADRH] = static_cast<uint8_t>(rt_Record.u32_Address >> 8U);
+         au8_Line[mu8_INTEL_ADRL] = static_cast<uint8_t>(rt_Record.u32_Address);
+         au8_Line[mu8_INTEL_CMD] = mu8_CMD_DATA;
+         (void)std::memcpy(&au8_Line[mu8_INTEL_DAT], pu8_Data, rt_Record.u8_Length);
+         u32_Error = m_AppendLine(au8_Line, rt_Record.u32_Address);
       }
    }
 
-   if (u32_Error == NO_ERR) // no error?
+   if (u32_Error == NO_ERR)
    {
-      m_SetEOFPtr(); // add EOF record to end of file
-      u32_Error = m_AddHexLine(":00000001FF\n");
+      au8_Line[mu8_INTEL_LEN] = 0U;
+      au8_Line[mu8_INTEL_ADRH] = 0U;
+      au8_Line[mu8_INTEL_ADRL] = 0U;
+      au8_Line[mu8_INTEL_CMD] = mu8_CMD_EOF;
+      u32_Error = m_AppendLine(au8_Line, 0U);
    }
 
+   //the records are not needed any more
+   std::vector<T_HexRecord>().swap(mc_Records);
+
    return u32_Error;
 }
 
-//************************************************************************
-// .FUNCTION    GetFileType
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//  - check if input file opt_File is intel-hex or motorola srecord
-//------------------------------------------------------------------------
-// .PARAMETERS  opt_File           file handle
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//
-//              xxxxxxx = error line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_GetFileType(std::FILE * const opt_File, int32_t & ors32_FileType) const
-{
-   uint32_t u32_Error;
-   const char_t * pcn_Ret;
-   char_t acn_HexBuffer[mu32_HEXBUFFER_SIZE];
-   uint8_t u8_Dummy;
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Append binary Intel HEX line at end of ring buffer
 
-   ors32_FileType = ms32_HEXFILE_ERR;                           // init type flag
-   (void)std::memset(acn_HexBuffer, 0, mu32_HEXBUFFER_SIZE);    // clear hex buffer
-   pcn_Ret = fgets(acn_HexBuffer, ms32_INTELHEX_MAX, opt_File); // read first line of file
-   rewind(opt_File);                                            // set file pointer to start of file
+   \param[in]  opu8_Line   binary line (length, address, command, data); checksum will be calculated
+   \param[in]  ou32_XAdr   extended address of line
+
+   \return
+   NO_ERR                  0x00000000
+   ERR_NOT_ENOUGH_MEMORY   0xE0000000
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::m_AppendLine(const uint8_t * const opu8_Line, const uint32_t ou32_XAdr)
+{
+   uint32_t u32_Error = NO_ERR;
+   const uint32_t u32_Length = static_cast<uint32_t>(opu8_Line[mu8_INTEL_LEN]) + 5U;
+   T_HexLine * pt_New = NULL;
+   T_HexLine * pt_Next;
+   uint8_t u8_Checksum = 0U;
 
-   if (pcn_Ret != acn_HexBuffer)
+   try // be aware of the bad bad_alloc exception...
    {
-      // fgets failed
-      u32_Error = ERR_HEXLINE_SYNTAX;
+      pt_New = new T_HexLine();   // create new element
+      pt_New->pu8_HexLine = NULL; // sorry, no data!
+      pt_New->pu8_HexLine = new uint8_t[u32_Length];
    }
-   else if (acn_HexBuffer[0] == ':') // line might be intel-hex?
+   catch (...)
    {
-      u32_Error = m_GetIHexCommand(acn_HexBuffer, u8_Dummy);
-      if (u32_Error == NO_ERR) // check hexline
-      {
-         ors32_FileType = ms32_HEXFILE_IHEX;
-      }
+      delete pt_New;
+      u32_Error = ERR_NOT_ENOUGH_MEMORY;
    }
-   else if (acn_HexBuffer[0] == 'S') // line might be s-record?
+
+   if (u32_Error == NO_ERR)
    {
-      u32_Error = m_GetSRecordType(acn_HexBuffer, u8_Dummy);
-      if (u32_Error == NO_ERR) // check hexline
+      for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < (u32_Length - 1U); u32_ByteIndex++)
       {
-         ors32_FileType = ms32_HEXFILE_SREC;
+         pt_New->pu8_HexLine[u32_ByteIndex] = opu8_Line[u32_ByteIndex];
+         u8_Checksum += opu8_Line[u32_ByteIndex];
+      }
+      pt_New->pu8_HexLine[u32_Length - 1U] = static_cast<uint8_t>((~u8_Checksum) + 1U);
+      pt_New->u32_XAdr = ou32_XAdr;
+
+      if (mpt_Prev == NULL) // first entry?
+      {
+         pt_New->pt_Prev = pt_New; // 1st element points to himself
+         pt_New->pt_Next = pt_New; // 1st element points to himself
+         mpt_Prev      = pt_New;   // new element is also previous element!
+         mpt_DataEntry = pt_New;   // remember the entry pointer!
       }
-   }
-   else
-   {
-      u32_Error = ERR_HEXLINE_SYNTAX; // init error flag
-   }
 
+      pt_Next = mpt_Prev->pt_Next; // remember next element!
+      mpt_Prev->pt_Next = pt_New;  // previous points to new element
+      pt_New->pt_Prev = mpt_Prev;  // new points to previous element
+      pt_New->pt_Next = pt_Next;   // new points also to next element
+      pt_Next->pt_Prev = pt_New;   // next points to new element
+      mpt_Prev = pt_New;           // next time new is previous...
+
+      mu32_LineCountNew++; // count new line numbers
+   }
    return u32_Error;
 }
 
@@ -722,6 +1336,8 @@ void C_HexFile::m_InitHexFile(void)
    mpt_HexData = NULL;
    mpt_Prev = NULL;
    mq_DumpIsDirty = true;
+   mq_LinesPending = false;
+   std::vector<T_HexRecord>().swap(mc_Records);
 }
 
 //************************************************************************
@@ -730,7 +1346,9 @@ void C_HexFile::m_InitHexFile(void)
 //------------------------------------------------------------------------
 // .DESCRIPTION
 //    Clear frees all dynamic allocated memory
-//    called by destructor and at the beginning of LoadFromFile
+//    called by destructor and at the beginning of all functions replacing the data
+//    (LoadFromFile, SetDataDump, CreateHexFile; Optimize and OptimizeLinear via CreateHexFile)
+//    increments the data generation (see GetDataGeneration)
 //------------------------------------------------------------------------
 // .PARAMETERS  void
 //------------------------------------------------------------------------
@@ -764,6 +1382,7 @@ void C_HexFile::Clear(void)
    }
 
    m_InitHexFile();
+   mu32_DataGeneration++;
 }
 
 //************************************************************************
@@ -1043,410 +1662,107 @@ uint32_t C_HexFile::CreateHexFile(const C_HexDataDump & orc_Dump, const uint32_t
             {
                break;
             }
-
-            if (q_RecordOpen == false) // no record open?
-            {
-               // -> open data record...
-               s32_Length = 0;
-               mh_SetWord(acn_Record, mu8_INTEL_ADRH, (u32_AbsoluteAddress & ~mu32_XADR32_MASK));
-               mh_SetByte(acn_Record, mu8_INTEL_CMD, mu8_CMD_DATA);
-               q_RecordOpen = true;
-            }
-
-            // store data
-            mh_SetByte(acn_Record, static_cast<uint32_t>(mu8_INTEL_DAT + s32_Length),
-                       static_cast<uint8_t>(pc_Block->au8_Data[u32_OffsetInBlock]));
-            s32_Length++;                                                            // inc. data length
-            mh_SetByte(acn_Record, mu8_INTEL_LEN, static_cast<uint8_t>(s32_Length)); // set data length
-         }
-
-         if (u32_Error == NO_ERR)
-         {
-            u32_Error = m_CloseRecord(acn_Record, q_RecordOpen);
-         }
-
-         if (u32_Error != NO_ERR)
-         {
-            break;
-         }
-      }
-   }
-
-   if (u32_Error == 0U)
-   {
-      m_SetEOFPtr(); // add EOF record to end of file
-      u32_Error = m_AddHexLine(":00000001FF\n");
-      if (u32_Error == NO_ERR) // add EOF record
-      {
-         m_RemoveFirst(); // remove first element (zero offset)
-      }
-   }
-
-   return u32_Error;
-}
-
-//************************************************************************
-// .FUNCTION    CloseRecord
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    if open flag is set: store record data, clear open flag
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_Record:         pointer to record data
-//              orq_RecordOpen:      flag: record data available
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
-//
-//              xxxxxxx = line number of optimized file
-//************************************************************************
-uint32_t C_HexFile::m_CloseRecord(char_t * const opcn_Record, bool & orq_RecordOpen)
-{
-   uint32_t u32_Error = NO_ERR;
-
-   if (orq_RecordOpen == true) // create valid data record
-   {
-      mh_CalcCheck(opcn_Record);
-      u32_Error = m_AddHexLine(opcn_Record);
-      orq_RecordOpen = false;
-   }
-
-   return u32_Error;
-}
-
-//************************************************************************
-// .FUNCTION    HexLineString
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//  - HexFile.HexLineString converts binary HexLine stored in pbHexLine
-//                          into C-string
-//------------------------------------------------------------------------
-// .PARAMETERS  opu8_HexLine  pointer to binary HexLine
-//------------------------------------------------------------------------
-// .RETURNVALUE pointer to C-String
-//************************************************************************
-const char_t * C_HexFile::mh_HexLineString(const uint8_t * const opu8_HexLine) //const
-{
-   static char_t hacn_Buffer[mu32_HEXBUFFER_SIZE];
-   uint32_t u32_Length;
-
-   hacn_Buffer[0] = ':'; // begin a new Intel HEX line
-   u32_Length = static_cast<uint32_t>(opu8_HexLine[mu8_INTEL_LEN]) + 5U;
-
-   for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < u32_Length; u32_ByteIndex++) // store ASCII HEX data
-   {
-      mh_SetByte(hacn_Buffer, u32_ByteIndex, opu8_HexLine[u32_ByteIndex]);
-   }
-
-   u32_Length = (u32_Length * 2U) + 1U; // create line end:
-   hacn_Buffer[u32_Length] = '\0';      // terminate string
-
-   return hacn_Buffer;
-}
-
-//************************************************************************
-// .FUNCTION    GetIHexCommand
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    GetIHexCommand    fetch intel command byte from new HEX line
-//                      it checks also HEX line syntax
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_String   new HEX line (C-string)
-//              oru8_Command  reference to command byte
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//              ERR_HEXLINE_COMMAND     0xAxxxxxxx
-//
-//              xxxxxxx = line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_GetIHexCommand(const char_t * const opcn_String, uint8_t & oru8_Command) const
-{
-   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
-   uint8_t u8_Data;
-   uint32_t u32_Loop;
-   uint32_t u32_Length;
-   uint8_t u8_Checksum = 0U;
-
-   if (opcn_String[0] == ':')
-   {
-      if (mh_GetByte(opcn_String, mu8_INTEL_LEN, u8_Data) == NO_ERR) // read record data length
-      {
-         u32_Length = static_cast<uint32_t>(u8_Data) + mu8_INTEL_DAT + 1; // calculate complete record length
-
-         for (u32_Loop = 0U; u32_Loop < u32_Length; u32_Loop++) // calculate checksum...
-         {
-            u32_Error = mh_GetByte(opcn_String, u32_Loop, u8_Data);
-            if (u32_Error != NO_ERR)
-            {
-               break; // on error break!
-            }
-            u8_Checksum += u8_Data;
-         }
-
-         if ((u32_Error == NO_ERR) && (u8_Checksum != 0x00U)) // checksum error?
-         {
-            u32_Error = ERR_HEXLINE_CHECKSUM; // yes -> set checksum error
-         }
-      }
-
-      if (u32_Error == NO_ERR)
-      {
-         u32_Error = mh_GetByte(opcn_String, mu8_INTEL_CMD, oru8_Command);
-         if (u32_Error == NO_ERR)
-         {
-            if (oru8_Command > mu8_CMD_START32)
-            {
-               u32_Error = ERR_HEXLINE_COMMAND;
-            }
-         }
-      }
-   }
-
-   if (u32_Error != NO_ERR)
-   {
-      u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number
-   }
-
-   return (u32_Error);
-}
-
-//************************************************************************
-// .FUNCTION    GetSRecordType
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    GetSRecordType fetch s-record type from new HEX line
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_String      new HEX line (C-string)
-//              oru8_RecordType  reference to srecord type
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//              ERR_HEXLINE_COMMAND     0xAxxxxxxx
-//
-//              xxxxxxx = line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_GetSRecordType(const char_t * const opcn_String, uint8_t & oru8_RecordType) const
-{
-   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
-   uint8_t u8_Data;
-   uint8_t u8_Checksum = 0U;
-
-   if (opcn_String[0] == 'S')
-   {
-      if (mh_GetByte(opcn_String + 1, mu8_SREC_LEN, u8_Data) == NO_ERR) // read record data length
-      {
-         int32_t s32_Length = static_cast<int32_t>(u8_Data) + 1; // calculate complete record length
-
-         for (int32_t u32_ByteIndex = 0; u32_ByteIndex < s32_Length; u32_ByteIndex++) // calculate checksum...
-         {
-            u32_Error = mh_GetByte(opcn_String + 1, u32_ByteIndex, u8_Data);
-            if (u32_Error != NO_ERR)
-            {
-               break;
-            }
-            u8_Checksum += u8_Data;
+
+            if (q_RecordOpen == false) // no record open?
+            {
+               // -> open data record...
+               s32_Length = 0;
+               mh_SetWord(acn_Record, mu8_INTEL_ADRH, (u32_AbsoluteAddress & ~mu32_XADR32_MASK));
+               mh_SetByte(acn_Record, mu8_INTEL_CMD, mu8_CMD_DATA);
+               q_RecordOpen = true;
+            }
+
+            // store data
+            mh_SetByte(acn_Record, static_cast<uint32_t>(mu8_INTEL_DAT + s32_Length),
+                       static_cast<uint8_t>(pc_Block->au8_Data[u32_OffsetInBlock]));
+            s32_Length++;                                                            // inc. data length
+            mh_SetByte(acn_Record, mu8_INTEL_LEN, static_cast<uint8_t>(s32_Length)); // set data length
          }
 
-         if ((u32_Error == 0U) && (u8_Checksum != 0xFFU)) // checksum error?
+         if (u32_Error == NO_ERR)
          {
-            u32_Error = ERR_HEXLINE_CHECKSUM; // yes -> set checksum error
+            u32_Error = m_CloseRecord(acn_Record, q_RecordOpen);
          }
-      }
-
-      if (u32_Error == 0U)
-      {
-         oru8_RecordType = static_cast<uint8_t>(opcn_String[1]) - 0x30U; // read record type
 
-         if (oru8_RecordType > mu8_SREC_END16) // check record type
+         if (u32_Error != NO_ERR)
          {
-            u32_Error = ERR_HEXLINE_COMMAND;
+            break;
          }
       }
    }
 
-   if (u32_Error != NO_ERR)
-   {
-      u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number
-   }
-
-   return (u32_Error);
-}
-
-//************************************************************************
-// .FUNCTION    GetIntelAddress
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    GetAddress fetch start address from new HEX line
-//               it checks also HEX line syntax
-//------------------------------------------------------------------------
-// .ASSUMPTIONS command byte ou8_Command available
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_String   new HEX line (C-string)
-//              ou8_Command   Intel HEX command byte
-//              oru32_Adr     reference to address
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//
-//              xxxxxxx = line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_GetIntelAddress(const char_t * const opcn_String, const uint8_t ou8_Command,
-                                      uint32_t & oru32_Adr) const
-{
-   uint32_t u32_Error = ERR_HEXLINE_SYNTAX;
-   uint32_t u32_Address;
-
-   switch (ou8_Command)
+   if (u32_Error == 0U)
    {
-   case mu8_CMD_DATA: // calculate 32bit address for data record
-      if (mh_GetWord(opcn_String, mu8_INTEL_ADRH, u32_Address) == NO_ERR)
-      {
-         oru32_Adr = mu32_AdrOffs + u32_Address;
-         u32_Error = NO_ERR;
-      }
-      break;
-
-   case mu8_CMD_XADR16: // calculate 32bit offset address
-                        // from Intel16 20bit offset command
-      if (mh_GetWord(opcn_String, mu8_INTEL_DAT, u32_Address) == NO_ERR)
-      {
-         oru32_Adr = (u32_Address << 4);
-         u32_Error = NO_ERR;
-      }
-      break;
-
-   case mu8_CMD_XADR32: // calculate 32bit offset address
-      // from Intel32 32bit offset command
-      if (mh_GetWord(opcn_String, mu8_INTEL_DAT, u32_Address) == NO_ERR)
+      m_SetEOFPtr(); // add EOF record to end of file
+      u32_Error = m_AddHexLine(":00000001FF\n");
+      if (u32_Error == NO_ERR) // add EOF record
       {
-         oru32_Adr = (u32_Address << 16U);
-         u32_Error = NO_ERR;
+         m_RemoveFirst(); // remove first element (zero offset)
       }
-      break;
-
-   default:
-      break;
-   }
-
-   if (u32_Error != NO_ERR)
-   {
-      u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number
    }
 
-   return (u32_Error);
+   return u32_Error;
 }
 
 //************************************************************************
-// .FUNCTION    GetSRecordAddress
+// .FUNCTION    CloseRecord
 // .GROUP
 //------------------------------------------------------------------------
 // .DESCRIPTION
-//    GetAddress fetch start address from new HEX line
-//               it checks also HEX line syntax
-//------------------------------------------------------------------------
-// .ASSUMPTIONS command byte available
+//    if open flag is set: store record data, clear open flag
 //------------------------------------------------------------------------
-// .PARAMETERS  opcn_String     new HEX line (C-string)
-//              ou8_RecordType  S-Record type
-//              oru32_Adr       reference to address
+// .PARAMETERS  opcn_Record:         pointer to record data
+//              orq_RecordOpen:      flag: record data available
 //------------------------------------------------------------------------
 // .RETURNVALUE
 //              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
+//              ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
 //
-//              xxxxxxx = line number of input file
+//              xxxxxxx = line number of optimized file
 //************************************************************************
-uint32_t C_HexFile::m_GetSRecordAddress(const char_t * const opcn_String, const uint8_t ou8_RecordType,
-                                        uint32_t & oru32_Adr) const
+uint32_t C_HexFile::m_CloseRecord(char_t * const opcn_Record, bool & orq_RecordOpen)
 {
-   uint32_t u32_Error;
-   uint32_t u32_Address;
-   uint32_t u32_LSW;
-   uint8_t u8_LSB;
-
-   u32_Error = mh_GetWord(opcn_String + 1, mu8_SREC_ADR, u32_Address);
-   if (u32_Error == NO_ERR)
-   {
-      if (ou8_RecordType == mu8_SREC_DATA16)
-      {
-         oru32_Adr = u32_Address;
-      }
-      else if (ou8_RecordType == mu8_SREC_DATA24)
-      {
-         u32_Error = mh_GetByte(opcn_String + 1, mu8_SREC_ADR + 2, u8_LSB);
-         if (u32_Error == NO_ERR)
-         {
-            oru32_Adr = (u32_Address << 8U) | u8_LSB;
-         }
-      }
-      else if (ou8_RecordType == mu8_SREC_DATA32)
-      {
-         u32_Error = mh_GetWord(opcn_String + 1, mu8_SREC_ADR + 2, u32_LSW);
-         if (u32_Error == NO_ERR)
-         {
-            oru32_Adr = (u32_Address << 16U) | u32_LSW;
-         }
-      }
-      else
-      {
-         u32_Error = ERR_HEXLINE_SYNTAX;
-      }
-   }
+   uint32_t u32_Error = NO_ERR;
 
-   if (u32_Error != NO_ERR)
+   if (orq_RecordOpen == true) // create valid data record
    {
-      u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number
+      mh_CalcCheck(opcn_Record);
+      u32_Error = m_AddHexLine(opcn_Record);
+      orq_RecordOpen = false;
    }
 
-   return (u32_Error);
+   return u32_Error;
 }
 
 //************************************************************************
-// .FUNCTION    SetDataPtr
+// .FUNCTION    HexLineString
 // .GROUP
 //------------------------------------------------------------------------
 // .DESCRIPTION
-//    SetDataPtr set the internal data pointer to the element with lower
-//               or same address as new address (from new data record)
-//------------------------------------------------------------------------
-// .ASSUMPTIONS at least one element is available
+//  - HexFile.HexLineString converts binary HexLine stored in pbHexLine
+//                          into C-string
 //------------------------------------------------------------------------
-// .PARAMETERS  ou32_Adr   new address (from new HEX line)
+// .PARAMETERS  opu8_HexLine  pointer to binary HexLine
 //------------------------------------------------------------------------
-// .RETURNVALUE void
+// .RETURNVALUE pointer to C-String
 //************************************************************************
-void C_HexFile::m_SetDataPtr(const uint32_t ou32_Adr)
+const char_t * C_HexFile::mh_HexLineString(const uint8_t * const opu8_HexLine) //const
 {
-   T_HexLine * pt_Next;
+   static char_t hacn_Buffer[mu32_HEXBUFFER_SIZE];
+   uint32_t u32_Length;
 
-   if (mpt_Prev == NULL)
-   {
-      return;
-   }
+   hacn_Buffer[0] = ':'; // begin a new Intel HEX line
+   u32_Length = static_cast<uint32_t>(opu8_HexLine[mu8_INTEL_LEN]) + 5U;
 
-   while (ou32_Adr < mpt_Prev->u32_XAdr) // search for next data entry point
+   for (uint32_t u32_ByteIndex = 0U; u32_ByteIndex < u32_Length; u32_ByteIndex++) // store ASCII HEX data
    {
-      mpt_Prev = mpt_Prev->pt_Prev;
+      mh_SetByte(hacn_Buffer, u32_ByteIndex, opu8_HexLine[u32_ByteIndex]);
    }
 
-   pt_Next = mpt_Prev->pt_Next;
+   u32_Length = (u32_Length * 2U) + 1U; // create line end:
+   hacn_Buffer[u32_Length] = '\0';      // terminate string
 
-   while ((ou32_Adr >= pt_Next->u32_XAdr) && (pt_Next != mpt_DataEntry))
-   {
-      mpt_Prev = pt_Next;
-      pt_Next = mpt_Prev->pt_Next;
-   }
+   return hacn_Buffer;
 }
 
 //************************************************************************
@@ -1728,162 +2044,6 @@ void C_HexFile::m_RemoveFirst(void)
    }
 }
 
-//************************************************************************
-// .FUNCTION    ConvOffs16To32
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    ConvOffs16To32 convert a Intel16 offset command to Intel32 offset
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_String  HEX line (C-string)
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//
-//              xxxxxxx = line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_ConvOffs16To32(char_t * const opcn_String) const
-{
-   uint32_t u32_Error;
-   uint32_t u32_AdrOffs;
-
-   u32_Error = mh_GetWord(opcn_String, mu8_INTEL_DAT, u32_AdrOffs);
-   if (u32_Error == NO_ERR)
-   {
-      u32_AdrOffs >>= 12;
-      mh_SetWord(opcn_String, mu8_INTEL_DAT, u32_AdrOffs);
-      mh_SetByte(opcn_String, mu8_INTEL_CMD, mu8_CMD_XADR32);
-
-      u32_Error = mh_CalcCheck(opcn_String);
-   }
-
-   if (u32_Error != NO_ERR)
-   {
-      u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number info
-   }
-
-   return (u32_Error);
-}
-
-//************************************************************************
-// .FUNCTION    ConvRec16ToRec32
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    ConvOffs16To32 convert Intel16 data records to Intel32 data records
-//           creates new offset commands and splits data records that
-//            do not fit into 64K pages
-//           all HEX data will be stored in memory
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_String  HEX line (C-string)
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x8xxxxxxx
-//              ERR_HEXLINE_CHECKSUM    0x9xxxxxxx
-//              ERR_NOT_ENOUGH_MEMORY   0xExxxxxxx
-//
-//              xxxxxxx = line number of input file
-//************************************************************************
-uint32_t C_HexFile::m_ConvRec16ToRec32(char_t * const opcn_String)
-{
-   uint32_t u32_Error;
-   char_t acn_HexLine[mu32_HEXBUFFER_SIZE];
-   uint32_t u32_Adr;
-   uint8_t u8_Len;
-   uint8_t u8_Len1;
-   uint32_t u32_StartAdr;
-   uint32_t u32_EndAdr;
-   uint32_t u32_SaveOffs;
-
-   u32_Error = mh_GetWord(opcn_String, mu8_INTEL_ADRH, u32_Adr);
-   if (u32_Error == NO_ERR)
-   {
-      u32_Error = mh_GetByte(opcn_String, mu8_INTEL_LEN, u8_Len);
-      if (u32_Error == NO_ERR)
-      {
-         u32_StartAdr = (mu32_AdrOffs & ~mu32_XADR32_MASK) + u32_Adr;
-         u32_EndAdr   = (u32_StartAdr + u8_Len) - 1;
-
-         if (u32_StartAdr >= 0x00010000U)
-         {
-            // write 32bit offset command
-            u32_Error = m_SetOffset((mu32_AdrOffs & mu32_XADR32_MASK) + 0x10000U);
-         }
-
-         m_SetDataPtr(mu32_AdrOffs + u32_Adr); // calc new list pointer
-
-         if (u32_Error == NO_ERR)
-         {
-            if ((u32_EndAdr < 0x00010000U) ||
-                ((u32_StartAdr >= 0x00010000U) && (u32_EndAdr < 0x00020000U)))
-            {
-               mh_SetWord(opcn_String, mu8_INTEL_ADRH, u32_StartAdr);
-               mh_CalcCheck(opcn_String);
-
-               u32_SaveOffs = mu32_AdrOffs;                                // save address offset
-               mu32_AdrOffs = (mu32_AdrOffs + u32_Adr) & mu32_XADR32_MASK; // create 32bit Offset
-               u32_Error = m_AddHexLine(opcn_String);                      // add 32bit HEX record
-               mu32_AdrOffs = u32_SaveOffs;                                // restore address offset
-            }
-            else
-            {
-               u8_Len1 = static_cast<uint8_t>(0x00010000U - (u32_StartAdr & ~mu32_XADR32_MASK));
-               u8_Len  -= u8_Len1;
-               // create 1st part of 32bit record:
-               acn_HexLine[0] = ':';
-               mh_SetByte(acn_HexLine, mu8_INTEL_LEN, u8_Len1);
-               mh_SetWord(acn_HexLine, mu8_INTEL_ADRH, u32_StartAdr);
-               mh_SetByte(acn_HexLine, mu8_INTEL_CMD, mu8_CMD_DATA);
-               for (uint8_t u32_ByteIndex = 0U; u32_ByteIndex < u8_Len1; u32_ByteIndex++)
-               {
-                  strncpy(&acn_HexLine[(u32_ByteIndex * 2U) + 9U], &opcn_String[(u32_ByteIndex * 2U) + 9U], 2U);
-               }
-               mh_CalcCheck(acn_HexLine);
-               strncpy(&acn_HexLine[(static_cast<uint32_t>(u8_Len1) * 2U) + 11U], "\n\0", 2U);
-
-               u32_SaveOffs = mu32_AdrOffs;                                // save address offset
-               mu32_AdrOffs = (mu32_AdrOffs + u32_Adr) & mu32_XADR32_MASK; // create 32bit Offset
-               u32_Error = m_AddHexLine(acn_HexLine);                      // add 32bit HEX record
-               mu32_AdrOffs = u32_SaveOffs;                                // restore address offset
-
-               if (u32_Error == NO_ERR)
-               {
-                  // write 32bit offset command
-                  u32_StartAdr = (((mu32_AdrOffs + u32_Adr) & mu32_XADR32_MASK) + 0x10000U);
-                  u32_Error = m_SetOffset(u32_StartAdr);
-                  if (u32_Error == NO_ERR)
-                  {
-                     // create 2nd part of 32bit record:
-                     mh_SetByte(acn_HexLine, mu8_INTEL_LEN, u8_Len);
-                     mh_SetWord(acn_HexLine, mu8_INTEL_ADRH, u32_StartAdr);
-                     for (uint32_t i = u8_Len1; i < (static_cast<uint32_t>(u8_Len) + u8_Len1); i++)
-                     {
-                        strncpy(&acn_HexLine[((i - u8_Len1) * 2U) + 9U], &opcn_String[(i * 2U) + 9U], 2U);
-                     }
-                     mh_CalcCheck(acn_HexLine);
-                     strncpy(&acn_HexLine[(static_cast<uint32_t>(u8_Len) * 2U) + 11U], "\n\0", 2U);
-
-                     m_SetDataPtr(u32_StartAdr);            // calc new list pointer
-                     u32_SaveOffs = mu32_AdrOffs;           // save address offset
-                     mu32_AdrOffs = u32_StartAdr;           // create 32bit Offset
-                     u32_Error = m_AddHexLine(acn_HexLine); // add 32bit HEX record
-                     mu32_AdrOffs = u32_SaveOffs;           // restore address offset
-                  }
-               }
-            }
-         }
-      }
-   }
-
-   if (u32_Error != NO_ERR)
-   {
-      u32_Error |= (mu32_LineCount & ~ERR_MASK); // set line number info
-   }
-   return (u32_Error);
-}
-
 //************************************************************************
 // .FUNCTION    SetOffset
 // .GROUP
@@ -2063,40 +2223,6 @@ void C_HexFile::mh_SetByte(char_t * const opcn_String, const uint32_t ou32_Index
    opcn_String[u32_Index + 1] = static_cast<char_t>(au8_HexByte[1]);
 }
 
-//************************************************************************
-// .FUNCTION    GetWord
-// .GROUP
-//------------------------------------------------------------------------
-// .DESCRIPTION
-//    GetWord read word out of HEX line at position dwIndex
-//------------------------------------------------------------------------
-// .PARAMETERS  opcn_String   HEX line (C-string)
-//              ou32_Index    position inside HEX record
-//              oru32_Word    reference to data word
-//------------------------------------------------------------------------
-// .RETURNVALUE
-//              NO_ERR                  0x00000000
-//              ERR_HEXLINE_SYNTAX      0x80000000
-//************************************************************************
-uint32_t C_HexFile::mh_GetWord(const char_t * const opcn_String, const uint32_t ou32_Index, uint32_t & oru32_Word)
-{
-   uint32_t u32_Error;
-   uint8_t u8_Hi;
-   uint8_t u8_Lo;
-
-   u32_Error = mh_GetByte(opcn_String, ou32_Index, u8_Hi);
-   if (u32_Error == NO_ERR)
-   {
-      u32_Error = mh_GetByte(opcn_String, ou32_Index + 1, u8_Lo);
-      if (u32_Error == NO_ERR)
-      {
-         oru32_Word = (static_cast<uint32_t>(u8_Hi) << 8U) + u8_Lo;
-      }
-   }
-
-   return u32_Error;
-}
-
 //************************************************************************
 // .FUNCTION    SetWord
 // .GROUP
@@ -2169,6 +2295,12 @@ const uint8_t * C_HexFile::LineInit(void)
 {
    uint8_t * pu8_Start = NULL;
 
+   if (mq_LinesPending == true)
+   {
+      //lines have not been created after loading the file yet
+      (void)this->m_CreateLines(NULL);
+   }
+
    mpt_HexData = mpt_DataEntry;
    if (mpt_HexData != NULL)
    {
@@ -2559,3 +2691,20 @@ uint32_t C_HexFile::GetLastOverlayErrorAddress(void) const
 {
    return mu32_LastOverlayErrorAddress;
 }
+
+//-----------------------------------------------------------------------------
+/*!
+   \brief   Return data generation
+
+   The value changes whenever the data is replaced or rearranged (all such functions call Clear()).
+   Derived classes can use it to detect that information they extracted from the data is outdated,
+    regardless of which function (and via which base class reference) was used to change the data.
+
+   \return
+   current data generation
+*/
+//-----------------------------------------------------------------------------
+uint32_t C_HexFile::GetDataGeneration(void) const
+{
+   return mu32_DataGeneration;
+}
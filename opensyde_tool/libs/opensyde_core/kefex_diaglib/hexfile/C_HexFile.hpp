@@ -12,6 +12,7 @@
 #define CHEXFILEHPP
 
 #include <cstdio> //for "FILE"
+#include <vector>
 #include "stwtypes.hpp"
 #include "C_SclDynamicArray.hpp"
 
@@ -49,6 +50,14 @@ struct T_HexLine
    uint8_t * pu8_HexLine; ///< binary data contained in hex line (without leading ":")
 };
 
+///Data record of a loaded hex file (data is stored in a separate buffer)
+struct T_HexRecord
+{
+   uint32_t u32_Address;   ///< absolute address of first data byte
+   uint32_t u32_DataIndex; ///< index of first data byte in data buffer
+   uint8_t u8_Length;      ///< number of data bytes
+};
+
 //----------------------------------------------------------------------------------------------------------------------
 // class definition, prototypes
 //----------------------------------------------------------------------------------------------------------------------
@@ -126,6 +135,8 @@ public:
                           const uint32_t ou32_RecSize);
    //create hex file data from image that only contains used data
    uint32_t CreateHexFile(const C_HexDataDump & orc_Dump, const uint32_t ou32_RecSize);
+   //take over data from existing memory dump (e.g. from a cache) without parsing a file
+   uint32_t SetDataDump(const C_HexDataDump & orc_Dump);
 
    const C_HexDataDump * GetDataDump(uint32_t & oru32_ErrorResult);
 
@@ -135,6 +146,9 @@ public:
    //call on WRN_RECORD_OVERLAY to find out offending address:
    uint32_t GetLastOverlayErrorAddress(void) const;
 
+   //changes whenever the data is replaced or rearranged (information derived from the data is outdated then)
+   uint32_t GetDataGeneration(void) const;
+
 protected:
    uint32_t mu32_MinAdr; // Lowest occupied address in hex file
    uint32_t mu32_MaxAdr; // Highest occupied address in hex file
@@ -151,32 +165,41 @@ protected:
    bool mq_DumpIsDirty;   //flags whether dump has been compromised by changing hex data contents since it was
                           // last built
    uint32_t mu32_LastOverlayErrorAddress;
+   std::vector<T_HexRecord> mc_Records; //data records of loaded file; sorted by address after loading
+   bool mq_LinesPending;                 //flags whether lines still need to be created from mc_Records and mc_Dump
+   uint32_t mu32_DataGeneration;         //incremented by Clear(); all functions changing the data call Clear()
 
    void m_InitHexFile(void);
-   uint32_t m_GetFileType(std::FILE * const opt_File, int32_t & ors32_FileType) const;
-   uint32_t m_LoadIntelHex(std::FILE * const opt_File);
-   uint32_t m_LoadSRecord(std::FILE * const opt_File);
+   uint32_t m_GetFileType(const char_t * const opcn_Text, const uint32_t ou32_Size, int32_t & ors32_FileType) const;
+   uint32_t m_LoadIntelHex(const char_t * const opcn_Text, const uint32_t ou32_Size,
+                           std::vector<uint8_t> & orc_DataPool);
+   uint32_t m_LoadSRecord(const char_t * const opcn_Text, const uint32_t ou32_Size,
+                          std::vector<uint8_t> & orc_DataPool);
+   uint32_t m_AddRecord(const uint32_t ou32_Address, const uint8_t * const opu8_Data, const uint8_t ou8_Length,
+                        std::vector<uint8_t> & orc_DataPool);
+   uint32_t m_CreateImage(const std::vector<uint8_t> & orc_DataPool);
+   uint32_t m_CreateLines(const std::vector<uint8_t> * const opc_DataPool);
+   uint32_t m_AppendLine(const uint8_t * const opu8_Line, const uint32_t ou32_XAdr);
+   static uint32_t mh_GetLineLength(const char_t * const opcn_Line, const uint32_t ou32_MaxLength);
+   static bool mh_DecodeBytes(const char_t * const opcn_Chars, const uint32_t ou32_NumBytes,
+                              uint8_t * const opu8_Bytes);
+   static uint32_t mh_DecodeIntelRecord(const char_t * const opcn_Line, const uint32_t ou32_LineLength,
+                                        uint8_t * const opu8_Record);
+   static uint32_t mh_DecodeSRecord(const char_t * const opcn_Line, const uint32_t ou32_LineLength,
+                                    uint8_t * const opu8_Record, uint8_t & oru8_RecordType);
+   static bool mh_CompareRecordAddress(const T_HexRecord & orc_Record1, const T_HexRecord & orc_Record2);
    uint32_t m_CopyHex2Mem(uint16_t * opu16_BinImage, const uint32_t ou32_Offset);
    uint32_t m_CloseRecord(char_t * const opcn_Record, bool & orq_RecordOpen);
    static const char_t * mh_HexLineString(const uint8_t * const opu8_HexLine);
-   uint32_t m_GetIHexCommand(const char_t * const opcn_String, uint8_t & oru8_Command) const;
-   uint32_t m_GetSRecordType(const char_t * const opcn_String, uint8_t & oru8_RecordType) const;
-   uint32_t m_GetIntelAddress(const char_t * const opcn_String, const uint8_t ou8_Command, uint32_t & oru32_Adr) const;
-   uint32_t m_GetSRecordAddress(const char_t * const opcn_String, const uint8_t ou8_RecordType,
-                                uint32_t & oru32_Adr) const;
    void m_SetEOFPtr(void);
-   void m_SetDataPtr(const uint32_t ou32_Adr);
    uint32_t m_SetXAdrPtr(const uint32_t ou32_Adr);
    uint32_t m_AddHexLine(const char_t * const opcn_String);
    void m_RemoveFirst(void);
-   uint32_t m_ConvOffs16To32(char_t * const opcn_String) const;
-   uint32_t m_ConvRec16ToRec32(char_t * const opcn_String);
    uint32_t m_SetOffset(const uint32_t ou32_Adr);
    static uint32_t mh_CalcCheck(char_t * const opcn_String);
    uint32_t m_CopyData(const char_t * opcn_String, T_HexLine * const opt_HexLine, const uint32_t ou32_Length);
    static uint32_t mh_GetByte(const char_t * const opcn_String, const uint32_t ou32_Index, uint8_t & oru8_Data);
    static void mh_SetByte(char_t * const opcn_String, const uint32_t ou32_Index, const uint8_t ou8_Byte);
-   static uint32_t mh_GetWord(const char_t * const opcn_String, const uint32_t ou32_Index, uint32_t & oru32_Word);
    static void mh_SetWord(char_t * const opcn_String, const uint32_t ou32_Index, const uint32_t ou32_Data);
 
    static int32_t mh_FindPattern(const uint8_t * const opu8_Buffer, const uint8_t * const opu8_Pattern,
@@ -15,9 +15,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <fnmatch.h>
 #include <ftw.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include "stwtypes.hpp"
@@ -479,7 +481,8 @@ int32_t stw::tgl::TglCreateDirectory(const C_SclString & orc_Directory)
    {
       // Directory does not exist, create it
       s32_Ret = mkdir(orc_Directory.c_str(), 0777);
-      if (s32_Ret == 0)
+      //another thread or process might have created the directory in the meantime
+      if ((s32_Ret == 0) || (TglDirectoryExists(orc_Directory) == true))
       {
          s32_Result = 0;
       }
@@ -557,6 +560,31 @@ int32_t stw::tgl::TglRemoveDirectory(const C_SclString & orc_Directory, const bo
    return s32_Ret;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rename file
+
+   An existing file with the new name is replaced.
+   Within one file system readers see either the complete old or the complete new file.
+
+   \param[in]   orc_OldName    name of file to rename (absolute or relative)
+   \param[in]   orc_NewName    new name of file (absolute or relative)
+
+   \return
+   0     file renamed
+   -1    could not rename file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t stw::tgl::TglRenameFile(const C_SclString & orc_OldName, const C_SclString & orc_NewName)
+{
+   int32_t s32_Result = 0;
+
+   if (rename(orc_OldName.c_str(), orc_NewName.c_str()) != 0)
+   {
+      s32_Result = -1;
+   }
+   return s32_Result;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Check whether specified path is a relative path
 
@@ -583,3 +611,126 @@ bool stw::tgl::TglIsRelativePath(const C_SclString & orc_Path)
    }
    return !q_IsAbsolute;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Initialize to "nothing mapped".
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglFileMapping::C_TglFileMapping(void) :
+   mpu8_Data(NULL),
+   mu32_Size(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Destructor
+
+   Release mapping (if any).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_TglFileMapping::~C_TglFileMapping(void)
+{
+   this->Unmap();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Map complete file into memory
+
+   Maps the specified file read-only into the address space of the process.
+   An already existing mapping is released first.
+   The file descriptor is closed right away; the mapping stays valid until Unmap() is called.
+
+   An empty file results in a valid "mapping" with no data (GetData() returns NULL, GetSize() returns 0).
+
+   \param[in]     orc_FileName     path to file
+
+   \return
+   C_NO_ERR    file mapped
+   C_RD_WR     could not open or map file
+   C_RANGE     file too big to be mapped (> 4GB)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_TglFileMapping::Map(const C_SclString & orc_FileName)
+{
+   int32_t s32_Return = C_RD_WR;
+   //lint -e{970,8080} //using type to match library interface
+   const int x_File = open(orc_FileName.c_str(), O_RDONLY);
+
+   this->Unmap();
+
+   if (x_File >= 0)
+   {
+      struct stat c_Stat;
+      //lint -emacro(9001 9130,S_ISREG)  //system macro uses octal constants and bitwise operations
+      if ((fstat(x_File, &c_Stat) == 0) && (S_ISREG(c_Stat.st_mode) != false))
+      {
+         if (static_cast<uint64_t>(c_Stat.st_size) > static_cast<uint64_t>(0xFFFFFFFFUL))
+         {
+            s32_Return = C_RANGE;
+         }
+         else if (c_Stat.st_size == 0)
+         {
+            //nothing to map; mmap does not accept a size of zero
+            s32_Return = C_NO_ERR;
+         }
+         else
+         {
+            void * const pv_Data = mmap(NULL, static_cast<size_t>(c_Stat.st_size), PROT_READ, MAP_PRIVATE,
+                                        x_File, 0);
+            if (pv_Data != MAP_FAILED) //lint !e923 //provided by system headers; no problems expected
+            {
+               //we only pass through the file front to back; this is only a hint to the kernel: ignore result
+               (void)madvise(pv_Data, static_cast<size_t>(c_Stat.st_size), MADV_SEQUENTIAL);
+               mpu8_Data = static_cast<const uint8_t *>(pv_Data);
+               mu32_Size = static_cast<uint32_t>(c_Stat.st_size);
+               s32_Return = C_NO_ERR;
+            }
+         }
+      }
+      (void)close(x_File);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Release mapping
+
+   Pointers returned by GetData() are invalid after this call.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_TglFileMapping::Unmap(void)
+{
+   if (mpu8_Data != NULL)
+   {
+      //lint -e{9005} //API requires non-const pointer; no problem as we do not write through it
+      (void)munmap(const_cast<uint8_t *>(mpu8_Data), mu32_Size);
+   }
+   mpu8_Data = NULL;
+   mu32_Size = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pointer to mapped file content
+
+   \return
+   start of file content (NULL if nothing is mapped or file is empty)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8_t * C_TglFileMapping::GetData(void) const
+{
+   return mpu8_Data;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get size of mapped file content
+
+   \return
+   size of file content in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_TglFileMapping::GetSize(void) const
+{
+   return mu32_Size;
+}
@@ -5,6 +5,16 @@
 
    Handler class for logging operations
 
+   Console output is written by the logging thread.
+   For file output the logging thread only records the entry in a bounded queue.
+   A writer thread formats the queued entries and writes them to the file in batches,
+   so threads with heavy logging (e.g. communication threads) are not slowed down by file I/O.
+   The writer thread sleeps until the first entry is queued; entries queued while it is writing form the next batch.
+   If the queue is full, new entries are dropped and the number of dropped entries is reported in the log file.
+   Entries configured to be flushed (see h_SetWriteToFileActive) are written and flushed by the logging thread
+   before the logging call returns, so they are not lost if the application crashes right after.
+   Optionally the log file is rotated when it reaches a configured size.
+
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -12,12 +22,13 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
-#include <sstream>
-#include <iomanip>
 #include "TglFile.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "stwerrors.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
@@ -27,6 +38,7 @@ using namespace stw::errors;
 using namespace stw::opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscLoggingHandler::mhu32_MAX_QUEUED_ENTRIES = 20000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -39,11 +51,25 @@ bool C_OscLoggingHandler::mhq_AutoFlushWarningsAndErrorsFile = false;
 bool C_OscLoggingHandler::mhq_WriteToConsole = true;
 bool C_OscLoggingHandler::mhq_MeasureTime = false;
 bool C_OscLoggingHandler::mhq_LogInitErrorsToConsole = false;
-std::map<uint16_t, uint32_t> C_OscLoggingHandler::mhc_StartTimes = std::map<uint16_t, uint32_t> ();
+std::map<uint16_t, uint64_t> C_OscLoggingHandler::mhc_StartTimes = std::map<uint16_t, uint64_t> ();
 C_SclString C_OscLoggingHandler::mhc_FileName = "";
 C_TglCriticalSection C_OscLoggingHandler::mhc_ConsoleCriticalSection;
 C_TglCriticalSection C_OscLoggingHandler::mhc_FileCriticalSection;
 std::ofstream C_OscLoggingHandler::mhc_File;
+uint64_t C_OscLoggingHandler::mhu64_FileSize = 0U;
+uint32_t C_OscLoggingHandler::mhu32_MaxFileSize = 0U;
+uint32_t C_OscLoggingHandler::mhu32_NumBackupFiles = 0U;
+std::string C_OscLoggingHandler::mhc_FileBuffer;
+std::vector<C_OscLoggingHandler::C_Entry> C_OscLoggingHandler::mhc_FileEntries;
+C_TglCriticalSection C_OscLoggingHandler::mhc_QueueCriticalSection;
+std::vector<C_OscLoggingHandler::C_Entry> C_OscLoggingHandler::mhc_QueuedEntries;
+uint32_t C_OscLoggingHandler::mhu32_NumDroppedEntries = 0U;
+bool C_OscLoggingHandler::mhq_WriterActive = false;
+bool C_OscLoggingHandler::mhq_StopWriter = false;
+bool C_OscLoggingHandler::mhq_WriteSynchronously = false;
+bool C_OscLoggingHandler::mhq_ExitHandlerRegistered = false;
+C_TglThread C_OscLoggingHandler::mhc_WriterThread;
+C_TglEvent C_OscLoggingHandler::mhc_WriterEvent;
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
@@ -64,10 +90,7 @@ void C_OscLoggingHandler::h_SetWriteToFileActive(const bool oq_Active, const boo
                                                  const bool oq_LogInitErrorsToConsole,
                                                  const bool oq_AutoFlushWarningsAndErrors)
 {
-   if (C_OscLoggingHandler::mhc_File.is_open() == true)
-   {
-      C_OscLoggingHandler::mhc_File.close();
-   }
+   mh_CloseFile();
    C_OscLoggingHandler::mhq_WriteToFile = oq_Active;
    C_OscLoggingHandler::mhq_AutoFlushAllFile = oq_AutoFlushAll;
    C_OscLoggingHandler::mhq_AutoFlushWarningsAndErrorsFile = oq_AutoFlushWarningsAndErrors;
@@ -105,14 +128,30 @@ void C_OscLoggingHandler::h_SetMeasurePerformanceActive(const bool oq_Active)
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscLoggingHandler::h_SetCompleteLogFileLocation(const C_SclString & orc_CompleteLogFileLocation)
 {
-   if (C_OscLoggingHandler::mhc_File.is_open() == true)
-   {
-      C_OscLoggingHandler::mhc_File.close();
-   }
+   mh_CloseFile();
    C_OscLoggingHandler::mhc_FileName = orc_CompleteLogFileLocation;
    mh_OpenFile();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set size based rotation of log file
+
+   If writing an entry would make the log file exceed the maximum size the file is renamed to "<file>.1",
+   existing backups are shifted to "<file>.2" ... and a new log file is started.
+   Backups exceeding the configured number are deleted.
+
+   \param[in] ou32_MaxFileSize    Maximum log file size in bytes (0: no rotation = default)
+   \param[in] ou32_NumBackupFiles Number of backup files to keep (0: discard the full log file)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::h_SetFileRotation(const uint32_t ou32_MaxFileSize, const uint32_t ou32_NumBackupFiles)
+{
+   C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+   C_OscLoggingHandler::mhu32_MaxFileSize = ou32_MaxFileSize;
+   C_OscLoggingHandler::mhu32_NumBackupFiles = ou32_NumBackupFiles;
+   C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get complete log file location
 
@@ -137,7 +176,7 @@ const C_SclString & C_OscLoggingHandler::h_GetCompleteLogFileLocation(void)
 void C_OscLoggingHandler::h_WriteLogInfo(const C_SclString & orc_Activity, const C_SclString & orc_Message,
                                          const char_t * const opcn_Class, const char_t * const opcn_Function)
 {
-   C_OscLoggingHandler::mh_WriteLog("INFO", orc_Activity, orc_Message, opcn_Class, opcn_Function);
+   C_OscLoggingHandler::mh_WriteLog(eINFO, orc_Activity, orc_Message, opcn_Class, opcn_Function);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -152,7 +191,7 @@ void C_OscLoggingHandler::h_WriteLogInfo(const C_SclString & orc_Activity, const
 void C_OscLoggingHandler::h_WriteLogWarning(const C_SclString & orc_Activity, const C_SclString & orc_Message,
                                             const char_t * const opcn_Class, const char_t * const opcn_Function)
 {
-   C_OscLoggingHandler::mh_WriteLog("WARNING", orc_Activity, orc_Message, opcn_Class, opcn_Function);
+   C_OscLoggingHandler::mh_WriteLog(eWARNING, orc_Activity, orc_Message, opcn_Class, opcn_Function);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -167,13 +206,14 @@ void C_OscLoggingHandler::h_WriteLogWarning(const C_SclString & orc_Activity, co
 void C_OscLoggingHandler::h_WriteLogError(const C_SclString & orc_Activity, const C_SclString & orc_Message,
                                           const char_t * const opcn_Class, const char_t * const opcn_Function)
 {
-   C_OscLoggingHandler::mh_WriteLog("ERROR", orc_Activity, orc_Message, opcn_Class, opcn_Function);
+   C_OscLoggingHandler::mh_WriteLog(eERROR, orc_Activity, orc_Message, opcn_Class, opcn_Function);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Write time measurement message to log
 
    Previous call of C_OscLoggingHandler::h_StartPerformanceTimer() is mandatory ("tik and tok").
+   If tracing is active the measurement is also recorded as trace event (see C_OscTraceHandler).
 
    \param[in] ou16_TimerId  Timer ID returned by previous call of C_OscLoggingHandler::h_StartPerformanceTimer()
    \param[in] orc_Message   Message to write (No '\n' necessary)
@@ -184,22 +224,28 @@ void C_OscLoggingHandler::h_WriteLogError(const C_SclString & orc_Activity, cons
 void C_OscLoggingHandler::h_WriteLogPerformance(const uint16_t ou16_TimerId, const C_SclString & orc_Message,
                                                 const char_t * const opcn_Class, const char_t * const opcn_Function)
 {
-   if (mhq_MeasureTime == true)
+   const std::map< uint16_t, uint64_t >::iterator c_StartTime = mhc_StartTimes.find(ou16_TimerId);
+
+   if (c_StartTime != mhc_StartTimes.end())
    {
-      const std::map< uint16_t, uint32_t >::iterator c_StartTime = mhc_StartTimes.find(ou16_TimerId);
-      if (c_StartTime != mhc_StartTimes.end())
+      const uint64_t u64_DurationUs = stw::tgl::TglGetTickCountUs() - c_StartTime->second;
+
+      if (mhq_MeasureTime == true)
       {
          C_OscLoggingHandler::mh_WriteLog(
-            "INFO", "Performance measurement",
-            orc_Message + " time: " + C_SclString::IntToStr(stw::tgl::TglGetTickCount() - c_StartTime->second) + " ms",
+            eINFO, "Performance measurement",
+            orc_Message + " time: " + C_SclString::IntToStr(u64_DurationUs / 1000U) + " ms",
             opcn_Class, opcn_Function);
 
          // update log file
          C_OscLoggingHandler::h_Flush();
-
-         // remove ID from map
-         mhc_StartTimes.erase(c_StartTime);
       }
+
+      C_OscTraceHandler::h_AddEvent("Performance measurement", orc_Message, "", c_StartTime->second,
+                                    u64_DurationUs);
+
+      // remove ID from map
+      mhc_StartTimes.erase(c_StartTime);
    }
 }
 
@@ -214,7 +260,7 @@ uint16_t C_OscLoggingHandler::h_StartPerformanceTimer(void)
 {
    const uint16_t u16_Id = static_cast< uint16_t > (rand());
 
-   mhc_StartTimes[u16_Id] = stw::tgl::TglGetTickCount();
+   mhc_StartTimes[u16_Id] = stw::tgl::TglGetTickCountUs();
 
    return u16_Id;
 }
@@ -294,14 +340,10 @@ void C_OscLoggingHandler::h_Flush(void)
       C_OscLoggingHandler::mhc_ConsoleCriticalSection.Release();
    }
 
-   //File
-   if ((C_OscLoggingHandler::mhq_WriteToFile == true) && (C_OscLoggingHandler::mhc_File.is_open() == true))
+   //File: write everything logged so far instead of waiting for the writer thread
+   if (C_OscLoggingHandler::mhq_WriteToFile == true)
    {
-      //Critical section
-      C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
-      C_OscLoggingHandler::mhc_File.flush();
-      //Critical section
-      C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+      C_OscLoggingHandler::mh_WriteQueuedEntries(true);
    }
 }
 
@@ -318,27 +360,20 @@ void C_OscLoggingHandler::h_Flush(void)
 //----------------------------------------------------------------------------------------------------------------------
 std::string C_OscLoggingHandler::h_UtilConvertDateTimeToString(const C_TglDateTime & orc_DateTime)
 {
-   std::stringstream c_Stream;
-
-   c_Stream << &std::right << std::setw(4) << std::setfill('0') << orc_DateTime.mu16_Year << "-";
-   c_Stream << &std::right << std::setw(2) << std::setfill('0') << static_cast< uint16_t > (orc_DateTime.mu8_Month) <<
-      "-";
-   c_Stream << &std::right << std::setw(2) << std::setfill('0') << static_cast< uint16_t > (orc_DateTime.mu8_Day) <<
-      " ";
-   c_Stream << &std::right << std::setw(2) << std::setfill('0') << static_cast< uint16_t > (orc_DateTime.mu8_Hour) <<
-      ":";
-   c_Stream << &std::right << std::setw(2) << std::setfill('0') << static_cast< uint16_t > (orc_DateTime.mu8_Minute) <<
-      ":";
-   c_Stream << &std::right << std::setw(2) << std::setfill('0') << static_cast< uint16_t > (orc_DateTime.mu8_Second) <<
-      ".";
-   c_Stream << &std::right << std::setw(3) << std::setfill('0') << orc_DateTime.mu16_MilliSeconds;
-   return c_Stream.str();
+   std::string c_Text;
+
+   C_OscLoggingHandler::mh_AppendDateTime(c_Text, orc_DateTime);
+   return c_Text;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Write message to log
 
-   \param[in] oe_Type       Message type (maximum 7 characters)
+   Console output is written directly.
+   For file output the entry is only queued; it is formatted and written by the writer thread.
+   Exception: entries which shall be flushed automatically are written and flushed before returning.
+
+   \param[in] oe_Type       Message type
    \param[in] orc_Activity  Current activity (maximum 26 characters)
    \param[in] orc_Message   Message to write
    \param[in] opcn_Class    Current class (combined with function: maximum 50 characters)
@@ -346,27 +381,112 @@ std::string C_OscLoggingHandler::h_UtilConvertDateTimeToString(const C_TglDateTi
    \param[in] opcn_Function Current function (combined with function: maximum 50 characters)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OscLoggingHandler::mh_WriteLog(const C_SclString & orc_Type, const C_SclString & orc_Activity,
+void C_OscLoggingHandler::mh_WriteLog(const E_Type oe_Type, const C_SclString & orc_Activity,
                                       const C_SclString & orc_Message, const char_t * const opcn_Class,
                                       const char_t * const opcn_Function)
 {
-   std::string c_DateTimeFormatted;
-   C_TglDateTime c_DateTime;
-   std::stringstream c_LogEntryStream;
+   C_Entry c_Entry;
+
+   TglGetDateTimeNow(c_Entry.c_DateTime);
+   c_Entry.e_Type = oe_Type;
+   c_Entry.c_Activity = orc_Activity;
+   c_Entry.c_Message = orc_Message;
+   if (opcn_Class != NULL)
+   {
+      c_Entry.c_Class = opcn_Class;
+   }
+   if (opcn_Function != NULL)
+   {
+      c_Entry.c_Function = opcn_Function;
+   }
+
+   //Console
+   if (C_OscLoggingHandler::mhq_WriteToConsole == true)
+   {
+      std::string c_Line;
+      C_OscLoggingHandler::mh_FormatEntry(c_Entry, c_Line);
+
+      //Critical section
+      C_OscLoggingHandler::mhc_ConsoleCriticalSection.Acquire();
+      std::cout << c_Line;
+      //Critical section
+      C_OscLoggingHandler::mhc_ConsoleCriticalSection.Release();
+   }
+
+   //File
+   if (C_OscLoggingHandler::mhq_WriteToFile == true)
+   {
+      const bool q_Flush = (C_OscLoggingHandler::mhq_AutoFlushAllFile == true) ||
+                           ((C_OscLoggingHandler::mhq_AutoFlushWarningsAndErrorsFile == true) && (oe_Type != eINFO));
+      bool q_WriteNow = false;
+      bool q_WakeWriter = false;
+
+      //Critical section
+      C_OscLoggingHandler::mhc_QueueCriticalSection.Acquire();
+      if (C_OscLoggingHandler::mhq_WriterActive == true)
+      {
+         //entries written right away below must not be dropped
+         if ((C_OscLoggingHandler::mhc_QueuedEntries.size() < mhu32_MAX_QUEUED_ENTRIES) || (q_Flush == true))
+         {
+            //the writer takes all queued entries at once: only wake it up for the first one
+            q_WakeWriter = C_OscLoggingHandler::mhc_QueuedEntries.empty();
+            C_OscLoggingHandler::mhc_QueuedEntries.push_back(c_Entry);
+         }
+         else
+         {
+            //do not block the logging thread if the writer cannot keep up
+            ++C_OscLoggingHandler::mhu32_NumDroppedEntries;
+         }
+         q_WriteNow = (C_OscLoggingHandler::mhq_WriteSynchronously == true) || (q_Flush == true);
+      }
+      //Critical section
+      C_OscLoggingHandler::mhc_QueueCriticalSection.Release();
+
+      if (q_WriteNow == true)
+      {
+         //also writes the entries queued before, so the order in the file is kept
+         C_OscLoggingHandler::mh_WriteQueuedEntries(q_Flush);
+      }
+      else if (q_WakeWriter == true)
+      {
+         C_OscLoggingHandler::mhc_WriterEvent.Signal();
+      }
+      else
+      {
+         //writer was already woken up
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Format log entry
+
+   Format:
+   [DATE/TIME] [TYPE_OF_REPORT (Info, Warning, Error)] [ACTIVITY] [CLASS::FUNCTION] [MESSAGE]
+   2017-08-29 07:32:19.123      INFO       Startup         Main                            Application started.
+
+   \param[in]     orc_Entry   Log entry
+   \param[in,out] orc_Line    Formatted line including line break is appended
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_FormatEntry(const C_Entry & orc_Entry, std::string & orc_Line)
+{
    C_SclString c_Class;
    C_SclString c_Function;
-   C_SclString c_CombinedClassAndFunction;
-   if (opcn_Class != NULL)
+   const char_t * pcn_Type;
+   const std::string::size_type x_Start = orc_Line.size();
+
+   if (orc_Entry.c_Class.IsEmpty() == false)
    {
-      c_Class = TglChangeFileExtension(TglExtractFileName(opcn_Class), "");
+      c_Class = TglChangeFileExtension(TglExtractFileName(orc_Entry.c_Class), "");
    }
    else
    {
       c_Class = "UNKNOWN_CLASS";
    }
-   if (opcn_Function != NULL)
+   if (orc_Entry.c_Function.IsEmpty() == false)
    {
-      c_Function = opcn_Function;
+      c_Function = orc_Entry.c_Function;
    }
    else
    {
@@ -385,56 +505,120 @@ void C_OscLoggingHandler::mh_WriteLog(const C_SclString & orc_Type, const C_SclS
       c_Function.Delete(1, c_Class.Length());
    }
 
-   c_CombinedClassAndFunction = c_Class + c_Function;
+   switch (orc_Entry.e_Type)
+   {
+   case eWARNING:
+      pcn_Type = "WARNING";
+      break;
+   case eERROR:
+      pcn_Type = "ERROR";
+      break;
+   case eINFO:
+   default:
+      pcn_Type = "INFO";
+      break;
+   }
 
-   TglGetDateTimeNow(c_DateTime);
-   c_DateTimeFormatted = C_OscLoggingHandler::h_UtilConvertDateTimeToString(c_DateTime);
+   orc_Line.reserve(x_Start + 120U + orc_Entry.c_Message.Length());
+   C_OscLoggingHandler::mh_AppendDateTime(orc_Line, orc_Entry.c_DateTime);
+   if ((orc_Line.size() - x_Start) < 25U)
+   {
+      orc_Line.append(25U - (orc_Line.size() - x_Start), ' ');
+   }
+   C_OscLoggingHandler::mh_AppendPadded(orc_Line, pcn_Type, 7U);
+   orc_Line += "  ";
+   C_OscLoggingHandler::mh_AppendPadded(orc_Line, orc_Entry.c_Activity.c_str(), 26U);
+   orc_Line += "  ";
+   C_OscLoggingHandler::mh_AppendPadded(orc_Line, (c_Class + c_Function).c_str(), 52U);
+   orc_Line += "  ";
+   orc_Line += orc_Entry.c_Message.c_str();
+   orc_Line += '\n';
+}
 
-   //Format:
-   //[DATE/TIME] [TYPE_OF_REPORT (Info, Warning, Error)] [ACTIVITY] [CLASS::FUNCTION] [MESSAGE]
-   //2017-08-29 07:32:19.123      INFO       Startup         Main                            Application started.
-   c_LogEntryStream << &std::left << std::setw(25) << c_DateTimeFormatted;
-   c_LogEntryStream << &std::left << std::setw(7) << orc_Type.c_str();
-   c_LogEntryStream << "  ";
-   c_LogEntryStream << &std::left << std::setw(26) << orc_Activity.c_str();
-   c_LogEntryStream << "  ";
-   c_LogEntryStream << &std::left << std::setw(52) << c_CombinedClassAndFunction.c_str();
-   c_LogEntryStream << "  ";
-   c_LogEntryStream << &std::left << orc_Message.c_str() << &std::endl;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append text left aligned and padded with spaces to a minimum width
 
-   //Console
-   if (C_OscLoggingHandler::mhq_WriteToConsole == true)
+   \param[in,out] orc_Line    Line to append to
+   \param[in]     opcn_Text   Text to append
+   \param[in]     ou32_Width  Minimum number of characters to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_AppendPadded(std::string & orc_Line, const char_t * const opcn_Text,
+                                          const uint32_t ou32_Width)
+{
+   const uint32_t u32_Length = static_cast<uint32_t>(std::strlen(opcn_Text));
+
+   orc_Line.append(opcn_Text, u32_Length);
+   if (u32_Length < ou32_Width)
    {
-      //Critical section
-      C_OscLoggingHandler::mhc_ConsoleCriticalSection.Acquire();
-      std::cout << c_LogEntryStream.str();
-      //Critical section
-      C_OscLoggingHandler::mhc_ConsoleCriticalSection.Release();
+      orc_Line.append(ou32_Width - u32_Length, ' ');
    }
+}
 
-   //File
-   if ((C_OscLoggingHandler::mhq_WriteToFile == true) && (C_OscLoggingHandler::mhc_File.is_open() == true))
-   {
-      const std::string c_Message = c_LogEntryStream.str();
-      //Critical section
-      C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append decimal number with leading zeros
 
-      //TGL critical section -> file
-      C_OscLoggingHandler::mhc_File.write(c_Message.c_str(), c_Message.size());
-      if ((mhq_AutoFlushAllFile == true) ||
-          ((C_OscLoggingHandler::mhq_AutoFlushWarningsAndErrorsFile == true) &&
-           ((orc_Type == "WARNING") || (orc_Type == "ERROR"))))
-      {
-         C_OscLoggingHandler::mhc_File.flush();
-      }
+   \param[in,out] orc_Line     Line to append to
+   \param[in]     ou32_Value   Value to append
+   \param[in]     ou32_Digits  Minimum number of digits
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_AppendNumber(std::string & orc_Line, const uint32_t ou32_Value,
+                                          const uint32_t ou32_Digits)
+{
+   char_t acn_Digits[10];
+   uint32_t u32_Value = ou32_Value;
+   uint32_t u32_NumDigits = 0U;
 
-      //Critical section
-      C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+   do
+   {
+      acn_Digits[u32_NumDigits] = static_cast<char_t>('0' + static_cast<char_t>(u32_Value % 10U));
+      u32_Value /= 10U;
+      ++u32_NumDigits;
+   }
+   while (u32_Value > 0U);
+
+   if (u32_NumDigits < ou32_Digits)
+   {
+      orc_Line.append(ou32_Digits - u32_NumDigits, '0');
+   }
+   while (u32_NumDigits > 0U)
+   {
+      --u32_NumDigits;
+      orc_Line += acn_Digits[u32_NumDigits];
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append date time in log format
+
+   Format:2017-08-29 07:32:19.123
+
+   \param[in,out] orc_Line       Line to append to
+   \param[in]     orc_DateTime   Date time structure
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_AppendDateTime(std::string & orc_Line, const C_TglDateTime & orc_DateTime)
+{
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu16_Year, 4U);
+   orc_Line += '-';
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu8_Month, 2U);
+   orc_Line += '-';
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu8_Day, 2U);
+   orc_Line += ' ';
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu8_Hour, 2U);
+   orc_Line += ':';
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu8_Minute, 2U);
+   orc_Line += ':';
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu8_Second, 2U);
+   orc_Line += '.';
+   C_OscLoggingHandler::mh_AppendNumber(orc_Line, orc_DateTime.mu16_MilliSeconds, 3U);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Open file if necessary
+
+   Starts the writer thread for the opened file.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscLoggingHandler::mh_OpenFile(void)
@@ -461,7 +645,207 @@ void C_OscLoggingHandler::mh_OpenFile(void)
             osc_write_log_warning("openSYDE logging engine", c_ErrorText);
          }
       }
+      else
+      {
+         bool q_WriteSynchronously = false;
+         //64 bit position: log files are not limited to 4GB if rotation is not configured
+         const std::streamoff x_FileSize = C_OscLoggingHandler::mhc_File.seekp(0, std::ios::end).tellp();
+
+         C_OscLoggingHandler::mhu64_FileSize = (x_FileSize > 0) ? static_cast<uint64_t>(x_FileSize) : 0U;
+
+         //make sure remaining entries are written on application exit
+         if (C_OscLoggingHandler::mhq_ExitHandlerRegistered == false)
+         {
+            C_OscLoggingHandler::mhq_ExitHandlerRegistered = (std::atexit(&C_OscLoggingHandler::mh_OnExit) == 0);
+         }
+
+         C_OscLoggingHandler::mhq_StopWriter = false;
+         if ((C_OscLoggingHandler::mhq_ExitHandlerRegistered == false) ||
+             (C_OscLoggingHandler::mhc_WriterThread.Start(&C_OscLoggingHandler::mh_WriterThreadFunc, NULL) != C_NO_ERR))
+         {
+            //fall back to writing each entry in the logging thread
+            q_WriteSynchronously = true;
+         }
+
+         //Critical section
+         C_OscLoggingHandler::mhc_QueueCriticalSection.Acquire();
+         C_OscLoggingHandler::mhq_WriteSynchronously = q_WriteSynchronously;
+         C_OscLoggingHandler::mhq_WriterActive = true;
+         //Critical section
+         C_OscLoggingHandler::mhc_QueueCriticalSection.Release();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop writer thread, write all remaining entries and close file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_CloseFile(void)
+{
+   //Critical section
+   C_OscLoggingHandler::mhc_QueueCriticalSection.Acquire();
+   //no further entries are accepted
+   C_OscLoggingHandler::mhq_WriterActive = false;
+   C_OscLoggingHandler::mhq_StopWriter = true;
+   //Critical section
+   C_OscLoggingHandler::mhc_QueueCriticalSection.Release();
+
+   C_OscLoggingHandler::mhc_WriterEvent.Signal();
+   C_OscLoggingHandler::mhc_WriterThread.Join();
+   C_OscLoggingHandler::mh_WriteQueuedEntries(true);
+
+   //Critical section
+   C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+   if (C_OscLoggingHandler::mhc_File.is_open() == true)
+   {
+      C_OscLoggingHandler::mhc_File.close();
+   }
+   //Critical section
+   C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Move full log file to first backup and start a new log file
+
+   Caller is responsible for holding the file critical section.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_RotateFile(void)
+{
+   const C_SclString & rc_FileName = C_OscLoggingHandler::mhc_FileName;
+
+   C_OscLoggingHandler::mhc_File.close();
+   if (C_OscLoggingHandler::mhu32_NumBackupFiles == 0U)
+   {
+      (void)std::remove(rc_FileName.c_str());
+   }
+   else
+   {
+      //rename does not replace existing files on all platforms: remove oldest backup first
+      (void)std::remove((rc_FileName + "." + C_SclString::IntToStr(C_OscLoggingHandler::mhu32_NumBackupFiles)).c_str());
+      for (uint32_t u32_Backup = C_OscLoggingHandler::mhu32_NumBackupFiles - 1U; u32_Backup > 0U; --u32_Backup)
+      {
+         (void)std::rename((rc_FileName + "." + C_SclString::IntToStr(u32_Backup)).c_str(),
+                           (rc_FileName + "." + C_SclString::IntToStr(u32_Backup + 1U)).c_str());
+      }
+      (void)std::rename(rc_FileName.c_str(), (rc_FileName + ".1").c_str());
+   }
+   C_OscLoggingHandler::mhc_File.open(rc_FileName.c_str(), std::ios::app);
+   C_OscLoggingHandler::mhu64_FileSize = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Format and write all queued entries to file
+
+   \param[in] oq_Flush    true: flush file after writing
+                          false: flush only as configured by h_SetWriteToFileActive
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_WriteQueuedEntries(const bool oq_Flush)
+{
+   uint32_t u32_NumDropped;
+   bool q_Flush = oq_Flush || C_OscLoggingHandler::mhq_AutoFlushAllFile;
+
+   //Critical section
+   C_OscLoggingHandler::mhc_FileCriticalSection.Acquire();
+
+   //take over all queued entries; the logging threads continue with the emptied container
+   //Critical section
+   C_OscLoggingHandler::mhc_QueueCriticalSection.Acquire();
+   C_OscLoggingHandler::mhc_FileEntries.swap(C_OscLoggingHandler::mhc_QueuedEntries);
+   u32_NumDropped = C_OscLoggingHandler::mhu32_NumDroppedEntries;
+   C_OscLoggingHandler::mhu32_NumDroppedEntries = 0U;
+   //Critical section
+   C_OscLoggingHandler::mhc_QueueCriticalSection.Release();
+
+   if (u32_NumDropped > 0U)
+   {
+      C_Entry c_Entry;
+      TglGetDateTimeNow(c_Entry.c_DateTime);
+      c_Entry.e_Type = eWARNING;
+      c_Entry.c_Activity = "openSYDE logging engine";
+      c_Entry.c_Message = "Log queue was full. " + C_SclString::IntToStr(u32_NumDropped) +
+                          " log entries were dropped.";
+      c_Entry.c_Class = __FILE__;
+      c_Entry.c_Function = TGL_UTIL_FUNC_ID;
+      C_OscLoggingHandler::mhc_FileEntries.push_back(c_Entry);
+   }
+
+   if ((C_OscLoggingHandler::mhc_FileEntries.empty() == false) && (C_OscLoggingHandler::mhc_File.is_open() == true))
+   {
+      std::string c_Line;
+      C_OscLoggingHandler::mhc_FileBuffer.clear();
+      for (uint32_t u32_ItEntry = 0U; u32_ItEntry < C_OscLoggingHandler::mhc_FileEntries.size(); ++u32_ItEntry)
+      {
+         const C_Entry & rc_Entry = C_OscLoggingHandler::mhc_FileEntries[u32_ItEntry];
+         const uint64_t u64_SizeBefore = C_OscLoggingHandler::mhu64_FileSize +
+                                         static_cast<uint64_t>(C_OscLoggingHandler::mhc_FileBuffer.size());
+
+         c_Line.clear();
+         C_OscLoggingHandler::mh_FormatEntry(rc_Entry, c_Line);
+         if (((C_OscLoggingHandler::mhu32_MaxFileSize > 0U) && (u64_SizeBefore > 0U)) &&
+             ((u64_SizeBefore + c_Line.size()) > C_OscLoggingHandler::mhu32_MaxFileSize))
+         {
+            C_OscLoggingHandler::mhc_File.write(C_OscLoggingHandler::mhc_FileBuffer.c_str(),
+                                                C_OscLoggingHandler::mhc_FileBuffer.size());
+            C_OscLoggingHandler::mhc_FileBuffer.clear();
+            C_OscLoggingHandler::mh_RotateFile();
+         }
+         C_OscLoggingHandler::mhc_FileBuffer += c_Line;
+
+         if ((C_OscLoggingHandler::mhq_AutoFlushWarningsAndErrorsFile == true) && (rc_Entry.e_Type != eINFO))
+         {
+            q_Flush = true;
+         }
+      }
+      C_OscLoggingHandler::mhc_File.write(C_OscLoggingHandler::mhc_FileBuffer.c_str(),
+                                          C_OscLoggingHandler::mhc_FileBuffer.size());
+      C_OscLoggingHandler::mhu64_FileSize += static_cast<uint64_t>(C_OscLoggingHandler::mhc_FileBuffer.size());
+   }
+   if ((q_Flush == true) && (C_OscLoggingHandler::mhc_File.is_open() == true))
+   {
+      C_OscLoggingHandler::mhc_File.flush();
    }
+   //keep capacity for the next batch
+   C_OscLoggingHandler::mhc_FileEntries.clear();
+
+   //Critical section
+   C_OscLoggingHandler::mhc_FileCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Writer thread: write queued entries to file whenever woken up until stopped
+
+   \param[in] opv_Instance   not used
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_WriterThreadFunc(void * const opv_Instance)
+{
+   bool q_Stop = false;
+
+   (void)opv_Instance;
+   while (q_Stop == false)
+   {
+      C_OscLoggingHandler::mhc_WriterEvent.Wait();
+
+      //Critical section
+      C_OscLoggingHandler::mhc_QueueCriticalSection.Acquire();
+      q_Stop = C_OscLoggingHandler::mhq_StopWriter;
+      //Critical section
+      C_OscLoggingHandler::mhc_QueueCriticalSection.Release();
+
+      C_OscLoggingHandler::mh_WriteQueuedEntries(false);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write remaining entries on application exit
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscLoggingHandler::mh_OnExit(void)
+{
+   C_OscLoggingHandler::mh_CloseFile();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,382 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Recording of timed scopes for profiling
+
+   Applications activate tracing (e.g. by a command line option) and export the recorded events to a file
+   in Chrome trace event format. The file can be viewed with Perfetto (ui.perfetto.dev) or chrome://tracing.
+
+   Code to profile creates a C_OscTraceScope on the stack. If tracing is not active the scope only checks a flag.
+   If tracing is active the scope adds one event with start time, duration and thread ID when it is destroyed.
+   The number of recorded events is limited; further events are dropped.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <fstream>
+#include <map>
+
+#include "stwerrors.hpp"
+#include "TglTime.hpp"
+#include "C_OscTraceHandler.hpp"
+#include "C_OscLoggingHandler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
+using namespace stw::tgl;
+using namespace stw::errors;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscTraceHandler::mhu32_MAX_EVENTS = 1000000U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+bool C_OscTraceHandler::mhq_Active = false;
+std::vector<C_OscTraceHandler::C_Event> C_OscTraceHandler::mhc_Events;
+uint32_t C_OscTraceHandler::mhu32_NumDroppedEvents = 0U;
+C_TglCriticalSection C_OscTraceHandler::mhc_CriticalSection;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscTraceSummary::C_OscTraceSummary(void) :
+   c_Name(""),
+   u32_Count(0U),
+   u64_TotalUs(0U),
+   u64_MaxUs(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set tracing active
+
+   Recorded events are kept when tracing is deactivated.
+
+   \param[in] oq_Active   true: record events of C_OscTraceScope
+                          false: do not record events (= default)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscTraceHandler::h_SetActive(const bool oq_Active)
+{
+   C_OscTraceHandler::mhq_Active = oq_Active;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get tracing active flag
+
+   Can be used to skip preparing trace details if tracing is not active.
+
+   \return
+   true    events are recorded
+   false   events are not recorded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscTraceHandler::h_IsActive(void)
+{
+   return C_OscTraceHandler::mhq_Active;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all recorded events
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscTraceHandler::h_Clear(void)
+{
+   C_OscTraceHandler::mhc_CriticalSection.Acquire();
+   C_OscTraceHandler::mhc_Events.clear();
+   C_OscTraceHandler::mhu32_NumDroppedEvents = 0U;
+   C_OscTraceHandler::mhc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of recorded events
+
+   \return
+   Number of recorded events
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscTraceHandler::h_GetNumEvents(void)
+{
+   uint32_t u32_Retval;
+
+   C_OscTraceHandler::mhc_CriticalSection.Acquire();
+   u32_Retval = static_cast<uint32_t>(C_OscTraceHandler::mhc_Events.size());
+   C_OscTraceHandler::mhc_CriticalSection.Release();
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add event for the calling thread
+
+   Only recorded if tracing is active.
+
+   \param[in] orc_Category      Category (e.g. phase of application)
+   \param[in] orc_Name          Name of event
+   \param[in] orc_Detail        Optional detail information (e.g. node name or file path)
+   \param[in] ou64_StartUs      Start time (time base of TglGetTickCountUs)
+   \param[in] ou64_DurationUs   Duration
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscTraceHandler::h_AddEvent(const C_SclString & orc_Category, const C_SclString & orc_Name,
+                                   const C_SclString & orc_Detail, const uint64_t ou64_StartUs,
+                                   const uint64_t ou64_DurationUs)
+{
+   if (C_OscTraceHandler::mhq_Active == true)
+   {
+      const uint32_t u32_ThreadId = TglGetCurrentThreadId();
+
+      C_OscTraceHandler::mhc_CriticalSection.Acquire();
+      if (C_OscTraceHandler::mhc_Events.size() < mhu32_MAX_EVENTS)
+      {
+         C_Event c_Event;
+         c_Event.c_Category = orc_Category;
+         c_Event.c_Name = orc_Name;
+         c_Event.c_Detail = orc_Detail;
+         c_Event.u64_StartUs = ou64_StartUs;
+         c_Event.u64_DurationUs = ou64_DurationUs;
+         c_Event.u32_ThreadId = u32_ThreadId;
+         C_OscTraceHandler::mhc_Events.push_back(c_Event);
+      }
+      else
+      {
+         ++C_OscTraceHandler::mhu32_NumDroppedEvents;
+      }
+      C_OscTraceHandler::mhc_CriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write recorded events to file in Chrome trace event format (JSON)
+
+   Time stamps are relative to the earliest recorded event.
+
+   \param[in] orc_FilePath   Path of file to write (an existing file is replaced)
+
+   \return
+   C_NO_ERR   file written
+   C_RD_WR    could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscTraceHandler::h_ExportChromeTrace(const C_SclString & orc_FilePath)
+{
+   int32_t s32_Retval = C_NO_ERR;
+   std::string c_Json;
+   uint32_t u32_NumDropped;
+   uint64_t u64_TimeBaseUs = 0U;
+   std::ofstream c_File;
+
+   C_OscTraceHandler::mhc_CriticalSection.Acquire();
+
+   for (uint32_t u32_ItEvent = 0U; u32_ItEvent < C_OscTraceHandler::mhc_Events.size(); ++u32_ItEvent)
+   {
+      const uint64_t u64_StartUs = C_OscTraceHandler::mhc_Events[u32_ItEvent].u64_StartUs;
+      if ((u32_ItEvent == 0U) || (u64_StartUs < u64_TimeBaseUs))
+      {
+         u64_TimeBaseUs = u64_StartUs;
+      }
+   }
+
+   c_Json.reserve(C_OscTraceHandler::mhc_Events.size() * 150U);
+   c_Json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   for (uint32_t u32_ItEvent = 0U; u32_ItEvent < C_OscTraceHandler::mhc_Events.size(); ++u32_ItEvent)
+   {
+      const C_Event & rc_Event = C_OscTraceHandler::mhc_Events[u32_ItEvent];
+
+      c_Json += (u32_ItEvent == 0U) ? "\n{\"name\":" : ",\n{\"name\":";
+      C_OscTraceHandler::mh_AppendJsonString(c_Json, rc_Event.c_Name);
+      c_Json += ",\"cat\":";
+      C_OscTraceHandler::mh_AppendJsonString(c_Json, rc_Event.c_Category);
+      c_Json += ",\"ph\":\"X\",\"ts\":";
+      c_Json += C_SclString::IntToStr(rc_Event.u64_StartUs - u64_TimeBaseUs).c_str();
+      c_Json += ",\"dur\":";
+      c_Json += C_SclString::IntToStr(rc_Event.u64_DurationUs).c_str();
+      c_Json += ",\"pid\":1,\"tid\":";
+      c_Json += C_SclString::IntToStr(rc_Event.u32_ThreadId).c_str();
+      if (rc_Event.c_Detail.IsEmpty() == false)
+      {
+         c_Json += ",\"args\":{\"detail\":";
+         C_OscTraceHandler::mh_AppendJsonString(c_Json, rc_Event.c_Detail);
+         c_Json += "}";
+      }
+      c_Json += "}";
+   }
+   c_Json += "\n]}\n";
+   u32_NumDropped = C_OscTraceHandler::mhu32_NumDroppedEvents;
+   C_OscTraceHandler::mhc_CriticalSection.Release();
+
+   c_File.open(orc_FilePath.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+   if (c_File.is_open() == true)
+   {
+      c_File.write(c_Json.c_str(), c_Json.size());
+      c_File.close();
+      if (c_File.good() == false)
+      {
+         s32_Retval = C_RD_WR;
+      }
+   }
+   else
+   {
+      s32_Retval = C_RD_WR;
+   }
+
+   if (s32_Retval != C_NO_ERR)
+   {
+      osc_write_log_error("Tracing", "Could not write trace file \"" + orc_FilePath + "\".");
+   }
+   else if (u32_NumDropped > 0U)
+   {
+      osc_write_log_warning("Tracing", "Trace file \"" + orc_FilePath + "\" is incomplete. " +
+                            C_SclString::IntToStr(u32_NumDropped) + " events were dropped.");
+   }
+   else
+   {
+      //nothing to report
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get accumulated durations of the recorded events of one category
+
+   The durations of events of concurrent threads are added up. So the total of an event name can be higher than the
+   elapsed time.
+
+   \param[in]  orc_Category   Category of events to evaluate
+   \param[out] orc_Summary    One entry per event name; sorted by name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscTraceHandler::h_GetSummary(const C_SclString & orc_Category, std::vector<C_OscTraceSummary> & orc_Summary)
+{
+   std::map<C_SclString, C_OscTraceSummary> c_SummaryPerName;
+
+   C_OscTraceHandler::mhc_CriticalSection.Acquire();
+   for (uint32_t u32_ItEvent = 0U; u32_ItEvent < C_OscTraceHandler::mhc_Events.size(); ++u32_ItEvent)
+   {
+      const C_Event & rc_Event = C_OscTraceHandler::mhc_Events[u32_ItEvent];
+      if (rc_Event.c_Category == orc_Category)
+      {
+         C_OscTraceSummary & rc_Summary = c_SummaryPerName[rc_Event.c_Name];
+         rc_Summary.c_Name = rc_Event.c_Name;
+         ++rc_Summary.u32_Count;
+         rc_Summary.u64_TotalUs += rc_Event.u64_DurationUs;
+         if (rc_Event.u64_DurationUs > rc_Summary.u64_MaxUs)
+         {
+            rc_Summary.u64_MaxUs = rc_Event.u64_DurationUs;
+         }
+      }
+   }
+   C_OscTraceHandler::mhc_CriticalSection.Release();
+
+   orc_Summary.clear();
+   orc_Summary.reserve(c_SummaryPerName.size());
+   for (std::map<C_SclString, C_OscTraceSummary>::const_iterator c_It = c_SummaryPerName.begin();
+        c_It != c_SummaryPerName.end(); ++c_It)
+   {
+      orc_Summary.push_back(c_It->second);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append text as JSON string literal
+
+   \param[in,out] orc_Json   JSON text to append to
+   \param[in]     orc_Text   Text to append
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscTraceHandler::mh_AppendJsonString(std::string & orc_Json, const C_SclString & orc_Text)
+{
+   static const char_t hacn_HEX_DIGITS[] = "0123456789abcdef";
+
+   orc_Json += '"';
+   for (uint32_t u32_ItChar = 0U; u32_ItChar < orc_Text.Length(); ++u32_ItChar)
+   {
+      const char_t cn_Char = orc_Text.c_str()[u32_ItChar];
+      const uint8_t u8_Char = static_cast<uint8_t>(cn_Char);
+
+      if ((cn_Char == '"') || (cn_Char == '\\'))
+      {
+         orc_Json += '\\';
+         orc_Json += cn_Char;
+      }
+      else if (u8_Char < 0x20U)
+      {
+         orc_Json += "\\u00";
+         orc_Json += hacn_HEX_DIGITS[u8_Char >> 4U];
+         orc_Json += hacn_HEX_DIGITS[u8_Char & 0x0FU];
+      }
+      else
+      {
+         orc_Json += cn_Char;
+      }
+   }
+   orc_Json += '"';
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start scope
+
+   \param[in] opcn_Category   Category (e.g. phase of application); must be a static text
+   \param[in] opcn_Name       Name of event; must be a static text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscTraceScope::C_OscTraceScope(const char_t * const opcn_Category, const char_t * const opcn_Name) :
+   mpcn_Category(opcn_Category),
+   mpcn_Name(opcn_Name),
+   mq_Active(C_OscTraceHandler::h_IsActive()),
+   mu64_StartUs(0U)
+{
+   if (this->mq_Active == true)
+   {
+      this->mu64_StartUs = TglGetTickCountUs();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start scope with detail information
+
+   \param[in] opcn_Category   Category (e.g. phase of application); must be a static text
+   \param[in] opcn_Name       Name of event; must be a static text
+   \param[in] orc_Detail      Detail information (e.g. node name or file path)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscTraceScope::C_OscTraceScope(const char_t * const opcn_Category, const char_t * const opcn_Name,
+                                 const C_SclString & orc_Detail) :
+   mpcn_Category(opcn_Category),
+   mpcn_Name(opcn_Name),
+   mq_Active(C_OscTraceHandler::h_IsActive()),
+   mu64_StartUs(0U)
+{
+   if (this->mq_Active == true)
+   {
+      this->mc_Detail = orc_Detail;
+      this->mu64_StartUs = TglGetTickCountUs();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   End scope and record event
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscTraceScope::~C_OscTraceScope(void)
+{
+   if (this->mq_Active == true)
+   {
+      const uint64_t u64_EndUs = TglGetTickCountUs();
+      C_OscTraceHandler::h_AddEvent(this->mpcn_Category, this->mpcn_Name, this->mc_Detail, this->mu64_StartUs,
+                                    u64_EndUs - this->mu64_StartUs);
+   }
+}
@@ -5,12 +5,12 @@
 
    Data class for any supported data type
 
-   All SetValue* and GetValue* functions are synchronized and thread safe.
-   All other functions (SetArray for example) are not thread safe and shall not be used
-   if more than one thread are accessing to the instance.
+   The class is not thread safe. Instances are accessed by many threads only in combination with the data dealers.
+   So synchronization is done there (cf. C_OscDataDealer) instead of spending one lock for each instance.
 
-   The data is held in a std::vector of uint8.
-   The getter and setter functions place the data into that vector in native endianness.
+   The data is held in a C_OscNodeDataPoolContentBuffer, which stores scalars and short arrays without heap
+   allocation.
+   The getter and setter functions place the data into that buffer in native endianness.
    This is not a problem as the RAM data is not shared with other systems.
 
    \copyright   Copyright 2016 Sensor-Technik Wiedemann GmbH. All rights reserved.
@@ -56,10 +56,9 @@ using namespace stw::opensyde_core;
 //----------------------------------------------------------------------------------------------------------------------
 C_OscNodeDataPoolContent::C_OscNodeDataPoolContent(void) :
    me_Type(eUINT8),
-   mq_Array(false),
-   mc_CriticalSection()
+   mq_Array(false)
 {
-   mc_Data.resize(1, 0U); //matching uint8 type
+   mc_Data.Resize(1U); //matching uint8 type
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -71,8 +70,7 @@ C_OscNodeDataPoolContent::C_OscNodeDataPoolContent(void) :
 C_OscNodeDataPoolContent::C_OscNodeDataPoolContent(const C_OscNodeDataPoolContent & orc_Source) :
    me_Type(orc_Source.me_Type),
    mq_Array(orc_Source.mq_Array),
-   mc_Data(orc_Source.mc_Data),
-   mc_CriticalSection()
+   mc_Data(orc_Source.mc_Data)
 {
 }
 
@@ -117,8 +115,7 @@ void C_OscNodeDataPoolContent::CalcHash(uint32_t & oru32_HashValue) const
 {
    stw::scl::C_SclChecksums::CalcCRC32(&this->me_Type, sizeof(this->me_Type), oru32_HashValue);
    stw::scl::C_SclChecksums::CalcCRC32(&this->mq_Array, sizeof(this->mq_Array), oru32_HashValue);
-   stw::scl::C_SclChecksums::CalcCRC32(&this->mc_Data[0], static_cast<uint32_t>(this->mc_Data.size()),
-                                       oru32_HashValue);
+   stw::scl::C_SclChecksums::CalcCRC32(this->mc_Data.GetData(), this->mc_Data.GetSize(), oru32_HashValue);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -190,8 +187,7 @@ void C_OscNodeDataPoolContent::CalcHashElement(uint32_t & oru32_HashValue, const
    else
    {
       //Just one element
-      stw::scl::C_SclChecksums::CalcCRC32(&this->mc_Data[0], static_cast<uint32_t>(this->mc_Data.size()),
-                                          oru32_HashValue);
+      stw::scl::C_SclChecksums::CalcCRC32(this->mc_Data.GetData(), this->mc_Data.GetSize(), oru32_HashValue);
    }
 }
 
@@ -226,10 +222,8 @@ template <typename T> void C_OscNodeDataPoolContent::m_SetValue(const T & orc_Va
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&this->mc_Data[0], &orc_Value, sizeof(orc_Value));
-         this->mc_CriticalSection.Release();
+         (void)std::memcpy(this->mc_Data.GetData(), &orc_Value, sizeof(orc_Value));
       }
       else
       {
@@ -259,10 +253,8 @@ template <typename T> void C_OscNodeDataPoolContent::m_GetValue(const E_Type oe_
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&orc_Value, &this->mc_Data[0], sizeof(orc_Value));
-         this->mc_CriticalSection.Release();
+         (void)std::memcpy(&orc_Value, this->mc_Data.GetData(), sizeof(orc_Value));
       }
       else
       {
@@ -767,11 +759,9 @@ template <typename T> void C_OscNodeDataPoolContent::m_SetValueArray(const T & o
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
-         mc_Data.resize(orc_Value.size() * sizeof(orc_Value[0]));
+         this->mc_Data.Resize(static_cast<uint32_t>(orc_Value.size() * sizeof(orc_Value[0])));
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&this->mc_Data[0], &orc_Value[0], this->mc_Data.size());
-         this->mc_CriticalSection.Release();
+         (void)std::memcpy(this->mc_Data.GetData(), &orc_Value[0], this->mc_Data.GetSize());
       }
       else
       {
@@ -808,11 +798,10 @@ template <typename T> void C_OscNodeDataPoolContent::m_SetValueArrayElement(cons
       {
          if (this->GetArraySize() > ou32_Index)
          {
-            this->mc_CriticalSection.Acquire();
             //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
             //lint -e{9114} //range of parameter is safe for sizeof result to fit in
-            (void)std::memcpy(&this->mc_Data[ou32_Index * (sizeof(orc_Value))], &orc_Value, sizeof(orc_Value));
-            this->mc_CriticalSection.Release();
+            (void)std::memcpy(&this->mc_Data.GetData()[ou32_Index * (sizeof(orc_Value))], &orc_Value,
+                              sizeof(orc_Value));
          }
          else
          {
@@ -846,11 +835,9 @@ template <typename T> void C_OscNodeDataPoolContent::m_GetValueArray(const E_Typ
    {
       if (this->me_Type == oe_Type)
       {
-         this->mc_CriticalSection.Acquire();
-         orc_Result.resize(this->mc_Data.size() / sizeof(orc_Result[0]));
+         orc_Result.resize(this->mc_Data.GetSize() / sizeof(orc_Result[0]));
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&orc_Result[0], &this->mc_Data[0], this->mc_Data.size());
-         this->mc_CriticalSection.Release();
+         (void)std::memcpy(&orc_Result[0], this->mc_Data.GetData(), this->mc_Data.GetSize());
       }
       else
       {
@@ -887,11 +874,10 @@ template <typename T> void C_OscNodeDataPoolContent::m_GetValueArrayElement(cons
       {
          if (this->GetArraySize() > ou32_Index)
          {
-            this->mc_CriticalSection.Acquire();
             //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
             //lint -e{9114} //range of parameter is safe for sizeof result to fit in
-            (void)std::memcpy(&orc_Result, &this->mc_Data[ou32_Index * sizeof(orc_Result)], sizeof(orc_Result));
-            this->mc_CriticalSection.Release();
+            (void)std::memcpy(&orc_Result, &this->mc_Data.GetData()[ou32_Index * sizeof(orc_Result)],
+                              sizeof(orc_Result));
          }
          else
          {
@@ -1379,21 +1365,21 @@ void C_OscNodeDataPoolContent::SetArraySize(const uint32_t & oru32_Size)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(oru32_Size, 0U);
+         this->mc_Data.Resize(oru32_Size);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(static_cast<size_t>(oru32_Size) * 2, 0U);
+         this->mc_Data.Resize(oru32_Size * 2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(static_cast<size_t>(oru32_Size) * 4, 0U);
+         this->mc_Data.Resize(oru32_Size * 4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(static_cast<size_t>(oru32_Size) * 8, 0U);
+         this->mc_Data.Resize(oru32_Size * 8U);
          break;
       default:
          throw std::invalid_argument("Type mismatch (incorrect data type)");
@@ -1424,21 +1410,21 @@ uint32_t C_OscNodeDataPoolContent::GetArraySize(void) const
       {
       case eUINT8:
       case eSINT8:
-         u32_Retval = static_cast<uint32_t>(this->mc_Data.size());
+         u32_Retval = this->mc_Data.GetSize();
          break;
       case eUINT16:
       case eSINT16:
-         u32_Retval = static_cast<uint32_t>(this->mc_Data.size() / 2);
+         u32_Retval = this->mc_Data.GetSize() / 2U;
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         u32_Retval = static_cast<uint32_t>(this->mc_Data.size() / 4);
+         u32_Retval = this->mc_Data.GetSize() / 4U;
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         u32_Retval = static_cast<uint32_t>(this->mc_Data.size() / 8);
+         u32_Retval = this->mc_Data.GetSize() / 8U;
          break;
       default:
          throw std::invalid_argument("Element type mismatch");
@@ -1486,21 +1472,21 @@ void C_OscNodeDataPoolContent::SetType(const E_Type & ore_Value)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(1);
+         this->mc_Data.Resize(1U);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(2);
+         this->mc_Data.Resize(2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(4);
+         this->mc_Data.Resize(4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(8);
+         this->mc_Data.Resize(8U);
          break;
       default:
          throw std::invalid_argument("Element type mismatch");
@@ -1625,21 +1611,21 @@ void C_OscNodeDataPoolContent::SetType(const E_Type & ore_Value)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(u32_Size);
+         this->mc_Data.Resize(u32_Size);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(static_cast<size_t>(u32_Size) * 2);
+         this->mc_Data.Resize(u32_Size * 2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(static_cast<size_t>(u32_Size) * 4);
+         this->mc_Data.Resize(u32_Size * 4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(static_cast<size_t>(u32_Size) * 8);
+         this->mc_Data.Resize(u32_Size * 8U);
          break;
       default:
          throw std::invalid_argument("Element type mismatch");
@@ -1815,21 +1801,21 @@ void C_OscNodeDataPoolContent::SetArray(const bool oq_Value)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(1);
+         this->mc_Data.Resize(1U);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(2);
+         this->mc_Data.Resize(2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(4);
+         this->mc_Data.Resize(4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(8);
+         this->mc_Data.Resize(8U);
          break;
       default:
          throw std::invalid_argument("Element type mismatch");
@@ -1847,7 +1833,7 @@ void C_OscNodeDataPoolContent::SetArray(const bool oq_Value)
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t C_OscNodeDataPoolContent::GetSizeByte(void) const
 {
-   return static_cast<uint32_t>(mc_Data.size());
+   return this->mc_Data.GetSize();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3086,47 +3072,32 @@ void C_OscNodeDataPoolContent::GetAnyValueAsFloat64(float64_t & orf64_Output, co
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns pointer to the used const memory of the content
 
-   The usage of the associated critical section must be considered when accessing the memory
-
-   \param[out]      oppc_CriticalSection   Optional pointer to the associated critical section
+   The memory holds GetSizeByte() bytes in native endianness.
+   The pointer gets invalid when size or type of the content are changed.
 
    \return
-   Pointer to the vector with the const value data of the content
+   Pointer to the const value data of the content
 */
 //----------------------------------------------------------------------------------------------------------------------
-const std::vector<uint8_t> * stw::opensyde_core::C_OscNodeDataPoolContent::GetDataAccessConst(
-   stw::tgl::C_TglCriticalSection ** const oppc_CriticalSection) const
+const uint8_t * stw::opensyde_core::C_OscNodeDataPoolContent::GetDataAccessConst(void) const
 {
-   if (oppc_CriticalSection != NULL)
-   {
-      *oppc_CriticalSection = &this->mc_CriticalSection;
-   }
-
-   return &this->mc_Data;
+   return this->mc_Data.GetData();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns pointer to the used memory of the content
 
-   The usage of the associated critical section must be considered when accessing the memory
-
-   \param[out]      oppc_CriticalSection   Optional pointer to the associated critical section
+   See const variant for details.
 
    \return
-   Pointer to the vector with the value data of the content
+   Pointer to the value data of the content
 */
 //----------------------------------------------------------------------------------------------------------------------
-std::vector<uint8_t> * stw::opensyde_core::C_OscNodeDataPoolContent::GetDataAccess(
-   stw::tgl::C_TglCriticalSection ** const oppc_CriticalSection)
+uint8_t * stw::opensyde_core::C_OscNodeDataPoolContent::GetDataAccess(void)
 {
-   if (oppc_CriticalSection != NULL)
-   {
-      *oppc_CriticalSection = &this->mc_CriticalSection;
-   }
-
    //lint -e{1536} it is intended to expose a private member to increase performance when data transfers without
    // type knowledge is possible
-   return &this->mc_Data;
+   return this->mc_Data.GetData();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
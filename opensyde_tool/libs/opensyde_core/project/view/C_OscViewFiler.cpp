@@ -18,6 +18,7 @@
 #include "C_OscLoggingHandler.hpp"
 #include "C_OscSystemFilerUtil.hpp"
 #include "C_OscViewFiler.hpp"
+#include "C_OscTraceHandler.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
@@ -61,6 +62,7 @@ int32_t C_OscViewFiler::h_LoadSystemViewsFile(std::vector<C_OscViewData> & orc_V
                                               const C_SclString & orc_PathSystemViews,
                                               const std::vector<C_OscNode> & orc_OscNodes)
 {
+   const C_OscTraceScope c_TraceScope("Project load", "System views file", orc_PathSystemViews);
    int32_t s32_Retval = C_NO_ERR;
 
    if (TglFileExists(orc_PathSystemViews) == true)
@@ -2733,6 +2733,36 @@ int32_t C_OscComDriverFlash::SendStwReadDeviceInformation(const C_OscProtocolDri
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscComDriverFlash::SendStwDoFlash(const C_OscProtocolDriverOsyNode & orc_ServerId,
                                             const stw::scl::C_SclString & orc_HexFilePath) const
+{
+   return this->SendStwDoFlash(orc_ServerId, orc_HexFilePath, this->pr_XflReportProgress,
+                               this->pv_XflReportProgressInstance);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write one hex file to an STW Flashloader node with a specific progress reporting target
+
+   Same as the other SendStwDoFlash() function, but reports the progress of the STW Flashloader driver
+   to the specified function instead of the one passed to the constructor.
+   The STW Flashloader protocols of the nodes are independent of each other, so several nodes can be flashed
+   at the same time from different threads as long as each node is flashed by only one thread.
+   The reporting function needs to be thread safe in that case.
+
+   \param[in]  orc_ServerId                 Server id to write the hex file to
+   \param[in]  orc_HexFilePath              path to hex file to flash
+   \param[in]  opr_ReportProgress           function to call if STW Flashloader driver has something to report
+   \param[in]  opv_ReportProgressInstance   instance pointer to pass when invoking opr_ReportProgress
+
+   \return
+   C_NO_ERR    hex file written
+   C_CONFIG    node identified by orc_ServerId is unknown or does not speak STW Flashloader
+   else        problem during flashing; details can be seen in the progress log
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscComDriverFlash::SendStwDoFlash(const C_OscProtocolDriverOsyNode & orc_ServerId,
+                                            const stw::scl::C_SclString & orc_HexFilePath,
+                                            const C_OscFlashProtocolStwFlashloader::PR_ReportProgress
+                                            opr_ReportProgress,
+                                            void * const opv_ReportProgressInstance) const
 {
    int32_t s32_Return = C_CONFIG;
    C_OscFlashProtocolStwFlashloader * const pc_ExistingProtocol = this->m_GetStwFlashloaderProtocol(orc_ServerId);
@@ -2764,7 +2794,11 @@ int32_t C_OscComDriverFlash::SendStwDoFlash(const C_OscProtocolDriverOsyNode & o
 
       c_Params.e_DevTypeCheck = eXFL_DEV_TYPE_CHECK_NONE; //no check performed
 
+      pc_ExistingProtocol->pr_ReportProgress = opr_ReportProgress;
+      pc_ExistingProtocol->pv_ReportProgressInstance = opv_ReportProgressInstance;
       s32_Return = pc_ExistingProtocol->ExecuteWrite(c_Params);
+      pc_ExistingProtocol->pr_ReportProgress = this->pr_XflReportProgress;
+      pc_ExistingProtocol->pv_ReportProgressInstance = this->pv_XflReportProgressInstance;
    }
 
    return s32_Return;
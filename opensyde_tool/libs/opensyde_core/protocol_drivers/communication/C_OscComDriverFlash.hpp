@@ -242,6 +242,10 @@ public:
                                         stw::diag_lib::C_XFLChecksumAreas & orc_ChecksumInformation) const;
    int32_t SendStwDoFlash(const C_OscProtocolDriverOsyNode & orc_ServerId,
                           const stw::scl::C_SclString & orc_HexFilePath) const;
+   int32_t SendStwDoFlash(const C_OscProtocolDriverOsyNode & orc_ServerId,
+                          const stw::scl::C_SclString & orc_HexFilePath,
+                          const C_OscFlashProtocolStwFlashloader::PR_ReportProgress opr_ReportProgress,
+                          void * const opv_ReportProgressInstance) const;
 
    void PrepareForDestructionFlash(void);
 
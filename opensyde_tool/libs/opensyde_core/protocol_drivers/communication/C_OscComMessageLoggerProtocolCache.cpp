@@ -0,0 +1,178 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Cache for protocol interpretations of CAN messages (implementation)
+
+   The CANmon protocol interpreters are stateless: the interpretation of a CAN message only depends on
+   the protocol, the message content and the registered openSYDE system definitions.
+   Cyclic messages therefore produce the same strings over and over again.
+   This cache stores the hex and decimal interpretation of each message content once, so a message only
+   needs to be formatted the first time it is seen with a protocol. This includes the re-interpretation of
+   the whole trace after a protocol change.
+
+   Only the finished texts are cached, there is no structured decoded record per protocol: the interpreters
+   (C_CanMonProtocolBase::MessageToString) format while decoding and select hex or decimal output by their own
+   mode, so a separate decode result would require a rewrite of all interpreters. Tools which need decoded values
+   without text use the system definition based interpretation (signals of C_OscComMessageLoggerData), which
+   already provides the openSYDE signal definitions for each interpreted message.
+
+   The owner must clear the cache when the interpretation configuration changes.
+   The cache is limited in size and is cleared completely when the limit is reached.
+   All functions are thread safe.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstring>
+
+#include "C_OscComMessageLoggerProtocolCache.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::can;
+using namespace stw::cmon_protocol;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_OscComMessageLoggerProtocolCache::mhu32_MAX_ENTRIES = 20000UL;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerProtocolText::C_OscComMessageLoggerProtocolText(void) :
+   c_TextHex(""),
+   c_TextDec("")
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerProtocolCache::C_OscComMessageLoggerProtocolCache(void)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the cached interpretation of a CAN message
+
+   \param[in]   oe_Protocol   Protocol of interpretation
+   \param[in]   orc_Msg       CAN message
+   \param[out]  orc_Text      Cached interpretation (only valid if true is returned)
+
+   \return
+   true     Interpretation found
+   false    Message content not yet interpreted with this protocol
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerProtocolCache::Get(const e_CanMonL7Protocols oe_Protocol, const T_STWCAN_Msg_RX & orc_Msg,
+                                             C_OscComMessageLoggerProtocolText & orc_Text)
+{
+   bool q_Return = false;
+   const C_Key c_Key(oe_Protocol, orc_Msg);
+
+   std::map<C_Key, C_OscComMessageLoggerProtocolText>::const_iterator c_It;
+
+   this->mc_CriticalSection.Acquire();
+   c_It = this->mc_Entries.find(c_Key);
+   if (c_It != this->mc_Entries.end())
+   {
+      orc_Text = c_It->second;
+      q_Return = true;
+   }
+   this->mc_CriticalSection.Release();
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store the interpretation of a CAN message
+
+   \param[in]  oe_Protocol   Protocol of interpretation
+   \param[in]  orc_Msg       CAN message
+   \param[in]  orc_Text      Interpretation of CAN message (empty texts if the message does not match the protocol)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerProtocolCache::Add(const e_CanMonL7Protocols oe_Protocol, const T_STWCAN_Msg_RX & orc_Msg,
+                                             const C_OscComMessageLoggerProtocolText & orc_Text)
+{
+   const C_Key c_Key(oe_Protocol, orc_Msg);
+
+   this->mc_CriticalSection.Acquire();
+   if (this->mc_Entries.size() >= mhu32_MAX_ENTRIES)
+   {
+      // Mostly changing content (e.g. counters or measured values); start again with the current messages
+      this->mc_Entries.clear();
+   }
+   this->mc_Entries[c_Key] = orc_Text;
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all cached interpretations
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscComMessageLoggerProtocolCache::Clear(void)
+{
+   this->mc_CriticalSection.Acquire();
+   this->mc_Entries.clear();
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Constructor
+
+   \param[in]  oe_Protocol   Protocol of interpretation
+   \param[in]  orc_Msg       CAN message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OscComMessageLoggerProtocolCache::C_Key::C_Key(const e_CanMonL7Protocols oe_Protocol,
+                                                 const T_STWCAN_Msg_RX & orc_Msg) :
+   u64_Header((static_cast<uint64_t>(oe_Protocol) << 48U) | (static_cast<uint64_t>(orc_Msg.u32_ID) << 16U) |
+              ((orc_Msg.u8_XTD != 0U) ? 0x200ULL : 0ULL) | ((orc_Msg.u8_RTR != 0U) ? 0x100ULL : 0ULL) |
+              static_cast<uint64_t>(orc_Msg.u8_DLC)),
+   u64_Data(0ULL)
+{
+   // Interpreters may also evaluate bytes beyond the DLC, so all of them are part of the key
+   (void)std::memcpy(&this->u64_Data, &orc_Msg.au8_Data[0], sizeof(this->u64_Data));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Less operator for usage as map key
+
+   \param[in]  orc_Cmp  Compared instance
+
+   \return
+   true     Current smaller than orc_Cmp
+   false    Equal or bigger than orc_Cmp
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscComMessageLoggerProtocolCache::C_Key::operator <(const C_Key & orc_Cmp) const
+{
+   bool q_Return;
+
+   if (this->u64_Header != orc_Cmp.u64_Header)
+   {
+      q_Return = (this->u64_Header < orc_Cmp.u64_Header);
+   }
+   else
+   {
+      q_Return = (this->u64_Data < orc_Cmp.u64_Data);
+   }
+
+   return q_Return;
+}
@@ -0,0 +1,82 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Cache for protocol interpretations of CAN messages (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCCOMMESSAGELOGGERPROTOCOLCACHE_HPP
+#define C_OSCCOMMESSAGELOGGERPROTOCOLCACHE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "stw_can.hpp"
+#include "TglTasks.hpp"
+
+#include "C_CanMonProtocol.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+///Protocol interpretation of one CAN message
+class C_OscComMessageLoggerProtocolText
+{
+public:
+   C_OscComMessageLoggerProtocolText(void);
+
+   stw::scl::C_SclString c_TextHex; ///< Empty if the message does not match the protocol
+   stw::scl::C_SclString c_TextDec; ///< Empty if the message does not match the protocol
+};
+
+///Already interpreted CAN messages per protocol
+class C_OscComMessageLoggerProtocolCache
+{
+public:
+   C_OscComMessageLoggerProtocolCache(void);
+
+   bool Get(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol, const stw::can::T_STWCAN_Msg_RX & orc_Msg,
+            C_OscComMessageLoggerProtocolText & orc_Text);
+   void Add(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol, const stw::can::T_STWCAN_Msg_RX & orc_Msg,
+            const C_OscComMessageLoggerProtocolText & orc_Text);
+   void Clear(void);
+
+private:
+   ///Content of a CAN message which is relevant for the interpretation (the time stamp is not)
+   class C_Key
+   {
+   public:
+      C_Key(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol, const stw::can::T_STWCAN_Msg_RX & orc_Msg);
+
+      bool operator <(const C_Key & orc_Cmp) const;
+
+      uint64_t u64_Header; ///< Protocol, CAN ID, XTD, RTR and DLC
+      uint64_t u64_Data;   ///< All eight data bytes
+   };
+
+   std::map<C_Key, C_OscComMessageLoggerProtocolText> mc_Entries;
+   stw::tgl::C_TglCriticalSection mc_CriticalSection;
+
+   static const uint32_t mhu32_MAX_ENTRIES;
+
+   //Avoid call
+   C_OscComMessageLoggerProtocolCache(const C_OscComMessageLoggerProtocolCache &);
+   C_OscComMessageLoggerProtocolCache & operator =(const C_OscComMessageLoggerProtocolCache &);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
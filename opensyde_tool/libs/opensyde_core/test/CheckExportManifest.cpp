@@ -0,0 +1,171 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for the incremental code generation manifest (C_OscExportManifest)
+
+   Checks that the input hash is reproducible and changes with the generator version, the application index and
+    the node. Checks that outputs are only up to date with unchanged inputs and unmodified files, also after
+    saving and loading the manifest file.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclString.hpp"
+#include "C_OscNode.hpp"
+#include "C_OscExportManifest.hpp"
+#include "C_OscLoggingHandler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const C_SclString mc_OUTPUT_PATH = "manifest_check_output";
+static const C_SclString mc_OUTPUT_FILE = "manifest_check_output.c";
+static const C_SclString mc_MANIFEST_FILE = "manifest_check.ini";
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static void m_WriteFile(const C_SclString & orc_FilePath, const C_SclString & orc_Content);
+static void m_CheckInputHash(void);
+static void m_CheckOutputs(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      std::printf("FAILED: %s\n", orc_Description.c_str());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write text file
+
+   \param[in]  orc_FilePath   path of file
+   \param[in]  orc_Content    new file content
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_WriteFile(const C_SclString & orc_FilePath, const C_SclString & orc_Content)
+{
+   std::FILE * const pc_File = std::fopen(orc_FilePath.c_str(), "wb");
+
+   if (pc_File != NULL)
+   {
+      (void)std::fwrite(orc_Content.c_str(), 1U, orc_Content.Length(), pc_File);
+      (void)std::fclose(pc_File);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check input hash calculation
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckInputHash(void)
+{
+   C_OscNode c_Node;
+   C_OscNode c_Changed;
+   C_SclString c_Hash;
+
+   c_Node.c_Properties.c_Name = "Node1";
+   c_Hash = C_OscExportManifest::h_CalcInputHash(c_Node, 0U, "1.0");
+
+   m_Check(c_Hash.Length() == 32, "input hash is MD5 digest");
+   m_Check(C_OscExportManifest::h_CalcInputHash(c_Node, 0U, "1.0") == c_Hash, "input hash reproducible");
+   m_Check(C_OscExportManifest::h_CalcInputHash(c_Node, 1U, "1.0") != c_Hash, "input hash covers application");
+   m_Check(C_OscExportManifest::h_CalcInputHash(c_Node, 0U, "1.1") != c_Hash, "input hash covers generator");
+
+   c_Changed = c_Node;
+   c_Changed.c_Properties.c_Comment = "changed";
+   m_Check(C_OscExportManifest::h_CalcInputHash(c_Changed, 0U, "1.0") != c_Hash, "input hash covers properties");
+
+   c_Changed = c_Node;
+   c_Changed.c_DataPools.resize(1);
+   c_Changed.c_DataPools[0].c_Name = "DataPool";
+   m_Check(C_OscExportManifest::h_CalcInputHash(c_Changed, 0U, "1.0") != c_Hash, "input hash covers Datapools");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check up to date detection of outputs
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckOutputs(void)
+{
+   C_OscNode c_Node;
+   C_OscExportManifest c_Manifest;
+   C_OscExportManifest c_Loaded;
+   std::vector<C_SclString> c_Files;
+   std::vector<C_SclString> c_Result;
+   const C_SclString c_Hash = C_OscExportManifest::h_CalcInputHash(c_Node, 0U, "1.0");
+   const C_SclString c_OtherHash = C_OscExportManifest::h_CalcInputHash(c_Node, 1U, "1.0");
+
+   m_WriteFile(mc_OUTPUT_FILE, "int32_t s32_Value;\n");
+   c_Files.push_back(mc_OUTPUT_FILE);
+
+   m_Check(c_Manifest.IsUpToDate(mc_OUTPUT_PATH, c_Hash, c_Result) == false, "unknown output not up to date");
+   c_Manifest.SetOutputs(mc_OUTPUT_PATH, c_Hash, c_Files);
+   m_Check(c_Manifest.IsUpToDate(mc_OUTPUT_PATH, c_Hash, c_Result) == true, "output up to date");
+   m_Check(c_Result == c_Files, "files of output reported");
+   m_Check(c_Manifest.IsUpToDate(mc_OUTPUT_PATH, c_OtherHash, c_Result) == false, "changed inputs not up to date");
+
+   m_Check(c_Manifest.SaveToFile(mc_MANIFEST_FILE) == C_NO_ERR, "manifest saved");
+   m_Check(c_Loaded.LoadFromFile(mc_MANIFEST_FILE) == C_NO_ERR, "manifest loaded");
+   m_Check(c_Loaded.IsUpToDate(mc_OUTPUT_PATH, c_Hash, c_Result) == true, "loaded output up to date");
+
+   //same size, different content
+   m_WriteFile(mc_OUTPUT_FILE, "int32_t s32_Other;\n");
+   m_Check(c_Loaded.IsUpToDate(mc_OUTPUT_PATH, c_Hash, c_Result) == false, "modified file not up to date");
+
+   (void)std::remove(mc_OUTPUT_FILE.c_str());
+   c_Manifest.SetOutputs(mc_OUTPUT_PATH, c_Hash, c_Files);
+   m_Check(c_Manifest.IsUpToDate(mc_OUTPUT_PATH, c_Hash, c_Result) == false, "missing file not up to date");
+
+   m_WriteFile(mc_OUTPUT_FILE, "int32_t s32_Value;\n");
+   c_Manifest.SetOutputs(mc_OUTPUT_PATH, "", c_Files);
+   m_Check(c_Manifest.IsUpToDate(mc_OUTPUT_PATH, "", c_Result) == false, "empty input hash never up to date");
+
+   (void)std::remove(mc_OUTPUT_FILE.c_str());
+   (void)std::remove(mc_MANIFEST_FILE.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   C_OscLoggingHandler::h_SetWriteToConsoleActive(false);
+   m_CheckInputHash();
+   m_CheckOutputs();
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,1129 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for the routing table (C_OscRoutingTable)
+
+   Compares the routes of the breadth first search with a reference that enumerates all paths over the buses.
+    Checked are the result state, the number of route points, the Ethernet preference and the validity of each
+    route point. Pseudo random systems and hand made systems are checked in all routing modes.
+    Of several routes with the same number of route points the table must choose the same one as the previous
+    depth first search did (route points in node and interface index order: of routes using Ethernet the last one,
+    else the first one); the reference models this choice based on the enumerated paths.
+    Additionally the cached results (h_GetBestRoute) must always be the same as the directly calculated table, also
+    for systems which only differ in one routing relevant property.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <algorithm>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclString.hpp"
+#include "C_OscRoutingTable.hpp"
+#include "C_OscDeviceDefinition.hpp"
+#include "C_OscLoggingHandler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const uint32_t mu32_MAX_BUSES = 6U;
+static const uint32_t mu32_MAX_NODES = 8U;
+static const uint32_t mu32_MAX_INTERFACES = 3U;
+static const uint32_t mu32_NUM_RANDOM_RUNS = 3000U;
+static const uint32_t mu32_NO_ROUTE = 0xFFFFFFFFU;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+///system definition as used by the routing
+class C_System
+{
+public:
+   std::vector<C_OscSystemBus::E_Type> c_BusTypes;
+   std::vector<C_OscNode> c_Nodes;
+   std::vector<uint8_t> c_ActiveNodes;
+   uint32_t u32_StartBusIndex;
+};
+
+///result of the reference search for one target node
+class C_Reference
+{
+public:
+   uint32_t u32_Hops;                                   ///< fewest route points; mu32_NO_ROUTE: no route
+   bool q_HasEthernet;                                  ///< true: at least one of the routes with the fewest
+                                                        ///< route points uses Ethernet
+   std::vector<uint32_t> c_FirstPath;                   ///< first path with the fewest route points in node and
+                                                        ///< interface index order (see m_GetPointKey)
+   std::vector<C_OscRoutingRoutePoint> c_RoutePoints;   ///< route chosen of the routes with the fewest route points
+};
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+static uint32_t mu32_RandomState = 0x12345678U;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static uint32_t m_GetRandom(const uint32_t ou32_Range);
+static const C_OscDeviceDefinition * m_GetDeviceDefinition(const bool oq_WithFlashloader);
+static C_OscNode m_CreateNode(const bool oq_WithFlashloader);
+static void m_AddInterface(C_OscNode & orc_Node, const C_OscSystemBus::E_Type oe_Type, const uint32_t ou32_BusIndex,
+                           const bool oq_Routing, const bool oq_Update, const bool oq_Diagnosis);
+static bool m_IsTargetInterface(const C_OscNodeComInterfaceSettings & orc_Itf,
+                                const C_OscRoutingCalculation::E_Mode oe_Mode);
+static bool m_IsRoutingInterface(const C_OscNodeComInterfaceSettings & orc_Itf);
+static int32_t m_GetExpectedConfigState(const C_OscNode & orc_Node, const C_OscRoutingCalculation::E_Mode oe_Mode);
+static uint32_t m_GetPointKey(const uint32_t ou32_NodeIndex, const uint32_t ou32_InItfIndex,
+                              const uint32_t ou32_OutItfIndex);
+static void m_SearchPaths(const C_System & orc_System, const uint32_t ou32_BusIndex, const uint32_t ou32_Hops,
+                          const bool oq_HasEthernet, const bool oq_AllowCanToEthernet,
+                          const uint32_t ou32_ExcludedNodeIndex, std::vector<bool> & orc_Visited,
+                          std::vector<uint32_t> & orc_Path, std::vector<C_Reference> & orc_BestPerBus);
+static C_OscRoutingRoutePoint m_GetRoutePoint(const C_System & orc_System, const uint32_t ou32_NodeIndex,
+                                              const uint32_t ou32_InItfIndex, const uint32_t ou32_OutItfIndex);
+static void m_GetChosenRoutes(const C_System & orc_System, const bool oq_AllowCanToEthernet,
+                              const uint32_t ou32_ExcludedNodeIndex, std::vector<C_Reference> & orc_BestPerBus);
+static void m_GetChosenTargetRoute(const C_System & orc_System, const uint32_t ou32_TargetNodeIndex,
+                                   const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                   const std::vector<C_Reference> & orc_BestPerBus, bool & orq_PassesTarget,
+                                   std::vector<C_OscRoutingRoutePoint> & orc_RoutePoints);
+static C_Reference m_GetReference(const C_System & orc_System, const uint32_t ou32_TargetNodeIndex,
+                                  const C_OscRoutingCalculation::E_Mode oe_Mode, const bool oq_AllowCanToEthernet);
+static bool m_FindInterface(const C_OscNode & orc_Node, const uint32_t ou32_BusIndex,
+                            const C_OscSystemBus::E_Type oe_Type, const uint8_t ou8_InterfaceNumber,
+                            const uint8_t ou8_NodeId);
+static void m_CheckRoute(const C_System & orc_System, const uint32_t ou32_TargetNodeIndex,
+                         const C_OscRoutingCalculation::E_Mode oe_Mode, const C_OscRoutingRoute & orc_Route,
+                         const C_Reference & orc_Reference, const C_SclString & orc_Description);
+static void m_CheckSystem(const C_System & orc_System, const C_OscRoutingCalculation::E_Mode oe_Mode,
+                          const C_SclString & orc_Description);
+static void m_CheckFixedCases(void);
+static C_System m_CreateRandomSystem(void);
+static void m_ChangeRandomSystem(C_System & orc_System);
+static void m_CheckRandomCases(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      if (mu32_NumFailures <= 20U)
+      {
+         std::printf("FAILED: %s\n", orc_Description.c_str());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pseudo random number
+
+   xorshift32; fixed seed so all runs check the same values
+
+   \param[in]  ou32_Range   number of possible results (> 0)
+
+   \return
+   pseudo random number in range 0 .. ou32_Range-1
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetRandom(const uint32_t ou32_Range)
+{
+   mu32_RandomState ^= mu32_RandomState << 13U;
+   mu32_RandomState ^= mu32_RandomState >> 17U;
+   mu32_RandomState ^= mu32_RandomState << 5U;
+   return mu32_RandomState % ou32_Range;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get device definition of a routable device or of a third party device without flashloader
+
+   Created on first use; the device definition uses static strings which must be initialized before.
+
+   \param[in]  oq_WithFlashloader   true: routable device; false: third party device
+
+   \return
+   device definition with one sub device
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static const C_OscDeviceDefinition * m_GetDeviceDefinition(const bool oq_WithFlashloader)
+{
+   static C_OscDeviceDefinition hc_WithFlashloader;
+   static C_OscDeviceDefinition hc_WithoutFlashloader;
+
+   if (hc_WithFlashloader.c_SubDevices.empty())
+   {
+      C_OscSubDeviceDefinition c_SubDevice;
+
+      c_SubDevice.q_FlashloaderOpenSydeCan = true;
+      c_SubDevice.q_FlashloaderOpenSydeEthernet = true;
+      hc_WithFlashloader.c_SubDevices.push_back(c_SubDevice);
+
+      c_SubDevice.q_FlashloaderOpenSydeCan = false;
+      c_SubDevice.q_FlashloaderOpenSydeEthernet = false;
+      c_SubDevice.q_FlashloaderStwCan = false;
+      hc_WithoutFlashloader.c_SubDevices.push_back(c_SubDevice);
+   }
+   return oq_WithFlashloader ? &hc_WithFlashloader : &hc_WithoutFlashloader;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create node without interfaces
+
+   \param[in]  oq_WithFlashloader   true: routable device; false: third party device
+
+   \return
+   node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_OscNode m_CreateNode(const bool oq_WithFlashloader)
+{
+   C_OscNode c_Node;
+
+   c_Node.pc_DeviceDefinition = m_GetDeviceDefinition(oq_WithFlashloader);
+   c_Node.u32_SubDeviceIndex = 0U;
+   c_Node.c_Properties.e_DiagnosticServer = C_OscNodeProperties::eDS_OPEN_SYDE;
+   return c_Node;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add interface connected to a bus
+
+   \param[in,out]  orc_Node        node
+   \param[in]      oe_Type         bus type
+   \param[in]      ou32_BusIndex   bus index
+   \param[in]      oq_Routing      routing enabled
+   \param[in]      oq_Update       update enabled
+   \param[in]      oq_Diagnosis    diagnosis enabled
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_AddInterface(C_OscNode & orc_Node, const C_OscSystemBus::E_Type oe_Type, const uint32_t ou32_BusIndex,
+                           const bool oq_Routing, const bool oq_Update, const bool oq_Diagnosis)
+{
+   C_OscNodeComInterfaceSettings c_Itf;
+
+   c_Itf.e_InterfaceType = oe_Type;
+   c_Itf.u8_InterfaceNumber = static_cast<uint8_t>(orc_Node.c_Properties.c_ComInterfaces.size());
+   c_Itf.u8_NodeId = static_cast<uint8_t>(1U + m_GetRandom(126U));
+   c_Itf.q_IsRoutingEnabled = oq_Routing;
+   c_Itf.q_IsUpdateEnabled = oq_Update;
+   c_Itf.q_IsDiagnosisEnabled = oq_Diagnosis;
+   c_Itf.AddConnection(ou32_BusIndex);
+   orc_Node.c_Properties.c_ComInterfaces.push_back(c_Itf);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: can the target node be reached on this interface
+
+   \param[in]  orc_Itf   interface of target node
+   \param[in]  oe_Mode   routing mode
+
+   \return
+   true: target interface
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_IsTargetInterface(const C_OscNodeComInterfaceSettings & orc_Itf,
+                                const C_OscRoutingCalculation::E_Mode oe_Mode)
+{
+   bool q_Function;
+
+   switch (oe_Mode)
+   {
+   case C_OscRoutingCalculation::eUPDATE:
+      q_Function = orc_Itf.q_IsUpdateEnabled;
+      break;
+   case C_OscRoutingCalculation::eDIAGNOSTIC:
+      q_Function = orc_Itf.q_IsDiagnosisEnabled;
+      break;
+   default:
+      q_Function = true;
+      break;
+   }
+   return q_Function && orc_Itf.GetBusConnected();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: can the node route on this interface
+
+   \param[in]  orc_Itf   interface of routing node
+
+   \return
+   true: routing interface
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_IsRoutingInterface(const C_OscNodeComInterfaceSettings & orc_Itf)
+{
+   return orc_Itf.q_IsRoutingEnabled && orc_Itf.GetBusConnected();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: state of the target node configuration
+
+   \param[in]  orc_Node   target node
+   \param[in]  oe_Mode    routing mode
+
+   \return
+   C_NO_ERR   function active on a connected interface
+   C_COM      function only active on interfaces without bus
+   C_NOACT    no flashloader or function not active
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static int32_t m_GetExpectedConfigState(const C_OscNode & orc_Node, const C_OscRoutingCalculation::E_Mode oe_Mode)
+{
+   const C_OscSubDeviceDefinition & rc_SubDevice = orc_Node.pc_DeviceDefinition->c_SubDevices[0];
+   int32_t s32_State = C_NOACT;
+
+   if (rc_SubDevice.q_FlashloaderOpenSydeCan || rc_SubDevice.q_FlashloaderOpenSydeEthernet ||
+       rc_SubDevice.q_FlashloaderStwCan)
+   {
+      for (uint32_t u32_Itf = 0U; u32_Itf < orc_Node.c_Properties.c_ComInterfaces.size(); u32_Itf++)
+      {
+         const C_OscNodeComInterfaceSettings & rc_Itf = orc_Node.c_Properties.c_ComInterfaces[u32_Itf];
+         bool q_Function;
+
+         switch (oe_Mode)
+         {
+         case C_OscRoutingCalculation::eUPDATE:
+            q_Function = rc_Itf.q_IsUpdateEnabled;
+            break;
+         case C_OscRoutingCalculation::eDIAGNOSTIC:
+            q_Function = rc_Itf.q_IsDiagnosisEnabled;
+            break;
+         case C_OscRoutingCalculation::eROUTING_CHECK:
+            q_Function = true;
+            break;
+         default:
+            q_Function = (orc_Node.c_Properties.e_DiagnosticServer != C_OscNodeProperties::eDS_NONE);
+            break;
+         }
+         if (q_Function)
+         {
+            if (rc_Itf.GetBusConnected())
+            {
+               s32_State = C_NO_ERR;
+            }
+            else if (s32_State == C_NOACT)
+            {
+               s32_State = C_COM;
+            }
+            else
+            {
+               //keep
+            }
+         }
+      }
+   }
+   return s32_State;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: sort key of a route point
+
+   Sorting by the key sorts route points by node index, then input interface index, then output interface index.
+
+   \param[in]  ou32_NodeIndex     node index
+   \param[in]  ou32_InItfIndex    index of input interface
+   \param[in]  ou32_OutItfIndex   index of output interface
+
+   \return
+   key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetPointKey(const uint32_t ou32_NodeIndex, const uint32_t ou32_InItfIndex,
+                              const uint32_t ou32_OutItfIndex)
+{
+   return (ou32_NodeIndex << 16U) + (ou32_InItfIndex << 8U) + ou32_OutItfIndex;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: enumerate all paths without bus repetition
+
+   The paths are enumerated in node and interface index order of their route points, so the first path found with
+   the fewest route points is the first one in this order.
+
+   \param[in]      orc_System               system
+   \param[in]      ou32_BusIndex            current bus
+   \param[in]      ou32_Hops                route points to the current bus
+   \param[in]      oq_HasEthernet           path to the current bus routes to Ethernet
+   \param[in]      oq_AllowCanToEthernet    true: route points from CAN to Ethernet are usable
+   \param[in]      ou32_ExcludedNodeIndex   node which must not route
+   \param[in,out]  orc_Visited              buses of the current path
+   \param[in,out]  orc_Path                 route point keys of the current path
+   \param[in,out]  orc_BestPerBus           best path per bus
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_SearchPaths(const C_System & orc_System, const uint32_t ou32_BusIndex, const uint32_t ou32_Hops,
+                          const bool oq_HasEthernet, const bool oq_AllowCanToEthernet,
+                          const uint32_t ou32_ExcludedNodeIndex, std::vector<bool> & orc_Visited,
+                          std::vector<uint32_t> & orc_Path, std::vector<C_Reference> & orc_BestPerBus)
+{
+   C_Reference & rc_Best = orc_BestPerBus[ou32_BusIndex];
+
+   if (ou32_Hops < rc_Best.u32_Hops)
+   {
+      rc_Best.u32_Hops = ou32_Hops;
+      rc_Best.q_HasEthernet = oq_HasEthernet;
+      rc_Best.c_FirstPath = orc_Path;
+   }
+   else if (ou32_Hops == rc_Best.u32_Hops)
+   {
+      rc_Best.q_HasEthernet = rc_Best.q_HasEthernet || oq_HasEthernet;
+   }
+   else
+   {
+      //longer
+   }
+
+   orc_Visited[ou32_BusIndex] = true;
+   for (uint32_t u32_Node = 0U; u32_Node < orc_System.c_Nodes.size(); u32_Node++)
+   {
+      const std::vector<C_OscNodeComInterfaceSettings> & rc_Itfs =
+         orc_System.c_Nodes[u32_Node].c_Properties.c_ComInterfaces;
+
+      if ((u32_Node != ou32_ExcludedNodeIndex) && (orc_System.c_ActiveNodes[u32_Node] == 1U))
+      {
+         for (uint32_t u32_In = 0U; u32_In < rc_Itfs.size(); u32_In++)
+         {
+            for (uint32_t u32_Out = 0U; u32_Out < rc_Itfs.size(); u32_Out++)
+            {
+               const C_OscNodeComInterfaceSettings & rc_In = rc_Itfs[u32_In];
+               const C_OscNodeComInterfaceSettings & rc_Out = rc_Itfs[u32_Out];
+               const bool q_CanToEthernet = (rc_In.e_InterfaceType == C_OscSystemBus::eCAN) &&
+                                            (rc_Out.e_InterfaceType == C_OscSystemBus::eETHERNET);
+
+               if ((u32_In != u32_Out) && (rc_In.u32_BusIndex == ou32_BusIndex) && m_IsRoutingInterface(rc_In) &&
+                   m_IsRoutingInterface(rc_Out) && (orc_Visited[rc_Out.u32_BusIndex] == false) &&
+                   ((q_CanToEthernet == false) || oq_AllowCanToEthernet))
+               {
+                  orc_Path.push_back(m_GetPointKey(u32_Node, u32_In, u32_Out));
+                  m_SearchPaths(orc_System, rc_Out.u32_BusIndex, ou32_Hops + 1U,
+                                oq_HasEthernet || (rc_Out.e_InterfaceType == C_OscSystemBus::eETHERNET),
+                                oq_AllowCanToEthernet, ou32_ExcludedNodeIndex, orc_Visited, orc_Path,
+                                orc_BestPerBus);
+                  orc_Path.pop_back();
+               }
+            }
+         }
+      }
+   }
+   orc_Visited[ou32_BusIndex] = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: route point of a node
+
+   \param[in]  orc_System         system
+   \param[in]  ou32_NodeIndex     node index
+   \param[in]  ou32_InItfIndex    index of input interface
+   \param[in]  ou32_OutItfIndex   index of output interface
+
+   \return
+   route point
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_OscRoutingRoutePoint m_GetRoutePoint(const C_System & orc_System, const uint32_t ou32_NodeIndex,
+                                              const uint32_t ou32_InItfIndex, const uint32_t ou32_OutItfIndex)
+{
+   const std::vector<C_OscNodeComInterfaceSettings> & rc_Itfs =
+      orc_System.c_Nodes[ou32_NodeIndex].c_Properties.c_ComInterfaces;
+   C_OscRoutingRoutePoint c_Point;
+
+   c_Point.u32_NodeIndex = ou32_NodeIndex;
+   c_Point.u32_InBusIndex = rc_Itfs[ou32_InItfIndex].u32_BusIndex;
+   c_Point.u8_InNodeId = rc_Itfs[ou32_InItfIndex].u8_NodeId;
+   c_Point.e_InInterfaceType = rc_Itfs[ou32_InItfIndex].e_InterfaceType;
+   c_Point.u8_InInterfaceNumber = rc_Itfs[ou32_InItfIndex].u8_InterfaceNumber;
+   c_Point.u32_OutBusIndex = rc_Itfs[ou32_OutItfIndex].u32_BusIndex;
+   c_Point.u8_OutNodeId = rc_Itfs[ou32_OutItfIndex].u8_NodeId;
+   c_Point.e_OutInterfaceType = rc_Itfs[ou32_OutItfIndex].e_InterfaceType;
+   c_Point.u8_OutInterfaceNumber = rc_Itfs[ou32_OutItfIndex].u8_InterfaceNumber;
+   return c_Point;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: chosen route to each bus
+
+   Model of the choice of the previous search: of the routes with the fewest route points the last one using
+    Ethernet, else the first one. The routes to the buses with one route point more are extended bus by bus in the
+    order of the first path to each bus, each bus in node and interface index order of its route points.
+
+   \param[in]   orc_System               system
+   \param[in]   oq_AllowCanToEthernet    true: route points from CAN to Ethernet are usable
+   \param[in]   ou32_ExcludedNodeIndex   node which must not route (mu32_NO_ROUTE: none)
+   \param[out]  orc_BestPerBus           best path and chosen route per bus
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_GetChosenRoutes(const C_System & orc_System, const bool oq_AllowCanToEthernet,
+                              const uint32_t ou32_ExcludedNodeIndex, std::vector<C_Reference> & orc_BestPerBus)
+{
+   C_Reference c_NoRoute;
+   std::vector<bool> c_Visited(orc_System.c_BusTypes.size(), false);
+   std::vector<bool> c_Chosen(orc_System.c_BusTypes.size(), false);
+   std::vector<uint32_t> c_Path;
+   bool q_Continue = true;
+
+   c_NoRoute.u32_Hops = mu32_NO_ROUTE;
+   c_NoRoute.q_HasEthernet = false;
+   orc_BestPerBus.assign(orc_System.c_BusTypes.size(), c_NoRoute);
+   m_SearchPaths(orc_System, orc_System.u32_StartBusIndex, 0U, false, oq_AllowCanToEthernet, ou32_ExcludedNodeIndex,
+                 c_Visited, c_Path, orc_BestPerBus);
+
+   for (uint32_t u32_Hops = 1U; q_Continue; u32_Hops++)
+   {
+      std::vector<std::pair<std::vector<uint32_t>, uint32_t> > c_FromBuses;
+
+      for (uint32_t u32_Bus = 0U; u32_Bus < orc_BestPerBus.size(); u32_Bus++)
+      {
+         if (orc_BestPerBus[u32_Bus].u32_Hops == (u32_Hops - 1U))
+         {
+            c_FromBuses.push_back(std::make_pair(orc_BestPerBus[u32_Bus].c_FirstPath, u32_Bus));
+         }
+      }
+      std::sort(c_FromBuses.begin(), c_FromBuses.end());
+      q_Continue = (c_FromBuses.size() > 0U);
+
+      for (uint32_t u32_From = 0U; u32_From < c_FromBuses.size(); u32_From++)
+      {
+         const uint32_t u32_FromBus = c_FromBuses[u32_From].second;
+
+         for (uint32_t u32_Node = 0U; u32_Node < orc_System.c_Nodes.size(); u32_Node++)
+         {
+            const std::vector<C_OscNodeComInterfaceSettings> & rc_Itfs =
+               orc_System.c_Nodes[u32_Node].c_Properties.c_ComInterfaces;
+
+            if ((u32_Node != ou32_ExcludedNodeIndex) && (orc_System.c_ActiveNodes[u32_Node] == 1U))
+            {
+               for (uint32_t u32_In = 0U; u32_In < rc_Itfs.size(); u32_In++)
+               {
+                  for (uint32_t u32_Out = 0U; u32_Out < rc_Itfs.size(); u32_Out++)
+                  {
+                     const C_OscNodeComInterfaceSettings & rc_In = rc_Itfs[u32_In];
+                     const C_OscNodeComInterfaceSettings & rc_Out = rc_Itfs[u32_Out];
+                     const bool q_CanToEthernet = (rc_In.e_InterfaceType == C_OscSystemBus::eCAN) &&
+                                                  (rc_Out.e_InterfaceType == C_OscSystemBus::eETHERNET);
+
+                     if ((u32_In != u32_Out) && (rc_In.u32_BusIndex == u32_FromBus) && m_IsRoutingInterface(rc_In) &&
+                         m_IsRoutingInterface(rc_Out) && (orc_BestPerBus[rc_Out.u32_BusIndex].u32_Hops == u32_Hops) &&
+                         ((q_CanToEthernet == false) || oq_AllowCanToEthernet))
+                     {
+                        const C_Reference & rc_From = orc_BestPerBus[u32_FromBus];
+                        C_Reference & rc_To = orc_BestPerBus[rc_Out.u32_BusIndex];
+                        const bool q_Ethernet = rc_From.q_HasEthernet ||
+                                                (rc_Out.e_InterfaceType == C_OscSystemBus::eETHERNET);
+
+                        if ((c_Chosen[rc_Out.u32_BusIndex] == false) || q_Ethernet)
+                        {
+                           rc_To.c_RoutePoints = rc_From.c_RoutePoints;
+                           rc_To.c_RoutePoints.push_back(m_GetRoutePoint(orc_System, u32_Node, u32_In, u32_Out));
+                           rc_To.q_HasEthernet = q_Ethernet;
+                           c_Chosen[rc_Out.u32_BusIndex] = true;
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: chosen route to a target node
+
+   The buses of the target are checked in ascending bus index order. Of routes with the fewest route points the last
+    one using Ethernet is chosen, else the first one.
+
+   \param[in]   orc_System             system
+   \param[in]   ou32_TargetNodeIndex   target node
+   \param[in]   oe_Mode                routing mode
+   \param[in]   orc_BestPerBus         chosen route per bus
+   \param[out]  orq_PassesTarget       true: the route to one of the buses of the target passes the target
+   \param[out]  orc_RoutePoints        chosen route (empty if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_GetChosenTargetRoute(const C_System & orc_System, const uint32_t ou32_TargetNodeIndex,
+                                   const C_OscRoutingCalculation::E_Mode oe_Mode,
+                                   const std::vector<C_Reference> & orc_BestPerBus, bool & orq_PassesTarget,
+                                   std::vector<C_OscRoutingRoutePoint> & orc_RoutePoints)
+{
+   const std::vector<C_OscNodeComInterfaceSettings> & rc_Itfs =
+      orc_System.c_Nodes[ou32_TargetNodeIndex].c_Properties.c_ComInterfaces;
+   const C_Reference * pc_Best = NULL;
+
+   orq_PassesTarget = false;
+   orc_RoutePoints.clear();
+   for (uint32_t u32_Bus = 0U; u32_Bus < orc_BestPerBus.size(); u32_Bus++)
+   {
+      const C_Reference & rc_Bus = orc_BestPerBus[u32_Bus];
+      bool q_TargetBus = false;
+      bool q_PassesTarget = false;
+
+      for (uint32_t u32_Itf = 0U; u32_Itf < rc_Itfs.size(); u32_Itf++)
+      {
+         if ((rc_Itfs[u32_Itf].u32_BusIndex == u32_Bus) && m_IsTargetInterface(rc_Itfs[u32_Itf], oe_Mode))
+         {
+            q_TargetBus = true;
+         }
+      }
+      for (uint32_t u32_Point = 0U; u32_Point < rc_Bus.c_RoutePoints.size(); u32_Point++)
+      {
+         if (rc_Bus.c_RoutePoints[u32_Point].u32_NodeIndex == ou32_TargetNodeIndex)
+         {
+            q_PassesTarget = true;
+         }
+      }
+
+      if ((q_TargetBus == true) && (rc_Bus.u32_Hops != mu32_NO_ROUTE))
+      {
+         if (q_PassesTarget == true)
+         {
+            orq_PassesTarget = true;
+         }
+         else if ((pc_Best == NULL) || (rc_Bus.u32_Hops < pc_Best->u32_Hops) ||
+                  ((rc_Bus.u32_Hops == pc_Best->u32_Hops) && rc_Bus.q_HasEthernet))
+         {
+            pc_Best = &rc_Bus;
+         }
+         else
+         {
+            //not chosen
+         }
+      }
+   }
+   if (pc_Best != NULL)
+   {
+      orc_RoutePoints = pc_Best->c_RoutePoints;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reference: best route to a target node
+
+   \param[in]  orc_System               system
+   \param[in]  ou32_TargetNodeIndex     target node
+   \param[in]  oe_Mode                  routing mode
+   \param[in]  oq_AllowCanToEthernet    true: route points from CAN to Ethernet are usable
+
+   The target can not route to itself. If the chosen route to one of its buses passes it the routes are chosen
+    again without the target as router.
+
+   \return
+   fewest route points and Ethernet usage of the best route, chosen route
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_Reference m_GetReference(const C_System & orc_System, const uint32_t ou32_TargetNodeIndex,
+                                  const C_OscRoutingCalculation::E_Mode oe_Mode, const bool oq_AllowCanToEthernet)
+{
+   C_Reference c_Result;
+   std::vector<C_Reference> c_BestPerBus;
+   std::vector<bool> c_Visited(orc_System.c_BusTypes.size(), false);
+   std::vector<uint32_t> c_Path;
+   bool q_PassesTarget;
+   const std::vector<C_OscNodeComInterfaceSettings> & rc_Itfs =
+      orc_System.c_Nodes[ou32_TargetNodeIndex].c_Properties.c_ComInterfaces;
+
+   c_Result.u32_Hops = mu32_NO_ROUTE;
+   c_Result.q_HasEthernet = false;
+   c_BestPerBus.resize(orc_System.c_BusTypes.size(), c_Result);
+
+   m_SearchPaths(orc_System, orc_System.u32_StartBusIndex, 0U, false, oq_AllowCanToEthernet, ou32_TargetNodeIndex,
+                 c_Visited, c_Path, c_BestPerBus);
+
+   for (uint32_t u32_Itf = 0U; u32_Itf < rc_Itfs.size(); u32_Itf++)
+   {
+      if (m_IsTargetInterface(rc_Itfs[u32_Itf], oe_Mode))
+      {
+         const C_Reference & rc_Bus = c_BestPerBus[rc_Itfs[u32_Itf].u32_BusIndex];
+         if (rc_Bus.u32_Hops < c_Result.u32_Hops)
+         {
+            c_Result = rc_Bus;
+         }
+         else if (rc_Bus.u32_Hops == c_Result.u32_Hops)
+         {
+            c_Result.q_HasEthernet = c_Result.q_HasEthernet || rc_Bus.q_HasEthernet;
+         }
+         else
+         {
+            //longer
+         }
+      }
+   }
+
+   m_GetChosenRoutes(orc_System, oq_AllowCanToEthernet, mu32_NO_ROUTE, c_BestPerBus);
+   m_GetChosenTargetRoute(orc_System, ou32_TargetNodeIndex, oe_Mode, c_BestPerBus, q_PassesTarget,
+                          c_Result.c_RoutePoints);
+   if (q_PassesTarget == true)
+   {
+      m_GetChosenRoutes(orc_System, oq_AllowCanToEthernet, ou32_TargetNodeIndex, c_BestPerBus);
+      m_GetChosenTargetRoute(orc_System, ou32_TargetNodeIndex, oe_Mode, c_BestPerBus, q_PassesTarget,
+                             c_Result.c_RoutePoints);
+   }
+   return c_Result;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether a node has a routing interface with the given properties
+
+   \param[in]  orc_Node              node
+   \param[in]  ou32_BusIndex         bus index
+   \param[in]  oe_Type               interface type
+   \param[in]  ou8_InterfaceNumber   interface number
+   \param[in]  ou8_NodeId            node ID
+
+   \return
+   true: interface found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static bool m_FindInterface(const C_OscNode & orc_Node, const uint32_t ou32_BusIndex,
+                            const C_OscSystemBus::E_Type oe_Type, const uint8_t ou8_InterfaceNumber,
+                            const uint8_t ou8_NodeId)
+{
+   bool q_Found = false;
+
+   for (uint32_t u32_Itf = 0U; u32_Itf < orc_Node.c_Properties.c_ComInterfaces.size(); u32_Itf++)
+   {
+      const C_OscNodeComInterfaceSettings & rc_Itf = orc_Node.c_Properties.c_ComInterfaces[u32_Itf];
+      if ((rc_Itf.u32_BusIndex == ou32_BusIndex) && (rc_Itf.e_InterfaceType == oe_Type) &&
+          (rc_Itf.u8_InterfaceNumber == ou8_InterfaceNumber) && (rc_Itf.u8_NodeId == ou8_NodeId) &&
+          m_IsRoutingInterface(rc_Itf))
+      {
+         q_Found = true;
+      }
+   }
+   return q_Found;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check one found route
+
+   Checks:
+   * the route starts at the start bus and ends at a bus the target can be reached on
+   * consecutive route points are connected by a bus
+   * each route point uses routing interfaces of an active node other than the target
+   * no route point routes from CAN to Ethernet
+   * number of route points and Ethernet usage are the same as of the reference
+   * the route is the one chosen by the reference of the routes with the fewest route points
+
+   \param[in]  orc_System             system
+   \param[in]  ou32_TargetNodeIndex   target node
+   \param[in]  oe_Mode                routing mode
+   \param[in]  orc_Route              found route
+   \param[in]  orc_Reference          reference result
+   \param[in]  orc_Description        description for report
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckRoute(const C_System & orc_System, const uint32_t ou32_TargetNodeIndex,
+                         const C_OscRoutingCalculation::E_Mode oe_Mode, const C_OscRoutingRoute & orc_Route,
+                         const C_Reference & orc_Reference, const C_SclString & orc_Description)
+{
+   const std::vector<C_OscNodeComInterfaceSettings> & rc_TargetItfs =
+      orc_System.c_Nodes[ou32_TargetNodeIndex].c_Properties.c_ComInterfaces;
+   uint32_t u32_BusIndex = orc_System.u32_StartBusIndex;
+   bool q_HasEthernet = false;
+   bool q_Valid = true;
+   bool q_TargetReached = false;
+
+   for (uint32_t u32_Point = 0U; u32_Point < orc_Route.c_VecRoutePoints.size(); u32_Point++)
+   {
+      const C_OscRoutingRoutePoint & rc_Point = orc_Route.c_VecRoutePoints[u32_Point];
+
+      if ((rc_Point.u32_NodeIndex >= orc_System.c_Nodes.size()) ||
+          (rc_Point.u32_NodeIndex == ou32_TargetNodeIndex) ||
+          (orc_System.c_ActiveNodes[rc_Point.u32_NodeIndex] != 1U) ||
+          (rc_Point.u32_InBusIndex != u32_BusIndex) || (rc_Point.u32_OutBusIndex == rc_Point.u32_InBusIndex) ||
+          ((rc_Point.e_InInterfaceType == C_OscSystemBus::eCAN) &&
+           (rc_Point.e_OutInterfaceType == C_OscSystemBus::eETHERNET)))
+      {
+         q_Valid = false;
+         break;
+      }
+      if ((m_FindInterface(orc_System.c_Nodes[rc_Point.u32_NodeIndex], rc_Point.u32_InBusIndex,
+                           rc_Point.e_InInterfaceType, rc_Point.u8_InInterfaceNumber, rc_Point.u8_InNodeId) == false) ||
+          (m_FindInterface(orc_System.c_Nodes[rc_Point.u32_NodeIndex], rc_Point.u32_OutBusIndex,
+                           rc_Point.e_OutInterfaceType, rc_Point.u8_OutInterfaceNumber,
+                           rc_Point.u8_OutNodeId) == false))
+      {
+         q_Valid = false;
+         break;
+      }
+      q_HasEthernet = q_HasEthernet || (rc_Point.e_OutInterfaceType == C_OscSystemBus::eETHERNET);
+      u32_BusIndex = rc_Point.u32_OutBusIndex;
+   }
+
+   for (uint32_t u32_Itf = 0U; u32_Itf < rc_TargetItfs.size(); u32_Itf++)
+   {
+      if ((rc_TargetItfs[u32_Itf].u32_BusIndex == u32_BusIndex) && m_IsTargetInterface(rc_TargetItfs[u32_Itf], oe_Mode))
+      {
+         q_TargetReached = true;
+      }
+   }
+
+   m_Check(orc_Route.u32_TargetNodeIndex == ou32_TargetNodeIndex, orc_Description + ": target index");
+   m_Check(q_Valid, orc_Description + ": invalid route point");
+   m_Check(q_TargetReached, orc_Description + ": route does not end at target");
+   m_Check(orc_Route.c_VecRoutePoints.size() == orc_Reference.u32_Hops, orc_Description + ": route not shortest");
+   m_Check(q_HasEthernet == orc_Reference.q_HasEthernet, orc_Description + ": Ethernet preference");
+   m_Check(orc_Route.c_VecRoutePoints == orc_Reference.c_RoutePoints, orc_Description + ": route choice");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check routes to all nodes of a system, directly calculated and cached
+
+   \param[in]  orc_System        system
+   \param[in]  oe_Mode           routing mode
+   \param[in]  orc_Description   description for report
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckSystem(const C_System & orc_System, const C_OscRoutingCalculation::E_Mode oe_Mode,
+                          const C_SclString & orc_Description)
+{
+   const C_OscRoutingTable c_Table(orc_System.c_Nodes, orc_System.c_ActiveNodes, orc_System.u32_StartBusIndex,
+                                   oe_Mode);
+   C_OscRoutingRoute c_CachedRoute(0U);
+
+   for (uint32_t u32_Target = 0U; u32_Target < orc_System.c_Nodes.size(); u32_Target++)
+   {
+      const C_SclString c_Description = orc_Description + " mode " +
+                                        C_SclString::IntToStr(static_cast<int32_t>(oe_Mode)) + " target " +
+                                        C_SclString::IntToStr(u32_Target);
+      const int32_t s32_State = c_Table.GetState(u32_Target);
+      const C_OscRoutingRoute * const pc_Route = c_Table.GetBestRoute(u32_Target);
+      int32_t s32_Expected = m_GetExpectedConfigState(orc_System.c_Nodes[u32_Target], oe_Mode);
+      const C_Reference c_Reference = m_GetReference(orc_System, u32_Target, oe_Mode, false);
+
+      if (s32_Expected == C_NO_ERR)
+      {
+         if (orc_System.c_ActiveNodes[u32_Target] != 1U)
+         {
+            s32_Expected = C_COM;
+         }
+         else if (c_Reference.u32_Hops != mu32_NO_ROUTE)
+         {
+            s32_Expected = C_NO_ERR;
+         }
+         else if (m_GetReference(orc_System, u32_Target, oe_Mode, true).u32_Hops != mu32_NO_ROUTE)
+         {
+            s32_Expected = C_CONFIG;
+         }
+         else
+         {
+            s32_Expected = C_COM;
+         }
+      }
+      m_Check(s32_State == s32_Expected, c_Description + ": state " + C_SclString::IntToStr(s32_State) +
+              " expected " + C_SclString::IntToStr(s32_Expected));
+      m_Check((pc_Route != NULL) == (s32_State == C_NO_ERR), c_Description + ": route pointer");
+      if ((pc_Route != NULL) && (s32_Expected == C_NO_ERR))
+      {
+         m_CheckRoute(orc_System, u32_Target, oe_Mode, *pc_Route, c_Reference, c_Description);
+      }
+
+      //cached result must be the same
+      c_CachedRoute.c_VecRoutePoints.clear();
+      m_Check(C_OscRoutingTable::h_GetBestRoute(orc_System.c_Nodes, orc_System.c_ActiveNodes,
+                                                orc_System.u32_StartBusIndex, u32_Target, oe_Mode,
+                                                c_CachedRoute) == s32_State, c_Description + ": cached state");
+      m_Check((pc_Route == NULL) || (c_CachedRoute == *pc_Route), c_Description + ": cached route");
+   }
+
+   m_Check(C_OscRoutingTable::h_GetBestRoute(orc_System.c_Nodes, orc_System.c_ActiveNodes,
+                                             orc_System.u32_StartBusIndex,
+                                             static_cast<uint32_t>(orc_System.c_Nodes.size()), oe_Mode,
+                                             c_CachedRoute) == C_RANGE, orc_Description + ": cached invalid target");
+   m_Check(c_Table.GetState(static_cast<uint32_t>(orc_System.c_Nodes.size())) == C_RANGE,
+           orc_Description + ": invalid target");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check hand made systems with known routes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckFixedCases(void)
+{
+   C_System c_System;
+   const C_OscRoutingTable * pc_Table;
+   const C_OscRoutingRoute * pc_Route;
+
+   //bus 0: CAN (start); bus 1: Ethernet; bus 2: CAN
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eCAN);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eETHERNET);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eCAN);
+   c_System.u32_StartBusIndex = 0U;
+   //node 0: router CAN 0 -> Ethernet 1 (not possible)
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[0], C_OscSystemBus::eCAN, 0U, true, true, true);
+   m_AddInterface(c_System.c_Nodes[0], C_OscSystemBus::eETHERNET, 1U, true, true, true);
+   //node 1: only on Ethernet 1
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[1], C_OscSystemBus::eETHERNET, 1U, false, true, true);
+   //node 2: router CAN 0 -> CAN 2
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[2], C_OscSystemBus::eCAN, 0U, true, true, true);
+   m_AddInterface(c_System.c_Nodes[2], C_OscSystemBus::eCAN, 2U, true, true, true);
+   //node 3: only on CAN 2
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[3], C_OscSystemBus::eCAN, 2U, false, true, true);
+   //node 4: third party device on CAN 2
+   c_System.c_Nodes.push_back(m_CreateNode(false));
+   m_AddInterface(c_System.c_Nodes[4], C_OscSystemBus::eCAN, 2U, false, true, true);
+   //node 5: update deactivated
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[5], C_OscSystemBus::eCAN, 0U, false, false, true);
+   //node 6: update activated on an interface without bus
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[6], C_OscSystemBus::eCAN, 0U, false, true, true);
+   c_System.c_Nodes[6].c_Properties.c_ComInterfaces[0].SetBusConnected(false);
+   c_System.c_ActiveNodes.resize(c_System.c_Nodes.size(), 1U);
+
+   pc_Table = new C_OscRoutingTable(c_System.c_Nodes, c_System.c_ActiveNodes, 0U, C_OscRoutingCalculation::eUPDATE);
+   m_Check(pc_Table->GetState(0U) == C_NO_ERR, "fixed: node on start bus");
+   pc_Route = pc_Table->GetBestRoute(0U);
+   m_Check((pc_Route != NULL) && (pc_Route->c_VecRoutePoints.size() == 0U), "fixed: no route point on start bus");
+   m_Check(pc_Table->GetState(1U) == C_CONFIG, "fixed: CAN to Ethernet");
+   m_Check(pc_Table->GetState(3U) == C_NO_ERR, "fixed: CAN to CAN");
+   pc_Route = pc_Table->GetBestRoute(3U);
+   m_Check((pc_Route != NULL) && (pc_Route->c_VecRoutePoints.size() == 1U) &&
+           (pc_Route->c_VecRoutePoints[0].u32_NodeIndex == 2U), "fixed: CAN to CAN route");
+   m_Check(pc_Table->GetState(4U) == C_NOACT, "fixed: third party device");
+   m_Check(pc_Table->GetState(5U) == C_NOACT, "fixed: update deactivated");
+   m_Check(pc_Table->GetState(6U) == C_COM, "fixed: not connected");
+   delete pc_Table;
+   m_CheckSystem(c_System, C_OscRoutingCalculation::eUPDATE, "fixed CAN");
+
+   //inactive router: no route
+   c_System.c_ActiveNodes[2] = 0U;
+   pc_Table = new C_OscRoutingTable(c_System.c_Nodes, c_System.c_ActiveNodes, 0U, C_OscRoutingCalculation::eUPDATE);
+   m_Check(pc_Table->GetState(3U) == C_COM, "fixed: inactive router");
+   delete pc_Table;
+   m_CheckSystem(c_System, C_OscRoutingCalculation::eUPDATE, "fixed inactive router");
+
+   //Ethernet preference
+   //bus 0: Ethernet (start); bus 1: CAN; bus 2: Ethernet; bus 3: CAN
+   c_System.c_BusTypes.clear();
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eETHERNET);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eCAN);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eETHERNET);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eCAN);
+   c_System.c_Nodes.clear();
+   //node 0: Ethernet 0 -> CAN 1; node 1: CAN 1 -> CAN 3 (found first, no Ethernet)
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[0], C_OscSystemBus::eETHERNET, 0U, true, true, true);
+   m_AddInterface(c_System.c_Nodes[0], C_OscSystemBus::eCAN, 1U, true, true, true);
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[1], C_OscSystemBus::eCAN, 1U, true, true, true);
+   m_AddInterface(c_System.c_Nodes[1], C_OscSystemBus::eCAN, 3U, true, true, true);
+   //node 2: Ethernet 0 -> Ethernet 2; node 3: Ethernet 2 -> CAN 3
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[2], C_OscSystemBus::eETHERNET, 0U, true, true, true);
+   m_AddInterface(c_System.c_Nodes[2], C_OscSystemBus::eETHERNET, 2U, true, true, true);
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[3], C_OscSystemBus::eETHERNET, 2U, true, true, true);
+   m_AddInterface(c_System.c_Nodes[3], C_OscSystemBus::eCAN, 3U, true, true, true);
+   //node 4: target on CAN 3
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[4], C_OscSystemBus::eCAN, 3U, false, true, true);
+   c_System.c_ActiveNodes.clear();
+   c_System.c_ActiveNodes.resize(c_System.c_Nodes.size(), 1U);
+
+   pc_Table = new C_OscRoutingTable(c_System.c_Nodes, c_System.c_ActiveNodes, 0U, C_OscRoutingCalculation::eUPDATE);
+   pc_Route = pc_Table->GetBestRoute(4U);
+   m_Check((pc_Route != NULL) && (pc_Route->c_VecRoutePoints.size() == 2U) &&
+           (pc_Route->c_VecRoutePoints[0].u32_NodeIndex == 2U) && (pc_Route->c_VecRoutePoints[1].u32_NodeIndex == 3U),
+           "fixed: Ethernet preferred");
+   delete pc_Table;
+   m_CheckSystem(c_System, C_OscRoutingCalculation::eUPDATE, "fixed Ethernet");
+
+   //target as router: node 4 also routes Ethernet 0 -> CAN 3 (update only on CAN 3)
+   m_AddInterface(c_System.c_Nodes[4], C_OscSystemBus::eETHERNET, 0U, true, false, false);
+   c_System.c_Nodes[4].c_Properties.c_ComInterfaces[0].q_IsRoutingEnabled = true;
+   pc_Table = new C_OscRoutingTable(c_System.c_Nodes, c_System.c_ActiveNodes, 0U, C_OscRoutingCalculation::eUPDATE);
+   pc_Route = pc_Table->GetBestRoute(4U);
+   m_Check((pc_Route != NULL) && (pc_Route->c_VecRoutePoints.size() == 2U) &&
+           (pc_Route->c_VecRoutePoints[0].u32_NodeIndex == 2U), "fixed: target not used as router");
+   delete pc_Table;
+   m_CheckSystem(c_System, C_OscRoutingCalculation::eUPDATE, "fixed target as router");
+   m_CheckSystem(c_System, C_OscRoutingCalculation::eDIAGNOSTIC, "fixed target as router");
+
+   //routes of same length: first one without Ethernet, last one with Ethernet (as the previous search)
+   //bus 0: Ethernet (start); bus 1: CAN; bus 2: Ethernet
+   c_System.c_BusTypes.clear();
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eETHERNET);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eCAN);
+   c_System.c_BusTypes.push_back(C_OscSystemBus::eETHERNET);
+   c_System.c_Nodes.clear();
+   //nodes 0 and 1: Ethernet 0 -> CAN 1; nodes 2 and 3: Ethernet 0 -> Ethernet 2
+   for (uint32_t u32_Node = 0U; u32_Node < 4U; u32_Node++)
+   {
+      c_System.c_Nodes.push_back(m_CreateNode(true));
+      m_AddInterface(c_System.c_Nodes[u32_Node], C_OscSystemBus::eETHERNET, 0U, true, true, true);
+      m_AddInterface(c_System.c_Nodes[u32_Node], c_System.c_BusTypes[1U + (u32_Node / 2U)], 1U + (u32_Node / 2U),
+                     true, true, true);
+   }
+   //node 4: target on CAN 1; node 5: target on Ethernet 2
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[4], C_OscSystemBus::eCAN, 1U, false, true, true);
+   c_System.c_Nodes.push_back(m_CreateNode(true));
+   m_AddInterface(c_System.c_Nodes[5], C_OscSystemBus::eETHERNET, 2U, false, true, true);
+   c_System.c_ActiveNodes.clear();
+   c_System.c_ActiveNodes.resize(c_System.c_Nodes.size(), 1U);
+
+   pc_Table = new C_OscRoutingTable(c_System.c_Nodes, c_System.c_ActiveNodes, 0U, C_OscRoutingCalculation::eUPDATE);
+   pc_Route = pc_Table->GetBestRoute(4U);
+   m_Check((pc_Route != NULL) && (pc_Route->c_VecRoutePoints.size() == 1U) &&
+           (pc_Route->c_VecRoutePoints[0].u32_NodeIndex == 0U), "fixed: first of equal routes without Ethernet");
+   pc_Route = pc_Table->GetBestRoute(5U);
+   m_Check((pc_Route != NULL) && (pc_Route->c_VecRoutePoints.size() == 1U) &&
+           (pc_Route->c_VecRoutePoints[0].u32_NodeIndex == 3U), "fixed: last of equal routes with Ethernet");
+   delete pc_Table;
+   m_CheckSystem(c_System, C_OscRoutingCalculation::eUPDATE, "fixed equal routes");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create pseudo random system
+
+   \return
+   system
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_System m_CreateRandomSystem(void)
+{
+   C_System c_System;
+   const uint32_t u32_NumBuses = 1U + m_GetRandom(mu32_MAX_BUSES);
+   const uint32_t u32_NumNodes = 1U + m_GetRandom(mu32_MAX_NODES);
+
+   for (uint32_t u32_Bus = 0U; u32_Bus < u32_NumBuses; u32_Bus++)
+   {
+      c_System.c_BusTypes.push_back((m_GetRandom(5U) < 3U) ? C_OscSystemBus::eCAN : C_OscSystemBus::eETHERNET);
+   }
+   c_System.u32_StartBusIndex = m_GetRandom(u32_NumBuses);
+
+   for (uint32_t u32_Node = 0U; u32_Node < u32_NumNodes; u32_Node++)
+   {
+      const uint32_t u32_NumItfs = 1U + m_GetRandom(mu32_MAX_INTERFACES);
+      C_OscNode c_Node = m_CreateNode(m_GetRandom(8U) != 0U);
+
+      if (m_GetRandom(4U) == 0U)
+      {
+         c_Node.c_Properties.e_DiagnosticServer = C_OscNodeProperties::eDS_NONE;
+      }
+      for (uint32_t u32_Itf = 0U; u32_Itf < u32_NumItfs; u32_Itf++)
+      {
+         const uint32_t u32_Bus = m_GetRandom(u32_NumBuses);
+         m_AddInterface(c_Node, c_System.c_BusTypes[u32_Bus], u32_Bus, m_GetRandom(10U) < 7U,
+                        m_GetRandom(10U) < 7U, m_GetRandom(10U) < 7U);
+         if (m_GetRandom(12U) == 0U)
+         {
+            c_Node.c_Properties.c_ComInterfaces.back().SetBusConnected(false);
+         }
+         else if (m_GetRandom(20U) == 0U)
+         {
+            c_Node.c_Properties.c_ComInterfaces.back().SetInterfaceConnectedInDevice(false);
+         }
+         else
+         {
+            //connected
+         }
+      }
+      c_System.c_Nodes.push_back(c_Node);
+      c_System.c_ActiveNodes.push_back((m_GetRandom(8U) != 0U) ? 1U : 0U);
+   }
+   return c_System;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Change one routing relevant property of a pseudo random system
+
+   \param[in,out]  orc_System   system
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_ChangeRandomSystem(C_System & orc_System)
+{
+   const uint32_t u32_Node = m_GetRandom(static_cast<uint32_t>(orc_System.c_Nodes.size()));
+   std::vector<C_OscNodeComInterfaceSettings> & rc_Itfs = orc_System.c_Nodes[u32_Node].c_Properties.c_ComInterfaces;
+   C_OscNodeComInterfaceSettings & rc_Itf = rc_Itfs[m_GetRandom(static_cast<uint32_t>(rc_Itfs.size()))];
+
+   switch (m_GetRandom(5U))
+   {
+   case 0U:
+      rc_Itf.q_IsRoutingEnabled = !rc_Itf.q_IsRoutingEnabled;
+      break;
+   case 1U:
+      rc_Itf.q_IsUpdateEnabled = !rc_Itf.q_IsUpdateEnabled;
+      rc_Itf.q_IsDiagnosisEnabled = !rc_Itf.q_IsDiagnosisEnabled;
+      break;
+   case 2U:
+      rc_Itf.SetBusConnected(!rc_Itf.GetBusConnectedRawValue());
+      break;
+   case 3U:
+      rc_Itf.u8_NodeId = static_cast<uint8_t>(rc_Itf.u8_NodeId + 1U);
+      break;
+   default:
+      orc_System.c_ActiveNodes[u32_Node] = (orc_System.c_ActiveNodes[u32_Node] == 1U) ? 0U : 1U;
+      break;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check pseudo random systems
+
+   Each system is checked, changed in one property and checked again, so the cache holds a table of an almost
+   identical system. Then the original system is checked again to get a cache hit.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckRandomCases(void)
+{
+   static const C_OscRoutingCalculation::E_Mode hae_MODES[] =
+   {
+      C_OscRoutingCalculation::eUPDATE, C_OscRoutingCalculation::eDIAGNOSTIC,
+      C_OscRoutingCalculation::eROUTING_CHECK, C_OscRoutingCalculation::eROUTING_CHECK_DIAG
+   };
+
+   for (uint32_t u32_Run = 0U; u32_Run < mu32_NUM_RANDOM_RUNS; u32_Run++)
+   {
+      const C_OscRoutingCalculation::E_Mode e_Mode =
+         hae_MODES[u32_Run % (sizeof(hae_MODES) / sizeof(C_OscRoutingCalculation::E_Mode))];
+      const C_SclString c_Description = "random run " + C_SclString::IntToStr(u32_Run);
+      const C_System c_System = m_CreateRandomSystem();
+      C_System c_Changed = c_System;
+
+      m_ChangeRandomSystem(c_Changed);
+      m_CheckSystem(c_System, e_Mode, c_Description);
+      m_CheckSystem(c_Changed, e_Mode, c_Description + " changed");
+      m_CheckSystem(c_System, e_Mode, c_Description + " again");
+   }
+
+   C_OscRoutingTable::h_ClearCache();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   //one log entry per calculated table is not of interest here
+   C_OscLoggingHandler::h_SetWriteToConsoleActive(false);
+   m_CheckFixedCases();
+   m_CheckRandomCases();
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
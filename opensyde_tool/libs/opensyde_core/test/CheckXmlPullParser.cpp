@@ -0,0 +1,539 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Module check for the read-only XML load path (C_OscXmlParser::LoadFromFileReadOnly)
+
+   The read-only path uses the pull parser (C_OscXmlPullParser) and a compact element table instead of tinyxml2.
+   Each document is loaded with LoadFromFile and with LoadFromFileReadOnly. The results and complete dumps
+    (navigation via names and name handles, node names, attributes incl. numeric conversions, content and line
+    numbers) must be identical.
+   Documents: fixed cases (entities, CDATA, BOM, CR/LF variants, comments, declarations, DTD, mixed content),
+    malformed cases and pseudo random documents.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <cstdio>
+#include <set>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_SclString.hpp"
+#include "C_OscXmlParser.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const char_t * const mpcn_FILE_NAME = "xml_pull_parser_check.xml";
+static const uint32_t mu32_NUM_RANDOM_RUNS = 300U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+static uint32_t mu32_NumChecks = 0U;
+static uint32_t mu32_NumFailures = 0U;
+static uint32_t mu32_RandomState = 0x13579BDFU;
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description);
+static uint32_t m_GetRandom(const uint32_t ou32_Range);
+static C_SclString m_Raw(const char_t * const opcn_Text);
+static void m_DumpElement(C_OscXmlParser & orc_Parser, const uint32_t ou32_Depth, C_SclString & orc_Dump);
+static C_SclString m_Dump(C_OscXmlParser & orc_Parser);
+static void m_CheckDocument(const C_SclString & orc_Content, const C_SclString & orc_Description,
+                            const bool oq_WellFormed);
+static void m_CheckFixedCases(void);
+static void m_CheckMalformedCases(void);
+static C_SclString m_CreateRandomText(const bool oq_Attribute);
+static void m_CreateRandomElement(const uint32_t ou32_Depth, C_SclString & orc_Document);
+static void m_CheckRandomCases(void);
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Report result of one check
+
+   \param[in]  oq_Condition      true: check passed
+   \param[in]  orc_Description   description printed if the check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_Check(const bool oq_Condition, const C_SclString & orc_Description)
+{
+   mu32_NumChecks++;
+   if (oq_Condition == false)
+   {
+      mu32_NumFailures++;
+      if (mu32_NumFailures <= 20U)
+      {
+         std::printf("FAILED: %s\n", orc_Description.c_str());
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pseudo random number
+
+   xorshift32; fixed seed so all runs check the same values
+
+   \param[in]  ou32_Range   number of possible results (> 0)
+
+   \return
+   pseudo random number in range 0 .. ou32_Range-1
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static uint32_t m_GetRandom(const uint32_t ou32_Range)
+{
+   mu32_RandomState ^= mu32_RandomState << 13U;
+   mu32_RandomState ^= mu32_RandomState >> 17U;
+   mu32_RandomState ^= mu32_RandomState << 5U;
+   return mu32_RandomState % ou32_Range;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert raw text to dump text
+
+   \param[in]  opcn_Text   text (may be NULL)
+
+   \return
+   "(null)" or text in brackets
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_Raw(const char_t * const opcn_Text)
+{
+   return (opcn_Text == NULL) ? C_SclString("(null)") : ("[" + C_SclString(opcn_Text) + "]");
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Dump current element and all its children
+
+   The current element is selected again afterwards.
+
+   \param[in,out]  orc_Parser   parser
+   \param[in]      ou32_Depth   nesting depth of element
+   \param[in,out]  orc_Dump     dump to append to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_DumpElement(C_OscXmlParser & orc_Parser, const uint32_t ou32_Depth, C_SclString & orc_Dump)
+{
+   const C_SclString c_Name = orc_Parser.GetCurrentNodeName();
+   const C_OscXmlName c_NameHandle(c_Name.c_str());
+   const std::vector<C_OscXmlAttribute> c_Attributes = orc_Parser.GetAttributes();
+   std::set<C_SclString> c_ChildNames;
+   C_SclString c_Child;
+
+   orc_Dump += C_SclString::IntToStr(ou32_Depth) + " <" + c_Name + "> line " +
+               C_SclString::IntToStr(orc_Parser.GetFileLineForCurrentNode()) + " is " +
+               C_SclString::IntToStr(orc_Parser.IsCurrentNode(c_NameHandle)) + " raw " +
+               m_Raw(orc_Parser.GetCurrentNodeNameRaw()) + " content " + m_Raw(orc_Parser.GetNodeContentRaw()) +
+               " / [" + orc_Parser.GetNodeContent() + "]\n";
+   for (uint32_t u32_Attribute = 0U; u32_Attribute < c_Attributes.size(); u32_Attribute++)
+   {
+      const C_OscXmlAttribute & rc_Attribute = c_Attributes[u32_Attribute];
+      const C_OscXmlName c_AttributeHandle(rc_Attribute.c_Name.c_str());
+      C_SclString c_Value;
+      int32_t s32_Value = 0;
+      uint32_t u32_Value = 0U;
+      int64_t s64_Value = 0;
+      uint64_t u64_Value = 0U;
+      bool q_Value = false;
+      float32_t f32_Value = 0.0F;
+      float64_t f64_Value = 0.0;
+      C_SclString c_Errors;
+
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeStringError(rc_Attribute.c_Name, c_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeSint32Error(rc_Attribute.c_Name, s32_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeUint32Error(rc_Attribute.c_Name, u32_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeSint64Error(rc_Attribute.c_Name, s64_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeUint64Error(rc_Attribute.c_Name, u64_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeBoolError(rc_Attribute.c_Name, q_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeFloat32Error(rc_Attribute.c_Name, f32_Value)) + ",";
+      c_Errors += C_SclString::IntToStr(orc_Parser.GetAttributeFloat64Error(rc_Attribute.c_Name, f64_Value));
+
+      orc_Dump += "  @" + rc_Attribute.c_Name + "=[" + rc_Attribute.c_Value + "] string [" +
+                  orc_Parser.GetAttributeString(rc_Attribute.c_Name) + "] raw " +
+                  m_Raw(orc_Parser.GetAttributeRaw(c_AttributeHandle)) + " exists " +
+                  C_SclString::IntToStr(orc_Parser.AttributeExists(rc_Attribute.c_Name)) +
+                  C_SclString::IntToStr(orc_Parser.AttributeExists(c_AttributeHandle)) + " values " +
+                  C_SclString::IntToStr(orc_Parser.GetAttributeSint32(c_AttributeHandle, -1)) + " " +
+                  C_SclString::IntToStr(orc_Parser.GetAttributeUint32(c_AttributeHandle, 7U)) + " " +
+                  C_SclString::IntToStr(orc_Parser.GetAttributeSint64(c_AttributeHandle, -1)) + " " +
+                  C_SclString::IntToStr(orc_Parser.GetAttributeUint64(c_AttributeHandle, 7U)) + " " +
+                  C_SclString::IntToStr(orc_Parser.GetAttributeBool(c_AttributeHandle, true)) + " " +
+                  C_SclString::FloatToStr(orc_Parser.GetAttributeFloat32(c_AttributeHandle, 0.5F)) + " " +
+                  C_SclString::FloatToStr(orc_Parser.GetAttributeFloat64(c_AttributeHandle, 0.25)) + " errors " +
+                  c_Errors + " values " + c_Value + " " + C_SclString::IntToStr(s32_Value) + " " +
+                  C_SclString::IntToStr(u32_Value) + " " + C_SclString::IntToStr(s64_Value) + " " +
+                  C_SclString::IntToStr(u64_Value) + " " + C_SclString::IntToStr(q_Value) + " " +
+                  C_SclString::FloatToStr(f32_Value) + " " + C_SclString::FloatToStr(f64_Value) + "\n";
+   }
+   orc_Dump += "  missing attribute " + C_SclString::IntToStr(orc_Parser.AttributeExists("no_such_attribute")) +
+               " [" + orc_Parser.GetAttributeString("no_such_attribute", "default") + "]\n";
+
+   //all children in document order
+   c_Child = orc_Parser.SelectNodeChild();
+   if (c_Child != "")
+   {
+      do
+      {
+         c_ChildNames.insert(c_Child);
+         m_DumpElement(orc_Parser, ou32_Depth + 1U, orc_Dump);
+         c_Child = orc_Parser.SelectNodeNext();
+      }
+      while (c_Child != "");
+      orc_Dump += "  parent [" + orc_Parser.SelectNodeParent() + "]\n";
+   }
+
+   //children by name: via string and via name handle
+   c_ChildNames.insert("no_such_element");
+   for (std::set<C_SclString>::const_iterator c_It = c_ChildNames.begin(); c_It != c_ChildNames.end(); ++c_It)
+   {
+      const C_OscXmlName c_ChildHandle(c_It->c_str());
+      uint32_t u32_Count = 0U;
+      uint32_t u32_CountHandle = 0U;
+
+      if (orc_Parser.SelectNodeChild(*c_It) == *c_It)
+      {
+         do
+         {
+            u32_Count++;
+         }
+         while (orc_Parser.SelectNodeNext(*c_It) == *c_It);
+         orc_Dump += "  after last [" + orc_Parser.GetCurrentNodeName() + "] line " +
+                     C_SclString::IntToStr(orc_Parser.GetFileLineForCurrentNode()) + "\n";
+         (void)orc_Parser.SelectNodeParent();
+      }
+      if (orc_Parser.SelectNodeChild(c_ChildHandle) == true)
+      {
+         do
+         {
+            u32_CountHandle++;
+         }
+         while (orc_Parser.SelectNodeNext(c_ChildHandle) == true);
+         (void)orc_Parser.SelectNodeParentRaw();
+      }
+      orc_Dump += "  children <" + *c_It + "> " + C_SclString::IntToStr(u32_Count) + " " +
+                  C_SclString::IntToStr(u32_CountHandle) + " current [" + orc_Parser.GetCurrentNodeName() + "]\n";
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Dump complete document
+
+   \param[in,out]  orc_Parser   parser with loaded document
+
+   \return
+   dump
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_Dump(C_OscXmlParser & orc_Parser)
+{
+   C_SclString c_Dump;
+   const C_SclString c_Root = orc_Parser.SelectRoot();
+
+   c_Dump = "root [" + c_Root + "]\n";
+   if (c_Root != "")
+   {
+      m_DumpElement(orc_Parser, 0U, c_Dump);
+      //navigation beyond the root element
+      c_Dump += "root next [" + orc_Parser.SelectNodeNext() + "] current [" + orc_Parser.GetCurrentNodeName() +
+                "]\n";
+      c_Dump += "root parent [" + orc_Parser.SelectNodeParent() + "] current [" + orc_Parser.GetCurrentNodeName() +
+                "]\n";
+      c_Dump += "root again [" + orc_Parser.SelectRoot() + "] error " +
+                C_SclString::IntToStr(orc_Parser.SelectRootError(c_Root)) + " " +
+                C_SclString::IntToStr(orc_Parser.SelectRootError("no_such_root")) + "\n";
+      c_Dump += "child error " + C_SclString::IntToStr(orc_Parser.SelectNodeChildError("no_such_element")) +
+                " current [" + orc_Parser.GetCurrentNodeName() + "]\n";
+   }
+   return c_Dump;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Load document with both load functions and compare results
+
+   \param[in]  orc_Content       file content
+   \param[in]  orc_Description   description of case
+   \param[in]  oq_WellFormed     true: document expected to be loaded; false: document expected to be rejected
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckDocument(const C_SclString & orc_Content, const C_SclString & orc_Description,
+                            const bool oq_WellFormed)
+{
+   std::FILE * const pc_File = std::fopen(mpcn_FILE_NAME, "wb");
+
+   if (pc_File != NULL)
+   {
+      C_OscXmlParser c_Dom;
+      C_OscXmlParser c_ReadOnly;
+      int32_t s32_ResultDom;
+      int32_t s32_ResultReadOnly;
+      C_SclString c_DumpDom;
+      C_SclString c_DumpReadOnly;
+
+      (void)std::fwrite(orc_Content.c_str(), 1U, orc_Content.Length(), pc_File);
+      (void)std::fclose(pc_File);
+
+      s32_ResultDom = c_Dom.LoadFromFile(mpcn_FILE_NAME);
+      s32_ResultReadOnly = c_ReadOnly.LoadFromFileReadOnly(mpcn_FILE_NAME);
+      m_Check(s32_ResultDom == ((oq_WellFormed == true) ? C_NO_ERR : C_NOACT), orc_Description + ": expected result");
+      m_Check(s32_ResultDom == s32_ResultReadOnly, orc_Description + ": same result");
+      c_DumpDom = m_Dump(c_Dom);
+      c_DumpReadOnly = m_Dump(c_ReadOnly);
+      m_Check(c_DumpDom == c_DumpReadOnly, orc_Description + ": same dump");
+      if ((c_DumpDom != c_DumpReadOnly) && (mu32_NumFailures <= 3U))
+      {
+         std::printf("LoadFromFile:\n%s\nLoadFromFileReadOnly:\n%s\n", c_DumpDom.c_str(), c_DumpReadOnly.c_str());
+      }
+   }
+   else
+   {
+      m_Check(false, orc_Description + ": could not write file");
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check well-formed documents
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckFixedCases(void)
+{
+   const C_SclString c_Declaration = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+
+   m_CheckDocument(c_Declaration + "<opensyde-node>\n  <file-version>3</file-version>\n  <core>\n"
+                   "    <properties name=\"ESX3CM\" diagnostic-server=\"open-syde\" flash-loader=\"open-syde\">\n"
+                   "      <comment>first line\nsecond line</comment>\n"
+                   "      <com-interface kind=\"CAN\" interface-number=\"0\" node-id=\"1\" update-available=\"true\""
+                   " routing-available=\"false\" diagnosis-available=\"true\" bus-connected=\"true\""
+                   " bus-index=\"0\"/>\n"
+                   "      <com-interface kind=\"ETHERNET\" interface-number=\"1\" node-id=\"1\"/>\n"
+                   "    </properties>\n  </core>\n"
+                   "  <values><value min=\"-2147483648\" max=\"4294967295\" big=\"18446744073709551615\""
+                   " neg=\"-9223372036854775808\" f=\"1.5e3\" g=\"-0.125\" h=\"0x10\" i=\" 12\" j=\"12 \""
+                   " k=\"true\" l=\"false\" m=\"1\" n=\"\" o=\"4294967296\" p=\"nan\"/></values>\n"
+                   "</opensyde-node>\n", "node file", true);
+   m_CheckDocument(c_Declaration + "<a t=\"&lt;&gt;&amp;&quot;&apos;&#65;&#x42;&#x20AC;\">&lt;b&gt; &amp; "
+                   "&quot;c&quot; &apos;d&apos; &#65;&#x42;&#228;&#x20AC;</a>", "entities", true);
+   m_CheckDocument(c_Declaration + "<a><b><![CDATA[x<y&z]]></b><c>text<![CDATA[ <cdata> ]]>more</c>"
+                   "<d><![CDATA[]]></d></a>", "CDATA", true);
+   m_CheckDocument("\xEF\xBB\xBF" + c_Declaration + "<a b=\"1\">text</a>", "BOM", true);
+   m_CheckDocument("\xEF\xBB\xBF<a/>", "BOM without declaration", true);
+   m_CheckDocument("<?xml version=\"1.0\"?>\r\n<a>\r\n  <b c=\"x\r\ny\">line1\r\nline2</b>\r\n  <d/>\r\n</a>\r\n",
+                   "CR LF", true);
+   m_CheckDocument("<?xml version=\"1.0\"?>\r<a>\r  <b c=\"x\ry\">line1\rline2\r\rline4</b>\r  <d/>\r</a>\r",
+                   "CR only", true);
+   m_CheckDocument("<?xml version=\"1.0\"?>\n<a>\n  <b c=\"x\ty\">line1\n\rline2\r\n\nline4</b>\n  <d/>\n</a>",
+                   "mixed line ends", true);
+   m_CheckDocument(c_Declaration + "<?pi data?>\n<!-- comment -->\n<!DOCTYPE a>\n<a><!-- inner <b> -->"
+                   "<b/><c>x<!-- y -->z</c><d><!-- first --></d></a>\n<!-- trailing -->\n",
+                   "comments and declarations", true);
+   m_CheckDocument(c_Declaration + "<a>  leading and trailing  <b/>  between  <c/>\n  tail  </a>", "mixed content",
+                   true);
+   m_CheckDocument(c_Declaration + "<a>   </a>", "whitespace only content", true);
+   m_CheckDocument(c_Declaration + "<a b = 'single' c= \"double\"  d ='x\"y' e=\"x'y\"/>", "attribute quoting",
+                   true);
+   m_CheckDocument(c_Declaration + "<a><b>1</b><c>2</c><b>3</b><b/><c x=\"1\"/><d><b>inner</b></d><b>4</b></a>",
+                   "same name siblings", true);
+   m_CheckDocument(c_Declaration + "<a>\xC3\xA4\xC3\xB6\xC3\xBC \xE2\x82\xAC<b n=\"\xE6\x97\xA5\"/></a>", "UTF-8",
+                   true);
+   m_CheckDocument(c_Declaration + "<ns:a xmlns:ns=\"urn:x\" ns:b=\"1\"><ns:c/><_d-e.f/></ns:a>", "names", true);
+   m_CheckDocument(c_Declaration + "<a>unknown &foo; entity &amp x</a>", "unknown entity", true);
+   m_CheckDocument(c_Declaration + "<a></a>", "empty element", true);
+   m_CheckDocument("<a/>", "minimal document", true);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check documents that are not well-formed
+
+   tinyxml2 accepts some of them; loading in read-only mode must give the same result.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckMalformedCases(void)
+{
+   const C_SclString c_Declaration = "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+
+   m_CheckDocument("", "empty file", false);
+   m_CheckDocument("   \n", "whitespace only file", false);
+   m_CheckDocument(c_Declaration, "declaration only", true);
+   m_CheckDocument(c_Declaration + "<!-- comment only -->", "comment only", true);
+   m_CheckDocument(c_Declaration + "<a><?pi in element?></a>", "declaration in element", false);
+   m_CheckDocument("<!-- comment -->" + c_Declaration + "<a/>", "declaration after comment", false);
+   m_CheckDocument(c_Declaration + "<a><b></a></b>", "mismatched tags", false);
+   m_CheckDocument(c_Declaration + "<a><b></b>", "unclosed root", false);
+   m_CheckDocument(c_Declaration + "</a>", "end tag only", true);
+   m_CheckDocument(c_Declaration + "<a>x</a></b c=\"1\"> <c/> text </a> <<", "end tag on document level", true);
+   m_CheckDocument(c_Declaration + "<a><b></b c=\"1\"><c></c d='2' ></a>", "end tags with attributes", true);
+   m_CheckDocument(c_Declaration + "<a></b c=\"1\"/></a>", "end tag as empty element", true);
+   m_CheckDocument(c_Declaration + "<a><b></b c></a>", "end tag with invalid attribute", false);
+   m_CheckDocument(c_Declaration + "<a><b></b c=\"1\" c=\"2\"></a>", "end tag with duplicate attribute", false);
+   m_CheckDocument(c_Declaration + "<a b=\"1></a>", "unterminated attribute", false);
+   m_CheckDocument(c_Declaration + "<a b=1></a>", "unquoted attribute", false);
+   m_CheckDocument(c_Declaration + "<a b></a>", "attribute without value", false);
+   m_CheckDocument(c_Declaration + "<a b=\"<\"></a>", "less than in attribute", true);
+   m_CheckDocument(c_Declaration + "<a><!-- unterminated comment </a>", "unterminated comment", false);
+   m_CheckDocument(c_Declaration + "<a><![CDATA[ unterminated </a>", "unterminated CDATA", false);
+   m_CheckDocument(c_Declaration + "<a><b/", "unterminated tag", false);
+   m_CheckDocument(c_Declaration + "<a", "truncated start tag", false);
+   m_CheckDocument(c_Declaration + "<a></", "truncated end tag", false);
+   m_CheckDocument(c_Declaration + "<1a/>", "invalid name", false);
+   m_CheckDocument(c_Declaration + "< a/>< /a>", "space before name", true);
+   m_CheckDocument(c_Declaration + "<a>text", "text without end tag", false);
+   m_CheckDocument(c_Declaration + "<a/><b/>", "two root elements", true);
+   m_CheckDocument(c_Declaration + "<a/>trailing text", "text after root", false);
+   m_CheckDocument(c_Declaration + "text<a/>", "text before root", true);
+   m_CheckDocument(c_Declaration + "<a b=\"1\" b=\"2\"/>", "duplicate attribute", false);
+
+   //nesting limit of tinyxml2:
+   for (uint32_t u32_Levels = 97U; u32_Levels <= 100U; u32_Levels++)
+   {
+      C_SclString c_Start;
+      C_SclString c_End;
+      for (uint32_t u32_Level = 0U; u32_Level < u32_Levels; u32_Level++)
+      {
+         c_Start += "<e" + C_SclString::IntToStr(u32_Level) + ">";
+         c_End = "</e" + C_SclString::IntToStr(u32_Level) + ">" + c_End;
+      }
+      m_CheckDocument(c_Start + c_End, C_SclString::IntToStr(u32_Levels) + " open levels", u32_Levels < 99U);
+      m_CheckDocument(c_Start + "<x/>" + c_End, C_SclString::IntToStr(u32_Levels) + " open levels and empty element",
+                      u32_Levels < 99U);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create pseudo random text
+
+   Contains entities, characters that must be escaped in some places and different line ends.
+
+   \param[in]  oq_Attribute   true: text for attribute value (double quotes); false: element content
+
+   \return
+   text
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static C_SclString m_CreateRandomText(const bool oq_Attribute)
+{
+   static const char_t * const hapcn_PARTS[] =
+   {
+      "a", "Z", "0", "-12", "3.5", "true", " ", "  ", "\t", "\n", "\r\n", "\r", "&lt;", "&gt;", "&amp;", "&quot;",
+      "&apos;", "&#65;", "&#x3C;", ">", "'", "\xC3\xA4", "]]", "x y"
+   };
+   const uint32_t u32_NumParts = sizeof(hapcn_PARTS) / sizeof(hapcn_PARTS[0]);
+   const uint32_t u32_Length = m_GetRandom(6U);
+   C_SclString c_Text;
+
+   for (uint32_t u32_Part = 0U; u32_Part < u32_Length; u32_Part++)
+   {
+      c_Text += hapcn_PARTS[m_GetRandom(u32_NumParts)];
+   }
+   if ((oq_Attribute == false) && (m_GetRandom(8U) == 0U))
+   {
+      c_Text += "<![CDATA[" + C_SclString(hapcn_PARTS[m_GetRandom(u32_NumParts)]) + "<&]]>";
+   }
+   return c_Text;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create pseudo random element with children
+
+   \param[in]      ou32_Depth     nesting depth of element
+   \param[in,out]  orc_Document   document to append element to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CreateRandomElement(const uint32_t ou32_Depth, C_SclString & orc_Document)
+{
+   static const char_t * const hapcn_NAMES[] =
+   {
+      "node", "data-pool", "list", "element", "value", "x", "com-interface"
+   };
+   const C_SclString c_Name = hapcn_NAMES[m_GetRandom(sizeof(hapcn_NAMES) / sizeof(hapcn_NAMES[0]))];
+   const uint32_t u32_NumAttributes = m_GetRandom(4U);
+   const uint32_t u32_NumChildren = (ou32_Depth < 5U) ? m_GetRandom(5U) : 0U;
+
+   orc_Document += "<" + c_Name;
+   for (uint32_t u32_Attribute = 0U; u32_Attribute < u32_NumAttributes; u32_Attribute++)
+   {
+      orc_Document += ((m_GetRandom(4U) == 0U) ? "\n   " : " ") + C_SclString("attr") +
+                      C_SclString::IntToStr(u32_Attribute) + "=\"" + m_CreateRandomText(true) + "\"";
+   }
+   if ((u32_NumChildren == 0U) && (m_GetRandom(2U) == 0U))
+   {
+      orc_Document += "/>";
+   }
+   else
+   {
+      orc_Document += ">" + m_CreateRandomText(false);
+      for (uint32_t u32_Child = 0U; u32_Child < u32_NumChildren; u32_Child++)
+      {
+         if (m_GetRandom(6U) == 0U)
+         {
+            orc_Document += "<!-- comment -->";
+         }
+         m_CreateRandomElement(ou32_Depth + 1U, orc_Document);
+         orc_Document += m_CreateRandomText(false);
+      }
+      orc_Document += "</" + c_Name + ">";
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check pseudo random documents
+
+   Every fifth document is truncated at a random position.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+static void m_CheckRandomCases(void)
+{
+   for (uint32_t u32_Run = 0U; u32_Run < mu32_NUM_RANDOM_RUNS; u32_Run++)
+   {
+      C_SclString c_Document = (m_GetRandom(2U) == 0U) ? "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" : "";
+      const C_SclString c_Description = "random run " + C_SclString::IntToStr(u32_Run);
+
+      m_CreateRandomElement(0U, c_Document);
+      if ((u32_Run % 5U) == 4U)
+      {
+         //cut within the root element: never well-formed
+         const uint32_t u32_Length = c_Document.Length();
+         c_Document = c_Document.SubString(1U, u32_Length - 1U - m_GetRandom(u32_Length / 2U));
+         m_CheckDocument(c_Document, c_Description + " truncated", false);
+      }
+      else
+      {
+         m_CheckDocument(c_Document + "\n", c_Description, true);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Entry point
+
+   \return
+   0   all checks passed
+   1   at least one check failed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int main(void)
+{
+   m_CheckFixedCases();
+   m_CheckMalformedCases();
+   m_CheckRandomCases();
+   (void)std::remove(mpcn_FILE_NAME);
+
+   //missing file
+   {
+      C_OscXmlParser c_Dom;
+      C_OscXmlParser c_ReadOnly;
+      m_Check(c_Dom.LoadFromFile(mpcn_FILE_NAME) == C_NOACT, "missing file");
+      m_Check(c_ReadOnly.LoadFromFileReadOnly(mpcn_FILE_NAME) == C_NOACT, "missing file read-only");
+      m_Check(m_Dump(c_Dom) == m_Dump(c_ReadOnly), "missing file: same dump");
+   }
+
+   std::printf("%u checks; %u failed\n", mu32_NumChecks, mu32_NumFailures);
+   return (mu32_NumFailures == 0U) ? 0 : 1;
+}
@@ -12,17 +12,21 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp" //pre-compiled headers
 
+#include <cstring>
 #include <fstream>
+#include <sstream>
 #include "stwtypes.hpp"
 #include "stwerrors.hpp"
 #include "C_OscXmlParser.hpp"
 #include "tinyxml2.h"
+#include "TglFile.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::scl;
 
 using namespace stw::errors;
 using namespace stw::opensyde_core;
+using stw::tgl::C_TglFileMapping;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
 
@@ -43,7 +47,9 @@ using namespace stw::opensyde_core;
    Will throw on error.
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_OscXmlParserBase::C_OscXmlParserBase(void)
+C_OscXmlParserBase::C_OscXmlParserBase(void) :
+   mq_ReadOnly(false),
+   mu32_CurrentCompactNode(C_OscXmlCompactTree::hu32_INVALID_INDEX)
 {
    mpc_CurrentNode = NULL;
    m_Init();
@@ -65,6 +71,319 @@ void C_OscXmlParserBase::m_Init(void)
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Parse XML data into compact read-only element table
+
+   On success the parser is switched to read-only mode: all reading functions work on the compact element table,
+    functions modifying the document have no effect.
+
+   \param[in]  opcn_Data   XML text (does not need to be zero terminated)
+   \param[in]  ou32_Size   number of bytes in opcn_Data
+
+   \return
+   C_NO_ERR   data parsed
+   C_NOACT    data is not a well-formed XML document (read-only mode is left)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscXmlParserBase::m_LoadReadOnly(const char_t * const opcn_Data, const uint32_t ou32_Size)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   mpc_CurrentNode = NULL;
+   mu32_CurrentCompactNode = C_OscXmlCompactTree::hu32_INVALID_INDEX;
+   if (mc_CompactTree.Parse(opcn_Data, ou32_Size) == C_NO_ERR)
+   {
+      mq_ReadOnly = true;
+   }
+   else
+   {
+      m_ResetReadOnly();
+      s32_Return = C_NOACT;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Leave read-only mode
+
+   Releases the compact element table. Subsequent operations work on the tinyxml2 document again.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OscXmlParserBase::m_ResetReadOnly(void)
+{
+   mc_CompactTree.Clear();
+   mq_ReadOnly = false;
+   mu32_CurrentCompactNode = C_OscXmlCompactTree::hu32_INVALID_INDEX;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether document was loaded in read-only mode
+
+   \return
+   true    read-only mode: document is held in compact element table
+   false   document is held in tinyxml2 DOM
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::m_IsReadOnly(void) const
+{
+   return mq_ReadOnly;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get raw attribute value of selected node
+
+   \param[in]  orc_Name   name of attribute
+
+   \return
+   NULL   attribute does not exist (or: no element selected)
+   else   attribute value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlParserBase::m_GetAttributeValue(const C_SclString & orc_Name) const
+{
+   const char_t * pcn_Value = NULL;
+
+   if (mq_ReadOnly == true)
+   {
+      pcn_Value = mc_CompactTree.GetAttribute(mu32_CurrentCompactNode, C_OscXmlName(orc_Name.c_str()));
+   }
+   else if (mpc_CurrentNode != NULL)
+   {
+      pcn_Value = mpc_CurrentNode->Attribute(orc_Name.c_str());
+   }
+   else
+   {
+      //no element selected
+   }
+   return pcn_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get element whose children are searched by SelectNodeChild (DOM)
+
+   \return
+   current node; root node if no node is selected
+*/
+//----------------------------------------------------------------------------------------------------------------------
+tinyxml2::XMLElement * C_OscXmlParserBase::m_GetParentForChildSelection(void)
+{
+   return (mpc_CurrentNode != NULL) ? mpc_CurrentNode : mc_Document.RootElement();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get element whose children are searched by SelectNodeChild (read-only mode)
+
+   \return
+   current node; root node if no node is selected
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlParserBase::m_GetCompactParentForChildSelection(void) const
+{
+   return (mu32_CurrentCompactNode != C_OscXmlCompactTree::hu32_INVALID_INDEX) ? mu32_CurrentCompactNode :
+          mc_CompactTree.GetRootElement();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to sint32
+
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Text      attribute value (NULL if attribute does not exist)
+   \param[in]  os32_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscXmlParserBase::mh_ToSint32(const char_t * const opcn_Text, const int32_t os32_Default)
+{
+   int32_t s32_Value = os32_Default;
+
+   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+   if ((opcn_Text != NULL) && (opcn_Text[0] != '\0'))
+   {
+      try
+      {
+         //numbers are short enough for the string's internal buffer; no heap allocation
+         s32_Value = C_SclString(opcn_Text).ToInt();
+      }
+      catch (...)
+      {
+      }
+   }
+   return s32_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to uint32
+
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Text      attribute value (NULL if attribute does not exist)
+   \param[in]  ou32_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlParserBase::mh_ToUint32(const char_t * const opcn_Text, const uint32_t ou32_Default)
+{
+   uint32_t u32_Value = ou32_Default;
+
+   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+   if ((opcn_Text != NULL) && (opcn_Text[0] != '\0'))
+   {
+      try
+      {
+         u32_Value = static_cast<uint32_t>(C_SclString(opcn_Text).ToInt());
+      }
+      catch (...)
+      {
+      }
+   }
+   return u32_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to sint64
+
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Text      attribute value (NULL if attribute does not exist)
+   \param[in]  os64_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int64_t C_OscXmlParserBase::mh_ToSint64(const char_t * const opcn_Text, const int64_t os64_Default)
+{
+   int64_t s64_Value = os64_Default;
+
+   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+   if ((opcn_Text != NULL) && (opcn_Text[0] != '\0'))
+   {
+      try
+      {
+         s64_Value = C_SclString(opcn_Text).ToInt64();
+      }
+      catch (...)
+      {
+      }
+   }
+   return s64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to uint64
+
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Text      attribute value (NULL if attribute does not exist)
+   \param[in]  ou64_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscXmlParserBase::mh_ToUint64(const char_t * const opcn_Text, const uint64_t ou64_Default)
+{
+   uint64_t u64_Value = ou64_Default;
+
+   if ((opcn_Text != NULL) && (opcn_Text[0] != '\0'))
+   {
+      if ((opcn_Text[0] == '0') && (opcn_Text[1] == 'x'))
+      {
+         //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
+         std::istringstream c_Stream(&opcn_Text[2]);
+         c_Stream >> std::hex >> u64_Value;
+         if (c_Stream.fail() == true)
+         {
+            u64_Value = ou64_Default;
+         }
+      }
+      else
+      {
+         //Use tinyxml2 conversion. Using istringstream with an decimal string caused issues with
+         // max uint64 value and MSVC. No issues found with hex string. See #83022.
+         if (tinyxml2::XMLUtil::ToUnsigned64(opcn_Text, &u64_Value) == false)
+         {
+            u64_Value = ou64_Default;
+         }
+      }
+   }
+   return u64_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to bool
+
+   "0" resp. "1" and "false" resp. "true" are accepted as valid values (same as XMLElement::QueryBoolAttribute).
+
+   \param[in]  opcn_Text    attribute value (NULL if attribute does not exist)
+   \param[in]  oq_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::mh_ToBool(const char_t * const opcn_Text, const bool oq_Default)
+{
+   bool q_Value = oq_Default;
+
+   if ((opcn_Text == NULL) || (tinyxml2::XMLUtil::ToBool(opcn_Text, &q_Value) == false))
+   {
+      q_Value = oq_Default;
+   }
+   return q_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to float32
+
+   Same conversion as XMLElement::QueryFloatAttribute.
+
+   \param[in]  opcn_Text      attribute value (NULL if attribute does not exist)
+   \param[in]  of32_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float32_t C_OscXmlParserBase::mh_ToFloat32(const char_t * const opcn_Text, const float32_t of32_Default)
+{
+   float32_t f32_Value = of32_Default;
+
+   if ((opcn_Text == NULL) || (tinyxml2::XMLUtil::ToFloat(opcn_Text, &f32_Value) == false))
+   {
+      f32_Value = of32_Default;
+   }
+   return f32_Value;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Convert attribute text to float64
+
+   Same conversion as XMLElement::QueryDoubleAttribute.
+
+   \param[in]  opcn_Text      attribute value (NULL if attribute does not exist)
+   \param[in]  of64_Default   value to return if there is no text or it can not be converted
+
+   \return
+   converted value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_OscXmlParserBase::mh_ToFloat64(const char_t * const opcn_Text, const float64_t of64_Default)
+{
+   float64_t f64_Value = of64_Default;
+
+   if ((opcn_Text == NULL) || (tinyxml2::XMLUtil::ToDouble(opcn_Text, &f64_Value) == false))
+   {
+      f64_Value = of64_Default;
+   }
+   return f64_Value;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Destructor
 
@@ -117,12 +436,51 @@ int32_t C_OscXmlParser::LoadFromFile(const C_SclString & orc_FileName)
 {
    tinyxml2::XMLError e_Error;
    int32_t s32_Return = C_NO_ERR;
+   m_ResetReadOnly();
    mc_Document.Clear();
 
    e_Error = mc_Document.LoadFile(orc_FileName.c_str());
    if (e_Error != tinyxml2::XML_SUCCESS)
    {
       s32_Return = C_NOACT;
+      //tinyxml2 keeps the elements parsed before the error; drop them and prepare empty file structure:
+      mc_Document.Clear();
+      m_Init();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Open XML data from file for reading only
+
+   Open XML file for reading only.
+   The file is mapped into memory and parsed with a streaming pull parser into a compact element table instead of
+    a tinyxml2 DOM. This needs far less memory and no heap allocations per element, attribute and text.
+   All reading and navigation functions behave like after LoadFromFile.
+   Functions modifying the document have no effect; SaveToFile will fail.
+   If the file could not be opened the function will return an error and prepare an empty XML structure.
+
+   \param[in]  orc_FileName   path to XML file to open
+
+   \return
+   C_NO_ERR   data was read from file
+   C_NOACT    could not read data from file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscXmlParser::LoadFromFileReadOnly(const C_SclString & orc_FileName)
+{
+   int32_t s32_Return = C_NOACT;
+   C_TglFileMapping c_File;
+
+   mc_Document.Clear();
+   if (c_File.Map(orc_FileName) == C_NO_ERR)
+   {
+      //the mapping is only needed while parsing: the element table holds copies of all values
+      s32_Return = m_LoadReadOnly(reinterpret_cast<const char_t *>(c_File.GetData()), c_File.GetSize());
+   }
+   if (s32_Return != C_NO_ERR)
+   {
+      m_ResetReadOnly();
       //prepare empty file structure:
       m_Init();
    }
@@ -145,12 +503,20 @@ int32_t C_OscXmlParser::SaveToFile(const C_SclString & orc_FileName)
 {
    int32_t s32_Return = C_NO_ERR;
 
-   const tinyxml2::XMLError e_Error = mc_Document.SaveFile(orc_FileName.c_str());
-
-   if (e_Error != tinyxml2::XML_SUCCESS)
+   if (this->m_IsReadOnly() == true)
    {
+      //document content is not available as DOM
       s32_Return = C_NOACT;
    }
+   else
+   {
+      const tinyxml2::XMLError e_Error = mc_Document.SaveFile(orc_FileName.c_str());
+
+      if (e_Error != tinyxml2::XML_SUCCESS)
+      {
+         s32_Return = C_NOACT;
+      }
+   }
    return s32_Return;
 }
 
@@ -167,10 +533,21 @@ C_SclString C_OscXmlParserBase::SelectRoot(void)
 {
    C_SclString c_RootName;
 
-   mpc_CurrentNode = mc_Document.RootElement();
-   if (mpc_CurrentNode != NULL)
+   if (mq_ReadOnly == true)
    {
-      c_RootName = mpc_CurrentNode->Name();
+      mu32_CurrentCompactNode = mc_CompactTree.GetRootElement();
+      if (mu32_CurrentCompactNode != C_OscXmlCompactTree::hu32_INVALID_INDEX)
+      {
+         c_RootName = mc_CompactTree.GetName(mu32_CurrentCompactNode);
+      }
+   }
+   else
+   {
+      mpc_CurrentNode = mc_Document.RootElement();
+      if (mpc_CurrentNode != NULL)
+      {
+         c_RootName = mpc_CurrentNode->Name();
+      }
    }
    return c_RootName;
 }
@@ -215,30 +592,80 @@ int32_t C_OscXmlParserBase::SelectRootError(const C_SclString & orc_Name)
 C_SclString C_OscXmlParserBase::SelectNodeNext(const C_SclString & orc_Name)
 {
    C_SclString c_Name;
+   bool q_Found;
 
-   tinyxml2::XMLElement * const pc_Save = mpc_CurrentNode;
-
-   if (mpc_CurrentNode != NULL)
+   if (orc_Name != "")
    {
-      if (orc_Name != "")
+      q_Found = this->SelectNodeNext(C_OscXmlName(orc_Name.c_str()));
+   }
+   else if (mq_ReadOnly == true)
+   {
+      const uint32_t u32_Next = mc_CompactTree.GetNextSiblingElement(mu32_CurrentCompactNode);
+      q_Found = (u32_Next != C_OscXmlCompactTree::hu32_INVALID_INDEX);
+      if (q_Found == true)
       {
-         mpc_CurrentNode = mpc_CurrentNode->NextSiblingElement(orc_Name.c_str());
+         mu32_CurrentCompactNode = u32_Next;
       }
-      else
+   }
+   else
+   {
+      tinyxml2::XMLElement * const pc_Next =
+         (mpc_CurrentNode != NULL) ? mpc_CurrentNode->NextSiblingElement() : NULL;
+      q_Found = (pc_Next != NULL);
+      if (q_Found == true)
       {
-         mpc_CurrentNode = mpc_CurrentNode->NextSiblingElement();
+         mpc_CurrentNode = pc_Next;
       }
    }
-   if (mpc_CurrentNode != NULL)
+   //on error the last known state is kept
+   if (q_Found == true)
    {
-      c_Name = mpc_CurrentNode->Name();
+      c_Name = this->GetCurrentNodeNameRaw();
+   }
+   return c_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select next node with name as active element
+
+   Select the next node with the specified name on the same level as the current node as active element.
+   Non-allocating variant of SelectNodeNext for precomputed names.
+   If there is no such node the selection is not changed.
+
+   \param[in]  orc_Name    name of node to select
+
+   \return
+   true    node selected
+   false   no such node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::SelectNodeNext(const C_OscXmlName & orc_Name)
+{
+   bool q_Found = false;
+
+   if (mq_ReadOnly == true)
+   {
+      const uint32_t u32_Next = mc_CompactTree.GetNextSiblingElement(mu32_CurrentCompactNode, orc_Name);
+      if (u32_Next != C_OscXmlCompactTree::hu32_INVALID_INDEX)
+      {
+         mu32_CurrentCompactNode = u32_Next;
+         q_Found = true;
+      }
+   }
+   else if (mpc_CurrentNode != NULL)
+   {
+      tinyxml2::XMLElement * const pc_Next = mpc_CurrentNode->NextSiblingElement(orc_Name.GetName());
+      if (pc_Next != NULL)
+      {
+         mpc_CurrentNode = pc_Next;
+         q_Found = true;
+      }
    }
    else
    {
-      //Restore last known state?
-      mpc_CurrentNode = pc_Save;
+      //no element selected
    }
-   return c_Name;
+   return q_Found;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -256,36 +683,80 @@ C_SclString C_OscXmlParserBase::SelectNodeNext(const C_SclString & orc_Name)
 C_SclString C_OscXmlParserBase::SelectNodeChild(const C_SclString & orc_Name)
 {
    C_SclString c_Name;
+   bool q_Found;
 
-   tinyxml2::XMLElement * pc_Element = NULL;
-
-   if (mpc_CurrentNode != NULL)
+   if (orc_Name != "")
    {
-      pc_Element = mpc_CurrentNode;
+      q_Found = this->SelectNodeChild(C_OscXmlName(orc_Name.c_str()));
    }
-   else
+   else if (mq_ReadOnly == true)
    {
-      pc_Element = mc_Document.RootElement();
+      const uint32_t u32_Child = mc_CompactTree.GetFirstChildElement(m_GetCompactParentForChildSelection());
+      q_Found = (u32_Child != C_OscXmlCompactTree::hu32_INVALID_INDEX);
+      if (q_Found == true)
+      {
+         mu32_CurrentCompactNode = u32_Child;
+      }
    }
-
-   if (pc_Element != NULL)
+   else
    {
-      if (orc_Name == "")
+      tinyxml2::XMLElement * const pc_Parent = m_GetParentForChildSelection();
+      tinyxml2::XMLElement * const pc_Child = (pc_Parent != NULL) ? pc_Parent->FirstChildElement() : NULL;
+      q_Found = (pc_Child != NULL);
+      if (q_Found == true)
       {
-         pc_Element = pc_Element->FirstChildElement();
+         mpc_CurrentNode = pc_Child;
       }
-      else
+   }
+   if (q_Found == true)
+   {
+      c_Name = this->GetCurrentNodeNameRaw();
+   }
+   return c_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select child node with name as active element
+
+   Select the first child node with the specified name of the current node as active element.
+   If no node is selected the children of the root node are searched.
+   Non-allocating variant of SelectNodeChild for precomputed names.
+   If there is no such node the selection is not changed.
+
+   \param[in]  orc_Name    name of child node to select
+
+   \return
+   true    node selected
+   false   no such node
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::SelectNodeChild(const C_OscXmlName & orc_Name)
+{
+   bool q_Found = false;
+
+   if (mq_ReadOnly == true)
+   {
+      const uint32_t u32_Child = mc_CompactTree.GetFirstChildElement(m_GetCompactParentForChildSelection(), orc_Name);
+      if (u32_Child != C_OscXmlCompactTree::hu32_INVALID_INDEX)
       {
-         pc_Element = pc_Element->FirstChildElement(orc_Name.c_str());
+         mu32_CurrentCompactNode = u32_Child;
+         q_Found = true;
       }
    }
-
-   if (pc_Element != NULL)
+   else
    {
-      mpc_CurrentNode = pc_Element;
-      c_Name = mpc_CurrentNode->Name();
+      tinyxml2::XMLElement * const pc_Parent = m_GetParentForChildSelection();
+      if (pc_Parent != NULL)
+      {
+         tinyxml2::XMLElement * const pc_Child = pc_Parent->FirstChildElement(orc_Name.GetName());
+         if (pc_Child != NULL)
+         {
+            mpc_CurrentNode = pc_Child;
+            q_Found = true;
+         }
+      }
    }
-   return c_Name;
+   return q_Found;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -326,15 +797,42 @@ C_SclString C_OscXmlParserBase::SelectNodeParent(void)
 {
    C_SclString c_Name;
 
-   if (mpc_CurrentNode != NULL)
+   if (this->SelectNodeParentRaw() == true)
    {
-      mpc_CurrentNode = mpc_CurrentNode->Parent()->ToElement();
+      c_Name = this->GetCurrentNodeNameRaw();
    }
-   if (mpc_CurrentNode != NULL)
+   return c_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select parent of active node as active element
+
+   Select the parent node of the current node as active element.
+   Non-allocating variant of SelectNodeParent.
+
+   \return
+   true    parent node selected
+   false   there is no parent element (nothing is selected now)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::SelectNodeParentRaw(void)
+{
+   bool q_Selected;
+
+   if (mq_ReadOnly == true)
    {
-      c_Name = mpc_CurrentNode->Name();
+      mu32_CurrentCompactNode = mc_CompactTree.GetParentElement(mu32_CurrentCompactNode);
+      q_Selected = (mu32_CurrentCompactNode != C_OscXmlCompactTree::hu32_INVALID_INDEX);
    }
-   return c_Name;
+   else
+   {
+      if (mpc_CurrentNode != NULL)
+      {
+         mpc_CurrentNode = mpc_CurrentNode->Parent()->ToElement();
+      }
+      q_Selected = (mpc_CurrentNode != NULL);
+   }
+   return q_Selected;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -351,18 +849,36 @@ C_SclString C_OscXmlParserBase::SelectNodeParent(void)
 //----------------------------------------------------------------------------------------------------------------------
 C_SclString C_OscXmlParserBase::GetNodeContent(void) const
 {
-   C_SclString c_Content;
+   return this->GetNodeContentRaw();
+}
 
-   if (mpc_CurrentNode != NULL)
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get content of selected node
+
+   Non-allocating variant of GetNodeContent.
+   The returned text is valid until the document is modified or reloaded.
+
+   \return
+   Content of selected element ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlParserBase::GetNodeContentRaw(void) const
+{
+   const char_t * pcn_Content = NULL;
+
+   if (mq_ReadOnly == true)
    {
-      const char_t * const pcn_Content = mpc_CurrentNode->GetText();
-      if (pcn_Content != NULL)
-      {
-         c_Content = pcn_Content;
-      }
+      pcn_Content = mc_CompactTree.GetText(mu32_CurrentCompactNode);
    }
-
-   return c_Content;
+   else if (mpc_CurrentNode != NULL)
+   {
+      pcn_Content = mpc_CurrentNode->GetText();
+   }
+   else
+   {
+      //no element selected
+   }
+   return (pcn_Content != NULL) ? pcn_Content : "";
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -370,38 +886,105 @@ C_SclString C_OscXmlParserBase::GetNodeContent(void) const
 
    Check whether the specified attribute exists in the current element.
 
-   \param[in]  orc_Name    name of attribute to check for
+   \param[in]  orc_Name    name of attribute to check for
+
+   \return
+   true   attribute exists
+   false  attribute does not exists (or: no element selected)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::AttributeExists(const C_SclString & orc_Name) const
+{
+   return (this->m_GetAttributeValue(orc_Name) != NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check whether specified attribute exists
+
+   Variant of AttributeExists for precomputed names.
+
+   \param[in]  orc_Name    name of attribute to check for
+
+   \return
+   true   attribute exists
+   false  attribute does not exists (or: no element selected)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::AttributeExists(const C_OscXmlName & orc_Name) const
+{
+   return (this->GetAttributeRaw(orc_Name) != NULL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get current node name
+
+   \return
+   Current node name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SclString C_OscXmlParserBase::GetCurrentNodeName(void) const
+{
+   return this->GetCurrentNodeNameRaw();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get current node name
+
+   Non-allocating variant of GetCurrentNodeName.
+   The returned text is valid until the document is modified or reloaded.
 
    \return
-   true   attribute exists
-   false  attribute does not exists (or: no element selected)
+   Current node name ("" if no node is selected)
 */
 //----------------------------------------------------------------------------------------------------------------------
-bool C_OscXmlParserBase::AttributeExists(const C_SclString & orc_Name) const
+const char_t * C_OscXmlParserBase::GetCurrentNodeNameRaw(void) const
 {
-   bool q_Return = false;
+   const char_t * pcn_Name = "";
 
-   if (mpc_CurrentNode != NULL)
+   if (mq_ReadOnly == true)
    {
-      const char_t * const pcn_Text = mpc_CurrentNode->Attribute(orc_Name.c_str());
-      if (pcn_Text != NULL)
-      {
-         q_Return = true;
-      }
+      pcn_Name = mc_CompactTree.GetName(mu32_CurrentCompactNode);
+   }
+   else if (mpc_CurrentNode != NULL)
+   {
+      pcn_Name = mpc_CurrentNode->Name();
+   }
+   else
+   {
+      //no element selected
    }
-   return q_Return;
+   return pcn_Name;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Get current node name
+/*! \brief  Check name of current node
+
+   \param[in]  orc_Name    expected name
 
    \return
-   Current node name
+   true    current node has this name
+   false   current node has another name (or: no element selected)
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_SclString C_OscXmlParserBase::GetCurrentNodeName(void) const
+bool C_OscXmlParserBase::IsCurrentNode(const C_OscXmlName & orc_Name) const
 {
-   return (mpc_CurrentNode == NULL) ? "" : mpc_CurrentNode->Name();
+   bool q_Match = false;
+
+   if (mq_ReadOnly == true)
+   {
+      //interned names: comparing pointers is sufficient
+      q_Match = ((mu32_CurrentCompactNode != C_OscXmlCompactTree::hu32_INVALID_INDEX) &&
+                 (mc_CompactTree.GetName(mu32_CurrentCompactNode) == orc_Name.GetName()));
+   }
+   else if (mpc_CurrentNode != NULL)
+   {
+      q_Match = (std::strcmp(mpc_CurrentNode->Name(), orc_Name.GetName()) == 0);
+   }
+   else
+   {
+      //no element selected
+   }
+   return q_Match;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -413,7 +996,17 @@ C_SclString C_OscXmlParserBase::GetCurrentNodeName(void) const
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t C_OscXmlParserBase::GetFileLineForCurrentNode(void) const
 {
-   return (mpc_CurrentNode == NULL) ? 0U : static_cast<uint32_t>(mpc_CurrentNode->GetLineNum());
+   uint32_t u32_Line;
+
+   if (mq_ReadOnly == true)
+   {
+      u32_Line = mc_CompactTree.GetLineNumber(mu32_CurrentCompactNode);
+   }
+   else
+   {
+      u32_Line = (mpc_CurrentNode == NULL) ? 0U : static_cast<uint32_t>(mpc_CurrentNode->GetLineNum());
+   }
+   return u32_Line;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -431,18 +1024,47 @@ uint32_t C_OscXmlParserBase::GetFileLineForCurrentNode(void) const
 C_SclString C_OscXmlParserBase::GetAttributeString(const C_SclString & orc_Name, const C_SclString & orc_Default) const
 {
    C_SclString c_Value = orc_Default;
+   const char_t * const pcn_Text = this->m_GetAttributeValue(orc_Name);
 
-   if (mpc_CurrentNode != NULL)
+   if (pcn_Text != NULL)
    {
-      const char_t * const pcn_Text = mpc_CurrentNode->Attribute(orc_Name.c_str());
-      if (pcn_Text != NULL)
-      {
-         c_Value = pcn_Text;
-      }
+      c_Value = pcn_Text;
    }
    return c_Value;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Non-allocating variant of GetAttributeString for precomputed names.
+   The returned text is valid until the document is modified or reloaded.
+
+   \param[in]  orc_Name       name of attribute
+
+   \return
+   NULL   attribute does not exist (or: no element selected)
+   else   attribute value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const char_t * C_OscXmlParserBase::GetAttributeRaw(const C_OscXmlName & orc_Name) const
+{
+   const char_t * pcn_Value = NULL;
+
+   if (mq_ReadOnly == true)
+   {
+      pcn_Value = mc_CompactTree.GetAttribute(mu32_CurrentCompactNode, orc_Name);
+   }
+   else if (mpc_CurrentNode != NULL)
+   {
+      pcn_Value = mpc_CurrentNode->Attribute(orc_Name.GetName());
+   }
+   else
+   {
+      //no element selected
+   }
+   return pcn_Value;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get attribute value of selected node
 
@@ -458,22 +1080,24 @@ C_SclString C_OscXmlParserBase::GetAttributeString(const C_SclString & orc_Name,
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_OscXmlParserBase::GetAttributeSint32(const C_SclString & orc_Name, const int32_t os32_Default) const
 {
-   int32_t s32_Value = os32_Default;
-   C_SclString c_Text;
+   return mh_ToSint32(this->m_GetAttributeValue(orc_Name), os32_Default);
+}
 
-   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
-   {
-      try
-      {
-         s32_Value = c_Text.ToInt();
-      }
-      catch (...)
-      {
-      }
-   }
-   return s32_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeSint32 for precomputed names.
+
+   \param[in]  orc_Name       name of attribute
+   \param[in]  os32_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_OscXmlParserBase::GetAttributeSint32(const C_OscXmlName & orc_Name, const int32_t os32_Default) const
+{
+   return mh_ToSint32(this->GetAttributeRaw(orc_Name), os32_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -491,22 +1115,24 @@ int32_t C_OscXmlParserBase::GetAttributeSint32(const C_SclString & orc_Name, con
 //----------------------------------------------------------------------------------------------------------------------
 uint32_t C_OscXmlParserBase::GetAttributeUint32(const C_SclString & orc_Name, const uint32_t ou32_Default) const
 {
-   uint32_t u32_Value = ou32_Default;
-   C_SclString c_Text;
+   return mh_ToUint32(this->m_GetAttributeValue(orc_Name), ou32_Default);
+}
 
-   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
-   {
-      try
-      {
-         u32_Value = static_cast<uint32_t>(c_Text.ToInt());
-      }
-      catch (...)
-      {
-      }
-   }
-   return u32_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeUint32 for precomputed names.
+
+   \param[in]  orc_Name       name of attribute
+   \param[in]  ou32_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_OscXmlParserBase::GetAttributeUint32(const C_OscXmlName & orc_Name, const uint32_t ou32_Default) const
+{
+   return mh_ToUint32(this->GetAttributeRaw(orc_Name), ou32_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -524,22 +1150,24 @@ uint32_t C_OscXmlParserBase::GetAttributeUint32(const C_SclString & orc_Name, co
 //----------------------------------------------------------------------------------------------------------------------
 int64_t C_OscXmlParserBase::GetAttributeSint64(const C_SclString & orc_Name, const int64_t os64_Default) const
 {
-   int64_t s64_Value = os64_Default;
-   C_SclString c_Text;
+   return mh_ToSint64(this->m_GetAttributeValue(orc_Name), os64_Default);
+}
 
-   //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
-   {
-      try
-      {
-         s64_Value = c_Text.ToInt64();
-      }
-      catch (...)
-      {
-      }
-   }
-   return s64_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeSint64 for precomputed names.
+
+   \param[in]  orc_Name       name of attribute
+   \param[in]  os64_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int64_t C_OscXmlParserBase::GetAttributeSint64(const C_OscXmlName & orc_Name, const int64_t os64_Default) const
+{
+   return mh_ToSint64(this->GetAttributeRaw(orc_Name), os64_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -557,34 +1185,24 @@ int64_t C_OscXmlParserBase::GetAttributeSint64(const C_SclString & orc_Name, con
 //----------------------------------------------------------------------------------------------------------------------
 uint64_t C_OscXmlParserBase::GetAttributeUint64(const C_SclString & orc_Name, const uint64_t ou64_Default) const
 {
-   uint64_t u64_Value = ou64_Default;
-   C_SclString c_Text;
+   return mh_ToUint64(this->m_GetAttributeValue(orc_Name), ou64_Default);
+}
 
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
-   {
-      if ((c_Text.Length() >= 2) && ((c_Text[1] == '0') && (c_Text[2] == 'x')))
-      {
-         //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-         std::istringstream c_Stream(c_Text.SubString(3UL, c_Text.Length() - 2UL).c_str());
-         c_Stream >> std::hex >> u64_Value;
-         if (c_Stream.fail() == true)
-         {
-            u64_Value = ou64_Default;
-         }
-      }
-      else
-      {
-         //Use Query function. Using istringstream with an decimal string caused issues with
-         // max uint64 value and MSVC. No issues found with hex string. See #83022.
-         const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryUnsigned64Attribute(orc_Name.c_str(), &u64_Value);
-         if (e_Error != tinyxml2::XML_SUCCESS)
-         {
-            u64_Value = ou64_Default;
-         }
-      }
-   }
-   return u64_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeUint64 for precomputed names.
+
+   \param[in]  orc_Name       name of attribute
+   \param[in]  ou64_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_OscXmlParserBase::GetAttributeUint64(const C_OscXmlName & orc_Name, const uint64_t ou64_Default) const
+{
+   return mh_ToUint64(this->GetAttributeRaw(orc_Name), ou64_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -593,8 +1211,8 @@ uint64_t C_OscXmlParserBase::GetAttributeUint64(const C_SclString & orc_Name, co
    Return one attribute value of selected node as bool value.
    "0" resp. "1" and "false" resp. "true" are accepted as valid values.
 
-   \param[in]  orc_Name    name of attribute
-   \param[in]  oq_Default  Default if attribute is not found or conversion of node content from string fails
+   \param[in]  orc_Name     name of attribute
+   \param[in]  oq_Default   Default if attribute is not found or conversion of node content from string fails
 
    \return
    true   attribute value is true
@@ -603,17 +1221,25 @@ uint64_t C_OscXmlParserBase::GetAttributeUint64(const C_SclString & orc_Name, co
 //----------------------------------------------------------------------------------------------------------------------
 bool C_OscXmlParserBase::GetAttributeBool(const C_SclString & orc_Name, const bool oq_Default) const
 {
-   bool q_Value = oq_Default;
+   return mh_ToBool(this->m_GetAttributeValue(orc_Name), oq_Default);
+}
 
-   if (mpc_CurrentNode != NULL)
-   {
-      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryBoolAttribute(orc_Name.c_str(), &q_Value);
-      if (e_Error != tinyxml2::XML_SUCCESS)
-      {
-         q_Value = oq_Default;
-      }
-   }
-   return q_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeBool for precomputed names.
+
+   \param[in]  orc_Name     name of attribute
+   \param[in]  oq_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   true   attribute value is true
+   false  attribute value is false (also returned on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OscXmlParserBase::GetAttributeBool(const C_OscXmlName & orc_Name, const bool oq_Default) const
+{
+   return mh_ToBool(this->GetAttributeRaw(orc_Name), oq_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -630,17 +1256,24 @@ bool C_OscXmlParserBase::GetAttributeBool(const C_SclString & orc_Name, const bo
 //----------------------------------------------------------------------------------------------------------------------
 float32_t C_OscXmlParserBase::GetAttributeFloat32(const C_SclString & orc_Name, const float32_t of32_Default) const
 {
-   float32_t f32_Value = of32_Default;
+   return mh_ToFloat32(this->m_GetAttributeValue(orc_Name), of32_Default);
+}
 
-   if (mpc_CurrentNode != NULL)
-   {
-      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryFloatAttribute(orc_Name.c_str(), &f32_Value);
-      if (e_Error != tinyxml2::XML_SUCCESS)
-      {
-         f32_Value = of32_Default;
-      }
-   }
-   return f32_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeFloat32 for precomputed names.
+
+   \param[in]  orc_Name       name of attribute
+   \param[in]  of32_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   value (0.0F on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float32_t C_OscXmlParserBase::GetAttributeFloat32(const C_OscXmlName & orc_Name, const float32_t of32_Default) const
+{
+   return mh_ToFloat32(this->GetAttributeRaw(orc_Name), of32_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -657,17 +1290,24 @@ float32_t C_OscXmlParserBase::GetAttributeFloat32(const C_SclString & orc_Name,
 //----------------------------------------------------------------------------------------------------------------------
 float64_t C_OscXmlParserBase::GetAttributeFloat64(const C_SclString & orc_Name, const float64_t of64_Default) const
 {
-   float64_t f64_Value = of64_Default;
+   return mh_ToFloat64(this->m_GetAttributeValue(orc_Name), of64_Default);
+}
 
-   if (mpc_CurrentNode != NULL)
-   {
-      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryDoubleAttribute(orc_Name.c_str(), &f64_Value);
-      if (e_Error != tinyxml2::XML_SUCCESS)
-      {
-         f64_Value = of64_Default;
-      }
-   }
-   return f64_Value;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Variant of GetAttributeFloat64 for precomputed names.
+
+   \param[in]  orc_Name       name of attribute
+   \param[in]  of64_Default   Default if attribute is not found or conversion of node content from string fails
+
+   \return
+   value (0.0 on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_OscXmlParserBase::GetAttributeFloat64(const C_OscXmlName & orc_Name, const float64_t of64_Default) const
+{
+   return mh_ToFloat64(this->GetAttributeRaw(orc_Name), of64_Default);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1015,7 +1655,19 @@ void C_OscXmlParserBase::ReportErrorForNodeMissing(const C_SclString & orc_Missi
 std::vector<C_OscXmlAttribute> C_OscXmlParserBase::GetAttributes(void) const
 {
    std::vector<C_OscXmlAttribute> c_AttributeList;
-   if (mpc_CurrentNode != NULL)
+   if (mq_ReadOnly == true)
+   {
+      const uint32_t u32_NumAttributes = mc_CompactTree.GetNumAttributes(mu32_CurrentCompactNode);
+      c_AttributeList.reserve(u32_NumAttributes);
+      for (uint32_t u32_Index = 0U; u32_Index < u32_NumAttributes; ++u32_Index)
+      {
+         C_OscXmlAttribute c_Data;
+         c_Data.c_Name = mc_CompactTree.GetAttributeName(mu32_CurrentCompactNode, u32_Index);
+         c_Data.c_Value = mc_CompactTree.GetAttributeValue(mu32_CurrentCompactNode, u32_Index);
+         c_AttributeList.push_back(c_Data);
+      }
+   }
+   else if (mpc_CurrentNode != NULL)
    {
       const tinyxml2::XMLAttribute * pc_Attribute = mpc_CurrentNode->FirstAttribute();
       while (pc_Attribute != NULL)
@@ -1045,19 +1697,23 @@ std::vector<C_OscXmlAttribute> C_OscXmlParserBase::GetAttributes(void) const
 //----------------------------------------------------------------------------------------------------------------------
 void C_OscXmlParserBase::CreateNodeChild(const C_SclString & orc_Name, const C_SclString & orc_Content)
 {
-   tinyxml2::XMLElement * const pc_Node = mc_Document.NewElement("");
-   if (orc_Content != "")
-   {
-      pc_Node->SetText(orc_Content.c_str());
-   }
-   pc_Node->SetName(orc_Name.c_str()); //does not seem to be the same as in the constructor (?)
-   if (mpc_CurrentNode != NULL)
-   {
-      mpc_CurrentNode->InsertEndChild(pc_Node);
-   }
-   else
+   //a read-only document can not be modified
+   if (mq_ReadOnly == false)
    {
-      mc_Document.InsertEndChild(pc_Node);
+      tinyxml2::XMLElement * const pc_Node = mc_Document.NewElement("");
+      if (orc_Content != "")
+      {
+         pc_Node->SetText(orc_Content.c_str());
+      }
+      pc_Node->SetName(orc_Name.c_str()); //does not seem to be the same as in the constructor (?)
+      if (mpc_CurrentNode != NULL)
+      {
+         mpc_CurrentNode->InsertEndChild(pc_Node);
+      }
+      else
+      {
+         mc_Document.InsertEndChild(pc_Node);
+      }
    }
 }
 
@@ -1077,20 +1733,24 @@ C_SclString C_OscXmlParserBase::CreateAndSelectNodeChild(const C_SclString & orc
 {
    C_SclString c_Name;
 
-   this->CreateNodeChild(orc_Name);
-   if (mpc_CurrentNode != NULL)
-   {
-      mpc_CurrentNode = mpc_CurrentNode->LastChildElement();
-   }
-   else
+   //a read-only document can not be modified
+   if (mq_ReadOnly == false)
    {
-      //new node added at the end:
-      mpc_CurrentNode = mc_Document.LastChildElement();
-   }
+      this->CreateNodeChild(orc_Name);
+      if (mpc_CurrentNode != NULL)
+      {
+         mpc_CurrentNode = mpc_CurrentNode->LastChildElement();
+      }
+      else
+      {
+         //new node added at the end:
+         mpc_CurrentNode = mc_Document.LastChildElement();
+      }
 
-   if (mpc_CurrentNode != NULL)
-   {
-      c_Name = mpc_CurrentNode->Name();
+      if (mpc_CurrentNode != NULL)
+      {
+         c_Name = mpc_CurrentNode->Name();
+      }
    }
    return c_Name;
 }
@@ -1289,13 +1949,15 @@ int32_t C_OscXmlParser::LoadFromString(const C_SclString & orc_String)
 {
    tinyxml2::XMLError e_Error;
    int32_t s32_Return = C_NO_ERR;
+   m_ResetReadOnly();
    mc_Document.Clear();
 
    e_Error = this->mc_Document.Parse(orc_String.c_str(), orc_String.Length());
    if (e_Error != tinyxml2::XML_SUCCESS)
    {
       s32_Return = C_NOACT;
-      //prepare empty file structure:
+      //tinyxml2 keeps the elements parsed before the error; drop them and prepare empty file structure:
+      mc_Document.Clear();
       m_Init();
    }
    return s32_Return;
@@ -224,6 +224,44 @@ void C_CamComDriverBase::RemoveAllCyclicCanMessages(void)
    this->mc_CriticalSectionMsg.Release();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get transmission statistics of all registered CAN messages
+
+   This function is thread safe
+
+   \param[out]  orc_Statistics  Statistics of all registered messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamComDriverBase::GetCyclicCanMessageStatistics(
+   std::vector<C_OscComDriverBaseCanMessageStatistics> & orc_Statistics) const
+{
+   this->mc_CriticalSectionMsg.Acquire();
+   C_OscComDriverBase::GetCyclicCanMessageStatistics(orc_Statistics);
+   this->mc_CriticalSectionMsg.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get time until the next CAN message has to be sent
+
+   This function is thread safe
+
+   \param[out]  oru32_TimeUs  Time until the next transmission (0 if a message is already due)
+
+   \return
+   true     Message pending; time valid
+   false    No message queued or registered
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamComDriverBase::GetTimeToNextCanMessage(uint32_t & oru32_TimeUs) const
+{
+   bool q_Retval;
+
+   this->mc_CriticalSectionMsg.Acquire();
+   q_Retval = C_OscComDriverBase::GetTimeToNextCanMessage(oru32_TimeUs);
+   this->mc_CriticalSectionMsg.Release();
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  On Clear trace we send information to base class to clear message counters
 */
@@ -54,6 +54,9 @@ public:
                                const bool oq_SetAutoSupportMode,
                                const stw::opensyde_core::C_OscCanProtocol::E_Type oe_ProtocolType) override;
    void RemoveAllCyclicCanMessages(void) override;
+   void GetCyclicCanMessageStatistics(
+      std::vector<stw::opensyde_core::C_OscComDriverBaseCanMessageStatistics> & orc_Statistics) const override;
+   bool GetTimeToNextCanMessage(uint32_t & oru32_TimeUs) const override;
    void ClearData(void) override;
    void UpdateAutoSupportProtocol(const int32_t os32_CanId, const bool oq_SetAutoSupportMode,
                                   const stw::opensyde_core::C_OscCanProtocol::E_Type oe_ProtocolType) override;
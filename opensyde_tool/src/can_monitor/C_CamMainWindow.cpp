@@ -881,11 +881,22 @@ void C_CamMainWindow::mh_ThreadFunc(void * const opv_Instance)
 //----------------------------------------------------------------------------------------------------------------------
 void C_CamMainWindow::m_ThreadFunc(void)
 {
+   uint32_t u32_TimeToNextMessageUs;
+
    // Get and spread the CAN messages to all registered loggers
    this->mc_ComDriver.DistributeMessages();
 
-   //rescind CPU time to other threads ...
-   stw::tgl::TglSleep(1);
+   // Wait exactly for a transmission which is due before the next regular poll
+   if ((this->mc_ComDriver.GetTimeToNextCanMessage(u32_TimeToNextMessageUs) == true) &&
+       (u32_TimeToNextMessageUs < 1000U))
+   {
+      stw::tgl::TglDelayUs(u32_TimeToNextMessageUs);
+   }
+   else
+   {
+      //rescind CPU time to other threads ...
+      stw::tgl::TglSleep(1);
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
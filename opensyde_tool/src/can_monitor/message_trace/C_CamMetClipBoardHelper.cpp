@@ -80,17 +80,13 @@ void C_CamMetClipBoardHelper::h_StoreCanMessages(const bool oq_DisplayAsHex, con
 
    for (u32_CounterMessage = 0U; u32_CounterMessage < orc_MessageData.size(); ++u32_CounterMessage)
    {
-      const C_OscComMessageLoggerData * const pc_Data = orc_MessageData[u32_CounterMessage].pc_MessageData;
+      const C_CamMetClipBoardHelperCanMessageData & rc_Data = orc_MessageData[u32_CounterMessage];
 
-      if (pc_Data != NULL)
-      {
-         C_CamMetClipBoardHelper::mh_AddMessage(c_Text, *pc_Data, orc_MessageData[u32_CounterMessage].q_Extended,
-                                                oq_DisplayAsHex, oq_DisplayTimestampRelative,
-                                                oq_DisplayTimestampAbsoluteTimeOfDay, s32_WIDTH_INITIAL, s32_WIDTH_TIME,
-                                                s32_WIDTH_ID, s32_WIDTH_NAME, s32_WIDTH_DIR, s32_WIDTH_DLC,
-                                                s32_WIDTH_DATA, s32_WIDTH_COUNTER,
-                                                orc_MessageData[u32_CounterMessage].c_ExpandedIndices);
-      }
+      C_CamMetClipBoardHelper::mh_AddMessage(c_Text, rc_Data.c_MessageData, rc_Data.q_Extended,
+                                             oq_DisplayAsHex, oq_DisplayTimestampRelative,
+                                             oq_DisplayTimestampAbsoluteTimeOfDay, s32_WIDTH_INITIAL, s32_WIDTH_TIME,
+                                             s32_WIDTH_ID, s32_WIDTH_NAME, s32_WIDTH_DIR, s32_WIDTH_DLC,
+                                             s32_WIDTH_DATA, s32_WIDTH_COUNTER, rc_Data.c_ExpandedIndices);
    }
 
    C_CamMetClipBoardHelper::mh_SetClipBoard(c_Text);
@@ -30,12 +30,11 @@ class C_CamMetClipBoardHelperCanMessageData
 {
 public:
    C_CamMetClipBoardHelperCanMessageData() :
-      pc_MessageData(NULL),
       q_Extended(false)
    {
    }
 
-   const stw::opensyde_core::C_OscComMessageLoggerData * pc_MessageData;
+   stw::opensyde_core::C_OscComMessageLoggerData c_MessageData; ///< Copy, the trace only formats rows temporarily
    bool q_Extended;
    std::vector<int32_t> c_ExpandedIndices;
 };
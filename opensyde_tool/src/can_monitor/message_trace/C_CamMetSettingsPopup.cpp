@@ -59,7 +59,7 @@ C_CamMetSettingsPopup::C_CamMetSettingsPopup(stw::opensyde_gui_elements::C_OgePo
    this->m_InitStaticGuiElements();
 
    this->mpc_Ui->pc_SpinBoxTraceBuffer->SetMinimumCustom(500);
-   this->mpc_Ui->pc_SpinBoxTraceBuffer->SetMaximumCustom(50000);
+   this->mpc_Ui->pc_SpinBoxTraceBuffer->SetMaximumCustom(2000000);
 
    // connects
    connect(this->mpc_Ui->pc_PushButtonSave, &C_OgePubDialog::clicked, this, &C_CamMetSettingsPopup::m_OnOk);
@@ -5,6 +5,13 @@
 
    Buffer for max performance model additions
 
+   Incoming messages are collected in one of two batches while the other one is owned by the UI.
+   On each timer tick a filled batch is swapped with the released one and handed over by pointer.
+   The slots of a batch are assigned to instead of being recreated, so in a steady state neither
+   adding a message nor the handoff allocate memory.
+   If the UI has not released its batch yet, the messages keep accumulating in the current batch
+   and are handed over on a later tick.
+
    \copyright   Copyright 2018 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -12,12 +19,17 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include "TglTime.hpp"
 #include "C_CamMetTreeGuiBuffer.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::tgl;
 using namespace stw::opensyde_gui_logic;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_CamMetTreeGuiBuffer::mhu32_INITIAL_SLOTS = 1024UL;
+// Bursts may grow a batch further; anything beyond this is released again after the handoff
+const uint32_t C_CamMetTreeGuiBuffer::mhu32_MAX_KEPT_SLOTS = 16384UL;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -29,6 +41,29 @@ using namespace stw::opensyde_gui_logic;
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeGuiBuffer::C_Batch::C_Batch(void) :
+   u32_Count(0UL),
+   u64_FirstMessageTimeUs(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeGuiBuffer::C_Statistics::C_Statistics(void) :
+   u32_NumBatches(0UL),
+   u64_NumMessages(0ULL),
+   u32_MaxBatchSize(0UL),
+   u64_SumLatencyUs(0ULL),
+   u32_MaxLatencyUs(0UL)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Default constructor
 
@@ -41,8 +76,13 @@ using namespace stw::opensyde_gui_logic;
 //lint -save -e2751
 C_CamMetTreeGuiBuffer::C_CamMetTreeGuiBuffer(QObject * const opc_Parent) :
    QObject(opc_Parent),
-   mq_Connected(false)
+   mq_Connected(false),
+   mpc_FillBatch(&mac_Batches[0]),
+   mpc_HandoffBatch(&mac_Batches[1]),
+   mq_HandoffPending(false)
 {
+   this->mac_Batches[0].c_Messages.resize(mhu32_INITIAL_SLOTS);
+   this->mac_Batches[1].c_Messages.resize(mhu32_INITIAL_SLOTS);
    mc_Timer.setInterval(100);
    mc_Timer.start();
    connect(this, &C_CamMetTreeGuiBuffer::SigInternalTrigger, this, &C_CamMetTreeGuiBuffer::m_HandleUpdateUi);
@@ -57,7 +97,20 @@ C_CamMetTreeGuiBuffer::C_CamMetTreeGuiBuffer(QObject * const opc_Parent) :
 void C_CamMetTreeGuiBuffer::HandleData(const C_CamMetTreeLoggerData & orc_NewData)
 {
    this->mc_BufferMutex.lock();
-   this->mc_Buffer.push_back(orc_NewData);
+   if (this->mpc_FillBatch->u32_Count == 0UL)
+   {
+      this->mpc_FillBatch->u64_FirstMessageTimeUs = TglGetTickCountUs();
+   }
+   if (this->mpc_FillBatch->u32_Count < this->mpc_FillBatch->c_Messages.size())
+   {
+      //Assignment keeps the memory of the strings and signals of the slot
+      this->mpc_FillBatch->c_Messages[this->mpc_FillBatch->u32_Count] = orc_NewData;
+   }
+   else
+   {
+      this->mpc_FillBatch->c_Messages.push_back(orc_NewData);
+   }
+   ++this->mpc_FillBatch->u32_Count;
    this->mc_BufferMutex.unlock();
    if (this->mq_Connected == false)
    {
@@ -73,24 +126,99 @@ void C_CamMetTreeGuiBuffer::HandleData(const C_CamMetTreeLoggerData & orc_NewDat
 void C_CamMetTreeGuiBuffer::ClearBuffer(void)
 {
    this->mc_BufferMutex.lock();
-   this->mc_Buffer.clear();
+   this->mpc_FillBatch->u32_Count = 0UL;
+   this->mc_BufferMutex.unlock();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Give a batch received by SigUpdateUi back to the buffer
+
+   Has to be called once the UI is done with the batch; no new batch is handed over before that.
+
+   \param[in]  opc_Batch   Batch received by SigUpdateUi
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeGuiBuffer::ReleaseBatch(const C_Batch * const opc_Batch)
+{
+   const uint64_t u64_Now = TglGetTickCountUs();
+
+   this->mc_BufferMutex.lock();
+   if ((opc_Batch == this->mpc_HandoffBatch) && (this->mq_HandoffPending == true))
+   {
+      const uint64_t u64_LatencyUs = u64_Now - this->mpc_HandoffBatch->u64_FirstMessageTimeUs;
+
+      ++this->mc_Statistics.u32_NumBatches;
+      this->mc_Statistics.u64_NumMessages += this->mpc_HandoffBatch->u32_Count;
+      if (this->mpc_HandoffBatch->u32_Count > this->mc_Statistics.u32_MaxBatchSize)
+      {
+         this->mc_Statistics.u32_MaxBatchSize = this->mpc_HandoffBatch->u32_Count;
+      }
+      this->mc_Statistics.u64_SumLatencyUs += u64_LatencyUs;
+      if (u64_LatencyUs > this->mc_Statistics.u32_MaxLatencyUs)
+      {
+         this->mc_Statistics.u32_MaxLatencyUs = static_cast<uint32_t>(u64_LatencyUs);
+      }
+      if (this->mpc_HandoffBatch->c_Messages.size() > mhu32_MAX_KEPT_SLOTS)
+      {
+         this->mpc_HandoffBatch->c_Messages.resize(mhu32_MAX_KEPT_SLOTS);
+      }
+      this->mpc_HandoffBatch->u32_Count = 0UL;
+      this->mq_HandoffPending = false;
+   }
+   this->mc_BufferMutex.unlock();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get handoff statistics
+
+   \return
+   Statistics since construction or last reset
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeGuiBuffer::C_Statistics C_CamMetTreeGuiBuffer::GetStatistics(void)
+{
+   C_Statistics c_Retval;
+
+   this->mc_BufferMutex.lock();
+   c_Retval = this->mc_Statistics;
+   this->mc_BufferMutex.unlock();
+   return c_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Reset handoff statistics
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeGuiBuffer::ResetStatistics(void)
+{
+   this->mc_BufferMutex.lock();
+   this->mc_Statistics = C_Statistics();
    this->mc_BufferMutex.unlock();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Trigger UI update
+
+   Hands over the filled batch if the UI released the previous one.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_CamMetTreeGuiBuffer::m_HandleUpdateUi(void)
 {
-   std::list<C_CamMetTreeLoggerData> c_BufferCopy;
+   const C_Batch * pc_Batch = NULL;
+
    this->mc_BufferMutex.lock();
-   c_BufferCopy = this->mc_Buffer;
-   this->mc_Buffer.clear();
+   if ((this->mpc_FillBatch->u32_Count > 0UL) && (this->mq_HandoffPending == false))
+   {
+      C_Batch * const pc_Filled = this->mpc_FillBatch;
+      this->mpc_FillBatch = this->mpc_HandoffBatch;
+      this->mpc_HandoffBatch = pc_Filled;
+      this->mq_HandoffPending = true;
+      pc_Batch = pc_Filled;
+   }
    this->mc_BufferMutex.unlock();
-   if (c_BufferCopy.empty() == false)
+   if (pc_Batch != NULL)
    {
-      Q_EMIT this->SigUpdateUi(c_BufferCopy);
+      Q_EMIT this->SigUpdateUi(pc_Batch);
    }
 }
 //lint -restore
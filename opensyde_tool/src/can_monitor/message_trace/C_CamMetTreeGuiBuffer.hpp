@@ -12,10 +12,11 @@
 #define C_CAMMETTREEGUIBUFFER_HPP
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
-#include <list>
 #include <mutex>
+#include <vector>
 #include <QTimer>
 #include <QObject>
+#include "stwtypes.hpp"
 #include "C_CamMetTreeLoggerData.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -33,10 +34,37 @@ class C_CamMetTreeGuiBuffer :
    Q_OBJECT
 
 public:
+   ///Messages handed over to the UI in one go
+   class C_Batch
+   {
+   public:
+      C_Batch(void);
+
+      std::vector<C_CamMetTreeLoggerData> c_Messages; ///< Reused slots; only the first u32_Count entries are valid
+      uint32_t u32_Count;
+      uint64_t u64_FirstMessageTimeUs; ///< Time the first message was added to the batch
+   };
+
+   ///Handoff statistics since the last reset
+   class C_Statistics
+   {
+   public:
+      C_Statistics(void);
+
+      uint32_t u32_NumBatches;
+      uint64_t u64_NumMessages;
+      uint32_t u32_MaxBatchSize;
+      uint64_t u64_SumLatencyUs; ///< Sum of times from first message added to batch released by the UI
+      uint32_t u32_MaxLatencyUs;
+   };
+
    C_CamMetTreeGuiBuffer(QObject * const opc_Parent = NULL);
 
    void HandleData(const C_CamMetTreeLoggerData & orc_NewData);
    void ClearBuffer(void);
+   void ReleaseBatch(const C_Batch * const opc_Batch);
+   C_Statistics GetStatistics(void);
+   void ResetStatistics(void);
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -44,13 +72,20 @@ public:
 Q_SIGNALS:
    //lint -restore
    void SigInternalTrigger(void);
-   void SigUpdateUi(const std::list<C_CamMetTreeLoggerData> & orc_Buffer);
+   void SigUpdateUi(const stw::opensyde_gui_logic::C_CamMetTreeGuiBuffer::C_Batch * const opc_Batch);
 
 private:
    bool mq_Connected;
    QTimer mc_Timer;
    std::mutex mc_BufferMutex;
-   std::list<C_CamMetTreeLoggerData> mc_Buffer;
+   C_Batch mac_Batches[2];
+   C_Batch * mpc_FillBatch;    ///< Batch filled by HandleData
+   C_Batch * mpc_HandoffBatch; ///< Batch handed over to the UI (if mq_HandoffPending)
+   bool mq_HandoffPending;
+   C_Statistics mc_Statistics;
+
+   static const uint32_t mhu32_INITIAL_SLOTS;
+   static const uint32_t mhu32_MAX_KEPT_SLOTS;
 
    void m_HandleUpdateUi(void);
 };
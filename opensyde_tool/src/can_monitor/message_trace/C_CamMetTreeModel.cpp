@@ -14,8 +14,12 @@
 
 #include <sstream>
 #include <iomanip>
+#include <iterator>
 
+#include <QDir>
 #include <QBitArray>
+#include <QCoreApplication>
+#include <QRegularExpression>
 
 #include "TglTime.hpp"
 #include "stwtypes.hpp"
@@ -67,11 +71,9 @@ C_CamMetTreeModel::C_CamMetTreeModel(QObject * const opc_Parent) :
    mu32_TraceBufferSizeUsed(1000U),
    mu32_TraceBufferSizeConfig(1000U),
    mq_DataUnlocked(false),
-   mu32_OldestItemIndex(0),
    ms32_SelectedParentRow(-1),
    mq_GrayOutPause(false),
    mu32_GrayOutPauseTimeStamp(0U),
-   mpc_RootItemContinuous(new C_TblTreSimpleItem()),
    mpc_RootItemStatic(new C_TblTreSimpleItem()),
    ms32_LastSearchedMessageRow(-1),
    ms32_LastSearchedSignalRow(-1),
@@ -92,8 +94,8 @@ C_CamMetTreeModel::C_CamMetTreeModel(QObject * const opc_Parent) :
       this->mc_FontTransparcencyColors[s32_Counter].setAlpha(ms32_TRACE_TRANSPARENCY_START - s32_Counter);
    }
 
-   //Default
-   this->mpc_InvisibleRootItem = this->mpc_RootItemContinuous;
+   //Default: continuous mode has no root item, its tree items are managed by the trace store
+   this->mpc_InvisibleRootItem = NULL;
 
    connect(&this->mc_GrayOutTimer, &QTimer::timeout, this, &C_CamMetTreeModel::m_GrayOutTimer);
    this->mc_GrayOutTimer.start(ms32_TRACE_TRANSPARENCY_REFRESH_TIME);
@@ -217,12 +219,10 @@ void C_CamMetTreeModel::UnlockData(void)
 void C_CamMetTreeModel::ActionClearData(void)
 {
    this->beginResetModel();
-   this->mu32_OldestItemIndex = 0UL;
-   this->mc_DataBase.clear();
+   this->mc_TraceStore.Clear();
    this->mc_UniqueMessages.clear();
    this->mc_UniqueMessagesOrdering.clear();
    //Tree
-   this->mpc_RootItemContinuous->ClearChildren();
    this->mpc_RootItemStatic->ClearChildren();
    //Every reset will clear the selection
    this->SetSelection(-1, -1);
@@ -240,16 +240,18 @@ void C_CamMetTreeModel::ActionClearData(void)
 /*! \brief  Add specified strings as rows
 
    \param[in]  orc_Data    New row content
+   \param[in]  ou32_Count  Number of valid entries at the start of orc_Data
 
    \return
    Indices of added rows (only valid if not in unique message mode)
 */
 //----------------------------------------------------------------------------------------------------------------------
-std::vector<int32_t> C_CamMetTreeModel::AddRows(const std::list<C_CamMetTreeLoggerData> & orc_Data)
+std::vector<int32_t> C_CamMetTreeModel::AddRows(const std::vector<C_CamMetTreeLoggerData> & orc_Data,
+                                                const uint32_t ou32_Count)
 {
-   const std::vector<int32_t> c_Retval = this->m_AddRowsContinuousMode(orc_Data);
+   const std::vector<int32_t> c_Retval = this->m_AddRowsContinuousMode(orc_Data, ou32_Count);
 
-   this->m_AddRowsUnique(orc_Data);
+   this->m_AddRowsUnique(orc_Data, ou32_Count);
 
    return c_Retval;
 }
@@ -334,7 +336,7 @@ void C_CamMetTreeModel::SetDisplayUniqueMessages(const bool oq_Value)
    }
    else
    {
-      this->mpc_InvisibleRootItem = this->mpc_RootItemContinuous;
+      this->mpc_InvisibleRootItem = NULL;
    }
    this->endResetModel();
 
@@ -454,25 +456,49 @@ void C_CamMetTreeModel::SetTraceBufferSize(const uint32_t ou32_Value)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Get all messages
+/*! \brief  Keep messages dropped from the trace buffer in a history on disk
 
-   Intended only for protocol changes
+   The history files are removed when the data is cleared and on destruction.
+   All current data of the continuous trace is cleared.
+
+   \param[in]  orc_Directory    Directory for the history files; empty: no history
+   \param[in]  ou64_MaxBytes    Maximum size of all history files; the oldest messages are dropped if exceeded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeModel::SetTraceHistory(const QString & orc_Directory, const uint64_t ou64_MaxBytes)
+{
+   QString c_FilePathBase;
+
+   if (orc_Directory.isEmpty() == false)
+   {
+      c_FilePathBase = QDir(orc_Directory).filePath(
+         static_cast<QString>("openSYDE_CAN_Monitor_trace_%1_%2").arg(QCoreApplication::applicationPid()).
+         arg(QString::number(reinterpret_cast<quintptr>(this), 16)));
+   }
+
+   this->beginResetModel();
+   this->mc_TraceStore.SetHistory(c_FilePathBase.toLocal8Bit().constData(), ou64_MaxBytes);
+   this->SetSelection(-1, -1);
+   this->endResetModel();
+
+   this->m_ResetSearch();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get all unique messages for protocol change
+
+   The messages of the continuous trace are stored compact,
+   see GetTraceMessageForProtocolChange and SetTraceMessageProtocolText for those.
 
    \return
-   All messages
+   All unique messages
 */
 //----------------------------------------------------------------------------------------------------------------------
 std::vector<C_CamMetTreeLoggerData *> C_CamMetTreeModel::GetAllMessagesForProtocolChange(void)
 {
    std::vector<C_CamMetTreeLoggerData *> c_Retval;
-   const int64_t s64_CompleteSize = static_cast<int32_t>(this->mc_DataBase.size()) + this->mc_UniqueMessages.size();
    //Reserve
-   c_Retval.reserve(s64_CompleteSize);
-   //Append vector
-   for (uint32_t u32_ItVec = 0; u32_ItVec < this->mc_DataBase.size(); ++u32_ItVec)
-   {
-      c_Retval.push_back(&this->mc_DataBase[u32_ItVec]);
-   }
+   c_Retval.reserve(this->mc_UniqueMessages.size());
    //Append map
    for (QMap<C_SclString, C_CamMetTreeLoggerData>::iterator c_It = this->mc_UniqueMessages.begin();
         c_It != this->mc_UniqueMessages.end(); ++c_It)
@@ -482,6 +508,49 @@ std::vector<C_CamMetTreeLoggerData *> C_CamMetTreeModel::GetAllMessagesForProtoc
    return c_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of messages in continuous trace
+
+   Messages in the trace history are not interpreted any more and therefore not counted.
+
+   \return
+   Number of messages of the continuous trace in memory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeModel::GetTraceMessageCount(void) const
+{
+   return this->mc_TraceStore.GetNumInMemory();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get continuous trace message for protocol change
+
+   Only the CAN message, the name and the protocol texts are set.
+
+   \param[in]   ou32_Index    Message index in continuous trace in memory (0 .. GetTraceMessageCount() - 1)
+   \param[out]  orc_Message   Message parts relevant for the protocol
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeModel::GetTraceMessageForProtocolChange(const uint32_t ou32_Index,
+                                                         C_OscComMessageLoggerData & orc_Message) const
+{
+   this->mc_TraceStore.GetProtocolData(this->mc_TraceStore.GetHistorySize() + ou32_Index, orc_Message);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Apply protocol texts of continuous trace message after protocol change
+
+   \param[in]  ou32_Index    Message index in continuous trace in memory (0 .. GetTraceMessageCount() - 1)
+   \param[in]  orc_Message   Message with updated protocol texts
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeModel::SetTraceMessageProtocolText(const uint32_t ou32_Index,
+                                                    const C_OscComMessageLoggerData & orc_Message)
+{
+   this->mc_TraceStore.SetProtocolText(this->mc_TraceStore.GetHistorySize() + ou32_Index,
+                                       orc_Message.c_ProtocolTextHex, orc_Message.c_ProtocolTextDec);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Signal a change of protocol related data
 */
@@ -647,10 +716,16 @@ QModelIndex C_CamMetTreeModel::index(const int32_t os32_Row, const int32_t os32_
 {
    QModelIndex c_Retval;
 
-   if (this->mq_DisplayTree)
+   if ((this->mq_DisplayTree) && ((this->mq_UniqueMessageMode) || (orc_Parent.isValid())))
    {
       c_Retval = C_TblTreSimpleModel::index(os32_Row, os32_Column, orc_Parent);
    }
+   else if ((this->mq_DisplayTree) && (hasIndex(os32_Row, os32_Column, orc_Parent) == true))
+   {
+      //Continuous trace top level: tree item only exists for messages with signals
+      c_Retval = this->createIndex(os32_Row, os32_Column,
+                                   this->mc_TraceStore.GetTreeItem(static_cast<uint32_t>(os32_Row)));
+   }
    else
    {
       c_Retval = this->createIndex(os32_Row, os32_Column);
@@ -671,10 +746,38 @@ QModelIndex C_CamMetTreeModel::parent(const QModelIndex & orc_Index) const
 {
    QModelIndex c_Retval;
 
-   if (this->mq_DisplayTree)
+   if ((this->mq_DisplayTree) && (this->mq_UniqueMessageMode))
    {
       c_Retval = C_TblTreSimpleModel::parent(orc_Index);
    }
+   else if ((this->mq_DisplayTree) && (orc_Index.isValid() == true))
+   {
+      //lint -e{9079}  Result of Qt interface restrictions, set by index function
+      const C_TblTreSimpleItem * const pc_TreeItem =
+         static_cast<const C_TblTreSimpleItem *>(orc_Index.internalPointer());
+      if ((pc_TreeItem != NULL) && (pc_TreeItem->pc_Parent != NULL))
+      {
+         int32_t s32_Index;
+         if (pc_TreeItem->pc_Parent->pc_Parent == NULL)
+         {
+            //Parent is a trace message item, its row is known by the trace store (avoid search in all messages)
+            s32_Index = this->mc_TraceStore.GetIndexOfTreeItem(pc_TreeItem->pc_Parent);
+         }
+         else
+         {
+            s32_Index = pc_TreeItem->pc_Parent->GetIndexInParentNumber();
+         }
+         if (s32_Index >= 0)
+         {
+            //Parent should always use column 0
+            c_Retval = createIndex(s32_Index, 0, pc_TreeItem->pc_Parent);
+         }
+      }
+   }
+   else
+   {
+      //Flat list
+   }
    return c_Retval;
 }
 
@@ -725,7 +828,7 @@ int32_t C_CamMetTreeModel::rowCount(const QModelIndex & orc_Parent) const
 {
    int32_t s32_Retval = 0;
 
-   if (this->mq_DisplayTree == true)
+   if ((this->mq_DisplayTree == true) && ((this->mq_UniqueMessageMode == true) || (orc_Parent.isValid() == true)))
    {
       s32_Retval = C_TblTreSimpleModel::rowCount(orc_Parent);
    }
@@ -738,7 +841,7 @@ int32_t C_CamMetTreeModel::rowCount(const QModelIndex & orc_Parent) const
       }
       else
       {
-         s32_Retval = static_cast<int32_t>(this->mc_DataBase.size());
+         s32_Retval = static_cast<int32_t>(this->mc_TraceStore.GetSize());
       }
    }
    else
@@ -1281,10 +1384,11 @@ const C_CamMetTreeLoggerData * C_CamMetTreeModel::GetMessageData(const int32_t o
 
    if (this->mq_UniqueMessageMode == false)
    {
-      //If not unique messages: look in "queue"/vector
-      const uint32_t u32_Index = (this->mu32_OldestItemIndex + static_cast<uint32_t>(os32_Row)) %
-                                 this->mu32_TraceBufferSizeUsed;
-      pc_Retval = &this->mc_DataBase[u32_Index];
+      //If not unique messages: look in trace ring buffer (formats the message on demand)
+      if (os32_Row >= 0)
+      {
+         pc_Retval = this->mc_TraceStore.GetMessage(static_cast<uint32_t>(os32_Row));
+      }
    }
    else
    {
@@ -1314,6 +1418,8 @@ const C_CamMetTreeLoggerData * C_CamMetTreeModel::GetMessageData(const int32_t o
    \param[out]      ors32_MultiplexedSignalRow   >= 0: Row of Multiplexed signal
                                                  < 0: Signal is not a multiplexed signal
 
+   Messages of the continuous trace history are not searched (see SearchTimeStamp and SearchCanId for those).
+
    \retval  >= 0   Message found, row returned
    \retval  < 0    No Message found
 */
@@ -1322,7 +1428,10 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
                                              int32_t & ors32_SignalRow, int32_t & ors32_MultiplexedSignalRow)
 {
    int32_t s32_Row = -1;
-   const uint32_t u32_NumberEntries = this->rowCount();
+   //Formatting all messages of the history for a text search would take too long
+   const uint32_t u32_FirstRow = (this->mq_UniqueMessageMode == false) ? this->mc_TraceStore.GetHistorySize() : 0U;
+   const uint32_t u32_NumberEntries = static_cast<uint32_t>(this->rowCount()) - u32_FirstRow;
+   const int32_t s32_LastSearchedEntry = this->ms32_LastSearchedMessageRow - static_cast<int32_t>(u32_FirstRow);
    const int32_t s32_START_AT_LAST_SIGNAL = -2;
 
    ors32_SignalRow = -1;
@@ -1338,7 +1447,7 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
       int32_t s32_CurrentSignalIndexMultiplexed = -1;
 
       if ((this->mc_LastSearchedString == orc_SearchString) &&
-          (this->ms32_LastSearchedMessageRow >= 0))
+          (this->ms32_LastSearchedMessageRow >= 0) && (s32_LastSearchedEntry >= 0))
       {
          // In case of the same search string, continue search with next or previous index
          if (oq_Next == true)
@@ -1347,12 +1456,12 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
             if (this->mq_IsLastSearchedSignalLastOfMessage == true)
             {
                // Start with message itself again
-               u32_StartIndex = (static_cast<uint32_t>(this->ms32_LastSearchedMessageRow) + 1) % u32_NumberEntries;
+               u32_StartIndex = (static_cast<uint32_t>(s32_LastSearchedEntry) + 1) % u32_NumberEntries;
             }
             else
             {
                // Start search with next available signal of last message
-               u32_StartIndex = static_cast<uint32_t>(this->ms32_LastSearchedMessageRow);
+               u32_StartIndex = static_cast<uint32_t>(s32_LastSearchedEntry);
                s32_CurrentSignalIndex = this->ms32_LastSearchedSignalRow + 1;
                s32_CurrentSignalIndexMultiplexed = this->ms32_LastSearchedSignalRowMultiplexed + 1;
                if (s32_CurrentSignalIndex >= 0)
@@ -1371,13 +1480,13 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
             if (this->ms32_LastSearchedSignalRow < 0)
             {
                // Prevent a minus value here
-               if (this->ms32_LastSearchedMessageRow == 0)
+               if (s32_LastSearchedEntry == 0)
                {
                   u32_StartIndex = u32_NumberEntries - 1U;
                }
                else
                {
-                  u32_StartIndex = (static_cast<uint32_t>(this->ms32_LastSearchedMessageRow) - 1);
+                  u32_StartIndex = (static_cast<uint32_t>(s32_LastSearchedEntry) - 1);
                }
 
                // special case: starting at the last signal of the message
@@ -1388,7 +1497,7 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
             else
             {
                // Start search with previous available signal of last message or the message itself (-1)
-               u32_StartIndex = static_cast<uint32_t>(this->ms32_LastSearchedMessageRow);
+               u32_StartIndex = static_cast<uint32_t>(s32_LastSearchedEntry);
                s32_CurrentSignalIndex = this->ms32_LastSearchedSignalRow - 1;
                s32_CurrentSignalIndexMultiplexed = this->ms32_LastSearchedSignalRowMultiplexed - 1;
 
@@ -1447,7 +1556,7 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
             }
          }
 
-         pc_Data = this->GetMessageData(u32_Row);
+         pc_Data = this->GetMessageData(static_cast<int32_t>(u32_FirstRow + u32_Row));
 
          if (pc_Data != NULL)
          {
@@ -1467,7 +1576,7 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
 
             if (q_SearchMessageResult == true)
             {
-               s32_Row = static_cast<int32_t>(u32_Row);
+               s32_Row = static_cast<int32_t>(u32_FirstRow + u32_Row);
 
                // Save the match for next call
                this->ms32_LastSearchedMessageRow = s32_Row;
@@ -1535,6 +1644,122 @@ int32_t C_CamMetTreeModel::SearchMessageData(const QString & orc_SearchString, c
    return s32_Row;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search first message of the continuous trace at or after a time stamp
+
+   The time stamp is interpreted like the currently shown absolute time stamps (time of day or time since start).
+   The whole trace including its history is searched with the help of the history index.
+
+   \param[in]  ou64_TimeStamp  Time stamp in us
+
+   \retval  >= 0   Message found, row returned
+   \retval  < 0    No Message found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeModel::SearchTimeStamp(const uint64_t ou64_TimeStamp) const
+{
+   int32_t s32_Row = -1;
+   const uint32_t u32_Size = this->mc_TraceStore.GetSize();
+
+   if ((this->mq_UniqueMessageMode == false) && (u32_Size > 0UL))
+   {
+      uint64_t u64_TimeStampAbsoluteStart = ou64_TimeStamp;
+
+      if (this->mq_DisplayTimestampAbsoluteTimeOfDay == true)
+      {
+         //Both time stamps only differ by the start time of day; the newest message is always in memory
+         const C_CamMetTreeLoggerData * const pc_Newest = this->mc_TraceStore.GetMessage(u32_Size - 1UL);
+         if (pc_Newest != NULL)
+         {
+            const uint64_t u64_DAY = 24ULL * 60ULL * 60ULL * 1000000ULL;
+            const uint64_t u64_StartOfTrace =
+               ((pc_Newest->u64_TimeStampAbsoluteTimeOfDay + u64_DAY) -
+                (pc_Newest->u64_TimeStampAbsoluteStart % u64_DAY)) % u64_DAY;
+            u64_TimeStampAbsoluteStart = ((ou64_TimeStamp + u64_DAY) - (u64_StartOfTrace % u64_DAY)) % u64_DAY;
+         }
+      }
+      s32_Row = this->mc_TraceStore.FindTimeStamp(u64_TimeStampAbsoluteStart);
+   }
+   return s32_Row;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search neighbor message of the continuous trace with the same CAN ID
+
+   The whole trace including its history is searched.
+   Only parts of the history which might contain the CAN ID are read.
+
+   \param[in]  os32_Row   Row of message with CAN ID to search
+   \param[in]  oq_Next    Flag for search direction
+                           true:  Search the next message
+                           false: Search the previous message
+
+   \retval  >= 0   Message found, row returned
+   \retval  < 0    No Message found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeModel::SearchCanId(const int32_t os32_Row, const bool oq_Next) const
+{
+   int32_t s32_Row = -1;
+
+   if ((this->mq_UniqueMessageMode == false) && (os32_Row >= 0))
+   {
+      const C_CamMetTreeLoggerData * const pc_Message = this->GetMessageData(os32_Row);
+      if (pc_Message != NULL)
+      {
+         const uint32_t u32_CanId = pc_Message->c_CanMsg.u32_ID;
+         const uint8_t u8_Xtd = pc_Message->c_CanMsg.u8_XTD;
+         if (oq_Next == true)
+         {
+            s32_Row = this->mc_TraceStore.FindCanId(static_cast<uint32_t>(os32_Row) + 1UL, u32_CanId, u8_Xtd, true);
+         }
+         else if (os32_Row > 0)
+         {
+            s32_Row = this->mc_TraceStore.FindCanId(static_cast<uint32_t>(os32_Row) - 1UL, u32_CanId, u8_Xtd, false);
+         }
+         else
+         {
+            //Oldest message, nothing before
+         }
+      }
+   }
+   return s32_Row;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse time stamp in the format of the trace
+
+   Accepted format: hours:minutes:seconds with optional milliseconds and microseconds ("12:03:15.250.100").
+   Shorter millisecond and microsecond parts are handled as decimal fraction ("12:03:15.25" equals 250 ms).
+
+   \param[in]   orc_Text          Text to parse
+   \param[out]  oru64_TimeStamp   Parsed time stamp in us
+
+   \retval  true    Text is a time stamp
+   \retval  false   Text is no time stamp
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeModel::h_ParseTimeStamp(const QString & orc_Text, uint64_t & oru64_TimeStamp)
+{
+   const QRegularExpression c_Format("^\\s*(\\d{1,6}):(\\d{1,2}):(\\d{1,2})(?:\\.(\\d{1,3})(?:\\.(\\d{1,3}))?)?\\s*$");
+   const QRegularExpressionMatch c_Match = c_Format.match(orc_Text);
+   const bool q_Retval = c_Match.hasMatch();
+
+   if (q_Retval == true)
+   {
+      const uint64_t u64_Hours = c_Match.captured(1).toULongLong();
+      const uint64_t u64_Minutes = c_Match.captured(2).toULongLong();
+      const uint64_t u64_Seconds = c_Match.captured(3).toULongLong();
+      //Missing parts are empty and result in zero
+      const uint64_t u64_MilliSeconds = c_Match.captured(4).leftJustified(3, '0').toULongLong();
+      const uint64_t u64_MicroSeconds = c_Match.captured(5).leftJustified(3, '0').toULongLong();
+
+      oru64_TimeStamp = (((((((u64_Hours * 60ULL) + u64_Minutes) * 60ULL) + u64_Seconds) * 1000ULL) +
+                          u64_MilliSeconds) * 1000ULL) + u64_MicroSeconds;
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Translate message tree indices to signal index
 
@@ -1622,7 +1847,7 @@ Qt::ItemFlags C_CamMetTreeModel::flags(const QModelIndex & orc_Index) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief  Reserves new size by the necessary vectors and sets the configured buffer size as used value
+/*! \brief  Applies the configured buffer size to the trace store and sets it as used value
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_CamMetTreeModel::m_AdaptTraceBufferSize(void)
@@ -1630,10 +1855,7 @@ void C_CamMetTreeModel::m_AdaptTraceBufferSize(void)
    // Activate the changed buffer size configuration
    this->mu32_TraceBufferSizeUsed = this->mu32_TraceBufferSizeConfig;
 
-   //lint -e{1938}  static const is guaranteed preinitialized before main
-   this->mc_DataBase.reserve(this->mu32_TraceBufferSizeUsed);
-   //lint -e{1938}  static const is guaranteed preinitialized before main
-   this->mpc_RootItemContinuous->ReserveChildrenSpace(this->mu32_TraceBufferSizeUsed);
+   this->mc_TraceStore.SetCapacity(this->mu32_TraceBufferSizeUsed);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1642,170 +1864,218 @@ void C_CamMetTreeModel::m_AdaptTraceBufferSize(void)
    Only handle continuous mode storage
 
    \param[in]  orc_Data    New row content
+   \param[in]  ou32_Count  Number of valid entries at the start of orc_Data
 
    \return
    Indices of added rows (only valid if not in unique message mode)
 */
 //----------------------------------------------------------------------------------------------------------------------
-std::vector<int32_t> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::list<C_CamMetTreeLoggerData> & orc_Data)
+std::vector<int32_t> C_CamMetTreeModel::m_AddRowsContinuousMode(const std::vector<C_CamMetTreeLoggerData> & orc_Data,
+                                                                const uint32_t ou32_Count)
 {
    std::vector<int32_t> c_Retval;
-   if (orc_Data.empty() == false)
-   {
-      //Columns which need to get updated on change of static message
-      const uint32_t u32_CompleteSize = static_cast<uint32_t>(this->mc_DataBase.size()) +
-                                        static_cast<uint32_t>(orc_Data.size());
-
-      //Check if only append case
-      if (u32_CompleteSize <= this->mu32_TraceBufferSizeUsed)
+   if (ou32_Count > 0UL)
+   {
+      const uint32_t u32_Capacity = this->mc_TraceStore.GetCapacity();
+      const uint32_t u32_NumNew = ou32_Count;
+      //If more messages than the capacity arrive, only the newest ones can be shown
+      const uint32_t u32_NumSkipped = (u32_NumNew > u32_Capacity) ? (u32_NumNew - u32_Capacity) : 0UL;
+      const uint32_t u32_NumAdded = u32_NumNew - u32_NumSkipped;
+      const uint32_t u32_NumFree = u32_Capacity - this->mc_TraceStore.GetNumInMemory();
+      const uint32_t u32_NumRemoved = (u32_NumAdded > u32_NumFree) ? (u32_NumAdded - u32_NumFree) : 0UL;
+      uint32_t u32_FirstNewRow;
+
+      //Drop oldest messages first, so the views only need to move their rows instead of a reset
+      if ((u32_NumRemoved > 0UL) && (this->mc_TraceStore.IsHistoryActive() == true))
       {
-         //Appending so notify model of insert action
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->beginInsertRows(QModelIndex(), this->rowCount(),
-                                  this->rowCount() + (static_cast<int32_t>(orc_Data.size()) - 1));
-         }
-         //Appending items in reserved space
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
-         {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            this->mc_DataBase.push_back(*c_ItData);
-            //Add tree item
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            this->mpc_RootItemContinuous->AddChild(pc_Item);
-         }
-         //Appending so notify model of insert action
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->endInsertRows();
-         }
-      }
-      //Check if we need to append any items to reach the max storage size
-      else if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
-      {
-         //Simple model reset notification (if replaced: look at two segments: adding new and queuing mechanism)
-         if (this->mq_UniqueMessageMode == false)
-         {
-            this->beginResetModel();
-         }
-         //One time code doing both parts
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         uint32_t u32_NumHistoryRemoved;
+
+         //The rows stay as part of the history, only their signals are gone
+         this->m_RemoveTraceChildren(u32_NumRemoved);
+         this->mc_TraceStore.RemoveOldest(u32_NumRemoved);
+
+         u32_NumHistoryRemoved = this->mc_TraceStore.GetNumHistoryOverLimit();
+         if (u32_NumHistoryRemoved > 0UL)
          {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            //1. insert until space is no longer available
-            if (this->mc_DataBase.size() < this->mu32_TraceBufferSizeUsed)
+            if (this->mq_UniqueMessageMode == false)
             {
-               //Append in reserved space
-               this->mc_DataBase.push_back(*c_ItData);
-               //Add tree item
-               this->mpc_RootItemContinuous->AddChild(pc_Item);
+               this->beginRemoveRows(QModelIndex(), 0, static_cast<int32_t>(u32_NumHistoryRemoved) - 1);
             }
-            //2. start replacing oldest ones
-            else
+            this->mc_TraceStore.RemoveHistoryOverLimit();
+            if (this->mq_UniqueMessageMode == false)
             {
-               //Shift item
-               this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-               //Replace tree item
-               delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-               this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
-               this->mpc_RootItemContinuous->AddChild(pc_Item);
-               //Iterate
-               ++this->mu32_OldestItemIndex;
-               this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
+               this->endRemoveRows();
+               this->m_HandleOldestRowsRemoved(static_cast<int32_t>(u32_NumHistoryRemoved));
             }
          }
-         //Simple model reset notification
-         if (this->mq_UniqueMessageMode == false)
-         {
-            //Every reset will clear the selection
-            this->SetSelection(-1, -1);
-            this->endResetModel();
-         }
       }
-      else
+      else if (u32_NumRemoved > 0UL)
       {
-         //Begin queue shift
          if (this->mq_UniqueMessageMode == false)
          {
-            //Use reset model to avoid console output, warning: does have negative side effects, but also faster
-            this->beginResetModel();
-            //this->beginRemoveRows(QModelIndex(), 0, orc_Data.size() - 1);
-            //this->beginInsertRows(QModelIndex(), this->rowCount() - (orc_Data.size() - 1), this->rowCount());
-         }
-         //Shift item in queue
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
-         {
-            C_TblTreSimpleItem * const pc_Item = new C_TblTreSimpleItem();
-            this->mc_DataBase[this->mu32_OldestItemIndex] = *c_ItData;
-            //Replace tree item
-            m_UpdateTreeItemBasedOnMessage(pc_Item, *c_ItData, false, -1);
-            delete (this->mpc_RootItemContinuous->c_Children[0UL]);
-            this->mpc_RootItemContinuous->c_Children.erase(this->mpc_RootItemContinuous->c_Children.begin());
-            this->mpc_RootItemContinuous->AddChild(pc_Item);
-            //Iterate
-            ++this->mu32_OldestItemIndex;
-            this->mu32_OldestItemIndex %= this->mu32_TraceBufferSizeUsed;
-         }
-         //End queue shift
+            this->beginRemoveRows(QModelIndex(), 0, static_cast<int32_t>(u32_NumRemoved) - 1);
+         }
+         this->mc_TraceStore.RemoveOldest(u32_NumRemoved);
          if (this->mq_UniqueMessageMode == false)
          {
-            //Every reset will clear the selection
-            this->SetSelection(-1, -1);
-            //Use reset model to avoid console output, warning: reset model does have negative side effects
-            this->endResetModel();
-            //this->endInsertRows();
-            //this->endRemoveRows();
+            this->endRemoveRows();
+            this->m_HandleOldestRowsRemoved(static_cast<int32_t>(u32_NumRemoved));
          }
       }
-      //Every time count the actual indices
+      else
+      {
+         //Enough free space
+      }
+
+      //Append in free space
+      u32_FirstNewRow = this->mc_TraceStore.GetSize();
       if (this->mq_UniqueMessageMode == false)
       {
-         int32_t s32_Start = static_cast<int32_t>(this->rowCount()) - (static_cast<int32_t>(orc_Data.size()) - 1);
-         c_Retval.reserve(orc_Data.size());
-         for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-              c_ItData != orc_Data.end(); ++c_ItData)
+         this->beginInsertRows(QModelIndex(), static_cast<int32_t>(u32_FirstNewRow),
+                               static_cast<int32_t>((u32_FirstNewRow + u32_NumAdded) - 1UL));
+      }
+      for (uint32_t u32_ItData = u32_NumSkipped; u32_ItData < u32_NumNew; ++u32_ItData)
+      {
+         this->mc_TraceStore.Append(orc_Data[u32_ItData], this->m_CreateTraceTreeItem(orc_Data[u32_ItData]));
+      }
+      if (this->mq_UniqueMessageMode == false)
+      {
+         this->endInsertRows();
+
+         //Every time count the actual indices
+         c_Retval.reserve(u32_NumAdded);
+         for (uint32_t u32_It = 0UL; u32_It < u32_NumAdded; ++u32_It)
          {
-            c_Retval.push_back(s32_Start);
-            ++s32_Start;
+            c_Retval.push_back(static_cast<int32_t>(u32_FirstNewRow + u32_It));
          }
       }
    }
    return c_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Create tree item for continuous trace message
+
+   Only messages with signals get a tree item, all others are leafs without any item.
+
+   \param[in]  orc_Message  New message
+
+   \return
+   NULL No tree item necessary
+   Else New tree item (ownership is handed over to the caller)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_MessageItem * C_CamMetTreeModel::m_CreateTraceTreeItem(
+   const C_CamMetTreeLoggerData & orc_Message)
+{
+   C_CamMetTreeTraceStore::C_MessageItem * pc_Retval = NULL;
+
+   if (orc_Message.c_Signals.empty() == false)
+   {
+      pc_Retval = new C_CamMetTreeTraceStore::C_MessageItem();
+      m_UpdateTreeItemBasedOnMessage(pc_Retval, orc_Message, false, -1);
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Adapt row based states after the oldest rows were removed from the continuous trace
+
+   \param[in]  os32_Count  Number of removed rows
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeModel::m_HandleOldestRowsRemoved(const int32_t os32_Count)
+{
+   if (this->ms32_SelectedParentRow >= os32_Count)
+   {
+      //Selected message is still there
+      this->ms32_SelectedParentRow -= os32_Count;
+   }
+   else if (this->ms32_SelectedParentRow >= 0)
+   {
+      this->SetSelection(-1, -1);
+   }
+   else
+   {
+      //No selection
+   }
+
+   if (this->ms32_LastSearchedMessageRow >= os32_Count)
+   {
+      this->ms32_LastSearchedMessageRow -= os32_Count;
+   }
+   else if (this->ms32_LastSearchedMessageRow >= 0)
+   {
+      this->m_ResetSearch();
+   }
+   else
+   {
+      //No active search
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove the signal rows of the oldest messages in memory before they are moved to the trace history
+
+   Only necessary if the tree is shown, the tree items get deleted by the trace store.
+
+   \param[in]  ou32_Count  Number of oldest messages in memory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeModel::m_RemoveTraceChildren(const uint32_t ou32_Count)
+{
+   if ((this->mq_UniqueMessageMode == false) && (this->mq_DisplayTree == true))
+   {
+      const uint32_t u32_FirstRow = this->mc_TraceStore.GetHistorySize();
+      for (uint32_t u32_It = 0UL; u32_It < ou32_Count; ++u32_It)
+      {
+         const int32_t s32_Row = static_cast<int32_t>(u32_FirstRow + u32_It);
+         C_TblTreSimpleItem * const pc_Item = this->mc_TraceStore.GetTreeItem(static_cast<uint32_t>(s32_Row));
+         if ((pc_Item != NULL) && (pc_Item->c_Children.size() > 0UL))
+         {
+            this->beginRemoveRows(this->index(s32_Row, 0), 0, static_cast<int32_t>(pc_Item->c_Children.size()) - 1);
+            pc_Item->ClearChildren();
+            this->endRemoveRows();
+            if (this->ms32_SelectedParentRow == s32_Row)
+            {
+               this->SetSelection(-1, -1);
+            }
+         }
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add specified strings as rows
 
    Only handle unique mode storage
 
    \param[in]  orc_Data    New row content
+   \param[in]  ou32_Count  Number of valid entries at the start of orc_Data
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_CamMetTreeModel::m_AddRowsUnique(const std::list<C_CamMetTreeLoggerData> & orc_Data)
+void C_CamMetTreeModel::m_AddRowsUnique(const std::vector<C_CamMetTreeLoggerData> & orc_Data,
+                                        const uint32_t ou32_Count)
 {
-   if (orc_Data.empty() == false)
+   if (ou32_Count > 0UL)
    {
       //Every time
-      for (std::list<C_CamMetTreeLoggerData>::const_iterator c_ItData = orc_Data.begin();
-           c_ItData != orc_Data.end(); ++c_ItData)
+      for (uint32_t u32_ItData = 0UL; u32_ItData < ou32_Count; ++u32_ItData)
       {
+         const C_CamMetTreeLoggerData & rc_Data = orc_Data[u32_ItData];
          const QMap<stw::scl::C_SclString,
                     C_CamMetTreeLoggerData>::const_iterator c_ItMessage = this->mc_UniqueMessages.find(
-            c_ItData->c_CanIdDec);
-         const int32_t s32_MuxValue = C_CamMetUtil::h_GetMultiplexerValue(c_ItData->c_Signals);
+            rc_Data.c_CanIdDec);
+         const int32_t s32_MuxValue = C_CamMetUtil::h_GetMultiplexerValue(rc_Data.c_Signals);
 
          //Check if there is a new row
          if (c_ItMessage != this->mc_UniqueMessages.end())
          {
-            this->m_HandleNewUniqueMessageForExistingUniqueMessage(*c_ItData, c_ItMessage.key(), s32_MuxValue);
+            this->m_HandleNewUniqueMessageForExistingUniqueMessage(rc_Data, c_ItMessage.key(), s32_MuxValue);
          }
          else
          {
-            this->m_HandleNewUniqueMessage(*c_ItData, s32_MuxValue);
+            this->m_HandleNewUniqueMessage(rc_Data, s32_MuxValue);
          }
       }
    }
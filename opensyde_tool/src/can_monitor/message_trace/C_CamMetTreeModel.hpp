@@ -22,6 +22,7 @@
 #include "C_SclString.hpp"
 #include "C_TblTreSimpleModel.hpp"
 #include "C_CamMetTreeLoggerData.hpp"
+#include "C_CamMetTreeTraceStore.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw
@@ -61,7 +62,7 @@ public:
 
    //Access
    void ActionClearData(void);
-   std::vector<int32_t> AddRows(const std::list<C_CamMetTreeLoggerData> & orc_Data);
+   std::vector<int32_t> AddRows(const std::vector<C_CamMetTreeLoggerData> & orc_Data, const uint32_t ou32_Count);
    void SetSelection(const int32_t os32_SelectedParentRow, const int32_t os32_SelectedChildIndex);
    void SetDisplayTree(const bool oq_Value);
    void SetDisplayUniqueMessages(const bool oq_Value);
@@ -72,8 +73,14 @@ public:
    bool GetDisplayTimestampRelative(void) const;
    bool GetDisplayTimestampAbsoluteTimeOfDay(void) const;
    void SetTraceBufferSize(const uint32_t ou32_Value);
+   void SetTraceHistory(const QString & orc_Directory, const uint64_t ou64_MaxBytes);
 
    std::vector<C_CamMetTreeLoggerData *> GetAllMessagesForProtocolChange(void);
+   uint32_t GetTraceMessageCount(void) const;
+   void GetTraceMessageForProtocolChange(const uint32_t ou32_Index,
+                                         stw::opensyde_core::C_OscComMessageLoggerData & orc_Message) const;
+   void SetTraceMessageProtocolText(const uint32_t ou32_Index,
+                                    const stw::opensyde_core::C_OscComMessageLoggerData & orc_Message);
    void SignalProtocolChange(void);
 
    QVariant headerData(const int32_t os32_Section, const Qt::Orientation oe_Orientation,
@@ -92,6 +99,9 @@ public:
    const C_CamMetTreeLoggerData * GetMessageData(const int32_t os32_Row) const;
    int32_t SearchMessageData(const QString & orc_SearchString, const bool oq_Next, int32_t & ors32_SignalRow,
                              int32_t & ors32_MultiplexedSignalRow);
+   int32_t SearchTimeStamp(const uint64_t ou64_TimeStamp) const;
+   int32_t SearchCanId(const int32_t os32_Row, const bool oq_Next) const;
+   static bool h_ParseTimeStamp(const QString & orc_Text, uint64_t & oru64_TimeStamp);
    uint32_t TranslateTreeRowsToSignalIndex(const QModelIndex & orc_CurrentIndex) const;
    uint32_t TranslateTreeRowsToSignalIndex(const int32_t os32_MessageIndex, const int32_t os32_SignalIndex,
                                            const int32_t os32_SignalIndexL2 = -1) const;
@@ -109,16 +119,14 @@ private:
    // communication
    QMap<stw::scl::C_SclString, C_CamMetTreeLoggerData> mc_UniqueMessages;
    QMap<stw::scl::C_SclString, stw::scl::C_SclString> mc_UniqueMessagesOrdering;
-   std::vector<C_CamMetTreeLoggerData> mc_DataBase;
+   C_CamMetTreeTraceStore mc_TraceStore;
    bool mq_DataUnlocked;
-   uint32_t mu32_OldestItemIndex;
    int32_t ms32_SelectedParentRow;
    std::set<uint16_t> mc_SelectedChildBytes;
    std::vector<QColor> mc_FontTransparcencyColors;
    QTimer mc_GrayOutTimer;
    bool mq_GrayOutPause;
    uint32_t mu32_GrayOutPauseTimeStamp;
-   C_TblTreSimpleItem * const mpc_RootItemContinuous;
    C_TblTreSimpleItem * const mpc_RootItemStatic;
    int32_t ms32_LastSearchedMessageRow;
    int32_t ms32_LastSearchedSignalRow;
@@ -136,8 +144,12 @@ private:
 
    void m_AdaptTraceBufferSize(void);
 
-   std::vector<int32_t> m_AddRowsContinuousMode(const std::list<C_CamMetTreeLoggerData> & orc_Data);
-   void m_AddRowsUnique(const std::list<C_CamMetTreeLoggerData> & orc_Data);
+   std::vector<int32_t> m_AddRowsContinuousMode(const std::vector<C_CamMetTreeLoggerData> & orc_Data,
+                                                const uint32_t ou32_Count);
+   C_CamMetTreeTraceStore::C_MessageItem * m_CreateTraceTreeItem(const C_CamMetTreeLoggerData & orc_Message);
+   void m_HandleOldestRowsRemoved(const int32_t os32_Count);
+   void m_RemoveTraceChildren(const uint32_t ou32_Count);
+   void m_AddRowsUnique(const std::vector<C_CamMetTreeLoggerData> & orc_Data, const uint32_t ou32_Count);
    void m_HandleNewUniqueMessageForExistingUniqueMessage(const C_CamMetTreeLoggerData & orc_Message,
                                                          const stw::scl::C_SclString & orc_ExistingMessageKey,
                                                          const int32_t os32_MultiplexerValue);
@@ -0,0 +1,571 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Disk based history of the continuous message trace
+
+   Takes over the messages dropped from the in-memory trace so long sessions can still be scrolled back.
+
+   The records are collected in chunks of hu32_CHUNK_SIZE messages.
+   As soon as a chunk is complete it is written to a file of its own in one go, so the receive path never waits for
+   small disk accesses. If the configured maximum size is exceeded the oldest chunk files are deleted.
+
+   For each chunk a small index is kept in memory:
+   - the maximum absolute time stamp of this and all older chunks, which allows a binary search for a time stamp
+   - the contained standard IDs (exact) and extended IDs (hashed), so a search for an ID only reads the chunks which
+     might contain it
+
+   Random access reads load a page of mhu32_PAGE_SIZE records, so scrolling through the history causes only a few
+   file accesses.
+
+   Only the raw frame, the time stamps, the counter and the string pool indices of name and state are kept;
+   signals and protocol interpretation of messages in the history are lost.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "stwerrors.hpp"
+#include "C_SclString.hpp"
+#include "C_CamMetTreeTraceHistory.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_CamMetTreeTraceHistory::hu32_CHUNK_SIZE = 65536U;
+const uint32_t C_CamMetTreeTraceHistory::mhu32_PAGE_SIZE = 1024U;
+// Keeps all row numbers of the trace in the range of int32
+const uint32_t C_CamMetTreeTraceHistory::mhu32_MAX_CHUNKS = 16384U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceHistory::C_Chunk::C_Chunk(void) :
+   u32_FileNumber(0U),
+   q_Valid(true),
+   u64_MaxTimeStamp(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+
+   The history is inactive until a file path is set.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceHistory::C_CamMetTreeTraceHistory(void) :
+   mu32_MaxChunks(1U),
+   mu32_NextFileNumber(0U),
+   mu32_PageFileNumber(0U),
+   mu32_PageStart(0U),
+   mq_PageValid(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+
+   Removes all history files.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceHistory::~C_CamMetTreeTraceHistory(void)
+{
+   this->Clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set location and maximum size of the history
+
+   All records are removed.
+
+   \param[in]  orc_FilePathBase  Path and start of the file names (a number and extension is added per file);
+                                 empty: history inactive
+   \param[in]  ou64_MaxBytes     Maximum size of all history files (at least one chunk is kept)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceHistory::SetFilePath(const std::string & orc_FilePathBase, const uint64_t ou64_MaxBytes)
+{
+   const uint64_t u64_ChunkBytes = static_cast<uint64_t>(hu32_CHUNK_SIZE) * sizeof(C_Record);
+   const uint64_t u64_MaxChunks = ou64_MaxBytes / u64_ChunkBytes;
+
+   this->Clear();
+   this->mc_FilePathBase = orc_FilePathBase;
+   this->mu32_MaxChunks = static_cast<uint32_t>(std::min(u64_MaxChunks, static_cast<uint64_t>(mhu32_MAX_CHUNKS)));
+   this->mu32_MaxChunks = std::max(this->mu32_MaxChunks, 1U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if records are kept
+
+   \retval   true    History is active
+   \retval   false   History is inactive, appended records are discarded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceHistory::IsActive(void) const
+{
+   return this->mc_FilePathBase.empty() == false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove all records and history files
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceHistory::Clear(void)
+{
+   for (std::deque<C_Chunk>::const_iterator c_It = this->mc_Chunks.begin(); c_It != this->mc_Chunks.end(); ++c_It)
+   {
+      if (c_It->q_Valid == true)
+      {
+         (void)std::remove(this->m_GetFilePath(c_It->u32_FileNumber).c_str());
+      }
+   }
+   this->mc_Chunks.clear();
+   std::vector<C_Record>().swap(this->mc_OpenChunk);
+   this->mc_OpenChunkIndex = C_Chunk();
+   std::vector<C_Record>().swap(this->mc_Page);
+   this->mq_PageValid = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add record as newest entry
+
+   Does nothing if the history is inactive.
+   If the maximum size is exceeded afterwards the user is responsible for calling RemoveRecordsOverLimit.
+
+   \param[in]  orc_Record  Record to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceHistory::Append(const C_Record & orc_Record)
+{
+   if (this->IsActive() == true)
+   {
+      if (this->mc_OpenChunk.empty() == true)
+      {
+         this->mc_OpenChunk.reserve(hu32_CHUNK_SIZE);
+         this->mc_OpenChunkIndex = C_Chunk();
+         if (this->mc_Chunks.empty() == false)
+         {
+            this->mc_OpenChunkIndex.u64_MaxTimeStamp = this->mc_Chunks.back().u64_MaxTimeStamp;
+         }
+      }
+      this->mc_OpenChunk.push_back(orc_Record);
+      C_CamMetTreeTraceHistory::mh_AddToIndex(orc_Record, this->mc_OpenChunkIndex);
+      if (this->mc_OpenChunk.size() >= hu32_CHUNK_SIZE)
+      {
+         this->m_WriteOpenChunk();
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of records
+
+   \return
+   Number of records
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceHistory::GetSize(void) const
+{
+   return (static_cast<uint32_t>(this->mc_Chunks.size()) * hu32_CHUNK_SIZE) +
+          static_cast<uint32_t>(this->mc_OpenChunk.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of oldest records which exceed the maximum size
+
+   \return
+   Number of records RemoveRecordsOverLimit would remove
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceHistory::GetNumRecordsOverLimit(void) const
+{
+   uint32_t u32_Retval = 0U;
+
+   if (this->mc_Chunks.size() > this->mu32_MaxChunks)
+   {
+      u32_Retval = (static_cast<uint32_t>(this->mc_Chunks.size()) - this->mu32_MaxChunks) * hu32_CHUNK_SIZE;
+   }
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove oldest chunks until the maximum size is met
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceHistory::RemoveRecordsOverLimit(void)
+{
+   while (this->mc_Chunks.size() > this->mu32_MaxChunks)
+   {
+      if (this->mc_Chunks.front().q_Valid == true)
+      {
+         (void)std::remove(this->m_GetFilePath(this->mc_Chunks.front().u32_FileNumber).c_str());
+      }
+      this->mc_Chunks.pop_front();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read record
+
+   \param[in]   ou32_Index    Record index (0 is the oldest record)
+   \param[out]  orc_Record    Read record
+
+   \return
+   C_NO_ERR   Record read
+   C_RANGE    Index out of range
+   C_RD_WR    Record is lost (history file could not be written or read)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeTraceHistory::GetRecord(const uint32_t ou32_Index, C_Record & orc_Record) const
+{
+   int32_t s32_Retval = C_NO_ERR;
+   const uint32_t u32_ChunkIndex = ou32_Index / hu32_CHUNK_SIZE;
+   const uint32_t u32_Offset = ou32_Index % hu32_CHUNK_SIZE;
+
+   if (u32_ChunkIndex < this->mc_Chunks.size())
+   {
+      const C_Chunk & rc_Chunk = this->mc_Chunks[u32_ChunkIndex];
+      const uint32_t u32_PageStart = u32_Offset - (u32_Offset % mhu32_PAGE_SIZE);
+      if (rc_Chunk.q_Valid == false)
+      {
+         s32_Retval = C_RD_WR;
+      }
+      else if (((this->mq_PageValid == false) || (this->mu32_PageFileNumber != rc_Chunk.u32_FileNumber)) ||
+               (this->mu32_PageStart != u32_PageStart))
+      {
+         const std::streamsize s64_Size = static_cast<std::streamsize>(mhu32_PAGE_SIZE * sizeof(C_Record));
+         std::ifstream c_File(this->m_GetFilePath(rc_Chunk.u32_FileNumber).c_str(), std::ios::in | std::ios::binary);
+
+         this->mc_Page.resize(mhu32_PAGE_SIZE);
+         c_File.seekg(static_cast<std::streamoff>(static_cast<uint64_t>(u32_PageStart) * sizeof(C_Record)));
+         //lint -e{9176}  Records are plain data written by this class
+         c_File.read(reinterpret_cast<char_t *>(&this->mc_Page[0]), s64_Size);
+         if ((c_File.good() == false) || (c_File.gcount() != s64_Size))
+         {
+            this->mq_PageValid = false;
+            s32_Retval = C_RD_WR;
+         }
+         else
+         {
+            this->mq_PageValid = true;
+            this->mu32_PageFileNumber = rc_Chunk.u32_FileNumber;
+            this->mu32_PageStart = u32_PageStart;
+         }
+      }
+      else
+      {
+         //Page already loaded
+      }
+      if (s32_Retval == C_NO_ERR)
+      {
+         orc_Record = this->mc_Page[u32_Offset - u32_PageStart];
+      }
+   }
+   else if ((u32_ChunkIndex == this->mc_Chunks.size()) && (u32_Offset < this->mc_OpenChunk.size()))
+   {
+      orc_Record = this->mc_OpenChunk[u32_Offset];
+   }
+   else
+   {
+      s32_Retval = C_RANGE;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search record with CAN ID
+
+   Only chunks which might contain the ID are read.
+
+   \param[in]   ou32_Start     Index of first record to check
+   \param[in]   ou32_CanId     CAN ID to search
+   \param[in]   ou8_Xtd        Extended ID flag of the searched ID
+   \param[in]   oq_Forward     Flag for search direction: true: towards newer records; false: towards older records
+   \param[out]  oru32_Index    Index of found record
+
+   \retval   true    Record found
+   \retval   false   No record found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceHistory::FindCanId(const uint32_t ou32_Start, const uint32_t ou32_CanId, const uint8_t ou8_Xtd,
+                                         const bool oq_Forward, uint32_t & oru32_Index) const
+{
+   bool q_Found = false;
+   const uint32_t u32_Size = this->GetSize();
+
+   if ((oq_Forward == true) && (ou32_Start < u32_Size))
+   {
+      const uint32_t u32_NumChunks = (u32_Size + (hu32_CHUNK_SIZE - 1U)) / hu32_CHUNK_SIZE;
+      for (uint32_t u32_Chunk = ou32_Start / hu32_CHUNK_SIZE; (u32_Chunk < u32_NumChunks) && (q_Found == false);
+           ++u32_Chunk)
+      {
+         if (C_CamMetTreeTraceHistory::mh_MightContain(this->m_GetChunk(u32_Chunk), ou32_CanId, ou8_Xtd) == true)
+         {
+            const uint32_t u32_ChunkStart = u32_Chunk * hu32_CHUNK_SIZE;
+            const uint32_t u32_From = std::max(ou32_Start, u32_ChunkStart) - u32_ChunkStart;
+            const uint32_t u32_To = std::min(u32_Size - u32_ChunkStart, hu32_CHUNK_SIZE);
+            q_Found = this->m_FindCanIdInChunk(u32_Chunk, u32_From, u32_To, ou32_CanId, ou8_Xtd, true, oru32_Index);
+         }
+      }
+   }
+   else if ((oq_Forward == false) && (u32_Size > 0U))
+   {
+      const uint32_t u32_Start = std::min(ou32_Start, u32_Size - 1U);
+      for (uint32_t u32_Chunk = (u32_Start / hu32_CHUNK_SIZE) + 1U; (u32_Chunk > 0U) && (q_Found == false);
+           --u32_Chunk)
+      {
+         const uint32_t u32_ChunkIndex = u32_Chunk - 1U;
+         if (C_CamMetTreeTraceHistory::mh_MightContain(this->m_GetChunk(u32_ChunkIndex), ou32_CanId,
+                                                       ou8_Xtd) == true)
+         {
+            const uint32_t u32_ChunkStart = u32_ChunkIndex * hu32_CHUNK_SIZE;
+            const uint32_t u32_To = std::min((u32_Start - u32_ChunkStart) + 1U, hu32_CHUNK_SIZE);
+            q_Found = this->m_FindCanIdInChunk(u32_ChunkIndex, 0U, u32_To, ou32_CanId, ou8_Xtd, false, oru32_Index);
+         }
+      }
+   }
+   else
+   {
+      //Nothing to search
+   }
+   return q_Found;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search first record at or after an absolute time stamp
+
+   \param[in]   ou64_TimeStampAbsoluteStart  Searched absolute time stamp (time since start)
+   \param[out]  oru32_Index                  Index of found record
+
+   \retval   true    Record found
+   \retval   false   All records are older
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceHistory::FindTimeStamp(const uint64_t ou64_TimeStampAbsoluteStart, uint32_t & oru32_Index) const
+{
+   bool q_Found = false;
+   const uint32_t u32_Size = this->GetSize();
+   const uint32_t u32_NumChunks = (u32_Size + (hu32_CHUNK_SIZE - 1U)) / hu32_CHUNK_SIZE;
+   uint32_t u32_Low = 0U;
+   uint32_t u32_High = u32_NumChunks;
+
+   //First chunk reaching the time stamp; the maximum time stamps are increasing over the chunks
+   while (u32_Low < u32_High)
+   {
+      const uint32_t u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->m_GetChunk(u32_Mid).u64_MaxTimeStamp < ou64_TimeStampAbsoluteStart)
+      {
+         u32_Low = u32_Mid + 1U;
+      }
+      else
+      {
+         u32_High = u32_Mid;
+      }
+   }
+
+   if (u32_Low < u32_NumChunks)
+   {
+      const uint32_t u32_ChunkStart = u32_Low * hu32_CHUNK_SIZE;
+      const uint32_t u32_ChunkEnd = std::min(u32_Size, u32_ChunkStart + hu32_CHUNK_SIZE);
+      C_Record c_Record;
+
+      for (uint32_t u32_It = u32_ChunkStart; (u32_It < u32_ChunkEnd) && (q_Found == false); ++u32_It)
+      {
+         if ((this->GetRecord(u32_It, c_Record) == C_NO_ERR) &&
+             (c_Record.u64_TimeStampAbsoluteStart >= ou64_TimeStampAbsoluteStart))
+         {
+            oru32_Index = u32_It;
+            q_Found = true;
+         }
+      }
+      if (q_Found == false)
+      {
+         //Records of chunk lost, best match is the start of the chunk
+         oru32_Index = u32_ChunkStart;
+         q_Found = true;
+      }
+   }
+   return q_Found;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get path of history file
+
+   \param[in]  ou32_FileNumber   Number of file
+
+   \return
+   File path
+*/
+//----------------------------------------------------------------------------------------------------------------------
+std::string C_CamMetTreeTraceHistory::m_GetFilePath(const uint32_t ou32_FileNumber) const
+{
+   return this->mc_FilePathBase + "_" + C_SclString::IntToStr(ou32_FileNumber).c_str() + ".tmp";
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write complete open chunk to a new file and start a new chunk
+
+   If writing fails the records of the chunk are lost but the chunk is kept, so the record indices stay valid.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceHistory::m_WriteOpenChunk(void)
+{
+   const std::string c_FilePath = this->m_GetFilePath(this->mu32_NextFileNumber);
+   std::ofstream c_File;
+
+   c_File.open(c_FilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+   //lint -e{9176}  Records are plain data only read by this class
+   c_File.write(reinterpret_cast<const char_t *>(&this->mc_OpenChunk[0]),
+                static_cast<std::streamsize>(this->mc_OpenChunk.size() * sizeof(C_Record)));
+   c_File.close();
+
+   this->mc_OpenChunkIndex.u32_FileNumber = this->mu32_NextFileNumber;
+   this->mc_OpenChunkIndex.q_Valid = (c_File.fail() == false);
+   if (this->mc_OpenChunkIndex.q_Valid == false)
+   {
+      (void)std::remove(c_FilePath.c_str());
+   }
+   ++this->mu32_NextFileNumber;
+   this->mc_Chunks.push_back(this->mc_OpenChunkIndex);
+   this->mc_OpenChunk.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get index of chunk
+
+   \param[in]  ou32_ChunkIndex   Chunk index; the number of written chunks refers to the open chunk
+
+   \return
+   Chunk index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_CamMetTreeTraceHistory::C_Chunk & C_CamMetTreeTraceHistory::m_GetChunk(const uint32_t ou32_ChunkIndex) const
+{
+   const C_Chunk * pc_Retval = &this->mc_OpenChunkIndex;
+
+   if (ou32_ChunkIndex < this->mc_Chunks.size())
+   {
+      pc_Retval = &this->mc_Chunks[ou32_ChunkIndex];
+   }
+   return *pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search record with CAN ID in part of a chunk
+
+   \param[in]   ou32_ChunkIndex   Chunk index
+   \param[in]   ou32_From         First offset in chunk to check
+   \param[in]   ou32_To           Offset in chunk after last one to check
+   \param[in]   ou32_CanId        CAN ID to search
+   \param[in]   ou8_Xtd           Extended ID flag of the searched ID
+   \param[in]   oq_Forward        Flag for search direction
+   \param[out]  oru32_Index       Index of found record
+
+   \retval   true    Record found
+   \retval   false   No record found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceHistory::m_FindCanIdInChunk(const uint32_t ou32_ChunkIndex, const uint32_t ou32_From,
+                                                  const uint32_t ou32_To, const uint32_t ou32_CanId,
+                                                  const uint8_t ou8_Xtd, const bool oq_Forward,
+                                                  uint32_t & oru32_Index) const
+{
+   bool q_Found = false;
+   const uint32_t u32_ChunkStart = ou32_ChunkIndex * hu32_CHUNK_SIZE;
+   C_Record c_Record;
+
+   for (uint32_t u32_It = 0U; (u32_It < (ou32_To - ou32_From)) && (q_Found == false); ++u32_It)
+   {
+      const uint32_t u32_Offset = (oq_Forward == true) ? (ou32_From + u32_It) : ((ou32_To - 1U) - u32_It);
+      const uint32_t u32_Index = u32_ChunkStart + u32_Offset;
+      if ((this->GetRecord(u32_Index, c_Record) == C_NO_ERR) && (c_Record.c_CanMsg.u32_ID == ou32_CanId) &&
+          ((c_Record.c_CanMsg.u8_XTD > 0U) == (ou8_Xtd > 0U)))
+      {
+         oru32_Index = u32_Index;
+         q_Found = true;
+      }
+   }
+   return q_Found;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Register record in chunk index
+
+   \param[in]      orc_Record  Added record
+   \param[in,out]  orc_Chunk   Index of chunk containing the record
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceHistory::mh_AddToIndex(const C_Record & orc_Record, C_Chunk & orc_Chunk)
+{
+   orc_Chunk.u64_MaxTimeStamp = std::max(orc_Chunk.u64_MaxTimeStamp, orc_Record.u64_TimeStampAbsoluteStart);
+   if (orc_Record.c_CanMsg.u8_XTD > 0U)
+   {
+      orc_Chunk.c_ExtendedIds.set(C_CamMetTreeTraceHistory::mh_HashExtendedId(orc_Record.c_CanMsg.u32_ID));
+   }
+   else
+   {
+      orc_Chunk.c_StandardIds.set(orc_Record.c_CanMsg.u32_ID & 0x7FFU);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check chunk index for CAN ID
+
+   \param[in]  orc_Chunk   Chunk index
+   \param[in]  ou32_CanId  CAN ID
+   \param[in]  ou8_Xtd     Extended ID flag
+
+   \retval   true    Chunk might contain a record with the ID
+   \retval   false   Chunk does not contain a record with the ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceHistory::mh_MightContain(const C_Chunk & orc_Chunk, const uint32_t ou32_CanId,
+                                               const uint8_t ou8_Xtd)
+{
+   bool q_Retval;
+
+   if (ou8_Xtd > 0U)
+   {
+      q_Retval = orc_Chunk.c_ExtendedIds.test(C_CamMetTreeTraceHistory::mh_HashExtendedId(ou32_CanId));
+   }
+   else
+   {
+      q_Retval = (ou32_CanId <= 0x7FFU) && orc_Chunk.c_StandardIds.test(ou32_CanId);
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get bit of extended ID in chunk index
+
+   \param[in]  ou32_CanId  Extended CAN ID
+
+   \return
+   Bit index (0 .. 4095)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceHistory::mh_HashExtendedId(const uint32_t ou32_CanId)
+{
+   //Multiplicative hashing; the upper bits mix all bits of the ID
+   return (ou32_CanId * 2654435761U) >> 20U;
+}
@@ -0,0 +1,116 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Disk based history of the continuous message trace (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CAMMETTREETRACEHISTORY_HPP
+#define C_CAMMETTREETRACEHISTORY_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <bitset>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "stw_can.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CamMetTreeTraceHistory
+{
+public:
+   ///Compact trace entry; used in memory and in the history files
+   class C_Record
+   {
+   public:
+      stw::can::T_STWCAN_Msg_RX c_CanMsg;
+      uint64_t u64_TimeStampRelative;
+      uint64_t u64_TimeStampAbsoluteStart;
+      uint64_t u64_TimeStampAbsoluteTimeOfDay;
+      uint32_t u32_Counter;
+      uint32_t u32_NameIndex;   ///< Index in string pool of the trace store
+      uint32_t u32_StatusIndex; ///< Index in string pool of the trace store
+      bool q_IsTx;
+      bool q_CanDlcError;
+   };
+
+   C_CamMetTreeTraceHistory(void);
+   ~C_CamMetTreeTraceHistory(void);
+
+   void SetFilePath(const std::string & orc_FilePathBase, const uint64_t ou64_MaxBytes);
+   bool IsActive(void) const;
+   void Clear(void);
+   void Append(const C_Record & orc_Record);
+   uint32_t GetSize(void) const;
+   uint32_t GetNumRecordsOverLimit(void) const;
+   void RemoveRecordsOverLimit(void);
+   int32_t GetRecord(const uint32_t ou32_Index, C_Record & orc_Record) const;
+   bool FindCanId(const uint32_t ou32_Start, const uint32_t ou32_CanId, const uint8_t ou8_Xtd, const bool oq_Forward,
+                  uint32_t & oru32_Index) const;
+   bool FindTimeStamp(const uint64_t ou64_TimeStampAbsoluteStart, uint32_t & oru32_Index) const;
+
+   static const uint32_t hu32_CHUNK_SIZE; ///< Number of records per file
+
+private:
+   ///Index of one chunk of records
+   class C_Chunk
+   {
+   public:
+      C_Chunk(void);
+
+      uint32_t u32_FileNumber;
+      bool q_Valid;              ///< False if writing the file failed
+      uint64_t u64_MaxTimeStamp; ///< Maximum absolute time stamp of this and all older chunks
+      std::bitset<2048> c_StandardIds;
+      std::bitset<4096> c_ExtendedIds; ///< Hashed; a set bit only tells the ID might be contained
+   };
+
+   std::string mc_FilePathBase; ///< Empty: history inactive
+   uint32_t mu32_MaxChunks;
+   uint32_t mu32_NextFileNumber;
+   std::deque<C_Chunk> mc_Chunks;      ///< Chunks stored in files, oldest first
+   std::vector<C_Record> mc_OpenChunk; ///< Newest records; written to a file as soon as the chunk is complete
+   C_Chunk mc_OpenChunkIndex;
+
+   //Last read file section
+   mutable std::vector<C_Record> mc_Page;
+   mutable uint32_t mu32_PageFileNumber;
+   mutable uint32_t mu32_PageStart;
+   mutable bool mq_PageValid;
+
+   static const uint32_t mhu32_PAGE_SIZE;
+   static const uint32_t mhu32_MAX_CHUNKS;
+
+   //Avoid call
+   C_CamMetTreeTraceHistory(const C_CamMetTreeTraceHistory &);
+   C_CamMetTreeTraceHistory & operator =(const C_CamMetTreeTraceHistory &) &;
+
+   std::string m_GetFilePath(const uint32_t ou32_FileNumber) const;
+   void m_WriteOpenChunk(void);
+   const C_Chunk & m_GetChunk(const uint32_t ou32_ChunkIndex) const;
+   bool m_FindCanIdInChunk(const uint32_t ou32_ChunkIndex, const uint32_t ou32_From, const uint32_t ou32_To,
+                           const uint32_t ou32_CanId, const uint8_t ou8_Xtd, const bool oq_Forward,
+                           uint32_t & oru32_Index) const;
+   static void mh_AddToIndex(const C_Record & orc_Record, C_Chunk & orc_Chunk);
+   static bool mh_MightContain(const C_Chunk & orc_Chunk, const uint32_t ou32_CanId, const uint8_t ou8_Xtd);
+   static uint32_t mh_HashExtendedId(const uint32_t ou32_CanId);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -0,0 +1,773 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Ring buffer storage of the continuous message trace (implementation)
+
+   Holds the messages of the continuous trace in a fixed size ring:
+   adding a message and dropping the oldest one are constant time operations independent of the trace size.
+
+   Each message is stored as raw CAN frame with its numeric timestamps and counter.
+   Message names and states are shared via a string pool.
+   Protocol texts, signals and tree items only get allocated for messages which were interpreted.
+   The display strings are formatted on demand when a row is requested and kept in a small cache,
+   so only the rows which are actually shown (or copied, searched) pay for formatting.
+
+   Rows are identified by a sequence number which increases with each added message.
+   So cached rows and tree items never get mixed up when the ring wraps around.
+
+   If a history is set, messages dropped from the ring are moved to the disk based C_CamMetTreeTraceHistory
+   instead of being discarded. Message indices then cover the history first and the messages in memory afterwards.
+   Messages in the history keep their raw data, time stamps, counter, name and state only.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "stwtypes.hpp"
+#include "stwerrors.hpp"
+#include "C_CamMetTreeTraceStore.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::scl;
+using namespace stw::can;
+using namespace stw::opensyde_core;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+// Number of formatted rows kept; needs to cover at least all visible rows
+const uint32_t C_CamMetTreeTraceStore::mhu32_CACHE_SIZE = 512U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_MessageItem::C_MessageItem(void) :
+   C_TblTreSimpleItem(),
+   u64_Sequence(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_Detail::C_Detail(void) :
+   pc_TreeItem(NULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+
+   Clean up.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_Detail::~C_Detail(void)
+{
+   delete this->pc_TreeItem;
+   this->pc_TreeItem = NULL;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_CacheEntry::C_CacheEntry(void) :
+   q_Valid(false),
+   u64_Sequence(0ULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_CamMetTreeTraceStore(void) :
+   mu32_Capacity(1U),
+   mu32_Oldest(0U),
+   mu32_Size(0U),
+   mu64_FirstSequence(0ULL)
+{
+   //Index 0 is always the empty string
+   this->mc_Strings.push_back("");
+   this->mc_Cache.resize(mhu32_CACHE_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+
+   Clean up.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::~C_CamMetTreeTraceStore(void)
+{
+   this->m_RemoveOldest(this->mu32_Size, false);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set maximum number of messages
+
+   All messages are removed.
+
+   \param[in]  ou32_Capacity  Maximum number of messages (at least 1)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::SetCapacity(const uint32_t ou32_Capacity)
+{
+   this->Clear();
+   this->mu32_Capacity = (ou32_Capacity > 0U) ? ou32_Capacity : 1U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get maximum number of messages
+
+   \return
+   Maximum number of messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::GetCapacity(void) const
+{
+   return this->mu32_Capacity;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set disk based history for messages dropped from memory
+
+   All messages are removed.
+
+   \param[in]  orc_FilePathBase  Path and start of the file names of the history; empty: no history
+   \param[in]  ou64_MaxBytes     Maximum size of the history files
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::SetHistory(const std::string & orc_FilePathBase, const uint64_t ou64_MaxBytes)
+{
+   this->Clear();
+   this->mc_History.SetFilePath(orc_FilePathBase, ou64_MaxBytes);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if dropped messages are kept in the history
+
+   \retval   true    History active
+   \retval   false   Dropped messages are discarded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceStore::IsHistoryActive(void) const
+{
+   return this->mc_History.IsActive();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of stored messages
+
+   \return
+   Number of stored messages in history and memory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::GetSize(void) const
+{
+   return this->mc_History.GetSize() + this->mu32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of messages in the history
+
+   \return
+   Number of messages in the history (index of the oldest message in memory)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::GetHistorySize(void) const
+{
+   return this->mc_History.GetSize();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of messages in memory
+
+   \return
+   Number of messages in memory (at most the capacity)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::GetNumInMemory(void) const
+{
+   return this->mu32_Size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove all messages and release the storage
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::Clear(void)
+{
+   this->m_RemoveOldest(this->mu32_Size, false);
+   this->mc_History.Clear();
+   std::vector<C_Frame>().swap(this->mc_Frames);
+   this->mu32_Oldest = 0U;
+   this->mc_Strings.resize(1U);
+   this->mc_StringIndices.clear();
+   this->m_InvalidateCache();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add message as newest entry
+
+   If the store is full the oldest message is dropped (or moved to the history) first.
+
+   \param[in]      orc_Message   Message to store
+   \param[in,out]  opc_TreeItem  Optional tree item of the message (ownership is taken over)
+
+   \retval   true    Oldest message was dropped from memory
+   \retval   false   No message was dropped from memory
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_CamMetTreeTraceStore::Append(const C_CamMetTreeLoggerData & orc_Message, C_MessageItem * const opc_TreeItem)
+{
+   bool q_Dropped = false;
+   uint32_t u32_Position;
+   C_Frame c_Frame;
+
+   if (this->mu32_Size >= this->mu32_Capacity)
+   {
+      this->RemoveOldest(1U);
+      q_Dropped = true;
+   }
+
+   c_Frame.c_Record.c_CanMsg = orc_Message.c_CanMsg;
+   c_Frame.c_Record.u64_TimeStampRelative = orc_Message.u64_TimeStampRelative;
+   c_Frame.c_Record.u64_TimeStampAbsoluteStart = orc_Message.u64_TimeStampAbsoluteStart;
+   c_Frame.c_Record.u64_TimeStampAbsoluteTimeOfDay = orc_Message.u64_TimeStampAbsoluteTimeOfDay;
+   //The logger always provides the counter as decimal number
+   c_Frame.c_Record.u32_Counter = static_cast<uint32_t>(std::strtoul(orc_Message.c_Counter.c_str(), NULL, 10));
+   c_Frame.c_Record.u32_NameIndex = this->m_GetStringIndex(orc_Message.c_Name);
+   c_Frame.c_Record.u32_StatusIndex = this->m_GetStringIndex(orc_Message.c_Status);
+   c_Frame.c_Record.q_IsTx = orc_Message.q_IsTx;
+   c_Frame.c_Record.q_CanDlcError = orc_Message.q_CanDlcError;
+   c_Frame.pc_Detail = NULL;
+   if (((orc_Message.c_ProtocolTextHex != "") || (orc_Message.c_ProtocolTextDec != "")) ||
+       ((orc_Message.c_Signals.empty() == false) || (opc_TreeItem != NULL)))
+   {
+      c_Frame.pc_Detail = new C_Detail();
+      c_Frame.pc_Detail->c_ProtocolTextHex = orc_Message.c_ProtocolTextHex;
+      c_Frame.pc_Detail->c_ProtocolTextDec = orc_Message.c_ProtocolTextDec;
+      c_Frame.pc_Detail->c_Signals = orc_Message.c_Signals;
+      c_Frame.pc_Detail->pc_TreeItem = opc_TreeItem;
+      if (opc_TreeItem != NULL)
+      {
+         opc_TreeItem->u64_Sequence = this->mu64_FirstSequence + this->mu32_Size;
+      }
+   }
+
+   //The ring only grows at its end until the capacity is reached
+   u32_Position = (this->mu32_Oldest + this->mu32_Size) % this->mu32_Capacity;
+   if (u32_Position < this->mc_Frames.size())
+   {
+      this->mc_Frames[u32_Position] = c_Frame;
+   }
+   else
+   {
+      this->mc_Frames.push_back(c_Frame);
+   }
+   ++this->mu32_Size;
+   return q_Dropped;
+} //lint !e429  no memory leak because the detail is owned by the frame
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop oldest messages from memory
+
+   If the history is active the messages are moved to the history.
+   Their interpretation results and tree items are released in any case.
+
+   \param[in]  ou32_Count  Number of messages to drop (limited to the number of messages in memory)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::RemoveOldest(const uint32_t ou32_Count)
+{
+   this->m_RemoveOldest(ou32_Count, true);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of oldest history messages which exceed the maximum history size
+
+   \return
+   Number of messages RemoveHistoryOverLimit would remove
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::GetNumHistoryOverLimit(void) const
+{
+   return this->mc_History.GetNumRecordsOverLimit();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove oldest history messages until the maximum history size is met
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::RemoveHistoryOverLimit(void)
+{
+   this->mc_History.RemoveRecordsOverLimit();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get formatted message
+
+   The returned message stays valid until the store is changed
+   or a lot of other messages were requested in between.
+   Do not keep it, copy it if necessary.
+
+   \param[in]  ou32_Index  Message index (0 is the oldest message)
+
+   \return
+   NULL Message not found or lost from history
+   Else Valid message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_CamMetTreeLoggerData * C_CamMetTreeTraceStore::GetMessage(const uint32_t ou32_Index) const
+{
+   const C_CamMetTreeLoggerData * pc_Retval = NULL;
+   const uint32_t u32_HistorySize = this->mc_History.GetSize();
+
+   if (ou32_Index < (u32_HistorySize + this->mu32_Size))
+   {
+      //History messages continue the sequence numbers backwards
+      const uint64_t u64_Sequence = (this->mu64_FirstSequence - u32_HistorySize) + ou32_Index;
+      C_CacheEntry & rc_Entry = this->mc_Cache[static_cast<uint32_t>(u64_Sequence % mhu32_CACHE_SIZE)];
+      if ((rc_Entry.q_Valid == true) && (rc_Entry.u64_Sequence == u64_Sequence))
+      {
+         pc_Retval = &rc_Entry.c_Message;
+      }
+      else if (ou32_Index >= u32_HistorySize)
+      {
+         const C_Frame & rc_Frame = this->mc_Frames[this->m_GetPosition(ou32_Index - u32_HistorySize)];
+         this->m_FillMessage(rc_Frame.c_Record, rc_Frame.pc_Detail, rc_Entry.c_Message);
+         rc_Entry.u64_Sequence = u64_Sequence;
+         rc_Entry.q_Valid = true;
+         pc_Retval = &rc_Entry.c_Message;
+      }
+      else
+      {
+         C_CamMetTreeTraceHistory::C_Record c_Record;
+         if (this->mc_History.GetRecord(ou32_Index, c_Record) == C_NO_ERR)
+         {
+            this->m_FillMessage(c_Record, NULL, rc_Entry.c_Message);
+            rc_Entry.u64_Sequence = u64_Sequence;
+            rc_Entry.q_Valid = true;
+            pc_Retval = &rc_Entry.c_Message;
+         }
+      }
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get tree item of message
+
+   \param[in]  ou32_Index  Message index (0 is the oldest message)
+
+   \return
+   NULL Message not found or message has no tree item (e.g. message in history)
+   Else Valid tree item
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_CamMetTreeTraceStore::C_MessageItem * C_CamMetTreeTraceStore::GetTreeItem(const uint32_t ou32_Index) const
+{
+   C_MessageItem * pc_Retval = NULL;
+   const uint32_t u32_HistorySize = this->mc_History.GetSize();
+
+   if ((ou32_Index >= u32_HistorySize) && ((ou32_Index - u32_HistorySize) < this->mu32_Size))
+   {
+      const C_Detail * const pc_Detail =
+         this->mc_Frames[this->m_GetPosition(ou32_Index - u32_HistorySize)].pc_Detail;
+      if (pc_Detail != NULL)
+      {
+         pc_Retval = pc_Detail->pc_TreeItem;
+      }
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get current message index of tree item
+
+   \param[in]  opc_Item  Tree item handed over by Append
+
+   \return
+   -1   Item not found
+   Else Message index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeTraceStore::GetIndexOfTreeItem(const C_TblTreSimpleItem * const opc_Item) const
+{
+   int32_t s32_Retval = -1;
+
+   if (opc_Item != NULL)
+   {
+      //lint -e{9079,1939}  Only items of type C_MessageItem are handed over to this class
+      const C_MessageItem * const pc_Item = static_cast<const C_MessageItem *>(opc_Item);
+      if ((pc_Item->u64_Sequence >= this->mu64_FirstSequence) &&
+          (pc_Item->u64_Sequence < (this->mu64_FirstSequence + this->mu32_Size)))
+      {
+         s32_Retval = static_cast<int32_t>((pc_Item->u64_Sequence - this->mu64_FirstSequence) +
+                                           this->mc_History.GetSize());
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get message parts relevant for updating the protocol text
+
+   Only the CAN message, the name and the protocol texts are set.
+   Only supported for messages in memory.
+
+   \param[in]   ou32_Index    Message index (0 is the oldest message)
+   \param[out]  orc_Message   Message parts
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::GetProtocolData(const uint32_t ou32_Index, C_OscComMessageLoggerData & orc_Message) const
+{
+   const uint32_t u32_HistorySize = this->mc_History.GetSize();
+
+   if ((ou32_Index >= u32_HistorySize) && ((ou32_Index - u32_HistorySize) < this->mu32_Size))
+   {
+      const C_Frame & rc_Frame = this->mc_Frames[this->m_GetPosition(ou32_Index - u32_HistorySize)];
+      orc_Message.c_CanMsg = rc_Frame.c_Record.c_CanMsg;
+      orc_Message.c_Name = this->mc_Strings[rc_Frame.c_Record.u32_NameIndex];
+      if (rc_Frame.pc_Detail != NULL)
+      {
+         orc_Message.c_ProtocolTextHex = rc_Frame.pc_Detail->c_ProtocolTextHex;
+         orc_Message.c_ProtocolTextDec = rc_Frame.pc_Detail->c_ProtocolTextDec;
+      }
+      else
+      {
+         orc_Message.c_ProtocolTextHex = "";
+         orc_Message.c_ProtocolTextDec = "";
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Replace protocol text of message
+
+   Only supported for messages in memory.
+
+   \param[in]  ou32_Index           Message index (0 is the oldest message)
+   \param[in]  orc_ProtocolTextHex  New protocol text in hexadecimal style
+   \param[in]  orc_ProtocolTextDec  New protocol text in decimal style
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::SetProtocolText(const uint32_t ou32_Index, const C_SclString & orc_ProtocolTextHex,
+                                             const C_SclString & orc_ProtocolTextDec)
+{
+   const uint32_t u32_HistorySize = this->mc_History.GetSize();
+
+   if ((ou32_Index >= u32_HistorySize) && ((ou32_Index - u32_HistorySize) < this->mu32_Size))
+   {
+      const uint64_t u64_Sequence = this->mu64_FirstSequence + (ou32_Index - u32_HistorySize);
+      C_Frame & rc_Frame = this->mc_Frames[this->m_GetPosition(ou32_Index - u32_HistorySize)];
+      if ((rc_Frame.pc_Detail == NULL) && ((orc_ProtocolTextHex != "") || (orc_ProtocolTextDec != "")))
+      {
+         rc_Frame.pc_Detail = new C_Detail();
+      }
+      if (rc_Frame.pc_Detail != NULL)
+      {
+         rc_Frame.pc_Detail->c_ProtocolTextHex = orc_ProtocolTextHex;
+         rc_Frame.pc_Detail->c_ProtocolTextDec = orc_ProtocolTextDec;
+      }
+      this->mc_Cache[static_cast<uint32_t>(u64_Sequence % mhu32_CACHE_SIZE)].q_Valid = false;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search message with CAN ID
+
+   The history is searched with the help of its chunk indices, the messages in memory are checked one by one.
+
+   \param[in]  ou32_Start   Index of first message to check
+   \param[in]  ou32_CanId   CAN ID to search
+   \param[in]  ou8_Xtd      Extended ID flag of the searched ID
+   \param[in]  oq_Forward   Flag for search direction: true: towards newer messages; false: towards older messages
+
+   \return
+   -1   No message found
+   Else Index of found message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeTraceStore::FindCanId(const uint32_t ou32_Start, const uint32_t ou32_CanId, const uint8_t ou8_Xtd,
+                                          const bool oq_Forward) const
+{
+   int32_t s32_Retval = -1;
+   const uint32_t u32_HistorySize = this->mc_History.GetSize();
+   uint32_t u32_Found;
+
+   if (oq_Forward == true)
+   {
+      if (this->mc_History.FindCanId(ou32_Start, ou32_CanId, ou8_Xtd, true, u32_Found) == true)
+      {
+         s32_Retval = static_cast<int32_t>(u32_Found);
+      }
+      else
+      {
+         const uint32_t u32_First = (ou32_Start > u32_HistorySize) ? (ou32_Start - u32_HistorySize) : 0U;
+         for (uint32_t u32_It = u32_First; (u32_It < this->mu32_Size) && (s32_Retval < 0); ++u32_It)
+         {
+            const T_STWCAN_Msg_RX & rc_Msg = this->mc_Frames[this->m_GetPosition(u32_It)].c_Record.c_CanMsg;
+            if ((rc_Msg.u32_ID == ou32_CanId) && ((rc_Msg.u8_XTD > 0U) == (ou8_Xtd > 0U)))
+            {
+               s32_Retval = static_cast<int32_t>(u32_HistorySize + u32_It);
+            }
+         }
+      }
+   }
+   else
+   {
+      if ((ou32_Start >= u32_HistorySize) && (this->mu32_Size > 0U))
+      {
+         const uint32_t u32_Last = std::min(ou32_Start - u32_HistorySize, this->mu32_Size - 1U);
+         for (uint32_t u32_It = u32_Last + 1U; (u32_It > 0U) && (s32_Retval < 0); --u32_It)
+         {
+            const T_STWCAN_Msg_RX & rc_Msg = this->mc_Frames[this->m_GetPosition(u32_It - 1U)].c_Record.c_CanMsg;
+            if ((rc_Msg.u32_ID == ou32_CanId) && ((rc_Msg.u8_XTD > 0U) == (ou8_Xtd > 0U)))
+            {
+               s32_Retval = static_cast<int32_t>((u32_HistorySize + u32_It) - 1U);
+            }
+         }
+      }
+      if ((s32_Retval < 0) &&
+          (this->mc_History.FindCanId(ou32_Start, ou32_CanId, ou8_Xtd, false, u32_Found) == true))
+      {
+         s32_Retval = static_cast<int32_t>(u32_Found);
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Search first message at or after an absolute time stamp
+
+   \param[in]  ou64_TimeStampAbsoluteStart  Searched absolute time stamp (time since start)
+
+   \return
+   -1   All messages are older
+   Else Index of found message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeTraceStore::FindTimeStamp(const uint64_t ou64_TimeStampAbsoluteStart) const
+{
+   int32_t s32_Retval = -1;
+   uint32_t u32_Found;
+
+   if (this->mc_History.FindTimeStamp(ou64_TimeStampAbsoluteStart, u32_Found) == true)
+   {
+      s32_Retval = static_cast<int32_t>(u32_Found);
+   }
+   else
+   {
+      for (uint32_t u32_It = 0U; (u32_It < this->mu32_Size) && (s32_Retval < 0); ++u32_It)
+      {
+         if (this->mc_Frames[this->m_GetPosition(u32_It)].c_Record.u64_TimeStampAbsoluteStart >=
+             ou64_TimeStampAbsoluteStart)
+         {
+            s32_Retval = static_cast<int32_t>(this->mc_History.GetSize() + u32_It);
+         }
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop oldest messages from memory
+
+   \param[in]  ou32_Count         Number of messages to drop (limited to the number of messages in memory)
+   \param[in]  oq_KeepInHistory   Flag to move the messages to the history (if active)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::m_RemoveOldest(const uint32_t ou32_Count, const bool oq_KeepInHistory)
+{
+   const uint32_t u32_Count = (ou32_Count < this->mu32_Size) ? ou32_Count : this->mu32_Size;
+
+   for (uint32_t u32_It = 0U; u32_It < u32_Count; ++u32_It)
+   {
+      C_Frame & rc_Frame = this->mc_Frames[this->mu32_Oldest];
+      if (oq_KeepInHistory == true)
+      {
+         this->mc_History.Append(rc_Frame.c_Record);
+         if (rc_Frame.pc_Detail != NULL)
+         {
+            //Formatted row still contains the interpretation results
+            const uint64_t u64_Sequence = this->mu64_FirstSequence + u32_It;
+            this->mc_Cache[static_cast<uint32_t>(u64_Sequence % mhu32_CACHE_SIZE)].q_Valid = false;
+         }
+      }
+      delete rc_Frame.pc_Detail;
+      rc_Frame.pc_Detail = NULL;
+      this->mu32_Oldest = (this->mu32_Oldest + 1U) % this->mu32_Capacity;
+   }
+   this->mu32_Size -= u32_Count;
+   this->mu64_FirstSequence += u32_Count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get storage position of message
+
+   \param[in]  ou32_Index  Index of message in memory (0 is the oldest message in memory)
+
+   \return
+   Position in ring storage
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::m_GetPosition(const uint32_t ou32_Index) const
+{
+   return (this->mu32_Oldest + ou32_Index) % this->mu32_Capacity;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get pool index of string
+
+   The string is added to the pool if necessary.
+   Only used for names and states which repeat for each message of the same type.
+
+   \param[in]  orc_String  String to look up
+
+   \return
+   Index in string pool
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_CamMetTreeTraceStore::m_GetStringIndex(const C_SclString & orc_String)
+{
+   uint32_t u32_Retval = 0U;
+
+   if (orc_String != "")
+   {
+      const std::map<C_SclString, uint32_t>::const_iterator c_It = this->mc_StringIndices.find(orc_String);
+      if (c_It != this->mc_StringIndices.end())
+      {
+         u32_Retval = c_It->second;
+      }
+      else
+      {
+         u32_Retval = static_cast<uint32_t>(this->mc_Strings.size());
+         this->mc_Strings.push_back(orc_String);
+         this->mc_StringIndices[orc_String] = u32_Retval;
+      }
+   }
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Drop all formatted messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::m_InvalidateCache(void) const
+{
+   for (uint32_t u32_It = 0U; u32_It < this->mc_Cache.size(); ++u32_It)
+   {
+      C_CacheEntry & rc_Entry = this->mc_Cache[u32_It];
+      rc_Entry.q_Valid = false;
+      //Release memory of signals
+      rc_Entry.c_Message.c_Signals.clear();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Format message from compact entry
+
+   \param[in]   orc_Record    Stored entry
+   \param[in]   opc_Detail    Interpretation results of entry (NULL if none)
+   \param[out]  orc_Message   Formatted message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::m_FillMessage(const C_CamMetTreeTraceHistory::C_Record & orc_Record,
+                                           const C_Detail * const opc_Detail,
+                                           C_CamMetTreeLoggerData & orc_Message) const
+{
+   orc_Message.c_CanMsg = orc_Record.c_CanMsg;
+   orc_Message.q_IsTx = orc_Record.q_IsTx;
+   orc_Message.q_CanDlcError = orc_Record.q_CanDlcError;
+   C_CamMetTreeTraceStore::mh_FillCanStrings(orc_Record.c_CanMsg, orc_Message);
+
+   orc_Message.u64_TimeStampRelative = orc_Record.u64_TimeStampRelative;
+   orc_Message.u64_TimeStampAbsoluteStart = orc_Record.u64_TimeStampAbsoluteStart;
+   orc_Message.u64_TimeStampAbsoluteTimeOfDay = orc_Record.u64_TimeStampAbsoluteTimeOfDay;
+   orc_Message.c_TimeStampRelative = C_OscComMessageLoggerData::h_GetTimestampAsString(
+      orc_Record.u64_TimeStampRelative);
+   orc_Message.c_TimeStampAbsoluteStart = C_OscComMessageLoggerData::h_GetTimestampAsString(
+      orc_Record.u64_TimeStampAbsoluteStart);
+   orc_Message.c_TimeStampAbsoluteTimeOfDay = C_OscComMessageLoggerData::h_GetTimestampAsString(
+      orc_Record.u64_TimeStampAbsoluteTimeOfDay);
+   orc_Message.c_Counter = C_SclString::IntToStr(orc_Record.u32_Counter);
+
+   orc_Message.c_Name = this->mc_Strings[orc_Record.u32_NameIndex];
+   orc_Message.c_Status = this->mc_Strings[orc_Record.u32_StatusIndex];
+   if (opc_Detail != NULL)
+   {
+      orc_Message.c_ProtocolTextHex = opc_Detail->c_ProtocolTextHex;
+      orc_Message.c_ProtocolTextDec = opc_Detail->c_ProtocolTextDec;
+      orc_Message.c_Signals = opc_Detail->c_Signals;
+   }
+   else
+   {
+      orc_Message.c_ProtocolTextHex = "";
+      orc_Message.c_ProtocolTextDec = "";
+      orc_Message.c_Signals.clear();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Format CAN identifier, DLC and data
+
+   Same format as used by C_OscComMessageLogger.
+
+   \param[in]      orc_Msg       CAN message
+   \param[in,out]  orc_Message   Message to set the strings of
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeTraceStore::mh_FillCanStrings(const T_STWCAN_Msg_RX & orc_Msg, C_OscComMessageLoggerData & orc_Message)
+{
+   orc_Message.c_CanIdDec = C_SclString::IntToStr(orc_Msg.u32_ID);
+   orc_Message.c_CanIdHex = C_SclString::IntToHex(orc_Msg.u32_ID, 1).UpperCase();
+   if (orc_Msg.u8_XTD > 0U)
+   {
+      // Extended Id
+      orc_Message.c_CanIdDec += "x";
+      orc_Message.c_CanIdHex += "x";
+   }
+   orc_Message.c_CanDlc = C_SclString::IntToStr(orc_Msg.u8_DLC);
+
+   orc_Message.c_CanDataDec = "";
+   orc_Message.c_CanDataHex = "";
+   for (uint8_t u8_DbCounter = 0U; u8_DbCounter < orc_Msg.u8_DLC; ++u8_DbCounter)
+   {
+      if (orc_Msg.au8_Data[u8_DbCounter] < 100)
+      {
+         orc_Message.c_CanDataDec += " ";
+         if (orc_Msg.au8_Data[u8_DbCounter] < 10)
+         {
+            orc_Message.c_CanDataDec += " ";
+         }
+      }
+      orc_Message.c_CanDataDec += C_SclString::IntToStr(orc_Msg.au8_Data[u8_DbCounter]);
+      orc_Message.c_CanDataHex += C_SclString::IntToHex(orc_Msg.au8_Data[u8_DbCounter], 2).UpperCase();
+
+      if (u8_DbCounter < (orc_Msg.u8_DLC - 1U))
+      {
+         orc_Message.c_CanDataDec += " ";
+         orc_Message.c_CanDataHex += " ";
+      }
+   }
+}
@@ -0,0 +1,141 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Ring buffer storage of the continuous message trace (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_CAMMETTREETRACESTORE_HPP
+#define C_CAMMETTREETRACESTORE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+#include <string>
+#include <vector>
+
+#include "stwtypes.hpp"
+#include "C_SclString.hpp"
+#include "C_TblTreSimpleItem.hpp"
+#include "C_CamMetTreeLoggerData.hpp"
+#include "C_CamMetTreeTraceHistory.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_CamMetTreeTraceStore
+{
+public:
+   ///Tree item of a trace message with signals; not linked to a root item
+   class C_MessageItem :
+      public C_TblTreSimpleItem
+   {
+   public:
+      C_MessageItem(void);
+
+      uint64_t u64_Sequence; ///< Sequence number of the owning message
+   };
+
+   C_CamMetTreeTraceStore(void);
+   ~C_CamMetTreeTraceStore(void);
+
+   void SetCapacity(const uint32_t ou32_Capacity);
+   uint32_t GetCapacity(void) const;
+   void SetHistory(const std::string & orc_FilePathBase, const uint64_t ou64_MaxBytes);
+   bool IsHistoryActive(void) const;
+   uint32_t GetSize(void) const;
+   uint32_t GetHistorySize(void) const;
+   uint32_t GetNumInMemory(void) const;
+   void Clear(void);
+   bool Append(const C_CamMetTreeLoggerData & orc_Message, C_MessageItem * const opc_TreeItem);
+   void RemoveOldest(const uint32_t ou32_Count);
+   uint32_t GetNumHistoryOverLimit(void) const;
+   void RemoveHistoryOverLimit(void);
+
+   const C_CamMetTreeLoggerData * GetMessage(const uint32_t ou32_Index) const;
+   C_MessageItem * GetTreeItem(const uint32_t ou32_Index) const;
+   int32_t GetIndexOfTreeItem(const C_TblTreSimpleItem * const opc_Item) const;
+   void GetProtocolData(const uint32_t ou32_Index, stw::opensyde_core::C_OscComMessageLoggerData & orc_Message) const;
+   void SetProtocolText(const uint32_t ou32_Index, const stw::scl::C_SclString & orc_ProtocolTextHex,
+                        const stw::scl::C_SclString & orc_ProtocolTextDec);
+   int32_t FindCanId(const uint32_t ou32_Start, const uint32_t ou32_CanId, const uint8_t ou8_Xtd,
+                     const bool oq_Forward) const;
+   int32_t FindTimeStamp(const uint64_t ou64_TimeStampAbsoluteStart) const;
+
+private:
+   ///Interpretation results; only allocated for messages which have any
+   class C_Detail
+   {
+   public:
+      C_Detail(void);
+      ~C_Detail(void);
+
+      stw::scl::C_SclString c_ProtocolTextHex;
+      stw::scl::C_SclString c_ProtocolTextDec;
+      std::vector<stw::opensyde_core::C_OscComMessageLoggerDataSignal> c_Signals;
+      C_MessageItem * pc_TreeItem; ///< Owned tree item (NULL if none)
+
+   private:
+      //Avoid call
+      C_Detail(const C_Detail &);
+      C_Detail & operator =(const C_Detail &) &;
+   };
+
+   ///Trace entry in memory; all display strings are formatted on demand
+   class C_Frame
+   {
+   public:
+      C_CamMetTreeTraceHistory::C_Record c_Record;
+      C_Detail * pc_Detail; ///< Owned interpretation results (NULL if none)
+   };
+
+   ///Formatted message for a recently requested row
+   class C_CacheEntry
+   {
+   public:
+      C_CacheEntry(void);
+
+      bool q_Valid;
+      uint64_t u64_Sequence;
+      C_CamMetTreeLoggerData c_Message;
+   };
+
+   std::vector<C_Frame> mc_Frames; ///< Ring storage; grows up to the capacity
+   uint32_t mu32_Capacity;
+   uint32_t mu32_Oldest;        ///< Storage position of the oldest message
+   uint32_t mu32_Size;          ///< Number of stored messages
+   uint64_t mu64_FirstSequence; ///< Sequence number of the oldest message in memory; never reused
+   std::vector<stw::scl::C_SclString> mc_Strings;
+   std::map<stw::scl::C_SclString, uint32_t> mc_StringIndices;
+   mutable std::vector<C_CacheEntry> mc_Cache;
+   C_CamMetTreeTraceHistory mc_History; ///< Messages dropped from memory (if active)
+
+   static const uint32_t mhu32_CACHE_SIZE;
+
+   //Avoid call
+   C_CamMetTreeTraceStore(const C_CamMetTreeTraceStore &);
+   C_CamMetTreeTraceStore & operator =(const C_CamMetTreeTraceStore &) &;
+
+   void m_RemoveOldest(const uint32_t ou32_Count, const bool oq_KeepInHistory);
+   uint32_t m_GetPosition(const uint32_t ou32_Index) const;
+   uint32_t m_GetStringIndex(const stw::scl::C_SclString & orc_String);
+   void m_InvalidateCache(void) const;
+   void m_FillMessage(const C_CamMetTreeTraceHistory::C_Record & orc_Record, const C_Detail * const opc_Detail,
+                      C_CamMetTreeLoggerData & orc_Message) const;
+   static void mh_FillCanStrings(const stw::can::T_STWCAN_Msg_RX & orc_Msg,
+                                 stw::opensyde_core::C_OscComMessageLoggerData & orc_Message);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -12,6 +12,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <QDir>
 #include <QScrollBar>
 #include <QHeaderView>
 #include <QApplication>
@@ -19,6 +20,8 @@
 #include <QDrag>
 
 #include "stwerrors.hpp"
+#include "C_SclString.hpp"
+#include "C_OscLoggingHandler.hpp"
 #include "constants.hpp"
 #include "cam_constants.hpp"
 
@@ -30,6 +33,7 @@
 #include "C_GtGetText.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::scl;
 using namespace stw::errors;
 using namespace stw::opensyde_gui;
 using namespace stw::opensyde_gui_logic;
@@ -46,6 +50,8 @@ const int32_t C_CamMetTreeView::mhs32_COL_WIDTH_CAN_DIR = 44;
 const int32_t C_CamMetTreeView::mhs32_COL_WIDTH_CAN_DLC = 44;
 const int32_t C_CamMetTreeView::mhs32_COL_WIDTH_CAN_DATA = 247;
 const int32_t C_CamMetTreeView::mhs32_COL_WIDTH_CAN_COUNTER = 97;
+// Maximum size of the trace history files on disk (4 GiB are about 67 million messages)
+const uint64_t C_CamMetTreeView::mhu64_TRACE_HISTORY_MAX_SIZE = 4ULL * 1024ULL * 1024ULL * 1024ULL;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -87,6 +93,9 @@ C_CamMetTreeView::C_CamMetTreeView(QWidget * const opc_Parent) :
 
    this->header()->setStretchLastSection(false);
 
+   // All rows have the same height; allows the view to handle huge traces without measuring each row
+   this->setUniformRowHeights(true);
+
    this->setSelectionMode(QAbstractItemView::ExtendedSelection);
 
    //Buttons
@@ -121,12 +130,14 @@ C_CamMetTreeView::C_CamMetTreeView(QWidget * const opc_Parent) :
    this->m_SetupContextMenu();
 
    //Model
+   //Keep messages dropped from the trace buffer on disk, so the user can scroll back
+   this->mc_Model.SetTraceHistory(QDir::tempPath(), mhu64_TRACE_HISTORY_MAX_SIZE);
    this->mc_TimerHandleMessages.setInterval(90);
    this->setItemDelegate(&this->mc_Delegate);
    this->mc_GuiBuffer.moveToThread(&mc_ThreadGuiBuffer);
    this->mc_ThreadGuiBuffer.start();
    //lint -e{1938}  static const is guaranteed preinitialized before main
-   qRegisterMetaType<std::list<C_CamMetTreeLoggerData> >();
+   qRegisterMetaType<const C_CamMetTreeGuiBuffer::C_Batch *>();
    connect(&this->mc_GuiBuffer, &C_CamMetTreeGuiBuffer::SigUpdateUi, this, &C_CamMetTreeView::m_UpdateUi);
    connect(&this->mc_Delegate, &C_CamMetTreeDelegate::SigStartAccept, &this->mc_Model, &C_CamMetTreeModel::UnlockData);
    connect(&this->mc_Delegate, &C_CamMetTreeDelegate::SigEndAccept, &this->mc_Model, &C_CamMetTreeModel::LockData);
@@ -211,6 +222,7 @@ void C_CamMetTreeView::Stop(void)
    this->mc_Model.Stop();
 
    C_SyvComMessageMonitor::Stop();
+   this->m_LogGuiBufferStatistics();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -225,6 +237,7 @@ void C_CamMetTreeView::Start(void)
    this->clearSelection();
 
    this->mc_Model.Start();
+   this->mc_GuiBuffer.ResetStatistics();
 
    C_SyvComMessageMonitor::Start();
 }
@@ -251,6 +264,7 @@ void C_CamMetTreeView::ActionClearData(void)
 void C_CamMetTreeView::SetProtocol(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol)
 {
    std::vector<C_CamMetTreeLoggerData *> c_Messages;
+   stw::opensyde_core::C_OscComMessageLoggerData c_TraceMessage;
    C_SyvComMessageMonitor::SetProtocol(oe_Protocol);
    //Change all existing messages
    c_Messages = this->mc_Model.GetAllMessagesForProtocolChange();
@@ -258,6 +272,12 @@ void C_CamMetTreeView::SetProtocol(const stw::cmon_protocol::e_CanMonL7Protocols
    {
       this->m_UpdateProtocolString(*c_Messages[u32_ItMessage]);
    }
+   for (uint32_t u32_ItMessage = 0UL; u32_ItMessage < this->mc_Model.GetTraceMessageCount(); ++u32_ItMessage)
+   {
+      this->mc_Model.GetTraceMessageForProtocolChange(u32_ItMessage, c_TraceMessage);
+      this->m_UpdateProtocolString(c_TraceMessage);
+      this->mc_Model.SetTraceMessageProtocolText(u32_ItMessage, c_TraceMessage);
+   }
    //Update all related columns
    this->mc_Model.SignalProtocolChange();
 }
@@ -376,6 +396,9 @@ bool C_CamMetTreeView::GetDisplayTimestampRelative() const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Search a matching item
 
+   A time stamp as search string ("hh:mm:ss.ms.us") jumps to the first message at or after this time
+   (only for absolute time stamps in continuous mode).
+
    \param[in]  orc_SearchString  String to search in model
    \param[in]  oq_Next           Flag for search direction
                                  true:  Search the next entry, forward
@@ -384,24 +407,28 @@ bool C_CamMetTreeView::GetDisplayTimestampRelative() const
 //----------------------------------------------------------------------------------------------------------------------
 void C_CamMetTreeView::SearchTrace(const QString & orc_SearchString, const bool oq_Next)
 {
-   QItemSelection c_Selection;
-   int32_t s32_RowSignal;
-   int32_t s32_RowMultiplexedSignal;
-   const int32_t s32_Row = this->mc_Model.SearchMessageData(orc_SearchString, oq_Next, s32_RowSignal,
-                                                            s32_RowMultiplexedSignal);
+   uint64_t u64_TimeStamp;
 
-   if (s32_Row >= 0)
+   if (((this->mq_UniqueMessageMode == false) && (this->mc_Model.GetDisplayTimestampRelative() == false)) &&
+       (C_CamMetTreeModel::h_ParseTimeStamp(orc_SearchString, u64_TimeStamp) == true))
    {
-      // Select the result
+      this->m_SelectMessageRow(this->mc_Model.SearchTimeStamp(u64_TimeStamp));
+   }
+   else
+   {
+      int32_t s32_RowSignal;
+      int32_t s32_RowMultiplexedSignal;
+      const int32_t s32_Row = this->mc_Model.SearchMessageData(orc_SearchString, oq_Next, s32_RowSignal,
+                                                               s32_RowMultiplexedSignal);
+
       if (s32_RowSignal < 0)
       {
          // Message only
-         c_Selection.select(this->mc_Model.index(s32_Row, 0),
-                            this->mc_Model.index(s32_Row, this->mc_Model.columnCount() - 1));
-         this->scrollTo(this->mc_SortProxyModel.mapFromSource(this->mc_Model.index(s32_Row, 0)));
+         this->m_SelectMessageRow(s32_Row);
       }
-      else
+      else if (s32_Row >= 0)
       {
+         QItemSelection c_Selection;
          // Signal of message
          const QModelIndex c_ParentIndex =
             this->mc_SortProxyModel.mapFromSource(this->mc_Model.index(s32_Row, 0));
@@ -426,11 +453,15 @@ void C_CamMetTreeView::SearchTrace(const QString & orc_SearchString, const bool
 
          c_Selection.select(c_SelectIndex, c_SelectIndex);
          this->scrollTo(c_SelectIndex);
-      }
 
-      // Select the element
-      this->selectionModel()->select(c_Selection,
-                                     QItemSelectionModel::ClearAndSelect);
+         // Select the element
+         this->selectionModel()->select(c_Selection,
+                                        QItemSelectionModel::ClearAndSelect);
+      }
+      else
+      {
+         // Nothing found
+      }
    }
 }
 
@@ -806,6 +837,12 @@ void C_CamMetTreeView::m_SetupContextMenu(void)
    this->mpc_AddFilter = this->mpc_ContextMenu->addAction(C_GtGetText::h_GetText("Add to Receive Filter"),
                                                           this, &C_CamMetTreeView::m_OnAddFilterClicked);
 
+   this->mpc_ActionPreviousSameId = this->mpc_ContextMenu->addAction(
+      C_GtGetText::h_GetText("Go to Previous Message with Same ID"), this, &C_CamMetTreeView::m_GoToPreviousSameId);
+
+   this->mpc_ActionNextSameId = this->mpc_ContextMenu->addAction(
+      C_GtGetText::h_GetText("Go to Next Message with Same ID"), this, &C_CamMetTreeView::m_GoToNextSameId);
+
    this->mpc_ContextMenu->addSeparator();
 
    this->mpc_ActionExpandAll = this->mpc_ContextMenu->addAction(C_GtGetText::h_GetText("Expand all"),
@@ -832,7 +869,10 @@ void C_CamMetTreeView::m_OnCustomContextMenuRequested(const QPoint & orc_Pos)
    if ((q_Selected == true) ||
        (this->mc_SortProxyModel.rowCount() > 0))
    {
+      const bool q_MessageSelected = (this->mq_UniqueMessageMode == false) && (this->m_GetSelectedMessageRow() >= 0);
       this->mpc_ActionCopy->setVisible(q_Selected);
+      this->mpc_ActionPreviousSameId->setVisible(q_MessageSelected);
+      this->mpc_ActionNextSameId->setVisible(q_MessageSelected);
 
       this->mpc_ContextMenu->popup(this->mapToGlobal(orc_Pos));
    }
@@ -908,7 +948,8 @@ void C_CamMetTreeView::m_CopySelection(void)
                      q_Add = false;
                   }
                }
-               if (q_Add)
+               const C_CamMetTreeLoggerData * const pc_MessageData = this->mc_Model.GetMessageData(s32_NewRow);
+               if ((q_Add) && (pc_MessageData != NULL))
                {
                   //Handle expanded children
                   for (int32_t s32_ItChild = 0; s32_ItChild < this->mc_SortProxyModel.rowCount(c_TopLevelIndex);
@@ -921,9 +962,8 @@ void C_CamMetTreeView::m_CopySelection(void)
                      }
                   }
 
-                  // Save the info for this message data
-                  c_CanMessageData.pc_MessageData =
-                     this->mc_Model.GetMessageData(s32_NewRow);
+                  // Save a copy of the message data, rows of the trace are only formatted temporarily
+                  c_CanMessageData.c_MessageData = *pc_MessageData;
 
                   c_CanMessagesData.push_back(c_CanMessageData);
 
@@ -963,10 +1003,12 @@ void C_CamMetTreeView::m_HandleMessages(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add data to UI
 
-   \param[in]  orc_Data    New data
+   The batch is given back to the buffer afterwards.
+
+   \param[in]  opc_Batch   New data
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_CamMetTreeView::m_UpdateUi(const std::list<C_CamMetTreeLoggerData> & orc_Data)
+void C_CamMetTreeView::m_UpdateUi(const C_CamMetTreeGuiBuffer::C_Batch * const opc_Batch)
 {
    std::vector<int32_t> c_Rows;
    // Get the maximum of the scroll bar before adding new data
@@ -974,7 +1016,7 @@ void C_CamMetTreeView::m_UpdateUi(const std::list<C_CamMetTreeLoggerData> & orc_
 
    //Don't allow multiple concurrent add row steps
    this->mc_MutexUpdate.lock();
-   c_Rows = this->mc_Model.AddRows(orc_Data);
+   c_Rows = this->mc_Model.AddRows(opc_Batch->c_Messages, opc_Batch->u32_Count);
    if (this->mq_UniqueMessageMode == false)
    {
       // In case of continuous mode, adapt the new messages for showing the signals in correct column size
@@ -997,9 +1039,29 @@ void C_CamMetTreeView::m_UpdateUi(const std::list<C_CamMetTreeLoggerData> & orc_
       this->style()->polish(this);
    }
    this->mc_MutexUpdate.unlock();
+   this->mc_GuiBuffer.ReleaseBatch(opc_Batch);
    //lint -restore
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write handoff statistics of the GUI buffer for the last measurement to the log
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeView::m_LogGuiBufferStatistics(void)
+{
+   const C_CamMetTreeGuiBuffer::C_Statistics c_Statistics = this->mc_GuiBuffer.GetStatistics();
+
+   if (c_Statistics.u32_NumBatches > 0UL)
+   {
+      osc_write_log_info("CAN trace",
+                         "GUI buffer: " + C_SclString::IntToStr(c_Statistics.u64_NumMessages) + " messages in " +
+                         C_SclString::IntToStr(c_Statistics.u32_NumBatches) + " batches (max " +
+                         C_SclString::IntToStr(c_Statistics.u32_MaxBatchSize) + "), handoff latency avg " +
+                         C_SclString::IntToStr(c_Statistics.u64_SumLatencyUs / c_Statistics.u32_NumBatches) +
+                         " us, max " + C_SclString::IntToStr(c_Statistics.u32_MaxLatencyUs) + " us");
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Set child item stretch property for these rows
 
@@ -1137,7 +1199,9 @@ void C_CamMetTreeView::m_AddFilter()
             s32_Row = this->mc_SortProxyModel.mapToSource(this->currentIndex().parent()).row();
          }
          c_SelectedRowIndexs << s32_Row;
-         if (((c_SelectedRowIndexs.size() % 7) == 1) || (c_SelectedRowIndexs.size() == 1))
+         //Messages lost from the trace history have no data
+         if ((((c_SelectedRowIndexs.size() % 7) == 1) || (c_SelectedRowIndexs.size() == 1)) &&
+             (this->mc_Model.GetMessageData(s32_Row) != NULL))
          {
             if (this->mc_Model.GetMessageData(s32_Row)->c_CanMsg.u8_XTD == 0)
             {
@@ -1169,6 +1233,70 @@ void C_CamMetTreeView::m_OnAddFilterClicked()
 {
    Q_EMIT C_CamMetTreeView::SigEmitAddFilter();
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get row of the message of the first selected item
+
+   \return
+   -1   Nothing selected
+   Else Top level model row
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_CamMetTreeView::m_GetSelectedMessageRow(void) const
+{
+   int32_t s32_Retval = -1;
+   const QModelIndexList c_Indices = this->selectedIndexes();
+
+   if (c_Indices.size() > 0L)
+   {
+      QModelIndex c_Index = this->mc_SortProxyModel.mapToSource(c_Indices.at(0));
+      while (c_Index.parent().isValid() == true)
+      {
+         c_Index = c_Index.parent();
+      }
+      s32_Retval = c_Index.row();
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select message row and scroll to it
+
+   \param[in]  os32_Row  Top level model row (nothing is done if negative)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeView::m_SelectMessageRow(const int32_t os32_Row)
+{
+   if (os32_Row >= 0)
+   {
+      QItemSelection c_Selection;
+      const QModelIndex c_Index = this->mc_SortProxyModel.mapFromSource(this->mc_Model.index(os32_Row, 0));
+
+      c_Selection.select(c_Index, this->mc_SortProxyModel.mapFromSource(
+                            this->mc_Model.index(os32_Row, this->mc_Model.columnCount() - 1)));
+      this->selectionModel()->setCurrentIndex(c_Index, QItemSelectionModel::NoUpdate);
+      this->selectionModel()->select(c_Selection, QItemSelectionModel::ClearAndSelect);
+      this->scrollTo(c_Index);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select the previous message with the CAN ID of the selected message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeView::m_GoToPreviousSameId(void)
+{
+   this->m_SelectMessageRow(this->mc_Model.SearchCanId(this->m_GetSelectedMessageRow(), false));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select the next message with the CAN ID of the selected message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamMetTreeView::m_GoToNextSameId(void)
+{
+   this->m_SelectMessageRow(this->mc_Model.SearchCanId(this->m_GetSelectedMessageRow(), true));
+}
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Expand all messages and update geometry
 */
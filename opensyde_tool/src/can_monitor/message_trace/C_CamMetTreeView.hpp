@@ -101,6 +101,8 @@ private:
    QAction * mpc_ActionExpandAll;
    QAction * mpc_ActionCollapseAll;
    QAction * mpc_AddFilter;
+   QAction * mpc_ActionPreviousSameId;
+   QAction * mpc_ActionNextSameId;
    bool mq_UniqueMessageMode;
    bool mq_IsRunning;
    const bool mq_AllowSorting;
@@ -109,7 +111,8 @@ private:
    void m_OnCustomContextMenuRequested(const QPoint & orc_Pos);
    void m_CopySelection(void);
    void m_HandleMessages(void);
-   void m_UpdateUi(const std::list<stw::opensyde_gui_logic::C_CamMetTreeLoggerData> & orc_Data);
+   void m_UpdateUi(const stw::opensyde_gui_logic::C_CamMetTreeGuiBuffer::C_Batch * const opc_Batch);
+   void m_LogGuiBufferStatistics(void);
    void m_SetChildColumns(const std::vector<int32_t> & orc_Indices);
    void m_SetChildColumns(const QModelIndex & orc_ModelIndex);
    void m_SetAllChildren(void);
@@ -121,6 +124,10 @@ private:
    void m_CollapseAll(void);
    void m_AddFilter();
    void m_OnAddFilterClicked();
+   int32_t m_GetSelectedMessageRow(void) const;
+   void m_SelectMessageRow(const int32_t os32_Row);
+   void m_GoToPreviousSameId(void);
+   void m_GoToNextSameId(void);
    void m_OnCollapse(const QModelIndex & orc_Index);
    std::vector<int32_t> m_GetCurrentColumnPositionIndices(void) const;
    void m_SetColumnPositionIndices(const std::vector<int32_t> & orc_NewColPositionIndices);
@@ -137,6 +144,7 @@ private:
    const static int32_t mhs32_COL_WIDTH_CAN_DLC;
    const static int32_t mhs32_COL_WIDTH_CAN_DATA;
    const static int32_t mhs32_COL_WIDTH_CAN_COUNTER;
+   const static uint64_t mhu64_TRACE_HISTORY_MAX_SIZE;
 
 Q_SIGNALS:
    void SigEmitAddFilter();
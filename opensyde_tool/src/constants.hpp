@@ -54,7 +54,8 @@ const int32_t ms32_ANIMATION_STEPS = 10;
 const int32_t ms32_TIMER_INTERVAL = 10; //ms
 
 //GUI refresh timer
-const int32_t ms32_TIMER_GUI_REFRESH = 100; //ms
+const int32_t ms32_TIMER_GUI_FRAME = 40;          //ms; dashboard frame interval
+const int32_t ms32_TIMER_GUI_FULL_REFRESH = 500;  //ms; update of all dashboard widgets (e.g. timeouts)
 
 //Dashboard timeout factor
 const uint32_t mu32_DASHBOARD_TIMEOUT_FACTOR = 10U;
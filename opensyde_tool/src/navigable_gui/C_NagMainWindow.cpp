@@ -22,8 +22,10 @@
 #include "constants.hpp"
 
 #include "TglUtils.hpp"
+#include "TglFile.hpp"
 #include "C_OscUtils.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "stwerrors.hpp"
 #include "C_SyvUtil.hpp"
 #include "C_HeHandler.hpp"
@@ -175,6 +177,7 @@ C_NagMainWindow::C_NagMainWindow(const uint16_t ou16_Timer) :
 
    // Performance time measurement
    C_OscLoggingHandler::h_SetMeasurePerformanceActive(C_UsHandler::h_GetInstance()->GetPerformanceActive());
+   C_OscTraceHandler::h_SetActive(C_UsHandler::h_GetInstance()->GetPerformanceActive());
 
    //Drag & drop of *.syde files
    this->setAcceptDrops(true);
@@ -229,6 +232,13 @@ C_NagMainWindow::~C_NagMainWindow()
 
    delete mpc_Ui;
 
+   // write timing trace next to log file
+   if (C_OscTraceHandler::h_IsActive() == true)
+   {
+      (void)C_OscTraceHandler::h_ExportChromeTrace(
+         TglChangeFileExtension(C_OscLoggingHandler::h_GetCompleteLogFileLocation(), "_trace.json"));
+   }
+
    //Clean up singleton
    stw::opensyde_gui_logic::C_PuiProject::h_Destroy();
    C_UsHandler::h_Destroy();
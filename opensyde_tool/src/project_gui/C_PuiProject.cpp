@@ -33,6 +33,7 @@
 #include "C_GtGetText.hpp"
 #include "C_PuiSvHandler.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscHexImageCache.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -554,6 +555,8 @@ void C_PuiProject::LoadEmpty(void)
    this->c_Version = c_Tmp.c_Version;
    C_PuiSdHandler::h_GetInstance()->Clear(true);
    C_PuiSvHandler::h_GetInstance()->Clear();
+   //Parsed HEX files of the previous project are of no use anymore
+   C_OscHexImageCache::h_Clear();
    //Update hash
    this->mu32_CalculatedProjectHash = this->m_CalcHashProject();
 }
@@ -765,6 +768,8 @@ int32_t C_PuiProject::m_LoadProject(uint16_t * const opu16_FileVersion,
    }
    else
    {
+      //Parsed HEX files of the previous project are of no use anymore
+      C_OscHexImageCache::h_Clear();
       //Load project file
       s32_Retval = C_OscProjectFiler::h_Load(*this, this->mc_Path.toStdString().c_str());
       if (s32_Retval == C_NO_ERR)
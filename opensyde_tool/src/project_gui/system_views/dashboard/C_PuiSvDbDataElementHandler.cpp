@@ -483,10 +483,30 @@ bool C_PuiSvDbDataElementHandler::IsReadItem() const
    return this->mq_ReadItem;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Prepare the value queues of all elements for new producing threads
+
+   To be called for each new connection before any value is inserted (see InsertNewValueIntoQueue).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementHandler::ResetValueProducers(void)
+{
+   for (uint32_t u32_ItValue = 0U; u32_ItValue < this->mc_VecDataValues.size(); ++u32_ItValue)
+   {
+      this->mc_VecDataValues[u32_ItValue].ResetProducer();
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Inserts a new received value to the widget queue
 
-   This function is thread safe.
+   This function does not lock:
+   the value is handed over to the GUI thread via the lock-free queue of the element.
+   All values of one element must be inserted by the same thread: the polling thread for elements read on trigger
+   and written elements, the asynchronous communication thread for cyclic and on change elements and bus signals.
+   Different elements may be inserted by different threads in parallel.
+   Debug builds assert on a second producing thread of one element since the last call of ResetValueProducers.
+   The registered elements must not be changed while values are inserted (no configuration changes while connected).
 
    \param[in]  orc_WidgetDataPoolElementId   Datapool element identificator
    \param[in]  orc_NewValue                  New received value
@@ -507,11 +527,10 @@ void C_PuiSvDbDataElementHandler::InsertNewValueIntoQueue(
       {
          // Add the new value to the correct data series
          const uint32_t u32_DataSerieIndex = c_ItItem.value();
-         if (static_cast<int32_t>(u32_DataSerieIndex) < this->mc_VecDataValues.size())
+         if (u32_DataSerieIndex < this->mc_VecDataValues.size())
          {
-            this->mc_CriticalSection.Acquire();
-            this->mc_VecDataValues[u32_DataSerieIndex].push_back(orc_NewValue);
-            this->mc_CriticalSection.Release();
+            this->mc_VecDataValues[u32_DataSerieIndex].Push(orc_NewValue,
+                                                            c_ItItem.key().GetArrayElementIndexOrZero());
          }
          //Don't stop as there might be multiple matches
       }
@@ -551,6 +570,37 @@ void C_PuiSvDbDataElementHandler::AddNewNvmValueIntoQueue(
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if any value was received since the widget took its last values
+
+   Used by the dashboard refresh to skip widgets without new data.
+
+   \retval   true    New value or NVM value available
+   \retval   false   No new data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_PuiSvDbDataElementHandler::HasNewValues(void) const
+{
+   bool q_Retval = false;
+
+   for (uint32_t u32_ItValue = 0U; u32_ItValue < this->mc_VecDataValues.size(); ++u32_ItValue)
+   {
+      if (this->mc_VecDataValues[u32_ItValue].HasNewValue() == true)
+      {
+         q_Retval = true;
+         break;
+      }
+   }
+
+   if (q_Retval == false)
+   {
+      this->mc_CriticalSection.Acquire();
+      q_Retval = this->mc_VecNvmValueReceived.contains(true);
+      this->mc_CriticalSection.Release();
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get unscaled value as scaled string
 
@@ -691,31 +741,27 @@ int32_t C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32_t ou32_WidgetDa
    int32_t s32_Return = C_RANGE;
    C_PuiSvDbNodeDataPoolListElementId c_Id;
 
-   if (((static_cast<int32_t>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
+   if (((ou32_WidgetDataPoolElementIndex < this->mc_VecDataValues.size()) &&
         (ou32_WidgetDataPoolElementIndex < this->mc_UsedConfig.size())) && (
           this->GetDataPoolElementIndex(ou32_WidgetDataPoolElementIndex, c_Id) == C_NO_ERR))
    {
-      this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      // Get the newest value and remove all older values for the next call
+      const C_PuiSvDbDataElementContent * const pc_Value =
+         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].TakeNewest();
+      if (pc_Value != NULL)
       {
-         const int32_t s32_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
          const uint32_t u32_ArrayIndex = c_Id.GetArrayElementIndexOrZero();
 
          orc_ScaledValue = this->mc_UsedConfig[ou32_WidgetDataPoolElementIndex].GetSingleValueContentFormatted(
-            this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][s32_LastIndex],
-            u32_ArrayIndex, opf64_UnscaledValueAsFloat, opf64_ScaledValueAsFloat);
-
-         this->m_SaveTimeStamp(ou32_WidgetDataPoolElementIndex, s32_LastIndex);
+            *pc_Value, u32_ArrayIndex, opf64_UnscaledValueAsFloat, opf64_ScaledValueAsFloat);
 
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+         this->m_SaveTimeStamp(ou32_WidgetDataPoolElementIndex, pc_Value->GetTimeStamp());
          s32_Return = C_NO_ERR;
       }
       else
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
 
    return s32_Return;
@@ -754,30 +800,24 @@ int32_t C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32_t ou32_WidgetDa
    orc_ScaledValues.clear();
    orc_UnscaledValues.clear();
 
-   if ((static_cast<int32_t>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
+   if ((ou32_WidgetDataPoolElementIndex < this->mc_VecDataValues.size()) &&
        (ou32_WidgetDataPoolElementIndex < this->mc_UsedConfig.size()))
    {
-      this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      // Get the newest value(s) and remove all older values for the next call
+      const C_PuiSvDbDataElementContent * const pc_Value =
+         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].TakeNewest();
+      if (pc_Value != NULL)
       {
-         const int32_t s32_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
-
-         // Get the newest value(s)
          orc_ScaledValues = this->mc_UsedConfig[ou32_WidgetDataPoolElementIndex].GetValuesContentFormatted(
-            this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][s32_LastIndex],
-            orc_UnscaledValues);
-
-         this->m_SaveTimeStamp(ou32_WidgetDataPoolElementIndex, s32_LastIndex);
+            *pc_Value, orc_UnscaledValues);
 
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+         this->m_SaveTimeStamp(ou32_WidgetDataPoolElementIndex, pc_Value->GetTimeStamp());
          s32_Return = C_NO_ERR;
       }
       else
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
 
    return s32_Return;
@@ -811,19 +851,17 @@ int32_t C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32_t ou32_WidgetDa
 
    orc_Values.clear();
 
-   if ((static_cast<int32_t>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
+   if ((ou32_WidgetDataPoolElementIndex < this->mc_VecDataValues.size()) &&
        ((ou32_WidgetDataPoolElementIndex < this->mc_UsedConfig.size()) || (oq_UseScaling == false)))
    {
-      this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      // Get the newest value and remove all older values for the next call
+      const C_PuiSvDbDataElementContent * const pc_Value =
+         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].TakeNewest();
+      if (pc_Value != NULL)
       {
-         const int32_t s32_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
          float64_t f64_Temp;
 
-         // Get the newest value
-         C_SdNdeDpContentUtil::h_GetValuesAsFloat64(
-            this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][s32_LastIndex],
-            orc_Values);
+         C_SdNdeDpContentUtil::h_GetValuesAsFloat64(*pc_Value, orc_Values);
 
          // Scale all values
          if (oq_UseScaling == true)
@@ -838,17 +876,13 @@ int32_t C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32_t ou32_WidgetDa
             }
          }
 
-         this->m_SaveTimeStamp(ou32_WidgetDataPoolElementIndex, s32_LastIndex);
-
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+         this->m_SaveTimeStamp(ou32_WidgetDataPoolElementIndex, pc_Value->GetTimeStamp());
          s32_Return = C_NO_ERR;
       }
       else
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
 
    return s32_Return;
@@ -857,6 +891,8 @@ int32_t C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32_t ou32_WidgetDa
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns all registered values of a specific datapool element
 
+   Takes the history samples and the newest value, so the element has no new values afterwards.
+
    This function is thread safe.
 
    \param[in]   ou32_WidgetDataPoolElementIndex    Index of shown datapool element in widget
@@ -878,44 +914,42 @@ int32_t C_PuiSvDbDataElementHandler::m_GetAllValues(const uint32_t ou32_WidgetDa
    int32_t s32_Return = C_RANGE;
    C_PuiSvDbNodeDataPoolListElementId c_Id;
 
-   if ((static_cast<int32_t>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
+   if ((ou32_WidgetDataPoolElementIndex < this->mc_VecDataValues.size()) &&
        (ou32_WidgetDataPoolElementIndex < this->mc_UsedConfig.size()) &&
        (this->GetDataPoolElementIndex(ou32_WidgetDataPoolElementIndex, c_Id) == C_NO_ERR))
    {
-      this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      C_PuiSvDbDataElementValueRing & rc_Ring = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex];
+      // Only the values available now; values received meanwhile are returned with the next call
+      const uint32_t u32_Count = rc_Ring.GetHistoryCount();
+      if (u32_Count > 0U)
       {
-         uint32_t u32_Counter = 0U;
-         QList<C_PuiSvDbDataElementContent>::const_iterator c_ItItem;
          const uint32_t u32_ArrayIndex = c_Id.GetArrayElementIndexOrZero();
-         const int32_t s32_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
+         const C_PuiSvDbDataElementContent * pc_Newest;
 
          // Copy all values and scale the values
-         orc_ScaledValues.resize(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size());
-         orc_Timestamps.resize(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size());
-         for (c_ItItem = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].begin();
-              c_ItItem != this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].end();
-              ++c_ItItem)
+         orc_ScaledValues.resize(u32_Count);
+         orc_Timestamps.resize(u32_Count);
+         for (uint32_t u32_Counter = 0U; u32_Counter < u32_Count; ++u32_Counter)
          {
-            float64_t f64_Temp;
-            C_SdNdeDpContentUtil::h_GetValueAsFloat64(*c_ItItem, f64_Temp, u32_ArrayIndex);
+            const C_PuiSvDbDataElementValueRing::C_HistorySample & rc_Sample = rc_Ring.GetHistoryValue(u32_Counter);
             orc_ScaledValues[u32_Counter] = C_OscUtils::h_GetValueScaled(
-               f64_Temp,
+               rc_Sample.f64_Value,
                this->mc_UsedConfig[ou32_WidgetDataPoolElementIndex].c_Scaling.f64_Factor,
                this->mc_UsedConfig[ou32_WidgetDataPoolElementIndex].c_Scaling.f64_Offset);
 
             // Copy the timestamp
-            orc_Timestamps[u32_Counter] = (*c_ItItem).GetTimeStamp();
-            ++u32_Counter;
+            orc_Timestamps[u32_Counter] = rc_Sample.u32_TimeStamp;
          }
 
-         // The last value will be returned formatted too
+         // Remove all values for the next call
+         rc_Ring.ReleaseHistory(u32_Count);
+
+         // The newest value will be returned formatted too; taking it also resets the new value flag.
+         // No newest value means it was already taken with an earlier call; it is still the newest one.
+         pc_Newest = rc_Ring.TakeNewest();
          orc_ScaledFormattedLastValue =
             this->mc_UsedConfig[ou32_WidgetDataPoolElementIndex].GetSingleValueContentFormatted(
-               this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][s32_LastIndex], u32_ArrayIndex, NULL);
-
-         // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+               (pc_Newest != NULL) ? *pc_Newest : rc_Ring.GetLastTakenValue(), u32_ArrayIndex, NULL);
          s32_Return = C_NO_ERR;
 
          //Save last timestamp
@@ -935,11 +969,30 @@ int32_t C_PuiSvDbDataElementHandler::m_GetAllValues(const uint32_t ou32_WidgetDa
       {
          s32_Return = C_NOACT;
       }
-      this->mc_CriticalSection.Release();
    }
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of values which were not added to the history of any element and reset it
+
+   Values get dropped if the GUI does not take them in time (see m_GetAllValues).
+
+   \return
+   Number of dropped values since the last call
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_PuiSvDbDataElementHandler::m_TakeDroppedValueCount(void)
+{
+   uint32_t u32_Retval = 0U;
+
+   for (uint32_t u32_ItValue = 0U; u32_ItValue < this->mc_VecDataValues.size(); ++u32_ItValue)
+   {
+      u32_Retval += this->mc_VecDataValues[u32_ItValue].TakeHistoryDroppedCount();
+   }
+   return u32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the newest registered NVM value of a specific NVM datapool element. It can be an array too.
 
@@ -1809,8 +1862,18 @@ const
 //----------------------------------------------------------------------------------------------------------------------
 void C_PuiSvDbDataElementHandler::m_SetWidgetDataPoolElementCount(const uint32_t ou32_Count)
 {
+   const uint32_t u32_PreviousCount = static_cast<uint32_t>(this->mc_VecDataValues.size());
+
    this->mu32_WidgetDataPoolElementCount = ou32_Count;
    this->mc_VecDataValues.resize(this->mu32_WidgetDataPoolElementCount);
+   // Only charts show every received value; all other widgets only need the newest one
+   if ((this->me_Type == C_PuiSvDbDataElement::eTAB_CHART) || (this->me_Type == C_PuiSvDbDataElement::eCHART))
+   {
+      for (uint32_t u32_It = u32_PreviousCount; u32_It < this->mu32_WidgetDataPoolElementCount; ++u32_It)
+      {
+         this->mc_VecDataValues[u32_It].SetHistoryActive(true);
+      }
+   }
    this->mc_VecNvmValue.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_VecNvmValueReceived.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_LastDataPoolElementTimeStampsMs.resize(this->mu32_WidgetDataPoolElementCount);
@@ -1877,17 +1940,16 @@ QString C_PuiSvDbDataElementHandler::mh_GetStringForScaledValue(const float64_t
 /*! \brief   Saves the last timestamp for specific element and sets it as valid
 
    \param[in]   ou32_WidgetDataPoolElementIndex    Index of shown datapool element in widget
-   \param[in]   os32_ValueIndex                     Index of value
+   \param[in]   ou32_TimeStamp                      Time stamp of the value
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_PuiSvDbDataElementHandler::m_SaveTimeStamp(const uint32_t ou32_WidgetDataPoolElementIndex,
-                                                  const int32_t os32_ValueIndex)
+                                                  const uint32_t ou32_TimeStamp)
 {
    //Save last timestamp
    if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsMs.size())
    {
-      this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] =
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][os32_ValueIndex].GetTimeStamp();
+      this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] = ou32_TimeStamp;
    }
    //Set timestamp valid
    if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsValid.size())
@@ -25,6 +25,7 @@
 #include "C_OscNodeDataPoolListElementId.hpp"
 #include "C_PuiSvDbNodeDataPoolListElementId.hpp"
 #include "C_PuiSvDbDataElementContent.hpp"
+#include "C_PuiSvDbDataElementValueRing.hpp"
 #include "C_PuiSvDbDataElementScaling.hpp"
 #include "C_PuiSvDbDataElementDisplayFormatterConfig.hpp"
 
@@ -68,10 +69,12 @@ public:
    bool IsDataElementRegistered(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId) const;
    bool IsReadItem() const;
 
+   void ResetValueProducers(void);
    void InsertNewValueIntoQueue(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
                                 const C_PuiSvDbDataElementContent & orc_NewValue);
    void AddNewNvmValueIntoQueue(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
                                 const C_PuiSvDbDataElementContent & orc_NewValue);
+   bool HasNewValues(void) const;
    QString GetUnscaledValueAsScaledString(const float64_t of64_Value, const uint32_t ou32_IndexElement = 0UL) const;
    QString GetUnscaledValueInRangeAsScaledString(const float64_t of64_Value, const uint32_t ou32_IndexElement = 0UL, float64_t * const opf64_Progress =
                                                     NULL) const;
@@ -91,6 +94,7 @@ protected:
                                   const bool oq_UseScaling);
    int32_t m_GetAllValues(const uint32_t ou32_WidgetDataPoolElementIndex, QString & orc_ScaledFormattedLastValue,
                           QVector<float64_t> & orc_ScaledValues, QVector<uint32_t> & orc_Timestamps);
+   uint32_t m_TakeDroppedValueCount(void);
    int32_t m_GetLastNvmValue(const uint32_t ou32_WidgetDataPoolElementIndex,
                              stw::opensyde_core::C_OscNodeDataPoolContent & orc_Value);
    int32_t m_GetTimoutPercentage100(const uint32_t ou32_DataElementIndex, uint8_t & oru8_TimoutPercentage100) const;
@@ -142,8 +146,8 @@ private:
 
    const uint32_t mu32_WidgetDataPoolElementCountMaximum;
    uint32_t mu32_WidgetDataPoolElementCount;
-   // For each datapool element an own list
-   QVector<QList<C_PuiSvDbDataElementContent> > mc_VecDataValues;
+   // For each datapool element an own lock-free queue
+   std::vector<C_PuiSvDbDataElementValueRing> mc_VecDataValues;
    QVector<C_PuiSvDbDataElementContent> mc_VecNvmValue;
    QVector<bool> mc_VecNvmValueReceived;
    // Mapping of datapool element id to index of datapool element list in mc_VecDataValues
@@ -174,7 +178,7 @@ private:
    static QString mh_GetStringForScaledValue(const float64_t of64_Value,
                                              const stw::opensyde_core::C_OscNodeDataPoolContent::E_Type oe_Type);
 
-   void m_SaveTimeStamp(const uint32_t ou32_WidgetDataPoolElementIndex, const int32_t os32_ValueIndex);
+   void m_SaveTimeStamp(const uint32_t ou32_WidgetDataPoolElementIndex, const uint32_t ou32_TimeStamp);
 
    //Avoid call
    C_PuiSvDbDataElementHandler(const C_PuiSvDbDataElementHandler &);
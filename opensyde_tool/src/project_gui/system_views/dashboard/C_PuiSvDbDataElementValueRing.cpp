@@ -0,0 +1,327 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Lock-free value queue of one dashboard data element
+
+   Hands the received values over to the GUI thread without any lock.
+   Exactly one producer thread and one consumer (GUI thread) are supported per instance.
+   Which thread produces depends on the transmission mode of the element: the polling thread for elements read on
+   trigger (and written elements), the asynchronous communication thread for cyclic and on change elements and for
+   bus signals. Debug builds assert that all values since the last call of ResetProducer come from the same thread.
+
+   Two views on the received values are provided:
+   * a "newest value" slot for all widgets. It is triple buffered so the producer never waits and the consumer
+     always gets the most recent complete value.
+   * an optional history ring for widgets showing every value (charts). It only holds time stamp and unscaled value
+     of the shown array element per sample, so it has a fixed size and filling it never allocates memory.
+     If the GUI does not drain it in time, new samples are dropped (and counted) until space is available again.
+
+   As the newest value slots are reused, assigning small values (scalars, short arrays) does not allocate memory.
+
+   Copying and assigning is not thread safe. It may only be done while no thread is using the instance.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "C_PuiSvDbDataElementValueRing.hpp"
+#include "C_SdNdeDpContentUtil.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_PuiSvDbDataElementValueRing::hu32_HISTORY_SIZE = 256U;
+const uint32_t C_PuiSvDbDataElementValueRing::mhu32_NEWEST_FRESH = 0x04U;
+const uint32_t C_PuiSvDbDataElementValueRing::mhu32_NEWEST_INDEX_MASK = 0x03U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   History is not active.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbDataElementValueRing::C_PuiSvDbDataElementValueRing(void) :
+   mc_HistoryWriteCounter(0U),
+   mc_HistoryReadCounter(0U),
+   mc_HistoryDropped(0U),
+   mc_NewestShared(1U),
+   mu32_NewestProducerIndex(0U),
+   mu32_NewestConsumerIndex(2U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Copy constructor
+
+   Not thread safe.
+   The producer thread is not copied.
+
+   \param[in]  orc_Source  Reference to source
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbDataElementValueRing::C_PuiSvDbDataElementValueRing(const C_PuiSvDbDataElementValueRing & orc_Source) :
+   mc_History(orc_Source.mc_History),
+   mc_HistoryWriteCounter(orc_Source.mc_HistoryWriteCounter.loadRelaxed()),
+   mc_HistoryReadCounter(orc_Source.mc_HistoryReadCounter.loadRelaxed()),
+   mc_HistoryDropped(orc_Source.mc_HistoryDropped.loadRelaxed()),
+   mc_NewestShared(orc_Source.mc_NewestShared.loadRelaxed()),
+   mu32_NewestProducerIndex(orc_Source.mu32_NewestProducerIndex),
+   mu32_NewestConsumerIndex(orc_Source.mu32_NewestConsumerIndex)
+{
+   for (uint32_t u32_It = 0U; u32_It < 3U; ++u32_It)
+   {
+      this->mac_Newest[u32_It] = orc_Source.mac_Newest[u32_It];
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Assignment operator
+
+   Not thread safe.
+   The producer thread is not copied.
+
+   \param[in]  orc_Source  Reference to source
+
+   \return
+   reference to new instance
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbDataElementValueRing & C_PuiSvDbDataElementValueRing::operator =(
+   const C_PuiSvDbDataElementValueRing & orc_Source) &
+{
+   if (this != &orc_Source)
+   {
+      this->mc_History = orc_Source.mc_History;
+      this->mc_HistoryWriteCounter.storeRelaxed(orc_Source.mc_HistoryWriteCounter.loadRelaxed());
+      this->mc_HistoryReadCounter.storeRelaxed(orc_Source.mc_HistoryReadCounter.loadRelaxed());
+      this->mc_HistoryDropped.storeRelaxed(orc_Source.mc_HistoryDropped.loadRelaxed());
+      for (uint32_t u32_It = 0U; u32_It < 3U; ++u32_It)
+      {
+         this->mac_Newest[u32_It] = orc_Source.mac_Newest[u32_It];
+      }
+      this->mc_NewestShared.storeRelaxed(orc_Source.mc_NewestShared.loadRelaxed());
+      this->mu32_NewestProducerIndex = orc_Source.mu32_NewestProducerIndex;
+      this->mu32_NewestConsumerIndex = orc_Source.mu32_NewestConsumerIndex;
+   }
+   return *this;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbDataElementValueRing::C_HistorySample::C_HistorySample(void) :
+   u32_TimeStamp(0U),
+   f64_Value(0.0)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Activate or deactivate the history
+
+   Only widgets showing every received value need the history; all others only use the newest value.
+   Any history samples are discarded.
+   Not thread safe: may only be called while no value is pushed.
+
+   \param[in]  oq_Active  true: keep history samples; false: only keep the newest value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementValueRing::SetHistoryActive(const bool oq_Active)
+{
+   if (oq_Active == true)
+   {
+      this->mc_History.resize(hu32_HISTORY_SIZE);
+   }
+   else
+   {
+      std::vector<C_HistorySample>().swap(this->mc_History);
+   }
+   this->mc_HistoryWriteCounter.storeRelaxed(0U);
+   this->mc_HistoryReadCounter.storeRelaxed(0U);
+   this->mc_HistoryDropped.storeRelaxed(0U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Forget the thread which pushed the values so far
+
+   To be called when the producing threads change (e.g. for a new connection).
+   Not thread safe: may only be called while no value is pushed.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementValueRing::ResetProducer(void)
+{
+#ifndef QT_NO_DEBUG
+   this->mc_ProducerThread.storeRelaxed(NULL);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add a new received value
+
+   To be called by the producer thread only.
+   The first call after ResetProducer determines the producer thread; debug builds assert on calls from other threads.
+   The thread object is used instead of the system thread ID as the polling thread is restarted for each operation.
+   If the history is full the value is not added to the history but still becomes the newest value.
+
+   \param[in]  orc_Value         New received value
+   \param[in]  ou32_ArrayIndex   Array element to keep in the history (0 for non-array elements)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementValueRing::Push(const C_PuiSvDbDataElementContent & orc_Value, const uint32_t ou32_ArrayIndex)
+{
+   uint32_t u32_Previous;
+
+#ifndef QT_NO_DEBUG
+   if (this->mc_ProducerThread.testAndSetRelaxed(NULL, QThread::currentThread()) == false)
+   {
+      Q_ASSERT(this->mc_ProducerThread.loadRelaxed() == QThread::currentThread());
+   }
+#endif
+
+   if (this->mc_History.empty() == false)
+   {
+      const uint32_t u32_WriteCounter = this->mc_HistoryWriteCounter.loadRelaxed();
+      if ((u32_WriteCounter - this->mc_HistoryReadCounter.loadAcquire()) < hu32_HISTORY_SIZE)
+      {
+         C_HistorySample & rc_Sample = this->mc_History[u32_WriteCounter & (hu32_HISTORY_SIZE - 1U)];
+         rc_Sample.u32_TimeStamp = orc_Value.GetTimeStamp();
+         C_SdNdeDpContentUtil::h_GetValueAsFloat64(orc_Value, rc_Sample.f64_Value, ou32_ArrayIndex);
+         this->mc_HistoryWriteCounter.storeRelease(u32_WriteCounter + 1U);
+      }
+      else
+      {
+         this->mc_HistoryDropped.fetchAndAddRelaxed(1U);
+      }
+   }
+
+   //hand the filled slot over and continue with the one the consumer did not take yet
+   this->mac_Newest[this->mu32_NewestProducerIndex] = orc_Value;
+   u32_Previous = this->mc_NewestShared.fetchAndStoreAcquireRelease(this->mu32_NewestProducerIndex |
+                                                                    mhu32_NEWEST_FRESH);
+   this->mu32_NewestProducerIndex = u32_Previous & mhu32_NEWEST_INDEX_MASK;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the newest value
+
+   To be called by the consumer thread only.
+   The history is not changed.
+
+   \return
+   NULL     No value received since the last call
+   Else     Newest value; valid until the next call of this function
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_PuiSvDbDataElementContent * C_PuiSvDbDataElementValueRing::TakeNewest(void)
+{
+   const C_PuiSvDbDataElementContent * pc_Retval = NULL;
+
+   if ((this->mc_NewestShared.loadRelaxed() & mhu32_NEWEST_FRESH) != 0U)
+   {
+      const uint32_t u32_Previous = this->mc_NewestShared.fetchAndStoreAcquireRelease(this->mu32_NewestConsumerIndex);
+      this->mu32_NewestConsumerIndex = u32_Previous & mhu32_NEWEST_INDEX_MASK;
+      pc_Retval = &this->mac_Newest[this->mu32_NewestConsumerIndex];
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the value returned by the last successful call of TakeNewest
+
+   To be called by the consumer thread only.
+
+   \return
+   Last taken value (default content if no value was taken yet)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_PuiSvDbDataElementContent & C_PuiSvDbDataElementValueRing::GetLastTakenValue(void) const
+{
+   return this->mac_Newest[this->mu32_NewestConsumerIndex];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if a value was received since the consumer took its last values
+
+   To be called by the consumer thread only.
+
+   \return
+   true     New value or history samples available
+   false    No new value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_PuiSvDbDataElementValueRing::HasNewValue(void) const
+{
+   return ((this->mc_NewestShared.loadRelaxed() & mhu32_NEWEST_FRESH) != 0U) || (this->GetHistoryCount() > 0U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of history samples available to the consumer
+
+   To be called by the consumer thread only.
+
+   \return
+   Number of samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_PuiSvDbDataElementValueRing::GetHistoryCount(void) const
+{
+   return this->mc_HistoryWriteCounter.loadAcquire() - this->mc_HistoryReadCounter.loadRelaxed();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get history sample
+
+   To be called by the consumer thread only.
+
+   \param[in]  ou32_Index  Index of sample; 0 is the oldest one; must be smaller than the result of GetHistoryCount
+
+   \return
+   Sample; valid until it is released
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_PuiSvDbDataElementValueRing::C_HistorySample & C_PuiSvDbDataElementValueRing::GetHistoryValue(
+   const uint32_t ou32_Index) const
+{
+   return this->mc_History[(this->mc_HistoryReadCounter.loadRelaxed() + ou32_Index) & (hu32_HISTORY_SIZE - 1U)];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Hand the oldest history samples back to the producer
+
+   To be called by the consumer thread only.
+
+   \param[in]  ou32_Count  Number of samples to release; must not exceed the result of GetHistoryCount
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementValueRing::ReleaseHistory(const uint32_t ou32_Count)
+{
+   this->mc_HistoryReadCounter.storeRelease(this->mc_HistoryReadCounter.loadRelaxed() + ou32_Count);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of samples dropped because the history was full and reset it
+
+   To be called by the consumer thread only.
+
+   \return
+   Number of dropped samples since the last call
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_PuiSvDbDataElementValueRing::TakeHistoryDroppedCount(void)
+{
+   return this->mc_HistoryDropped.fetchAndStoreRelaxed(0U);
+}
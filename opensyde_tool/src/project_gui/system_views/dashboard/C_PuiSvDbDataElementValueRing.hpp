@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Lock-free value queue of one dashboard data element (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_PUISVDBDATAELEMENTVALUERING_HPP
+#define C_PUISVDBDATAELEMENTVALUERING_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QThread>
+
+#include "stwtypes.hpp"
+
+#include "C_PuiSvDbDataElementContent.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_PuiSvDbDataElementValueRing
+{
+public:
+   C_PuiSvDbDataElementValueRing(void);
+   C_PuiSvDbDataElementValueRing(const C_PuiSvDbDataElementValueRing & orc_Source);
+   C_PuiSvDbDataElementValueRing & operator =(const C_PuiSvDbDataElementValueRing & orc_Source) &;
+
+   ///History sample: only what a chart needs of a received value
+   class C_HistorySample
+   {
+   public:
+      C_HistorySample(void);
+
+      uint32_t u32_TimeStamp; ///< Time stamp of the received value
+      float64_t f64_Value;    ///< Unscaled value of the shown array element
+   };
+
+   //Configuration; not thread safe
+   void SetHistoryActive(const bool oq_Active);
+   void ResetProducer(void);
+
+   //Producer side
+   void Push(const C_PuiSvDbDataElementContent & orc_Value, const uint32_t ou32_ArrayIndex);
+
+   //Consumer side
+   const C_PuiSvDbDataElementContent * TakeNewest(void);
+   const C_PuiSvDbDataElementContent & GetLastTakenValue(void) const;
+   bool HasNewValue(void) const;
+   uint32_t GetHistoryCount(void) const;
+   const C_HistorySample & GetHistoryValue(const uint32_t ou32_Index) const;
+   void ReleaseHistory(const uint32_t ou32_Count);
+   uint32_t TakeHistoryDroppedCount(void);
+
+   static const uint32_t hu32_HISTORY_SIZE; ///< Number of history samples; must be a power of two
+
+private:
+   std::vector<C_HistorySample> mc_History;         ///< Empty if history is not active
+   QAtomicInteger<uint32_t> mc_HistoryWriteCounter; ///< Written by producer only
+   QAtomicInteger<uint32_t> mc_HistoryReadCounter;  ///< Written by consumer only
+   QAtomicInteger<uint32_t> mc_HistoryDropped;      ///< Samples not added because the history was full
+
+   C_PuiSvDbDataElementContent mac_Newest[3];
+   QAtomicInteger<uint32_t> mc_NewestShared; ///< Index of the slot handed over plus the fresh flag
+   uint32_t mu32_NewestProducerIndex;        ///< Slot owned by the producer
+   uint32_t mu32_NewestConsumerIndex;        ///< Slot owned by the consumer
+
+#ifndef QT_NO_DEBUG
+   QAtomicPointer<QThread> mc_ProducerThread; ///< Thread which pushed the first value since the last reset
+#endif
+
+   static const uint32_t mhu32_NEWEST_FRESH;
+   static const uint32_t mhu32_NEWEST_INDEX_MASK;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
@@ -38,6 +38,7 @@ using namespace stw::opensyde_gui_logic;
 const uint32_t C_SyvHandlerWidget::mhu32_USER_INPUT_FUNC_APPLY = 0U;
 const uint32_t C_SyvHandlerWidget::mhu32_USER_INPUT_FUNC_SETTINGS = 1U;
 const uint32_t C_SyvHandlerWidget::mhu32_USER_INPUT_FUNC_DEVICECONFIG = 2U;
+const uint32_t C_SyvHandlerWidget::mhu32_USER_INPUT_FUNC_EXPORT_RECORDING = 3U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -91,6 +92,13 @@ C_SyvHandlerWidget::C_SyvHandlerWidget(QWidget * const opc_Parent) :
    c_ButtonProperties.c_ToolTipContent = C_GtGetText::h_GetText(
       "Scan for devices, assign and configure device interface properties like node ID, bitrate, ...");
    this->mc_VecUserInputFuncNames.append(c_ButtonProperties);
+
+   // Function index 3: mhu32_USER_INPUT_FUNC_EXPORT_RECORDING
+   c_ButtonProperties.c_ButtonText = C_GtGetText::h_GetText("Export Recording");
+   c_ButtonProperties.c_ToolTipHeading = C_GtGetText::h_GetText("Export Recording");
+   c_ButtonProperties.c_ToolTipContent = C_GtGetText::h_GetText(
+      "Export all values received during the last connection to a CSV file.");
+   this->mc_VecUserInputFuncNames.append(c_ButtonProperties);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -148,6 +156,12 @@ void C_SyvHandlerWidget::UserInputFunc(const uint32_t ou32_FuncNumber)
          this->mpc_SetupWidget->StartDeviceConfiguration();
       }
       break;
+   case mhu32_USER_INPUT_FUNC_EXPORT_RECORDING:
+      if (this->mpc_DashboardsWidget != NULL)
+      {
+         this->mpc_DashboardsWidget->ExportSignalRecording();
+      }
+      break;
    default:
       break;
    }
@@ -191,6 +205,7 @@ void C_SyvHandlerWidget::SetSubMode(const int32_t os32_SubMode, const uint32_t o
       // Deactivate all buttons in the first step
       Q_EMIT (this->SigShowUserInputFunc(mhu32_USER_INPUT_FUNC_SETTINGS, false));
       Q_EMIT (this->SigShowUserInputFunc(mhu32_USER_INPUT_FUNC_DEVICECONFIG, false));
+      Q_EMIT (this->SigShowUserInputFunc(mhu32_USER_INPUT_FUNC_EXPORT_RECORDING, false));
 
       // delete or remove from the layout the other widgets if necessary
       if (this->mpc_SetupWidget != NULL)
@@ -301,7 +316,15 @@ void C_SyvHandlerWidget::SetSubMode(const int32_t os32_SubMode, const uint32_t o
          Q_EMIT (this->SigShowUserInputFunc(mhu32_USER_INPUT_FUNC_APPLY, true));
          Q_EMIT (this->SigShowUserInputFunc(mhu32_USER_INPUT_FUNC_SETTINGS, true));
 
+         Q_EMIT (this->SigShowUserInputFunc(mhu32_USER_INPUT_FUNC_EXPORT_RECORDING, true));
+
          Q_EMIT (this->SigEnableUserInputFunc(mhu32_USER_INPUT_FUNC_SETTINGS, !q_ServiceModeActive));
+         Q_EMIT (this->SigEnableUserInputFunc(mhu32_USER_INPUT_FUNC_EXPORT_RECORDING, true));
+
+         QIcon c_IconExport("://images/system_views/IconExportEnabled.svg");
+         c_IconExport.addPixmap(static_cast<QPixmap>("://images/system_views/IconExportDisabled.svg"),
+                                QIcon::Disabled);
+         Q_EMIT (this->SigSetIconForUserInputFunc(mhu32_USER_INPUT_FUNC_EXPORT_RECORDING, c_IconExport));
 
          this->mpc_DashboardsWidget = new C_SyvDaDashboardsWidget(ou32_Index, this->parentWidget(), this);
 
@@ -574,6 +597,8 @@ void C_SyvHandlerWidget::m_SetConfigurationAvailable(const bool oq_State)
    const bool q_ServiceModeActive = C_PuiSvHandler::h_GetInstance()->GetServiceModeActive();
 
    Q_EMIT this->SigEnableUserInputFunc(mhu32_USER_INPUT_FUNC_SETTINGS, oq_State && (!q_ServiceModeActive));
+   // Recording is exported while disconnected only; also available in service mode
+   Q_EMIT this->SigEnableUserInputFunc(mhu32_USER_INPUT_FUNC_EXPORT_RECORDING, oq_State);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -81,6 +81,7 @@ private:
    static const uint32_t mhu32_USER_INPUT_FUNC_APPLY;
    static const uint32_t mhu32_USER_INPUT_FUNC_SETTINGS;
    static const uint32_t mhu32_USER_INPUT_FUNC_DEVICECONFIG;
+   static const uint32_t mhu32_USER_INPUT_FUNC_EXPORT_RECORDING;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -15,12 +15,14 @@
 #include "precomp_headers.hpp"
 
 #include "stwerrors.hpp"
+#include "TglTime.hpp"
 
 #include "C_SyvComDataDealer.hpp"
 #include "C_OscLoggingHandler.hpp"
 #include "C_PuiSvDbDataElementContent.hpp"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::tgl;
 using namespace stw::errors;
 using namespace stw::opensyde_gui_logic;
 using namespace stw::opensyde_core;
@@ -44,7 +46,8 @@ using namespace stw::opensyde_core;
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDataDealer::C_SyvComDataDealer(void) :
-   C_OscDataDealerNvmSafe()
+   C_OscDataDealerNvmSafe(),
+   mpc_SignalRecorder(NULL)
 {
 }
 
@@ -60,7 +63,8 @@ C_SyvComDataDealer::C_SyvComDataDealer(void) :
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDataDealer::C_SyvComDataDealer(C_OscNode * const opc_Node, const uint32_t ou32_NodeIndex,
                                        C_OscDiagProtocolBase * const opc_DiagProtocol) :
-   C_OscDataDealerNvmSafe(opc_Node, ou32_NodeIndex, opc_DiagProtocol)
+   C_OscDataDealerNvmSafe(opc_Node, ou32_NodeIndex, opc_DiagProtocol),
+   mpc_SignalRecorder(NULL)
 {
 }
 
@@ -124,6 +128,20 @@ void C_SyvComDataDealer::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set recorder for all received data pool values
+
+   Values are recorded independent of the registered widgets.
+   Must not be changed while communication is running.
+
+   \param[in]  opc_Recorder  Recorder (NULL: no recording)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDataDealer::SetSignalRecorder(C_SyvComSignalRecorder * const opc_Recorder)
+{
+   this->mpc_SignalRecorder = opc_Recorder;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read data from server's data pool and updates the associated widgets
 
@@ -325,8 +343,17 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventReceivedForWidget(const uint8_t ou
                                                        ou16_ElementIndex);
       const C_OscNodeDataPoolContent * const pc_ElementContent =
          &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_Value;
+      C_OscNodeDataPoolContent c_Content;
+      this->mc_CriticalSectionContent.Acquire();
+      c_Content = *pc_ElementContent;
+      this->mc_CriticalSectionContent.Release();
       // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-      const C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+      const C_PuiSvDbDataElementContent c_DbContent(c_Content);
+
+      if (this->mpc_SignalRecorder != NULL)
+      {
+         this->mpc_SignalRecorder->Record(c_ElementId, c_Content, TglGetTickCountUs());
+      }
 
       // Update the value
       opc_DashboardWidget->InsertNewValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
@@ -351,30 +378,46 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventReceived(const uint8_t ou8_DataPoo
       // Get the correct list with all pointers to the widgets which are showing this datapool element
       c_ItElement = this->mc_AllWidgets.find(c_ElementId);
 
-      if (c_ItElement != this->mc_AllWidgets.end())
+      if ((c_ItElement != this->mc_AllWidgets.end()) || (this->mpc_SignalRecorder != NULL))
       {
-         const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
-         QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
          const C_OscNodeDataPoolContent * const pc_ElementContent =
             &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_Value;
-         // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-         const C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         C_OscNodeDataPoolContent c_Content;
+         this->mc_CriticalSectionContent.Acquire();
+         c_Content = *pc_ElementContent;
+         this->mc_CriticalSectionContent.Release();
 
-         for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
+         // Recording does not depend on any widget showing the value
+         if (this->mpc_SignalRecorder != NULL)
+         {
+            this->mpc_SignalRecorder->Record(c_ElementId, c_Content, TglGetTickCountUs());
+         }
+
+         if (c_ItElement != this->mc_AllWidgets.end())
          {
-            // Update only read items here
-            if ((*c_ItWidget)->IsReadItem() == true)
+            const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
+            QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
+            // Create the necessary instance with a copy of the content. The timestamp will be filled in the
+            // constructor
+            const C_PuiSvDbDataElementContent c_DbContent(c_Content);
+
+            for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
             {
-               // Update the value
-               (*c_ItWidget)->InsertNewValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
-                                                                                         C_PuiSvDbNodeDataPoolListElementId
-                                                                                         ::eDATAPOOL_ELEMENT, false,
-                                                                                         0UL),
-                                                      c_DbContent);
+               // Update only read items here
+               if ((*c_ItWidget)->IsReadItem() == true)
+               {
+                  // Update the value
+                  (*c_ItWidget)->InsertNewValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
+                                                                                            C_PuiSvDbNodeDataPoolListElementId
+                                                                                            ::eDATAPOOL_ELEMENT, false,
+                                                                                            0UL),
+                                                         c_DbContent);
+               }
             }
          }
       }
-      else
+
+      if (c_ItElement == this->mc_AllWidgets.end())
       {
          stw::scl::C_SclString c_Info;
          c_Info.PrintFormatted("C_SyvComDataDealer: incoming data with no interested widget " \
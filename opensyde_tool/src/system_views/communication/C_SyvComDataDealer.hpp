@@ -21,6 +21,7 @@
 #include "C_OscDiagProtocolBase.hpp"
 
 #include "C_PuiSvDbDataElementHandler.hpp"
+#include "C_SyvComSignalRecorder.hpp"
 #include "C_OscNodeDataPoolListElementId.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -42,6 +43,7 @@ public:
    ~C_SyvComDataDealer(void) noexcept override;
 
    void RegisterWidget(C_PuiSvDbDataElementHandler * const opc_Widget);
+   void SetSignalRecorder(C_SyvComSignalRecorder * const opc_Recorder);
 
    int32_t DataPoolReadWithWidget(const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
                                   const uint16_t ou16_ElementIndex,
@@ -66,6 +68,7 @@ protected:
 
 private:
    QMap<stw::opensyde_core::C_OscNodeDataPoolListElementId, QList<C_PuiSvDbDataElementHandler *> > mc_AllWidgets;
+   C_SyvComSignalRecorder * mpc_SignalRecorder; ///< Optional recorder of all received values (not owned)
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
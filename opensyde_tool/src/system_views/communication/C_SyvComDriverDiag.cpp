@@ -21,7 +21,9 @@
 #include "C_PuiSdHandler.hpp"
 #include "C_PuiSvData.hpp"
 #include "TglUtils.hpp"
+#include "TglTime.hpp"
 #include "C_OscLoggingHandler.hpp"
+#include "C_OscTraceHandler.hpp"
 #include "C_Uti.hpp"
 #include "C_GtGetText.hpp"
 #include "C_SyvComDriverUtil.hpp"
@@ -30,12 +32,14 @@
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw::errors;
 using namespace stw::scl;
+using namespace stw::tgl;
 using namespace stw::can;
 using namespace stw::opensyde_gui;
 using namespace stw::opensyde_core;
 using namespace stw::opensyde_gui_logic;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_SyvComDriverDiag::mhu32_POLL_READ_RATE_WINDOW_MS = 1000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -58,9 +62,12 @@ using namespace stw::opensyde_gui_logic;
 C_SyvComDriverDiag::C_SyvComDriverDiag(const uint32_t ou32_ViewIndex) :
    QObject(),
    C_OscComDriverProtocol(),
+   mu32_PollReadNodeIndex(0U),
+   mu32_PollReadElements(0U),
    mu32_ViewIndex(ou32_ViewIndex),
    mpc_CanDllDispatcher(NULL),
-   mpc_EthernetDispatcher(NULL)
+   mpc_EthernetDispatcher(NULL),
+   mpc_SignalRecorder(NULL)
 {
    mpc_AsyncThread = new C_SyvComDriverThread(&C_SyvComDriverDiag::mh_ThreadFunc, this);
 
@@ -140,6 +147,7 @@ C_SyvComDriverDiag::~C_SyvComDriverDiag(void)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SyvComDriverDiag::InitDiag(void)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Init diagnostics");
    int32_t s32_Return;
    uint32_t u32_ActiveBusIndex;
    uint32_t u32_ActiveNodeCounter;
@@ -270,6 +278,7 @@ int32_t C_SyvComDriverDiag::InitDiag(void)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SyvComDriverDiag::SetDiagnosticMode(QString & orc_ErrorDetails)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Set diagnostic mode");
    int32_t s32_Return;
 
    this->mc_DefectNodeIndices.clear();
@@ -351,6 +360,7 @@ int32_t C_SyvComDriverDiag::SetUpCyclicTransmissions(QString & orc_ErrorDetails,
                                                                                                                                                                                     uint32_t> & orc_FailedNodesElementNumber, std::map<uint32_t,
                                                                                                                                                                                                                                        uint32_t> & orc_NodesElementNumber)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Set up cyclic transmissions");
    int32_t s32_Return = C_NO_ERR;
    const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
 
@@ -639,6 +649,7 @@ int32_t C_SyvComDriverDiag::SetUpCyclicTransmissions(QString & orc_ErrorDetails,
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SyvComDriverDiag::StopCyclicTransmissions(void)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Stop cyclic transmissions");
    int32_t s32_Return = C_NO_ERR;
    const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
 
@@ -781,10 +792,99 @@ int32_t C_SyvComDriverDiag::PollDataPoolRead(const uint32_t ou32_NodeIndex, cons
       s32_Return = mc_PollingThread.StartDataPoolRead((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
                                                       ou16_ListIndex, ou16_ElementIndex,
                                                       opc_DashboardWidget);
+      if (s32_Return == C_NO_ERR)
+      {
+         this->mu32_PollReadNodeIndex = ou32_NodeIndex;
+         this->mu32_PollReadElements = 1U;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start thread for polled reading of multiple elements of one node
+
+   All elements are read in one run of the polling thread.
+   Compared to one PollDataPoolRead call per element this saves the thread start and the event loop round trip
+   for each element.
+   The protocol has no service to read multiple elements at once and only one request per node can be pending;
+   so the services are still sent one after another.
+
+   SigPollingFinished is emitted once after all elements were handled. Its result is the result of the first failed
+   read. Reading continues after negative responses but stops on communication errors.
+
+   \param[in]  ou32_NodeIndex          node index to read from
+   \param[in]  orc_ElementIds          elements to read (node index is ignored)
+   \param[in]  orc_DashboardWidgets    Optional pointer to dashboard widget data element for each element
+                                          Valid pointer: read value only for this widget with this Datapool element
+                                          NULL pointer:  read value for all widgets with this Datapool element
+
+   \return
+   C_NO_ERR  started polling
+   C_RANGE   node index out of range or number of widgets does not match number of elements
+   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComDriverDiag::PollDataPoolReadMultiple(const uint32_t ou32_NodeIndex,
+                                                     const std::vector<C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                                     const std::vector<C_PuiSvDbDataElementHandler *> & orc_DashboardWidgets)
+{
+   int32_t s32_Return;
+   const uint32_t u32_ActiveIndex = this->m_GetActiveDiagIndex(ou32_NodeIndex);
+
+   if (u32_ActiveIndex >= mc_DataDealers.size())
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      s32_Return = mc_PollingThread.StartDataPoolReadMultiple((*mc_DataDealers[u32_ActiveIndex]), orc_ElementIds,
+                                                              orc_DashboardWidgets);
+      if (s32_Return == C_NO_ERR)
+      {
+         this->mu32_PollReadNodeIndex = ou32_NodeIndex;
+         this->mu32_PollReadElements = static_cast<uint32_t>(orc_ElementIds.size());
+      }
    }
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get achieved rate of polled element reads of one node
+
+   Counts all elements successfully read by PollDataPoolRead and PollDataPoolReadMultiple.
+   The rate is measured in windows of one second. If no polled reads took place for longer than that the rate
+   decays accordingly.
+
+   \param[in]  ou32_NodeIndex   node index
+
+   \return
+   element updates per second (0 if the node was never polled)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_SyvComDriverDiag::GetPolledElementUpdatesPerSecond(const uint32_t ou32_NodeIndex) const
+{
+   float64_t f64_Rate = 0.0;
+   const std::map<uint32_t, C_SyvComDriverDiagPollReadRate>::const_iterator c_It =
+      this->mc_PollReadRates.find(ou32_NodeIndex);
+
+   if (c_It != this->mc_PollReadRates.end())
+   {
+      const uint32_t u32_Elapsed = stw::tgl::TglGetTickCount() - c_It->second.u32_WindowStartMs;
+      if (u32_Elapsed >= (2U * mhu32_POLL_READ_RATE_WINDOW_MS))
+      {
+         //no completed window for a while: report what the open window achieved so far
+         f64_Rate = (static_cast<float64_t>(c_It->second.u32_ElementsInWindow) * 1000.0) /
+                    static_cast<float64_t>(u32_Elapsed);
+      }
+      else
+      {
+         f64_Rate = c_It->second.f64_ElementsPerSecond;
+      }
+   }
+   return f64_Rate;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Start thread for polled writing to data pool
 
@@ -1349,6 +1449,8 @@ const std::vector<C_SyvComDataDealer *> & C_SyvComDriverDiag::GetAllDataDealer(v
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Adds a widget to inform about new datapool com signal events
 
+   The threads of this driver become the new producers of the values of the widget.
+
    \param[in]  opc_Widget  Pointer to dashboard widget base
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -1358,6 +1460,8 @@ void C_SyvComDriverDiag::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
    {
       uint32_t u32_Counter;
 
+      opc_Widget->ResetValueProducers();
+
       for (u32_Counter = 0U; u32_Counter < opc_Widget->GetWidgetDataPoolElementCount(); ++u32_Counter)
       {
          C_PuiSvDbNodeDataPoolListElementId c_DpElementId;
@@ -1388,28 +1492,7 @@ void C_SyvComDriverDiag::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
                   QMap<C_OscCanMessageUniqueId, QList<C_SyvComDriverDiagWidgetRegistration> >::iterator c_ItElement;
 
                   c_WidgetRegistration.c_Signal = *pc_Signal;
-
-                  if (c_WidgetRegistration.c_Signal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)
-                  {
-                     uint32_t u32_SignalCounter;
-                     bool q_MultiplexerSignalFound = false;
-
-                     // Special case: This signal is multiplexed. It is necessary to know the multiplexer signal
-                     for (u32_SignalCounter = 0U; u32_SignalCounter < pc_CanMsg->c_Signals.size(); ++u32_SignalCounter)
-                     {
-                        if (pc_CanMsg->c_Signals[u32_SignalCounter].e_MultiplexerType ==
-                            C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL)
-                        {
-                           // Save the multiplexer signal
-                           c_WidgetRegistration.c_MultiplexerSignal = pc_CanMsg->c_Signals[u32_SignalCounter];
-                           q_MultiplexerSignalFound = true;
-                           break;
-                        }
-                     }
-
-                     // A multiplexer signal must exist if at least one multiplexed signal is present
-                     tgl_assert(q_MultiplexerSignalFound == true);
-                  }
+                  C_SyvComDriverDiag::mh_SetMultiplexerSignal(*pc_CanMsg, c_WidgetRegistration);
 
                   c_WidgetRegistration.pc_Handler = opc_Widget;
                   c_WidgetRegistration.q_IsExtended = pc_CanMsg->q_IsExtended;
@@ -1449,6 +1532,28 @@ void C_SyvComDriverDiag::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set recorder for all received values of this view
+
+   Records all cyclically received data pool elements of the data dealers and all signals of the COMM messages
+   on the bus of the view. Must be called before InitDiag.
+
+   \param[in]  opc_Recorder  Recorder (NULL: no recording); must stay valid as long as this driver exists
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::SetSignalRecorder(C_SyvComSignalRecorder * const opc_Recorder)
+{
+   this->mpc_SignalRecorder = opc_Recorder;
+   for (uint32_t u32_DealerIndex = 0U; u32_DealerIndex < this->mc_DataDealers.size(); ++u32_DealerIndex)
+   {
+      if (this->mc_DataDealers[u32_DealerIndex] != NULL)
+      {
+         this->mc_DataDealers[u32_DealerIndex]->SetSignalRecorder(opc_Recorder);
+      }
+   }
+   this->m_InitRecordedSignals();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the information about the routing configuration
 
@@ -1576,12 +1681,13 @@ bool C_SyvComDriverDiag::m_CheckInterfaceForFunctions(const C_OscNodeComInterfac
 void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx)
 {
    const bool q_IsExtended = orc_Msg.u8_XTD == 1;
+   const C_OscCanMessageUniqueId c_MsgCanId(orc_Msg.u32_ID, q_IsExtended);
 
    C_OscComDriverBase::m_HandleCanMessage(orc_Msg, oq_IsTx);
    QMap<C_OscCanMessageUniqueId, QList<C_SyvComDriverDiagWidgetRegistration> >::const_iterator c_ItElement;
 
    // Check if this CAN message id is relevant
-   c_ItElement = this->mc_AllWidgets.find(C_OscCanMessageUniqueId(orc_Msg.u32_ID, q_IsExtended));
+   c_ItElement = this->mc_AllWidgets.find(c_MsgCanId);
 
    if (c_ItElement != this->mc_AllWidgets.end())
    {
@@ -1597,67 +1703,14 @@ void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, con
          if (((orc_Msg.u8_XTD == 1U) == rc_WidgetRegistration.q_IsExtended) &&
              (rc_WidgetRegistration.pc_Handler != NULL))
          {
-            bool q_SignalFits;
-            bool q_DlcErrorPossible = true;
-
-            if (rc_WidgetRegistration.c_Signal.e_MultiplexerType != C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)
-            {
-               // No multiplexed signal, no dependency of a multiplexer value
-               q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, rc_WidgetRegistration.c_Signal);
-            }
-            else
-            {
-               // Multiplexed signal. Checking the multiplexer signal first
-               q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC,
-                                                                rc_WidgetRegistration.c_MultiplexerSignal);
-
-               if (q_SignalFits == true)
-               {
-                  // Multiplexer fits into the message. Get the multiplexer value
-                  C_PuiSvDbDataElementContent c_MultiplexerContent;
-                  C_OscCanUtil::h_GetSignalValue(orc_Msg.au8_Data, rc_WidgetRegistration.c_MultiplexerSignal,
-                                                 c_MultiplexerContent);
-                  const C_OscNodeDataPoolContent::E_Type e_Type = c_MultiplexerContent.GetType();
-                  uint16_t u16_MultiplexerValue;
-
-                  // Multiplexer can be maximum 16 bit
-                  if (e_Type == C_OscNodeDataPoolContent::eUINT8)
-                  {
-                     u16_MultiplexerValue = c_MultiplexerContent.GetValueU8();
-                  }
-                  else if (e_Type == C_OscNodeDataPoolContent::eUINT16)
-                  {
-                     u16_MultiplexerValue = c_MultiplexerContent.GetValueU16();
-                  }
-                  else
-                  {
-                     // May not happen
-                     tgl_assert(false);
-                     u16_MultiplexerValue = 0;
-                  }
-
-                  if (rc_WidgetRegistration.c_Signal.u16_MultiplexValue == u16_MultiplexerValue)
-                  {
-                     // The multiplexer value is matching. The signal is in the message.
-                     q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, rc_WidgetRegistration.c_Signal);
-                  }
-                  else
-                  {
-                     // The multiplexer value is not matching. The signal is not in the message, but it is no DLC error.
-                     q_SignalFits = false;
-                     q_DlcErrorPossible = false;
-                  }
-               }
-            }
+            C_PuiSvDbDataElementContent c_Content;
+            bool q_DlcErrorPossible;
 
-            if (q_SignalFits == true)
+            if (C_SyvComDriverDiag::mh_GetSignalValue(orc_Msg, rc_WidgetRegistration, c_Content,
+                                                      q_DlcErrorPossible) == true)
             {
-               C_PuiSvDbDataElementContent c_Content;
                const uint64_t u64_TimeStamp = orc_Msg.u64_TimeStamp / 1000U;
 
-               // Get the content
-               c_Content = rc_WidgetRegistration.c_ElementContent;
-               C_OscCanUtil::h_GetSignalValue(orc_Msg.au8_Data, rc_WidgetRegistration.c_Signal, c_Content);
                c_Content.SetTimeStamp(static_cast<uint32_t>(u64_TimeStamp));
 
                rc_WidgetRegistration.pc_Handler->InsertNewValueIntoQueue(rc_WidgetRegistration.c_ElementId,
@@ -1676,6 +1729,33 @@ void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, con
          }
       }
    }
+
+   if (this->mpc_SignalRecorder != NULL)
+   {
+      // Record all signals of the message independent of the widgets
+      c_ItElement = this->mc_RecordedSignals.find(c_MsgCanId);
+
+      if (c_ItElement != this->mc_RecordedSignals.end())
+      {
+         const QList<C_SyvComDriverDiagWidgetRegistration> & rc_Registrations = c_ItElement.value();
+         QList<C_SyvComDriverDiagWidgetRegistration>::const_iterator c_ItRegistration;
+         // Same time base as the data pool values of the data dealers
+         const uint64_t u64_TimeStampUs = TglGetTickCountUs();
+
+         for (c_ItRegistration = rc_Registrations.begin(); c_ItRegistration != rc_Registrations.end();
+              ++c_ItRegistration)
+         {
+            C_OscNodeDataPoolContent c_Content;
+            bool q_DlcErrorPossible;
+
+            if (C_SyvComDriverDiag::mh_GetSignalValue(orc_Msg, *c_ItRegistration, c_Content,
+                                                      q_DlcErrorPossible) == true)
+            {
+               this->mpc_SignalRecorder->Record(c_ItRegistration->c_ElementId, c_Content, u64_TimeStampUs);
+            }
+         }
+      }
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1691,6 +1771,17 @@ C_SyvComDriverDiag::C_SyvComDriverDiagWidgetRegistration::C_SyvComDriverDiagWidg
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComDriverDiag::C_SyvComDriverDiagPollReadRate::C_SyvComDriverDiagPollReadRate(void) :
+   u32_WindowStartMs(0U),
+   u32_ElementsInWindow(0U),
+   f64_ElementsPerSecond(0.0)
+{
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Check if current equal to orc_Cmp
 
@@ -1880,6 +1971,7 @@ int32_t C_SyvComDriverDiag::m_InitDataDealer(void)
                this->mc_DataDealers[u32_DiagNodeCounter] =
                   new C_SyvComDataDealer(pc_Node, this->mc_ActiveNodesIndexes[u32_ActiveNode],
                                          this->mc_DiagProtocols[u32_ActiveNode]);
+               this->mc_DataDealers[u32_DiagNodeCounter]->SetSignalRecorder(this->mpc_SignalRecorder);
             }
             else
             {
@@ -1928,6 +2020,7 @@ int32_t C_SyvComDriverDiag::m_InitDataDealer(void)
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SyvComDriverDiag::m_StartRoutingDiag(QString & orc_ErrorDetails, std::set<uint32_t> & orc_ErrorActiveNodes)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Start routing");
    int32_t s32_Return = C_NO_ERR;
    uint32_t u32_DiagNodeCounter;
    uint32_t u32_ErrorActiveNodeIndex;
@@ -2007,6 +2100,7 @@ int32_t C_SyvComDriverDiag::m_StartRoutingDiag(QString & orc_ErrorDetails, std::
 //----------------------------------------------------------------------------------------------------------------------
 int32_t C_SyvComDriverDiag::m_StartDiagServers(QString & orc_ErrorDetails)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Start diagnostic servers");
    int32_t s32_Retval = C_NO_ERR;
 
    this->mc_ReadDatapoolMetadata.clear();
@@ -2089,6 +2183,8 @@ int32_t C_SyvComDriverDiag::m_StartDiagServers(QString & orc_ErrorDetails)
 int32_t C_SyvComDriverDiag::m_GetAllDatapoolMetadata(const uint32_t ou32_ActiveDiagNodeIndex,
                                                      QString & orc_ErrorDetails)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Read datapool metadata",
+                                      C_SclString::IntToStr(ou32_ActiveDiagNodeIndex));
    uint32_t u32_ItDataPool;
    int32_t s32_Return = C_NO_ERR;
    // Get the original active node index
@@ -2186,6 +2282,8 @@ int32_t C_SyvComDriverDiag::m_GetAllDatapoolMetadata(const uint32_t ou32_ActiveD
 int32_t C_SyvComDriverDiag::m_CheckOsyDatapoolsAndCreateMapping(const uint32_t ou32_ActiveDiagNodeIndex,
                                                                 QString & orc_ErrorDetails)
 {
+   const C_OscTraceScope c_TraceScope("Dashboard connect", "Check datapools",
+                                      C_SclString::IntToStr(ou32_ActiveDiagNodeIndex));
    int32_t s32_Retval = C_CONFIG;
    QString c_DataPoolErrorString = "";
    // Get the original active node index
@@ -2653,11 +2751,267 @@ void C_SyvComDriverDiag::m_HandlePollingFinished(void)
 
    tgl_assert(this->mc_PollingThread.GetResults(s32_Result) == C_NO_ERR);
    tgl_assert(this->mc_PollingThread.GetNegativeResponseCode(u8_Nrc) == C_NO_ERR);
+   if (this->mu32_PollReadElements > 0U)
+   {
+      uint32_t u32_ElementsRead = 0U;
+      if (this->mu32_PollReadElements == 1U)
+      {
+         u32_ElementsRead = (s32_Result == C_NO_ERR) ? 1U : 0U;
+      }
+      else
+      {
+         tgl_assert(this->mc_PollingThread.GetDataPoolReadMultipleOutput(u32_ElementsRead) == C_NO_ERR);
+      }
+      this->m_UpdatePollReadRate(this->mu32_PollReadNodeIndex, u32_ElementsRead);
+      this->mu32_PollReadElements = 0U;
+   }
    //Start with next one
    this->mc_PollingThread.AcceptNextRequest();
    Q_EMIT this->SigPollingFinished(s32_Result, u8_Nrc);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add finished polled reads to the statistics of a node
+
+   \param[in]  ou32_NodeIndex      node index
+   \param[in]  ou32_ElementsRead   number of successfully read elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::m_UpdatePollReadRate(const uint32_t ou32_NodeIndex, const uint32_t ou32_ElementsRead)
+{
+   const uint32_t u32_Now = stw::tgl::TglGetTickCount();
+   std::map<uint32_t, C_SyvComDriverDiagPollReadRate>::iterator c_It = this->mc_PollReadRates.find(ou32_NodeIndex);
+
+   if (c_It == this->mc_PollReadRates.end())
+   {
+      //first read of this node: start measuring now
+      C_SyvComDriverDiagPollReadRate c_Rate;
+      c_Rate.u32_WindowStartMs = u32_Now;
+      c_It = this->mc_PollReadRates.insert(std::pair<const uint32_t, C_SyvComDriverDiagPollReadRate>(
+                                              ou32_NodeIndex, c_Rate)).first;
+   }
+
+   C_SyvComDriverDiagPollReadRate & rc_Rate = c_It->second;
+   rc_Rate.u32_ElementsInWindow += ou32_ElementsRead;
+   if ((u32_Now - rc_Rate.u32_WindowStartMs) >= mhu32_POLL_READ_RATE_WINDOW_MS)
+   {
+      rc_Rate.f64_ElementsPerSecond = (static_cast<float64_t>(rc_Rate.u32_ElementsInWindow) * 1000.0) /
+                                      static_cast<float64_t>(u32_Now - rc_Rate.u32_WindowStartMs);
+      rc_Rate.u32_WindowStartMs = u32_Now;
+      rc_Rate.u32_ElementsInWindow = 0U;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Collect all signals of the COMM messages on the bus of the view for recording
+
+   Each message is registered once, preferably from the transmitting node.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::m_InitRecordedSignals(void)
+{
+   const C_PuiSvData * const pc_View = C_PuiSvHandler::h_GetInstance()->GetView(this->mu32_ViewIndex);
+
+   this->mc_RecordedSignals.clear();
+
+   if ((this->mpc_SignalRecorder != NULL) && (pc_View != NULL) && (pc_View->GetOscPcData().GetConnected() == true))
+   {
+      const uint32_t u32_BusIndex = pc_View->GetOscPcData().GetBusIndex();
+
+      // First pass: transmitted messages, second pass: received messages without transmitter in the system
+      for (uint32_t u32_ItPass = 0U; u32_ItPass < 2U; ++u32_ItPass)
+      {
+         const bool q_IsTx = (u32_ItPass == 0U);
+
+         for (uint32_t u32_ItNode = 0U; u32_ItNode < C_PuiSdHandler::h_GetInstance()->GetOscNodesSize();
+              ++u32_ItNode)
+         {
+            const C_OscNode * const pc_Node = C_PuiSdHandler::h_GetInstance()->GetOscNodeConst(u32_ItNode);
+
+            if (pc_Node != NULL)
+            {
+               for (uint32_t u32_ItInterface = 0U; u32_ItInterface < pc_Node->c_Properties.c_ComInterfaces.size();
+                    ++u32_ItInterface)
+               {
+                  const C_OscNodeComInterfaceSettings & rc_Interface =
+                     pc_Node->c_Properties.c_ComInterfaces[u32_ItInterface];
+
+                  if ((rc_Interface.e_InterfaceType == C_OscSystemBus::eCAN) &&
+                      (rc_Interface.GetBusConnected() == true) && (rc_Interface.u32_BusIndex == u32_BusIndex))
+                  {
+                     for (uint32_t u32_ItProtocol = 0U; u32_ItProtocol < pc_Node->c_ComProtocols.size();
+                          ++u32_ItProtocol)
+                     {
+                        const C_OscCanProtocol & rc_Protocol = pc_Node->c_ComProtocols[u32_ItProtocol];
+                        uint32_t u32_ListIndex;
+
+                        if ((rc_Interface.u8_InterfaceNumber < rc_Protocol.c_ComMessages.size()) &&
+                            (rc_Protocol.u32_DataPoolIndex < pc_Node->c_DataPools.size()) &&
+                            (C_OscCanProtocol::h_GetComListIndex(pc_Node->c_DataPools[rc_Protocol.u32_DataPoolIndex],
+                                                                 rc_Interface.u8_InterfaceNumber, q_IsTx,
+                                                                 u32_ListIndex) == C_NO_ERR))
+                        {
+                           const C_OscNodeDataPoolList & rc_List =
+                              pc_Node->c_DataPools[rc_Protocol.u32_DataPoolIndex].c_Lists[u32_ListIndex];
+                           const std::vector<C_OscCanMessage> & rc_Messages =
+                              rc_Protocol.c_ComMessages[rc_Interface.u8_InterfaceNumber].GetMessagesConst(q_IsTx);
+
+                           for (uint32_t u32_ItMessage = 0U; u32_ItMessage < rc_Messages.size(); ++u32_ItMessage)
+                           {
+                              const C_OscCanMessage & rc_Message = rc_Messages[u32_ItMessage];
+                              const C_OscCanMessageUniqueId c_MsgCanId(rc_Message.u32_CanId, rc_Message.q_IsExtended);
+
+                              if (this->mc_RecordedSignals.contains(c_MsgCanId) == false)
+                              {
+                                 QList<C_SyvComDriverDiagWidgetRegistration> c_List;
+
+                                 for (uint32_t u32_ItSignal = 0U; u32_ItSignal < rc_Message.c_Signals.size();
+                                      ++u32_ItSignal)
+                                 {
+                                    const C_OscCanSignal & rc_Signal = rc_Message.c_Signals[u32_ItSignal];
+
+                                    if (rc_Signal.u32_ComDataElementIndex < rc_List.c_Elements.size())
+                                    {
+                                       C_SyvComDriverDiagWidgetRegistration c_Registration;
+                                       c_Registration.c_Signal = rc_Signal;
+                                       C_SyvComDriverDiag::mh_SetMultiplexerSignal(rc_Message, c_Registration);
+                                       c_Registration.q_IsExtended = rc_Message.q_IsExtended;
+                                       c_Registration.u16_Dlc = rc_Message.u16_Dlc;
+                                       c_Registration.c_ElementId = C_PuiSvDbNodeDataPoolListElementId(
+                                          u32_ItNode, rc_Protocol.u32_DataPoolIndex, u32_ListIndex,
+                                          rc_Signal.u32_ComDataElementIndex,
+                                          C_PuiSvDbNodeDataPoolListElementId::eBUS_SIGNAL, false, 0UL);
+                                       c_Registration.c_ElementContent =
+                                          rc_List.c_Elements[rc_Signal.u32_ComDataElementIndex].c_Value;
+                                       c_List.push_back(c_Registration);
+                                    }
+                                 }
+                                 this->mc_RecordedSignals.insert(c_MsgCanId, c_List);
+                              }
+                           }
+                        }
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set the multiplexer signal of the message in case of a multiplexed signal registration
+
+   \param[in]      orc_CanMsg        CAN message containing the signal
+   \param[in,out]  orc_Registration  Registration with set c_Signal
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::mh_SetMultiplexerSignal(const C_OscCanMessage & orc_CanMsg,
+                                                 C_SyvComDriverDiagWidgetRegistration & orc_Registration)
+{
+   if (orc_Registration.c_Signal.e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)
+   {
+      uint32_t u32_SignalCounter;
+      bool q_MultiplexerSignalFound = false;
+
+      // Special case: This signal is multiplexed. It is necessary to know the multiplexer signal
+      for (u32_SignalCounter = 0U; u32_SignalCounter < orc_CanMsg.c_Signals.size(); ++u32_SignalCounter)
+      {
+         if (orc_CanMsg.c_Signals[u32_SignalCounter].e_MultiplexerType == C_OscCanSignal::eMUX_MULTIPLEXER_SIGNAL)
+         {
+            // Save the multiplexer signal
+            orc_Registration.c_MultiplexerSignal = orc_CanMsg.c_Signals[u32_SignalCounter];
+            q_MultiplexerSignalFound = true;
+            break;
+         }
+      }
+
+      // A multiplexer signal must exist if at least one multiplexed signal is present
+      tgl_assert(q_MultiplexerSignalFound == true);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Extract the value of a registered signal from a CAN message
+
+   \param[in]   orc_Msg                 Received CAN message
+   \param[in]   orc_Registration        Registration of the signal
+   \param[out]  orc_Content             Signal value (only valid if the signal is in the message)
+   \param[out]  orq_DlcErrorPossible    Only relevant if signal is not in message:
+                                        true: DLC too short; false: other multiplexer value active
+
+   \return
+   true   Signal is in the message
+   false  Signal is not in the message
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComDriverDiag::mh_GetSignalValue(const T_STWCAN_Msg_RX & orc_Msg,
+                                           const C_SyvComDriverDiagWidgetRegistration & orc_Registration,
+                                           C_OscNodeDataPoolContent & orc_Content, bool & orq_DlcErrorPossible)
+{
+   bool q_SignalFits;
+
+   orq_DlcErrorPossible = true;
+
+   if (orc_Registration.c_Signal.e_MultiplexerType != C_OscCanSignal::eMUX_MULTIPLEXED_SIGNAL)
+   {
+      // No multiplexed signal, no dependency of a multiplexer value
+      q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, orc_Registration.c_Signal);
+   }
+   else
+   {
+      // Multiplexed signal. Checking the multiplexer signal first
+      q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, orc_Registration.c_MultiplexerSignal);
+
+      if (q_SignalFits == true)
+      {
+         // Multiplexer fits into the message. Get the multiplexer value
+         C_OscNodeDataPoolContent c_MultiplexerContent;
+         C_OscCanUtil::h_GetSignalValue(orc_Msg.au8_Data, orc_Registration.c_MultiplexerSignal,
+                                        c_MultiplexerContent);
+         const C_OscNodeDataPoolContent::E_Type e_Type = c_MultiplexerContent.GetType();
+         uint16_t u16_MultiplexerValue;
+
+         // Multiplexer can be maximum 16 bit
+         if (e_Type == C_OscNodeDataPoolContent::eUINT8)
+         {
+            u16_MultiplexerValue = c_MultiplexerContent.GetValueU8();
+         }
+         else if (e_Type == C_OscNodeDataPoolContent::eUINT16)
+         {
+            u16_MultiplexerValue = c_MultiplexerContent.GetValueU16();
+         }
+         else
+         {
+            // May not happen
+            tgl_assert(false);
+            u16_MultiplexerValue = 0;
+         }
+
+         if (orc_Registration.c_Signal.u16_MultiplexValue == u16_MultiplexerValue)
+         {
+            // The multiplexer value is matching. The signal is in the message.
+            q_SignalFits = C_OscCanUtil::h_IsSignalInMessage(orc_Msg.u8_DLC, orc_Registration.c_Signal);
+         }
+         else
+         {
+            // The multiplexer value is not matching. The signal is not in the message, but it is no DLC error.
+            q_SignalFits = false;
+            orq_DlcErrorPossible = false;
+         }
+      }
+   }
+
+   if (q_SignalFits == true)
+   {
+      // Get the content
+      orc_Content = orc_Registration.c_ElementContent;
+      C_OscCanUtil::h_GetSignalValue(orc_Msg.au8_Data, orc_Registration.c_Signal, orc_Content);
+   }
+
+   return q_SignalFits;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Reports error details in case of an routing error with check for duplicate entries
 
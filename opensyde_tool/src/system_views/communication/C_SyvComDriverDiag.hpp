@@ -14,11 +14,13 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QObject>
 #include <set>
+#include <map>
 
 #include "stwtypes.hpp"
 
 #include "C_OscComDriverProtocol.hpp"
 #include "C_SyvComDataDealer.hpp"
+#include "C_SyvComSignalRecorder.hpp"
 #include "C_SyvComPollingThreadDiag.hpp"
 #include "C_SyvComDriverThread.hpp"
 #include "C_Can.hpp"
@@ -62,6 +64,10 @@ public:
    int32_t PollDataPoolRead(const uint32_t ou32_NodeIndex, const uint8_t ou8_DataPoolIndex,
                             const uint16_t ou16_ListIndex, const uint16_t ou16_ElementIndex,
                             stw::opensyde_gui_logic::C_PuiSvDbDataElementHandler * const opc_DashboardWidget);
+   int32_t PollDataPoolReadMultiple(const uint32_t ou32_NodeIndex,
+                                    const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                    const std::vector<stw::opensyde_gui_logic::C_PuiSvDbDataElementHandler *> & orc_DashboardWidgets);
+   float64_t GetPolledElementUpdatesPerSecond(const uint32_t ou32_NodeIndex) const;
    int32_t PollDataPoolWrite(const uint32_t ou32_NodeIndex, const uint8_t ou8_DataPoolIndex,
                              const uint16_t ou16_ListIndex, const uint16_t ou16_ElementIndex);
    int32_t PollNvmRead(const uint32_t ou32_NodeIndex, const uint8_t ou8_DataPoolIndex, const uint16_t ou16_ListIndex,
@@ -97,6 +103,7 @@ public:
    const std::vector<C_SyvComDataDealer *> & GetAllDataDealer(void) const;
 
    void RegisterWidget(C_PuiSvDbDataElementHandler * const opc_Widget);
+   void SetSignalRecorder(C_SyvComSignalRecorder * const opc_Recorder);
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -144,8 +151,23 @@ private:
       stw::opensyde_core::C_OscNodeDataPoolContent c_ElementContent;
    };
 
+   ///Statistics of polled element reads of one node
+   class C_SyvComDriverDiagPollReadRate
+   {
+   public:
+      C_SyvComDriverDiagPollReadRate(void);
+
+      uint32_t u32_WindowStartMs;     ///< start of current measurement window
+      uint32_t u32_ElementsInWindow;  ///< elements read in current measurement window
+      float64_t f64_ElementsPerSecond; ///< result of last completed measurement window
+   };
+
    C_SyvComDriverThread * mpc_AsyncThread; ///< Thread for handling all async messages
    C_SyvComPollingThreadDiag mc_PollingThread;
+   uint32_t mu32_PollReadNodeIndex;  ///< node of running polled read
+   uint32_t mu32_PollReadElements;   ///< number of elements of running polled read; 0: no read running
+   std::map<uint32_t, C_SyvComDriverDiagPollReadRate> mc_PollReadRates; ///< polled read statistics per node index
+   static const uint32_t mhu32_POLL_READ_RATE_WINDOW_MS;
 
    std::vector<stw::opensyde_core::C_OscDiagProtocolBase *> mc_DiagProtocols; ///< Holds created
                                                                               // instances of openSYDE protocol
@@ -173,6 +195,10 @@ private:
    // Mapping from CAN-ID to registered widget and its used CAN message signal
    QMap<stw::opensyde_core::C_OscCanMessageUniqueId, QList<C_SyvComDriverDiagWidgetRegistration> > mc_AllWidgets;
 
+   // Recorder for all received values (NULL: no recording) and all bus signals to record (no handler set)
+   C_SyvComSignalRecorder * mpc_SignalRecorder;
+   QMap<stw::opensyde_core::C_OscCanMessageUniqueId, QList<C_SyvComDriverDiagWidgetRegistration> > mc_RecordedSignals;
+
    // Security PEM database
    stw::opensyde_core::C_OscSecurityPemDatabase mc_PemDatabase;
 
@@ -204,6 +230,15 @@ private:
    void m_ThreadFunc(void);
 
    void m_HandlePollingFinished(void);
+   void m_UpdatePollReadRate(const uint32_t ou32_NodeIndex, const uint32_t ou32_ElementsRead);
+
+   void m_InitRecordedSignals(void);
+   static void mh_SetMultiplexerSignal(const stw::opensyde_core::C_OscCanMessage & orc_CanMsg,
+                                       C_SyvComDriverDiagWidgetRegistration & orc_Registration);
+   static bool mh_GetSignalValue(const stw::can::T_STWCAN_Msg_RX & orc_Msg,
+                                 const C_SyvComDriverDiagWidgetRegistration & orc_Registration,
+                                 stw::opensyde_core::C_OscNodeDataPoolContent & orc_Content,
+                                 bool & orq_DlcErrorPossible);
 
    void m_GetRoutingErrorDetails(QString & orc_ErrorDetails, std::set<uint32_t> & orc_ErrorActiveNodes,
                                  const uint32_t ou32_ActiveNode, const uint32_t ou32_ErrorActiveNodeIndex) const;
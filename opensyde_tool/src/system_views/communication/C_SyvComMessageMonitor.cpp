@@ -119,6 +119,21 @@ void C_SyvComMessageMonitor::Stop(void)
    this->mc_CriticalSectionCounter.Release();
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Sets the protocol for interpreting
+
+   Synchronized with HandleCanMessage so a received message is interpreted and cached with one consistent protocol.
+
+   \param[in]  oe_Protocol    Set protocol type
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageMonitor::SetProtocol(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol)
+{
+   this->mc_CriticalSectionCounter.Acquire();
+   C_OscComMessageLogger::SetProtocol(oe_Protocol);
+   this->mc_CriticalSectionCounter.Release();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Starts thread to add openSYDE system definition
 
@@ -755,16 +770,8 @@ void C_SyvComMessageMonitor::m_UpdateProtocolString(C_OscComMessageLoggerData &
    if (orc_MessageData.c_Name == "")
    {
       // No interpretation found, check for classical protocol interpretation
-      orc_MessageData.c_ProtocolTextHex = this->m_GetProtocolStringHex(orc_MessageData.c_CanMsg).c_str();
-      if (orc_MessageData.c_ProtocolTextHex != "")
-      {
-         // Only necessary if a protocol was found in the hex variant
-         orc_MessageData.c_ProtocolTextDec = this->m_GetProtocolStringDec(orc_MessageData.c_CanMsg).c_str();
-      }
-      else
-      {
-         orc_MessageData.c_ProtocolTextDec = "";
-      }
+      this->m_GetProtocolStrings(orc_MessageData.c_CanMsg, orc_MessageData.c_ProtocolTextHex,
+                                 orc_MessageData.c_ProtocolTextDec);
    }
 }
 
@@ -47,6 +47,8 @@ public:
    void Start(void) override;
    void Stop(void) override;
 
+   void SetProtocol(const stw::cmon_protocol::e_CanMonL7Protocols oe_Protocol) override;
+
    // openSYDE system definition handling
    int32_t StartAddOsySysDef(const stw::scl::C_SclString & orc_PathSystemDefinition);
    int32_t StartAddOsySysDef(const stw::scl::C_SclString & orc_PathSystemDefinition, const uint32_t ou32_BusIndex);
@@ -142,6 +142,82 @@ void C_SyvComPollingThreadDiag::m_SetRunParams(const C_SyvComPollingThreadDiag::
    mpc_Dealer = &orc_Dealer;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: remember parameters for service execution
+
+   \param[in]      oe_Service             Service
+   \param[in,out]  orc_Dealer             Dealer
+   \param[in]      orc_ElementIds         Element ids (node index is ignored)
+   \param[in]      orc_DashboardWidgets   Optional dashboard widget for each element (see StartDataPoolRead)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComPollingThreadDiag::m_SetRunParams(const C_SyvComPollingThreadDiag::E_Service oe_Service,
+                                               C_SyvComDataDealer & orc_Dealer,
+                                               const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                               const std::vector<stw::opensyde_gui_logic::C_PuiSvDbDataElementHandler *> & orc_DashboardWidgets)
+{
+   me_Service = oe_Service;
+   mpc_Dealer = &orc_Dealer;
+   mc_ElementIds = orc_ElementIds;
+   mc_DashboardWidgets = orc_DashboardWidgets;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read all elements of a multiple read request
+
+   All elements are read within one thread run so there is no thread start and no event loop round trip between
+   the single services.
+   Negative responses for one element do not stop reading the other elements.
+   Communication errors do, as the following requests would most likely run into the same problem.
+
+   \return
+   C_NO_ERR   all elements read
+   else       result of first failed read (see C_SyvComDataDealer::DataPoolReadWithWidget)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComPollingThreadDiag::m_DataPoolReadMultiple(void)
+{
+   int32_t s32_Return = C_NO_ERR;
+   bool q_Abort = false;
+
+   this->mu32_ElementsRead = 0U;
+   for (uint32_t u32_ItElement = 0U; (u32_ItElement < this->mc_ElementIds.size()) && (q_Abort == false);
+        ++u32_ItElement)
+   {
+      const stw::opensyde_core::C_OscNodeDataPoolListElementId & rc_Id = this->mc_ElementIds[u32_ItElement];
+      uint8_t u8_Nrc = 0U;
+      const int32_t s32_Result =
+         mpc_Dealer->DataPoolReadWithWidget(static_cast<uint8_t>(rc_Id.u32_DataPoolIndex),
+                                            static_cast<uint16_t>(rc_Id.u32_ListIndex),
+                                            static_cast<uint16_t>(rc_Id.u32_ElementIndex),
+                                            this->mc_DashboardWidgets[u32_ItElement], &u8_Nrc);
+
+      if (s32_Result == C_NO_ERR)
+      {
+         ++this->mu32_ElementsRead;
+      }
+      else
+      {
+         if (s32_Return == C_NO_ERR)
+         {
+            //report the first problem
+            s32_Return = s32_Result;
+            this->mu8_Nrc = u8_Nrc;
+         }
+         if ((s32_Result == C_TIMEOUT) || (s32_Result == C_NOACT) || (s32_Result == C_COM) ||
+             (s32_Result == C_CONFIG))
+         {
+            q_Abort = true;
+         }
+      }
+      if (this->isInterruptionRequested() == true)
+      {
+         q_Abort = true;
+      }
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Thread function
 
@@ -156,6 +232,9 @@ void C_SyvComPollingThreadDiag::run(void)
       ms32_Result = mpc_Dealer->DataPoolReadWithWidget(mu8_DataPoolIndex, mu16_ListIndex, mu16_ElementIndex,
                                                        mpc_DashboardWidget, &mu8_Nrc);
       break;
+   case eDPREADMULTIPLE:
+      ms32_Result = this->m_DataPoolReadMultiple();
+      break;
    case eDPWRITE:
       ms32_Result = mpc_Dealer->DataPoolWrite(mu8_DataPoolIndex, mu16_ListIndex, mu16_ElementIndex, &mu8_Nrc);
       break;
@@ -207,6 +286,7 @@ C_SyvComPollingThreadDiag::C_SyvComPollingThreadDiag(void) :
    mu16_ElementIndex(0U),
    mpc_DashboardWidget(NULL),
    mpc_ParamNodeValues(NULL),
+   mu32_ElementsRead(0U),
    mq_ApplicationAcknowledge(false),
    ms32_Result(C_UNKNOWN_ERR),
    mu8_Nrc(0),
@@ -262,6 +342,75 @@ int32_t C_SyvComPollingThreadDiag::StartDataPoolRead(C_SyvComDataDealer & orc_De
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start executing service in thread
+
+   Reads multiple elements of one node in one thread run.
+   The protocol has no service to read multiple elements at once; so the elements are read one after another.
+
+   \param[in]  orc_Dealer              data dealer to use
+   \param[in]  orc_ElementIds          elements to read (node index is ignored)
+   \param[in]  orc_DashboardWidgets    Optional pointer to dashboard widget data element for each element
+                                          Valid pointer: read value only for this widget with this Datapool element
+                                          NULL pointer:  read value for all widgets with this Datapool element
+
+   \return
+   C_NO_ERR   started polling
+   C_RANGE    number of widgets does not match number of elements
+   C_BUSY     previously started polled communication still going on
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComPollingThreadDiag::StartDataPoolReadMultiple(C_SyvComDataDealer & orc_Dealer,
+                                                             const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                                             const std::vector<C_PuiSvDbDataElementHandler *> & orc_DashboardWidgets)
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if ((this->isRunning() == true) || (this->mq_AcceptNextRequest == false))
+   {
+      s32_Return = C_BUSY;
+   }
+   else if (orc_ElementIds.size() != orc_DashboardWidgets.size())
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->mq_AcceptNextRequest = false;
+      this->m_SetRunParams(eDPREADMULTIPLE, orc_Dealer, orc_ElementIds, orc_DashboardWidgets);
+      this->start();
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Returns the output of the multiple element read
+
+   Must be called after the thread was finished after calling StartDataPoolReadMultiple
+
+   \param[out]  oru32_ElementsRead   number of successfully read elements
+
+   \return
+   C_NO_ERR   result returned
+   C_BUSY     previously started polled communication still going on
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComPollingThreadDiag::GetDataPoolReadMultipleOutput(uint32_t & oru32_ElementsRead) const
+{
+   int32_t s32_Return = C_NO_ERR;
+
+   if (this->isRunning() == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else
+   {
+      oru32_ElementsRead = this->mu32_ElementsRead;
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Start executing service in thread
 
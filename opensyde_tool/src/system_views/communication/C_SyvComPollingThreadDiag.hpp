@@ -36,6 +36,7 @@ private:
    enum E_Service
    {
       eDPREAD,
+      eDPREADMULTIPLE,
       eDPWRITE,
       eNVMREAD,
       eNVMWRITE,
@@ -58,6 +59,10 @@ private:
    void m_SetRunParams(const E_Service oe_Service, stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
                        const std::vector<stw::opensyde_core::C_OscNodeDataPoolListId> & orc_ListIds);
    void m_SetRunParams(const E_Service oe_Service, stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer);
+   void m_SetRunParams(const E_Service oe_Service, stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
+                       const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                       const std::vector<stw::opensyde_gui_logic::C_PuiSvDbDataElementHandler *> & orc_DashboardWidgets);
+   int32_t m_DataPoolReadMultiple(void);
 
    //service execution parameters:
    E_Service me_Service;
@@ -69,8 +74,11 @@ private:
    stw::opensyde_gui_logic::C_PuiSvDbDataElementHandler * mpc_DashboardWidget;
    const stw::opensyde_core::C_OscNode * mpc_ParamNodeValues;
    std::vector<stw::opensyde_core::C_OscNodeDataPoolListId>  mc_ListIds;
+   std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> mc_ElementIds;
+   std::vector<stw::opensyde_gui_logic::C_PuiSvDbDataElementHandler *> mc_DashboardWidgets;
    // Output
    std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> mc_ChangedElements;
+   uint32_t mu32_ElementsRead;
    bool mq_ApplicationAcknowledge;
    //service execution result:
    int32_t ms32_Result;
@@ -87,6 +95,10 @@ public:
    int32_t StartDataPoolRead(stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer, const uint8_t ou8_DataPoolIndex,
                              const uint16_t ou16_ListIndex, const uint16_t ou16_ElementIndex,
                              C_PuiSvDbDataElementHandler * const opc_DashboardWidget);
+   int32_t StartDataPoolReadMultiple(stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer,
+                                     const std::vector<stw::opensyde_core::C_OscNodeDataPoolListElementId> & orc_ElementIds,
+                                     const std::vector<C_PuiSvDbDataElementHandler *> & orc_DashboardWidgets);
+   int32_t GetDataPoolReadMultipleOutput(uint32_t & oru32_ElementsRead) const;
    int32_t StartDataPoolWrite(stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer, const uint8_t ou8_DataPoolIndex,
                               const uint16_t ou16_ListIndex, const uint16_t ou16_ElementIndex);
    int32_t StartNvmRead(stw::opensyde_gui_logic::C_SyvComDataDealer & orc_Dealer, const uint8_t ou8_DataPoolIndex,
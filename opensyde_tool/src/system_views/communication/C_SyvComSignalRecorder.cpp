@@ -0,0 +1,520 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Columnar recorder of all received datapool element and CAN signal values
+
+   Records every value the communication driver receives, independent of the widgets showing it.
+
+   Each datapool element (resp. each element of an array) is stored in its own column.
+   A column consists of fixed size chunks holding the time stamps as 32 bit offsets to the first time stamp of
+   the chunk and the unscaled values as float64.
+   This needs 12 bytes per sample and no allocation apart from one per chunk.
+
+   The memory is bounded: when the configured maximum is reached, the chunk which was allocated first is
+   dropped and reused. As chunks fill up with similar rates, this keeps roughly the newest part of each column.
+
+   All functions are thread safe. Recording waits while an export is running.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+#include <QFile>
+#include <QTextStream>
+
+#include "stwerrors.hpp"
+#include "C_OscUtils.hpp"
+#include "C_PuiSdUtil.hpp"
+#include "C_PuiSdHandler.hpp"
+#include "C_SyvComSignalRecorder.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::opensyde_core;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+// Default limit of memory for samples (about 22 million samples)
+static const uint64_t mu64_DEFAULT_MAX_MEMORY = 256ULL * 1024ULL * 1024ULL;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComSignalRecorder::C_SyvComSignalRecorder(void) :
+   mu32_MaxChunks(1U),
+   mu64_NumSamples(0ULL),
+   mu64_NumDroppedSamples(0ULL)
+{
+   this->SetMaxMemory(mu64_DEFAULT_MAX_MEMORY);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Destructor
+
+   Release all chunks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComSignalRecorder::~C_SyvComSignalRecorder(void)
+{
+   this->m_ClearColumns();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set the maximum memory used for samples
+
+   Already recorded samples above the new limit are dropped with the next recorded value.
+
+   \param[in]  ou64_MaxBytes  Maximum number of bytes (at least one chunk is kept)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComSignalRecorder::SetMaxMemory(const uint64_t ou64_MaxBytes)
+{
+   const uint64_t u64_MaxChunks = ou64_MaxBytes / sizeof(C_Chunk);
+
+   this->mc_CriticalSection.Acquire();
+   this->mu32_MaxChunks = static_cast<uint32_t>(std::min(std::max(u64_MaxChunks, static_cast<uint64_t>(1U)),
+                                                          static_cast<uint64_t>(0xFFFFFFFFUL)));
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove all recorded values
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComSignalRecorder::Clear(void)
+{
+   this->mc_CriticalSection.Acquire();
+   this->m_ClearColumns();
+   this->mu64_NumSamples = 0ULL;
+   this->mu64_NumDroppedSamples = 0ULL;
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Record a received value
+
+   \param[in]  orc_Id            Datapool element the value belongs to
+   \param[in]  orc_Value         Received value
+   \param[in]  ou64_TimeStampUs  Time of reception
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComSignalRecorder::Record(const C_OscNodeDataPoolListElementId & orc_Id,
+                                    const C_OscNodeDataPoolContent & orc_Value, const uint64_t ou64_TimeStampUs)
+{
+   this->mc_CriticalSection.Acquire();
+   if (orc_Value.GetArray() == false)
+   {
+      float64_t f64_Value;
+      orc_Value.GetAnyValueAsFloat64(f64_Value, 0UL);
+      this->m_Append(C_ColumnId(orc_Id, 0UL), ou64_TimeStampUs, f64_Value);
+   }
+   else
+   {
+      for (uint32_t u32_ItArray = 0UL; u32_ItArray < orc_Value.GetArraySize(); ++u32_ItArray)
+      {
+         float64_t f64_Value;
+         C_ColumnId c_Id(orc_Id, u32_ItArray);
+         c_Id.q_IsArray = true;
+         orc_Value.GetAnyValueAsFloat64(f64_Value, u32_ItArray);
+         this->m_Append(c_Id, ou64_TimeStampUs, f64_Value);
+      }
+   }
+   this->mc_CriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of recorded columns
+
+   \return
+   Number of recorded datapool elements (each array element counts separately)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_SyvComSignalRecorder::GetNumColumns(void) const
+{
+   uint32_t u32_Retval;
+
+   this->mc_CriticalSection.Acquire();
+   u32_Retval = static_cast<uint32_t>(this->mc_Columns.size());
+   this->mc_CriticalSection.Release();
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of stored samples
+
+   \return
+   Number of samples available for export
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SyvComSignalRecorder::GetNumSamples(void) const
+{
+   uint64_t u64_Retval;
+
+   this->mc_CriticalSection.Acquire();
+   u64_Retval = this->mu64_NumSamples;
+   this->mc_CriticalSection.Release();
+   return u64_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get number of samples dropped because of the memory limit
+
+   \return
+   Number of dropped samples since the last clear
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SyvComSignalRecorder::GetNumDroppedSamples(void) const
+{
+   uint64_t u64_Retval;
+
+   this->mc_CriticalSection.Acquire();
+   u64_Retval = this->mu64_NumDroppedSamples;
+   this->mc_CriticalSection.Release();
+   return u64_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get memory used for samples
+
+   \return
+   Number of bytes of all allocated chunks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SyvComSignalRecorder::GetMemoryUsage(void) const
+{
+   uint64_t u64_Retval;
+
+   this->mc_CriticalSection.Acquire();
+   u64_Retval = static_cast<uint64_t>(this->mc_ChunkOrder.size()) * sizeof(C_Chunk);
+   this->mc_CriticalSection.Release();
+   return u64_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Export all recorded values to a CSV file
+
+   Same layout as the chart export: each column is written as pair of time stamp in ms (relative to the first
+   recorded value) and the scaled value. Columns with less samples are filled up with empty entries.
+
+   \param[in]  orc_FilePath   Path of CSV file (is overwritten)
+
+   \return
+   C_NO_ERR    File written
+   C_NOACT     Nothing recorded
+   C_RD_WR     Could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvComSignalRecorder::ExportCsv(const QString & orc_FilePath) const
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   this->mc_CriticalSection.Acquire();
+   if (this->mu64_NumSamples == 0ULL)
+   {
+      s32_Retval = C_NOACT;
+   }
+   else
+   {
+      QFile c_File(orc_FilePath);
+      if (c_File.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text) == false)
+      {
+         s32_Retval = C_RD_WR;
+      }
+      else
+      {
+         QTextStream c_Out(&c_File);
+         std::vector<float64_t> c_Factors;
+         std::vector<float64_t> c_Offsets;
+         std::vector<uint32_t> c_ChunkPositions(this->mc_Columns.size(), 0UL);
+         std::vector<uint32_t> c_SamplePositions(this->mc_Columns.size(), 0UL);
+         uint64_t u64_StartUs = 0xFFFFFFFFFFFFFFFFULL;
+         uint64_t u64_NumRows = 0ULL;
+         QString c_Header;
+
+         c_Out.setRealNumberPrecision(15);
+         c_Factors.reserve(this->mc_Columns.size());
+         c_Offsets.reserve(this->mc_Columns.size());
+         for (uint32_t u32_ItCol = 0UL; u32_ItCol < this->mc_Columns.size(); ++u32_ItCol)
+         {
+            const C_Column & rc_Column = this->mc_Columns[u32_ItCol];
+            const C_OscNodeDataPoolListElement * const pc_Element =
+               C_PuiSdHandler::h_GetInstance()->GetOscDataPoolListElement(rc_Column.c_Id.c_ElementId);
+            QString c_Name = C_PuiSdUtil::h_GetNamespace(rc_Column.c_Id.c_ElementId);
+            QString c_Unit;
+            uint64_t u64_NumSamples = 0ULL;
+
+            if (rc_Column.c_Id.q_IsArray == true)
+            {
+               c_Name += static_cast<QString>("[%1]").arg(rc_Column.c_Id.u32_ArrayIndex);
+            }
+            if (pc_Element != NULL)
+            {
+               c_Unit = pc_Element->c_Unit.c_str();
+               c_Factors.push_back(pc_Element->f64_Factor);
+               c_Offsets.push_back(pc_Element->f64_Offset);
+            }
+            else
+            {
+               c_Factors.push_back(1.0);
+               c_Offsets.push_back(0.0);
+            }
+            c_Header += "Timestamp (ms);" + c_Name + " (" + c_Unit + ")";
+            if (u32_ItCol < (this->mc_Columns.size() - 1UL))
+            {
+               c_Header += ";";
+            }
+
+            for (uint32_t u32_ItChunk = 0UL; u32_ItChunk < rc_Column.c_Chunks.size(); ++u32_ItChunk)
+            {
+               u64_NumSamples += rc_Column.c_Chunks[u32_ItChunk]->u32_Count;
+            }
+            u64_NumRows = std::max(u64_NumRows, u64_NumSamples);
+            if (rc_Column.c_Chunks.empty() == false)
+            {
+               u64_StartUs = std::min(u64_StartUs, rc_Column.c_Chunks.front()->u64_FirstTimeStampUs);
+            }
+         }
+         c_Out << c_Header << "\n";
+
+         for (uint64_t u64_ItRow = 0ULL; u64_ItRow < u64_NumRows; ++u64_ItRow)
+         {
+            for (uint32_t u32_ItCol = 0UL; u32_ItCol < this->mc_Columns.size(); ++u32_ItCol)
+            {
+               const C_Column & rc_Column = this->mc_Columns[u32_ItCol];
+               uint32_t & ru32_ChunkPos = c_ChunkPositions[u32_ItCol];
+               uint32_t & ru32_SamplePos = c_SamplePositions[u32_ItCol];
+
+               if (ru32_ChunkPos < rc_Column.c_Chunks.size())
+               {
+                  const C_Chunk & rc_Chunk = *rc_Column.c_Chunks[ru32_ChunkPos];
+                  const uint64_t u64_TimeUs = (rc_Chunk.u64_FirstTimeStampUs +
+                                               rc_Chunk.au32_TimeOffsetsUs[ru32_SamplePos]) - u64_StartUs;
+                  c_Out << QString::number(static_cast<float64_t>(u64_TimeUs) / 1000.0, 'f', 3) << ";" <<
+                     C_OscUtils::h_GetValueScaled(rc_Chunk.af64_Values[ru32_SamplePos], c_Factors[u32_ItCol],
+                                                  c_Offsets[u32_ItCol]);
+                  ++ru32_SamplePos;
+                  if (ru32_SamplePos >= rc_Chunk.u32_Count)
+                  {
+                     ru32_SamplePos = 0UL;
+                     ++ru32_ChunkPos;
+                  }
+               }
+               else
+               {
+                  c_Out << ";";
+               }
+               if (u32_ItCol < (this->mc_Columns.size() - 1UL))
+               {
+                  c_Out << ";";
+               }
+            }
+            c_Out << "\n";
+         }
+         c_Out.flush();
+         if (c_File.error() != QFileDevice::NoError)
+         {
+            s32_Retval = C_RD_WR;
+         }
+         c_File.close();
+      }
+   }
+   this->mc_CriticalSection.Release();
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Constructor
+
+   \param[in]  orc_ElementId     Datapool element
+   \param[in]  ou32_ArrayIndex   Index of array element (0 for scalars)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComSignalRecorder::C_ColumnId::C_ColumnId(const C_OscNodeDataPoolListElementId & orc_ElementId,
+                                               const uint32_t ou32_ArrayIndex) :
+   c_ElementId(orc_ElementId),
+   u32_ArrayIndex(ou32_ArrayIndex),
+   q_IsArray(false)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Less operator
+
+   \param[in]  orc_Cmp  Compared instance
+
+   \return
+   true     Current smaller than orc_Cmp
+   false    Otherwise
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComSignalRecorder::C_ColumnId::operator <(const C_ColumnId & orc_Cmp) const
+{
+   bool q_Retval;
+
+   // Compare the indices directly; the virtual operators of the element ID are too slow for each recorded value
+   if (this->c_ElementId.u32_NodeIndex != orc_Cmp.c_ElementId.u32_NodeIndex)
+   {
+      q_Retval = this->c_ElementId.u32_NodeIndex < orc_Cmp.c_ElementId.u32_NodeIndex;
+   }
+   else if (this->c_ElementId.u32_DataPoolIndex != orc_Cmp.c_ElementId.u32_DataPoolIndex)
+   {
+      q_Retval = this->c_ElementId.u32_DataPoolIndex < orc_Cmp.c_ElementId.u32_DataPoolIndex;
+   }
+   else if (this->c_ElementId.u32_ListIndex != orc_Cmp.c_ElementId.u32_ListIndex)
+   {
+      q_Retval = this->c_ElementId.u32_ListIndex < orc_Cmp.c_ElementId.u32_ListIndex;
+   }
+   else if (this->c_ElementId.u32_ElementIndex != orc_Cmp.c_ElementId.u32_ElementIndex)
+   {
+      q_Retval = this->c_ElementId.u32_ElementIndex < orc_Cmp.c_ElementId.u32_ElementIndex;
+   }
+   else
+   {
+      q_Retval = this->u32_ArrayIndex < orc_Cmp.u32_ArrayIndex;
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Constructor
+
+   \param[in]  orc_Id   Column identification
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComSignalRecorder::C_Column::C_Column(const C_ColumnId & orc_Id) :
+   c_Id(orc_Id)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Append sample to its column
+
+   Critical section must be acquired.
+
+   \param[in]  orc_Id            Column identification
+   \param[in]  ou64_TimeStampUs  Time stamp
+   \param[in]  of64_Value        Unscaled value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComSignalRecorder::m_Append(const C_ColumnId & orc_Id, const uint64_t ou64_TimeStampUs,
+                                      const float64_t of64_Value)
+{
+   uint32_t u32_ColumnIndex;
+   C_Chunk * pc_Chunk = NULL;
+
+   const std::map<C_ColumnId, uint32_t>::const_iterator c_ItColumn = this->mc_ColumnIndices.find(orc_Id);
+
+   if (c_ItColumn != this->mc_ColumnIndices.end())
+   {
+      u32_ColumnIndex = c_ItColumn->second;
+   }
+   else
+   {
+      u32_ColumnIndex = static_cast<uint32_t>(this->mc_Columns.size());
+      this->mc_Columns.push_back(C_Column(orc_Id));
+      this->mc_ColumnIndices[orc_Id] = u32_ColumnIndex;
+   }
+
+   if (this->mc_Columns[u32_ColumnIndex].c_Chunks.empty() == false)
+   {
+      pc_Chunk = this->mc_Columns[u32_ColumnIndex].c_Chunks.back();
+      //Start a new chunk if full or the time offset does not fit (time stamps are expected to be ascending)
+      if ((pc_Chunk->u32_Count >= hu32_CHUNK_SIZE) ||
+          (ou64_TimeStampUs < pc_Chunk->u64_FirstTimeStampUs) ||
+          ((ou64_TimeStampUs - pc_Chunk->u64_FirstTimeStampUs) > 0xFFFFFFFFULL))
+      {
+         pc_Chunk = NULL;
+      }
+   }
+   if (pc_Chunk == NULL)
+   {
+      pc_Chunk = this->m_GetNewChunk(u32_ColumnIndex);
+      pc_Chunk->u64_FirstTimeStampUs = ou64_TimeStampUs;
+   }
+   pc_Chunk->au32_TimeOffsetsUs[pc_Chunk->u32_Count] =
+      static_cast<uint32_t>(ou64_TimeStampUs - pc_Chunk->u64_FirstTimeStampUs);
+   pc_Chunk->af64_Values[pc_Chunk->u32_Count] = of64_Value;
+   ++pc_Chunk->u32_Count;
+   ++this->mu64_NumSamples;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get an empty chunk appended to the column
+
+   Reuses the oldest chunk if the memory limit is reached.
+   Critical section must be acquired.
+
+   \param[in]  ou32_ColumnIndex  Index of column the chunk is added to
+
+   \return
+   Empty chunk (not NULL)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComSignalRecorder::C_Chunk * C_SyvComSignalRecorder::m_GetNewChunk(const uint32_t ou32_ColumnIndex)
+{
+   C_Chunk * pc_Retval = NULL;
+
+   while ((this->mc_ChunkOrder.empty() == false) && (this->mc_ChunkOrder.size() >= this->mu32_MaxChunks))
+   {
+      //The oldest allocated chunk is always the first one of its column
+      C_Column & rc_Oldest = this->mc_Columns[this->mc_ChunkOrder.front()];
+      C_Chunk * const pc_Dropped = rc_Oldest.c_Chunks.front();
+
+      this->mu64_NumSamples -= pc_Dropped->u32_Count;
+      this->mu64_NumDroppedSamples += pc_Dropped->u32_Count;
+      rc_Oldest.c_Chunks.pop_front();
+      this->mc_ChunkOrder.pop_front();
+      if (pc_Retval == NULL)
+      {
+         pc_Retval = pc_Dropped;
+      }
+      else
+      {
+         delete pc_Dropped;
+      }
+   }
+   if (pc_Retval == NULL)
+   {
+      pc_Retval = new C_Chunk();
+   }
+   pc_Retval->u32_Count = 0UL;
+   this->mc_Columns[ou32_ColumnIndex].c_Chunks.push_back(pc_Retval);
+   this->mc_ChunkOrder.push_back(ou32_ColumnIndex);
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Release all columns and chunks
+
+   Critical section must be acquired (if used concurrently).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComSignalRecorder::m_ClearColumns(void)
+{
+   for (uint32_t u32_ItCol = 0UL; u32_ItCol < this->mc_Columns.size(); ++u32_ItCol)
+   {
+      std::deque<C_Chunk *> & rc_Chunks = this->mc_Columns[u32_ItCol].c_Chunks;
+      for (uint32_t u32_ItChunk = 0UL; u32_ItChunk < rc_Chunks.size(); ++u32_ItChunk)
+      {
+         delete rc_Chunks[u32_ItChunk];
+      }
+   }
+   this->mc_Columns.clear();
+   this->mc_ColumnIndices.clear();
+   this->mc_ChunkOrder.clear();
+}
@@ -0,0 +1,108 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Columnar recorder of all received datapool element and CAN signal values (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVCOMSIGNALRECORDER_HPP
+#define C_SYVCOMSIGNALRECORDER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+#include <deque>
+#include <vector>
+#include <QString>
+
+#include "stwtypes.hpp"
+#include "TglTasks.hpp"
+#include "C_OscNodeDataPoolContent.hpp"
+#include "C_OscNodeDataPoolListElementId.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvComSignalRecorder
+{
+public:
+   C_SyvComSignalRecorder(void);
+   ~C_SyvComSignalRecorder(void);
+
+   void SetMaxMemory(const uint64_t ou64_MaxBytes);
+   void Clear(void);
+   void Record(const stw::opensyde_core::C_OscNodeDataPoolListElementId & orc_Id,
+               const stw::opensyde_core::C_OscNodeDataPoolContent & orc_Value, const uint64_t ou64_TimeStampUs);
+
+   uint32_t GetNumColumns(void) const;
+   uint64_t GetNumSamples(void) const;
+   uint64_t GetNumDroppedSamples(void) const;
+   uint64_t GetMemoryUsage(void) const;
+   int32_t ExportCsv(const QString & orc_FilePath) const;
+
+   static const uint32_t hu32_CHUNK_SIZE = 1024U; ///< Number of samples per chunk of a column
+
+private:
+   ///Identification of one recorded value (array elements are recorded as separate columns)
+   class C_ColumnId
+   {
+   public:
+      C_ColumnId(const stw::opensyde_core::C_OscNodeDataPoolListElementId & orc_ElementId,
+                 const uint32_t ou32_ArrayIndex);
+
+      bool operator <(const C_ColumnId & orc_Cmp) const;
+
+      stw::opensyde_core::C_OscNodeDataPoolListElementId c_ElementId;
+      uint32_t u32_ArrayIndex;
+      bool q_IsArray;
+   };
+
+   ///Fixed size block of samples of one column
+   class C_Chunk
+   {
+   public:
+      uint64_t u64_FirstTimeStampUs;
+      uint32_t u32_Count;
+      uint32_t au32_TimeOffsetsUs[hu32_CHUNK_SIZE]; ///< Offsets to u64_FirstTimeStampUs
+      float64_t af64_Values[hu32_CHUNK_SIZE];       ///< Unscaled values
+   };
+
+   class C_Column
+   {
+   public:
+      C_Column(const C_ColumnId & orc_Id);
+
+      C_ColumnId c_Id;
+      std::deque<C_Chunk *> c_Chunks; ///< Owned chunks, oldest first
+   };
+
+   mutable stw::tgl::C_TglCriticalSection mc_CriticalSection;
+   std::map<C_ColumnId, uint32_t> mc_ColumnIndices;
+   std::vector<C_Column> mc_Columns;
+   std::deque<uint32_t> mc_ChunkOrder; ///< Column index of each allocated chunk in order of allocation
+   uint32_t mu32_MaxChunks;
+   uint64_t mu64_NumSamples;
+   uint64_t mu64_NumDroppedSamples;
+
+   //Avoid call
+   C_SyvComSignalRecorder(const C_SyvComSignalRecorder &);
+   C_SyvComSignalRecorder & operator =(const C_SyvComSignalRecorder &) &;
+
+   void m_Append(const C_ColumnId & orc_Id, const uint64_t ou64_TimeStampUs, const float64_t of64_Value);
+   C_Chunk * m_GetNewChunk(const uint32_t ou32_ColumnIndex);
+   void m_ClearColumns(void);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
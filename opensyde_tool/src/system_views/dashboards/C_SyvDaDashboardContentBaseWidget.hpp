@@ -47,7 +47,7 @@ public:
                                                                          bool> & orc_MappingNodeToTrafficEncryptionStatus)
       =
          0;
-   virtual void UpdateShowValues(void) = 0;
+   virtual void UpdateShowValues(const bool oq_IsVisible, const bool oq_UpdateAll) = 0;
    virtual void UpdateTransmissionConfiguration(void) = 0;
    virtual void HandleManualOperationFinished(const int32_t os32_Result, const uint8_t ou8_Nrc) = 0;
 
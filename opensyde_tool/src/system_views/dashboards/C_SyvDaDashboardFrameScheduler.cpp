@@ -0,0 +1,204 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Central refresh timer of all dashboards of a view
+
+   Replaces the independent refresh timers of the dashboards and their widgets by one frame tick.
+   Each frame only widgets with new data are updated. In a larger interval all widgets are updated, so states
+   depending on the time only (e.g. timeouts) are shown without new data.
+
+   The frame time (duration of all connected slots) is measured for statistics.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include "TglTime.hpp"
+#include "constants.hpp"
+#include "C_SyvDaDashboardFrameScheduler.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::tgl;
+using namespace stw::opensyde_gui;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaDashboardFrameScheduler::C_Statistics::C_Statistics(void) :
+   u32_NumFrames(0U),
+   u32_NumFullFrames(0U),
+   u32_NumLateFrames(0U),
+   u64_SumFrameTimeUs(0U),
+   u32_MaxFrameTimeUs(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   Uses the default frame and full refresh intervals.
+
+   \param[in,out]  opc_Parent    Optional pointer to parent
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaDashboardFrameScheduler::C_SyvDaDashboardFrameScheduler(QObject * const opc_Parent) :
+   QObject(opc_Parent),
+   ms32_FullRefreshIntervalMs(ms32_TIMER_GUI_FULL_REFRESH),
+   mu32_LastFullRefreshMs(0U),
+   mq_FullRefreshRequested(true)
+{
+   this->mc_Timer.setInterval(ms32_TIMER_GUI_FRAME);
+   connect(&this->mc_Timer, &QTimer::timeout, this, &C_SyvDaDashboardFrameScheduler::m_OnTimeout);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set the interval between two frames
+
+   \param[in]  os32_IntervalMs   Frame interval in ms (at least 1)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::SetFrameInterval(const int32_t os32_IntervalMs)
+{
+   this->mc_Timer.setInterval(std::max(os32_IntervalMs, static_cast<int32_t>(1)));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the interval between two frames
+
+   \return
+   Frame interval in ms
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvDaDashboardFrameScheduler::GetFrameInterval(void) const
+{
+   return this->mc_Timer.interval();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set the interval between two frames updating all widgets
+
+   \param[in]  os32_IntervalMs   Full refresh interval in ms (0: every frame)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::SetFullRefreshInterval(const int32_t os32_IntervalMs)
+{
+   this->ms32_FullRefreshIntervalMs = std::max(os32_IntervalMs, static_cast<int32_t>(0));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Start frame ticks
+
+   The first frame updates all widgets.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::Start(void)
+{
+   this->mq_FullRefreshRequested = true;
+   this->mc_Timer.start();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Stop frame ticks
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::Stop(void)
+{
+   this->mc_Timer.stop();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if frame ticks are running
+
+   \return
+   true  Running
+   false Stopped
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvDaDashboardFrameScheduler::IsActive(void) const
+{
+   return this->mc_Timer.isActive();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update all widgets with the next frame
+
+   E.g. if a dashboard got visible.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::RequestFullRefresh(void)
+{
+   this->mq_FullRefreshRequested = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get frame time statistics
+
+   \return
+   Statistics since construction or last reset
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_SyvDaDashboardFrameScheduler::C_Statistics & C_SyvDaDashboardFrameScheduler::GetStatistics(void) const
+{
+   return this->mc_Statistics;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reset frame time statistics
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::ResetStatistics(void)
+{
+   this->mc_Statistics = C_Statistics();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Handle frame tick
+
+   Emits the frame signal and measures the time of all (direct connected) slots.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardFrameScheduler::m_OnTimeout(void)
+{
+   const uint64_t u64_StartUs = TglGetTickCountUs();
+   const uint32_t u32_NowMs = static_cast<uint32_t>(u64_StartUs / 1000U);
+   uint32_t u32_FrameTimeUs;
+   bool q_UpdateAll = this->mq_FullRefreshRequested;
+
+   if ((u32_NowMs - this->mu32_LastFullRefreshMs) >= static_cast<uint32_t>(this->ms32_FullRefreshIntervalMs))
+   {
+      q_UpdateAll = true;
+   }
+   if (q_UpdateAll == true)
+   {
+      this->mu32_LastFullRefreshMs = u32_NowMs;
+      this->mq_FullRefreshRequested = false;
+      ++this->mc_Statistics.u32_NumFullFrames;
+   }
+
+   Q_EMIT (this->SigFrame(q_UpdateAll));
+
+   u32_FrameTimeUs = static_cast<uint32_t>(TglGetTickCountUs() - u64_StartUs);
+   ++this->mc_Statistics.u32_NumFrames;
+   this->mc_Statistics.u64_SumFrameTimeUs += u32_FrameTimeUs;
+   this->mc_Statistics.u32_MaxFrameTimeUs = std::max(this->mc_Statistics.u32_MaxFrameTimeUs, u32_FrameTimeUs);
+   if (u32_FrameTimeUs > (static_cast<uint32_t>(this->mc_Timer.interval()) * 1000U))
+   {
+      ++this->mc_Statistics.u32_NumLateFrames;
+   }
+}
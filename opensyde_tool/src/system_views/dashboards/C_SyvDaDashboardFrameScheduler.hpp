@@ -0,0 +1,86 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Central refresh timer of all dashboards of a view (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVDADASHBOARDFRAMESCHEDULER_HPP
+#define C_SYVDADASHBOARDFRAMESCHEDULER_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <QObject>
+#include <QTimer>
+
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvDaDashboardFrameScheduler :
+   public QObject
+{
+   Q_OBJECT
+
+public:
+   ///Frame time statistics since start
+   class C_Statistics
+   {
+   public:
+      C_Statistics(void);
+
+      uint32_t u32_NumFrames;      ///< Number of handled frames
+      uint32_t u32_NumFullFrames;  ///< Number of frames which updated all widgets
+      uint32_t u32_NumLateFrames;  ///< Number of frames which took longer than the frame interval
+      uint64_t u64_SumFrameTimeUs; ///< Sum of the frame times
+      uint32_t u32_MaxFrameTimeUs; ///< Longest frame time
+   };
+
+   explicit C_SyvDaDashboardFrameScheduler(QObject * const opc_Parent = NULL);
+
+   void SetFrameInterval(const int32_t os32_IntervalMs);
+   int32_t GetFrameInterval(void) const;
+   void SetFullRefreshInterval(const int32_t os32_IntervalMs);
+   void Start(void);
+   void Stop(void);
+   bool IsActive(void) const;
+   void RequestFullRefresh(void);
+
+   const C_Statistics & GetStatistics(void) const;
+   void ResetStatistics(void);
+
+   //The signals keyword is necessary for Qt signal slot functionality
+   //lint -save -e1736
+
+Q_SIGNALS:
+   //lint -restore
+   void SigFrame(const bool oq_UpdateAll);
+
+private:
+   //Avoid call
+   C_SyvDaDashboardFrameScheduler(const C_SyvDaDashboardFrameScheduler &);
+   C_SyvDaDashboardFrameScheduler & operator =(const C_SyvDaDashboardFrameScheduler &) &;
+
+   void m_OnTimeout(void);
+
+   QTimer mc_Timer;
+   int32_t ms32_FullRefreshIntervalMs;
+   uint32_t mu32_LastFullRefreshMs;
+   bool mq_FullRefreshRequested;
+   C_Statistics mc_Statistics;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
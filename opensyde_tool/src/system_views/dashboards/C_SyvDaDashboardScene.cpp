@@ -1063,21 +1063,30 @@ const
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Updates all values of all dashboard widgets
+
+   \param[in]  oq_UpdateAll  Flag to update all widgets (else only widgets with new data)
+
+   \retval   true    At least one widget was updated
+   \retval   false   No widget was updated
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardScene::UpdateShowValues(void) const
+bool C_SyvDaDashboardScene::UpdateShowValues(const bool oq_UpdateAll) const
 {
+   bool q_Updated = false;
    const QList<QGraphicsItem *> & rc_Items = this->items();
 
    // update the items
    for (QList<QGraphicsItem *>::const_iterator c_ItItem = rc_Items.begin(); c_ItItem != rc_Items.end(); ++c_ItItem)
    {
       C_GiSvDaRectBaseGroup * const pc_Item = dynamic_cast<C_GiSvDaRectBaseGroup *>(*c_ItItem);
-      if (pc_Item != NULL)
+      if ((pc_Item != NULL) &&
+          ((oq_UpdateAll == true) || (pc_Item->HasNewValues() == true)))
       {
          pc_Item->UpdateShowValue();
+         q_Updated = true;
       }
    }
+   return q_Updated;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -241,14 +241,21 @@ void C_SyvDaDashboardSceneWidget::ConnectionActiveChanged(const bool oq_Active,
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Updates all values of all dashboard widgets
+
+   Hidden dashboards are skipped; their widgets take the newest values once shown again.
+
+   \param[in]  oq_IsVisible  Flag if the dashboard is visible
+   \param[in]  oq_UpdateAll  Flag to update all widgets (else only widgets with new data)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardSceneWidget::UpdateShowValues(void)
+void C_SyvDaDashboardSceneWidget::UpdateShowValues(const bool oq_IsVisible, const bool oq_UpdateAll)
 {
-   if (this->mpc_Scene != NULL)
+   if ((this->mpc_Scene != NULL) && (oq_IsVisible == true))
    {
-      this->mpc_Scene->UpdateShowValues();
-      this->mpc_Ui->pc_GraphicsView->repaint();
+      if (this->mpc_Scene->UpdateShowValues(oq_UpdateAll) == true)
+      {
+         this->mpc_Ui->pc_GraphicsView->repaint();
+      }
    }
 }
 
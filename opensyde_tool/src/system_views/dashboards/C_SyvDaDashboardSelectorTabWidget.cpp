@@ -490,11 +490,16 @@ void C_SyvDaDashboardSelectorTabWidget::ConnectionActiveChanged(const bool oq_Ac
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Updates all values of all dashboard widgets
+
+   Only the current tab (if the window is not minimized) and the visible teared off dashboards are drawn.
+
+   \param[in]  oq_UpdateAll  Flag to update all widgets (else only widgets with new data)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardSelectorTabWidget::UpdateShowValues(void) const
+void C_SyvDaDashboardSelectorTabWidget::UpdateShowValues(const bool oq_UpdateAll) const
 {
    int32_t s32_Counter;
+   const bool q_WindowVisible = (this->isVisible() == true) && (this->window()->isMinimized() == false);
 
    for (s32_Counter = 0; s32_Counter < this->count(); ++s32_Counter)
    {
@@ -503,14 +508,15 @@ void C_SyvDaDashboardSelectorTabWidget::UpdateShowValues(void) const
 
       if (pc_WidgetRef != NULL)
       {
-         pc_WidgetRef->UpdateShowValues();
+         const bool q_IsVisible = (q_WindowVisible == true) && (s32_Counter == this->currentIndex());
+         pc_WidgetRef->UpdateShowValues(q_IsVisible, oq_UpdateAll);
       }
    }
 
    for (QList<C_SyvDaTearOffWidget *>::const_iterator c_ItItem = this->mc_TearedOffWidgets.begin();
         c_ItItem != this->mc_TearedOffWidgets.end(); ++c_ItItem)
    {
-      (*c_ItItem)->UpdateShowValues();
+      (*c_ItItem)->UpdateShowValues(oq_UpdateAll);
    }
 }
 
@@ -57,7 +57,7 @@ public:
 
    void RegisterWidgets(stw::opensyde_gui_logic::C_SyvComDriverDiag & orc_ComDriver) const;
    void ConnectionActiveChanged(const bool oq_Active);
-   void UpdateShowValues(void) const;
+   void UpdateShowValues(const bool oq_UpdateAll) const;
    void UpdateTransmissionConfiguration(void);
    int32_t GetDashboardIndexForTabIndex(const int32_t os32_TabIndex, uint32_t & oru32_DashboardIndex) const;
    void HandleManualOperationFinished(const int32_t os32_Result, const uint8_t ou8_Nrc);
@@ -260,11 +260,14 @@ const
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Updates all values of all dashboard widgets
+
+   \param[in]  oq_IsVisible  Flag if the dashboard is visible
+   \param[in]  oq_UpdateAll  Flag to update all widgets (else only widgets with new data)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardWidget::UpdateShowValues(void) const
+void C_SyvDaDashboardWidget::UpdateShowValues(const bool oq_IsVisible, const bool oq_UpdateAll) const
 {
-   this->mpc_Content->UpdateShowValues();
+   this->mpc_Content->UpdateShowValues(oq_IsVisible, oq_UpdateAll);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -56,7 +56,7 @@ public:
    void RegisterWidgets(stw::opensyde_gui_logic::C_SyvComDriverDiag & orc_ComDriver) const;
    void ConnectionActiveChanged(const bool oq_Active, const QMap<uint32_t,
                                                                  bool> & orc_MappingNodeToTrafficEncryptionStatus) const;
-   void UpdateShowValues(void) const;
+   void UpdateShowValues(const bool oq_IsVisible, const bool oq_UpdateAll) const;
    void UpdateTransmissionConfiguration(void) const;
    void HandleManualOperationFinished(const int32_t os32_Result, const uint8_t ou8_Nrc) const;
 
@@ -10,6 +10,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.hpp"
 
+#include <QDateTime>
+
 #include "C_SyvDaDashboardsWidget.hpp"
 #include "ui_C_SyvDaDashboardsWidget.h"
 
@@ -25,6 +27,7 @@
 #include "C_PuiSdHandler.hpp"
 #include "C_OgePopUpDialog.hpp"
 #include "C_UsHandler.hpp"
+#include "C_PuiProject.hpp"
 #include "C_SyvDaDashboardToolbox.hpp"
 #include "C_SyvDaPeUpdateModeConfiguration.hpp"
 #include "C_OgeWiCustomMessage.hpp"
@@ -43,6 +46,8 @@ const QString C_SyvDaDashboardsWidget::mhc_DARK_MODE_ENABLED_ICON_PATH = "://ima
 const QString C_SyvDaDashboardsWidget::mhc_DARK_MODE_DISABLED_ICON_PATH = "://images/system_views/Darkmode_Enable.svg";
 const int32_t C_SyvDaDashboardsWidget::mhs32_WIDGET_BORDER = 11;
 const int32_t C_SyvDaDashboardsWidget::mhs32_TOOLBOX_INIT_POS_Y = 150;
+//Limits the time pending write and NVM operations wait for a batch of polled reads
+const uint32_t C_SyvDaDashboardsWidget::mhu32_MAX_READ_BATCH = 32U;
 uint32_t C_SyvDaDashboardsWidget::mhu32_DisconnectTime = 0UL;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
@@ -104,9 +109,9 @@ C_SyvDaDashboardsWidget::C_SyvDaDashboardsWidget(const uint32_t ou32_ViewIndex,
    //Hide cancel button
    this->mpc_Ui->pc_PbCancel->setVisible(false);
 
-   // Configure timer
-   this->mc_Timer.setInterval(ms32_TIMER_GUI_REFRESH);
-   connect(&this->mc_Timer, &QTimer::timeout, this, &C_SyvDaDashboardsWidget::m_UpdateShowValues);
+   // Configure refresh
+   connect(&this->mc_FrameScheduler, &C_SyvDaDashboardFrameScheduler::SigFrame, this,
+           &C_SyvDaDashboardsWidget::m_UpdateShowValues);
 
    // Handle the service mode
    this->mpc_Ui->pc_PbConfirm->setEnabled(!q_ServiceModeActive);
@@ -390,7 +395,11 @@ void C_SyvDaDashboardsWidget::SetConnectActive(const bool oq_Value)
    }
    else
    {
-      this->mc_Timer.stop();
+      if (this->mc_FrameScheduler.IsActive() == true)
+      {
+         this->mc_FrameScheduler.Stop();
+         this->m_LogFrameStatistics();
+      }
       // Inform all widgets about the connection
       this->mpc_Ui->pc_TabWidget->ConnectionActiveChanged(false);
 
@@ -507,6 +516,66 @@ void C_SyvDaDashboardsWidget::OnPushButtonConnectPress(void)
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Export all values received during the last connection to a CSV file
+
+   Only available while disconnected.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardsWidget::ExportSignalRecording(void)
+{
+   if (this->me_ConnectState == eCS_DISCONNECTED)
+   {
+      if (this->mc_SignalRecorder.GetNumSamples() == 0U)
+      {
+         C_OgeWiCustomMessage c_MessageBox(this, C_OgeWiCustomMessage::E_Type::eINFORMATION);
+         c_MessageBox.SetHeading(C_GtGetText::h_GetText("Export recording"));
+         c_MessageBox.SetDescription(C_GtGetText::h_GetText("Nothing recorded. Values are recorded while the "
+                                                            "dashboards are connected."));
+         c_MessageBox.SetCustomMinHeight(180, 180);
+         c_MessageBox.Execute();
+      }
+      else
+      {
+         QString c_Folder = C_UsHandler::h_GetInstance()->GetLastKnownCsvExportPath();
+         const QString c_DefaultFilename = QDateTime::currentDateTime().toString("yyyy_MM_dd__HH_mm_ss_zzz") + "__" +
+                                           C_PuiProject::h_GetInstance()->GetName() + "__Recording.csv";
+         QString c_FilePath;
+
+         if (c_Folder.isEmpty())
+         {
+            c_Folder = C_PuiProject::h_GetInstance()->GetFolderPath();
+         }
+
+         c_FilePath = C_OgeWiUtil::h_GetSaveFileName(this, C_GtGetText::h_GetText("Save Recording as CSV"),
+                                                     c_Folder, C_GtGetText::h_GetText("CSV (*.csv)"),
+                                                     c_DefaultFilename);
+
+         if (c_FilePath.isEmpty() == false)
+         {
+            int32_t s32_Result;
+
+            C_UsHandler::h_GetInstance()->SetLastKnownCsvExportPath(c_FilePath);
+
+            QApplication::setOverrideCursor(Qt::WaitCursor);
+            s32_Result = this->mc_SignalRecorder.ExportCsv(c_FilePath);
+            QApplication::restoreOverrideCursor();
+
+            if (s32_Result != C_NO_ERR)
+            {
+               C_OgeWiCustomMessage c_MessageBox(this, C_OgeWiCustomMessage::E_Type::eERROR);
+               c_MessageBox.SetHeading(C_GtGetText::h_GetText("Export recording"));
+               c_MessageBox.SetDescription(static_cast<QString>(C_GtGetText::h_GetText(
+                                                                   "Could not write file \"%1\".")).
+                                           arg(c_FilePath));
+               c_MessageBox.SetCustomMinHeight(180, 180);
+               c_MessageBox.Execute();
+            }
+         }
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Overwritten hide event slot
 
@@ -741,9 +810,37 @@ void C_SyvDaDashboardsWidget::m_CleanUpToolBox(void) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardsWidget::m_UpdateShowValues(void) const
+/*! \brief   Update the dashboard widgets for one frame
+
+   \param[in]  oq_UpdateAll  Flag to update all widgets (else only widgets with new data)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardsWidget::m_UpdateShowValues(const bool oq_UpdateAll) const
 {
-   this->mpc_Ui->pc_TabWidget->UpdateShowValues();
+   this->mpc_Ui->pc_TabWidget->UpdateShowValues(oq_UpdateAll);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write frame time statistics of the last connection to the log
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaDashboardsWidget::m_LogFrameStatistics(void) const
+{
+   const C_SyvDaDashboardFrameScheduler::C_Statistics & rc_Statistics = this->mc_FrameScheduler.GetStatistics();
+
+   if (rc_Statistics.u32_NumFrames > 0UL)
+   {
+      osc_write_log_info("Dashboard refresh",
+                         stw::scl::C_SclString::IntToStr(rc_Statistics.u32_NumFrames) + " frames (" +
+                         stw::scl::C_SclString::IntToStr(rc_Statistics.u32_NumFullFrames) +
+                         " full), frame time avg " +
+                         stw::scl::C_SclString::IntToStr(rc_Statistics.u64_SumFrameTimeUs /
+                                                         rc_Statistics.u32_NumFrames) +
+                         " us, max " + stw::scl::C_SclString::IntToStr(rc_Statistics.u32_MaxFrameTimeUs) +
+                         " us, " + stw::scl::C_SclString::IntToStr(rc_Statistics.u32_NumLateFrames) +
+                         " frames exceeded interval of " +
+                         stw::scl::C_SclString::IntToStr(this->mc_FrameScheduler.GetFrameInterval()) + " ms");
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1025,18 +1122,27 @@ void C_SyvDaDashboardsWidget::m_HandleManualOperationFinished(const int32_t os32
          {
             if (this->mc_MissedReadOperations.size() > 0)
             {
-               const C_MissedReadOperation c_MissedOperation = *this->mc_MissedReadOperations.begin();
-               const C_OscNodeDataPoolListElementId & rc_Id = c_MissedOperation.c_ElementId;
-               const int32_t s32_Return =
-                  this->mpc_ComDriver->PollDataPoolRead(rc_Id.u32_NodeIndex,
-                                                        static_cast<uint8_t>(rc_Id.u32_DataPoolIndex),
-                                                        static_cast<uint16_t>(rc_Id.u32_ListIndex),
-                                                        static_cast<uint16_t>(rc_Id.u32_ElementIndex),
-                                                        c_MissedOperation.pc_DashboardWidget);
+               //Read the pending elements of the first node in one batch (the set is sorted by node first)
+               const uint32_t u32_NodeIndex = this->mc_MissedReadOperations.begin()->c_ElementId.u32_NodeIndex;
+               std::vector<C_OscNodeDataPoolListElementId> c_ElementIds;
+               std::vector<C_PuiSvDbDataElementHandler *> c_DashboardWidgets;
+               std::set<C_MissedReadOperation>::iterator c_ItBatchEnd = this->mc_MissedReadOperations.begin();
+               int32_t s32_Return;
+
+               while ((c_ItBatchEnd != this->mc_MissedReadOperations.end()) &&
+                      (c_ItBatchEnd->c_ElementId.u32_NodeIndex == u32_NodeIndex) &&
+                      (c_ElementIds.size() < mhu32_MAX_READ_BATCH))
+               {
+                  c_ElementIds.push_back(c_ItBatchEnd->c_ElementId);
+                  c_DashboardWidgets.push_back(c_ItBatchEnd->pc_DashboardWidget);
+                  ++c_ItBatchEnd;
+               }
+               s32_Return = this->mpc_ComDriver->PollDataPoolReadMultiple(u32_NodeIndex, c_ElementIds,
+                                                                         c_DashboardWidgets);
                //Error handling
                if (s32_Return != C_BUSY)
                {
-                  this->mc_MissedReadOperations.erase(this->mc_MissedReadOperations.begin());
+                  this->mc_MissedReadOperations.erase(this->mc_MissedReadOperations.begin(), c_ItBatchEnd);
                }
             }
          }
@@ -1056,6 +1162,9 @@ void C_SyvDaDashboardsWidget::m_ConnectStepFinished(void)
       QString c_Message;
 
       mpc_ComDriver = new C_SyvComDriverDiag(this->mu32_ViewIndex);
+      // Each connection starts a new recording
+      this->mc_SignalRecorder.Clear();
+      this->mpc_ComDriver->SetSignalRecorder(&this->mc_SignalRecorder);
       connect(mpc_ComDriver, &C_SyvComDriverDiag::SigPollingFinished, this,
               &C_SyvDaDashboardsWidget::m_HandleManualOperationFinished);
 
@@ -1161,7 +1270,8 @@ void C_SyvDaDashboardsWidget::m_HandleConnectionResult(const int32_t os32_Result
       // Inform all widgets about the connection
       this->mpc_Ui->pc_TabWidget->ConnectionActiveChanged(true);
       // Start updating the dashboard widgets
-      this->mc_Timer.start();
+      this->mc_FrameScheduler.ResetStatistics();
+      this->mc_FrameScheduler.Start();
       //Update UI
       this->me_ConnectState = eCS_CONNECTED;
       Q_EMIT this->SigSetConnectPushButtonIcon("://images/system_views/IconConnected.svg", false);
@@ -11,12 +11,13 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QWidget>
-#include <QTimer>
 
 #include "stwtypes.hpp"
 #include "C_OgeWiHover.hpp"
 #include "C_SyvComDriverDiag.hpp"
+#include "C_SyvComSignalRecorder.hpp"
 #include "C_SyvDaDashboardToolbox.hpp"
+#include "C_SyvDaDashboardFrameScheduler.hpp"
 #include "C_SyvComDriverDiagConnect.hpp"
 #include "C_OgeWiFixPosition.hpp"
 
@@ -60,6 +61,7 @@ public:
    bool PrepareToClose(void) const;
    void CheckError(void) const;
    void OnPushButtonConnectPress(void);
+   void ExportSignalRecording(void);
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -87,7 +89,8 @@ private:
    void m_ApplyDarkMode(const bool oq_Active);
    void m_InitToolBox(void);
    void m_CleanUpToolBox(void) const;
-   void m_UpdateShowValues(void) const;
+   void m_UpdateShowValues(const bool oq_UpdateAll) const;
+   void m_LogFrameStatistics(void) const;
 
    int32_t m_InitOsyDriver(QString & orc_Message);
    void m_CloseOsyDriver(void);
@@ -136,11 +139,12 @@ private:
    Ui::C_SyvDaDashboardsWidget * mpc_Ui;
    stw::opensyde_gui_logic::C_SyvComDriverDiag * mpc_ComDriver;
    stw::opensyde_gui_logic::C_SyvComDriverDiagConnect * const mpc_ConnectionThread;
+   stw::opensyde_gui_logic::C_SyvComSignalRecorder mc_SignalRecorder; ///< Values of last connection; outlives driver
    stw::opensyde_gui_elements::C_OgeWiHover * mpc_Toolbox;
    stw::opensyde_gui_elements::C_OgeWiFixPosition * mpc_FixMinimizedToolbox;
    QWidget * const mpc_ToolboxParent;
    C_SyvDaDashboardToolbox * mpc_ToolboxContent;
-   QTimer mc_Timer;
+   C_SyvDaDashboardFrameScheduler mc_FrameScheduler;
    uint32_t mu32_ViewIndex;
    bool mq_EditModeActive;
    bool mq_DarkModeActive;
@@ -155,6 +159,7 @@ private:
    static const QString mhc_DARK_MODE_DISABLED_ICON_PATH;
    static const int32_t mhs32_WIDGET_BORDER;
    static const int32_t mhs32_TOOLBOX_INIT_POS_Y;
+   static const uint32_t mhu32_MAX_READ_BATCH;
 };
 }
 }
@@ -392,13 +392,16 @@ void C_SyvDaTearOffWidget::ConnectionActiveChanged(const bool oq_Active, const Q
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Updates all values of all dashboard widgets
+
+   \param[in]  oq_UpdateAll  Flag to update all widgets (else only widgets with new data)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaTearOffWidget::UpdateShowValues(void) const
+void C_SyvDaTearOffWidget::UpdateShowValues(const bool oq_UpdateAll) const
 {
    if (this->mpc_Dashboard != NULL)
    {
-      this->mpc_Dashboard->UpdateShowValues();
+      const bool q_IsVisible = (this->isVisible() == true) && (this->isMinimized() == false);
+      this->mpc_Dashboard->UpdateShowValues(q_IsVisible, oq_UpdateAll);
    }
 }
 
@@ -63,7 +63,7 @@ public:
    void ConnectionActiveChanged(const bool oq_Active, const QMap<uint32_t,
                                                                  bool> & orc_MappingNodeToTrafficEncryptionStatus,
                                 const bool oq_WidgetTabOnly = false) const;
-   void UpdateShowValues(void) const;
+   void UpdateShowValues(const bool oq_UpdateAll) const;
    void UpdateTransmissionConfiguration(void) const;
 
    //The signals keyword is necessary for Qt signal slot functionality
@@ -13,6 +13,8 @@
 #include "precomp_headers.hpp"
 
 #include <QPushButton>
+#include <QDir>
+#include <QCoreApplication>
 
 #include "C_SyvDaChaPlotHandlerWidget.hpp"
 #include "ui_C_SyvDaChaPlotHandlerWidget.h"
@@ -101,7 +103,7 @@ const QColor C_SyvDaChaPlotHandlerWidget::mhac_DATA_COLORS[mhu8_COUNT_COLORS] =
 
 const int32_t C_SyvDaChaPlotHandlerWidget::mhs32_WIDTH_LINE_SELECTED = 2;
 const int32_t C_SyvDaChaPlotHandlerWidget::mhs32_WIDTH_LINE_DEFAULT = 1;
-const int32_t C_SyvDaChaPlotHandlerWidget::mhs32_INTERVAL_MS = 10;
+const uint32_t C_SyvDaChaPlotHandlerWidget::mhu32_DEFAULT_MAX_SAMPLES_IN_MEMORY = 1000000U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -135,12 +137,16 @@ C_SyvDaChaPlotHandlerWidget::C_SyvDaChaPlotHandlerWidget(QWidget * const opc_Par
    mq_ManualOperationPossible(false),
    mq_PauseState(false),
    mq_ShowSamplePointState(true),
+   mq_RedrawPending(false),
    me_SettingCursorMode(eSETTING_CM_NO_CURSOR),
    mpc_FirstCursor(NULL),
    mpc_SecondCursor(NULL),
    mf64_MeasuredTimeFirstCursor(0.0),
    mf64_MeasuredTimeSecondCursor(0.0),
    mq_IsSecondCursorClicked(false),
+   mu32_MaxSamplesInMemory(mhu32_DEFAULT_MAX_SAMPLES_IN_MEMORY),
+   mc_SpillDirectory(QDir::tempPath()),
+   mu32_SpillFileCounter(0U),
    mc_Out(&mc_File)
 {
    const bool q_ServiceModeActive = C_PuiSvHandler::h_GetInstance()->GetServiceModeActive();
@@ -213,9 +219,6 @@ C_SyvDaChaPlotHandlerWidget::C_SyvDaChaPlotHandlerWidget(QWidget * const opc_Par
 
    this->mpc_Ui->pc_PushButtonOptions->setMenu(this->mpc_MenuOptions);
 
-   //Configure timer
-   this->mc_CyclicChartUpdateTrigger.setInterval(C_SyvDaChaPlotHandlerWidget::mhs32_INTERVAL_MS);
-
    this->InitStaticNames();
 
    this->mpc_Ui->pc_LabelTitle->SetFontPixel(13, true); // color is dark/bright mode specific
@@ -246,9 +249,6 @@ C_SyvDaChaPlotHandlerWidget::C_SyvDaChaPlotHandlerWidget(QWidget * const opc_Par
    connect(this->mpc_Ui->pc_PushButtonManualAbort, &C_OgePubIconChart::clicked, this,
            &C_SyvDaChaPlotHandlerWidget::SigManualReadAbortTriggered);
 
-   connect(&this->mc_CyclicChartUpdateTrigger, &QTimer::timeout, this,
-           &C_SyvDaChaPlotHandlerWidget::m_CyclicUpdateHorizontalAxis);
-
    connect(this->mpc_Ui->pc_Plot, &C_SyvDaChaPlot::SigCursorItemMovedOnHorizontalAxis,
            this, &C_SyvDaChaPlotHandlerWidget::m_CursorItemMovedOnHorizontalAxis);
 
@@ -263,6 +263,9 @@ C_SyvDaChaPlotHandlerWidget::C_SyvDaChaPlotHandlerWidget(QWidget * const opc_Par
    connect(this->mpc_Ui->pc_Plot->xAxis,
            static_cast<void (QCPAxis::*)(const QCPRange &)>(&QCPAxis::rangeChanged), this,
            &C_SyvDaChaPlotHandlerWidget::m_RangeChangedHorizontalAxis);
+   // Every replot (also the ones triggered by zooming and dragging) shows the view of the current range
+   connect(this->mpc_Ui->pc_Plot, &QCustomPlot::beforeReplot,
+           this, &C_SyvDaChaPlotHandlerWidget::m_UpdateGraphViews);
 
    connect(this->mpc_Ui->pc_Plot, &C_SyvDaChaPlot::SigCursorItemClicked,
            this, &C_SyvDaChaPlotHandlerWidget::m_CursorItemClicked);
@@ -282,6 +285,12 @@ C_SyvDaChaPlotHandlerWidget::~C_SyvDaChaPlotHandlerWidget(void)
    // Deactivate and clean up measurement
    this->m_ConfigureCursorMode(eSETTING_CM_NO_CURSOR);
 
+   for (int32_t s32_It = 0; s32_It < this->mc_SampleStores.size(); ++s32_It)
+   {
+      delete this->mc_SampleStores[s32_It];
+   }
+   this->mc_SampleStores.clear();
+
    delete this->mpc_Ui;
 }
 
@@ -683,6 +692,27 @@ void C_SyvDaChaPlotHandlerWidget::SetDrawingActive(const bool oq_Active)
    this->mq_DrawingActive = oq_Active;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Draw one frame of the dashboard refresh
+
+   Moves the horizontal axis while connected and not paused and redraws the chart once if anything changed
+   since the last frame. Only to be called while the chart is visible.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotHandlerWidget::UpdateFrame(void)
+{
+   if ((this->mq_IsConnected == true) && (this->mq_PauseState == false))
+   {
+      this->m_CyclicUpdateHorizontalAxis();
+   }
+
+   if (this->mq_RedrawPending == true)
+   {
+      this->mq_RedrawPending = false;
+      this->m_RedrawGraph();
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the pause state of the chart
 
@@ -713,16 +743,11 @@ void C_SyvDaChaPlotHandlerWidget::ConnectionActiveChanged(const bool oq_Active,
       this->mu32_TimeStampOfStart = stw::tgl::TglGetTickCount();
       //Reset window
       this->mpc_Ui->pc_Plot->xAxis->setRange(0.0, this->mpc_Ui->pc_Plot->xAxis->range().size(), Qt::AlignLeft);
-      if (this->mq_PauseState == false)
-      {
-         this->mc_CyclicChartUpdateTrigger.start();
-      }
       this->mpc_Ui->pc_ButtonAddData->setEnabled(false);
       this->mpc_Ui->pc_PushButtonManualRead->setEnabled(true);
    }
    else
    {
-      this->mc_CyclicChartUpdateTrigger.stop();
       // In case of disconnect the transmission errors must be reseted, but not the warnings
       this->mpc_Ui->pc_ChartSelectorWidget->ResetError();
       this->mpc_Ui->pc_ButtonAddData->setEnabled(true);
@@ -845,6 +870,11 @@ bool C_SyvDaChaPlotHandlerWidget::RemoveSpecificGraph(const uint32_t ou32_DataPo
             }
          }
 
+         if (static_cast<int32_t>(ou32_DataPoolElementConfigIndex) < this->mc_SampleStores.size())
+         {
+            delete this->mc_SampleStores.takeAt(static_cast<int32_t>(ou32_DataPoolElementConfigIndex));
+         }
+
          this->mpc_Ui->pc_Plot->removeGraph(ou32_DataPoolElementConfigIndex);
       }
 
@@ -1049,9 +1079,11 @@ void C_SyvDaChaPlotHandlerWidget::AddGraphContent(const C_PuiSvDbNodeDataPoolLis
          const C_PuiSvDbNodeDataPoolListElementId & rc_CurDataPoolElementId =
             this->mc_Data.c_DataPoolElementsConfig[u32_ConfigCounter].c_ElementId;
          if ((rc_CurDataPoolElementId == orc_DataPoolElementId) &&
-             (static_cast<int32_t>(u32_ConfigCounter) < this->mpc_Ui->pc_Plot->graphCount()))
+             (static_cast<int32_t>(u32_ConfigCounter) < this->mpc_Ui->pc_Plot->graphCount()) &&
+             (static_cast<int32_t>(u32_ConfigCounter) < this->mc_SampleStores.size()))
          {
             QCPGraph * const pc_Graph = this->mpc_Ui->pc_Plot->graph(u32_ConfigCounter);
+            C_SyvDaChaSampleStore * const pc_Store = this->mc_SampleStores[static_cast<int32_t>(u32_ConfigCounter)];
 
             if (pc_Graph != NULL)
             {
@@ -1118,7 +1150,8 @@ void C_SyvDaChaPlotHandlerWidget::AddGraphContent(const C_PuiSvDbNodeDataPoolLis
                      }
                   }
 
-                  pc_Graph->addData(f64_Timestamp, f64_Value);
+                  // The graph gets the new samples with the next view update
+                  pc_Store->Append(f64_Timestamp, f64_Value);
                }
                // Show the last formatted value in the selector widget
                this->mpc_Ui->pc_ChartSelectorWidget->UpdateDataSerieValue(u32_ConfigCounter, orc_FormattedLastValue);
@@ -1126,7 +1159,8 @@ void C_SyvDaChaPlotHandlerWidget::AddGraphContent(const C_PuiSvDbNodeDataPoolLis
          }
       }
 
-      this->m_RedrawGraph();
+      // Drawn once per frame for all elements
+      this->mq_RedrawPending = true;
    }
 }
 
@@ -1319,6 +1353,23 @@ void C_SyvDaChaPlotHandlerWidget::SetCurrentDashboardTabName(const QString & orc
    this->mc_CurrentDashboardTabName = orc_CurrentDashboardTabName;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Set how many samples of each graph are kept
+
+   Older samples are moved to a temporary file in the spill directory. They are not shown anymore
+   but still exported. Applies to graphs added after this call.
+
+   \param[in]  ou32_MaxSamplesInMemory   Number of newest samples per graph kept in memory and shown
+   \param[in]  orc_SpillDirectory        Directory for temporary files; empty: older samples are discarded
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotHandlerWidget::SetSampleRetention(const uint32_t ou32_MaxSamplesInMemory,
+                                                     const QString & orc_SpillDirectory)
+{
+   this->mu32_MaxSamplesInMemory = ou32_MaxSamplesInMemory;
+   this->mc_SpillDirectory = orc_SpillDirectory;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Overridden resize event
 
@@ -1395,6 +1446,7 @@ void C_SyvDaChaPlotHandlerWidget::m_AddGraph(const uint32_t ou32_DataPoolElement
 
    // Add the new graph
    pc_Graph = this->mpc_Ui->pc_Plot->addGraph(NULL, pc_VerticalAxis);
+   this->mc_SampleStores.append(this->m_CreateSampleStore());
 
    // Add tracer
    if (this->me_SettingCursorMode != eSETTING_CM_NO_CURSOR)
@@ -1482,6 +1534,10 @@ void C_SyvDaChaPlotHandlerWidget::m_ResetChart(void)
       // Removing all previous data by setting empty data. Using clear function of data seems not to work
       this->mpc_Ui->pc_Plot->graph(s32_CounterItem)->setData(c_EmptyKeys, c_EmptyValues, true);
    }
+   for (s32_CounterItem = 0; s32_CounterItem < this->mc_SampleStores.size(); ++s32_CounterItem)
+   {
+      this->mc_SampleStores[s32_CounterItem]->Clear();
+   }
 
    // Reset the range
    this->mf64_MaxValue = 1.0;
@@ -1548,6 +1604,59 @@ void C_SyvDaChaPlotHandlerWidget::m_RedrawGraph(void)
    }
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Hand the view of the stored samples for the visible range to the graphs
+
+   Called before each replot. The graphs only get about two samples per horizontal pixel, so drawing does not depend
+   on the length of the recording. Graphs without new samples keep their data if the range did not change.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaPlotHandlerWidget::m_UpdateGraphViews(void)
+{
+   const QCPRange c_Range = this->mpc_Ui->pc_Plot->xAxis->range();
+   const int32_t s32_Width = this->mpc_Ui->pc_Plot->axisRect()->width();
+   const uint32_t u32_BucketCount = (s32_Width > 0) ? static_cast<uint32_t>(s32_Width) : 1U;
+   std::vector<C_SyvDaChaSampleStore::C_Sample> c_View;
+
+   for (int32_t s32_Counter = 0;
+        (s32_Counter < this->mc_SampleStores.size()) && (s32_Counter < this->mpc_Ui->pc_Plot->graphCount());
+        ++s32_Counter)
+   {
+      if (this->mc_SampleStores[s32_Counter]->UpdateView(c_Range.lower, c_Range.upper, u32_BucketCount,
+                                                         c_View) == true)
+      {
+         QVector<QCPGraphData> c_Data;
+         c_Data.reserve(static_cast<int32_t>(c_View.size()));
+         for (uint32_t u32_It = 0U; u32_It < c_View.size(); ++u32_It)
+         {
+            c_Data.append(QCPGraphData(c_View[u32_It].f64_Key, c_View[u32_It].f64_Value));
+         }
+         this->mpc_Ui->pc_Plot->graph(s32_Counter)->data()->set(c_Data, true);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create sample store for a new graph
+
+   \return
+   New sample store (ownership is passed to the caller)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaChaSampleStore * C_SyvDaChaPlotHandlerWidget::m_CreateSampleStore(void)
+{
+   QString c_SpillFile;
+
+   if (this->mc_SpillDirectory.isEmpty() == false)
+   {
+      c_SpillFile = QDir(this->mc_SpillDirectory).filePath(
+         static_cast<QString>("openSYDE_chart_%1_%2_%3.tmp").arg(QCoreApplication::applicationPid()).
+         arg(QString::number(reinterpret_cast<quintptr>(this), 16)).arg(this->mu32_SpillFileCounter));
+      ++this->mu32_SpillFileCounter;
+   }
+   return new C_SyvDaChaSampleStore(this->mu32_MaxSamplesInMemory, c_SpillFile.toLocal8Bit().constData());
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Update data element counter in title
 */
@@ -1625,13 +1734,17 @@ void C_SyvDaChaPlotHandlerWidget::m_OnSplitterMoved(void)
 void C_SyvDaChaPlotHandlerWidget::m_CyclicUpdateHorizontalAxis(void)
 {
    const uint32_t u32_CurTime = stw::tgl::TglGetTickCount() - this->mu32_TimeStampOfStart;
+   const QCPRange c_Range = this->mpc_Ui->pc_Plot->xAxis->range();
+   const int32_t s32_Width = this->mpc_Ui->pc_Plot->axisRect()->width();
+   // Time of one horizontal pixel; scrolling by less would redraw the same picture
+   const float64_t f64_PixelTime = (s32_Width > 0) ? (c_Range.size() / static_cast<float64_t>(s32_Width)) : 0.0;
 
-   if (static_cast<float64_t>(u32_CurTime) > this->mpc_Ui->pc_Plot->xAxis->range().upper)
+   if (static_cast<float64_t>(u32_CurTime) > (c_Range.upper + f64_PixelTime))
    {
       this->mpc_Ui->pc_Plot->xAxis->setRange(static_cast<float64_t>(u32_CurTime),
                                              this->mpc_Ui->pc_Plot->xAxis->range().size(), Qt::AlignRight);
 
-      m_RedrawGraph();
+      this->mq_RedrawPending = true;
    }
 }
 
@@ -3125,14 +3238,12 @@ void C_SyvDaChaPlotHandlerWidget::m_UpdatePause(const bool oq_Pause)
    this->mq_PauseState = oq_Pause;
    if (oq_Pause == true)
    {
-      this->mc_CyclicChartUpdateTrigger.stop();
       this->mpc_Ui->pc_PushButtonManualRead->setEnabled(false);
    }
    else
    {
       if (this->mq_IsConnected == true)
       {
-         this->mc_CyclicChartUpdateTrigger.start();
          this->mpc_Ui->pc_PushButtonManualRead->setEnabled(true);
       }
    }
@@ -3338,10 +3449,11 @@ void C_SyvDaChaPlotHandlerWidget::m_ExtractDataToCsv(void)
       const uint32_t u32_DataElementSize = static_cast<uint32_t>(this->mc_Data.c_DataPoolElementsConfig.size());
       const auto pc_Plot = this->mpc_Ui->pc_Plot;
       const auto pc_ChartSelectorWidget = this->mpc_Ui->pc_ChartSelectorWidget;
-      int32_t s32_MaxDataElement = 0;
-      if (u32_DataElementSize > 0)
+      uint64_t u64_MaxDataElement = 0U;
+      std::vector<std::vector<C_SyvDaChaSampleStore::C_Sample> > c_Blocks(u32_DataElementSize);
+      if ((u32_DataElementSize > 0) && (this->mc_SampleStores.size() > 0))
       {
-         s32_MaxDataElement = pc_Plot->graph(0)->dataCount();
+         u64_MaxDataElement = this->mc_SampleStores[0]->GetSampleCount();
       }
 
       for (uint32_t u32_DataElementCounter = 0U; u32_DataElementCounter < u32_DataElementSize; ++u32_DataElementCounter)
@@ -3349,9 +3461,11 @@ void C_SyvDaChaPlotHandlerWidget::m_ExtractDataToCsv(void)
          const QCPGraph * const pc_Graph = pc_Plot->graph(u32_DataElementCounter);
          if (pc_Graph->visible())
          {
-            if (pc_Graph->dataCount() > s32_MaxDataElement)
+            if (static_cast<int32_t>(u32_DataElementCounter) < this->mc_SampleStores.size())
             {
-               s32_MaxDataElement = pc_Graph->dataCount();
+               u64_MaxDataElement = std::max(u64_MaxDataElement,
+                                             this->mc_SampleStores[static_cast<int32_t>(u32_DataElementCounter)]->
+                                             GetSampleCount());
             }
             //Creating here headings for all data elements and units
             c_DataElements += "Timestamp (ms);" + pc_ChartSelectorWidget->GetDataElementName(
@@ -3367,31 +3481,60 @@ void C_SyvDaChaPlotHandlerWidget::m_ExtractDataToCsv(void)
       //Writing created data elements and units headings to .csv file
       mc_Out << c_DataElements + "\n";
 
-      for (int32_t s32_GraphDataCounter = 0U; s32_GraphDataCounter < s32_MaxDataElement;
-           ++s32_GraphDataCounter)
+      // All stored samples are exported (not only the shown view); read them block wise
+      for (uint64_t u64_BlockStart = 0U; u64_BlockStart < u64_MaxDataElement;
+           u64_BlockStart += C_SyvDaChaSampleStore::hu32_CHUNK_SIZE)
       {
+         const uint32_t u32_BlockSize =
+            static_cast<uint32_t>(std::min(u64_MaxDataElement - u64_BlockStart,
+                                           static_cast<uint64_t>(C_SyvDaChaSampleStore::hu32_CHUNK_SIZE)));
+
          for (uint32_t u32_DataElementCounter = 0U; u32_DataElementCounter < u32_DataElementSize;
               ++u32_DataElementCounter)
          {
-            const QCPGraph * const pc_Graph = pc_Plot->graph(u32_DataElementCounter);
-            if (pc_Graph->visible())
+            c_Blocks[u32_DataElementCounter].clear();
+            if ((pc_Plot->graph(u32_DataElementCounter)->visible()) &&
+                (static_cast<int32_t>(u32_DataElementCounter) < this->mc_SampleStores.size()))
             {
-               if (s32_GraphDataCounter < pc_Graph->dataCount())
+               const C_SyvDaChaSampleStore * const pc_Store =
+                  this->mc_SampleStores[static_cast<int32_t>(u32_DataElementCounter)];
+               if (u64_BlockStart < pc_Store->GetSampleCount())
                {
-                  mc_Out << pc_Graph->data()->at(s32_GraphDataCounter)->key << ";" << pc_Graph->data()->at(
-                     s32_GraphDataCounter)->mainValue();
+                  const uint64_t u64_Count = std::min(static_cast<uint64_t>(u32_BlockSize),
+                                                      pc_Store->GetSampleCount() - u64_BlockStart);
+                  //Not readable samples are left empty
+                  (void)pc_Store->ReadSamples(u64_BlockStart, static_cast<uint32_t>(u64_Count),
+                                        c_Blocks[u32_DataElementCounter]);
                }
-               else
-               {
-                  mc_Out << ";";
-               }
-               if (u32_DataElementCounter < (u32_DataElementSize - 1))
+            }
+         }
+
+         for (uint32_t u32_GraphDataCounter = 0U; u32_GraphDataCounter < u32_BlockSize; ++u32_GraphDataCounter)
+         {
+            for (uint32_t u32_DataElementCounter = 0U; u32_DataElementCounter < u32_DataElementSize;
+                 ++u32_DataElementCounter)
+            {
+               const QCPGraph * const pc_Graph = pc_Plot->graph(u32_DataElementCounter);
+               if (pc_Graph->visible())
                {
-                  mc_Out << ";";
+                  const std::vector<C_SyvDaChaSampleStore::C_Sample> & rc_Block = c_Blocks[u32_DataElementCounter];
+                  if (u32_GraphDataCounter < rc_Block.size())
+                  {
+                     mc_Out << rc_Block[u32_GraphDataCounter].f64_Key << ";" <<
+                        rc_Block[u32_GraphDataCounter].f64_Value;
+                  }
+                  else
+                  {
+                     mc_Out << ";";
+                  }
+                  if (u32_DataElementCounter < (u32_DataElementSize - 1))
+                  {
+                     mc_Out << ";";
+                  }
                }
             }
+            mc_Out << "\n";
          }
-         mc_Out << "\n";
       }
 
       mc_File.close();
@@ -12,7 +12,6 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QWidget>
 #include <QColor>
-#include <QTimer>
 #include <vector>
 #include <QFile>
 #include <QTextStream>
@@ -25,6 +24,7 @@
 #include "C_PuiSvDbDataElementDisplayFormatterConfig.hpp"
 #include "C_PuiSvDbTabChart.hpp"
 #include "C_SyvDaChaPlot.hpp"
+#include "C_SyvDaChaSampleStore.hpp"
 #include "C_OgeMuTabChartFit.hpp"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -69,6 +69,7 @@ public:
    void SetDarkMode(const bool oq_DarkMode);
    void SetDrawingActive(const bool oq_Active);
 
+   void UpdateFrame(void);
    bool IsPaused(void) const;
    void ConnectionActiveChanged(const bool oq_Active, const QMap<uint32_t,
                                                                  bool> & orc_MappingNodeToTrafficEncryptionStatus);
@@ -97,6 +98,7 @@ public:
    void SetManualOperationPossible(const bool oq_Possible);
    void ManualReadFinished(void);
    void SetCurrentDashboardTabName(const QString & orc_CurrentDashboardTabName);
+   void SetSampleRetention(const uint32_t ou32_MaxSamplesInMemory, const QString & orc_SpillDirectory);
 
    //The signals keyword is necessary for Qt signal slot functionality
    //lint -save -e1736
@@ -169,8 +171,7 @@ private:
    bool mq_ManualOperationPossible;
    bool mq_PauseState;
    bool mq_ShowSamplePointState;
-   static const int32_t mhs32_INTERVAL_MS;
-   QTimer mc_CyclicChartUpdateTrigger;
+   bool mq_RedrawPending; ///< New samples or axis movement since the last frame
 
    // Cursors
    E_SettingCursorMode me_SettingCursorMode;
@@ -183,6 +184,13 @@ private:
    // Index of list equals data element config index
    QList<QCPItemTracer *> mc_ItemTracers;
 
+   // Samples of each graph; the graphs only get the view of the visible range. Index equals data element config index
+   QList<stw::opensyde_gui_logic::C_SyvDaChaSampleStore *> mc_SampleStores;
+   uint32_t mu32_MaxSamplesInMemory;
+   QString mc_SpillDirectory;
+   uint32_t mu32_SpillFileCounter;
+   static const uint32_t mhu32_DEFAULT_MAX_SAMPLES_IN_MEMORY;
+
    //Avoid call
    C_SyvDaChaPlotHandlerWidget(const C_SyvDaChaPlotHandlerWidget &);
    C_SyvDaChaPlotHandlerWidget & operator =(const C_SyvDaChaPlotHandlerWidget &) &;
@@ -194,6 +202,8 @@ private:
    void m_DataItemToggled(const uint32_t ou32_DataPoolElementConfigIndex, const bool oq_Checked);
    void m_DataItemSelected(const uint32_t ou32_DataPoolElementConfigIndex);
    void m_RedrawGraph(void);
+   void m_UpdateGraphViews(void);
+   stw::opensyde_gui_logic::C_SyvDaChaSampleStore * m_CreateSampleStore(void);
    void m_UpdateElementCounter(void);
    void m_ResizeSelectorWidget(void);
    void m_OnSplitterMoved(void);
@@ -0,0 +1,618 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Time series storage with level of detail for one chart graph
+
+   The samples of a graph are stored column wise (keys and values separately) in chunks of hu32_CHUNK_SIZE samples.
+   For each chunk the indices of the minimum and maximum value are kept for blocks of 16 and 256 samples and for the
+   whole chunk. This allows to get the extremes of any sample range by looking at only a few entries.
+
+   The chart does not get all samples but only a view of them:
+   for each horizontal pixel of the visible range the minimum and the maximum sample is used.
+   Outside of the visible range only the direct neighbors (for correct lines at the borders) and the first, last,
+   minimum and maximum sample are added so fitting the axes to the whole data still works.
+   All returned samples are real samples, no values are interpolated.
+
+   Only the newest samples are kept in memory. If more samples are received the oldest chunk is moved to an optional
+   spill file. Samples in the spill file are not shown any more but can still be read (e.g. for export).
+
+   Keys are expected to be increasing. A key smaller than the previous one is stored with the previous key.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "stwerrors.hpp"
+#include "C_SyvDaChaSampleStore.hpp"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw::errors;
+using namespace stw::opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+const uint32_t C_SyvDaChaSampleStore::hu32_CHUNK_SIZE = 4096U;
+const uint32_t C_SyvDaChaSampleStore::mhu32_LEVEL1_SIZE = 16U;
+const uint32_t C_SyvDaChaSampleStore::mhu32_LEVEL2_SIZE = 256U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   \param[in]  ou32_MaxSamplesInMemory    Number of newest samples kept in memory (at least two chunks are kept)
+   \param[in]  orc_SpillFilePath          File for samples removed from memory; empty: discard these samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaChaSampleStore::C_SyvDaChaSampleStore(const uint32_t ou32_MaxSamplesInMemory,
+                                             const std::string & orc_SpillFilePath) :
+   mu32_SampleCountInMemory(0U),
+   mu32_MaxSamplesInMemory(std::max(ou32_MaxSamplesInMemory, 2U * hu32_CHUNK_SIZE)),
+   mc_SpillFilePath(orc_SpillFilePath),
+   mu64_SampleCountSpilled(0U),
+   mu32_Revision(1U),
+   mu32_ViewRevision(0U),
+   mf64_ViewKeyFrom(0.0),
+   mf64_ViewKeyTo(0.0),
+   mu32_ViewBucketCount(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default destructor
+
+   Removes the spill file.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaChaSampleStore::~C_SyvDaChaSampleStore(void)
+{
+   if (this->mu64_SampleCountSpilled > 0U)
+   {
+      (void)std::remove(this->mc_SpillFilePath.c_str());
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add a new sample
+
+   \param[in]  of64_Key    Key (time stamp)
+   \param[in]  of64_Value  Value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::Append(const float64_t of64_Key, const float64_t of64_Value)
+{
+   float64_t f64_Key = of64_Key;
+   uint32_t u32_Index;
+
+   if (this->mu32_SampleCountInMemory > 0U)
+   {
+      const float64_t f64_LastKey = this->mc_Chunks.back().c_Keys.back();
+      if (f64_Key < f64_LastKey)
+      {
+         f64_Key = f64_LastKey;
+      }
+   }
+
+   if ((this->mc_Chunks.empty() == true) || (this->mc_Chunks.back().c_Keys.size() >= hu32_CHUNK_SIZE))
+   {
+      this->mc_Chunks.push_back(C_Chunk());
+      this->mc_Chunks.back().c_Keys.reserve(hu32_CHUNK_SIZE);
+      this->mc_Chunks.back().c_Values.reserve(hu32_CHUNK_SIZE);
+      this->mc_Chunks.back().c_Level1.reserve(hu32_CHUNK_SIZE / mhu32_LEVEL1_SIZE);
+      this->mc_Chunks.back().c_Level2.reserve(hu32_CHUNK_SIZE / mhu32_LEVEL2_SIZE);
+   }
+
+   {
+      C_Chunk & rc_Chunk = this->mc_Chunks.back();
+      rc_Chunk.c_Keys.push_back(f64_Key);
+      rc_Chunk.c_Values.push_back(of64_Value);
+      u32_Index = static_cast<uint32_t>(rc_Chunk.c_Values.size() - 1U);
+      mh_UpdateExtremes(rc_Chunk.c_Values, u32_Index, rc_Chunk.c_Level1, mhu32_LEVEL1_SIZE);
+      mh_UpdateExtremes(rc_Chunk.c_Values, u32_Index, rc_Chunk.c_Level2, mhu32_LEVEL2_SIZE);
+      if (u32_Index == 0U)
+      {
+         rc_Chunk.c_All = rc_Chunk.c_Level1.back();
+      }
+      else if (of64_Value < rc_Chunk.c_Values[rc_Chunk.c_All.u32_MinIndex])
+      {
+         rc_Chunk.c_All.u32_MinIndex = u32_Index;
+      }
+      else if (of64_Value > rc_Chunk.c_Values[rc_Chunk.c_All.u32_MaxIndex])
+      {
+         rc_Chunk.c_All.u32_MaxIndex = u32_Index;
+      }
+      else
+      {
+         //Nothing to do
+      }
+   }
+   ++this->mu32_SampleCountInMemory;
+   ++this->mu32_Revision;
+
+   if ((this->mu32_SampleCountInMemory > this->mu32_MaxSamplesInMemory) && (this->mc_Chunks.size() > 1U))
+   {
+      this->m_EvictOldestChunk();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all samples (including the spill file)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::Clear(void)
+{
+   this->mc_Chunks.clear();
+   this->mu32_SampleCountInMemory = 0U;
+   if (this->mu64_SampleCountSpilled > 0U)
+   {
+      (void)std::remove(this->mc_SpillFilePath.c_str());
+      this->mu64_SampleCountSpilled = 0U;
+   }
+   ++this->mu32_Revision;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of stored samples
+
+   \return
+   Number of samples in memory and in the spill file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint64_t C_SyvDaChaSampleStore::GetSampleCount(void) const
+{
+   return this->mu64_SampleCountSpilled + this->mu32_SampleCountInMemory;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get view of samples if it changed since the last call
+
+   \param[in]   of64_KeyFrom        Start of visible key range
+   \param[in]   of64_KeyTo          End of visible key range
+   \param[in]   ou32_BucketCount    Number of buckets (usually pixels) to divide the visible range in
+   \param[out]  orc_View            Samples of view; only set if the function returns true
+
+   \return
+   true     Samples or parameters changed; view updated
+   false    View of last call is still valid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvDaChaSampleStore::UpdateView(const float64_t of64_KeyFrom, const float64_t of64_KeyTo,
+                                       const uint32_t ou32_BucketCount, std::vector<C_Sample> & orc_View)
+{
+   bool q_Changed = false;
+
+   //lint -e{777} //exact compare intended: any change of the range requires a new view
+   if ((this->mu32_ViewRevision != this->mu32_Revision) || (this->mf64_ViewKeyFrom != of64_KeyFrom) ||
+       (this->mf64_ViewKeyTo != of64_KeyTo) || (this->mu32_ViewBucketCount != ou32_BucketCount))
+   {
+      this->GetView(of64_KeyFrom, of64_KeyTo, ou32_BucketCount, orc_View);
+      this->mu32_ViewRevision = this->mu32_Revision;
+      this->mf64_ViewKeyFrom = of64_KeyFrom;
+      this->mf64_ViewKeyTo = of64_KeyTo;
+      this->mu32_ViewBucketCount = ou32_BucketCount;
+      q_Changed = true;
+   }
+   return q_Changed;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get view of samples in memory
+
+   If the visible range has not more than two samples per bucket all of them are returned.
+   Else the minimum and maximum sample of each bucket and the first and last visible sample are returned.
+
+   \param[in]   of64_KeyFrom        Start of visible key range
+   \param[in]   of64_KeyTo          End of visible key range
+   \param[in]   ou32_BucketCount    Number of buckets (usually pixels) to divide the visible range in
+   \param[out]  orc_View            Samples of view sorted by key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::GetView(const float64_t of64_KeyFrom, const float64_t of64_KeyTo,
+                                    const uint32_t ou32_BucketCount, std::vector<C_Sample> & orc_View) const
+{
+   orc_View.clear();
+   if ((this->mu32_SampleCountInMemory > 0U) && (ou32_BucketCount > 0U))
+   {
+      std::vector<uint32_t> c_Indices;
+      const uint32_t u32_First = this->m_FindFirstIndex(of64_KeyFrom, false);
+      const uint32_t u32_End = std::max(u32_First, this->m_FindFirstIndex(of64_KeyTo, true));
+
+      c_Indices.reserve((static_cast<size_t>(ou32_BucketCount) * 2U) + 10U);
+
+      //Left of visible range
+      if (u32_First > 0U)
+      {
+         this->m_AddRangeSummary(0U, u32_First - 1U, c_Indices);
+         c_Indices.push_back(u32_First - 1U);
+      }
+
+      //Visible range
+      if ((u32_End - u32_First) <= (2U * ou32_BucketCount))
+      {
+         for (uint32_t u32_It = u32_First; u32_It < u32_End; ++u32_It)
+         {
+            c_Indices.push_back(u32_It);
+         }
+      }
+      else
+      {
+         const float64_t f64_Width = (of64_KeyTo - of64_KeyFrom) / static_cast<float64_t>(ou32_BucketCount);
+         uint32_t u32_BucketBegin = u32_First;
+
+         //Keep the exact start and end of the visible lines
+         c_Indices.push_back(u32_First);
+         c_Indices.push_back(u32_End - 1U);
+
+         for (uint32_t u32_Bucket = 0U; u32_Bucket < ou32_BucketCount; ++u32_Bucket)
+         {
+            uint32_t u32_BucketEnd = u32_End;
+            if ((u32_Bucket + 1U) < ou32_BucketCount)
+            {
+               const float64_t f64_BucketKeyEnd = of64_KeyFrom + (f64_Width * static_cast<float64_t>(u32_Bucket + 1U));
+               u32_BucketEnd = std::min(u32_End, std::max(u32_BucketBegin,
+                                                          this->m_FindFirstIndex(f64_BucketKeyEnd, false)));
+            }
+            if (u32_BucketBegin < u32_BucketEnd)
+            {
+               uint32_t u32_MinIndex;
+               uint32_t u32_MaxIndex;
+               this->m_GetExtremes(u32_BucketBegin, u32_BucketEnd, u32_MinIndex, u32_MaxIndex);
+               c_Indices.push_back(u32_MinIndex);
+               c_Indices.push_back(u32_MaxIndex);
+            }
+            u32_BucketBegin = u32_BucketEnd;
+         }
+      }
+
+      //Right of visible range
+      if (u32_End < this->mu32_SampleCountInMemory)
+      {
+         c_Indices.push_back(u32_End);
+         this->m_AddRangeSummary(u32_End + 1U, this->mu32_SampleCountInMemory, c_Indices);
+      }
+
+      std::sort(c_Indices.begin(), c_Indices.end());
+      c_Indices.erase(std::unique(c_Indices.begin(), c_Indices.end()), c_Indices.end());
+
+      orc_View.resize(c_Indices.size());
+      for (uint32_t u32_It = 0U; u32_It < c_Indices.size(); ++u32_It)
+      {
+         orc_View[u32_It].f64_Key = this->m_GetKey(c_Indices[u32_It]);
+         orc_View[u32_It].f64_Value = this->m_GetValue(c_Indices[u32_It]);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read raw samples
+
+   Samples moved to the spill file are included. Index 0 is the oldest stored sample.
+
+   \param[in]   ou64_Start     Index of first sample
+   \param[in]   ou32_Count     Number of samples
+   \param[out]  orc_Samples    Read samples
+
+   \return
+   C_NO_ERR    Samples read
+   C_RANGE     Requested range exceeds the number of stored samples
+   C_RD_WR     Spill file could not be read
+*/
+//----------------------------------------------------------------------------------------------------------------------
+int32_t C_SyvDaChaSampleStore::ReadSamples(const uint64_t ou64_Start, const uint32_t ou32_Count,
+                                           std::vector<C_Sample> & orc_Samples) const
+{
+   int32_t s32_Retval = C_NO_ERR;
+
+   orc_Samples.clear();
+   if ((ou64_Start + ou32_Count) > this->GetSampleCount())
+   {
+      s32_Retval = C_RANGE;
+   }
+   else
+   {
+      uint64_t u64_Index = ou64_Start;
+      orc_Samples.resize(ou32_Count);
+
+      if (u64_Index < this->mu64_SampleCountSpilled)
+      {
+         const uint32_t u32_FromFile =
+            static_cast<uint32_t>(std::min(static_cast<uint64_t>(ou32_Count),
+                                           this->mu64_SampleCountSpilled - u64_Index));
+         std::vector<float64_t> c_Buffer(static_cast<size_t>(u32_FromFile) * 2U);
+         const std::streamsize s64_Size = static_cast<std::streamsize>(c_Buffer.size() * sizeof(float64_t));
+         std::ifstream c_File(this->mc_SpillFilePath.c_str(), std::ios::in | std::ios::binary);
+
+         c_File.seekg(static_cast<std::streamoff>(u64_Index * 2U * sizeof(float64_t)));
+         c_File.read(reinterpret_cast<char_t *>(&c_Buffer[0]), s64_Size);
+         if ((c_File.good() == false) || (c_File.gcount() != s64_Size))
+         {
+            orc_Samples.clear();
+            s32_Retval = C_RD_WR;
+         }
+         else
+         {
+            for (uint32_t u32_It = 0U; u32_It < u32_FromFile; ++u32_It)
+            {
+               orc_Samples[u32_It].f64_Key = c_Buffer[static_cast<size_t>(u32_It) * 2U];
+               orc_Samples[u32_It].f64_Value = c_Buffer[(static_cast<size_t>(u32_It) * 2U) + 1U];
+            }
+            u64_Index += u32_FromFile;
+         }
+      }
+
+      if (s32_Retval == C_NO_ERR)
+      {
+         for (uint32_t u32_It = static_cast<uint32_t>(u64_Index - ou64_Start); u32_It < ou32_Count; ++u32_It)
+         {
+            const uint32_t u32_MemoryIndex = static_cast<uint32_t>(u64_Index - this->mu64_SampleCountSpilled);
+            orc_Samples[u32_It].f64_Key = this->m_GetKey(u32_MemoryIndex);
+            orc_Samples[u32_It].f64_Value = this->m_GetValue(u32_MemoryIndex);
+            ++u64_Index;
+         }
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get key of sample in memory
+
+   \param[in]  ou32_Index  Index of sample in memory
+
+   \return
+   Key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_SyvDaChaSampleStore::m_GetKey(const uint32_t ou32_Index) const
+{
+   return this->mc_Chunks[ou32_Index / hu32_CHUNK_SIZE].c_Keys[ou32_Index % hu32_CHUNK_SIZE];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get value of sample in memory
+
+   \param[in]  ou32_Index  Index of sample in memory
+
+   \return
+   Value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64_t C_SyvDaChaSampleStore::m_GetValue(const uint32_t ou32_Index) const
+{
+   return this->mc_Chunks[ou32_Index / hu32_CHUNK_SIZE].c_Values[ou32_Index % hu32_CHUNK_SIZE];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find first sample in memory with a key at or after the given key
+
+   \param[in]  of64_Key    Key to search for
+   \param[in]  oq_Greater  true: search first key greater than of64_Key; false: greater or equal
+
+   \return
+   Index of sample (number of samples if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32_t C_SyvDaChaSampleStore::m_FindFirstIndex(const float64_t of64_Key, const bool oq_Greater) const
+{
+   uint32_t u32_Retval = this->mu32_SampleCountInMemory;
+   uint32_t u32_Low = 0U;
+   uint32_t u32_High = static_cast<uint32_t>(this->mc_Chunks.size());
+
+   //First chunk containing a matching key
+   while (u32_Low < u32_High)
+   {
+      const uint32_t u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      const float64_t f64_LastKey = this->mc_Chunks[u32_Mid].c_Keys.back();
+      const bool q_Match = (oq_Greater == true) ? (f64_LastKey > of64_Key) : (f64_LastKey >= of64_Key);
+      if (q_Match == true)
+      {
+         u32_High = u32_Mid;
+      }
+      else
+      {
+         u32_Low = u32_Mid + 1U;
+      }
+   }
+
+   if (u32_Low < this->mc_Chunks.size())
+   {
+      const std::vector<float64_t> & rc_Keys = this->mc_Chunks[u32_Low].c_Keys;
+      const std::vector<float64_t>::const_iterator c_It = (oq_Greater == true) ?
+                                                          std::upper_bound(rc_Keys.begin(), rc_Keys.end(), of64_Key) :
+                                                          std::lower_bound(rc_Keys.begin(), rc_Keys.end(), of64_Key);
+      u32_Retval = (u32_Low * hu32_CHUNK_SIZE) + static_cast<uint32_t>(c_It - rc_Keys.begin());
+   }
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get samples with minimum and maximum value in range
+
+   Uses the largest precomputed blocks fitting into the range.
+
+   \param[in]   ou32_Begin       Index of first sample (in memory)
+   \param[in]   ou32_End         Index after last sample; must be greater than ou32_Begin
+   \param[out]  oru32_MinIndex   Index of sample with minimum value
+   \param[out]  oru32_MaxIndex   Index of sample with maximum value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::m_GetExtremes(const uint32_t ou32_Begin, const uint32_t ou32_End,
+                                          uint32_t & oru32_MinIndex, uint32_t & oru32_MaxIndex) const
+{
+   uint32_t u32_Index = ou32_Begin;
+
+   oru32_MinIndex = ou32_Begin;
+   oru32_MaxIndex = ou32_Begin;
+
+   while (u32_Index < ou32_End)
+   {
+      const C_Chunk & rc_Chunk = this->mc_Chunks[u32_Index / hu32_CHUNK_SIZE];
+      const uint32_t u32_Offset = u32_Index % hu32_CHUNK_SIZE;
+      const uint32_t u32_Base = u32_Index - u32_Offset;
+      const uint32_t u32_Remaining = ou32_End - u32_Index;
+
+      if ((u32_Offset == 0U) && (u32_Remaining >= hu32_CHUNK_SIZE))
+      {
+         this->m_MergeExtremes(u32_Base, rc_Chunk.c_All, oru32_MinIndex, oru32_MaxIndex);
+         u32_Index += hu32_CHUNK_SIZE;
+      }
+      else if (((u32_Offset % mhu32_LEVEL2_SIZE) == 0U) && (u32_Remaining >= mhu32_LEVEL2_SIZE))
+      {
+         this->m_MergeExtremes(u32_Base, rc_Chunk.c_Level2[u32_Offset / mhu32_LEVEL2_SIZE], oru32_MinIndex,
+                               oru32_MaxIndex);
+         u32_Index += mhu32_LEVEL2_SIZE;
+      }
+      else if (((u32_Offset % mhu32_LEVEL1_SIZE) == 0U) && (u32_Remaining >= mhu32_LEVEL1_SIZE))
+      {
+         this->m_MergeExtremes(u32_Base, rc_Chunk.c_Level1[u32_Offset / mhu32_LEVEL1_SIZE], oru32_MinIndex,
+                               oru32_MaxIndex);
+         u32_Index += mhu32_LEVEL1_SIZE;
+      }
+      else
+      {
+         const C_Extremes c_Single = {u32_Offset, u32_Offset};
+         this->m_MergeExtremes(u32_Base, c_Single, oru32_MinIndex, oru32_MaxIndex);
+         ++u32_Index;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Merge precomputed extremes of a chunk into the current extremes
+
+   \param[in]      ou32_Base        Index of first sample of the chunk
+   \param[in]      orc_Extremes     Extremes (indices relative to the chunk)
+   \param[in,out]  oru32_MinIndex   Index of sample with minimum value
+   \param[in,out]  oru32_MaxIndex   Index of sample with maximum value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::m_MergeExtremes(const uint32_t ou32_Base, const C_Extremes & orc_Extremes,
+                                            uint32_t & oru32_MinIndex, uint32_t & oru32_MaxIndex) const
+{
+   const uint32_t u32_MinIndex = ou32_Base + orc_Extremes.u32_MinIndex;
+   const uint32_t u32_MaxIndex = ou32_Base + orc_Extremes.u32_MaxIndex;
+
+   if (this->m_GetValue(u32_MinIndex) < this->m_GetValue(oru32_MinIndex))
+   {
+      oru32_MinIndex = u32_MinIndex;
+   }
+   if (this->m_GetValue(u32_MaxIndex) > this->m_GetValue(oru32_MaxIndex))
+   {
+      oru32_MaxIndex = u32_MaxIndex;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add first, last, minimum and maximum sample of range
+
+   \param[in]      ou32_Begin    Index of first sample (in memory)
+   \param[in]      ou32_End      Index after last sample
+   \param[in,out]  orc_Indices   Indices to add to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::m_AddRangeSummary(const uint32_t ou32_Begin, const uint32_t ou32_End,
+                                              std::vector<uint32_t> & orc_Indices) const
+{
+   if (ou32_Begin < ou32_End)
+   {
+      uint32_t u32_MinIndex;
+      uint32_t u32_MaxIndex;
+
+      this->m_GetExtremes(ou32_Begin, ou32_End, u32_MinIndex, u32_MaxIndex);
+      orc_Indices.push_back(ou32_Begin);
+      orc_Indices.push_back(u32_MinIndex);
+      orc_Indices.push_back(u32_MaxIndex);
+      orc_Indices.push_back(ou32_End - 1U);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove oldest chunk from memory
+
+   Its samples are appended to the spill file if configured.
+   If writing fails spilling is stopped and the samples are discarded.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::m_EvictOldestChunk(void)
+{
+   const C_Chunk & rc_Chunk = this->mc_Chunks.front();
+   const uint32_t u32_Count = static_cast<uint32_t>(rc_Chunk.c_Keys.size());
+
+   if (this->mc_SpillFilePath.empty() == false)
+   {
+      std::vector<float64_t> c_Buffer(static_cast<size_t>(u32_Count) * 2U);
+      std::ofstream c_File;
+
+      for (uint32_t u32_It = 0U; u32_It < u32_Count; ++u32_It)
+      {
+         c_Buffer[static_cast<size_t>(u32_It) * 2U] = rc_Chunk.c_Keys[u32_It];
+         c_Buffer[(static_cast<size_t>(u32_It) * 2U) + 1U] = rc_Chunk.c_Values[u32_It];
+      }
+      //the first chunk starts a new file; left-overs of an earlier run are overwritten
+      c_File.open(this->mc_SpillFilePath.c_str(), std::ios::out | std::ios::binary |
+                  ((this->mu64_SampleCountSpilled > 0U) ? std::ios::app : std::ios::trunc));
+      c_File.write(reinterpret_cast<const char_t *>(&c_Buffer[0]),
+                   static_cast<std::streamsize>(c_Buffer.size() * sizeof(float64_t)));
+      c_File.close();
+      if (c_File.fail() == false)
+      {
+         this->mu64_SampleCountSpilled += u32_Count;
+      }
+      else
+      {
+         this->mc_SpillFilePath.clear();
+      }
+   }
+
+   this->mc_Chunks.pop_front();
+   this->mu32_SampleCountInMemory -= u32_Count;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update extremes of the block containing the new value
+
+   \param[in]      orc_Values       Values of chunk
+   \param[in]      ou32_Index       Index of new value in chunk
+   \param[in,out]  orc_Level        Extremes of all blocks of this level
+   \param[in]      ou32_BlockSize   Number of samples per block
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaChaSampleStore::mh_UpdateExtremes(const std::vector<float64_t> & orc_Values, const uint32_t ou32_Index,
+                                              std::vector<C_Extremes> & orc_Level, const uint32_t ou32_BlockSize)
+{
+   if ((ou32_Index % ou32_BlockSize) == 0U)
+   {
+      const C_Extremes c_New = {ou32_Index, ou32_Index};
+      orc_Level.push_back(c_New);
+   }
+   else
+   {
+      C_Extremes & rc_Block = orc_Level.back();
+      if (orc_Values[ou32_Index] < orc_Values[rc_Block.u32_MinIndex])
+      {
+         rc_Block.u32_MinIndex = ou32_Index;
+      }
+      else if (orc_Values[ou32_Index] > orc_Values[rc_Block.u32_MaxIndex])
+      {
+         rc_Block.u32_MaxIndex = ou32_Index;
+      }
+      else
+      {
+         //Nothing to do
+      }
+   }
+}
@@ -0,0 +1,111 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Time series storage with level of detail for one chart graph (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVDACHASAMPLESTORE_HPP
+#define C_SYVDACHASAMPLESTORE_HPP
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "stwtypes.hpp"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw
+{
+namespace opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvDaChaSampleStore
+{
+public:
+   class C_Sample
+   {
+   public:
+      float64_t f64_Key;
+      float64_t f64_Value;
+   };
+
+   C_SyvDaChaSampleStore(const uint32_t ou32_MaxSamplesInMemory, const std::string & orc_SpillFilePath);
+   ~C_SyvDaChaSampleStore(void);
+
+   void Append(const float64_t of64_Key, const float64_t of64_Value);
+   void Clear(void);
+   uint64_t GetSampleCount(void) const;
+   bool UpdateView(const float64_t of64_KeyFrom, const float64_t of64_KeyTo, const uint32_t ou32_BucketCount,
+                   std::vector<C_Sample> & orc_View);
+   void GetView(const float64_t of64_KeyFrom, const float64_t of64_KeyTo, const uint32_t ou32_BucketCount,
+                std::vector<C_Sample> & orc_View) const;
+   int32_t ReadSamples(const uint64_t ou64_Start, const uint32_t ou32_Count,
+                       std::vector<C_Sample> & orc_Samples) const;
+
+   static const uint32_t hu32_CHUNK_SIZE; ///< Number of samples per chunk
+
+private:
+   class C_Extremes
+   {
+   public:
+      uint32_t u32_MinIndex;
+      uint32_t u32_MaxIndex;
+   };
+
+   class C_Chunk
+   {
+   public:
+      std::vector<float64_t> c_Keys;
+      std::vector<float64_t> c_Values;
+      std::vector<C_Extremes> c_Level1; ///< Extremes of each block of mhu32_LEVEL1_SIZE samples
+      std::vector<C_Extremes> c_Level2; ///< Extremes of each block of mhu32_LEVEL2_SIZE samples
+      C_Extremes c_All;                 ///< Extremes of the whole chunk
+   };
+
+   std::deque<C_Chunk> mc_Chunks;
+   uint32_t mu32_SampleCountInMemory;
+   const uint32_t mu32_MaxSamplesInMemory;
+   std::string mc_SpillFilePath;
+   uint64_t mu64_SampleCountSpilled;
+
+   //Parameters of last view returned by UpdateView
+   uint32_t mu32_Revision;
+   uint32_t mu32_ViewRevision;
+   float64_t mf64_ViewKeyFrom;
+   float64_t mf64_ViewKeyTo;
+   uint32_t mu32_ViewBucketCount;
+
+   static const uint32_t mhu32_LEVEL1_SIZE;
+   static const uint32_t mhu32_LEVEL2_SIZE;
+
+   float64_t m_GetKey(const uint32_t ou32_Index) const;
+   float64_t m_GetValue(const uint32_t ou32_Index) const;
+   uint32_t m_FindFirstIndex(const float64_t of64_Key, const bool oq_Greater) const;
+   void m_GetExtremes(const uint32_t ou32_Begin, const uint32_t ou32_End, uint32_t & oru32_MinIndex,
+                      uint32_t & oru32_MaxIndex) const;
+   void m_MergeExtremes(const uint32_t ou32_Base, const C_Extremes & orc_Extremes, uint32_t & oru32_MinIndex,
+                        uint32_t & oru32_MaxIndex) const;
+   void m_AddRangeSummary(const uint32_t ou32_Begin, const uint32_t ou32_End,
+                          std::vector<uint32_t> & orc_Indices) const;
+   void m_EvictOldestChunk(void);
+   static void mh_UpdateExtremes(const std::vector<float64_t> & orc_Values, const uint32_t ou32_Index,
+                                 std::vector<C_Extremes> & orc_Level, const uint32_t ou32_BlockSize);
+
+   //Avoid call
+   C_SyvDaChaSampleStore(const C_SyvDaChaSampleStore &);
+   C_SyvDaChaSampleStore & operator =(const C_SyvDaChaSampleStore &) &;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+}
+} //end of namespace
+
+#endif
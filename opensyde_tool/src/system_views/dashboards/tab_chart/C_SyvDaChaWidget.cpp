@@ -212,9 +212,18 @@ void C_SyvDaChaWidget::ConnectionActiveChanged(const bool oq_Active, const QMap<
    if (oq_Active == true)
    {
       this->m_UpdateDataPoolElementTimeoutAndValidFlag();
+      //Only count values dropped during this connection
+      this->m_TakeDroppedValueCount();
    }
    else
    {
+      const uint32_t u32_Dropped = this->m_TakeDroppedValueCount();
+      if (u32_Dropped > 0U)
+      {
+         osc_write_log_warning("Dashboard chart",
+                               "Chart could not keep up with the received values; " +
+                               stw::scl::C_SclString::IntToStr(u32_Dropped) + " values were not shown.");
+      }
       //Clear error
       this->mc_CommmunicationErrors.clear();
       this->mc_InvalidDlcSignals.clear();
@@ -223,12 +232,19 @@ void C_SyvDaChaWidget::ConnectionActiveChanged(const bool oq_Active, const QMap<
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Updates all values of all dashboard widgets
+
+   All received values are taken in any case, so the chart has no gaps after being hidden.
+
+   \param[in]  oq_IsVisible  Flag if the chart is visible and shall be drawn
+   \param[in]  oq_UpdateAll  Flag to update all widgets (unused: the chart only draws new samples)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaChaWidget::UpdateShowValues(void)
+void C_SyvDaChaWidget::UpdateShowValues(const bool oq_IsVisible, const bool oq_UpdateAll)
 {
    uint32_t u32_Counter;
 
+   Q_UNUSED(oq_UpdateAll)
+
    for (u32_Counter = 0U; u32_Counter < this->GetWidgetDataPoolElementCount(); ++u32_Counter)
    {
       int32_t s32_Return;
@@ -256,6 +272,11 @@ void C_SyvDaChaWidget::UpdateShowValues(void)
          }
       }
    }
+
+   if (oq_IsVisible == true)
+   {
+      this->mpc_Ui->pc_ChartWidget->UpdateFrame();
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -55,7 +55,7 @@ public:
    void ConnectionActiveChanged(const bool oq_Active, const QMap<uint32_t,
                                                                  bool> & orc_MappingNodeToTrafficEncryptionStatus)
    override;
-   void UpdateShowValues(void) override;
+   void UpdateShowValues(const bool oq_IsVisible, const bool oq_UpdateAll) override;
    void UpdateTransmissionConfiguration(void) override;
    void HandleManualOperationFinished(const int32_t os32_Result, const uint8_t ou8_Nrc) override;
    void RegisterDataPoolElementCyclicError(
@@ -72,18 +72,6 @@ C_SyvRoRouteCalculation::~C_SyvRoRouteCalculation()
    delete this->mpc_Calculation;
 }
 
-//----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Returns all found routes
-
-   \return
-   Pointer to Vector with all found routes
-*/
-//----------------------------------------------------------------------------------------------------------------------
-const std::vector<C_OscRoutingRoute> * C_SyvRoRouteCalculation::GetRoutes(void) const
-{
-   return this->mpc_Calculation->GetRoutes();
-}
-
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Returns the best route
 